@@ -4,12 +4,21 @@
 #include "em_device.h"
 #if defined(USART_COUNT) && (USART_COUNT > 0)
 
+#include <stddef.h>
 #include "em_usart.h"
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+#include "em_ldma.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** Frame transmitted by USART_SpiTransferBuffer() when no TX data is given. */
+#ifndef USART_SPI_DUMMY_FRAME
+#define USART_SPI_DUMMY_FRAME 0xFF
+#endif
+
 USART_Databits_TypeDef USART_DataBits2Def(uint8_t bits);
 USART_Stopbits_TypeDef USART_StopBits2Def(uint8_t half_bits);
 USART_Parity_TypeDef USART_Parity2Def(uint8_t number);
@@ -19,6 +28,70 @@ void USART_FrameSet(USART_TypeDef *usart,
                     USART_Stopbits_TypeDef stopbits,
                     USART_Parity_TypeDef parity);
 
+void USART_TxBuffer(USART_TypeDef *usart, const uint8_t *data, size_t length);
+void USART_RxBuffer(USART_TypeDef *usart, uint8_t *data, size_t length);
+void USART_SpiTransferBuffer(USART_TypeDef *usart,
+                             const uint8_t *txData,
+                             uint8_t *rxData,
+                             size_t length);
+
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+/** Maximum number of frames in a single asynchronous transfer. */
+#define USART_TRANSFER_MAX_LENGTH \
+  ((_LDMA_CH_CTRL_XFERCNT_MASK >> _LDMA_CH_CTRL_XFERCNT_SHIFT) + 1U)
+
+typedef struct USART_Transfer USART_Transfer_TypeDef;
+
+/** Asynchronous transfer completion callback. */
+typedef void (*USART_TransferCallback_TypeDef)(USART_Transfer_TypeDef *transfer,
+                                               void *arg);
+
+/***************************************************************************//**
+ * @brief
+ *   State of an LDMA driven USART transfer.
+ *
+ * @note
+ *   The structure holds the LDMA descriptors, so it must stay allocated until
+ *   the transfer has completed. Initialize it with USART_TransferInit().
+ ******************************************************************************/
+struct USART_Transfer {
+  USART_TypeDef                  *usart;      /**< USART peripheral. */
+  int                            txChannel;   /**< LDMA channel for TX. */
+  int                            rxChannel;   /**< LDMA channel for RX. */
+  LDMA_Descriptor_t              txDescriptor;
+  LDMA_Descriptor_t              rxDescriptor;
+  uint32_t                       doneMask;    /**< Channel signalling completion. */
+  USART_TransferCallback_TypeDef callback;
+  void                           *arg;
+  volatile bool                  busy;        /**< True while a transfer runs. */
+  uint8_t                        txDummy;
+  uint8_t                        rxDummy;
+};
+
+void USART_TransferInit(USART_Transfer_TypeDef *transfer,
+                        USART_TypeDef *usart,
+                        int txChannel,
+                        int rxChannel);
+void USART_TxBufferAsync(USART_Transfer_TypeDef *transfer,
+                         const uint8_t *data,
+                         size_t length,
+                         USART_TransferCallback_TypeDef callback,
+                         void *arg);
+void USART_RxBufferAsync(USART_Transfer_TypeDef *transfer,
+                         uint8_t *data,
+                         size_t length,
+                         USART_TransferCallback_TypeDef callback,
+                         void *arg);
+void USART_SpiTransferBufferAsync(USART_Transfer_TypeDef *transfer,
+                                  const uint8_t *txData,
+                                  uint8_t *rxData,
+                                  size_t length,
+                                  USART_TransferCallback_TypeDef callback,
+                                  void *arg);
+bool USART_TransferIrqHandler(USART_Transfer_TypeDef *transfer,
+                              uint32_t pending);
+#endif /* defined(LDMA_PRESENT) && (LDMA_COUNT == 1) */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,336 @@
+#include "em_ldma_utils.h"
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+
+#include <string.h>
+#include "em_assert.h"
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/* Get the write position of the LDMA in the ring buffer. */
+static size_t streamWritePosition(LDMA_Stream_TypeDef *stream)
+{
+  size_t position = (size_t)(LDMA->CH[stream->channel].DST
+                             - (uint32_t)stream->buffer);
+
+  /* At the end of the last segment, before the first one is reloaded. */
+  if (position >= stream->size) {
+    position = 0;
+  }
+
+  return position;
+}
+
+/* Get the number of bytes written into the stream so far. */
+static uint32_t streamProduced(LDMA_Stream_TypeDef *stream)
+{
+  uint32_t written;
+  size_t writeIndex;
+  size_t position;
+
+  /* Retry if the interrupt handler updated the producer fields meanwhile.
+     It writes writeIndex before written. */
+  do {
+    written = stream->written;
+    writeIndex = stream->writeIndex;
+    position = streamWritePosition(stream);
+  } while (written != stream->written);
+
+  /* The LDMA may be some segments ahead of a pending interrupt. */
+  if (position < writeIndex) {
+    position += stream->size;
+  }
+
+  return written + (uint32_t)(position - writeIndex);
+}
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Start streaming from a peripheral into a ring buffer.
+ *
+ * @details
+ *   The buffer is split into @p segments segments of equal size. Each one is
+ *   filled by its own descriptor, and the last descriptor links back to the
+ *   first one. An interrupt is raised each time a segment is full.
+ *
+ * @note
+ *   LDMA_Init() must have been called. The application owns LDMA_IRQHandler()
+ *   and must call LDMA_StreamIrqHandler() from it.
+ *
+ * @param[out] stream
+ *   The stream to start.
+ *
+ * @param[in] channel
+ *   LDMA channel to use.
+ *
+ * @param[in] config
+ *   Transfer configuration, usually LDMA_TRANSFER_CFG_PERIPHERAL() with the
+ *   data valid request signal of the peripheral.
+ *
+ * @param[in] source
+ *   Peripheral data register to read from.
+ *
+ * @param[in] unitSize
+ *   Size of each unit read from the peripheral.
+ *
+ * @param[in] buffer
+ *   Ring buffer, aligned to @p unitSize.
+ *
+ * @param[in] size
+ *   Size of the ring buffer in bytes. Must be a multiple of @p segments times
+ *   the unit size.
+ *
+ * @param[in] descriptors
+ *   Array of @p segments descriptors. It must stay allocated while the stream
+ *   is running.
+ *
+ * @param[in] segments
+ *   Number of segments, at least two.
+ *
+ * @param[in] callback
+ *   Function to call when a segment is complete, or NULL.
+ *
+ * @param[in] arg
+ *   Argument passed to the callback.
+ ******************************************************************************/
+void LDMA_StreamStart(LDMA_Stream_TypeDef *stream,
+                      int channel,
+                      const LDMA_TransferCfg_t *config,
+                      const volatile void *source,
+                      LDMA_CtrlSize_t unitSize,
+                      void *buffer,
+                      size_t size,
+                      LDMA_Descriptor_t *descriptors,
+                      uint32_t segments,
+                      LDMA_StreamCallback_TypeDef callback,
+                      void *arg)
+{
+  size_t segmentSize;
+  size_t unitBytes;
+  uint32_t i;
+
+  EFM_ASSERT(segments >= 2U);
+  EFM_ASSERT((size % segments) == 0U);
+
+  unitBytes = (unitSize == ldmaCtrlSizeWord) ? 4U
+              : (unitSize == ldmaCtrlSizeHalf) ? 2U : 1U;
+  segmentSize = size / segments;
+
+  EFM_ASSERT((segmentSize % unitBytes) == 0U);
+  EFM_ASSERT((segmentSize / unitBytes)
+             <= ((_LDMA_CH_CTRL_XFERCNT_MASK >> _LDMA_CH_CTRL_XFERCNT_SHIFT) + 1U));
+  EFM_ASSERT(((uint32_t)buffer % unitBytes) == 0U);
+
+  stream->channel = channel;
+  stream->buffer = buffer;
+  stream->size = size;
+  stream->segmentSize = segmentSize;
+  stream->callback = callback;
+  stream->arg = arg;
+  stream->written = 0;
+  stream->writeIndex = 0;
+  stream->consumed = 0;
+  stream->readIndex = 0;
+  stream->overruns = 0;
+  stream->lost = 0;
+
+  for (i = 0; i < segments; i++) {
+    LDMA_Descriptor_t descriptor =
+      LDMA_DESCRIPTOR_SINGLE_P2M_BYTE(source,
+                                      stream->buffer + (i * segmentSize),
+                                      segmentSize / unitBytes);
+
+    descriptor.xfer.size = unitSize;
+    descriptor.xfer.linkMode = ldmaLinkModeAbs;
+    descriptor.xfer.link = 1;
+    descriptor.xfer.linkAddr =
+      (int32_t)((uint32_t)&descriptors[(i + 1U) % segments] >> 2);
+    descriptors[i] = descriptor;
+  }
+
+  LDMA_StartTransfer(channel, config, &descriptors[0]);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Stop a stream.
+ *
+ * @details
+ *   Data already in the ring buffer can still be consumed.
+ *
+ * @param[in] stream
+ *   The stream to stop.
+ ******************************************************************************/
+void LDMA_StreamStop(LDMA_Stream_TypeDef *stream)
+{
+  LDMA_StopTransfer(stream->channel);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Handle the LDMA interrupt of a stream.
+ *
+ * @details
+ *   Call this from LDMA_IRQHandler() with the pending and enabled interrupt
+ *   flags, as returned by LDMA_IntGetEnabled(). The write position is taken
+ *   from the channel, so segments completed while the interrupt was pending
+ *   are accounted for as well.
+ *
+ * @param[in] stream
+ *   The stream to check.
+ *
+ * @param[in] pending
+ *   Pending LDMA interrupt flags.
+ *
+ * @return
+ *   True if the interrupt belonged to this stream.
+ ******************************************************************************/
+bool LDMA_StreamIrqHandler(LDMA_Stream_TypeDef *stream, uint32_t pending)
+{
+  uint32_t mask = 1UL << (uint8_t)stream->channel;
+  size_t segmentIndex;
+  size_t writeIndex;
+
+  if (!(pending & mask)) {
+    return false;
+  }
+
+  LDMA_IntClear(mask);
+
+  writeIndex = stream->writeIndex;
+  segmentIndex = streamWritePosition(stream);
+  segmentIndex -= segmentIndex % stream->segmentSize;
+
+  if (segmentIndex != writeIndex) {
+    uint32_t written = stream->written
+                       + (uint32_t)((segmentIndex + stream->size - writeIndex)
+                                    % stream->size);
+
+    stream->writeIndex = segmentIndex;
+    stream->written = written;
+  }
+
+  if (stream->callback != NULL) {
+    stream->callback(stream, stream->arg);
+  }
+
+  return true;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the number of bytes that can be consumed.
+ *
+ * @details
+ *   If the LDMA has caught up with unread data, that data is discarded and
+ *   counted in the overruns and lost fields.
+ *
+ * @param[in] stream
+ *   The stream to check.
+ *
+ * @return
+ *   Number of bytes that can be consumed.
+ ******************************************************************************/
+size_t LDMA_StreamAvailable(LDMA_Stream_TypeDef *stream)
+{
+  uint32_t available = streamProduced(stream) - stream->consumed;
+
+  /* Unread data in the segment being written is being overwritten. */
+  if (available > (stream->size - stream->segmentSize)) {
+    stream->overruns++;
+    stream->lost += available;
+    stream->readIndex = (stream->readIndex + (available % stream->size))
+                        % stream->size;
+    stream->consumed += available;
+    available = 0;
+  }
+
+  return (size_t)available;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the unread data that is contiguous in the ring buffer.
+ *
+ * @details
+ *   This allows the data to be processed in place, after which it is released
+ *   with LDMA_StreamConsume().
+ *
+ * @param[in] stream
+ *   The stream to read.
+ *
+ * @param[out] length
+ *   Number of contiguous bytes at the returned address.
+ *
+ * @return
+ *   The next unread byte.
+ ******************************************************************************/
+const void *LDMA_StreamPeek(LDMA_Stream_TypeDef *stream, size_t *length)
+{
+  size_t available = LDMA_StreamAvailable(stream);
+  size_t contiguous = stream->size - stream->readIndex;
+
+  *length = (available < contiguous) ? available : contiguous;
+
+  return stream->buffer + stream->readIndex;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Release data from the stream.
+ *
+ * @param[in] stream
+ *   The stream to release data from.
+ *
+ * @param[in] length
+ *   Number of bytes to release, at most LDMA_StreamAvailable().
+ ******************************************************************************/
+void LDMA_StreamConsume(LDMA_Stream_TypeDef *stream, size_t length)
+{
+  size_t readIndex = stream->readIndex + length;
+
+  EFM_ASSERT(length <= stream->size);
+
+  if (readIndex >= stream->size) {
+    readIndex -= stream->size;
+  }
+
+  stream->readIndex = readIndex;
+  stream->consumed += (uint32_t)length;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Copy data out of the stream.
+ *
+ * @param[in] stream
+ *   The stream to read.
+ *
+ * @param[out] data
+ *   Buffer for the data.
+ *
+ * @param[in] length
+ *   Size of the buffer in bytes.
+ *
+ * @return
+ *   Number of bytes copied.
+ ******************************************************************************/
+size_t LDMA_StreamRead(LDMA_Stream_TypeDef *stream, void *data, size_t length)
+{
+  size_t available = LDMA_StreamAvailable(stream);
+  size_t count = (length < available) ? length : available;
+  size_t first = stream->size - stream->readIndex;
+
+  if (first > count) {
+    first = count;
+  }
+
+  memcpy(data, stream->buffer + stream->readIndex, first);
+  memcpy((uint8_t *)data + first, stream->buffer, count - first);
+  LDMA_StreamConsume(stream, count);
+
+  return count;
+}
+
+#endif /* defined(LDMA_PRESENT) && (LDMA_COUNT == 1) */
@@ -3000,6 +3000,26 @@ __STATIC_INLINE uint32_t CMU_PrescToLog2(uint32_t presc)
 }
 #endif // !defined(_SILICON_LABS_32B_SERIES_0)
 
+#if defined(CMU_CLOCK_FREQ_CACHE)
+#if !defined(CMU_CLOCK_FREQ_CACHE_SIZE)
+/** Number of clock points whose frequency is cached by CMU_ClockFreqGet(). */
+#define CMU_CLOCK_FREQ_CACHE_SIZE           16U
+#endif
+
+#if !defined(CMU_CLOCK_CHANGE_SUBSCRIBERS_MAX)
+/** Maximum number of functions registered with CMU_ClockChangeSubscribe(). */
+#define CMU_CLOCK_CHANGE_SUBSCRIBERS_MAX    4U
+#endif
+
+/** Clock change callback, called with a clock point and its new frequency in Hz. */
+typedef void (*CMU_ClockChangeCallback_TypeDef)(CMU_Clock_TypeDef clock,
+                                                uint32_t freq);
+
+void CMU_ClockFreqCacheRefresh(void);
+bool CMU_ClockChangeSubscribe(CMU_ClockChangeCallback_TypeDef callback);
+void CMU_ClockChangeUnsubscribe(CMU_ClockChangeCallback_TypeDef callback);
+#endif // defined(CMU_CLOCK_FREQ_CACHE)
+
 /** @} (end addtogroup CMU) */
 /** @} (end addtogroup emlib) */
 
@@ -263,6 +263,49 @@ void  CORE_InitNvicVectorTable(uint32_t *sourceTable,
                                void *defaultHandler,
                                bool overwriteActive);
 
+#if defined(CORE_PROFILE)
+#if !defined(CORE_PROFILE_SITES)
+/** Number of call sites tracked by the interrupt masking profiler. */
+#define CORE_PROFILE_SITES              16U
+#endif
+
+#if !defined(CORE_PROFILE_HISTOGRAM_BINS)
+/** Number of bins in the masked duration histogram. Bin n counts durations
+ *  of 2^(n-1) up to 2^n - 1 cycles, the last bin also counts longer ones. */
+#define CORE_PROFILE_HISTOGRAM_BINS     20U
+#endif
+
+#if !defined(CORE_PROFILE_NVIC_SECTIONS)
+/** Number of simultaneously open NVIC mask sections tracked by the
+ *  interrupt masking profiler. */
+#define CORE_PROFILE_NVIC_SECTIONS      4U
+#endif
+
+/** Worst case interrupt masking recorded for a call site. */
+typedef struct {
+  const void *site;     /*!< Return address of the call that masked interrupts. */
+  uint32_t count;       /*!< Number of masked intervals started at the site. */
+  uint32_t maxCycles;   /*!< Longest masked interval started at the site. */
+  bool nvic;            /*!< True for NVIC mask sections, false for PRIMASK
+                             or BASEPRI masking. */
+} CORE_profileSite_t;
+
+/** Interrupt masking profile summary. */
+typedef struct {
+  uint32_t intervals;   /*!< Number of PRIMASK or BASEPRI masked intervals. */
+  uint32_t maxCycles;   /*!< Longest PRIMASK or BASEPRI masked interval. */
+  const void *maxSite;  /*!< Call site of the longest masked interval. */
+  uint32_t dropped;     /*!< Intervals from sites which did not fit the site
+                             table. They are still counted in the histogram. */
+  uint32_t histogram[CORE_PROFILE_HISTOGRAM_BINS]; /*!< Masked durations in
+                                                        log2 cycle bins. */
+} CORE_profile_t;
+
+void     CORE_ProfileReset(void);
+void     CORE_ProfileGet(CORE_profile_t *profile);
+uint32_t CORE_ProfileGetSites(CORE_profileSite_t *sites, uint32_t maxSites);
+#endif // defined(CORE_PROFILE)
+
 #ifdef __cplusplus
 }
 #endif
@@ -112,6 +112,8 @@ extern "C" {
  *   The SHA APIs include support for
  *   @li SHA-1 @ref CRYPTO_SHA_1
  *   @li SHA-256 @ref CRYPTO_SHA_256
+ *   @li Incremental SHA-1 and SHA-256 @ref CRYPTO_SHA_Init,
+ *       @ref CRYPTO_SHA_Update and @ref CRYPTO_SHA_Final
  *
  *   The SHA-1 implementation is FIPS-180-1 compliant, ref:
  *   @li Wikipedia -  SHA-1, en.wikipedia.org/wiki/SHA-1
@@ -566,6 +568,28 @@ typedef uint8_t CRYPTO_SHA1_Digest_TypeDef[CRYPTO_SHA1_DIGEST_SIZE_IN_BYTES];
 /** SHA-256 Digest type. */
 typedef uint8_t CRYPTO_SHA256_Digest_TypeDef[CRYPTO_SHA256_DIGEST_SIZE_IN_BYTES];
 
+/** SHA algorithm selection for the incremental SHA functions. */
+typedef enum {
+  cryptoShaSha1,    /**< SHA-1. */
+  cryptoShaSha256   /**< SHA-256. */
+} CRYPTO_ShaMode_TypeDef;
+
+/**
+ * @brief
+ *   Incremental SHA context, see @ref CRYPTO_SHA_Init().
+ *
+ * @note
+ *   The fields are private to the SHA functions.
+ */
+typedef struct {
+  CRYPTO_TypeDef         *crypto;   /**< CRYPTO module doing the hashing. */
+  CRYPTO_ShaMode_TypeDef mode;      /**< Selected algorithm. */
+  uint32_t               state[CRYPTO_DDATA_SIZE_IN_32BIT_WORDS]; /**< DDATA1 between calls. */
+  uint32_t               block[CRYPTO_QDATA_SIZE_IN_32BIT_WORDS]; /**< Partial block. */
+  uint32_t               blockLen;  /**< Number of bytes in the partial block. */
+  uint64_t               msgLen;    /**< Total message length in bytes. */
+} CRYPTO_SHA_Context_TypeDef;
+
 /**
  * @brief
  *   AES counter modification function pointer.
@@ -1118,6 +1142,17 @@ void CRYPTO_SHA_256(CRYPTO_TypeDef              *crypto,
                     uint64_t                     msgLen,
                     CRYPTO_SHA256_Digest_TypeDef digest);
 
+void CRYPTO_SHA_Init(CRYPTO_SHA_Context_TypeDef *ctx,
+                     CRYPTO_TypeDef             *crypto,
+                     CRYPTO_ShaMode_TypeDef     mode);
+
+void CRYPTO_SHA_Update(CRYPTO_SHA_Context_TypeDef *ctx,
+                       const uint8_t              *msg,
+                       uint32_t                   msgLen);
+
+void CRYPTO_SHA_Final(CRYPTO_SHA_Context_TypeDef *ctx,
+                      uint8_t                    *digest);
+
 void CRYPTO_Mul(CRYPTO_TypeDef *crypto,
                 uint32_t * A, int aSize,
                 uint32_t * B, int bSize,
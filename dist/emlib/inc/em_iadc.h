@@ -902,6 +902,20 @@ IADC_Result_t IADC_readSingleResult(IADC_TypeDef *iadc);
 IADC_Result_t IADC_pullSingleFifoResult(IADC_TypeDef *iadc);
 IADC_Result_t IADC_readScanResult(IADC_TypeDef *iadc);
 IADC_Result_t IADC_pullScanFifoResult(IADC_TypeDef *iadc);
+uint32_t IADC_pullSingleFifoResults(IADC_TypeDef *iadc,
+                                    IADC_Result_t *results,
+                                    uint32_t max);
+uint32_t IADC_pullSingleFifoResultArrays(IADC_TypeDef *iadc,
+                                         uint32_t *data,
+                                         uint8_t *id,
+                                         uint32_t max);
+uint32_t IADC_pullScanFifoResults(IADC_TypeDef *iadc,
+                                  IADC_Result_t *results,
+                                  uint32_t max);
+uint32_t IADC_pullScanFifoResultArrays(IADC_TypeDef *iadc,
+                                       uint32_t *data,
+                                       uint8_t *id,
+                                       uint32_t max);
 
 /***************************************************************************//**
  * @brief
@@ -37,6 +37,7 @@
 #include "em_bus.h"
 #include "em_cmu.h"
 #include "em_common.h"
+#include "em_core.h"
 #include "em_emu.h"
 #include "em_gpio.h"
 #include "em_system.h"
@@ -56,6 +57,19 @@
  * @{
  ******************************************************************************/
 
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+// Clock setters call this after the clock tree has been modified.
+#if defined(CMU_CLOCK_FREQ_CACHE)
+#define CMU_CLOCK_FREQ_CACHE_REFRESH()  CMU_ClockFreqCacheRefresh()
+#else
+#define CMU_CLOCK_FREQ_CACHE_REFRESH()
+#endif
+
+static uint32_t clockFreqCompute(CMU_Clock_TypeDef clock);
+
+/** @endcond */
+
 #if defined(_SILICON_LABS_32B_SERIES_2)
 
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
@@ -220,7 +234,7 @@ void CMU_ClockEnable(CMU_Clock_TypeDef clock, bool enable)
 
 /***************************************************************************//**
  * @brief
- *   Get clock frequency for a clock point.
+ *   Compute the clock frequency of a clock point from the CMU registers.
  *
  * @param[in] clock
  *   Clock point to fetch frequency for.
@@ -228,7 +242,7 @@ void CMU_ClockEnable(CMU_Clock_TypeDef clock, bool enable)
  * @return
  *   The current frequency in Hz.
  ******************************************************************************/
-uint32_t CMU_ClockFreqGet(CMU_Clock_TypeDef clock)
+static uint32_t clockFreqCompute(CMU_Clock_TypeDef clock)
 {
   uint32_t ret = 0U;
 
@@ -447,7 +461,7 @@ static void rhclkPrescMax(void)
  ******************************************************************************/
 static void rhclkPrescOptimize(void)
 {
-  if (CMU_ClockFreqGet(cmuClock_SYSCLK) <= CMU_MAX_RHCLK_FREQ) {
+  if (clockFreqCompute(cmuClock_SYSCLK) <= CMU_MAX_RHCLK_FREQ) {
     // Set smallest prescaler (DIV1).
     CMU->SYSCLKCTRL_CLR = CMU_SYSCLKCTRL_RHCLKPRESC;
   }
@@ -462,7 +476,7 @@ static void rhclkPrescOptimize(void)
 
 /***************************************************************************//**
  * @brief
- *   Get clock frequency for a clock point.
+ *   Compute the clock frequency of a clock point from the CMU registers.
  *
  * @param[in] clock
  *   Clock point to fetch frequency for.
@@ -470,7 +484,7 @@ static void rhclkPrescOptimize(void)
  * @return
  *   The current frequency in Hz.
  ******************************************************************************/
-uint32_t CMU_ClockFreqGet(CMU_Clock_TypeDef clock)
+static uint32_t clockFreqCompute(CMU_Clock_TypeDef clock)
 {
   uint32_t ret = 0U;
 
@@ -604,6 +618,8 @@ void CMU_HFRCOEM23BandSet(CMU_HFRCOEM23Freq_TypeDef freq)
 
   // Activate new band selection
   HFRCOEM23->CAL = freqCal;
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
@@ -1215,6 +1231,8 @@ void CMU_ClockDivSet(CMU_Clock_TypeDef clock, CMU_ClkDiv_TypeDef div)
       EFM_ASSERT(false);
       break;
   }
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 
 /***************************************************************************//**
@@ -1736,6 +1754,8 @@ void CMU_ClockSelectSet(CMU_Clock_TypeDef clock, CMU_Select_TypeDef ref)
       EFM_ASSERT(false);
       break;
   }
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 
 /**************************************************************************//**
@@ -1876,6 +1896,8 @@ bool CMU_DPLLLock(const CMU_DPLLInit_TypeDef *init)
 #endif
   }
 
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
+
   if (lockStatus == DPLL_IF_LOCK) {
     return true;
   }
@@ -1985,6 +2007,8 @@ void CMU_HFRCODPLLBandSet(CMU_HFRCODPLLFreq_TypeDef freq)
     EMU_VScaleEM01ByClock(0, true);
   }
 #endif
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 
 /**************************************************************************//**
@@ -2134,6 +2158,8 @@ void CMU_HFXOInit(const CMU_HFXOInit_TypeDef *hfxoInit)
   if (hfxoInit->regLock) {
     HFXO0->LOCK = ~HFXO_LOCK_LOCKKEY_UNLOCK;
   }
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 
 /**************************************************************************//**
@@ -2193,6 +2219,8 @@ void CMU_LFXOInit(const CMU_LFXOInit_TypeDef *lfxoInit)
   if (lfxoInit->regLock) {
     LFXO->LOCK = ~LFXO_LOCK_LOCKKEY_UNLOCK;
   }
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 
 #if defined(PLFRCO_PRESENT)
@@ -2771,7 +2799,7 @@ static void pclkDivOptimize(void)
 {
   CMU_ClkDiv_TypeDef div = 2U;
 
-  if (CMU_ClockFreqGet(cmuClock_HCLK) <= CMU_MAX_PCLK_FREQ) {
+  if (clockFreqCompute(cmuClock_HCLK) <= CMU_MAX_PCLK_FREQ) {
     div = 1U;
   }
   CMU_ClockDivSet(cmuClock_PCLK, div);
@@ -4266,6 +4294,8 @@ void CMU_AUXHFRCOBandSet(CMU_AUXHFRCOBand_TypeDef band)
                            | _CMU_AUXHFRCOCTRL_TUNING_MASK))
                       | (band << _CMU_AUXHFRCOCTRL_BAND_SHIFT)
                       | (tuning << _CMU_AUXHFRCOCTRL_TUNING_SHIFT);
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 #endif /* _CMU_AUXHFRCOCTRL_BAND_MASK */
 
@@ -4383,6 +4413,8 @@ void CMU_AUXHFRCOBandSet(CMU_AUXHFRCOFreq_TypeDef setFreq)
       break;
   }
   CMU->AUXHFRCOCTRL = freqCal;
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 #endif /* _CMU_AUXHFRCOCTRL_FREQRANGE_MASK */
 
@@ -4973,6 +5005,8 @@ void CMU_ClockDivSet(CMU_Clock_TypeDef clock, CMU_ClkDiv_TypeDef div)
       break;
   }
 #endif
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 
 /***************************************************************************//**
@@ -5121,7 +5155,7 @@ void CMU_ClockEnable(CMU_Clock_TypeDef clock, bool enable)
 
 /***************************************************************************//**
  * @brief
- *   Get the clock frequency for a clock point.
+ *   Compute the clock frequency of a clock point from the CMU registers.
  *
  * @param[in] clock
  *   A clock point to fetch the frequency for.
@@ -5129,7 +5163,7 @@ void CMU_ClockEnable(CMU_Clock_TypeDef clock, bool enable)
  * @return
  *   The current frequency in Hz.
  ******************************************************************************/
-uint32_t CMU_ClockFreqGet(CMU_Clock_TypeDef clock)
+static uint32_t clockFreqCompute(CMU_Clock_TypeDef clock)
 {
   uint32_t ret;
 
@@ -5955,6 +5989,8 @@ void CMU_ClockPrescSet(CMU_Clock_TypeDef clock, CMU_ClkPresc_TypeDef presc)
       EFM_ASSERT(false);
       break;
   }
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 #endif
 
@@ -7233,6 +7269,8 @@ void CMU_ClockSelectSet(CMU_Clock_TypeDef clock, CMU_Select_TypeDef ref)
       EFM_ASSERT(false);
       break;
   }
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 
 #if defined(CMU_OSCENCMD_DPLLEN)
@@ -7380,6 +7418,8 @@ bool CMU_DPLLLock(const CMU_DPLLInit_TypeDef *init)
   EMU_VScaleEM01ByClock(0, true);
 #endif
 
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
+
   if (lockStatus == CMU_IF_DPLLRDY) {
     return true;
   }
@@ -7532,6 +7572,8 @@ void CMU_HFRCOBandSet(CMU_HFRCOBand_TypeDef band)
   /* Reduce HFLE frequency if possible. */
   setHfLeConfig(SystemCoreClockGet());
 #endif
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 #endif /* _CMU_HFRCOCTRL_BAND_MASK */
 
@@ -7712,6 +7754,8 @@ void CMU_HFRCOBandSet(CMU_HFRCOFreq_TypeDef setFreq)
     /* Set optimized HFPER clock-tree prescalers. */
     hfperClkOptimizedPrescaler();
   }
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 #endif /* _CMU_HFRCOCTRL_FREQRANGE_MASK */
 
@@ -7828,6 +7872,8 @@ void CMU_USHFRCOBandSet(CMU_USHFRCOFreq_TypeDef setFreq)
   while (BUS_RegBitRead(&CMU->SYNCBUSY, _CMU_SYNCBUSY_USHFRCOBSY_SHIFT)) ;
 
   CMU->USHFRCOCTRL = freqCal;
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 #endif /* _CMU_USHFRCOCTRL_FREQRANGE_MASK  */
 
@@ -7900,6 +7946,8 @@ void CMU_HFXOAutostartEnable(uint32_t userSel,
   /* Update HFXOCTRL after wait-states are updated as HF may automatically switch
      to HFXO when automatic select is enabled . */
   CMU->HFXOCTRL = hfxoCtrl;
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 #endif
 
@@ -8044,6 +8092,8 @@ void CMU_HFXOInit(const CMU_HFXOInit_TypeDef *hfxoInit)
               | (hfxoInit->mode << _CMU_CTRL_HFXOMODE_SHIFT)
               | (hfxoInit->glitchDetector ? CMU_CTRL_HFXOGLITCHDETEN : 0);
 #endif
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 
 /***************************************************************************//**
@@ -8088,6 +8138,8 @@ void CMU_LCDClkFDIVSet(uint32_t div)
   div        <<= _CMU_LCDCTRL_FDIV_SHIFT;
   div         &= _CMU_LCDCTRL_FDIV_MASK;
   CMU->LCDCTRL = (CMU->LCDCTRL & ~_CMU_LCDCTRL_FDIV_MASK) | div;
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 #else
   (void)div;  /* Unused parameter. */
 #endif /* defined(LCD_PRESENT) */
@@ -8146,6 +8198,8 @@ void CMU_LFXOInit(const CMU_LFXOInit_TypeDef *lfxoInit)
   BUS_RegBitWrite(&EMU->AUXCTRL, _EMU_AUXCTRL_REDLFXOBOOST_SHIFT, emuReduce ? 1 : 0);
 #endif
 #endif
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 
 /***************************************************************************//**
@@ -8699,6 +8753,8 @@ void CMU_PCNTClockExternalSet(unsigned int instance, bool external)
   (void)instance;  /* An unused parameter */
   (void)external;  /* An unused parameter */
 #endif
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 
 #if defined(_CMU_USHFRCOCONF_BAND_MASK)
@@ -8784,11 +8840,248 @@ void CMU_USHFRCOBandSet(CMU_USHFRCOBand_TypeDef band)
   if (band == cmuUSHFRCOBand_24MHz) {
     BUS_RegBitWrite(&CMU->USHFRCOCONF, _CMU_USHFRCOCONF_USHFRCODIV2DIS_SHIFT, 1);
   }
+
+  CMU_CLOCK_FREQ_CACHE_REFRESH();
 }
 #endif
 
 #endif // defined(_SILICON_LABS_32B_SERIES_2)
 
+#if defined(CMU_CLOCK_FREQ_CACHE)
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+// Fully associative cache of clock point frequencies.
+static struct clockFreqCacheEntry {
+  CMU_Clock_TypeDef clock;
+  uint32_t          freq;
+  bool              valid;
+} clockFreqCache[CMU_CLOCK_FREQ_CACHE_SIZE];
+
+// Index of the entry to be replaced on the next miss with a full cache.
+static uint32_t clockFreqCacheNext;
+
+// Incremented by every refresh. A frequency computed while this changed may
+// predate the clock change and must not be cached.
+static uint32_t clockFreqCacheGeneration;
+
+static CMU_ClockChangeCallback_TypeDef
+  clockChangeCallbacks[CMU_CLOCK_CHANGE_SUBSCRIBERS_MAX];
+
+/** @endcond */
+#endif
+
+/***************************************************************************//**
+ * @brief
+ *   Get clock frequency for a clock point.
+ *
+ * @details
+ *   When CMU_CLOCK_FREQ_CACHE is defined, the frequency of a clock point is
+ *   computed from the CMU registers the first time it is requested and
+ *   returned from a cache afterwards. The cache is updated by the clock
+ *   setters of this module. Code modifying the clock tree by any other means,
+ *   including direct register writes and @ref SystemHFXOClockSet(), must call
+ *   @ref CMU_ClockFreqCacheRefresh() afterwards.
+ *
+ * @param[in] clock
+ *   A clock point to fetch frequency for.
+ *
+ * @return
+ *   A clock frequency for a clock point.
+ ******************************************************************************/
+uint32_t CMU_ClockFreqGet(CMU_Clock_TypeDef clock)
+{
+#if defined(CMU_CLOCK_FREQ_CACHE)
+  CORE_DECLARE_IRQ_STATE;
+  uint32_t generation;
+  uint32_t freq;
+  uint32_t i;
+  uint32_t slot;
+
+  CORE_ENTER_CRITICAL();
+  for (i = 0U; i < CMU_CLOCK_FREQ_CACHE_SIZE; i++) {
+    if (clockFreqCache[i].valid && (clockFreqCache[i].clock == clock)) {
+      freq = clockFreqCache[i].freq;
+      CORE_EXIT_CRITICAL();
+      return freq;
+    }
+  }
+  generation = clockFreqCacheGeneration;
+  CORE_EXIT_CRITICAL();
+
+  // Computing a frequency involves many register reads and divisions, keep
+  // interrupts enabled while doing it.
+  freq = clockFreqCompute(clock);
+
+  CORE_ENTER_CRITICAL();
+  // Another context may have inserted the clock point in the meantime. Its
+  // entry is kept up to date by the refresh, so it wins over this result.
+  slot = CMU_CLOCK_FREQ_CACHE_SIZE;
+  for (i = 0U; i < CMU_CLOCK_FREQ_CACHE_SIZE; i++) {
+    if (clockFreqCache[i].valid && (clockFreqCache[i].clock == clock)) {
+      freq = clockFreqCache[i].freq;
+      CORE_EXIT_CRITICAL();
+      return freq;
+    }
+    if (!clockFreqCache[i].valid && (slot == CMU_CLOCK_FREQ_CACHE_SIZE)) {
+      slot = i;
+    }
+  }
+  // The clock tree changed while the frequency was computed. Nothing would
+  // correct a stale entry later, so do not cache the result.
+  if (generation != clockFreqCacheGeneration) {
+    CORE_EXIT_CRITICAL();
+    return freq;
+  }
+  if (slot == CMU_CLOCK_FREQ_CACHE_SIZE) {
+    slot = clockFreqCacheNext;
+    clockFreqCacheNext = (clockFreqCacheNext + 1U) % CMU_CLOCK_FREQ_CACHE_SIZE;
+  }
+  clockFreqCache[slot].clock = clock;
+  clockFreqCache[slot].freq  = freq;
+  clockFreqCache[slot].valid = true;
+  CORE_EXIT_CRITICAL();
+
+  return freq;
+#else
+  return clockFreqCompute(clock);
+#endif
+}
+
+#if defined(CMU_CLOCK_FREQ_CACHE)
+/***************************************************************************//**
+ * @brief
+ *   Recompute all cached clock point frequencies.
+ *
+ * @details
+ *   Every clock point whose frequency has changed is updated in the cache and
+ *   reported to the subscribers registered with
+ *   @ref CMU_ClockChangeSubscribe(). Clock points never read through
+ *   @ref CMU_ClockFreqGet() are not tracked and not reported.
+ *
+ *   This function is called by the clock setters of this module and on
+ *   energy mode transitions. It must be called by any code modifying the
+ *   clock tree outside of this module.
+ ******************************************************************************/
+void CMU_ClockFreqCacheRefresh(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+  CMU_Clock_TypeDef clock;
+  uint32_t generation;
+  uint32_t freq;
+  uint32_t i;
+  uint32_t j;
+  bool valid;
+  bool changed;
+
+  CORE_ENTER_CRITICAL();
+  generation = ++clockFreqCacheGeneration;
+  CORE_EXIT_CRITICAL();
+
+  for (i = 0U; i < CMU_CLOCK_FREQ_CACHE_SIZE; i++) {
+    CORE_ENTER_CRITICAL();
+    valid = clockFreqCache[i].valid;
+    clock = clockFreqCache[i].clock;
+    CORE_EXIT_CRITICAL();
+
+    if (!valid) {
+      continue;
+    }
+
+    freq = clockFreqCompute(clock);
+
+    CORE_ENTER_CRITICAL();
+    // Leave the rest to a refresh which interrupted this one, its results are
+    // newer. Skip the entry if it was replaced while the frequency was
+    // computed.
+    if (generation != clockFreqCacheGeneration) {
+      CORE_EXIT_CRITICAL();
+      return;
+    }
+    changed = clockFreqCache[i].valid
+              && (clockFreqCache[i].clock == clock)
+              && (clockFreqCache[i].freq != freq);
+    if (changed) {
+      clockFreqCache[i].freq = freq;
+    }
+    CORE_EXIT_CRITICAL();
+
+    if (changed) {
+      for (j = 0U; j < CMU_CLOCK_CHANGE_SUBSCRIBERS_MAX; j++) {
+        CMU_ClockChangeCallback_TypeDef callback = clockChangeCallbacks[j];
+        if (callback != NULL) {
+          callback(clock, freq);
+        }
+      }
+    }
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Register a function to be called when a clock point frequency changes.
+ *
+ * @details
+ *   The callback is called from the context that modified the clock tree,
+ *   with the clock point and its new frequency. It must not modify the clock
+ *   tree and may be called more than once for a single clock change. Only
+ *   clock points read at least once through @ref CMU_ClockFreqGet() are
+ *   reported.
+ *
+ * @param[in] callback
+ *   A function to call on clock changes.
+ *
+ * @return
+ *   True if the callback is registered, false if all
+ *   CMU_CLOCK_CHANGE_SUBSCRIBERS_MAX slots are in use.
+ ******************************************************************************/
+bool CMU_ClockChangeSubscribe(CMU_ClockChangeCallback_TypeDef callback)
+{
+  CORE_DECLARE_IRQ_STATE;
+  bool registered = false;
+  uint32_t i;
+
+  EFM_ASSERT(callback != NULL);
+
+  CORE_ENTER_CRITICAL();
+  for (i = 0U; i < CMU_CLOCK_CHANGE_SUBSCRIBERS_MAX; i++) {
+    if (clockChangeCallbacks[i] == callback) {
+      registered = true;
+      break;
+    }
+  }
+  for (i = 0U; !registered && (i < CMU_CLOCK_CHANGE_SUBSCRIBERS_MAX); i++) {
+    if (clockChangeCallbacks[i] == NULL) {
+      clockChangeCallbacks[i] = callback;
+      registered = true;
+    }
+  }
+  CORE_EXIT_CRITICAL();
+
+  return registered;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Unregister a function registered with @ref CMU_ClockChangeSubscribe().
+ *
+ * @param[in] callback
+ *   A function to remove from the clock change subscribers.
+ ******************************************************************************/
+void CMU_ClockChangeUnsubscribe(CMU_ClockChangeCallback_TypeDef callback)
+{
+  CORE_DECLARE_IRQ_STATE;
+  uint32_t i;
+
+  CORE_ENTER_CRITICAL();
+  for (i = 0U; i < CMU_CLOCK_CHANGE_SUBSCRIBERS_MAX; i++) {
+    if (clockChangeCallbacks[i] == callback) {
+      clockChangeCallbacks[i] = NULL;
+    }
+  }
+  CORE_EXIT_CRITICAL();
+}
+#endif /* defined(CMU_CLOCK_FREQ_CACHE) */
+
 /** @} (end addtogroup CMU) */
 /** @} (end addtogroup emlib) */
 #endif /* defined(CMU_PRESENT) */
@@ -28,6 +28,7 @@
  *
  ******************************************************************************/
 #include "em_core.h"
+#include <stddef.h>
 #include "em_assert.h"
 
 #if defined(EMLIB_USER_CONFIG)
@@ -49,6 +50,7 @@
 ///  @li @ref core_macro_api
 ///  @li @ref core_reimplementation
 ///  @li @ref core_vector_tables
+///  @li @ref core_profiling
 ///  @li @ref core_examples
 ///  @li @ref core_porting
 ///
@@ -199,6 +201,30 @@
 ///  They both use the interrupt vector table defined by the current
 ///  VTOR register value.
 ///
+///@n @section core_profiling Interrupt masking profiler
+///
+///  Defining CORE_PROFILE (with a -D compiler flag, since it changes
+///  em_core.h) makes the CRITICAL, ATOMIC and NVIC mask functions timestamp
+///  when interrupts become masked and when they are unmasked again. Nested
+///  sections count as one interval, which starts and ends at the outermost
+///  section. The longest interval and the number of intervals are recorded
+///  per call site, identified by the return address of the call that masked
+///  interrupts, along with a histogram of all PRIMASK or BASEPRI masked
+///  durations. NVIC mask sections are matched by their state storage:
+///  @ref CORE_EnterNvicMask() starts an interval that @ref CORE_NvicEnableMask()
+///  or @ref CORE_YieldNvicMask() with the same pointer ends, the yield
+///  starting another one.
+///
+///  @ref CORE_ProfileGet() @n @ref CORE_ProfileGetSites() @n
+///  @ref CORE_ProfileReset() @n
+///  Use these functions to read and clear the recorded profile.
+///
+///  Timestamps are read from the DWT cycle counter, which
+///  @ref CORE_ProfileReset() enables. On cores without DWT, or to use another
+///  clock, define CORE_PROFILE_TIMESTAMP() to return a free running 32-bit
+///  count. CORE_PROFILE_CALLER() can be redefined to identify call sites in
+///  another way. When CORE_PROFILE is not defined, em_core is unchanged.
+///
 ///@n @section core_examples Examples
 ///
 ///  Implement an NVIC critical section:
@@ -295,6 +321,74 @@
 #error "em_core: Undefined ATOMIC IRQ handling strategy."
 #endif
 
+#if defined(CORE_PROFILE)
+#if !defined(CORE_PROFILE_TIMESTAMP)
+#if (__CORTEX_M >= 3)
+/** Free running 32-bit timestamp used by the interrupt masking profiler. */
+#define CORE_PROFILE_TIMESTAMP()  (DWT->CYCCNT)
+#define CORE_PROFILE_USE_CYCCNT
+#else
+#error "em_core: CORE_PROFILE_TIMESTAMP() must be defined on this core."
+#endif
+#endif
+
+#if !defined(CORE_PROFILE_CALLER)
+#if defined(__GNUC__)
+/** Call site recorded by the interrupt masking profiler. */
+#define CORE_PROFILE_CALLER()     __builtin_return_address(0)
+#else
+#define CORE_PROFILE_CALLER()     ((void *)0)
+#endif
+#endif
+#endif // defined(CORE_PROFILE)
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+#if defined(CORE_PROFILE)
+#if (CORE_ATOMIC_METHOD == CORE_ATOMIC_METHOD_BASEPRI)
+#define CORE_PROFILE_BASEPRI_CLEAR()  (__get_BASEPRI() == 0U)
+#else
+#define CORE_PROFILE_BASEPRI_CLEAR()  true
+#endif
+#define CORE_PROFILE_PRIMASK_CLEAR()  ((__get_PRIMASK() & 1U) == 0U)
+
+// Sample whether interrupts are fully unmasked before masking them.
+#define CORE_PROFILE_DECLARE_UNMASKED()                              \
+  bool profileUnmasked = CORE_PROFILE_PRIMASK_CLEAR()                \
+                         && CORE_PROFILE_BASEPRI_CLEAR()
+// Start an interval after masking interrupts, if they were unmasked.
+#define CORE_PROFILE_START(unmasked)                                 \
+  do {                                                               \
+    if (unmasked) {                                                  \
+      coreProfileStart(CORE_PROFILE_CALLER());                       \
+    }                                                                \
+  } while (0)
+// End the interval before unmasking interrupts, if they become unmasked.
+#define CORE_PROFILE_STOP(unmasking)                                 \
+  do {                                                               \
+    if (unmasking) {                                                 \
+      coreProfileStop();                                             \
+    }                                                                \
+  } while (0)
+#define CORE_PROFILE_NVIC_START(state) \
+  coreProfileNvicStart(state, CORE_PROFILE_CALLER())
+#define CORE_PROFILE_NVIC_STOP(state)  coreProfileNvicStop(state)
+
+static void coreProfileStart(const void *site);
+static void coreProfileStop(void);
+static void coreProfileNvicStart(const CORE_nvicMask_t *state,
+                                 const void *site);
+static bool coreProfileNvicStop(const CORE_nvicMask_t *state);
+#else
+#define CORE_PROFILE_DECLARE_UNMASKED()
+#define CORE_PROFILE_START(unmasked)
+#define CORE_PROFILE_STOP(unmasking)
+#define CORE_PROFILE_NVIC_START(state)
+#define CORE_PROFILE_NVIC_STOP(state)
+#endif // defined(CORE_PROFILE)
+
+/** @endcond */
+
 /*******************************************************************************
  ******************************   FUNCTIONS   **********************************
  ******************************************************************************/
@@ -308,7 +402,9 @@
  ******************************************************************************/
 SL_WEAK void CORE_CriticalDisableIrq(void)
 {
+  CORE_PROFILE_DECLARE_UNMASKED();
   __disable_irq();
+  CORE_PROFILE_START(profileUnmasked);
 }
 
 /***************************************************************************//**
@@ -319,6 +415,7 @@ SL_WEAK void CORE_CriticalDisableIrq(void)
  ******************************************************************************/
 SL_WEAK void CORE_CriticalEnableIrq(void)
 {
+  CORE_PROFILE_STOP(CORE_PROFILE_BASEPRI_CLEAR());
   __enable_irq();
 }
 
@@ -335,7 +432,9 @@ SL_WEAK void CORE_CriticalEnableIrq(void)
 SL_WEAK CORE_irqState_t CORE_EnterCritical(void)
 {
   CORE_irqState_t irqState = __get_PRIMASK();
+  CORE_PROFILE_DECLARE_UNMASKED();
   __disable_irq();
+  CORE_PROFILE_START(profileUnmasked);
   return irqState;
 }
 
@@ -351,6 +450,7 @@ SL_WEAK CORE_irqState_t CORE_EnterCritical(void)
 SL_WEAK void CORE_ExitCritical(CORE_irqState_t irqState)
 {
   if (irqState == 0U) {
+    CORE_PROFILE_STOP(CORE_PROFILE_BASEPRI_CLEAR());
     __enable_irq();
   }
 }
@@ -366,9 +466,11 @@ SL_WEAK void CORE_ExitCritical(CORE_irqState_t irqState)
 SL_WEAK void CORE_YieldCritical(void)
 {
   if ((__get_PRIMASK() & 1U) != 0U) {
+    CORE_PROFILE_STOP(CORE_PROFILE_BASEPRI_CLEAR());
     __enable_irq();
     __ISB();
     __disable_irq();
+    CORE_PROFILE_START(CORE_PROFILE_BASEPRI_CLEAR());
   }
 }
 
@@ -386,11 +488,13 @@ SL_WEAK void CORE_YieldCritical(void)
  ******************************************************************************/
 SL_WEAK void CORE_AtomicDisableIrq(void)
 {
+  CORE_PROFILE_DECLARE_UNMASKED();
 #if (CORE_ATOMIC_METHOD == CORE_ATOMIC_METHOD_BASEPRI)
   __set_BASEPRI(CORE_ATOMIC_BASE_PRIORITY_LEVEL << (8 - __NVIC_PRIO_BITS));
 #else
   __disable_irq();
 #endif // (CORE_ATOMIC_METHOD == CORE_ATOMIC_METHOD_BASEPRI)
+  CORE_PROFILE_START(profileUnmasked);
 }
 
 /***************************************************************************//**
@@ -411,8 +515,10 @@ SL_WEAK void CORE_AtomicDisableIrq(void)
 SL_WEAK void CORE_AtomicEnableIrq(void)
 {
 #if (CORE_ATOMIC_METHOD == CORE_ATOMIC_METHOD_BASEPRI)
+  CORE_PROFILE_STOP(CORE_PROFILE_PRIMASK_CLEAR());
   __set_BASEPRI(0);
 #else
+  CORE_PROFILE_STOP(CORE_PROFILE_BASEPRI_CLEAR());
   __enable_irq();
 #endif // (CORE_ATOMIC_METHOD == CORE_ATOMIC_METHOD_BASEPRI)
 }
@@ -435,11 +541,15 @@ SL_WEAK CORE_irqState_t CORE_EnterAtomic(void)
 {
 #if (CORE_ATOMIC_METHOD == CORE_ATOMIC_METHOD_BASEPRI)
   CORE_irqState_t irqState = __get_BASEPRI();
+  CORE_PROFILE_DECLARE_UNMASKED();
   __set_BASEPRI(CORE_ATOMIC_BASE_PRIORITY_LEVEL << (8 - __NVIC_PRIO_BITS));
+  CORE_PROFILE_START(profileUnmasked);
   return irqState;
 #else
   CORE_irqState_t irqState = __get_PRIMASK();
+  CORE_PROFILE_DECLARE_UNMASKED();
   __disable_irq();
+  CORE_PROFILE_START(profileUnmasked);
   return irqState;
 #endif // (CORE_ATOMIC_METHOD == CORE_ATOMIC_METHOD_BASEPRI)
 }
@@ -460,9 +570,11 @@ SL_WEAK CORE_irqState_t CORE_EnterAtomic(void)
 SL_WEAK void CORE_ExitAtomic(CORE_irqState_t irqState)
 {
 #if (CORE_ATOMIC_METHOD == CORE_ATOMIC_METHOD_BASEPRI)
+  CORE_PROFILE_STOP((irqState == 0U) && CORE_PROFILE_PRIMASK_CLEAR());
   __set_BASEPRI(irqState);
 #else
   if (irqState == 0U) {
+    CORE_PROFILE_STOP(CORE_PROFILE_BASEPRI_CLEAR());
     __enable_irq();
   }
 #endif // (CORE_ATOMIC_METHOD == CORE_ATOMIC_METHOD_BASEPRI)
@@ -485,15 +597,19 @@ SL_WEAK void CORE_YieldAtomic(void)
 #if (CORE_ATOMIC_METHOD == CORE_ATOMIC_METHOD_BASEPRI)
   CORE_irqState_t basepri = __get_BASEPRI();
   if (basepri >= (CORE_ATOMIC_BASE_PRIORITY_LEVEL << (8 - __NVIC_PRIO_BITS))) {
+    CORE_PROFILE_STOP(CORE_PROFILE_PRIMASK_CLEAR());
     __set_BASEPRI(0);
     __ISB();
     __set_BASEPRI(basepri);
+    CORE_PROFILE_START(CORE_PROFILE_PRIMASK_CLEAR());
   }
 #else
   if ((__get_PRIMASK() & 1U) != 0U) {
+    CORE_PROFILE_STOP(CORE_PROFILE_BASEPRI_CLEAR());
     __enable_irq();
     __ISB();
     __disable_irq();
+    CORE_PROFILE_START(CORE_PROFILE_BASEPRI_CLEAR());
   }
 #endif // (CORE_ATOMIC_METHOD == CORE_ATOMIC_METHOD_BASEPRI)
 }
@@ -517,6 +633,7 @@ void CORE_EnterNvicMask(CORE_nvicMask_t *nvicState,
   CORE_CRITICAL_SECTION(
     *nvicState = *(CORE_nvicMask_t*)((uint32_t)&NVIC->ICER[0]);
     *(CORE_nvicMask_t*)((uint32_t)&NVIC->ICER[0]) = *disable;
+    CORE_PROFILE_NVIC_START(nvicState);
     )
 }
 
@@ -544,6 +661,7 @@ void CORE_NvicDisableMask(const CORE_nvicMask_t *disable)
 void CORE_NvicEnableMask(const CORE_nvicMask_t *enable)
 {
   CORE_CRITICAL_SECTION(
+    CORE_PROFILE_NVIC_STOP(enable);
     *(CORE_nvicMask_t*)((uint32_t)&NVIC->ISER[0]) = *enable;
     )
 }
@@ -558,10 +676,18 @@ void CORE_NvicEnableMask(const CORE_nvicMask_t *enable)
  *
  * @note
  *   Usually used within an NVIC mask section.
+ *
+ * @note
+ *   With CORE_PROFILE, when @p enable is the state storage of an open NVIC
+ *   mask section, the section interval ends before the interrupts are enabled
+ *   and a new one starts at this call once they are disabled again.
  ******************************************************************************/
 void CORE_YieldNvicMask(const CORE_nvicMask_t *enable)
 {
   CORE_nvicMask_t nvicMask;
+#if defined(CORE_PROFILE)
+  bool profileNvicOpen;
+#endif
 
   // Get current NVIC enable mask.
   CORE_CRITICAL_SECTION(
@@ -593,11 +719,25 @@ void CORE_YieldNvicMask(const CORE_nvicMask_t *enable)
   if ((nvicMask.a[0] != 0) || (nvicMask.a[1] != 0) || (nvicMask.a[2] != 0)) {
 #endif
 
+#if defined(CORE_PROFILE)
+    CORE_CRITICAL_SECTION(
+      profileNvicOpen = coreProfileNvicStop(enable);
+      )
+#endif
+
     // Enable previously disabled interrupts.
     *(CORE_nvicMask_t*)((uint32_t)&NVIC->ISER[0]) = nvicMask;
 
     // Disable those interrupts again.
     *(CORE_nvicMask_t*)((uint32_t)&NVIC->ICER[0]) = nvicMask;
+
+#if defined(CORE_PROFILE)
+    if (profileNvicOpen) {
+      CORE_CRITICAL_SECTION(
+        CORE_PROFILE_NVIC_START(enable);
+        )
+    }
+#endif
   }
 }
 
@@ -901,5 +1041,254 @@ void CORE_InitNvicVectorTable(uint32_t *sourceTable,
   SCB->VTOR = (uint32_t)targetTable;
 }
 
+#if defined(CORE_PROFILE)
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+typedef struct {
+  const CORE_nvicMask_t *state;
+  const void *site;
+  uint32_t start;
+} coreProfileNvic_t;
+
+static bool coreProfileOpen = false;
+static uint32_t coreProfileStartTime;
+static const void *coreProfileSite;
+static CORE_profile_t coreProfile;
+static CORE_profileSite_t coreProfileSites[CORE_PROFILE_SITES];
+static coreProfileNvic_t coreProfileNvic[CORE_PROFILE_NVIC_SECTIONS];
+
+/***************************************************************************//**
+ * @brief
+ *   Record a masked interval against its call site.
+ *
+ * @note
+ *   Must be called with interrupts disabled.
+ ******************************************************************************/
+static void coreProfileRecord(const void *site, uint32_t cycles, bool nvic)
+{
+  uint32_t i;
+
+  // Sites are added in order, so the first unused entry ends the search.
+  for (i = 0U; i < CORE_PROFILE_SITES; i++) {
+    if (coreProfileSites[i].count == 0U) {
+      coreProfileSites[i].site = site;
+      coreProfileSites[i].nvic = nvic;
+      break;
+    }
+    if ((coreProfileSites[i].site == site)
+        && (coreProfileSites[i].nvic == nvic)) {
+      break;
+    }
+  }
+  if (i == CORE_PROFILE_SITES) {
+    coreProfile.dropped++;
+    return;
+  }
+
+  coreProfileSites[i].count++;
+  if (cycles > coreProfileSites[i].maxCycles) {
+    coreProfileSites[i].maxCycles = cycles;
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Start a PRIMASK or BASEPRI masked interval.
+ *
+ * @note
+ *   Called right after interrupts were masked.
+ ******************************************************************************/
+static void coreProfileStart(const void *site)
+{
+  coreProfileOpen = true;
+  coreProfileSite = site;
+  coreProfileStartTime = CORE_PROFILE_TIMESTAMP();
+}
+
+/***************************************************************************//**
+ * @brief
+ *   End a PRIMASK or BASEPRI masked interval.
+ *
+ * @note
+ *   Called right before interrupts are unmasked.
+ ******************************************************************************/
+static void coreProfileStop(void)
+{
+  uint32_t cycles = CORE_PROFILE_TIMESTAMP() - coreProfileStartTime;
+  uint32_t bin;
+
+  if (!coreProfileOpen) {
+    return;
+  }
+  coreProfileOpen = false;
+
+  coreProfile.intervals++;
+  if (cycles > coreProfile.maxCycles) {
+    coreProfile.maxCycles = cycles;
+    coreProfile.maxSite = coreProfileSite;
+  }
+
+  bin = (cycles == 0U) ? 0U : (32U - __CLZ(cycles));
+  if (bin >= CORE_PROFILE_HISTOGRAM_BINS) {
+    bin = CORE_PROFILE_HISTOGRAM_BINS - 1U;
+  }
+  coreProfile.histogram[bin]++;
+
+  coreProfileRecord(coreProfileSite, cycles, false);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Start a NVIC mask section interval, keyed by its state storage.
+ *
+ * @note
+ *   Must be called with interrupts disabled.
+ ******************************************************************************/
+static void coreProfileNvicStart(const CORE_nvicMask_t *state,
+                                 const void *site)
+{
+  coreProfileNvic_t *slot = NULL;
+
+  for (uint32_t i = 0U; i < CORE_PROFILE_NVIC_SECTIONS; i++) {
+    // Reuse a stale slot if the same state storage is entered again.
+    if (coreProfileNvic[i].state == state) {
+      slot = &coreProfileNvic[i];
+      break;
+    }
+    if ((slot == NULL) && (coreProfileNvic[i].state == NULL)) {
+      slot = &coreProfileNvic[i];
+    }
+  }
+  if (slot == NULL) {
+    coreProfile.dropped++;
+    return;
+  }
+  slot->state = state;
+  slot->site = site;
+  slot->start = CORE_PROFILE_TIMESTAMP();
+}
+
+/***************************************************************************//**
+ * @brief
+ *   End a NVIC mask section interval when its state is restored.
+ *
+ * @return
+ *   True if an interval was open for the state storage.
+ *
+ * @note
+ *   Must be called with interrupts disabled.
+ ******************************************************************************/
+static bool coreProfileNvicStop(const CORE_nvicMask_t *state)
+{
+  uint32_t now = CORE_PROFILE_TIMESTAMP();
+
+  for (uint32_t i = 0U; i < CORE_PROFILE_NVIC_SECTIONS; i++) {
+    if (coreProfileNvic[i].state == state) {
+      coreProfileNvic[i].state = NULL;
+      coreProfileRecord(coreProfileNvic[i].site,
+                        now - coreProfileNvic[i].start,
+                        true);
+      return true;
+    }
+  }
+  return false;
+}
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Clear the interrupt masking profile.
+ *
+ * @details
+ *   Also enables the DWT cycle counter when it is used as the timestamp
+ *   source. Call this once before reading the profile for the first time.
+ ******************************************************************************/
+void CORE_ProfileReset(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t i;
+
+  __disable_irq();
+#if defined(CORE_PROFILE_USE_CYCCNT)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+  coreProfileOpen = false;
+  coreProfile.intervals = 0U;
+  coreProfile.maxCycles = 0U;
+  coreProfile.maxSite = NULL;
+  coreProfile.dropped = 0U;
+  for (i = 0U; i < CORE_PROFILE_HISTOGRAM_BINS; i++) {
+    coreProfile.histogram[i] = 0U;
+  }
+  for (i = 0U; i < CORE_PROFILE_SITES; i++) {
+    coreProfileSites[i].site = NULL;
+    coreProfileSites[i].count = 0U;
+    coreProfileSites[i].maxCycles = 0U;
+    coreProfileSites[i].nvic = false;
+  }
+  for (i = 0U; i < CORE_PROFILE_NVIC_SECTIONS; i++) {
+    coreProfileNvic[i].state = NULL;
+  }
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the interrupt masking profile summary.
+ *
+ * @param[out] profile
+ *   The profile summary, including the masked duration histogram.
+ ******************************************************************************/
+void CORE_ProfileGet(CORE_profile_t *profile)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  // Mask interrupts directly, so that reading the profile is not profiled.
+  __disable_irq();
+  *profile = coreProfile;
+  if (primask == 0U) {
+    __enable_irq();
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the worst case interrupt masking recorded per call site.
+ *
+ * @param[out] sites
+ *   The array to copy call site records to, in order of first use.
+ *
+ * @param[in] maxSites
+ *   The number of entries in the sites array.
+ *
+ * @return
+ *   The number of call site records copied.
+ ******************************************************************************/
+uint32_t CORE_ProfileGetSites(CORE_profileSite_t *sites, uint32_t maxSites)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t count = 0U;
+
+  __disable_irq();
+  while ((count < maxSites) && (count < CORE_PROFILE_SITES)
+         && (coreProfileSites[count].count != 0U)) {
+    sites[count] = coreProfileSites[count];
+    count++;
+  }
+  if (primask == 0U) {
+    __enable_irq();
+  }
+  return count;
+}
+
+#endif // defined(CORE_PROFILE)
+
 /** @} (end addtogroup CORE) */
 /** @} (end addtogroup emlib) */
@@ -541,6 +541,239 @@ void CRYPTO_SHA_256(CRYPTO_TypeDef *             crypto,
   CRYPTO_DDataRead(&crypto->DDATA0BIG, (uint32_t *)msgDigest);
 }
 
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/***************************************************************************//**
+ * @brief
+ *   Configure the CRYPTO module for a SHA context and load its state.
+ ******************************************************************************/
+static void cryptoShaStart(CRYPTO_SHA_Context_TypeDef *ctx)
+{
+  CRYPTO_TypeDef *crypto = ctx->crypto;
+
+  crypto->CTRL     = (ctx->mode == cryptoShaSha1) ? CRYPTO_CTRL_SHA_SHA1
+                     : CRYPTO_CTRL_SHA_SHA2;
+  crypto->SEQCTRL  = 0;
+  crypto->SEQCTRLB = 0;
+
+  /* Set the result width of the MADD32 operation. */
+  CRYPTO_ResultWidthSet(crypto, cryptoResult256Bits);
+
+  /* Restore the intermediate digest to DDATA1. */
+  CRYPTO_DDataWrite(&crypto->DDATA1, ctx->state);
+
+  /* Copy data to DDATA0 and select DDATA0 and DDATA1 for SHA operation. */
+  CRYPTO_EXECUTE_2(crypto,
+                   CRYPTO_CMD_INSTR_DDATA1TODDATA0,
+                   CRYPTO_CMD_INSTR_SELDDATA0DDATA1);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Hash one 64 byte block.
+ ******************************************************************************/
+static void cryptoShaBlock(CRYPTO_TypeDef *crypto, const uint32_t *block)
+{
+  /* Write block to QDATA1BIG. */
+  CRYPTO_InstructionSequenceWait(crypto);
+  CRYPTO_QDataWrite(&crypto->QDATA1BIG, (uint32_t *) block);
+
+  /* Execute SHA. */
+  CRYPTO_EXECUTE_3(crypto,
+                   CRYPTO_CMD_INSTR_SHA,
+                   CRYPTO_CMD_INSTR_MADD32,
+                   CRYPTO_CMD_INSTR_DDATA0TODDATA1);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Save the intermediate digest from DDATA1 to a SHA context.
+ ******************************************************************************/
+static void cryptoShaSave(CRYPTO_SHA_Context_TypeDef *ctx)
+{
+  CRYPTO_InstructionSequenceWait(ctx->crypto);
+  CRYPTO_DDataRead(&ctx->crypto->DDATA1, ctx->state);
+}
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Start an incremental SHA-1 or SHA-256 hash operation.
+ *
+ * @details
+ *   The message is then passed in any number of chunks of any size with
+ *   @ref CRYPTO_SHA_Update(), and the digest is produced by
+ *   @ref CRYPTO_SHA_Final(). Unlike @ref CRYPTO_SHA_1() and
+ *   @ref CRYPTO_SHA_256(), the message does not have to be in memory all at
+ *   once, and its total length is tracked with 64 bits.
+ *
+ *   The intermediate digest is kept in DDATA1 while blocks are hashed and
+ *   saved to the context when @ref CRYPTO_SHA_Update() returns. The CRYPTO
+ *   module can therefore be used for other operations, including other SHA
+ *   contexts, between calls.
+ *
+ * @param[out] ctx
+ *   A SHA context.
+ *
+ * @param[in]  crypto
+ *   A pointer to the CRYPTO peripheral register block.
+ *
+ * @param[in]  mode
+ *   The SHA algorithm to use.
+ ******************************************************************************/
+void CRYPTO_SHA_Init(CRYPTO_SHA_Context_TypeDef *ctx,
+                     CRYPTO_TypeDef             *crypto,
+                     CRYPTO_ShaMode_TypeDef     mode)
+{
+  EFM_ASSERT((mode == cryptoShaSha1) || (mode == cryptoShaSha256));
+
+  ctx->crypto   = crypto;
+  ctx->mode     = mode;
+  ctx->blockLen = 0;
+  ctx->msgLen   = 0;
+
+  if (mode == cryptoShaSha1) {
+    ctx->state[0] = 0x67452301UL;
+    ctx->state[1] = 0xefcdab89UL;
+    ctx->state[2] = 0x98badcfeUL;
+    ctx->state[3] = 0x10325476UL;
+    ctx->state[4] = 0xc3d2e1f0UL;
+    ctx->state[5] = 0x00000000UL;
+    ctx->state[6] = 0x00000000UL;
+    ctx->state[7] = 0x00000000UL;
+  } else {
+    ctx->state[0] = 0x6a09e667UL;
+    ctx->state[1] = 0xbb67ae85UL;
+    ctx->state[2] = 0x3c6ef372UL;
+    ctx->state[3] = 0xa54ff53aUL;
+    ctx->state[4] = 0x510e527fUL;
+    ctx->state[5] = 0x9b05688cUL;
+    ctx->state[6] = 0x1f83d9abUL;
+    ctx->state[7] = 0x5be0cd19UL;
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Add a chunk of message to an incremental SHA hash operation.
+ *
+ * @details
+ *   Whole blocks are hashed directly from @p msg, and the remainder is
+ *   buffered in the context until the next call.
+ *
+ * @param[in]  ctx
+ *   A SHA context started with @ref CRYPTO_SHA_Init().
+ *
+ * @param[in]  msg
+ *   Message chunk to hash.
+ *
+ * @param[in]  msgLen
+ *   Length of the message chunk in bytes.
+ ******************************************************************************/
+void CRYPTO_SHA_Update(CRYPTO_SHA_Context_TypeDef *ctx,
+                       const uint8_t              *msg,
+                       uint32_t                   msgLen)
+{
+  uint8_t *p8ShaBlock = (uint8_t *) ctx->block;
+  uint32_t count;
+
+  ctx->msgLen += msgLen;
+
+  /* Fill up the buffered partial block first. */
+  if (ctx->blockLen > 0U) {
+    count = CRYPTO_SHA1_BLOCK_SIZE_IN_BYTES - ctx->blockLen;
+    if (count > msgLen) {
+      count = msgLen;
+    }
+    memcpy(&p8ShaBlock[ctx->blockLen], msg, count);
+    ctx->blockLen += count;
+    msg           += count;
+    msgLen        -= count;
+
+    if (ctx->blockLen < CRYPTO_SHA1_BLOCK_SIZE_IN_BYTES) {
+      return;
+    }
+  }
+
+  if ((ctx->blockLen > 0U) || (msgLen >= CRYPTO_SHA1_BLOCK_SIZE_IN_BYTES)) {
+    cryptoShaStart(ctx);
+
+    if (ctx->blockLen > 0U) {
+      cryptoShaBlock(ctx->crypto, ctx->block);
+      ctx->blockLen = 0;
+    }
+
+    while (msgLen >= CRYPTO_SHA1_BLOCK_SIZE_IN_BYTES) {
+      cryptoShaBlock(ctx->crypto, (const uint32_t *) msg);
+      msg    += CRYPTO_SHA1_BLOCK_SIZE_IN_BYTES;
+      msgLen -= CRYPTO_SHA1_BLOCK_SIZE_IN_BYTES;
+    }
+
+    cryptoShaSave(ctx);
+  }
+
+  memcpy(p8ShaBlock, msg, msgLen);
+  ctx->blockLen = msgLen;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Finish an incremental SHA hash operation.
+ *
+ * @details
+ *   The message is padded and its length encoded, and the digest is written
+ *   to @p digest. The context must be initialized again to be reused.
+ *
+ * @param[in]  ctx
+ *   A SHA context started with @ref CRYPTO_SHA_Init().
+ *
+ * @param[out] digest
+ *   The message digest, @ref CRYPTO_SHA1_DIGEST_SIZE_IN_BYTES or
+ *   @ref CRYPTO_SHA256_DIGEST_SIZE_IN_BYTES long.
+ ******************************************************************************/
+void CRYPTO_SHA_Final(CRYPTO_SHA_Context_TypeDef *ctx,
+                      uint8_t                    *digest)
+{
+  uint8_t  *p8ShaBlock = (uint8_t *) ctx->block;
+  uint32_t blockLen    = ctx->blockLen;
+  uint32_t result[CRYPTO_DDATA_SIZE_IN_32BIT_WORDS];
+  uint64_t msgLenInBits = ctx->msgLen << 3U;
+
+  cryptoShaStart(ctx);
+
+  /* Append the '1' bit. */
+  p8ShaBlock[blockLen++] = 0x80;
+
+  /* If the length is currently above 56 bytes, zeros are appended
+   * then compressed.  Then, zeros are padded and length
+   * encoded like normal.
+   */
+  if (blockLen > 56U) {
+    memset(&p8ShaBlock[blockLen], 0, CRYPTO_SHA1_BLOCK_SIZE_IN_BYTES - blockLen);
+    cryptoShaBlock(ctx->crypto, ctx->block);
+    blockLen = 0;
+  }
+
+  /* Pad up to 56 bytes of zeros. */
+  memset(&p8ShaBlock[blockLen], 0, 56U - blockLen);
+
+  /* Finally, encode the message length. */
+  ctx->block[14] = SWAP32((uint32_t)(msgLenInBits >> 32U));
+  ctx->block[15] = SWAP32((uint32_t)msgLenInBits);
+  cryptoShaBlock(ctx->crypto, ctx->block);
+
+  /* Read the resulting message digest from DDATA0BIG. */
+  CRYPTO_InstructionSequenceWait(ctx->crypto);
+  CRYPTO_DDataRead(&ctx->crypto->DDATA0BIG, result);
+  memcpy(digest, result, (ctx->mode == cryptoShaSha1)
+         ? CRYPTO_SHA1_DIGEST_SIZE_IN_BYTES
+         : CRYPTO_SHA256_DIGEST_SIZE_IN_BYTES);
+
+  ctx->blockLen = 0;
+  ctx->msgLen   = 0;
+}
+
 /***************************************************************************//**
  * @brief
  *   Set the 32 bit word array to zero.
@@ -828,6 +828,9 @@ void EMU_EnterEM2(bool restore)
     /* update CMSIS core clock variable since HF clock has changed */
     /* to HFRCO. */
     SystemCoreClockUpdate();
+#if defined(CMU_CLOCK_FREQ_CACHE)
+    CMU_ClockFreqCacheRefresh();
+#endif
   }
 }
 
@@ -1005,6 +1008,9 @@ void EMU_EnterEM3(bool restore)
     /* update CMSIS core clock variable since HF clock has changed */
     /* to HFRCO. */
     SystemCoreClockUpdate();
+#if defined(CMU_CLOCK_FREQ_CACHE)
+    CMU_ClockFreqCacheRefresh();
+#endif
   }
 }
 
@@ -1045,6 +1051,9 @@ void EMU_Restore(void)
 #if defined(_SILICON_LABS_32B_SERIES_2_CONFIG_2)
   dpllState(dpllState_Restore);
 #endif
+#if defined(CMU_CLOCK_FREQ_CACHE)
+  CMU_ClockFreqCacheRefresh();
+#endif
 }
 
 /***************************************************************************//**
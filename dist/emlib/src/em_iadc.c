@@ -153,6 +153,78 @@ static IADC_Result_t IADC_ConvertRawDataToResult(uint32_t rawData,
   return result;
 }
 
+static bool IADC_isRightAligned(IADC_Alignment_t alignment)
+{
+  switch (alignment) {
+    case iadcAlignRight12:
+#if defined(IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT16)
+    case iadcAlignRight16:
+#endif
+#if defined(IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT20)
+    case iadcAlignRight20:
+#endif
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+// Pull count entries from a FIFO and convert them, with one loop per
+// alignment. Either results, or data and optionally id, are written.
+static void IADC_pullFifoResults(const volatile uint32_t *fifo,
+                                 uint32_t count,
+                                 IADC_Alignment_t alignment,
+                                 IADC_Result_t *results,
+                                 uint32_t *data,
+                                 uint8_t *id)
+{
+  uint32_t rawData;
+  uint32_t i;
+
+  if (IADC_isRightAligned(alignment)) {
+    if (results != NULL) {
+      for (i = 0U; i < count; i++) {
+        rawData = *fifo;
+        results[i].data = (rawData & 0x00FFFFFFUL)
+                          | ((rawData & 0x00800000UL) != 0x0UL ? 0xFF000000UL : 0x0UL);
+        results[i].id   = (uint8_t)((rawData & 0xFF000000UL) >> 24);
+      }
+    } else if (id != NULL) {
+      for (i = 0U; i < count; i++) {
+        rawData = *fifo;
+        data[i] = (rawData & 0x00FFFFFFUL)
+                  | ((rawData & 0x00800000UL) != 0x0UL ? 0xFF000000UL : 0x0UL);
+        id[i]   = (uint8_t)((rawData & 0xFF000000UL) >> 24);
+      }
+    } else {
+      for (i = 0U; i < count; i++) {
+        rawData = *fifo;
+        data[i] = (rawData & 0x00FFFFFFUL)
+                  | ((rawData & 0x00800000UL) != 0x0UL ? 0xFF000000UL : 0x0UL);
+      }
+    }
+  } else {
+    if (results != NULL) {
+      for (i = 0U; i < count; i++) {
+        rawData = *fifo;
+        results[i].data = rawData & 0xFFFFFF00UL;
+        results[i].id   = (uint8_t)(rawData & 0x000000FFUL);
+      }
+    } else if (id != NULL) {
+      for (i = 0U; i < count; i++) {
+        rawData = *fifo;
+        data[i] = rawData & 0xFFFFFF00UL;
+        id[i]   = (uint8_t)(rawData & 0x000000FFUL);
+      }
+    } else {
+      for (i = 0U; i < count; i++) {
+        data[i] = *fifo & 0xFFFFFF00UL;
+      }
+    }
+  }
+}
+
 /** @endcond */
 
 /*******************************************************************************
@@ -956,6 +1028,159 @@ IADC_Result_t IADC_readScanResult(IADC_TypeDef *iadc)
                                      (IADC_Alignment_t) alignment);
 }
 
+/***************************************************************************//**
+ * @brief
+ *   Pull all available results from the single data FIFO.
+ *
+ * @details
+ *   The FIFO level and the alignment are read once, and the entries are
+ *   converted in a single loop. Use this instead of repeated calls to
+ *   @ref IADC_pullSingleFifoResult() to drain the FIFO quickly.
+ *
+ * @param[in] iadc
+ *   Pointer to IADC peripheral register block.
+ *
+ * @param[out] results
+ *   Array for the results.
+ *
+ * @param[in] max
+ *   Size of the results array.
+ *
+ * @return
+ *   Number of results pulled from the FIFO.
+ ******************************************************************************/
+uint32_t IADC_pullSingleFifoResults(IADC_TypeDef *iadc,
+                                    IADC_Result_t *results,
+                                    uint32_t max)
+{
+  uint32_t alignment = (iadc->SINGLEFIFOCFG & _IADC_SINGLEFIFOCFG_ALIGNMENT_MASK)
+                       >> _IADC_SINGLEFIFOCFG_ALIGNMENT_SHIFT;
+  uint32_t count = SL_MIN((uint32_t)IADC_getSingleFifoCnt(iadc), max);
+
+  EFM_ASSERT(results != NULL);
+
+  IADC_pullFifoResults(&iadc->SINGLEFIFODATA, count,
+                       (IADC_Alignment_t) alignment, results, NULL, NULL);
+  return count;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Pull all available results from the single data FIFO into separate data
+ *   and id arrays.
+ *
+ * @details
+ *   Same as @ref IADC_pullSingleFifoResults(), but the samples are written to
+ *   a plain array which can be passed directly to signal processing code.
+ *
+ * @param[in] iadc
+ *   Pointer to IADC peripheral register block.
+ *
+ * @param[out] data
+ *   Array for the sample data.
+ *
+ * @param[out] id
+ *   Array for the ids, or NULL if not needed.
+ *
+ * @param[in] max
+ *   Size of the data and id arrays.
+ *
+ * @return
+ *   Number of results pulled from the FIFO.
+ ******************************************************************************/
+uint32_t IADC_pullSingleFifoResultArrays(IADC_TypeDef *iadc,
+                                         uint32_t *data,
+                                         uint8_t *id,
+                                         uint32_t max)
+{
+  uint32_t alignment = (iadc->SINGLEFIFOCFG & _IADC_SINGLEFIFOCFG_ALIGNMENT_MASK)
+                       >> _IADC_SINGLEFIFOCFG_ALIGNMENT_SHIFT;
+  uint32_t count = SL_MIN((uint32_t)IADC_getSingleFifoCnt(iadc), max);
+
+  EFM_ASSERT(data != NULL);
+
+  IADC_pullFifoResults(&iadc->SINGLEFIFODATA, count,
+                       (IADC_Alignment_t) alignment, NULL, data, id);
+  return count;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Pull all available results from the scan data FIFO.
+ *
+ * @details
+ *   The FIFO level and the alignment are read once, and the entries are
+ *   converted in a single loop. Use this instead of repeated calls to
+ *   @ref IADC_pullScanFifoResult() to drain the FIFO quickly.
+ *
+ * @param[in] iadc
+ *   Pointer to IADC peripheral register block.
+ *
+ * @param[out] results
+ *   Array for the results.
+ *
+ * @param[in] max
+ *   Size of the results array.
+ *
+ * @return
+ *   Number of results pulled from the FIFO.
+ ******************************************************************************/
+uint32_t IADC_pullScanFifoResults(IADC_TypeDef *iadc,
+                                  IADC_Result_t *results,
+                                  uint32_t max)
+{
+  uint32_t alignment = (iadc->SCANFIFOCFG & _IADC_SCANFIFOCFG_ALIGNMENT_MASK)
+                       >> _IADC_SCANFIFOCFG_ALIGNMENT_SHIFT;
+  uint32_t count = SL_MIN((uint32_t)IADC_getScanFifoCnt(iadc), max);
+
+  EFM_ASSERT(results != NULL);
+
+  IADC_pullFifoResults(&iadc->SCANFIFODATA, count,
+                       (IADC_Alignment_t) alignment, results, NULL, NULL);
+  return count;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Pull all available results from the scan data FIFO into separate data
+ *   and id arrays.
+ *
+ * @details
+ *   Same as @ref IADC_pullScanFifoResults(), but the samples are written to
+ *   a plain array which can be passed directly to signal processing code.
+ *   The ids tell which scan table entry each sample belongs to.
+ *
+ * @param[in] iadc
+ *   Pointer to IADC peripheral register block.
+ *
+ * @param[out] data
+ *   Array for the sample data.
+ *
+ * @param[out] id
+ *   Array for the ids, or NULL if not needed.
+ *
+ * @param[in] max
+ *   Size of the data and id arrays.
+ *
+ * @return
+ *   Number of results pulled from the FIFO.
+ ******************************************************************************/
+uint32_t IADC_pullScanFifoResultArrays(IADC_TypeDef *iadc,
+                                       uint32_t *data,
+                                       uint8_t *id,
+                                       uint32_t max)
+{
+  uint32_t alignment = (iadc->SCANFIFOCFG & _IADC_SCANFIFOCFG_ALIGNMENT_MASK)
+                       >> _IADC_SCANFIFOCFG_ALIGNMENT_SHIFT;
+  uint32_t count = SL_MIN((uint32_t)IADC_getScanFifoCnt(iadc), max);
+
+  EFM_ASSERT(data != NULL);
+
+  IADC_pullFifoResults(&iadc->SCANFIFODATA, count,
+                       (IADC_Alignment_t) alignment, NULL, data, id);
+  return count;
+}
+
 /** @} (end addtogroup IADC) */
 /** @} (end addtogroup emlib) */
 #endif /* defined(IADC_COUNT) && (IADC_COUNT > 0) */
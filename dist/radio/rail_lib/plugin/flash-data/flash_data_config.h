@@ -71,4 +71,59 @@
 #define FLASH_DATA_BYTE_ARRAY ""
 #endif
 
+/**
+ * The number of flash pages used by the flash log record store. At least two
+ * pages are required, since one erased page is always kept in reserve for
+ * garbage collection.
+ *
+ * Note: The flash log region is reserved in flash by the plugin itself, unless
+ * the application defines FLASH_LOG_BASE_ADDR to point to a page aligned
+ * region of FLASH_LOG_PAGE_COUNT pages.
+ */
+#ifndef FLASH_LOG_PAGE_COUNT
+#define FLASH_LOG_PAGE_COUNT 4
+#endif
+
+/**
+ * The number of distinct record keys supported by the flash log. Valid keys
+ * range from 0 to FLASH_LOG_KEY_COUNT - 1. Each key costs one word of RAM in
+ * the record index.
+ */
+#ifndef FLASH_LOG_KEY_COUNT
+#define FLASH_LOG_KEY_COUNT 32
+#endif
+
+/**
+ * A randomized 32-bit (word-sized) value stored at the beginning of each flash
+ * log page. Whether or not this value exists in flash indicates if a page was
+ * opened for writing records.
+ */
+#ifndef FLASH_LOG_PREFIX
+#define FLASH_LOG_PREFIX 0xD505F106UL
+#endif
+
+/**
+ * The size in bytes of the RAM buffer used to batch record words before they
+ * are written to flash. Must be a multiple of 4 bytes.
+ */
+#ifndef FLASH_LOG_WRITE_BUFFER_SIZE
+#define FLASH_LOG_WRITE_BUFFER_SIZE 64
+#endif
+
+/**
+ * The maximum difference in erase counts between the most and least worn
+ * flash log pages before garbage collection starts moving rarely updated
+ * records off the least worn page.
+ */
+#ifndef FLASH_LOG_WEAR_THRESHOLD
+#define FLASH_LOG_WEAR_THRESHOLD 64
+#endif
+
+/**
+ * The DMA channel used to write records to flash with MSC_WriteWordDma().
+ * When not defined, MSC_WriteWord() is used. Series 0 devices have no
+ * MSC_WriteWordDma() and must leave it undefined.
+ */
+// #define FLASH_LOG_DMA_CHANNEL 0
+
 #endif // __FLASHDATACONFIG_PLUGIN_H__
@@ -0,0 +1,137 @@
+/***************************************************************************//**
+ * @file
+ * @brief Header file for the RAIL Flash Data log-structured record store
+ ******************************************************************************/
+
+#ifndef __FLASHLOG_PLUGIN_H__
+#define __FLASHLOG_PLUGIN_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "rail_types.h"
+
+/**
+ * Flash log statistics, accumulated since the last call to FL_Init().
+ *
+ * The write amplification of the store is bytesProgrammed / bytesRequested.
+ */
+typedef struct FL_Stats {
+  uint32_t bytesRequested;  /**< Record payload bytes passed to FL_WriteRecord(). */
+  uint32_t bytesProgrammed; /**< Bytes programmed to flash, including headers,
+                                 commit markers and garbage collection copies. */
+  uint32_t pageErases;      /**< Pages erased by the flash log. */
+  uint32_t collections;     /**< Pages reclaimed by garbage collection. */
+  uint32_t minEraseCount;   /**< Erase count of the least worn page. */
+  uint32_t maxEraseCount;   /**< Erase count of the most worn page. */
+} FL_Stats_t;
+
+/**
+ * Mount the flash log and rebuild the in-RAM record index.
+ *
+ * @return The status of the mount operation.
+ *   RAIL_STATUS_INVALID_STATE if a flash operation failed.
+ *   RAIL_STATUS_NO_ERROR on success.
+ *
+ * Every page in the flash log region is scanned once. Records without a valid
+ * commit marker, e.g. because power was lost while writing them, are ignored.
+ * Pages which are neither in use nor erased are erased. This must be called
+ * before any other flash log function.
+ */
+RAIL_Status_t FL_Init(void);
+
+/**
+ * Erase every page of the flash log, discarding all records.
+ *
+ * @return The status of the erase operation.
+ *   RAIL_STATUS_INVALID_CALL if FL_Init() has not been called.
+ *   RAIL_STATUS_INVALID_STATE if a flash operation failed.
+ *   RAIL_STATUS_NO_ERROR on success.
+ *
+ * Page erase counts are preserved.
+ */
+RAIL_Status_t FL_Format(void);
+
+/**
+ * Append a record to the flash log, replacing any previous record for the key.
+ *
+ * @param[in] key The record key, from 0 to FLASH_LOG_KEY_COUNT - 1.
+ * @param[in] data A pointer to the record data.
+ * @param[in] len The length of the record data in bytes. Must be nonzero and
+ *   not larger than FL_GetMaxRecordLength().
+ * @return The status of the write operation.
+ *   RAIL_STATUS_INVALID_PARAMETER if the key, data pointer or length is invalid.
+ *   RAIL_STATUS_INVALID_CALL if FL_Init() has not been called.
+ *   RAIL_STATUS_INVALID_STATE if the flash log is full or a flash operation
+ *   failed.
+ *   RAIL_STATUS_NO_ERROR on success.
+ *
+ * The record only replaces the previous one once its commit marker is written,
+ * so losing power during the write leaves the previous record in place. This
+ * may run garbage collection, which erases at most a few pages.
+ */
+RAIL_Status_t FL_WriteRecord(uint16_t key, const uint8_t *data, uint32_t len);
+
+/**
+ * Return a pointer to the latest record for a key.
+ *
+ * @param[in] key The record key, from 0 to FLASH_LOG_KEY_COUNT - 1.
+ * @param[out] data A pointer to the record data located in flash.
+ * @param[out] len A pointer to the record length. If the len pointer is NULL,
+ *   no length value is returned.
+ * @return The status of the read operation.
+ *   RAIL_STATUS_INVALID_PARAMETER if the key or data pointer is invalid.
+ *   RAIL_STATUS_INVALID_CALL if FL_Init() has not been called or no record
+ *   exists for the key.
+ *   RAIL_STATUS_NO_ERROR on success.
+ *
+ * @note The returned pointer is only valid until the next call to
+ *   FL_WriteRecord(), FL_DeleteRecord(), FL_Collect() or FL_Format(), since
+ *   garbage collection may move or erase the record.
+ */
+RAIL_Status_t FL_ReadRecord(uint16_t key, uint8_t **data, uint32_t *len);
+
+/**
+ * Delete the record for a key.
+ *
+ * @param[in] key The record key, from 0 to FLASH_LOG_KEY_COUNT - 1.
+ * @return The status of the delete operation.
+ *   RAIL_STATUS_INVALID_PARAMETER if the key is invalid.
+ *   RAIL_STATUS_INVALID_CALL if FL_Init() has not been called or no record
+ *   exists for the key.
+ *   RAIL_STATUS_INVALID_STATE if the flash log is full or a flash operation
+ *   failed.
+ *   RAIL_STATUS_NO_ERROR on success.
+ */
+RAIL_Status_t FL_DeleteRecord(uint16_t key);
+
+/**
+ * Reclaim one page of the flash log ahead of time.
+ *
+ * @return The status of the collect operation.
+ *   RAIL_STATUS_INVALID_CALL if FL_Init() has not been called.
+ *   RAIL_STATUS_INVALID_STATE if there is nothing to reclaim or a flash
+ *   operation failed.
+ *   RAIL_STATUS_NO_ERROR on success.
+ *
+ * Garbage collection otherwise runs on demand from FL_WriteRecord(). Calling
+ * this while the application is idle moves the page erase out of the write
+ * path.
+ */
+RAIL_Status_t FL_Collect(void);
+
+/**
+ * Return the maximum record length in bytes supported by the flash log.
+ *
+ * @return The max record length in bytes.
+ */
+uint32_t FL_GetMaxRecordLength(void);
+
+/**
+ * Return the flash log statistics.
+ *
+ * @param[out] stats A pointer to the statistics to fill in.
+ */
+void FL_GetStats(FL_Stats_t *stats);
+
+#endif // __FLASHLOG_PLUGIN_H__
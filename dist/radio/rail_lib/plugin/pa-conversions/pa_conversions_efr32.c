@@ -49,6 +49,31 @@ static RAIL_TxPowerCurvesConfigAlt_t powerCurvesState;
   #define PA_CONVERSION_MINIMUM_PWRLVL 0
 #endif
 
+#ifdef RAIL_PA_CONVERSIONS_LOOKUP_TABLES
+// Maximum number of deci-dBm values covered by the dBm to raw table of a PA.
+// PAs with a wider power range keep using the curve conversion.
+#ifndef RAIL_PA_CONVERSIONS_LOOKUP_DBM_ENTRIES
+  #define RAIL_PA_CONVERSIONS_LOOKUP_DBM_ENTRIES 512U
+#endif
+
+// Conversion results of every deci-dBm value and power level of a PA, so that
+// conversions are a single table lookup
+typedef struct PaLookupTable {
+  // Number of valid entries in dbmToRaw, 0 if the PA has no table
+  uint16_t dbmEntries;
+  // Deci-dBm value of dbmToRaw[0]
+  RAIL_TxPower_t minPower;
+  // Highest power level in rawToDbm
+  RAIL_TxPowerLevel_t maxPowerLevel;
+  RAIL_TxPowerLevel_t dbmToRaw[RAIL_PA_CONVERSIONS_LOOKUP_DBM_ENTRIES];
+  RAIL_TxPower_t rawToDbm[256];
+} PaLookupTable_t;
+
+static PaLookupTable_t paLookupTables[RAIL_NUM_PA];
+
+static void buildLookupTables(void);
+#endif
+
 // This macro is defined when Silicon Labs builds this into the library as WEAK
 // to ensure it can be overriden by customer versions of these functions. It
 // should *not* be defined in a customer build.
@@ -136,6 +161,10 @@ RAIL_Status_t RAIL_InitTxPowerCurves(const RAIL_TxPowerCurvesConfig_t *config)
          config->piecewiseSegments * sizeof(RAIL_TxPowerCurveSegment_t));
   current->conversion.powerCurve = &txPowerSubGig;
 
+#ifdef RAIL_PA_CONVERSIONS_LOOKUP_TABLES
+  buildLookupTables();
+#endif
+
   return RAIL_STATUS_NO_ERROR;
 #else
   (void) config;
@@ -151,6 +180,10 @@ RAIL_Status_t RAIL_InitTxPowerCurvesAlt(const RAIL_TxPowerCurvesConfigAlt_t *con
   RAIL_VerifyTxPowerCurves(config);
   powerCurvesState = *config;
 
+#ifdef RAIL_PA_CONVERSIONS_LOOKUP_TABLES
+  buildLookupTables();
+#endif
+
   return RAIL_STATUS_NO_ERROR;
 }
 
@@ -187,6 +220,21 @@ RAIL_TxPowerLevel_t RAIL_ConvertDbmToRaw(RAIL_Handle_t railHandle,
     return 0;
   }
 
+#ifdef RAIL_PA_CONVERSIONS_LOOKUP_TABLES
+  if ((mode < RAIL_NUM_PA) && (paLookupTables[mode].dbmEntries != 0U)) {
+    PaLookupTable_t const *table = &paLookupTables[mode];
+    // Powers outside of the table convert like its first or last entry
+    int32_t index = (int32_t)power - table->minPower;
+    if (index < 0) {
+      index = 0;
+    } else if (index >= (int32_t)table->dbmEntries) {
+      index = (int32_t)table->dbmEntries - 1;
+    } else {
+    }
+    return table->dbmToRaw[index];
+  }
+#endif
+
   RAIL_PaDescriptor_t const *modeInfo = &powerCurvesState.curves[mode];
   minPowerLevel = SL_MAX(modeInfo->min, PA_CONVERSION_MINIMUM_PWRLVL);
 
@@ -277,6 +325,17 @@ RAIL_TxPower_t RAIL_ConvertRawToDbm(RAIL_Handle_t railHandle,
     return RAIL_TX_POWER_MIN;
   }
 
+#ifdef RAIL_PA_CONVERSIONS_LOOKUP_TABLES
+  if ((mode < RAIL_NUM_PA) && (paLookupTables[mode].dbmEntries != 0U)) {
+    PaLookupTable_t const *table = &paLookupTables[mode];
+    // Power levels above the PA maximum convert like the maximum
+    if (powerLevel > table->maxPowerLevel) {
+      powerLevel = table->maxPowerLevel;
+    }
+    return table->rawToDbm[powerLevel];
+  }
+#endif
+
   RAIL_PaDescriptor_t const *modeInfo = &powerCurvesState.curves[mode];
 
   if (modeInfo->algorithm == RAIL_PA_ALGORITHM_MAPPING_TABLE) {
@@ -346,3 +405,75 @@ RAIL_TxPower_t RAIL_ConvertRawToDbm(RAIL_Handle_t railHandle,
     }
   }
 }
+
+#ifdef RAIL_PA_CONVERSIONS_LOOKUP_TABLES
+// Fill the lookup tables of every PA by running the curve conversions once
+// for each deci-dBm value and power level. The tables are disabled while they
+// are filled so that the conversions use the curves.
+static void buildLookupTables(void)
+{
+  RAIL_TxPowerMode_t mode;
+
+  for (mode = (RAIL_TxPowerMode_t)0; mode < RAIL_NUM_PA; mode++) {
+    PaLookupTable_t *table = &paLookupTables[mode];
+    RAIL_PaDescriptor_t const *modeInfo = &powerCurvesState.curves[mode];
+    uint32_t minPowerLevel = SL_MAX(modeInfo->min, PA_CONVERSION_MINIMUM_PWRLVL);
+    int32_t minPower;
+    int32_t maxPower;
+    int32_t power;
+    uint32_t powerLevel;
+
+    table->dbmEntries = 0U;
+
+    if (modeInfo->algorithm == RAIL_PA_ALGORITHM_MAPPING_TABLE) {
+      if ((modeInfo->conversion.mappingTable == NULL)
+          || (modeInfo->max < minPowerLevel)) {
+        continue;
+      }
+      // Powers below the lowest table value all convert to the minimum power
+      // level, so the table starts one deci-dBm below it
+      minPower = RAIL_TX_POWER_MAX;
+      maxPower = RAIL_TX_POWER_MIN;
+      for (powerLevel = 0U; powerLevel <= modeInfo->max - minPowerLevel; powerLevel++) {
+        minPower = SL_MIN(minPower, modeInfo->conversion.mappingTable[powerLevel]);
+        maxPower = SL_MAX(maxPower, modeInfo->conversion.mappingTable[powerLevel]);
+      }
+      minPower--;
+    } else {
+      // Powers are capped to the curve range before conversion
+      if (modeInfo->conversion.powerCurve == NULL) {
+        continue;
+      }
+      minPower = modeInfo->conversion.powerCurve->minPower;
+      maxPower = modeInfo->conversion.powerCurve->maxPower;
+    }
+
+    if ((minPower < RAIL_TX_POWER_MIN)
+        || (maxPower >= RAIL_TX_POWER_MAX)
+        || (maxPower < minPower)
+        || ((maxPower - minPower + 1) > (int32_t)RAIL_PA_CONVERSIONS_LOOKUP_DBM_ENTRIES)) {
+      continue;
+    }
+
+    for (power = minPower; power <= maxPower; power++) {
+      table->dbmToRaw[power - minPower] =
+        RAIL_ConvertDbmToRaw(NULL, mode, (RAIL_TxPower_t)power);
+    }
+
+    // Power levels below the first mapping table entry have no dBm value,
+    // use the value of the first entry
+    if (modeInfo->algorithm != RAIL_PA_ALGORITHM_MAPPING_TABLE) {
+      minPowerLevel = 0U;
+    }
+    for (powerLevel = 0U; powerLevel <= modeInfo->max; powerLevel++) {
+      table->rawToDbm[powerLevel] =
+        RAIL_ConvertRawToDbm(NULL, mode,
+                             (RAIL_TxPowerLevel_t)SL_MAX(powerLevel, minPowerLevel));
+    }
+
+    table->minPower = (RAIL_TxPower_t)minPower;
+    table->maxPowerLevel = (RAIL_TxPowerLevel_t)modeInfo->max;
+    table->dbmEntries = (uint16_t)(maxPower - minPower + 1);
+  }
+}
+#endif
@@ -86,6 +86,10 @@ RAIL_Status_t RAIL_InitTxPowerCurves(const RAIL_TxPowerCurvesConfig_t *config);
  * tx power curves.
  * @return RAIL_Status_t indicating success or an error.
  *
+ * @note: When RAIL_PA_CONVERSIONS_LOOKUP_TABLES is defined, this function
+ * also fills a table of the conversion results of every deci-dBm value and
+ * power level of each PA, so that RAIL_ConvertDbmToRaw and
+ * RAIL_ConvertRawToDbm are a single table lookup.
  */
 RAIL_Status_t RAIL_InitTxPowerCurvesAlt(const RAIL_TxPowerCurvesConfigAlt_t *config);
 
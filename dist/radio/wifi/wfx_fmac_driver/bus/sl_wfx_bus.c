@@ -22,6 +22,7 @@ static sl_status_t sl_wfx_bus_access(sl_wfx_host_bus_transfer_type_t type,
                                      sl_wfx_register_address_t address,
                                      void *buffer,
                                      uint32_t length);
+static sl_status_t sl_wfx_bus_wake_up(sl_wfx_host_bus_transfer_type_t type);
 
 sl_status_t sl_wfx_reg_read_16(sl_wfx_register_address_t address, uint16_t *value_out)
 {
@@ -138,6 +139,42 @@ sl_status_t sl_wfx_data_write(const void *buffer, uint32_t length)
   return result;
 }
 
+sl_status_t sl_wfx_data_write_segments(const sl_wfx_data_segment_t *segments, uint8_t segment_count, uint32_t length)
+{
+  sl_status_t result;
+
+#if (SL_WFX_DEBUG_MASK & (SL_WFX_DEBUG_TX | SL_WFX_DEBUG_TX_RAW))
+  sl_wfx_host_log("TX> %02X%02X %02X %02X ",
+                  segments[0].data[0],
+                  segments[0].data[1],
+                  segments[0].data[2],
+                  segments[0].data[3]);
+#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_TX_RAW)
+  for (uint8_t segment = 0; segment < segment_count; segment++) {
+    for (uint32_t i = (segment == 0) ? 4 : 0; i < segments[segment].length; i++) {
+      sl_wfx_host_log("%02X", segments[segment].data[i]);
+    }
+  }
+#endif
+  sl_wfx_host_log("\r\n");
+#endif
+
+  result = sl_wfx_bus_wake_up(SL_WFX_BUS_WRITE);
+  SL_WFX_ERROR_CHECK(result);
+
+  result = sl_wfx_reg_write_segments(SL_WFX_IN_OUT_QUEUE_REG_ID, segments, segment_count, length);
+
+#ifdef SL_WFX_USE_STATISTICS
+  if (result == SL_STATUS_OK) {
+    sl_wfx_context->statistics.registers[SL_WFX_IN_OUT_QUEUE_REG_ID].write_count++;
+    sl_wfx_context->statistics.registers[SL_WFX_IN_OUT_QUEUE_REG_ID].write_bytes += length;
+  }
+#endif //SL_WFX_USE_STATISTICS
+
+  error_handler:
+  return result;
+}
+
 sl_status_t sl_wfx_apb_write(uint32_t address, const void *buffer, uint32_t length)
 {
   sl_status_t result;
@@ -179,14 +216,17 @@ sl_status_t sl_wfx_apb_read_32(uint32_t address, uint32_t *value_out)
   result = sl_wfx_reg_read_32(SL_WFX_CONFIG_REG_ID, &value32);
   result = sl_wfx_reg_write_32(SL_WFX_CONFIG_REG_ID, value32 | CONFIG_PREFETCH_BIT);
 
-  // and wait for the prefetch bit to clear
-  for (uint32_t i = 0; i < 20; i++) {
+  // and wait for the prefetch bit to clear, the first polls are done back
+  // to back since the prefetch usually completes in a few microseconds
+  for (uint32_t i = 0; i < 20 + SL_WFX_POLL_SPIN_COUNT; i++) {
     result = sl_wfx_reg_read_32(SL_WFX_CONFIG_REG_ID, &value32);
     if ((value32 & CONFIG_PREFETCH_BIT) == 0) {
       break;
     }
 
-    sl_wfx_host_wait(1);
+    if (i >= SL_WFX_POLL_SPIN_COUNT) {
+      sl_wfx_host_wait(1);
+    }
   }
 
   // and data is ready
@@ -202,21 +242,8 @@ static sl_status_t sl_wfx_bus_access(sl_wfx_host_bus_transfer_type_t type,
 {
   sl_status_t result;
 
-  /* If the WFx is sleeping, wake it up */
-  if (sl_wfx_context->state & SL_WFX_SLEEPING) {
-    result = sl_wfx_host_set_wake_up_pin(1);
-    SL_WFX_ERROR_CHECK(result);
-    /* If the command is of read type, consider the WFx awake */
-    if (type == SL_WFX_BUS_WRITE) {
-      result = sl_wfx_host_wait_for_wake_up();
-      SL_WFX_ERROR_CHECK(result);
-    }
-    sl_wfx_context->state &= ~SL_WFX_SLEEPING;
-
-#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_SLEEP)
-    sl_wfx_host_log("WFx awake\r\n");
-#endif
-  }
+  result = sl_wfx_bus_wake_up(type);
+  SL_WFX_ERROR_CHECK(result);
 
   /* Send the communication on the bus */
   if (type == SL_WFX_BUS_READ) {
@@ -228,6 +255,19 @@ static sl_status_t sl_wfx_bus_access(sl_wfx_host_bus_transfer_type_t type,
   }
   SL_WFX_ERROR_CHECK(result);
 
+#ifdef SL_WFX_USE_STATISTICS
+  if (address < SL_WFX_STATS_REGISTER_COUNT) {
+    sl_wfx_register_stats_t *stats = &sl_wfx_context->statistics.registers[address];
+    if (type == SL_WFX_BUS_READ) {
+      stats->read_count++;
+      stats->read_bytes += length;
+    } else {
+      stats->write_count++;
+      stats->write_bytes += length;
+    }
+  }
+#endif //SL_WFX_USE_STATISTICS
+
   /* If the power save is active and there is no confirmation pending, put
      the WFx back to sleep */
   if ((sl_wfx_context->state & SL_WFX_POWER_SAVE_ACTIVE)
@@ -241,6 +281,9 @@ static sl_status_t sl_wfx_bus_access(sl_wfx_host_bus_transfer_type_t type,
       sl_wfx_context->state |= SL_WFX_SLEEPING;
       result = sl_wfx_host_set_wake_up_pin(0);
       SL_WFX_ERROR_CHECK(result);
+#ifdef SL_WFX_USE_STATISTICS
+      sl_wfx_context->statistics.sleeps++;
+#endif
 
 #if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_SLEEP)
       sl_wfx_host_log("WFx sleeping\r\n");
@@ -251,3 +294,30 @@ static sl_status_t sl_wfx_bus_access(sl_wfx_host_bus_transfer_type_t type,
   error_handler:
   return result;
 }
+
+static sl_status_t sl_wfx_bus_wake_up(sl_wfx_host_bus_transfer_type_t type)
+{
+  sl_status_t result = SL_STATUS_OK;
+
+  /* If the WFx is sleeping, wake it up */
+  if (sl_wfx_context->state & SL_WFX_SLEEPING) {
+    result = sl_wfx_host_set_wake_up_pin(1);
+    SL_WFX_ERROR_CHECK(result);
+    /* If the command is of read type, consider the WFx awake */
+    if (type == SL_WFX_BUS_WRITE) {
+      result = sl_wfx_host_wait_for_wake_up();
+      SL_WFX_ERROR_CHECK(result);
+    }
+    sl_wfx_context->state &= ~SL_WFX_SLEEPING;
+#ifdef SL_WFX_USE_STATISTICS
+    sl_wfx_context->statistics.wake_ups++;
+#endif
+
+#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_SLEEP)
+    sl_wfx_host_log("WFx awake\r\n");
+#endif
+  }
+
+  error_handler:
+  return result;
+}
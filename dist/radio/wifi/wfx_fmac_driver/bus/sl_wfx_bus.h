@@ -33,6 +33,11 @@ sl_status_t sl_wfx_reg_read(sl_wfx_register_address_t address, void *buffer, uin
 
 sl_status_t sl_wfx_reg_write(sl_wfx_register_address_t address, const void *buffer, uint32_t length);
 
+sl_status_t sl_wfx_reg_write_segments(sl_wfx_register_address_t address,
+                                      const sl_wfx_data_segment_t *segments,
+                                      uint8_t segment_count,
+                                      uint32_t length);
+
 sl_status_t sl_wfx_notify_bus_thread(void);
 
 /* WF200 basic register API */
@@ -48,6 +53,8 @@ sl_status_t sl_wfx_data_read(void *buffer, uint32_t length);
 
 sl_status_t sl_wfx_data_write(const void *buffer, uint32_t length);
 
+sl_status_t sl_wfx_data_write_segments(const sl_wfx_data_segment_t *segments, uint8_t segment_count, uint32_t length);
+
 sl_status_t sl_wfx_apb_write_32(uint32_t address, uint32_t value_in);
 
 sl_status_t sl_wfx_apb_read_32(uint32_t address, uint32_t *value_out);
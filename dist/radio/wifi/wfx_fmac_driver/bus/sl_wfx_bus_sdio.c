@@ -91,6 +91,45 @@ sl_status_t sl_wfx_reg_write(sl_wfx_register_address_t address, const void *buff
   return sl_wfx_host_sdio_transfer_cmd53(SL_WFX_BUS_WRITE, 1, reg_address, (void *)buffer, current_transfer_size);
 }
 
+sl_status_t sl_wfx_reg_write_segments(sl_wfx_register_address_t address,
+                                      const sl_wfx_data_segment_t *segments,
+                                      uint8_t segment_count,
+                                      uint32_t length)
+{
+  static const uint8_t  padding[SL_WFX_SDIO_BLOCK_SIZE];
+  sl_wfx_data_segment_t transfer_segments[SL_WFX_DATA_SEGMENT_MAX + 1];
+  uint32_t buffer_id = 0;
+  uint32_t reg_address;
+  uint32_t written = 0;
+  uint32_t current_transfer_size = (length >= SL_WFX_SDIO_BLOCK_MODE_THRESHOLD) ? SL_WFX_ROUND_UP(length, SL_WFX_SDIO_BLOCK_SIZE) : length;
+
+  if (segment_count > SL_WFX_DATA_SEGMENT_MAX) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  if (address == SL_WFX_IN_OUT_QUEUE_REG_ID) {
+    buffer_id = tx_buffer_id++;
+    if (tx_buffer_id > 31) {
+      tx_buffer_id = 0;
+    }
+  }
+
+  reg_address = (buffer_id << 7) | (address << 2);
+
+  for (uint8_t i = 0; i < segment_count; i++) {
+    transfer_segments[i] = segments[i];
+    written += segments[i].length;
+  }
+  /* The frame is padded up to the transfer size with a zeroed segment */
+  if (written < current_transfer_size) {
+    transfer_segments[segment_count].data   = padding;
+    transfer_segments[segment_count].length = current_transfer_size - written;
+    segment_count++;
+  }
+
+  return sl_wfx_host_sdio_transfer_cmd53_segments(1, reg_address, transfer_segments, segment_count, current_transfer_size);
+}
+
 sl_status_t sl_wfx_init_bus(void)
 {
   sl_status_t result;
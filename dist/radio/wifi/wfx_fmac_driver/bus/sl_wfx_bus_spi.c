@@ -17,6 +17,7 @@
 #include "sl_wfx_bus.h"
 #include "sl_wfx_host_api.h"
 #include "firmware/sl_wfx_registers.h"
+#include <stddef.h>
 
 #define SET_WRITE 0x7FFF /* usage: and operation */
 #define SET_READ 0x8000  /* usage: or operation */
@@ -80,6 +81,37 @@ sl_status_t sl_wfx_reg_write(sl_wfx_register_address_t address, const void *buff
   return SL_STATUS_OK;
 }
 
+sl_status_t sl_wfx_reg_write_segments(sl_wfx_register_address_t address,
+                                      const sl_wfx_data_segment_t *segments,
+                                      uint8_t segment_count,
+                                      uint32_t length)
+{
+  static uint8_t padding[2];
+  uint16_t header = /* write flag = 0*/ (address << 12) | (length / 2);
+  uint32_t written = 0;
+
+  uint8_t header_as_bytes[2];
+  sl_wfx_pack_16bit_big_endian(header_as_bytes, header);
+
+  sl_wfx_host_spi_cs_assert();
+  /* The header goes with the first segment, the other segments follow in the same chip select frame */
+  for (uint8_t i = 0; i < segment_count; i++) {
+    sl_wfx_host_spi_transfer_no_cs_assert(SL_WFX_BUS_WRITE,
+                                          (i == 0) ? header_as_bytes : NULL,
+                                          (i == 0) ? 2 : 0,
+                                          (uint8_t *)segments[i].data,
+                                          segments[i].length);
+    written += segments[i].length;
+  }
+  /* Pad an odd frame to the next 16-bit word */
+  if (written < length) {
+    sl_wfx_host_spi_transfer_no_cs_assert(SL_WFX_BUS_WRITE, NULL, 0, padding, length - written);
+  }
+  sl_wfx_host_spi_cs_deassert();
+
+  return SL_STATUS_OK;
+}
+
 sl_status_t sl_wfx_init_bus(void)
 {
   sl_status_t status;
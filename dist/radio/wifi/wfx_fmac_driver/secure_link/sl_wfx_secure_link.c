@@ -19,6 +19,9 @@
  */
 
 #include "sl_wfx_secure_link.h"
+#ifdef SL_WFX_USE_SECURE_LINK_CCM
+#include "sl_wfx_secure_link_ccm.h"
+#endif
 
 #ifdef SL_WFX_USE_SECURE_LINK
 /******************************************************
@@ -218,6 +221,11 @@ sl_status_t sl_wfx_secure_link_renegotiate_session_key(void)
   result = sl_wfx_host_verify_pub_key(exchange_pub_keys_ind, sl_wfx_context->secure_link_mac_key, sl_host_pub_key);
   SL_WFX_ERROR_CHECK(result);
 
+#ifdef SL_WFX_USE_SECURE_LINK_CCM
+  /* Expand the key schedule of the new session key before the next message */
+  sl_wfx_secure_link_ccm_set_key(sl_wfx_context->secure_link_session_key);
+#endif
+
 #if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_SLK)
   sl_wfx_host_log("--Key renegotiated--\r\n");
 #endif
@@ -0,0 +1,37 @@
+/*
+ *  Software AES-CCM backend for the secure link host API
+ */
+
+#ifndef SL_WFX_SECURE_LINK_CCM_H
+#define SL_WFX_SECURE_LINK_CCM_H
+
+#include "sl_wfx.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#if defined(SL_WFX_USE_SECURE_LINK) && defined(SL_WFX_USE_SECURE_LINK_CCM)
+
+void sl_wfx_secure_link_ccm_set_key(const uint8_t *session_key);
+
+sl_status_t sl_wfx_secure_link_ccm_encrypt(const uint8_t *session_key,
+                                           const uint8_t *nonce,
+                                           uint8_t *data,
+                                           uint32_t length,
+                                           uint8_t *tag);
+
+sl_status_t sl_wfx_secure_link_ccm_decrypt(const uint8_t *session_key,
+                                           const uint8_t *nonce,
+                                           uint8_t *data,
+                                           uint32_t length,
+                                           const uint8_t *tag);
+
+#endif //SL_WFX_USE_SECURE_LINK && SL_WFX_USE_SECURE_LINK_CCM
+
+#ifdef __cplusplus
+} /*extern "C" */
+#endif
+
+#endif // SL_WFX_SECURE_LINK_CCM_H
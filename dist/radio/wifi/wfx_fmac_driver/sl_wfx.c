@@ -29,6 +29,20 @@
 *                      Macros
 ******************************************************/
 
+#ifdef SL_WFX_USE_BOOT_TIMING
+#define SL_WFX_BOOT_PHASE_END(phase) do {                                    \
+    uint32_t now = sl_wfx_host_get_time_us();                                \
+    sl_wfx_context->boot_timing.phase = now - sl_wfx_boot_phase_start;       \
+    sl_wfx_boot_phase_start = now;                                           \
+} while (0)
+#else
+#define SL_WFX_BOOT_PHASE_END(phase)
+#endif
+
+#if ((SL_WFX_FW_DOWNLOAD_CHUNK_SIZE % DOWNLOAD_BLOCK_SIZE) != 0) || (SL_WFX_FW_DOWNLOAD_CHUNK_SIZE > 0x1C00)
+#error "SL_WFX_FW_DOWNLOAD_CHUNK_SIZE must be a multiple of DOWNLOAD_BLOCK_SIZE, up to 7 KB"
+#endif
+
 /******************************************************
 *                    Constants
 ******************************************************/
@@ -51,6 +65,14 @@
 sl_wfx_context_t *sl_wfx_context;
 static uint8_t   encryption_keyset;
 static uint16_t  sl_wfx_input_buffer_number;
+#ifdef SL_WFX_USE_BOOT_TIMING
+static uint32_t  sl_wfx_boot_start;
+static uint32_t  sl_wfx_boot_phase_start;
+#endif
+#ifdef SL_WFX_USE_TX_QUEUE
+/* Priority class of each 802.1D user priority, the highest class is sent first */
+static const uint8_t sl_wfx_tx_queue_class[8] = { 1, 0, 0, 1, 2, 2, 3, 3 };
+#endif //SL_WFX_USE_TX_QUEUE
 /******************************************************
 *               Static Function Declarations
 ******************************************************/
@@ -63,6 +85,27 @@ static sl_status_t sl_wfx_download_run_bootloader(void);
 static sl_status_t sl_wfx_download_run_firmware(void);
 static sl_status_t sl_wfx_compare_keysets(uint8_t sl_wfx_keyset,
                                           char *firmware_keyset);
+static sl_status_t sl_wfx_receive_frame_locked(uint16_t *ctrl_reg);
+static sl_status_t sl_wfx_send_request_locked(uint8_t command_id,
+                                              sl_wfx_generic_message_t *request,
+                                              uint16_t request_length);
+static void sl_wfx_set_ethernet_frame_header(sl_wfx_send_frame_req_t *frame,
+                                             uint32_t data_length,
+                                             sl_wfx_interface_t interface,
+                                             uint8_t priority);
+#ifdef SL_WFX_USE_TX_QUEUE
+static bool sl_wfx_tx_queue_credit_available(void);
+static void sl_wfx_tx_queue_flush(void);
+static void sl_wfx_tx_queue_discard(void);
+#endif //SL_WFX_USE_TX_QUEUE
+#ifdef SL_WFX_USE_STATISTICS
+static uint8_t sl_wfx_stats_bin(uint32_t value, uint32_t base, uint8_t bin_count);
+static void sl_wfx_stats_add_frame(sl_wfx_frame_stats_t *stats, uint32_t length);
+static void sl_wfx_stats_add_confirmation(uint8_t command_id);
+#ifdef SL_WFX_USE_SECURE_LINK
+static void sl_wfx_stats_add_crypto(sl_wfx_crypto_stats_t *stats, uint32_t length, uint32_t start);
+#endif //SL_WFX_USE_SECURE_LINK
+#endif //SL_WFX_USE_STATISTICS
 
 /******************************************************
 *               Function Definitions
@@ -92,26 +135,40 @@ sl_status_t sl_wfx_init(sl_wfx_context_t *context)
   sl_wfx_secure_link_mode_t link_mode;
   sl_wfx_context->secure_link_renegotiation_state = SL_WFX_SECURELINK_DEFAULT;
 #endif
+#ifdef SL_WFX_USE_TX_QUEUE
+  // Free the frames a previous session left queued before losing track of them
+  if (sl_wfx_context != NULL) {
+    sl_wfx_tx_queue_discard();
+  }
+#endif //SL_WFX_USE_TX_QUEUE
 
   memset(context, 0, sizeof(*context) );
 
   sl_wfx_context = context;
   sl_wfx_context->used_buffers = 0;
 
+#ifdef SL_WFX_USE_BOOT_TIMING
+  sl_wfx_boot_start       = sl_wfx_host_get_time_us();
+  sl_wfx_boot_phase_start = sl_wfx_boot_start;
+#endif
+
   result = sl_wfx_init_bus(  );
   SL_WFX_ERROR_CHECK(result);
+  SL_WFX_BOOT_PHASE_END(bus_init);
 #if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_INIT)
   sl_wfx_host_log("--Bus initialized--\r\n");
 #endif
 
   result = sl_wfx_init_chip( );
   SL_WFX_ERROR_CHECK(result);
+  SL_WFX_BOOT_PHASE_END(chip_init);
 #if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_INIT)
   sl_wfx_host_log("--Chip initialized--\r\n");
 #endif
 
   result = sl_wfx_download_run_bootloader();
   SL_WFX_ERROR_CHECK(result);
+  SL_WFX_BOOT_PHASE_END(bootloader);
 #if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_INIT)
   sl_wfx_host_log("--Bootloader running--\r\n");
 #endif
@@ -122,6 +179,7 @@ sl_status_t sl_wfx_init(sl_wfx_context_t *context)
   /* Downloading Wi-Fi chip firmware */
   result = sl_wfx_download_run_firmware( );
   SL_WFX_ERROR_CHECK(result);
+  SL_WFX_BOOT_PHASE_END(firmware_download);
 #if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_INIT)
   sl_wfx_host_log("--Firmware downloaded--\r\n");
 #endif
@@ -140,6 +198,7 @@ sl_status_t sl_wfx_init(sl_wfx_context_t *context)
                                              SL_WFX_DEFAULT_REQUEST_TIMEOUT_MS,
                                              (void **)&startup_info);
   SL_WFX_ERROR_CHECK(result);
+  SL_WFX_BOOT_PHASE_END(startup);
 
   /* Store the firware version in the context */
   context->firmware_build = startup_info->body.firmware_build;
@@ -236,6 +295,10 @@ sl_status_t sl_wfx_init(sl_wfx_context_t *context)
 #endif
 
   sl_wfx_context->state = SL_WFX_STARTED;
+  SL_WFX_BOOT_PHASE_END(configuration);
+#ifdef SL_WFX_USE_BOOT_TIMING
+  sl_wfx_context->boot_timing.total = sl_wfx_boot_phase_start - sl_wfx_boot_start;
+#endif
 
   error_handler:
   if (result != SL_STATUS_OK) {
@@ -556,21 +619,318 @@ sl_status_t sl_wfx_send_ethernet_frame(sl_wfx_send_frame_req_t *frame,
   sl_status_t result;
   uint32_t request_length = SL_WFX_ROUND_UP_EVEN(sizeof(sl_wfx_send_frame_req_t) + data_length);
 
-  sl_wfx_context->data_frame_id++;
-
-  frame->header.length           = sl_wfx_htole16(data_length + sizeof(sl_wfx_send_frame_req_t));
-  frame->header.id               = SL_WFX_SEND_FRAME_REQ_ID;
-  frame->header.info             = (interface << SL_WFX_MSG_INFO_INTERFACE_OFFSET) & SL_WFX_MSG_INFO_INTERFACE_MASK;
-  frame->body.frame_type         = WFM_FRAME_TYPE_DATA;
-  frame->body.priority           = priority;
-  frame->body.packet_id          = sl_wfx_htole16(sl_wfx_context->data_frame_id);
-  frame->body.packet_data_length = sl_wfx_htole32(data_length);
+  sl_wfx_set_ethernet_frame_header(frame, data_length, interface, priority);
 
   result = sl_wfx_send_request(SL_WFX_SEND_FRAME_REQ_ID, (sl_wfx_generic_message_t*) frame, request_length);
 
   return result;
 }
 
+#ifdef SL_WFX_USE_TX_QUEUE
+/**************************************************************************//**
+ * @brief Send an Ethernet frame, queueing it if the Wi-Fi chip has no free
+ * input buffer
+ *
+ * @param frame contains the Ethernet frame to be sent. It must be allocated
+ * with sl_wfx_allocate_command_buffer() using SL_WFX_TX_FRAME_BUFFER.
+ * @param data_length is the length of the Ethernet frame
+ * @param interface is the interface used to send the ethernet frame.
+ *   @arg         SL_WFX_STA_INTERFACE
+ *   @arg         SL_WFX_SOFTAP_INTERFACE
+ * @param priority is the 802.1D priority level (0 to 7) used to send the
+ * Ethernet frame. It also selects the queue priority class.
+ * @returns SL_STATUS_OK if the frame has been sent or queued,
+ * SL_STATUS_NO_MORE_RESOURCE if the queue of the priority class is full,
+ * SL_STATUS_FAIL otherwise
+ *
+ * @note On success, the driver owns the frame and frees it with
+ * sl_wfx_free_command_buffer() once it is written to the Wi-Fi chip. On
+ * failure, the frame is left to the caller. Queued frames are sent as soon as
+ * confirmations received by sl_wfx_receive_frame() release input buffers,
+ * highest priority class first. SL_WFX_TX_QUEUE_CONTROL_CREDITS input
+ * buffers are kept free for control requests.
+ *****************************************************************************/
+sl_status_t sl_wfx_send_ethernet_frame_queued(sl_wfx_send_frame_req_t *frame,
+                                              uint32_t data_length,
+                                              sl_wfx_interface_t interface,
+                                              uint8_t priority)
+{
+  sl_status_t              result;
+  sl_wfx_tx_queue_t       *queue = &sl_wfx_context->tx_queue;
+  sl_wfx_tx_queue_stats_t *stats = &sl_wfx_context->tx_queue_stats;
+  sl_wfx_tx_queue_entry_t *entry;
+  uint16_t                 request_length = SL_WFX_ROUND_UP_EVEN(sizeof(sl_wfx_send_frame_req_t) + data_length);
+  uint8_t                  queue_class = sl_wfx_tx_queue_class[priority & 0x07];
+
+  result = sl_wfx_host_lock();
+  SL_WFX_ERROR_CHECK(result);
+
+  sl_wfx_set_ethernet_frame_header(frame, data_length, interface, priority);
+
+  /* Send the frame right away if nothing is waiting and an input buffer is free */
+  if (stats->depth == 0 && sl_wfx_tx_queue_credit_available()) {
+    result = sl_wfx_send_request_locked(SL_WFX_SEND_FRAME_REQ_ID, (sl_wfx_generic_message_t *)frame, request_length);
+    SL_WFX_ERROR_CHECK(result);
+    stats->sent_frames++;
+    sl_wfx_free_command_buffer((sl_wfx_generic_message_t *)frame, SL_WFX_SEND_FRAME_REQ_ID, SL_WFX_TX_FRAME_BUFFER);
+    goto error_handler;
+  }
+
+  if (queue->count[queue_class] >= SL_WFX_TX_QUEUE_LENGTH) {
+    stats->dropped_frames++;
+    result = SL_STATUS_NO_MORE_RESOURCE;
+    goto error_handler;
+  }
+
+  entry = &queue->entries[queue_class][(queue->head[queue_class] + queue->count[queue_class]) % SL_WFX_TX_QUEUE_LENGTH];
+  entry->frame          = frame;
+  entry->request_length = request_length;
+  entry->enqueue_time   = sl_wfx_host_get_time_us();
+  queue->count[queue_class]++;
+
+  stats->queued_frames++;
+  stats->depth++;
+  if (stats->depth > stats->max_depth) {
+    stats->max_depth = stats->depth;
+  }
+
+  /* Credits may have been released since the last flush */
+  sl_wfx_tx_queue_flush();
+
+  error_handler:
+  if (sl_wfx_host_unlock() != SL_STATUS_OK) {
+    result = SL_STATUS_FAIL;
+  }
+#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_ERROR)
+  if (result != SL_STATUS_OK) {
+    sl_wfx_host_log("Queue frame error %u\n", result);
+  }
+#endif
+  return result;
+}
+
+/**************************************************************************//**
+ * @brief Get the TX queue counters
+ *
+ * @param stats is a pointer to the structure receiving the counters
+ * @returns SL_STATUS_OK if the counters are retrieved correctly,
+ * SL_STATUS_FAIL otherwise
+ *****************************************************************************/
+sl_status_t sl_wfx_get_tx_queue_stats(sl_wfx_tx_queue_stats_t *stats)
+{
+  sl_status_t result;
+
+  result = sl_wfx_host_lock();
+  SL_WFX_ERROR_CHECK(result);
+
+  *stats = sl_wfx_context->tx_queue_stats;
+
+  result = sl_wfx_host_unlock();
+
+  error_handler:
+  return result;
+}
+
+/**************************************************************************//**
+ * @brief Reset the TX queue counters
+ *
+ * @returns SL_STATUS_OK if the counters are reset correctly,
+ * SL_STATUS_FAIL otherwise
+ *
+ * @note The current depth is kept, the maximum depth restarts from it
+ *****************************************************************************/
+sl_status_t sl_wfx_reset_tx_queue_stats(void)
+{
+  sl_status_t result;
+  uint16_t    depth;
+
+  result = sl_wfx_host_lock();
+  SL_WFX_ERROR_CHECK(result);
+
+  depth = sl_wfx_context->tx_queue_stats.depth;
+  memset(&sl_wfx_context->tx_queue_stats, 0, sizeof(sl_wfx_context->tx_queue_stats));
+  sl_wfx_context->tx_queue_stats.depth     = depth;
+  sl_wfx_context->tx_queue_stats.max_depth = depth;
+
+  result = sl_wfx_host_unlock();
+
+  error_handler:
+  return result;
+}
+#endif //SL_WFX_USE_TX_QUEUE
+
+#ifdef SL_WFX_USE_STATISTICS
+/**************************************************************************//**
+ * @brief Get the driver statistics
+ *
+ * @param stats is a pointer to the structure receiving the statistics
+ * @returns SL_STATUS_OK if the statistics are retrieved correctly,
+ * SL_STATUS_FAIL otherwise
+ *
+ * @note The statistics are collected since sl_wfx_init() or the last
+ * sl_wfx_reset_statistics() call
+ *****************************************************************************/
+sl_status_t sl_wfx_get_statistics(sl_wfx_statistics_t *stats)
+{
+  sl_status_t result;
+
+  result = sl_wfx_host_lock();
+  SL_WFX_ERROR_CHECK(result);
+
+  *stats = sl_wfx_context->statistics;
+
+  result = sl_wfx_host_unlock();
+
+  error_handler:
+  return result;
+}
+
+/**************************************************************************//**
+ * @brief Reset the driver statistics
+ *
+ * @returns SL_STATUS_OK if the statistics are reset correctly,
+ * SL_STATUS_FAIL otherwise
+ *****************************************************************************/
+sl_status_t sl_wfx_reset_statistics(void)
+{
+  sl_status_t result;
+
+  result = sl_wfx_host_lock();
+  SL_WFX_ERROR_CHECK(result);
+
+  memset(&sl_wfx_context->statistics, 0, sizeof(sl_wfx_context->statistics));
+
+  result = sl_wfx_host_unlock();
+
+  error_handler:
+  return result;
+}
+#endif //SL_WFX_USE_STATISTICS
+
+/**************************************************************************//**
+ * @brief Send an Ethernet frame given as a list of segments
+ *
+ * @param frame is the frame header, only the sl_wfx_send_frame_req_t part is
+ * used and the Ethernet payload does not need to follow it
+ * @param segments is the list of segments forming the Ethernet frame
+ * @param segment_count is the number of segments in the list. At most
+ * SL_WFX_DATA_SEGMENT_MAX - 1 segments can be given.
+ * @param interface is the interface used to send the ethernet frame.
+ *   @arg         SL_WFX_STA_INTERFACE
+ *   @arg         SL_WFX_SOFTAP_INTERFACE
+ * @param priority is the priority level used to send the Ethernet frame.
+ * @returns SL_STATUS_OK if the request has been sent correctly,
+ * SL_STATUS_INVALID_PARAMETER if there are too many segments,
+ * SL_STATUS_NO_MORE_RESOURCE if the Wi-Fi chip has no free input buffer,
+ * SL_STATUS_FAIL otherwise
+ *
+ * @note The header and the segments are written to the Wi-Fi chip in a
+ * single bus transaction through sl_wfx_host_transmit_frame_segments(), so
+ * the payload is never copied. If the frame needs secure link encryption, it
+ * is gathered in a command buffer and sent with sl_wfx_send_ethernet_frame().
+ * With SL_WFX_USE_TX_QUEUE, SL_STATUS_NO_MORE_RESOURCE is also returned while
+ * frames wait in the TX queue or only the control credits are free, so a
+ * segmented frame never overtakes the frames given to
+ * sl_wfx_send_ethernet_frame_queued().
+ *****************************************************************************/
+sl_status_t sl_wfx_send_ethernet_frame_segments(sl_wfx_send_frame_req_t *frame,
+                                                const sl_wfx_data_segment_t *segments,
+                                                uint8_t segment_count,
+                                                sl_wfx_interface_t interface,
+                                                uint8_t priority)
+{
+  sl_status_t           result;
+  sl_wfx_data_segment_t transfer_segments[SL_WFX_DATA_SEGMENT_MAX];
+  uint32_t              data_length = 0;
+  uint32_t              request_length;
+
+  if (segment_count >= SL_WFX_DATA_SEGMENT_MAX) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  for (uint8_t i = 0; i < segment_count; i++) {
+    data_length += segments[i].length;
+  }
+
+#ifdef SL_WFX_USE_SECURE_LINK
+  if (sl_wfx_secure_link_encryption_required_get(SL_WFX_SEND_FRAME_REQ_ID) == SL_WFX_SECURE_LINK_ENCRYPTION_REQUIRED) {
+    sl_wfx_send_frame_req_t *gathered_frame = NULL;
+    uint8_t                 *payload;
+
+    result = sl_wfx_allocate_command_buffer((sl_wfx_generic_message_t **)&gathered_frame,
+                                            SL_WFX_SEND_FRAME_REQ_ID,
+                                            SL_WFX_TX_FRAME_BUFFER,
+                                            SL_WFX_ROUND_UP_EVEN(sizeof(sl_wfx_send_frame_req_t) + data_length));
+    SL_WFX_ERROR_CHECK(result);
+
+    payload = gathered_frame->body.packet_data;
+    for (uint8_t i = 0; i < segment_count; i++) {
+      memcpy(payload, segments[i].data, segments[i].length);
+      payload += segments[i].length;
+    }
+
+    result = sl_wfx_send_ethernet_frame(gathered_frame, data_length, interface, priority);
+    sl_wfx_free_command_buffer((sl_wfx_generic_message_t *)gathered_frame,
+                               SL_WFX_SEND_FRAME_REQ_ID,
+                               SL_WFX_TX_FRAME_BUFFER);
+    return result;
+  }
+#endif //SL_WFX_USE_SECURE_LINK
+
+  request_length = SL_WFX_ROUND_UP_EVEN(sizeof(sl_wfx_send_frame_req_t) + data_length);
+
+  result = sl_wfx_host_lock();
+  if (result != SL_STATUS_OK) {
+    return SL_STATUS_FAIL;
+  }
+
+#ifdef SL_WFX_USE_TX_QUEUE
+  /* Do not overtake the queued frames nor use the control credits */
+  if (sl_wfx_context->tx_queue_stats.depth > 0 || !sl_wfx_tx_queue_credit_available()) {
+#else
+  if (sl_wfx_context->used_buffers >= sl_wfx_input_buffer_number) {
+#endif //SL_WFX_USE_TX_QUEUE
+    result = SL_STATUS_NO_MORE_RESOURCE;
+    goto error_handler;
+  }
+
+#ifdef SL_WFX_USE_SECURE_LINK
+  if (sl_wfx_context->secure_link_renegotiation_state == SL_WFX_SECURELINK_RENEGOTIATION_PENDING) {
+    result = SL_STATUS_FAIL;
+    goto error_handler;
+  }
+#endif //SL_WFX_USE_SECURE_LINK
+
+  sl_wfx_set_ethernet_frame_header(frame, data_length, interface, priority);
+
+  transfer_segments[0].data   = (const uint8_t *)frame;
+  transfer_segments[0].length = sizeof(sl_wfx_send_frame_req_t);
+  for (uint8_t i = 0; i < segment_count; i++) {
+    transfer_segments[i + 1] = segments[i];
+  }
+
+  result = sl_wfx_host_transmit_frame_segments(transfer_segments, segment_count + 1, request_length);
+  SL_WFX_ERROR_CHECK(result);
+
+  sl_wfx_context->used_buffers++;
+
+#ifdef SL_WFX_USE_STATISTICS
+  sl_wfx_stats_add_frame(&sl_wfx_context->statistics.tx_frames, data_length);
+#endif
+
+  error_handler:
+  // The lock is held on every path to here
+  if (sl_wfx_host_unlock() != SL_STATUS_OK) {
+    result = SL_STATUS_FAIL;
+  }
+#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_ERROR)
+  if (result != SL_STATUS_OK) {
+    sl_wfx_host_log("Send frame segments error %u\n", result);
+  }
+#endif
+  return result;
+}
+
 /**************************************************************************//**
  * @brief Send a scan command
  *
@@ -1464,6 +1824,14 @@ sl_status_t sl_wfx_shutdown(void)
   sl_wfx_context->state &= ~SL_WFX_STARTED;
 
   error_handler:
+#ifdef SL_WFX_USE_TX_QUEUE
+  // Frames still waiting for an input buffer will never be sent, even if the
+  // shutdown failed
+  if (sl_wfx_host_lock() == SL_STATUS_OK) {
+    sl_wfx_tx_queue_discard();
+    sl_wfx_host_unlock();
+  }
+#endif //SL_WFX_USE_TX_QUEUE
   if (result == SL_STATUS_TIMEOUT) {
     if (sl_wfx_context->used_buffers > 0) {
       sl_wfx_context->used_buffers--;
@@ -1549,68 +1917,7 @@ sl_status_t sl_wfx_send_request(uint8_t command_id, sl_wfx_generic_message_t *re
   SL_WFX_ERROR_CHECK(result);
 
   if (sl_wfx_context->used_buffers < sl_wfx_input_buffer_number) {
-    // Write the buffer header
-    request->header.id     = command_id;
-    request->header.length = sl_wfx_htole16(request_length);
-
-#ifdef SL_WFX_USE_SECURE_LINK
-    if (sl_wfx_context->secure_link_renegotiation_state == SL_WFX_SECURELINK_RENEGOTIATION_PENDING
-        && command_id != SL_WFX_SECURELINK_EXCHANGE_PUB_KEYS_REQ_ID) {
-      result = SL_STATUS_FAIL;
-      goto error_handler;
-    }
-
-    if (sl_wfx_secure_link_encryption_required_get(command_id) == SL_WFX_SECURE_LINK_ENCRYPTION_REQUIRED) {
-      // Nonce for encryption should have RX and HP counters 0, only use TX counter
-      sl_wfx_nonce_t encryption_nonce = { 0, 0, sl_wfx_context->secure_link_nonce.tx_packet_count };
-
-#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_SLK)
-      sl_wfx_host_log("TX packet %lu\n", sl_wfx_context->secure_link_nonce.tx_packet_count);
-#endif
-
-      // Round up to next crypto block size the part that will be ciphered
-      request_length = ((request_length + 15 - 2) & ~15) + 2;
-
-      // Encrypt the data
-      result = sl_wfx_host_encode_secure_link_data(request,
-                                                   request_length - 2,
-                                                   sl_wfx_context->secure_link_session_key,
-                                                   (uint8_t *)&encryption_nonce);
-      SL_WFX_ERROR_CHECK(result);
-
-      // Write the secure link header
-      uint16_t *secure_link_header = (uint16_t *)((uint8_t *)request - 4);
-      *secure_link_header = sl_wfx_htole16((uint16_t) (sl_wfx_context->secure_link_nonce.tx_packet_count & 0xFFFF));
-      secure_link_header++;
-      *secure_link_header = sl_wfx_htole16((uint16_t) (0x4000 | ( (sl_wfx_context->secure_link_nonce.tx_packet_count >> 16) & 0x3FFF)));
-
-      sl_wfx_context->secure_link_nonce.tx_packet_count++;
-
-      if (sl_wfx_context->secure_link_nonce.tx_packet_count > SL_WFX_SECURE_LINK_NONCE_WATERMARK
-          && sl_wfx_context->secure_link_renegotiation_state == SL_WFX_SECURELINK_DEFAULT) {
-#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_SLK)
-        sl_wfx_host_log("--SLK renegotiation needed--\r\n");
-#endif
-        //queue key re-negotiation
-        sl_wfx_context->secure_link_renegotiation_state = SL_WFX_SECURELINK_RENEGOTIATION_NEEDED;
-      }
-
-      // Add the secure link buffer overhead and transmit
-      request_length += SL_WFX_SECURE_LINK_HEADER_SIZE + SL_WFX_SECURE_LINK_CCM_TAG_SIZE;
-      request = (sl_wfx_generic_message_t *)((uint8_t *)request - SL_WFX_SECURE_LINK_HEADER_SIZE);
-    }
-#endif //SL_WFX_USE_SECURE_LINK
-
-    if (command_id != SL_WFX_SEND_FRAME_REQ_ID
-        && command_id != SL_WFX_SHUT_DOWN_REQ_ID) {
-      result = sl_wfx_host_setup_waited_event(command_id);
-      SL_WFX_ERROR_CHECK(result);
-    }
-
-    result = sl_wfx_host_transmit_frame(request, request_length);
-    SL_WFX_ERROR_CHECK(result);
-
-    sl_wfx_context->used_buffers++;
+    result = sl_wfx_send_request_locked(command_id, request, request_length);
   }
 
   error_handler:
@@ -1637,109 +1944,72 @@ sl_status_t sl_wfx_send_request(uint8_t command_id, sl_wfx_generic_message_t *re
  *****************************************************************************/
 sl_status_t sl_wfx_receive_frame(uint16_t *ctrl_reg)
 {
-  sl_status_t               result;
-  sl_wfx_generic_message_t *network_rx_buffer = NULL;
-  sl_wfx_received_message_type_t message_type;
-  sl_wfx_buffer_type_t      buffer_type = SL_WFX_RX_FRAME_BUFFER;
-  uint32_t                  read_length, frame_size;
+  sl_status_t result;
 
   result = sl_wfx_host_lock();
   SL_WFX_ERROR_CHECK(result);
 
-  frame_size = (*ctrl_reg & SL_WFX_CONT_NEXT_LEN_MASK) * 2;
-  /* if frame_size is equal to 0, read the control register to know the frame size */
-  if (frame_size == 0) {
-    /* Read the control register */
-    result = sl_wfx_reg_read_16(SL_WFX_CONTROL_REG_ID, ctrl_reg);
-    SL_WFX_ERROR_CHECK(result);
-    frame_size = (*ctrl_reg & SL_WFX_CONT_NEXT_LEN_MASK) * 2;
-    /* At this point, if frame_size is equal to zero, nothing to be read by the host */
-    if (frame_size == 0) {
-      result = SL_STATUS_WIFI_NO_PACKET_TO_RECEIVE;
-      SL_WFX_ERROR_CHECK(result);
-    }
-  }
+  result = sl_wfx_receive_frame_locked(ctrl_reg);
 
-  /* retrieve the message type from the control register*/
-  message_type = (sl_wfx_received_message_type_t)((*ctrl_reg & SL_WFX_CONT_FRAME_TYPE_INFO) >> SL_WFX_CONT_FRAME_TYPE_OFFSET);
+  error_handler:
+#ifdef SL_WFX_USE_SECURE_LINK
+  if (sl_wfx_context->secure_link_renegotiation_state == SL_WFX_SECURELINK_RENEGOTIATION_NEEDED) {
+#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_SLK)
+    sl_wfx_host_log("--SLK renegotiation pending--\r\n");
+#endif
+    sl_wfx_context->secure_link_renegotiation_state = SL_WFX_SECURELINK_RENEGOTIATION_PENDING;
+    //notify host
+    sl_wfx_host_schedule_secure_link_renegotiation();
+  }
+#endif //SL_WFX_USE_SECURE_LINK
+  if (result == SL_STATUS_NO_MORE_RESOURCE || sl_wfx_host_unlock()) {
+    result = SL_STATUS_FAIL;
+  }
+#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_ERROR)
+  if (result != SL_STATUS_OK) {
+    sl_wfx_host_log("Receive frame error %u\n", result);
+  }
+#endif
+  return result;
+}
 
-  /* critical : '+SL_WFX_CONT_REGISTER_SIZE' is to read the piggy-back value at
-     the end of the control register. */
-  read_length = frame_size + SL_WFX_CONT_REGISTER_SIZE;
+/**************************************************************************//**
+ * @brief Receive all available frames from the Wi-Fi chip in one burst
+ *
+ * @param ctrl_reg is the control register value of the last call of
+ * sl_wfx_receive_frame() or sl_wfx_receive_frames(). If equal to 0, the driver
+ * will read the control register. On return, it holds the piggy-backed control
+ * register value of the last frame read.
+ * @param max_frames is the maximum number of frames to read. If equal to 0,
+ * frames are read until the Wi-Fi chip reports no more pending frame.
+ * @param frame_count is a pointer to the number of frames read, can be NULL
+ * @returns SL_STATUS_OK if at least one frame has been received correctly,
+ * SL_STATUS_WIFI_NO_PACKET_TO_RECEIVE if no frame are pending inside the Wi-Fi chip
+ * SL_STATUS_FAIL otherwise
+ *
+ * @note The driver lock is held for the whole burst. The frames are chained
+ * using the piggy-backed control register value, so the control register is
+ * read at most once. Each frame is passed to the host through
+ * sl_wfx_host_post_event() in reception order.
+ *****************************************************************************/
+sl_status_t sl_wfx_receive_frames(uint16_t *ctrl_reg, uint32_t max_frames, uint32_t *frame_count)
+{
+  sl_status_t result;
+  uint32_t    count = 0;
 
-  /* Depending on the message type provided by the control register, allocate a
-     control buffer or a ethernet RX frame */
-  buffer_type = (message_type == SL_WFX_ETHERNET_DATA_MESSAGE) ? SL_WFX_RX_FRAME_BUFFER : SL_WFX_CONTROL_BUFFER;
-
-  result = sl_wfx_host_allocate_buffer((void **)&network_rx_buffer,
-                                       buffer_type,
-                                       SL_WFX_ROUND_UP(read_length, SL_WFX_ROUND_UP_VALUE));
-  SL_WFX_ERROR_CHECK(result);
-
-  memset(network_rx_buffer, 0, read_length);
-
-  /* Read the frame from WF200 */
-  result = sl_wfx_data_read(network_rx_buffer, read_length);
+  result = sl_wfx_host_lock();
   SL_WFX_ERROR_CHECK(result);
 
-  /* if the frame is a confirmation, decrease used_buffers value */
-  if ((sl_wfx_context->used_buffers > 0)
-      && (!(network_rx_buffer->header.id & SL_WFX_IND_BASE))) {
-    sl_wfx_context->used_buffers--;
-  }
-
-  /* read the control register value in the piggy back and pass it to the host */
-  *ctrl_reg = sl_wfx_unpack_16bit_little_endian(((uint8_t *)network_rx_buffer) + frame_size);
-
-#ifdef SL_WFX_USE_SECURE_LINK
-  // Bit 14/15 of second word indicates if it is encrypted
-  if ((network_rx_buffer->header.info & SL_WFX_MSG_INFO_SECURE_LINK_MASK) != 0) {
-    uint16_t *nonce_ptr = (uint16_t *) network_rx_buffer;
-    uint32_t new_packet_count = sl_wfx_unpack_16bit_little_endian(&network_rx_buffer->header.length);
-    nonce_ptr++;
-    new_packet_count |= (*nonce_ptr & 0x3FFF) << 16;
-
-#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_SLK)
-    sl_wfx_host_log("RX packet %lu\n", new_packet_count);
-#endif
-
-    // Update secure link nonce values. Currently only RX counter is expected
-    switch ( (network_rx_buffer->header.info & SL_WFX_MSG_INFO_SECURE_LINK_MASK) >> SL_WFX_MSG_INFO_SECURE_LINK_OFFSET ) {
-      case 0x1: sl_wfx_context->secure_link_nonce.tx_packet_count = new_packet_count; break;
-      case 0x2: sl_wfx_context->secure_link_nonce.rx_packet_count = new_packet_count; break;
-      case 0x3: sl_wfx_context->secure_link_nonce.hp_packet_count = new_packet_count; break;
-      default: /* Potentially flag an error here and abort */ break;
-    }
-
-    // Encrypted data length is Total bytes read - secure link header -  2 extra bytes read of CTRL register - 2 more bytes for message length in clear
-    uint32_t decrypt_length = read_length - SL_WFX_SECURE_LINK_HEADER_SIZE - SL_WFX_SECURE_LINK_CCM_TAG_SIZE - SL_WFX_CONT_REGISTER_SIZE - 2;
-    result = sl_wfx_host_decode_secure_link_data((uint8_t*)network_rx_buffer + SL_WFX_SECURE_LINK_HEADER_SIZE + 2,
-                                                 decrypt_length,
-                                                 sl_wfx_context->secure_link_session_key);
+  do {
+    result = sl_wfx_receive_frame_locked(ctrl_reg);
     SL_WFX_ERROR_CHECK(result);
-
-    if ((sl_wfx_context->secure_link_nonce.rx_packet_count > SL_WFX_SECURE_LINK_NONCE_WATERMARK
-         || sl_wfx_context->secure_link_nonce.hp_packet_count > SL_WFX_SECURE_LINK_NONCE_WATERMARK)
-        && sl_wfx_context->secure_link_renegotiation_state == SL_WFX_SECURELINK_DEFAULT) {
-#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_SLK)
-      sl_wfx_host_log("--SLK renegotiation needed--\r\n");
-#endif
-      sl_wfx_context->secure_link_renegotiation_state = SL_WFX_SECURELINK_RENEGOTIATION_NEEDED;
-    }
-
-    /* Move the buffer pointer by SL_WFX_SECURE_LINK_HEADER_SIZE bytes to point to generic_message_t data */
-    network_rx_buffer = (sl_wfx_generic_message_t *)((uint8_t *)network_rx_buffer + SL_WFX_SECURE_LINK_HEADER_SIZE);
-  }
-#endif //SL_WFX_USE_SECURE_LINK
-
-  network_rx_buffer->header.length = sl_wfx_htole16(network_rx_buffer->header.length);
-
-  /* send the information to the host */
-  result = sl_wfx_host_post_event(network_rx_buffer);
+    count++;
+  } while ((max_frames == 0 || count < max_frames)
+           && (*ctrl_reg & SL_WFX_CONT_NEXT_LEN_MASK) != 0);
 
   error_handler:
-  if (network_rx_buffer != NULL) {
-    sl_wfx_free_command_buffer(network_rx_buffer, network_rx_buffer->header.id, buffer_type);
+  if (frame_count != NULL) {
+    *frame_count = count;
   }
 #ifdef SL_WFX_USE_SECURE_LINK
   if (sl_wfx_context->secure_link_renegotiation_state == SL_WFX_SECURELINK_RENEGOTIATION_NEEDED) {
@@ -1755,8 +2025,8 @@ sl_status_t sl_wfx_receive_frame(uint16_t *ctrl_reg)
     result = SL_STATUS_FAIL;
   }
 #if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_ERROR)
-  if (result != SL_STATUS_OK) {
-    sl_wfx_host_log("Receive frame error %u\n", result);
+  if (result != SL_STATUS_OK && result != SL_STATUS_WIFI_NO_PACKET_TO_RECEIVE) {
+    sl_wfx_host_log("Receive frames error %u\n", result);
   }
 #endif
   return result;
@@ -1974,13 +2244,13 @@ static sl_status_t sl_wfx_init_chip(void)
   SL_WFX_ERROR_CHECK(status);
 
   /* .. and wait for wake-up */
-  for (uint32_t i = 0; i < 200; ++i) {
+  for (uint32_t i = 0; i < 200 + SL_WFX_POLL_SPIN_COUNT; ++i) {
     status = sl_wfx_reg_read_16(SL_WFX_CONTROL_REG_ID, &value16);
     SL_WFX_ERROR_CHECK(status);
 
     if ((value16 & SL_WFX_CONT_RDY_BIT) == SL_WFX_CONT_RDY_BIT) {
       break;
-    } else {
+    } else if (i >= SL_WFX_POLL_SPIN_COUNT) {
       sl_wfx_host_wait(1);
     }
   }
@@ -2052,8 +2322,6 @@ static sl_status_t sl_wfx_download_run_firmware(void)
   uint32_t       i;
   uint32_t       value32;
   uint32_t       image_length;
-  uint32_t       block;
-  uint32_t       num_blocks;
   uint32_t       put = 0;
   uint32_t       get = 0;
   const uint8_t *buffer;
@@ -2131,40 +2399,58 @@ static sl_status_t sl_wfx_download_run_firmware(void)
   // skip signature and hash from image length
   image_length -= (FW_HASH_SIZE + FW_SIGNATURE_SIZE + FW_KEYSET_SIZE);
 
-  /* Calculate number of download blocks */
-  num_blocks = (image_length - 1) / DOWNLOAD_BLOCK_SIZE + 1;
+  /* check the download status in NCP */
+  status = sl_wfx_apb_read_32(ADDR_DWL_CTRL_AREA_NCP_STATUS, &value32);
+  SL_WFX_ERROR_CHECK(status);
 
-  /* Firmware downloading loop */
-  for ( block = 0; block < num_blocks; block++ ) {
-    /* check the download status in NCP */
-    status = sl_wfx_apb_read_32(ADDR_DWL_CTRL_AREA_NCP_STATUS, &value32);
+  if (value32 != NCP_STATE_DOWNLOAD_PENDING) {
+    status = SL_STATUS_FAIL;
     SL_WFX_ERROR_CHECK(status);
+  }
 
-    if (value32 != NCP_STATE_DOWNLOAD_PENDING) {
-      status = SL_STATUS_FAIL;
+  /* Firmware downloading loop. The download FIFO is filled completely before
+     the NCP side is read again, the status being checked once per refill */
+  while (put < image_length) {
+    if ((put - get) > (DOWNLOAD_FIFO_SIZE - DOWNLOAD_BLOCK_SIZE)) {
+      /* check the download status in NCP */
+      status = sl_wfx_apb_read_32(ADDR_DWL_CTRL_AREA_NCP_STATUS, &value32);
       SL_WFX_ERROR_CHECK(status);
-    }
 
-    /* loop until put - get <= 24K */
-    for ( i = 0; i < 100; i++ ) {
-      get = 0;
-      status = sl_wfx_apb_read_32(ADDR_DWL_CTRL_AREA_GET, &get);
-      SL_WFX_ERROR_CHECK(status);
+      if (value32 != NCP_STATE_DOWNLOAD_PENDING) {
+        status = SL_STATUS_FAIL;
+        SL_WFX_ERROR_CHECK(status);
+      }
 
-      if ((put - get) <= (DOWNLOAD_FIFO_SIZE - DOWNLOAD_BLOCK_SIZE)) {
-        break;
+      /* loop until put - get <= 31K */
+      for ( i = 0; i < 100; i++ ) {
+        get = 0;
+        status = sl_wfx_apb_read_32(ADDR_DWL_CTRL_AREA_GET, &get);
+        SL_WFX_ERROR_CHECK(status);
+
+        if ((put - get) <= (DOWNLOAD_FIFO_SIZE - DOWNLOAD_BLOCK_SIZE)) {
+          break;
+        }
       }
-    }
 
-    if ((put - get) > (DOWNLOAD_FIFO_SIZE - DOWNLOAD_BLOCK_SIZE)) {
-      status = SL_STATUS_WIFI_FIRMWARE_DOWNLOAD_TIMEOUT;
-      SL_WFX_ERROR_CHECK(status);
+      if ((put - get) > (DOWNLOAD_FIFO_SIZE - DOWNLOAD_BLOCK_SIZE)) {
+        status = SL_STATUS_WIFI_FIRMWARE_DOWNLOAD_TIMEOUT;
+        SL_WFX_ERROR_CHECK(status);
+      }
     }
 
-    /* calculate the block size */
+    /* calculate the block size: whole blocks fitting in the free part of the
+       FIFO, without wrapping around its end */
     uint32_t block_size = image_length - put;
-    if (block_size > DOWNLOAD_BLOCK_SIZE) {
-      block_size = DOWNLOAD_BLOCK_SIZE;
+    uint32_t free_size  = DOWNLOAD_FIFO_SIZE - (put - get);
+    free_size -= free_size % DOWNLOAD_BLOCK_SIZE;
+    if (free_size > DOWNLOAD_FIFO_SIZE - (put % DOWNLOAD_FIFO_SIZE)) {
+      free_size = DOWNLOAD_FIFO_SIZE - (put % DOWNLOAD_FIFO_SIZE);
+    }
+    if (free_size > SL_WFX_FW_DOWNLOAD_CHUNK_SIZE) {
+      free_size = SL_WFX_FW_DOWNLOAD_CHUNK_SIZE;
+    }
+    if (block_size > free_size) {
+      block_size = free_size;
     }
 
     /* send the block to SRAM */
@@ -2203,6 +2489,458 @@ static sl_status_t sl_wfx_download_run_firmware(void)
   return status;
 }
 
+/**************************************************************************//**
+ * @brief Read one frame from the Wi-Fi chip and pass it to the host
+ *
+ * @param ctrl_reg is the control register value of the previous frame. If its
+ * length field is 0, the driver will read the control register.
+ * @return SL_STATUS_OK if the frame has been received correctly,
+ * SL_STATUS_WIFI_NO_PACKET_TO_RECEIVE if no frame are pending inside the Wi-Fi chip
+ * SL_STATUS_FAIL otherwise
+ *
+ * @note The caller must hold the driver lock
+ *****************************************************************************/
+static sl_status_t sl_wfx_receive_frame_locked(uint16_t *ctrl_reg)
+{
+  sl_status_t               result;
+  sl_wfx_generic_message_t *network_rx_buffer = NULL;
+  sl_wfx_received_message_type_t message_type;
+  sl_wfx_buffer_type_t      buffer_type = SL_WFX_RX_FRAME_BUFFER;
+  uint32_t                  read_length, frame_size;
+
+  frame_size = (*ctrl_reg & SL_WFX_CONT_NEXT_LEN_MASK) * 2;
+  /* if frame_size is equal to 0, read the control register to know the frame size */
+  if (frame_size == 0) {
+    /* Read the control register */
+    result = sl_wfx_reg_read_16(SL_WFX_CONTROL_REG_ID, ctrl_reg);
+    SL_WFX_ERROR_CHECK(result);
+    frame_size = (*ctrl_reg & SL_WFX_CONT_NEXT_LEN_MASK) * 2;
+    /* At this point, if frame_size is equal to zero, nothing to be read by the host */
+    if (frame_size == 0) {
+      result = SL_STATUS_WIFI_NO_PACKET_TO_RECEIVE;
+      SL_WFX_ERROR_CHECK(result);
+    }
+  }
+
+  /* retrieve the message type from the control register*/
+  message_type = (sl_wfx_received_message_type_t)((*ctrl_reg & SL_WFX_CONT_FRAME_TYPE_INFO) >> SL_WFX_CONT_FRAME_TYPE_OFFSET);
+
+  /* critical : '+SL_WFX_CONT_REGISTER_SIZE' is to read the piggy-back value at
+     the end of the control register. */
+  read_length = frame_size + SL_WFX_CONT_REGISTER_SIZE;
+
+  /* Depending on the message type provided by the control register, allocate a
+     control buffer or a ethernet RX frame */
+  buffer_type = (message_type == SL_WFX_ETHERNET_DATA_MESSAGE) ? SL_WFX_RX_FRAME_BUFFER : SL_WFX_CONTROL_BUFFER;
+
+  result = sl_wfx_host_allocate_buffer((void **)&network_rx_buffer,
+                                       buffer_type,
+                                       SL_WFX_ROUND_UP(read_length, SL_WFX_ROUND_UP_VALUE));
+  SL_WFX_ERROR_CHECK(result);
+
+  /* Read the frame from WF200. The read fills the whole buffer, so there is
+     no need to clear it beforehand. */
+  result = sl_wfx_data_read(network_rx_buffer, read_length);
+  SL_WFX_ERROR_CHECK(result);
+
+  /* if the frame is a confirmation, decrease used_buffers value */
+  if ((sl_wfx_context->used_buffers > 0)
+      && (!(network_rx_buffer->header.id & SL_WFX_IND_BASE))) {
+    sl_wfx_context->used_buffers--;
+  }
+
+  /* read the control register value in the piggy back and pass it to the host */
+  *ctrl_reg = sl_wfx_unpack_16bit_little_endian(((uint8_t *)network_rx_buffer) + frame_size);
+
+#ifdef SL_WFX_USE_SECURE_LINK
+  // Bit 14/15 of second word indicates if it is encrypted
+  if ((network_rx_buffer->header.info & SL_WFX_MSG_INFO_SECURE_LINK_MASK) != 0) {
+    uint16_t *nonce_ptr = (uint16_t *) network_rx_buffer;
+    uint32_t new_packet_count = sl_wfx_unpack_16bit_little_endian(&network_rx_buffer->header.length);
+    nonce_ptr++;
+    new_packet_count |= (*nonce_ptr & 0x3FFF) << 16;
+
+#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_SLK)
+    sl_wfx_host_log("RX packet %lu\n", new_packet_count);
+#endif
+
+    // Update secure link nonce values. Currently only RX counter is expected
+    switch ( (network_rx_buffer->header.info & SL_WFX_MSG_INFO_SECURE_LINK_MASK) >> SL_WFX_MSG_INFO_SECURE_LINK_OFFSET ) {
+      case 0x1: sl_wfx_context->secure_link_nonce.tx_packet_count = new_packet_count; break;
+      case 0x2: sl_wfx_context->secure_link_nonce.rx_packet_count = new_packet_count; break;
+      case 0x3: sl_wfx_context->secure_link_nonce.hp_packet_count = new_packet_count; break;
+      default: /* Potentially flag an error here and abort */ break;
+    }
+
+    // Encrypted data length is Total bytes read - secure link header -  2 extra bytes read of CTRL register - 2 more bytes for message length in clear
+    uint32_t decrypt_length = read_length - SL_WFX_SECURE_LINK_HEADER_SIZE - SL_WFX_SECURE_LINK_CCM_TAG_SIZE - SL_WFX_CONT_REGISTER_SIZE - 2;
+#ifdef SL_WFX_USE_STATISTICS
+    uint32_t decrypt_start = sl_wfx_host_get_time_us();
+#endif
+    result = sl_wfx_host_decode_secure_link_data((uint8_t*)network_rx_buffer + SL_WFX_SECURE_LINK_HEADER_SIZE + 2,
+                                                 decrypt_length,
+                                                 sl_wfx_context->secure_link_session_key);
+    SL_WFX_ERROR_CHECK(result);
+#ifdef SL_WFX_USE_STATISTICS
+    sl_wfx_stats_add_crypto(&sl_wfx_context->statistics.decryption, decrypt_length, decrypt_start);
+#endif
+
+    if ((sl_wfx_context->secure_link_nonce.rx_packet_count > SL_WFX_SECURE_LINK_NONCE_WATERMARK
+         || sl_wfx_context->secure_link_nonce.hp_packet_count > SL_WFX_SECURE_LINK_NONCE_WATERMARK)
+        && sl_wfx_context->secure_link_renegotiation_state == SL_WFX_SECURELINK_DEFAULT) {
+#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_SLK)
+      sl_wfx_host_log("--SLK renegotiation needed--\r\n");
+#endif
+      sl_wfx_context->secure_link_renegotiation_state = SL_WFX_SECURELINK_RENEGOTIATION_NEEDED;
+    }
+
+    /* Move the buffer pointer by SL_WFX_SECURE_LINK_HEADER_SIZE bytes to point to generic_message_t data */
+    network_rx_buffer = (sl_wfx_generic_message_t *)((uint8_t *)network_rx_buffer + SL_WFX_SECURE_LINK_HEADER_SIZE);
+  }
+#endif //SL_WFX_USE_SECURE_LINK
+
+  network_rx_buffer->header.length = sl_wfx_htole16(network_rx_buffer->header.length);
+
+#ifdef SL_WFX_USE_STATISTICS
+  if (network_rx_buffer->header.id == SL_WFX_RECEIVED_IND_ID) {
+    sl_wfx_stats_add_frame(&sl_wfx_context->statistics.rx_frames,
+                           sl_wfx_htole16(((sl_wfx_received_ind_t *)network_rx_buffer)->body.frame_length));
+  } else if (!(network_rx_buffer->header.id & SL_WFX_IND_BASE)) {
+    sl_wfx_stats_add_confirmation(network_rx_buffer->header.id);
+  }
+#endif //SL_WFX_USE_STATISTICS
+
+  /* send the information to the host */
+  result = sl_wfx_host_post_event(network_rx_buffer);
+
+#ifdef SL_WFX_USE_TX_QUEUE
+  /* Confirmations release input buffers, send the frames waiting for them */
+  sl_wfx_tx_queue_flush();
+#endif //SL_WFX_USE_TX_QUEUE
+
+  error_handler:
+  if (network_rx_buffer != NULL) {
+    sl_wfx_free_command_buffer(network_rx_buffer, network_rx_buffer->header.id, buffer_type);
+  }
+  return result;
+}
+
+/**************************************************************************//**
+ * @brief Write a request to the Wi-Fi chip and account for the input buffer
+ * it uses
+ *
+ * @param command_id is the ID of the command to be sent (cf. sl_wfx_cmd_api.h)
+ * @param request is the pointer to the request to be sent
+ * @param request_length is the size of the request to be sent
+ * @return SL_STATUS_OK if the request is sent correctly, SL_STATUS_FAIL otherwise
+ *
+ * @note The caller must hold the driver lock and check that an input buffer
+ * is available
+ *****************************************************************************/
+static sl_status_t sl_wfx_send_request_locked(uint8_t command_id,
+                                              sl_wfx_generic_message_t *request,
+                                              uint16_t request_length)
+{
+  sl_status_t result;
+#ifdef SL_WFX_USE_STATISTICS
+  /* Read the frame length before the request is encrypted */
+  uint32_t    frame_length = 0;
+
+  if (command_id == SL_WFX_SEND_FRAME_REQ_ID) {
+    frame_length = sl_wfx_htole32(((sl_wfx_send_frame_req_t *)request)->body.packet_data_length);
+  }
+#endif //SL_WFX_USE_STATISTICS
+
+  // Write the buffer header
+  request->header.id     = command_id;
+  request->header.length = sl_wfx_htole16(request_length);
+
+#ifdef SL_WFX_USE_SECURE_LINK
+  if (sl_wfx_context->secure_link_renegotiation_state == SL_WFX_SECURELINK_RENEGOTIATION_PENDING
+      && command_id != SL_WFX_SECURELINK_EXCHANGE_PUB_KEYS_REQ_ID) {
+    result = SL_STATUS_FAIL;
+    goto error_handler;
+  }
+
+  if (sl_wfx_secure_link_encryption_required_get(command_id) == SL_WFX_SECURE_LINK_ENCRYPTION_REQUIRED) {
+    // Nonce for encryption should have RX and HP counters 0, only use TX counter
+    sl_wfx_nonce_t encryption_nonce = { 0, 0, sl_wfx_context->secure_link_nonce.tx_packet_count };
+
+#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_SLK)
+    sl_wfx_host_log("TX packet %lu\n", sl_wfx_context->secure_link_nonce.tx_packet_count);
+#endif
+
+    // Round up to next crypto block size the part that will be ciphered
+    request_length = ((request_length + 15 - 2) & ~15) + 2;
+
+    // Encrypt the data
+#ifdef SL_WFX_USE_STATISTICS
+    uint32_t encrypt_start = sl_wfx_host_get_time_us();
+#endif
+    result = sl_wfx_host_encode_secure_link_data(request,
+                                                 request_length - 2,
+                                                 sl_wfx_context->secure_link_session_key,
+                                                 (uint8_t *)&encryption_nonce);
+    SL_WFX_ERROR_CHECK(result);
+#ifdef SL_WFX_USE_STATISTICS
+    sl_wfx_stats_add_crypto(&sl_wfx_context->statistics.encryption, request_length - 2, encrypt_start);
+#endif
+
+    // Write the secure link header
+    uint16_t *secure_link_header = (uint16_t *)((uint8_t *)request - 4);
+    *secure_link_header = sl_wfx_htole16((uint16_t) (sl_wfx_context->secure_link_nonce.tx_packet_count & 0xFFFF));
+    secure_link_header++;
+    *secure_link_header = sl_wfx_htole16((uint16_t) (0x4000 | ( (sl_wfx_context->secure_link_nonce.tx_packet_count >> 16) & 0x3FFF)));
+
+    sl_wfx_context->secure_link_nonce.tx_packet_count++;
+
+    if (sl_wfx_context->secure_link_nonce.tx_packet_count > SL_WFX_SECURE_LINK_NONCE_WATERMARK
+        && sl_wfx_context->secure_link_renegotiation_state == SL_WFX_SECURELINK_DEFAULT) {
+#if (SL_WFX_DEBUG_MASK & SL_WFX_DEBUG_SLK)
+      sl_wfx_host_log("--SLK renegotiation needed--\r\n");
+#endif
+      //queue key re-negotiation
+      sl_wfx_context->secure_link_renegotiation_state = SL_WFX_SECURELINK_RENEGOTIATION_NEEDED;
+    }
+
+    // Add the secure link buffer overhead and transmit
+    request_length += SL_WFX_SECURE_LINK_HEADER_SIZE + SL_WFX_SECURE_LINK_CCM_TAG_SIZE;
+    request = (sl_wfx_generic_message_t *)((uint8_t *)request - SL_WFX_SECURE_LINK_HEADER_SIZE);
+  }
+#endif //SL_WFX_USE_SECURE_LINK
+
+  if (command_id != SL_WFX_SEND_FRAME_REQ_ID
+      && command_id != SL_WFX_SHUT_DOWN_REQ_ID) {
+    result = sl_wfx_host_setup_waited_event(command_id);
+    SL_WFX_ERROR_CHECK(result);
+#ifdef SL_WFX_USE_STATISTICS
+    sl_wfx_context->stats_waited_command_id    = command_id;
+    sl_wfx_context->stats_waited_command_start = sl_wfx_host_get_time_us();
+#endif
+  }
+
+  result = sl_wfx_host_transmit_frame(request, request_length);
+  SL_WFX_ERROR_CHECK(result);
+
+  sl_wfx_context->used_buffers++;
+
+#ifdef SL_WFX_USE_STATISTICS
+  if (command_id == SL_WFX_SEND_FRAME_REQ_ID) {
+    sl_wfx_stats_add_frame(&sl_wfx_context->statistics.tx_frames, frame_length);
+  }
+#endif
+
+  error_handler:
+  return result;
+}
+
+/**************************************************************************//**
+ * @brief Fill the header of an Ethernet frame request
+ *
+ * @param frame is the frame to be sent
+ * @param data_length is the length of the Ethernet frame
+ * @param interface is the interface used to send the ethernet frame
+ * @param priority is the priority level used to send the Ethernet frame
+ *****************************************************************************/
+static void sl_wfx_set_ethernet_frame_header(sl_wfx_send_frame_req_t *frame,
+                                             uint32_t data_length,
+                                             sl_wfx_interface_t interface,
+                                             uint8_t priority)
+{
+  sl_wfx_context->data_frame_id++;
+
+  frame->header.length           = sl_wfx_htole16(data_length + sizeof(sl_wfx_send_frame_req_t));
+  frame->header.id               = SL_WFX_SEND_FRAME_REQ_ID;
+  frame->header.info             = (interface << SL_WFX_MSG_INFO_INTERFACE_OFFSET) & SL_WFX_MSG_INFO_INTERFACE_MASK;
+  frame->body.frame_type         = WFM_FRAME_TYPE_DATA;
+  frame->body.priority           = priority;
+  frame->body.packet_id          = sl_wfx_htole16(sl_wfx_context->data_frame_id);
+  frame->body.packet_data_length = sl_wfx_htole32(data_length);
+}
+
+#ifdef SL_WFX_USE_TX_QUEUE
+/**************************************************************************//**
+ * @brief Check if a queued frame may use an input buffer of the Wi-Fi chip
+ *
+ * @return true if an input buffer is available for data frames
+ *****************************************************************************/
+static bool sl_wfx_tx_queue_credit_available(void)
+{
+  uint16_t data_credits = 1;
+
+  if (sl_wfx_input_buffer_number > SL_WFX_TX_QUEUE_CONTROL_CREDITS) {
+    data_credits = sl_wfx_input_buffer_number - SL_WFX_TX_QUEUE_CONTROL_CREDITS;
+  }
+
+  return sl_wfx_context->used_buffers < data_credits;
+}
+
+/**************************************************************************//**
+ * @brief Send the queued frames while input buffers are available, highest
+ * priority class first
+ *
+ * @note The caller must hold the driver lock
+ *****************************************************************************/
+static void sl_wfx_tx_queue_flush(void)
+{
+  sl_wfx_tx_queue_t       *queue = &sl_wfx_context->tx_queue;
+  sl_wfx_tx_queue_stats_t *stats = &sl_wfx_context->tx_queue_stats;
+  sl_wfx_tx_queue_entry_t *entry;
+  uint32_t                 wait_time;
+  uint8_t                  queue_class = SL_WFX_TX_QUEUE_CLASS_COUNT;
+
+  while (stats->depth > 0 && sl_wfx_tx_queue_credit_available()) {
+    do {
+      queue_class--;
+    } while (queue->count[queue_class] == 0);
+
+    entry = &queue->entries[queue_class][queue->head[queue_class]];
+    queue->head[queue_class] = (queue->head[queue_class] + 1) % SL_WFX_TX_QUEUE_LENGTH;
+    queue->count[queue_class]--;
+    stats->depth--;
+
+    wait_time = sl_wfx_host_get_time_us() - entry->enqueue_time;
+    stats->total_wait_time += wait_time;
+    if (wait_time > stats->max_wait_time) {
+      stats->max_wait_time = wait_time;
+    }
+
+    if (sl_wfx_send_request_locked(SL_WFX_SEND_FRAME_REQ_ID,
+                                   (sl_wfx_generic_message_t *)entry->frame,
+                                   entry->request_length) == SL_STATUS_OK) {
+      stats->sent_frames++;
+    } else {
+      stats->dropped_frames++;
+    }
+    sl_wfx_free_command_buffer((sl_wfx_generic_message_t *)entry->frame, SL_WFX_SEND_FRAME_REQ_ID, SL_WFX_TX_FRAME_BUFFER);
+
+    /* Restart from the highest class, the queue is only scanned downwards */
+    queue_class = SL_WFX_TX_QUEUE_CLASS_COUNT;
+  }
+}
+
+/**************************************************************************//**
+ * @brief Free all the queued frames
+ *
+ * @note The caller must hold the driver lock
+ *****************************************************************************/
+static void sl_wfx_tx_queue_discard(void)
+{
+  sl_wfx_tx_queue_t       *queue = &sl_wfx_context->tx_queue;
+  sl_wfx_tx_queue_stats_t *stats = &sl_wfx_context->tx_queue_stats;
+  sl_wfx_tx_queue_entry_t *entry;
+
+  for (uint8_t queue_class = 0; queue_class < SL_WFX_TX_QUEUE_CLASS_COUNT; queue_class++) {
+    while (queue->count[queue_class] > 0) {
+      entry = &queue->entries[queue_class][queue->head[queue_class]];
+      queue->head[queue_class] = (queue->head[queue_class] + 1) % SL_WFX_TX_QUEUE_LENGTH;
+      queue->count[queue_class]--;
+      sl_wfx_free_command_buffer((sl_wfx_generic_message_t *)entry->frame, SL_WFX_SEND_FRAME_REQ_ID, SL_WFX_TX_FRAME_BUFFER);
+      stats->dropped_frames++;
+    }
+  }
+  stats->depth = 0;
+}
+#endif //SL_WFX_USE_TX_QUEUE
+
+#ifdef SL_WFX_USE_STATISTICS
+/**************************************************************************//**
+ * @brief Find the histogram bin of a value
+ *
+ * @param value is the value to be recorded
+ * @param base is the upper bound of the first bin, each bin is twice as wide
+ * as the previous one
+ * @param bin_count is the number of bins, the last one has no upper bound
+ * @return the index of the bin
+ *****************************************************************************/
+static uint8_t sl_wfx_stats_bin(uint32_t value, uint32_t base, uint8_t bin_count)
+{
+  uint8_t bin = 0;
+
+  while (bin < bin_count - 1 && value >= base) {
+    base <<= 1;
+    bin++;
+  }
+
+  return bin;
+}
+
+/**************************************************************************//**
+ * @brief Record an Ethernet frame
+ *
+ * @param stats is the frame statistics to be updated
+ * @param length is the length of the Ethernet frame
+ *****************************************************************************/
+static void sl_wfx_stats_add_frame(sl_wfx_frame_stats_t *stats, uint32_t length)
+{
+  stats->count++;
+  stats->bytes += length;
+  stats->histogram[sl_wfx_stats_bin(length, SL_WFX_STATS_FRAME_SIZE_BIN_BASE, SL_WFX_STATS_FRAME_SIZE_BIN_COUNT)]++;
+}
+
+/**************************************************************************//**
+ * @brief Record the latency of a confirmation
+ *
+ * @param command_id is the ID of the confirmation received
+ *
+ * @note Only the confirmation of the command awaited through
+ * sl_wfx_host_setup_waited_event() is recorded
+ *****************************************************************************/
+static void sl_wfx_stats_add_confirmation(uint8_t command_id)
+{
+  sl_wfx_command_stats_t *stats = NULL;
+  uint32_t                latency;
+
+  if (command_id != sl_wfx_context->stats_waited_command_id) {
+    return;
+  }
+  latency = sl_wfx_host_get_time_us() - sl_wfx_context->stats_waited_command_start;
+  sl_wfx_context->stats_waited_command_id = 0;
+
+  for (uint8_t i = 0; i < SL_WFX_STATS_COMMAND_SLOTS; i++) {
+    if (sl_wfx_context->statistics.commands[i].command_id == command_id
+        || sl_wfx_context->statistics.commands[i].command_id == 0) {
+      stats = &sl_wfx_context->statistics.commands[i];
+      break;
+    }
+  }
+
+  if (stats == NULL) {
+    sl_wfx_context->statistics.untracked_commands++;
+    return;
+  }
+
+  stats->command_id = command_id;
+  stats->count++;
+  stats->total_latency += latency;
+  if (latency > stats->max_latency) {
+    stats->max_latency = latency;
+  }
+  stats->histogram[sl_wfx_stats_bin(latency, SL_WFX_STATS_LATENCY_BIN_BASE_US, SL_WFX_STATS_LATENCY_BIN_COUNT)]++;
+}
+
+#ifdef SL_WFX_USE_SECURE_LINK
+/**************************************************************************//**
+ * @brief Record a secure link encryption or decryption
+ *
+ * @param stats is the crypto statistics to be updated
+ * @param length is the number of bytes processed
+ * @param start is the time at which the processing started
+ *****************************************************************************/
+static void sl_wfx_stats_add_crypto(sl_wfx_crypto_stats_t *stats, uint32_t length, uint32_t start)
+{
+  uint32_t duration = sl_wfx_host_get_time_us() - start;
+
+  stats->count++;
+  stats->bytes += length;
+  stats->total_time += duration;
+  if (duration > stats->max_time) {
+    stats->max_time = duration;
+  }
+}
+#endif //SL_WFX_USE_SECURE_LINK
+#endif //SL_WFX_USE_STATISTICS
+
 /**************************************************************************//**
  * @brief Poll a value from the Wi-Fi chip
  *
@@ -2219,12 +2957,13 @@ static sl_status_t sl_wfx_poll_for_value(uint32_t address, uint32_t polled_value
   uint32_t    value;
   sl_status_t status = SL_STATUS_OK;
 
-  for (; max_retries > 0; max_retries--) {
+  /* The first polls are done back to back, then 1 ms apart */
+  for (uint32_t i = 0; i < max_retries + SL_WFX_POLL_SPIN_COUNT; i++) {
     status = sl_wfx_apb_read_32(address, &value);
     SL_WFX_ERROR_CHECK(status);
     if (value == polled_value) {
       break;
-    } else {
+    } else if (i >= SL_WFX_POLL_SPIN_COUNT) {
       sl_wfx_host_wait(1);
     }
   }
@@ -2499,4 +3238,20 @@ sl_status_t sl_wfx_free_command_buffer(sl_wfx_generic_message_t *buffer, uint32_
   }
 }
 
+/**************************************************************************//**
+ * @brief Default transmission of a scattered frame, writes the segments
+ * directly on the bus
+ *
+ * @param segments is the list of segments forming the frame
+ * @param segment_count is the number of segments in the list
+ * @param frame_len is size of the frame, padding included
+ * @return SL_STATUS_OK if the frame is written correctly, SL_STATUS_FAIL otherwise
+ *****************************************************************************/
+WEAK sl_status_t sl_wfx_host_transmit_frame_segments(const sl_wfx_data_segment_t *segments,
+                                                     uint8_t segment_count,
+                                                     uint32_t frame_len)
+{
+  return sl_wfx_data_write_segments(segments, segment_count, frame_len);
+}
+
 /** @} end DRIVER_API */
@@ -44,6 +44,8 @@ sl_status_t sl_wfx_shutdown(void);
 
 sl_status_t sl_wfx_receive_frame(uint16_t *ctrl_reg);
 
+sl_status_t sl_wfx_receive_frames(uint16_t *ctrl_reg, uint32_t max_frames, uint32_t *frame_count);
+
 sl_status_t sl_wfx_send_configuration(const char *pds_data, uint32_t pds_data_length);
 
 sl_status_t sl_wfx_control_gpio(uint8_t gpio_label, uint8_t gpio_mode, uint32_t *value);
@@ -86,6 +88,29 @@ sl_status_t sl_wfx_send_ethernet_frame(sl_wfx_send_frame_req_t *frame,
                                        sl_wfx_interface_t interface,
                                        uint8_t priority);
 
+sl_status_t sl_wfx_send_ethernet_frame_segments(sl_wfx_send_frame_req_t *frame,
+                                                const sl_wfx_data_segment_t *segments,
+                                                uint8_t segment_count,
+                                                sl_wfx_interface_t interface,
+                                                uint8_t priority);
+
+#ifdef SL_WFX_USE_TX_QUEUE
+sl_status_t sl_wfx_send_ethernet_frame_queued(sl_wfx_send_frame_req_t *frame,
+                                              uint32_t data_length,
+                                              sl_wfx_interface_t interface,
+                                              uint8_t priority);
+
+sl_status_t sl_wfx_get_tx_queue_stats(sl_wfx_tx_queue_stats_t *stats);
+
+sl_status_t sl_wfx_reset_tx_queue_stats(void);
+#endif //SL_WFX_USE_TX_QUEUE
+
+#ifdef SL_WFX_USE_STATISTICS
+sl_status_t sl_wfx_get_statistics(sl_wfx_statistics_t *stats);
+
+sl_status_t sl_wfx_reset_statistics(void);
+#endif //SL_WFX_USE_STATISTICS
+
 /*
  * Send generic WF200 command
  */
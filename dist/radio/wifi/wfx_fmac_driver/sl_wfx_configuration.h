@@ -27,4 +27,16 @@
 #define SL_WFX_DEFAULT_REQUEST_TIMEOUT_MS 5000  // Timeout period in milliseconds
 #endif
 
+#ifndef SL_WFX_POLL_SPIN_COUNT
+#define SL_WFX_POLL_SPIN_COUNT 8  // Number of register polls done back to back before waiting 1 ms between polls
+#endif
+
+#ifndef SL_WFX_FW_DOWNLOAD_CHUNK_SIZE
+#define SL_WFX_FW_DOWNLOAD_CHUNK_SIZE (DOWNLOAD_BLOCK_SIZE)  // Size of the firmware chunks requested to the host, multiple of DOWNLOAD_BLOCK_SIZE up to 7 KB
+#endif
+
+#ifndef SL_WFX_DATA_SEGMENT_MAX
+#define SL_WFX_DATA_SEGMENT_MAX 8  // Maximum number of segments in a scattered frame, header included
+#endif
+
 #endif // SL_WFX_CONFIGURATION_H
@@ -216,6 +216,44 @@ static inline uint32_t uint32_identity(uint32_t x)
 #define SL_WFX_SECURE_LINK_NONCE_WATERMARK             1 << 29
 #endif //SL_WFX_USE_SECURE_LINK
 
+#ifdef SL_WFX_USE_TX_QUEUE
+/* TX queue constants */
+#ifndef SL_WFX_TX_QUEUE_LENGTH
+#define SL_WFX_TX_QUEUE_LENGTH                         (8)  // Number of frames queued per priority class
+#endif
+
+#ifndef SL_WFX_TX_QUEUE_CONTROL_CREDITS
+#define SL_WFX_TX_QUEUE_CONTROL_CREDITS                (1)  // Input buffers never used by queued frames
+#endif
+
+#define SL_WFX_TX_QUEUE_CLASS_COUNT                    (4)  // Background, best effort, video, voice
+#endif //SL_WFX_USE_TX_QUEUE
+
+#ifdef SL_WFX_USE_STATISTICS
+/* Statistics constants */
+#ifndef SL_WFX_STATS_COMMAND_SLOTS
+#define SL_WFX_STATS_COMMAND_SLOTS                     (16)  // Number of command IDs tracked
+#endif
+
+#ifndef SL_WFX_STATS_LATENCY_BIN_COUNT
+#define SL_WFX_STATS_LATENCY_BIN_COUNT                 (8)  // Latency histogram bins, each twice as wide as the previous one
+#endif
+
+#ifndef SL_WFX_STATS_LATENCY_BIN_BASE_US
+#define SL_WFX_STATS_LATENCY_BIN_BASE_US               (250)  // Upper bound of the first latency bin, in microseconds
+#endif
+
+#ifndef SL_WFX_STATS_FRAME_SIZE_BIN_COUNT
+#define SL_WFX_STATS_FRAME_SIZE_BIN_COUNT              (6)  // Frame size histogram bins, each twice as wide as the previous one
+#endif
+
+#ifndef SL_WFX_STATS_FRAME_SIZE_BIN_BASE
+#define SL_WFX_STATS_FRAME_SIZE_BIN_BASE               (128)  // Upper bound of the first frame size bin, in bytes
+#endif
+
+#define SL_WFX_STATS_REGISTER_COUNT                    (8)  // Number of sl_wfx_register_address_t values
+#endif //SL_WFX_USE_STATISTICS
+
 /**************************************************************************//**
  * @addtogroup ENUM
  * @{
@@ -351,6 +389,141 @@ typedef struct {
   uint32_t tx_packet_count; ///< Sent packet counter
 } sl_wfx_nonce_t;
 
+/**************************************************************************//**
+ * @struct sl_wfx_data_segment_t
+ * @brief Structure describing one segment of a scattered frame
+ *****************************************************************************/
+typedef struct {
+  const uint8_t *data;   ///< Pointer to the segment data
+  uint32_t       length; ///< Length of the segment in bytes
+} sl_wfx_data_segment_t;
+
+#ifdef SL_WFX_USE_BOOT_TIMING
+/**************************************************************************//**
+ * @struct sl_wfx_boot_timing_t
+ * @brief Structure reporting the duration of the sl_wfx_init() phases, in
+ * microseconds
+ *****************************************************************************/
+typedef struct {
+  uint32_t bus_init;          ///< Bus initialization and chip reset
+  uint32_t chip_init;         ///< Chip register setup and wake-up
+  uint32_t bootloader;        ///< Bootloader start and SRAM check
+  uint32_t firmware_download; ///< Firmware download and authentication
+  uint32_t startup;           ///< Wait for the startup indication
+  uint32_t configuration;     ///< Secure link setup and PDS download
+  uint32_t total;             ///< Whole sl_wfx_init() duration
+} sl_wfx_boot_timing_t;
+#endif //SL_WFX_USE_BOOT_TIMING
+
+#ifdef SL_WFX_USE_TX_QUEUE
+/**************************************************************************//**
+ * @struct sl_wfx_tx_queue_entry_t
+ * @brief Structure describing a frame waiting for a WFx input buffer
+ *****************************************************************************/
+typedef struct {
+  sl_wfx_send_frame_req_t *frame;          ///< Frame to be sent, owned by the driver
+  uint32_t                 enqueue_time;   ///< Time at which the frame was queued, in microseconds
+  uint16_t                 request_length; ///< Length of the request to be sent
+} sl_wfx_tx_queue_entry_t;
+
+/**************************************************************************//**
+ * @struct sl_wfx_tx_queue_t
+ * @brief Structure holding the frames waiting for a WFx input buffer, one
+ * FIFO per priority class
+ *****************************************************************************/
+typedef struct {
+  sl_wfx_tx_queue_entry_t entries[SL_WFX_TX_QUEUE_CLASS_COUNT][SL_WFX_TX_QUEUE_LENGTH];
+  uint8_t                 head[SL_WFX_TX_QUEUE_CLASS_COUNT];  ///< Index of the oldest frame per class
+  uint8_t                 count[SL_WFX_TX_QUEUE_CLASS_COUNT]; ///< Number of frames per class
+} sl_wfx_tx_queue_t;
+
+/**************************************************************************//**
+ * @struct sl_wfx_tx_queue_stats_t
+ * @brief Structure reporting the TX queue counters
+ *****************************************************************************/
+typedef struct {
+  uint32_t queued_frames;   ///< Frames that had to wait for a WFx input buffer
+  uint32_t sent_frames;     ///< Frames sent, directly or from the queue
+  uint32_t dropped_frames;  ///< Frames rejected because the queue was full, or discarded
+  uint32_t total_wait_time; ///< Sum of the queueing delays, in microseconds
+  uint32_t max_wait_time;   ///< Longest queueing delay, in microseconds
+  uint16_t depth;           ///< Number of frames currently queued
+  uint16_t max_depth;       ///< Highest number of frames queued at once
+} sl_wfx_tx_queue_stats_t;
+#endif //SL_WFX_USE_TX_QUEUE
+
+#ifdef SL_WFX_USE_STATISTICS
+/**************************************************************************//**
+ * @struct sl_wfx_register_stats_t
+ * @brief Structure reporting the bus transactions on one WFx register
+ *****************************************************************************/
+typedef struct {
+  uint32_t read_count;  ///< Number of read transactions
+  uint32_t write_count; ///< Number of write transactions
+  uint32_t read_bytes;  ///< Number of bytes read
+  uint32_t write_bytes; ///< Number of bytes written
+} sl_wfx_register_stats_t;
+
+/**************************************************************************//**
+ * @struct sl_wfx_command_stats_t
+ * @brief Structure reporting the request to confirmation latency of one
+ * command ID
+ *
+ * @note Bin i of the histogram counts the latencies below
+ * SL_WFX_STATS_LATENCY_BIN_BASE_US << i, the last bin counts all the others
+ *****************************************************************************/
+typedef struct {
+  uint8_t  command_id;                                ///< Command ID, 0 if the slot is unused
+  uint32_t count;                                     ///< Number of confirmations received
+  uint32_t total_latency;                             ///< Sum of the latencies, in microseconds
+  uint32_t max_latency;                               ///< Longest latency, in microseconds
+  uint32_t histogram[SL_WFX_STATS_LATENCY_BIN_COUNT]; ///< Latency distribution
+} sl_wfx_command_stats_t;
+
+/**************************************************************************//**
+ * @struct sl_wfx_frame_stats_t
+ * @brief Structure reporting the Ethernet frames sent or received
+ *
+ * @note Bin i of the histogram counts the frames below
+ * SL_WFX_STATS_FRAME_SIZE_BIN_BASE << i bytes, the last bin counts all the
+ * others
+ *****************************************************************************/
+typedef struct {
+  uint32_t count;                                        ///< Number of frames
+  uint32_t bytes;                                        ///< Number of Ethernet frame bytes
+  uint32_t histogram[SL_WFX_STATS_FRAME_SIZE_BIN_COUNT]; ///< Frame size distribution
+} sl_wfx_frame_stats_t;
+
+/**************************************************************************//**
+ * @struct sl_wfx_crypto_stats_t
+ * @brief Structure reporting the time spent in the secure link host crypto
+ *****************************************************************************/
+typedef struct {
+  uint32_t count;      ///< Number of messages processed
+  uint32_t bytes;      ///< Number of bytes processed
+  uint32_t total_time; ///< Sum of the processing times, in microseconds
+  uint32_t max_time;   ///< Longest processing time, in microseconds
+} sl_wfx_crypto_stats_t;
+
+/**************************************************************************//**
+ * @struct sl_wfx_statistics_t
+ * @brief Structure reporting the driver statistics
+ *****************************************************************************/
+typedef struct {
+  sl_wfx_register_stats_t registers[SL_WFX_STATS_REGISTER_COUNT]; ///< Bus transactions, indexed by register ID
+  sl_wfx_command_stats_t  commands[SL_WFX_STATS_COMMAND_SLOTS];   ///< Command latencies, in order of first use
+  uint32_t                untracked_commands;                     ///< Confirmations not recorded because all the slots are used
+  sl_wfx_frame_stats_t    tx_frames;                              ///< Ethernet frames sent
+  sl_wfx_frame_stats_t    rx_frames;                              ///< Ethernet frames received
+  uint32_t                wake_ups;                               ///< Number of times the WFx was woken up
+  uint32_t                sleeps;                                 ///< Number of times the WFx was put to sleep
+#ifdef SL_WFX_USE_SECURE_LINK
+  sl_wfx_crypto_stats_t   encryption;                             ///< Secure link encryption of the requests
+  sl_wfx_crypto_stats_t   decryption;                             ///< Secure link decryption of the confirmations and indications
+#endif //SL_WFX_USE_SECURE_LINK
+} sl_wfx_statistics_t;
+#endif //SL_WFX_USE_STATISTICS
+
 /**************************************************************************//**
  * @struct sl_wfx_context_t
  * @brief Structure used to maintain the Wi-Fi solution context on the host
@@ -375,6 +548,18 @@ typedef struct {
   uint8_t  secure_link_renegotiation_state;
   sl_wfx_securelink_exchange_pub_keys_ind_t  secure_link_exchange_ind;
 #endif //SL_WFX_USE_SECURE_LINK
+#ifdef SL_WFX_USE_BOOT_TIMING
+  sl_wfx_boot_timing_t    boot_timing;             ///< Duration of the last sl_wfx_init() phases
+#endif //SL_WFX_USE_BOOT_TIMING
+#ifdef SL_WFX_USE_TX_QUEUE
+  sl_wfx_tx_queue_t       tx_queue;
+  sl_wfx_tx_queue_stats_t tx_queue_stats;
+#endif //SL_WFX_USE_TX_QUEUE
+#ifdef SL_WFX_USE_STATISTICS
+  sl_wfx_statistics_t     statistics;
+  uint8_t                 stats_waited_command_id;    ///< Command whose confirmation is awaited, 0 if none
+  uint32_t                stats_waited_command_start; ///< Time at which the awaited command was sent
+#endif //SL_WFX_USE_STATISTICS
 } sl_wfx_context_t;
 
 #endif // SL_WFX_CONSTANTS_H
@@ -232,6 +232,22 @@ sl_status_t sl_wfx_host_free_buffer(void *buffer, sl_wfx_buffer_type_t type);
  *****************************************************************************/
 sl_status_t sl_wfx_host_transmit_frame(void *frame, uint32_t frame_len);
 
+/**************************************************************************//**
+ * @brief Called when the driver sends a scattered frame to the WFx chip
+ *
+ * @param segments is the list of segments forming the frame, starting with
+ * the frame header
+ * @param segment_count is the number of segments in the list
+ * @param frame_len is size of the frame, padding included
+ * @returns Returns SL_STATUS_OK if successful, SL_STATUS_FAIL otherwise
+ *
+ * @note A default implementation calling ::sl_wfx_data_write_segments is
+ * provided by the driver
+ *****************************************************************************/
+sl_status_t sl_wfx_host_transmit_frame_segments(const sl_wfx_data_segment_t *segments,
+                                                uint8_t segment_count,
+                                                uint32_t frame_len);
+
 /**************************************************************************//**
  * @brief Called when the driver needs to lock its access
  *
@@ -298,6 +314,10 @@ sl_status_t sl_wfx_host_spi_cs_deassert(void);
  * @param buffer is a pointer to the buffer data
  * @param buffer_length is the length of the buffer data
  * @returns Returns SL_STATUS_OK if successful, SL_STATUS_FAIL otherwise
+ *
+ * @note When a scattered frame is written, this function is called once per
+ * segment while the Chip Select stays asserted. The header is only given with
+ * the first segment, header_length is 0 for the following ones.
  *****************************************************************************/
 sl_status_t sl_wfx_host_spi_transfer_no_cs_assert(sl_wfx_host_bus_transfer_type_t type,
                                                   uint8_t *header,
@@ -336,6 +356,24 @@ sl_status_t sl_wfx_host_sdio_transfer_cmd53(sl_wfx_host_bus_transfer_type_t type
                                             uint8_t *buffer,
                                             uint16_t buffer_length);
 
+/**************************************************************************//**
+ * @brief Send command 53 on the SDIO bus with a scattered buffer
+ *
+ * @param function is the function to use in the SDIO command
+ * @param address is the address to use in the SDIO command
+ * @param segments is the list of segments to be written in a single command
+ * @param segment_count is the number of segments in the list
+ * @param buffer_length is the total length of the segments
+ * @returns Returns SL_STATUS_OK if successful, SL_STATUS_FAIL otherwise
+ *
+ * @note Only called for writes of scattered frames
+ *****************************************************************************/
+sl_status_t sl_wfx_host_sdio_transfer_cmd53_segments(uint8_t  function,
+                                                     uint32_t address,
+                                                     const sl_wfx_data_segment_t *segments,
+                                                     uint8_t  segment_count,
+                                                     uint16_t buffer_length);
+
 /**************************************************************************//**
  * @brief Enable the SDIO high-speed mode
  * @returns Returns SL_STATUS_OK if successful, SL_STATUS_FAIL otherwise
@@ -417,6 +455,20 @@ sl_status_t sl_wfx_host_encode_secure_link_data(sl_wfx_generic_message_t *buffer
 sl_status_t sl_wfx_host_schedule_secure_link_renegotiation(void);
 #endif //SL_WFX_USE_SECURE_LINK
 
+#if defined(SL_WFX_USE_TX_QUEUE) || defined(SL_WFX_USE_BOOT_TIMING) || defined(SL_WFX_USE_STATISTICS)
+/* WFX host time API */
+
+/**************************************************************************//**
+ * @brief Get a free running timestamp
+ *
+ * @returns Returns the current time in microseconds, wrapping at 2^32
+ *
+ * @note Used to measure the time spent by frames in the TX queue, the
+ * duration of the initialization phases and the command latencies
+ *****************************************************************************/
+uint32_t sl_wfx_host_get_time_us(void);
+#endif //SL_WFX_USE_TX_QUEUE || SL_WFX_USE_BOOT_TIMING || SL_WFX_USE_STATISTICS
+
 /* WF200 host debug API */
 /**************************************************************************//**
  * @brief Log information about the driver
@@ -0,0 +1,74 @@
+#ifndef __SILICON_LABS_EM_EUSART_UTILS_H__
+#define __SILICON_LABS_EM_EUSART_UTILS_H__
+
+#include "em_device.h"
+#if defined(EUART_PRESENT) && (EUART_COUNT > 0u)
+
+#include <stddef.h>
+#include "em_eusart.h"
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1) \
+  && defined(LDMAXBAR_CH_REQSEL_SIGSEL_EUART0TXFL)
+#include "em_ldma.h"
+
+/** LDMA transfers are available for the EUSART. */
+#define EUSART_TRANSFER_LDMA
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void EUSART_TxBuffer(EUSART_TypeDef *eusart, const uint8_t *data, size_t length);
+void EUSART_RxBuffer(EUSART_TypeDef *eusart, uint8_t *data, size_t length);
+
+#if defined(EUSART_TRANSFER_LDMA)
+/** Maximum number of frames in a single asynchronous transfer. */
+#define EUSART_TRANSFER_MAX_LENGTH \
+  ((_LDMA_CH_CTRL_XFERCNT_MASK >> _LDMA_CH_CTRL_XFERCNT_SHIFT) + 1U)
+
+typedef struct EUSART_Transfer EUSART_Transfer_TypeDef;
+
+/** Asynchronous transfer completion callback. */
+typedef void (*EUSART_TransferCallback_TypeDef)(EUSART_Transfer_TypeDef *transfer,
+                                                void *arg);
+
+/***************************************************************************//**
+ * @brief
+ *   State of an LDMA driven EUSART transfer.
+ *
+ * @note
+ *   The structure holds the LDMA descriptor, so it must stay allocated until
+ *   the transfer has completed. Initialize it with EUSART_TransferInit().
+ ******************************************************************************/
+struct EUSART_Transfer {
+  EUSART_TypeDef                  *eusart;    /**< EUSART peripheral. */
+  int                             channel;    /**< LDMA channel. */
+  LDMA_Descriptor_t               descriptor;
+  EUSART_TransferCallback_TypeDef callback;
+  void                            *arg;
+  volatile bool                   busy;       /**< True while a transfer runs. */
+};
+
+void EUSART_TransferInit(EUSART_Transfer_TypeDef *transfer,
+                         EUSART_TypeDef *eusart,
+                         int channel);
+void EUSART_TxBufferAsync(EUSART_Transfer_TypeDef *transfer,
+                          const uint8_t *data,
+                          size_t length,
+                          EUSART_TransferCallback_TypeDef callback,
+                          void *arg);
+void EUSART_RxBufferAsync(EUSART_Transfer_TypeDef *transfer,
+                          uint8_t *data,
+                          size_t length,
+                          EUSART_TransferCallback_TypeDef callback,
+                          void *arg);
+bool EUSART_TransferIrqHandler(EUSART_Transfer_TypeDef *transfer,
+                               uint32_t pending);
+#endif /* defined(EUSART_TRANSFER_LDMA) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* defined(EUART_PRESENT) && (EUART_COUNT > 0u) */
+#endif /* __SILICON_LABS_EM_EUSART_UTILS_H__ */
@@ -0,0 +1,98 @@
+#ifndef __SILICON_LABS_EM_I2C_UTILS_H__
+#define __SILICON_LABS_EM_I2C_UTILS_H__
+
+#include "em_device.h"
+#if defined(I2C_COUNT) && (I2C_COUNT > 0)
+
+#include "em_i2c.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Result reported for a transaction that did not finish within its timeout. */
+#define I2C_QUEUE_TIMEOUT   ((I2C_TransferReturn_TypeDef) -16)
+
+/** Transaction completion callback, called from I2C_QueueIrqHandler(). */
+typedef void (*I2C_QueueCallback_TypeDef)(I2C_TransferSeq_TypeDef *seq,
+                                          I2C_TransferReturn_TypeDef result,
+                                          void *arg);
+
+/** A queued transaction. */
+typedef struct {
+  I2C_TransferSeq_TypeDef   *seq;       /**< Transfer sequence. */
+  I2C_QueueCallback_TypeDef callback;   /**< Completion callback, or NULL. */
+  void                      *arg;       /**< Argument passed to the callback. */
+  uint32_t                  timeout;    /**< Timeout in ticks, or 0 for none. */
+} I2C_QueueEntry_TypeDef;
+
+/** Queue statistics. */
+typedef struct {
+  uint32_t completed;   /**< Transactions completed successfully. */
+  uint32_t failed;      /**< Transactions completed with an error or timeout. */
+  uint32_t timeouts;    /**< Transactions which timed out. */
+  uint32_t recoveries;  /**< Bus recoveries through I2C_Reset(). */
+  uint32_t bytes;       /**< Data bytes of successful transactions. */
+  uint32_t busyTicks;   /**< Ticks with a transaction on the bus. */
+  uint32_t idleTicks;   /**< Ticks with no transaction queued. */
+  uint32_t idleGaps;    /**< Times the queue drained and the bus went idle. */
+  uint32_t maxQueued;   /**< Largest number of transactions queued at once. */
+} I2C_QueueStats_TypeDef;
+
+/***************************************************************************//**
+ * @brief
+ *   State of an interrupt driven I2C transaction queue.
+ *
+ * @details
+ *   Transactions are submitted from any context and run one after the other
+ *   from the I2C interrupt handler. When a transaction finishes, the next one
+ *   is started before the callback of the finished one is called, so the bus
+ *   does not wait on software between queued transactions.
+ *
+ *   Timeouts and the busy and idle statistics are counted in ticks of
+ *   I2C_QueueTick(). Throughput is bytes over busyTicks.
+ *
+ * @note
+ *   The structure must stay allocated while the queue is in use. Initialize
+ *   it with I2C_QueueInit().
+ ******************************************************************************/
+typedef struct {
+  I2C_TypeDef             *i2c;
+  I2C_Init_TypeDef        init;         /**< Used to restore the I2C on recovery. */
+  IRQn_Type               irq;
+  I2C_QueueEntry_TypeDef  *entries;     /**< Ring of queued transactions. */
+  uint32_t                size;         /**< Number of entries in the ring. */
+
+  volatile uint32_t       submitted;    /**< Transactions submitted. */
+  volatile uint32_t       finished;     /**< Transactions finished. */
+  volatile bool           active;       /**< A transaction is on the bus. */
+  volatile uint32_t       ticks;        /**< Ticks counted by I2C_QueueTick(). */
+  volatile uint32_t       deadline;     /**< Tick at which the active transaction
+                                             times out. */
+  volatile bool           timed;        /**< The active transaction has a
+                                             timeout. */
+  I2C_QueueStats_TypeDef  stats;
+} I2C_Queue_TypeDef;
+
+void I2C_QueueInit(I2C_Queue_TypeDef *queue,
+                   I2C_TypeDef *i2c,
+                   const I2C_Init_TypeDef *init,
+                   I2C_QueueEntry_TypeDef *entries,
+                   uint32_t size);
+bool I2C_QueueSubmit(I2C_Queue_TypeDef *queue,
+                     I2C_TransferSeq_TypeDef *seq,
+                     I2C_QueueCallback_TypeDef callback,
+                     void *arg,
+                     uint32_t timeout);
+uint32_t I2C_QueuePending(I2C_Queue_TypeDef *queue);
+void I2C_QueueIrqHandler(I2C_Queue_TypeDef *queue);
+void I2C_QueueTick(I2C_Queue_TypeDef *queue);
+void I2C_QueueGetStats(I2C_Queue_TypeDef *queue, I2C_QueueStats_TypeDef *stats);
+void I2C_QueueClearStats(I2C_Queue_TypeDef *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* defined(I2C_COUNT) && (I2C_COUNT > 0) */
+#endif /* __SILICON_LABS_EM_I2C_UTILS_H__ */
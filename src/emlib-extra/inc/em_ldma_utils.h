@@ -0,0 +1,78 @@
+#ifndef __SILICON_LABS_EM_LDMA_UTILS_H__
+#define __SILICON_LABS_EM_LDMA_UTILS_H__
+
+#include "em_device.h"
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+
+#include <stddef.h>
+#include "em_ldma.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct LDMA_Stream LDMA_Stream_TypeDef;
+
+/** Segment completion callback, called from LDMA_StreamIrqHandler(). */
+typedef void (*LDMA_StreamCallback_TypeDef)(LDMA_Stream_TypeDef *stream,
+                                            void *arg);
+
+/***************************************************************************//**
+ * @brief
+ *   State of a continuous peripheral to memory stream.
+ *
+ * @details
+ *   The LDMA writes into a ring buffer through a circular chain of
+ *   descriptors, one per segment, and never stops. The interrupt handler is
+ *   the only writer of the producer fields and the consumer functions are the
+ *   only writers of the consumer fields, so a single consumer can read the
+ *   stream without locking.
+ *
+ * @note
+ *   The structure must stay allocated while the stream is running. Initialize
+ *   it with LDMA_StreamStart().
+ ******************************************************************************/
+struct LDMA_Stream {
+  int                         channel;      /**< LDMA channel. */
+  uint8_t                     *buffer;      /**< Ring buffer. */
+  size_t                      size;         /**< Ring buffer size in bytes. */
+  size_t                      segmentSize;  /**< Segment size in bytes. */
+  LDMA_StreamCallback_TypeDef callback;
+  void                        *arg;
+
+  /* Producer, written by LDMA_StreamIrqHandler(). */
+  volatile uint32_t           written;      /**< Bytes written up to writeIndex. */
+  volatile size_t             writeIndex;   /**< Start of the segment being written. */
+
+  /* Consumer, written by the consumer functions. */
+  uint32_t                    consumed;     /**< Bytes consumed. */
+  size_t                      readIndex;    /**< Next byte to consume. */
+  uint32_t                    overruns;     /**< Times unread data was overwritten. */
+  uint32_t                    lost;         /**< Bytes discarded on overruns. */
+};
+
+void LDMA_StreamStart(LDMA_Stream_TypeDef *stream,
+                      int channel,
+                      const LDMA_TransferCfg_t *config,
+                      const volatile void *source,
+                      LDMA_CtrlSize_t unitSize,
+                      void *buffer,
+                      size_t size,
+                      LDMA_Descriptor_t *descriptors,
+                      uint32_t segments,
+                      LDMA_StreamCallback_TypeDef callback,
+                      void *arg);
+void LDMA_StreamStop(LDMA_Stream_TypeDef *stream);
+bool LDMA_StreamIrqHandler(LDMA_Stream_TypeDef *stream, uint32_t pending);
+
+size_t LDMA_StreamAvailable(LDMA_Stream_TypeDef *stream);
+const void *LDMA_StreamPeek(LDMA_Stream_TypeDef *stream, size_t *length);
+void LDMA_StreamConsume(LDMA_Stream_TypeDef *stream, size_t length);
+size_t LDMA_StreamRead(LDMA_Stream_TypeDef *stream, void *data, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* defined(LDMA_PRESENT) && (LDMA_COUNT == 1) */
+#endif /* __SILICON_LABS_EM_LDMA_UTILS_H__ */
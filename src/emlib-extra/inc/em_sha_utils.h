@@ -0,0 +1,48 @@
+#ifndef __SILICON_LABS_EM_SHA_UTILS_H__
+#define __SILICON_LABS_EM_SHA_UTILS_H__
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** SHA-1 digest size in bytes. */
+#define SHA_SHA1_DIGEST_SIZE    (20)
+
+/** SHA-256 digest size in bytes. */
+#define SHA_SHA256_DIGEST_SIZE  (32)
+
+/** SHA algorithm selection. */
+typedef enum {
+  shaModeSha1,    /**< SHA-1. */
+  shaModeSha256   /**< SHA-256. */
+} SHA_Mode_TypeDef;
+
+/***************************************************************************//**
+ * @brief
+ *   Software SHA context.
+ *
+ * @details
+ *   Software counterpart of CRYPTO_SHA_Context_TypeDef. SHA_Init(),
+ *   SHA_Update() and SHA_Final() behave like CRYPTO_SHA_Init(),
+ *   CRYPTO_SHA_Update() and CRYPTO_SHA_Final(), but need no CRYPTO module and
+ *   no device headers.
+ ******************************************************************************/
+typedef struct {
+  SHA_Mode_TypeDef mode;       /**< Selected algorithm. */
+  uint32_t         state[8];   /**< Intermediate digest. */
+  uint8_t          block[64];  /**< Partial block. */
+  uint32_t         blockLen;   /**< Number of bytes in the partial block. */
+  uint64_t         msgLen;     /**< Total message length in bytes. */
+} SHA_Context_TypeDef;
+
+void SHA_Init(SHA_Context_TypeDef *ctx, SHA_Mode_TypeDef mode);
+void SHA_Update(SHA_Context_TypeDef *ctx, const uint8_t *msg, uint32_t msgLen);
+void SHA_Final(SHA_Context_TypeDef *ctx, uint8_t *digest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SILICON_LABS_EM_SHA_UTILS_H__ */
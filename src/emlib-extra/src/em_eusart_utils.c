@@ -0,0 +1,228 @@
+#include "em_eusart_utils.h"
+#if defined(EUART_PRESENT) && (EUART_COUNT > 0u)
+
+#include "em_assert.h"
+
+/***************************************************************************//**
+ * @brief
+ *   Transmit a buffer of frames.
+ *
+ * @details
+ *   The TX FIFO is refilled as soon as it has room, so there is no gap between
+ *   frames. The function returns when the last frame has been written to the
+ *   TX FIFO, not when it has been shifted out.
+ *
+ * @param[in] eusart
+ *   A pointer to the EUSART peripheral register block.
+ *
+ * @param[in] data
+ *   Frames to transmit.
+ *
+ * @param[in] length
+ *   Number of frames to transmit.
+ ******************************************************************************/
+void EUSART_TxBuffer(EUSART_TypeDef *eusart, const uint8_t *data, size_t length)
+{
+  size_t count;
+
+  for (count = 0; count < length; count++) {
+    while (!(eusart->STATUS & EUSART_STATUS_TXFL)) {
+    }
+    eusart->TXDATA = (uint32_t)data[count];
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Receive a buffer of frames.
+ *
+ * @details
+ *   Frames are read for as long as the RX FIFO has data, and the function
+ *   blocks until @p length frames have been received.
+ *
+ * @param[in] eusart
+ *   A pointer to the EUSART peripheral register block.
+ *
+ * @param[out] data
+ *   Buffer for the received frames.
+ *
+ * @param[in] length
+ *   Number of frames to receive.
+ ******************************************************************************/
+void EUSART_RxBuffer(EUSART_TypeDef *eusart, uint8_t *data, size_t length)
+{
+  size_t count = 0;
+
+  while (count < length) {
+    while ((count < length) && (eusart->STATUS & EUSART_STATUS_RXFL)) {
+      data[count] = (uint8_t)eusart->RXDATA;
+      count++;
+    }
+  }
+}
+
+#if defined(EUSART_TRANSFER_LDMA)
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/* The LDMA request signals of EUART0, missing from LDMA_PeripheralSignal_t. */
+#define EUSART_LDMA_SIGNAL_TXFL \
+  (LDMAXBAR_CH_REQSEL_SIGSEL_EUART0TXFL | LDMAXBAR_CH_REQSEL_SOURCESEL_EUART0)
+#define EUSART_LDMA_SIGNAL_RXFL \
+  (LDMAXBAR_CH_REQSEL_SIGSEL_EUART0RXFL | LDMAXBAR_CH_REQSEL_SOURCESEL_EUART0)
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Initialize an LDMA driven EUSART transfer.
+ *
+ * @note
+ *   LDMA_Init() must have been called. The application owns LDMA_IRQHandler()
+ *   and must call EUSART_TransferIrqHandler() from it.
+ *
+ * @param[out] transfer
+ *   The transfer to initialize.
+ *
+ * @param[in] eusart
+ *   A pointer to the EUSART peripheral register block.
+ *
+ * @param[in] channel
+ *   LDMA channel to use.
+ ******************************************************************************/
+void EUSART_TransferInit(EUSART_Transfer_TypeDef *transfer,
+                         EUSART_TypeDef *eusart,
+                         int channel)
+{
+  EFM_ASSERT(eusart == EUART0);
+
+  transfer->eusart = eusart;
+  transfer->channel = channel;
+  transfer->callback = NULL;
+  transfer->arg = NULL;
+  transfer->busy = false;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Start transmitting a buffer of frames using LDMA.
+ *
+ * @details
+ *   The callback is called from EUSART_TransferIrqHandler() once the last
+ *   frame has been written to the TX FIFO.
+ *
+ * @param[in] transfer
+ *   The transfer to use.
+ *
+ * @param[in] data
+ *   Frames to transmit. Must stay valid until the transfer has completed.
+ *
+ * @param[in] length
+ *   Number of frames, at most EUSART_TRANSFER_MAX_LENGTH.
+ *
+ * @param[in] callback
+ *   Function to call on completion, or NULL.
+ *
+ * @param[in] arg
+ *   Argument passed to the callback.
+ ******************************************************************************/
+void EUSART_TxBufferAsync(EUSART_Transfer_TypeDef *transfer,
+                          const uint8_t *data,
+                          size_t length,
+                          EUSART_TransferCallback_TypeDef callback,
+                          void *arg)
+{
+  LDMA_TransferCfg_t config = LDMA_TRANSFER_CFG_PERIPHERAL(EUSART_LDMA_SIGNAL_TXFL);
+  LDMA_Descriptor_t descriptor =
+    LDMA_DESCRIPTOR_SINGLE_M2P_BYTE(data, &transfer->eusart->TXDATA, length);
+
+  EFM_ASSERT(!transfer->busy);
+  EFM_ASSERT((length > 0U) && (length <= EUSART_TRANSFER_MAX_LENGTH));
+
+  transfer->descriptor = descriptor;
+  transfer->callback = callback;
+  transfer->arg = arg;
+  transfer->busy = true;
+
+  LDMA_StartTransfer(transfer->channel, &config, &transfer->descriptor);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Start receiving a buffer of frames using LDMA.
+ *
+ * @param[in] transfer
+ *   The transfer to use.
+ *
+ * @param[out] data
+ *   Buffer for the received frames. Must stay valid until the transfer has
+ *   completed.
+ *
+ * @param[in] length
+ *   Number of frames, at most EUSART_TRANSFER_MAX_LENGTH.
+ *
+ * @param[in] callback
+ *   Function to call on completion, or NULL.
+ *
+ * @param[in] arg
+ *   Argument passed to the callback.
+ ******************************************************************************/
+void EUSART_RxBufferAsync(EUSART_Transfer_TypeDef *transfer,
+                          uint8_t *data,
+                          size_t length,
+                          EUSART_TransferCallback_TypeDef callback,
+                          void *arg)
+{
+  LDMA_TransferCfg_t config = LDMA_TRANSFER_CFG_PERIPHERAL(EUSART_LDMA_SIGNAL_RXFL);
+  LDMA_Descriptor_t descriptor =
+    LDMA_DESCRIPTOR_SINGLE_P2M_BYTE(&transfer->eusart->RXDATA, data, length);
+
+  EFM_ASSERT(!transfer->busy);
+  EFM_ASSERT((length > 0U) && (length <= EUSART_TRANSFER_MAX_LENGTH));
+
+  transfer->descriptor = descriptor;
+  transfer->callback = callback;
+  transfer->arg = arg;
+  transfer->busy = true;
+
+  LDMA_StartTransfer(transfer->channel, &config, &transfer->descriptor);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Handle the LDMA interrupt of an EUSART transfer.
+ *
+ * @details
+ *   Call this from LDMA_IRQHandler() with the pending and enabled interrupt
+ *   flags, as returned by LDMA_IntGetEnabled(). If the transfer has completed,
+ *   its flag is cleared and its callback is called.
+ *
+ * @param[in] transfer
+ *   The transfer to check.
+ *
+ * @param[in] pending
+ *   Pending LDMA interrupt flags.
+ *
+ * @return
+ *   True if the interrupt belonged to this transfer.
+ ******************************************************************************/
+bool EUSART_TransferIrqHandler(EUSART_Transfer_TypeDef *transfer,
+                               uint32_t pending)
+{
+  uint32_t mask = 1UL << (uint8_t)transfer->channel;
+
+  if (!transfer->busy || !(pending & mask)) {
+    return false;
+  }
+
+  LDMA_IntClear(mask);
+  transfer->busy = false;
+
+  if (transfer->callback != NULL) {
+    transfer->callback(transfer, transfer->arg);
+  }
+
+  return true;
+}
+#endif /* defined(EUSART_TRANSFER_LDMA) */
+
+#endif /* defined(EUART_PRESENT) && (EUART_COUNT > 0u) */
@@ -0,0 +1,369 @@
+#include "em_i2c_utils.h"
+#if defined(I2C_COUNT) && (I2C_COUNT > 0)
+
+#include "em_assert.h"
+#include "em_core.h"
+
+#include <stddef.h>
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/* A finished transaction whose callback has not been called yet. */
+typedef struct {
+  I2C_QueueEntry_TypeDef     entry;
+  I2C_TransferReturn_TypeDef result;
+} queueDone_t;
+
+/* Get the NVIC interrupt of an I2C peripheral. */
+static IRQn_Type queueIrq(I2C_TypeDef *i2c)
+{
+#if (I2C_COUNT > 1)
+  if (i2c == I2C1) {
+    return I2C1_IRQn;
+  }
+#endif
+#if (I2C_COUNT > 2)
+  if (i2c == I2C2) {
+    return I2C2_IRQn;
+  }
+#endif
+  EFM_ASSERT(i2c == I2C0);
+  return I2C0_IRQn;
+}
+
+/* Get the number of data bytes of a transfer sequence. */
+static uint32_t queueSeqBytes(const I2C_TransferSeq_TypeDef *seq)
+{
+  uint32_t bytes = seq->buf[0].len;
+
+  if (seq->flags & (I2C_FLAG_WRITE_READ | I2C_FLAG_WRITE_WRITE)) {
+    bytes += seq->buf[1].len;
+  }
+
+  return bytes;
+}
+
+/* Retire the transaction at the head of the queue. */
+static void queueFinish(I2C_Queue_TypeDef *queue,
+                        I2C_TransferReturn_TypeDef result,
+                        queueDone_t *done)
+{
+  done->entry = queue->entries[queue->finished % queue->size];
+  done->result = result;
+
+  if (result == i2cTransferDone) {
+    queue->stats.completed++;
+    queue->stats.bytes += queueSeqBytes(done->entry.seq);
+  } else {
+    queue->stats.failed++;
+  }
+
+  if (result == I2C_QUEUE_TIMEOUT) {
+    queue->stats.timeouts++;
+  }
+
+  if ((result == I2C_QUEUE_TIMEOUT)
+      || (result == i2cTransferBusErr)
+      || (result == i2cTransferArbLost)
+      || (result == i2cTransferSwFault)) {
+    /* Abort whatever is left on the bus and start over from a clean state.
+       I2C_Reset() keeps the route but clears the configuration. */
+    I2C_Reset(queue->i2c);
+    I2C_Init(queue->i2c, &queue->init);
+    queue->stats.recoveries++;
+  }
+
+  queue->active = false;
+  queue->finished++;
+}
+
+/* Call the callback of a finished transaction. */
+static void queueNotify(const queueDone_t *done)
+{
+  if (done->entry.callback != NULL) {
+    done->entry.callback(done->entry.seq, done->result, done->entry.arg);
+  }
+}
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Initialize an I2C transaction queue.
+ *
+ * @details
+ *   The I2C is initialized with I2C_Init() and its NVIC interrupt is enabled.
+ *   Clock and route setup must be done beforehand. The application owns
+ *   I2Cn_IRQHandler() and must call I2C_QueueIrqHandler() from it.
+ *
+ * @param[out] queue
+ *   The queue to initialize.
+ *
+ * @param[in] i2c
+ *   A pointer to the I2C peripheral register block.
+ *
+ * @param[in] init
+ *   I2C initialization structure, also used to restore the I2C after a bus
+ *   recovery.
+ *
+ * @param[in] entries
+ *   Storage for the queued transactions. Must stay allocated while the queue
+ *   is in use.
+ *
+ * @param[in] size
+ *   Number of entries, which is the number of transactions that can be
+ *   queued at once.
+ ******************************************************************************/
+void I2C_QueueInit(I2C_Queue_TypeDef *queue,
+                   I2C_TypeDef *i2c,
+                   const I2C_Init_TypeDef *init,
+                   I2C_QueueEntry_TypeDef *entries,
+                   uint32_t size)
+{
+  EFM_ASSERT(entries != NULL);
+  EFM_ASSERT(size > 0);
+
+  queue->i2c = i2c;
+  queue->init = *init;
+  queue->irq = queueIrq(i2c);
+  queue->entries = entries;
+  queue->size = size;
+  queue->submitted = 0;
+  queue->finished = 0;
+  queue->active = false;
+  queue->ticks = 0;
+  queue->deadline = 0;
+  queue->timed = false;
+  queue->stats = (I2C_QueueStats_TypeDef){ 0 };
+
+  I2C_Init(i2c, init);
+
+  NVIC_ClearPendingIRQ(queue->irq);
+  NVIC_EnableIRQ(queue->irq);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Queue a transaction.
+ *
+ * @details
+ *   The transaction starts as soon as the ones before it have finished. The
+ *   sequence, including its buffers, must stay valid until the callback has
+ *   been called. The callback is called from I2C_QueueIrqHandler() with
+ *   #i2cTransferDone, an error returned by I2C_Transfer(), or
+ *   #I2C_QUEUE_TIMEOUT.
+ *
+ *   On a timeout, a bus error, a lost arbitration or a software fault, the
+ *   I2C is reset and initialized again before the next transaction starts.
+ *
+ * @param[in] queue
+ *   The queue to add to.
+ *
+ * @param[in] seq
+ *   The transfer sequence.
+ *
+ * @param[in] callback
+ *   Completion callback, or NULL.
+ *
+ * @param[in] arg
+ *   Argument passed to the callback.
+ *
+ * @param[in] timeout
+ *   Ticks of I2C_QueueTick() the transaction may take once started, or 0 for
+ *   no timeout. The transaction times out after between timeout - 1 and
+ *   timeout ticks.
+ *
+ * @return
+ *   True if the transaction was queued, false if the queue is full.
+ ******************************************************************************/
+bool I2C_QueueSubmit(I2C_Queue_TypeDef *queue,
+                     I2C_TransferSeq_TypeDef *seq,
+                     I2C_QueueCallback_TypeDef callback,
+                     void *arg,
+                     uint32_t timeout)
+{
+  I2C_QueueEntry_TypeDef *entry;
+  uint32_t queued;
+
+  EFM_ASSERT(seq != NULL);
+
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+
+  queued = queue->submitted - queue->finished;
+  if (queued >= queue->size) {
+    CORE_EXIT_ATOMIC();
+    return false;
+  }
+
+  entry = &queue->entries[queue->submitted % queue->size];
+  entry->seq = seq;
+  entry->callback = callback;
+  entry->arg = arg;
+  entry->timeout = timeout;
+  queue->submitted++;
+
+  if (queued + 1 > queue->stats.maxQueued) {
+    queue->stats.maxQueued = queued + 1;
+  }
+
+  /* The interrupt handler starts the transaction. When a transaction is
+     already running, it starts this one when that one finishes. */
+  if (!queue->active) {
+    NVIC_SetPendingIRQ(queue->irq);
+  }
+
+  CORE_EXIT_ATOMIC();
+
+  return true;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the number of queued transactions, including the running one.
+ *
+ * @param[in] queue
+ *   The queue to check.
+ *
+ * @return
+ *   Number of transactions which have not finished yet.
+ ******************************************************************************/
+uint32_t I2C_QueuePending(I2C_Queue_TypeDef *queue)
+{
+  return queue->submitted - queue->finished;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Handle the I2C interrupt of a queue.
+ *
+ * @details
+ *   Call this from I2Cn_IRQHandler(). The running transaction is advanced
+ *   with I2C_Transfer(). When it finishes, the next queued transaction is
+ *   started right away and only then is the callback of the finished one
+ *   called, so the bus is not left idle while the callback runs.
+ *   Transactions which are rejected by I2C_TransferInit() finish immediately
+ *   with its result. Callbacks are called in submission order.
+ *
+ *   Callbacks may submit new transactions.
+ *
+ * @param[in] queue
+ *   The queue to handle.
+ ******************************************************************************/
+void I2C_QueueIrqHandler(I2C_Queue_TypeDef *queue)
+{
+  I2C_TransferReturn_TypeDef result;
+  I2C_QueueEntry_TypeDef *entry;
+  queueDone_t done;
+  bool haveDone = false;
+
+  if (queue->active) {
+    result = I2C_Transfer(queue->i2c);
+    if (result == i2cTransferInProgress) {
+      if (!queue->timed
+          || ((int32_t)(queue->ticks - queue->deadline) < 0)) {
+        return;
+      }
+      result = I2C_QUEUE_TIMEOUT;
+    }
+    queueFinish(queue, result, &done);
+    haveDone = true;
+  }
+
+  while (!queue->active && (queue->finished != queue->submitted)) {
+    entry = &queue->entries[queue->finished % queue->size];
+
+    if (entry->timeout > 0) {
+      queue->deadline = queue->ticks + entry->timeout;
+    }
+    queue->timed = entry->timeout > 0;
+
+    result = I2C_TransferInit(queue->i2c, entry->seq);
+    if (result == i2cTransferInProgress) {
+      queue->active = true;
+      break;
+    }
+
+    /* Keep the callbacks in order before retiring the rejected one. */
+    if (haveDone) {
+      queueNotify(&done);
+    }
+    queueFinish(queue, result, &done);
+    haveDone = true;
+  }
+
+  if (haveDone) {
+    if (!queue->active) {
+      queue->stats.idleGaps++;
+    }
+    queueNotify(&done);
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Advance the time base of a queue.
+ *
+ * @details
+ *   Call this periodically, for instance from a timer interrupt. The tick
+ *   period sets the resolution of the transaction timeouts and of the busy
+ *   and idle statistics. When the running transaction has timed out, the I2C
+ *   interrupt is set pending to finish it.
+ *
+ * @param[in] queue
+ *   The queue to advance.
+ ******************************************************************************/
+void I2C_QueueTick(I2C_Queue_TypeDef *queue)
+{
+  uint32_t ticks = queue->ticks + 1;
+
+  queue->ticks = ticks;
+
+  if (queue->active) {
+    queue->stats.busyTicks++;
+    if (queue->timed && ((int32_t)(ticks - queue->deadline) >= 0)) {
+      NVIC_SetPendingIRQ(queue->irq);
+    }
+  } else if (queue->finished == queue->submitted) {
+    queue->stats.idleTicks++;
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the statistics of a queue.
+ *
+ * @param[in] queue
+ *   The queue to check.
+ *
+ * @param[out] stats
+ *   Copy of the statistics.
+ ******************************************************************************/
+void I2C_QueueGetStats(I2C_Queue_TypeDef *queue, I2C_QueueStats_TypeDef *stats)
+{
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  *stats = queue->stats;
+  CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Clear the statistics of a queue.
+ *
+ * @details
+ *   The maxQueued field restarts from the number of transactions queued now.
+ *
+ * @param[in] queue
+ *   The queue to clear.
+ ******************************************************************************/
+void I2C_QueueClearStats(I2C_Queue_TypeDef *queue)
+{
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  queue->stats = (I2C_QueueStats_TypeDef){ 0 };
+  queue->stats.maxQueued = queue->submitted - queue->finished;
+  CORE_EXIT_ATOMIC();
+}
+
+#endif /* defined(I2C_COUNT) && (I2C_COUNT > 0) */
@@ -0,0 +1,262 @@
+#include "em_sha_utils.h"
+
+#include <string.h>
+
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+#define ROTL32(x, n)  (((x) << (n)) | ((x) >> (32U - (n))))
+#define ROTR32(x, n)  (((x) >> (n)) | ((x) << (32U - (n))))
+
+static const uint32_t sha256K[64] = {
+  0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL,
+  0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
+  0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL,
+  0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf174UL,
+  0xe49b69c1UL, 0xefbe4786UL, 0x0fc19dc6UL, 0x240ca1ccUL,
+  0x2de92c6fUL, 0x4a7484aaUL, 0x5cb0a9dcUL, 0x76f988daUL,
+  0x983e5152UL, 0xa831c66dUL, 0xb00327c8UL, 0xbf597fc7UL,
+  0xc6e00bf3UL, 0xd5a79147UL, 0x06ca6351UL, 0x14292967UL,
+  0x27b70a85UL, 0x2e1b2138UL, 0x4d2c6dfcUL, 0x53380d13UL,
+  0x650a7354UL, 0x766a0abbUL, 0x81c2c92eUL, 0x92722c85UL,
+  0xa2bfe8a1UL, 0xa81a664bUL, 0xc24b8b70UL, 0xc76c51a3UL,
+  0xd192e819UL, 0xd6990624UL, 0xf40e3585UL, 0x106aa070UL,
+  0x19a4c116UL, 0x1e376c08UL, 0x2748774cUL, 0x34b0bcb5UL,
+  0x391c0cb3UL, 0x4ed8aa4aUL, 0x5b9cca4fUL, 0x682e6ff3UL,
+  0x748f82eeUL, 0x78a5636fUL, 0x84c87814UL, 0x8cc70208UL,
+  0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL
+};
+
+static uint32_t shaLoad32(const uint8_t *p)
+{
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16)
+         | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static void shaStore32(uint8_t *p, uint32_t value)
+{
+  p[0] = (uint8_t)(value >> 24);
+  p[1] = (uint8_t)(value >> 16);
+  p[2] = (uint8_t)(value >> 8);
+  p[3] = (uint8_t)value;
+}
+
+static void sha1Block(uint32_t *state, const uint8_t *block)
+{
+  uint32_t w[16];
+  uint32_t a = state[0];
+  uint32_t b = state[1];
+  uint32_t c = state[2];
+  uint32_t d = state[3];
+  uint32_t e = state[4];
+  uint32_t f;
+  uint32_t k;
+  uint32_t temp;
+  int i;
+
+  for (i = 0; i < 80; i++) {
+    if (i < 16) {
+      w[i] = shaLoad32(&block[4 * i]);
+    } else {
+      temp = w[(i - 3) & 15] ^ w[(i - 8) & 15] ^ w[(i - 14) & 15] ^ w[i & 15];
+      w[i & 15] = ROTL32(temp, 1U);
+    }
+
+    if (i < 20) {
+      f = (b & c) | (~b & d);
+      k = 0x5a827999UL;
+    } else if (i < 40) {
+      f = b ^ c ^ d;
+      k = 0x6ed9eba1UL;
+    } else if (i < 60) {
+      f = (b & c) | (b & d) | (c & d);
+      k = 0x8f1bbcdcUL;
+    } else {
+      f = b ^ c ^ d;
+      k = 0xca62c1d6UL;
+    }
+
+    temp = ROTL32(a, 5U) + f + e + k + w[i & 15];
+    e = d;
+    d = c;
+    c = ROTL32(b, 30U);
+    b = a;
+    a = temp;
+  }
+
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+}
+
+static void sha256Block(uint32_t *state, const uint8_t *block)
+{
+  uint32_t w[16];
+  uint32_t s[8];
+  uint32_t t1;
+  uint32_t t2;
+  int i;
+
+  memcpy(s, state, sizeof(s));
+
+  for (i = 0; i < 64; i++) {
+    if (i < 16) {
+      w[i] = shaLoad32(&block[4 * i]);
+    } else {
+      uint32_t w15 = w[(i - 15) & 15];
+      uint32_t w2 = w[(i - 2) & 15];
+
+      w[i & 15] += (ROTR32(w15, 7U) ^ ROTR32(w15, 18U) ^ (w15 >> 3))
+                   + w[(i - 7) & 15]
+                   + (ROTR32(w2, 17U) ^ ROTR32(w2, 19U) ^ (w2 >> 10));
+    }
+
+    t1 = s[7] + (ROTR32(s[4], 6U) ^ ROTR32(s[4], 11U) ^ ROTR32(s[4], 25U))
+         + ((s[4] & s[5]) ^ (~s[4] & s[6])) + sha256K[i] + w[i & 15];
+    t2 = (ROTR32(s[0], 2U) ^ ROTR32(s[0], 13U) ^ ROTR32(s[0], 22U))
+         + ((s[0] & s[1]) ^ (s[0] & s[2]) ^ (s[1] & s[2]));
+    s[7] = s[6];
+    s[6] = s[5];
+    s[5] = s[4];
+    s[4] = s[3] + t1;
+    s[3] = s[2];
+    s[2] = s[1];
+    s[1] = s[0];
+    s[0] = t1 + t2;
+  }
+
+  for (i = 0; i < 8; i++) {
+    state[i] += s[i];
+  }
+}
+
+static void shaBlock(SHA_Context_TypeDef *ctx, const uint8_t *block)
+{
+  if (ctx->mode == shaModeSha1) {
+    sha1Block(ctx->state, block);
+  } else {
+    sha256Block(ctx->state, block);
+  }
+}
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Start an incremental SHA-1 or SHA-256 hash operation in software.
+ *
+ * @param[out] ctx
+ *   A SHA context.
+ *
+ * @param[in] mode
+ *   The SHA algorithm to use.
+ ******************************************************************************/
+void SHA_Init(SHA_Context_TypeDef *ctx, SHA_Mode_TypeDef mode)
+{
+  static const uint32_t sha1Iv[5] = {
+    0x67452301UL, 0xefcdab89UL, 0x98badcfeUL, 0x10325476UL, 0xc3d2e1f0UL
+  };
+  static const uint32_t sha256Iv[8] = {
+    0x6a09e667UL, 0xbb67ae85UL, 0x3c6ef372UL, 0xa54ff53aUL,
+    0x510e527fUL, 0x9b05688cUL, 0x1f83d9abUL, 0x5be0cd19UL
+  };
+
+  ctx->mode = mode;
+  ctx->blockLen = 0;
+  ctx->msgLen = 0;
+
+  memset(ctx->state, 0, sizeof(ctx->state));
+  if (mode == shaModeSha1) {
+    memcpy(ctx->state, sha1Iv, sizeof(sha1Iv));
+  } else {
+    memcpy(ctx->state, sha256Iv, sizeof(sha256Iv));
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Add a chunk of message to an incremental SHA hash operation.
+ *
+ * @param[in] ctx
+ *   A SHA context started with SHA_Init().
+ *
+ * @param[in] msg
+ *   Message chunk to hash.
+ *
+ * @param[in] msgLen
+ *   Length of the message chunk in bytes.
+ ******************************************************************************/
+void SHA_Update(SHA_Context_TypeDef *ctx, const uint8_t *msg, uint32_t msgLen)
+{
+  uint32_t count;
+
+  ctx->msgLen += msgLen;
+
+  if (ctx->blockLen > 0U) {
+    count = sizeof(ctx->block) - ctx->blockLen;
+    if (count > msgLen) {
+      count = msgLen;
+    }
+    memcpy(&ctx->block[ctx->blockLen], msg, count);
+    ctx->blockLen += count;
+    msg += count;
+    msgLen -= count;
+
+    if (ctx->blockLen < sizeof(ctx->block)) {
+      return;
+    }
+
+    shaBlock(ctx, ctx->block);
+    ctx->blockLen = 0;
+  }
+
+  while (msgLen >= sizeof(ctx->block)) {
+    shaBlock(ctx, msg);
+    msg += sizeof(ctx->block);
+    msgLen -= sizeof(ctx->block);
+  }
+
+  memcpy(ctx->block, msg, msgLen);
+  ctx->blockLen = msgLen;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Finish an incremental SHA hash operation.
+ *
+ * @param[in] ctx
+ *   A SHA context started with SHA_Init().
+ *
+ * @param[out] digest
+ *   The message digest, SHA_SHA1_DIGEST_SIZE or SHA_SHA256_DIGEST_SIZE long.
+ ******************************************************************************/
+void SHA_Final(SHA_Context_TypeDef *ctx, uint8_t *digest)
+{
+  uint32_t blockLen = ctx->blockLen;
+  uint64_t msgLenInBits = ctx->msgLen << 3U;
+  uint32_t words = (ctx->mode == shaModeSha1) ? 5U : 8U;
+  uint32_t i;
+
+  /* Append the '1' bit. */
+  ctx->block[blockLen++] = 0x80;
+
+  if (blockLen > 56U) {
+    memset(&ctx->block[blockLen], 0, sizeof(ctx->block) - blockLen);
+    shaBlock(ctx, ctx->block);
+    blockLen = 0;
+  }
+
+  /* Pad up to 56 bytes of zeros and encode the message length. */
+  memset(&ctx->block[blockLen], 0, 56U - blockLen);
+  shaStore32(&ctx->block[56], (uint32_t)(msgLenInBits >> 32U));
+  shaStore32(&ctx->block[60], (uint32_t)msgLenInBits);
+  shaBlock(ctx, ctx->block);
+
+  for (i = 0; i < words; i++) {
+    shaStore32(&digest[4U * i], ctx->state[i]);
+  }
+
+  ctx->blockLen = 0;
+  ctx->msgLen = 0;
+}
@@ -84,4 +84,460 @@ void USART_FrameSet(USART_TypeDef *usart,
                  | (uint32_t)parity;
 }
 
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/* Frames in flight in SPI mode, one in the TX buffer and one in the shift
+   register. Limiting it to this keeps the two-frame RX buffer from
+   overflowing while the CPU is busy. */
+#define USART_SPI_FRAMES_IN_FLIGHT 2U
+
+/* Check if two frames can be moved with one TXDOUBLE/RXDOUBLE access. */
+static bool usartDoubleAccess(USART_TypeDef *usart)
+{
+  if ((usart->FRAME & _USART_FRAME_DATABITS_MASK) > USART_FRAME_DATABITS_EIGHT) {
+    return false;
+  }
+#if defined(_USART_CTRL_TXBIL_MASK)
+  /* TXBL only means that both buffer slots are free if TXBIL is EMPTY. */
+  return (usart->CTRL & _USART_CTRL_TXBIL_MASK) == USART_CTRL_TXBIL_EMPTY;
+#else
+  return false;
+#endif
+}
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Transmit a buffer of 4-8 bit frames.
+ *
+ * @details
+ *   The TX buffer is refilled as soon as it has room, two frames at a time
+ *   when possible, so there is no gap between frames. The function returns
+ *   when the last frame has been written to the TX buffer, not when it has
+ *   been shifted out.
+ *
+ * @param[in] usart
+ *   A pointer to the USART peripheral register block.
+ *
+ * @param[in] data
+ *   Frames to transmit.
+ *
+ * @param[in] length
+ *   Number of frames to transmit.
+ ******************************************************************************/
+void USART_TxBuffer(USART_TypeDef *usart, const uint8_t *data, size_t length)
+{
+  size_t count = 0;
+
+  if (usartDoubleAccess(usart)) {
+    while ((length - count) >= 2U) {
+      while (!(usart->STATUS & USART_STATUS_TXBL)) {
+      }
+      usart->TXDOUBLE = (uint32_t)data[count]
+                        | ((uint32_t)data[count + 1U] << _USART_TXDOUBLE_TXDATA1_SHIFT);
+      count += 2U;
+    }
+  }
+
+  while (count < length) {
+    while (!(usart->STATUS & USART_STATUS_TXBL)) {
+    }
+    usart->TXDATA = (uint32_t)data[count];
+    count++;
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Receive a buffer of 4-8 bit frames.
+ *
+ * @details
+ *   Both frames are read at once when the RX buffer is full. The function
+ *   blocks until @p length frames have been received.
+ *
+ * @param[in] usart
+ *   A pointer to the USART peripheral register block.
+ *
+ * @param[out] data
+ *   Buffer for the received frames.
+ *
+ * @param[in] length
+ *   Number of frames to receive.
+ ******************************************************************************/
+void USART_RxBuffer(USART_TypeDef *usart, uint8_t *data, size_t length)
+{
+  bool rxDouble = ((usart->FRAME & _USART_FRAME_DATABITS_MASK)
+                   <= USART_FRAME_DATABITS_EIGHT);
+  size_t count = 0;
+
+  while (count < length) {
+    uint32_t status = usart->STATUS;
+
+    if (rxDouble && (status & USART_STATUS_RXFULL) && ((length - count) >= 2U)) {
+      uint32_t frames = usart->RXDOUBLE;
+
+      data[count] = (uint8_t)frames;
+      data[count + 1U] = (uint8_t)(frames >> _USART_RXDOUBLE_RXDATA1_SHIFT);
+      count += 2U;
+    } else if (status & USART_STATUS_RXDATAV) {
+      data[count] = (uint8_t)usart->RXDATA;
+      count++;
+    }
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Perform a full-duplex SPI transfer of a buffer of frames.
+ *
+ * @details
+ *   Unlike calling USART_SpiTransfer() for every frame, the next frame is
+ *   written to the TX buffer while the previous one is still being shifted
+ *   out, so the bus runs without gaps between frames.
+ *
+ * @note
+ *   The USART must be configured as SPI master, and the RX buffer should be
+ *   empty before the call.
+ *
+ * @param[in] usart
+ *   A pointer to the USART peripheral register block.
+ *
+ * @param[in] txData
+ *   Frames to transmit, or NULL to transmit USART_SPI_DUMMY_FRAME.
+ *
+ * @param[out] rxData
+ *   Buffer for the received frames, or NULL to discard them.
+ *
+ * @param[in] length
+ *   Number of frames to transfer.
+ ******************************************************************************/
+void USART_SpiTransferBuffer(USART_TypeDef *usart,
+                             const uint8_t *txData,
+                             uint8_t *rxData,
+                             size_t length)
+{
+  size_t txCount = 0;
+  size_t rxCount = 0;
+
+  while (rxCount < length) {
+    if ((txCount < length)
+        && ((txCount - rxCount) < USART_SPI_FRAMES_IN_FLIGHT)
+        && (usart->STATUS & USART_STATUS_TXBL)) {
+      usart->TXDATA = (txData != NULL) ? (uint32_t)txData[txCount]
+                      : (uint32_t)USART_SPI_DUMMY_FRAME;
+      txCount++;
+    }
+
+    if (usart->STATUS & USART_STATUS_RXDATAV) {
+      uint8_t frame = (uint8_t)usart->RXDATA;
+
+      if (rxData != NULL) {
+        rxData[rxCount] = frame;
+      }
+      rxCount++;
+    }
+  }
+}
+
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/* Get the LDMA request signals of a USART. */
+static void usartLdmaSignals(USART_TypeDef *usart,
+                             LDMA_PeripheralSignal_t *txSignal,
+                             LDMA_PeripheralSignal_t *rxSignal)
+{
+  *txSignal = ldmaPeripheralSignal_NONE;
+  *rxSignal = ldmaPeripheralSignal_NONE;
+
+#if defined(USART0)
+  if (usart == USART0) {
+    *txSignal = ldmaPeripheralSignal_USART0_TXBL;
+    *rxSignal = ldmaPeripheralSignal_USART0_RXDATAV;
+    return;
+  }
+#endif
+#if defined(USART1)
+  if (usart == USART1) {
+    *txSignal = ldmaPeripheralSignal_USART1_TXBL;
+    *rxSignal = ldmaPeripheralSignal_USART1_RXDATAV;
+    return;
+  }
+#endif
+#if defined(USART2)
+  if (usart == USART2) {
+    *txSignal = ldmaPeripheralSignal_USART2_TXBL;
+    *rxSignal = ldmaPeripheralSignal_USART2_RXDATAV;
+    return;
+  }
+#endif
+#if defined(USART3)
+  if (usart == USART3) {
+    *txSignal = ldmaPeripheralSignal_USART3_TXBL;
+    *rxSignal = ldmaPeripheralSignal_USART3_RXDATAV;
+    return;
+  }
+#endif
+#if defined(USART4)
+  if (usart == USART4) {
+    *txSignal = ldmaPeripheralSignal_USART4_TXBL;
+    *rxSignal = ldmaPeripheralSignal_USART4_RXDATAV;
+    return;
+  }
+#endif
+#if defined(USART5)
+  if (usart == USART5) {
+    *txSignal = ldmaPeripheralSignal_USART5_TXBL;
+    *rxSignal = ldmaPeripheralSignal_USART5_RXDATAV;
+    return;
+  }
+#endif
+
+  EFM_ASSERT(false);
+}
+
+/* Set up the descriptors and start the LDMA channels of a transfer. Without
+   TX or RX data, the corresponding channel moves dummy frames. */
+static void usartTransferStart(USART_Transfer_TypeDef *transfer,
+                               const uint8_t *txData,
+                               uint8_t *rxData,
+                               bool tx,
+                               bool rx,
+                               size_t length,
+                               USART_TransferCallback_TypeDef callback,
+                               void *arg)
+{
+  LDMA_PeripheralSignal_t txSignal;
+  LDMA_PeripheralSignal_t rxSignal;
+
+  EFM_ASSERT(!transfer->busy);
+  EFM_ASSERT((length > 0U) && (length <= USART_TRANSFER_MAX_LENGTH));
+
+  usartLdmaSignals(transfer->usart, &txSignal, &rxSignal);
+
+  transfer->callback = callback;
+  transfer->arg = arg;
+  transfer->busy = true;
+
+  if (rx) {
+    LDMA_TransferCfg_t rxConfig = LDMA_TRANSFER_CFG_PERIPHERAL(rxSignal);
+    LDMA_Descriptor_t rxDescriptor =
+      LDMA_DESCRIPTOR_SINGLE_P2M_BYTE(&transfer->usart->RXDATA,
+                                      (rxData != NULL) ? rxData : &transfer->rxDummy,
+                                      length);
+
+    if (rxData == NULL) {
+      rxDescriptor.xfer.dstInc = ldmaCtrlDstIncNone;
+    }
+    transfer->rxDescriptor = rxDescriptor;
+    transfer->doneMask = 1UL << (uint8_t)transfer->rxChannel;
+
+    /* The RX channel must be running before the first frame is sent. */
+    LDMA_StartTransfer(transfer->rxChannel, &rxConfig, &transfer->rxDescriptor);
+  }
+
+  if (tx) {
+    LDMA_TransferCfg_t txConfig = LDMA_TRANSFER_CFG_PERIPHERAL(txSignal);
+    LDMA_Descriptor_t txDescriptor =
+      LDMA_DESCRIPTOR_SINGLE_M2P_BYTE((txData != NULL) ? txData : &transfer->txDummy,
+                                      &transfer->usart->TXDATA,
+                                      length);
+
+    if (txData == NULL) {
+      txDescriptor.xfer.srcInc = ldmaCtrlSrcIncNone;
+    }
+    if (rx) {
+      /* Completion is signalled by the RX channel. */
+      txDescriptor.xfer.doneIfs = 0;
+    } else {
+      transfer->doneMask = 1UL << (uint8_t)transfer->txChannel;
+    }
+    transfer->txDescriptor = txDescriptor;
+
+    LDMA_StartTransfer(transfer->txChannel, &txConfig, &transfer->txDescriptor);
+  }
+}
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Initialize an LDMA driven USART transfer.
+ *
+ * @note
+ *   LDMA_Init() must have been called. The application owns LDMA_IRQHandler()
+ *   and must call USART_TransferIrqHandler() from it.
+ *
+ * @param[out] transfer
+ *   The transfer to initialize.
+ *
+ * @param[in] usart
+ *   A pointer to the USART peripheral register block.
+ *
+ * @param[in] txChannel
+ *   LDMA channel used for transmitting.
+ *
+ * @param[in] rxChannel
+ *   LDMA channel used for receiving.
+ ******************************************************************************/
+void USART_TransferInit(USART_Transfer_TypeDef *transfer,
+                        USART_TypeDef *usart,
+                        int txChannel,
+                        int rxChannel)
+{
+  EFM_ASSERT(txChannel != rxChannel);
+
+  transfer->usart = usart;
+  transfer->txChannel = txChannel;
+  transfer->rxChannel = rxChannel;
+  transfer->doneMask = 0;
+  transfer->callback = NULL;
+  transfer->arg = NULL;
+  transfer->busy = false;
+  transfer->txDummy = USART_SPI_DUMMY_FRAME;
+  transfer->rxDummy = 0;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Start transmitting a buffer of frames using LDMA.
+ *
+ * @details
+ *   The callback is called from USART_TransferIrqHandler() once the last
+ *   frame has been written to the TX buffer.
+ *
+ * @param[in] transfer
+ *   The transfer to use.
+ *
+ * @param[in] data
+ *   Frames to transmit. Must stay valid until the transfer has completed.
+ *
+ * @param[in] length
+ *   Number of frames, at most USART_TRANSFER_MAX_LENGTH.
+ *
+ * @param[in] callback
+ *   Function to call on completion, or NULL.
+ *
+ * @param[in] arg
+ *   Argument passed to the callback.
+ ******************************************************************************/
+void USART_TxBufferAsync(USART_Transfer_TypeDef *transfer,
+                         const uint8_t *data,
+                         size_t length,
+                         USART_TransferCallback_TypeDef callback,
+                         void *arg)
+{
+  EFM_ASSERT(data != NULL);
+
+  usartTransferStart(transfer, data, NULL, true, false, length, callback, arg);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Start receiving a buffer of frames using LDMA.
+ *
+ * @param[in] transfer
+ *   The transfer to use.
+ *
+ * @param[out] data
+ *   Buffer for the received frames. Must stay valid until the transfer has
+ *   completed.
+ *
+ * @param[in] length
+ *   Number of frames, at most USART_TRANSFER_MAX_LENGTH.
+ *
+ * @param[in] callback
+ *   Function to call on completion, or NULL.
+ *
+ * @param[in] arg
+ *   Argument passed to the callback.
+ ******************************************************************************/
+void USART_RxBufferAsync(USART_Transfer_TypeDef *transfer,
+                         uint8_t *data,
+                         size_t length,
+                         USART_TransferCallback_TypeDef callback,
+                         void *arg)
+{
+  EFM_ASSERT(data != NULL);
+
+  usartTransferStart(transfer, NULL, data, false, true, length, callback, arg);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Start a full-duplex SPI transfer of a buffer of frames using LDMA.
+ *
+ * @details
+ *   A paired RX and TX channel move the data, and the callback is called once
+ *   the last frame has been received.
+ *
+ * @note
+ *   The USART must be configured as SPI master, and the RX buffer should be
+ *   empty before the call.
+ *
+ * @param[in] transfer
+ *   The transfer to use.
+ *
+ * @param[in] txData
+ *   Frames to transmit, or NULL to transmit USART_SPI_DUMMY_FRAME.
+ *
+ * @param[out] rxData
+ *   Buffer for the received frames, or NULL to discard them.
+ *
+ * @param[in] length
+ *   Number of frames, at most USART_TRANSFER_MAX_LENGTH.
+ *
+ * @param[in] callback
+ *   Function to call on completion, or NULL.
+ *
+ * @param[in] arg
+ *   Argument passed to the callback.
+ ******************************************************************************/
+void USART_SpiTransferBufferAsync(USART_Transfer_TypeDef *transfer,
+                                  const uint8_t *txData,
+                                  uint8_t *rxData,
+                                  size_t length,
+                                  USART_TransferCallback_TypeDef callback,
+                                  void *arg)
+{
+  usartTransferStart(transfer, txData, rxData, true, true, length, callback, arg);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Handle the LDMA interrupt of a USART transfer.
+ *
+ * @details
+ *   Call this from LDMA_IRQHandler() with the pending and enabled interrupt
+ *   flags, as returned by LDMA_IntGetEnabled(). If the transfer has completed,
+ *   its flag is cleared and its callback is called.
+ *
+ * @param[in] transfer
+ *   The transfer to check.
+ *
+ * @param[in] pending
+ *   Pending LDMA interrupt flags.
+ *
+ * @return
+ *   True if the interrupt belonged to this transfer.
+ ******************************************************************************/
+bool USART_TransferIrqHandler(USART_Transfer_TypeDef *transfer,
+                              uint32_t pending)
+{
+  if (!transfer->busy || !(pending & transfer->doneMask)) {
+    return false;
+  }
+
+  LDMA_IntClear(transfer->doneMask);
+  transfer->busy = false;
+
+  if (transfer->callback != NULL) {
+    transfer->callback(transfer, transfer->arg);
+  }
+
+  return true;
+}
+#endif /* defined(LDMA_PRESENT) && (LDMA_COUNT == 1) */
+
 #endif /* defined(USART_COUNT) && (USART_COUNT > 0) */
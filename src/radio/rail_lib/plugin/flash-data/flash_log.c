@@ -0,0 +1,737 @@
+/***************************************************************************//**
+ * @file
+ * @brief Log-structured record store for the RAIL Flash Data plugin
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "rail_types.h"
+#include "rail.h"
+
+#include "flash_data_config.h"
+#include "flash_log.h"
+
+#include "em_msc.h"
+
+#if (FLASH_LOG_PAGE_COUNT < 2)
+#error "FLASH_LOG_PAGE_COUNT must be at least 2"
+#endif
+
+#if ((FLASH_LOG_WRITE_BUFFER_SIZE % 4) != 0) || (FLASH_LOG_WRITE_BUFFER_SIZE < 8)
+#error "FLASH_LOG_WRITE_BUFFER_SIZE must be a multiple of 4 and at least 8"
+#endif
+
+#if defined(FLASH_LOG_DMA_CHANNEL) && !(_SILICON_LABS_32B_SERIES > 0)
+#error "FLASH_LOG_DMA_CHANNEL needs MSC_WriteWordDma(), which Series 0 lacks"
+#endif
+
+#define FLASH_DEFAULT_VALUE 0xFFFFFFFFUL
+
+/**
+ * Flash layout of a page (with a uint32_t pointer pointing to the page):
+ * ptr[0] = (uint32_t)FLASH_LOG_PREFIX, written when the page is opened
+ * ptr[1] = page erase count, written right after the page is erased
+ * ptr[2] = page sequence number, written when the page is opened
+ * ptr[3] = first word of the first record
+ * ...
+ *
+ * Flash layout of a record (with a uint32_t pointer pointing to the record):
+ * ptr[0] = key | (length << 16)
+ * ptr[1] = first word of the record data
+ * ...
+ * ptr[n] = commit marker, (crc << 16) | FLASH_LOG_COMMIT_TAG
+ *
+ * The commit marker holds a CRC-16 over the record header and data and is
+ * written last, so a record interrupted by a power loss is never accepted.
+ * Deleted keys are recorded with a zero length record (a tombstone) so that
+ * older records for the key in other pages stay shadowed.
+ *
+ * Records are appended to the active page. When it is full, the least worn
+ * erased page is opened. One erased page is always kept in reserve; when only
+ * the reserve is left, the page holding the fewest live bytes has its live
+ * records copied to the active page and is erased. When erase counts drift
+ * more than FLASH_LOG_WEAR_THRESHOLD apart, the least worn page is collected
+ * instead so that rarely updated records do not pin it.
+ */
+#define FLASH_LOG_PAGE_HEADER_SIZE  (3UL * sizeof(uint32_t))
+#define FLASH_LOG_RECORD_OVERHEAD   (2UL * sizeof(uint32_t))
+#define FLASH_LOG_COMMIT_TAG        0xC0DEUL
+#define FLASH_LOG_NO_PAGE           0xFFFFFFFFUL
+#define FLASH_LOG_RECORD_SIZE(len)  (FLASH_LOG_RECORD_OVERHEAD \
+                                     + (((len) + 3UL) & ~3UL))
+#define FLASH_LOG_MAX_RECORD_LENGTH ((uint32_t)FLASH_DATA_PAGE_SIZE \
+                                     - FLASH_LOG_PAGE_HEADER_SIZE   \
+                                     - FLASH_LOG_RECORD_OVERHEAD)
+
+// Keys are stored in the low 16 bits of the record header.
+#if (FLASH_LOG_KEY_COUNT > 0xFFFF)
+#error "FLASH_LOG_KEY_COUNT must fit in 16 bits"
+#endif
+
+// Record lengths are stored in the high 16 bits of the record header.
+_Static_assert(FLASH_LOG_MAX_RECORD_LENGTH <= 0xFFFFUL,
+               "FLASH_DATA_PAGE_SIZE is too large for 16-bit record lengths");
+
+/**
+ * FLASH_LOG_BASE_ADDR: The base address in flash of the flash log region,
+ * aligned to a flash page.
+ */
+#ifndef FLASH_LOG_BASE_ADDR
+// Align this array to a flash page boundary. The pages do not start out
+// erased, so FL_Init() erases them the first time it runs. The array is
+// modified by the MSC behind the compiler's back, so it is only ever accessed
+// through volatile pointers.
+__ALIGNED(FLASH_DATA_PAGE_SIZE)
+const uint8_t flash_log_region[FLASH_LOG_PAGE_COUNT * FLASH_DATA_PAGE_SIZE] = { 0 };
+#define FLASH_LOG_BASE_ADDR (&flash_log_region[0])
+#endif
+
+typedef enum FL_PageState {
+  FL_PAGE_FREE,
+  FL_PAGE_USED,
+} FL_PageState_t;
+
+typedef struct FL_Page {
+  FL_PageState_t state;
+  uint32_t eraseCount;
+  uint32_t sequence;
+  uint32_t writeOffset;
+  uint32_t liveBytes;
+} FL_Page_t;
+
+static FL_Page_t flashLogPages[FLASH_LOG_PAGE_COUNT];
+static const volatile uint32_t *flashLogIndex[FLASH_LOG_KEY_COUNT];
+static uint32_t flashLogWriteBuffer[FLASH_LOG_WRITE_BUFFER_SIZE / 4];
+static uint32_t activePage = FLASH_LOG_NO_PAGE;
+static uint32_t nextSequence;
+static bool initialized = false;
+static FL_Stats_t flashLogStats;
+
+static volatile uint32_t *pageAddress(uint32_t page)
+{
+  return (volatile uint32_t *)((uint8_t *)FLASH_LOG_BASE_ADDR
+                               + (page * (uint32_t)FLASH_DATA_PAGE_SIZE));
+}
+
+static uint32_t pageOf(const volatile uint32_t *record)
+{
+  return (uint32_t)((const volatile uint8_t *)record
+                    - (const uint8_t *)FLASH_LOG_BASE_ADDR)
+         / (uint32_t)FLASH_DATA_PAGE_SIZE;
+}
+
+static uint16_t recordKey(const volatile uint32_t *record)
+{
+  return (uint16_t)(record[0] & 0xFFFFUL);
+}
+
+static uint32_t recordLength(const volatile uint32_t *record)
+{
+  return record[0] >> 16;
+}
+
+static uint16_t crc16(uint16_t crc, const volatile uint8_t *data, uint32_t len)
+{
+  // CRC-16-CCITT, polynomial 0x1021.
+  while (len--) {
+    crc ^= (uint16_t)(*data++) << 8;
+    for (int i = 0; i < 8; i++) {
+      crc = (crc & 0x8000U) ? (uint16_t)((crc << 1) ^ 0x1021U)
+                            : (uint16_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+static uint32_t recordCommit(uint32_t header, const volatile uint8_t *data)
+{
+  uint16_t crc = crc16(0xFFFFU, (const uint8_t *)&header, sizeof(header));
+  crc = crc16(crc, data, header >> 16);
+  return ((uint32_t)crc << 16) | FLASH_LOG_COMMIT_TAG;
+}
+
+static MSC_Status_TypeDef programWords(volatile uint32_t *address,
+                                       const uint32_t *data,
+                                       uint32_t numBytes)
+{
+  flashLogStats.bytesProgrammed += numBytes;
+#if defined(FLASH_LOG_DMA_CHANNEL)
+  MSC_Status_TypeDef status = MSC_WriteWordDma(FLASH_LOG_DMA_CHANNEL,
+                                               (uint32_t *)address, data,
+                                               numBytes);
+
+  // MSC_WriteWordDma() returns while the last word is still programmed
+  while ((MSC->STATUS & MSC_STATUS_BUSY) != 0UL) {
+  }
+  return status;
+#else
+  return MSC_WriteWord((uint32_t *)address, data, numBytes);
+#endif
+}
+
+static RAIL_Status_t erasePage(uint32_t page)
+{
+  FL_Page_t *info = &flashLogPages[page];
+  volatile uint32_t *address = pageAddress(page);
+
+  if (mscReturnOk != MSC_ErasePage((uint32_t *)address)) {
+    return RAIL_STATUS_INVALID_STATE;
+  }
+  flashLogStats.pageErases++;
+  info->eraseCount++;
+  info->state = FL_PAGE_FREE;
+  info->sequence = 0UL;
+  info->writeOffset = 0UL;
+  info->liveBytes = 0UL;
+  if (page == activePage) {
+    activePage = FLASH_LOG_NO_PAGE;
+  }
+  // Keep the erase count in flash while the page is erased, so wear is
+  // tracked across resets. The prefix word stays erased until the page is
+  // opened.
+  if (mscReturnOk != programWords(&address[1], &info->eraseCount,
+                                  sizeof(uint32_t))) {
+    return RAIL_STATUS_INVALID_STATE;
+  }
+  return RAIL_STATUS_NO_ERROR;
+}
+
+static RAIL_Status_t openPage(uint32_t page)
+{
+  FL_Page_t *info = &flashLogPages[page];
+  volatile uint32_t *address = pageAddress(page);
+  const uint32_t prefix = FLASH_LOG_PREFIX;
+
+  info->state = FL_PAGE_USED;
+  info->sequence = nextSequence++;
+  info->writeOffset = FLASH_LOG_PAGE_HEADER_SIZE;
+  info->liveBytes = 0UL;
+  activePage = page;
+  // The prefix is written last so that it marks a complete page header.
+  if ((mscReturnOk != programWords(&address[2], &info->sequence,
+                                   sizeof(uint32_t)))
+      || (mscReturnOk != programWords(&address[0], &prefix,
+                                      sizeof(uint32_t)))) {
+    // Never append to a page with a broken header.
+    info->writeOffset = (uint32_t)FLASH_DATA_PAGE_SIZE;
+    return RAIL_STATUS_INVALID_STATE;
+  }
+  return RAIL_STATUS_NO_ERROR;
+}
+
+static void indexUpdate(uint16_t key, const volatile uint32_t *record)
+{
+  const volatile uint32_t *previous = flashLogIndex[key];
+
+  if (NULL != previous) {
+    flashLogPages[pageOf(previous)].liveBytes
+      -= FLASH_LOG_RECORD_SIZE(recordLength(previous));
+  }
+  flashLogIndex[key] = record;
+  if (NULL != record) {
+    flashLogPages[pageOf(record)].liveBytes
+      += FLASH_LOG_RECORD_SIZE(recordLength(record));
+  }
+}
+
+static RAIL_Status_t appendRecord(uint16_t key,
+                                  const volatile uint8_t *data,
+                                  uint32_t len)
+{
+  FL_Page_t *info = &flashLogPages[activePage];
+  volatile uint32_t *record = pageAddress(activePage) + (info->writeOffset / 4);
+  volatile uint32_t *dst = record;
+  uint32_t header = (uint32_t)key | (len << 16);
+  uint32_t commit = recordCommit(header, data);
+  uint8_t *buffer = (uint8_t *)flashLogWriteBuffer;
+  uint32_t fill = sizeof(header);
+  uint32_t offset = 0UL;
+
+  // Claim the space before programming, so that a failed write is never
+  // programmed over.
+  info->writeOffset += FLASH_LOG_RECORD_SIZE(len);
+
+  // Batch the header and data through the RAM buffer. This also allows the
+  // data to come from flash when garbage collection copies a record.
+  flashLogWriteBuffer[0] = header;
+  while ((offset < len) || (fill > 0UL)) {
+    uint32_t chunk = len - offset;
+    if (chunk > sizeof(flashLogWriteBuffer) - fill) {
+      chunk = sizeof(flashLogWriteBuffer) - fill;
+    }
+    // Copy through the volatile pointer, the data may be in flash.
+    for (uint32_t i = 0UL; i < chunk; i++) {
+      buffer[fill++] = data[offset++];
+    }
+    if ((fill == sizeof(flashLogWriteBuffer)) || (offset == len)) {
+      uint32_t fillAligned = (fill + 3UL) & ~3UL;
+      memset(&buffer[fill], 0xFF, fillAligned - fill);
+      if (mscReturnOk != programWords(dst, flashLogWriteBuffer, fillAligned)) {
+        return RAIL_STATUS_INVALID_STATE;
+      }
+      dst += fillAligned / 4;
+      fill = 0UL;
+    }
+  }
+
+  // Commit the record.
+  if (mscReturnOk != programWords(dst, &commit, sizeof(commit))) {
+    return RAIL_STATUS_INVALID_STATE;
+  }
+  indexUpdate(key, record);
+  return RAIL_STATUS_NO_ERROR;
+}
+
+static uint32_t countFreePages(void)
+{
+  uint32_t count = 0UL;
+  for (uint32_t page = 0UL; page < FLASH_LOG_PAGE_COUNT; page++) {
+    if (FL_PAGE_FREE == flashLogPages[page].state) {
+      count++;
+    }
+  }
+  return count;
+}
+
+static uint32_t leastWornFreePage(void)
+{
+  uint32_t result = FLASH_LOG_NO_PAGE;
+  for (uint32_t page = 0UL; page < FLASH_LOG_PAGE_COUNT; page++) {
+    if ((FL_PAGE_FREE == flashLogPages[page].state)
+        && ((FLASH_LOG_NO_PAGE == result)
+            || (flashLogPages[page].eraseCount
+                < flashLogPages[result].eraseCount))) {
+      result = page;
+    }
+  }
+  return result;
+}
+
+static uint32_t oldestUsedPage(void)
+{
+  uint32_t result = FLASH_LOG_NO_PAGE;
+  for (uint32_t page = 0UL; page < FLASH_LOG_PAGE_COUNT; page++) {
+    if ((FL_PAGE_USED == flashLogPages[page].state)
+        && ((FLASH_LOG_NO_PAGE == result)
+            || (flashLogPages[page].sequence
+                < flashLogPages[result].sequence))) {
+      result = page;
+    }
+  }
+  return result;
+}
+
+static uint32_t pickWearVictim(void)
+{
+  uint32_t leastWorn = 0UL;
+  uint32_t maxErase = 0UL;
+
+  for (uint32_t page = 0UL; page < FLASH_LOG_PAGE_COUNT; page++) {
+    if (flashLogPages[page].eraseCount < flashLogPages[leastWorn].eraseCount) {
+      leastWorn = page;
+    }
+    if (flashLogPages[page].eraseCount > maxErase) {
+      maxErase = flashLogPages[page].eraseCount;
+    }
+  }
+  // Static wear levelling: move records off the least worn page once it lags
+  // too far behind, even if it only holds live records.
+  if (((maxErase - flashLogPages[leastWorn].eraseCount)
+       > FLASH_LOG_WEAR_THRESHOLD)
+      && (FL_PAGE_USED == flashLogPages[leastWorn].state)
+      && (leastWorn != activePage)) {
+    return leastWorn;
+  }
+  return FLASH_LOG_NO_PAGE;
+}
+
+static uint32_t pickVictim(void)
+{
+  uint32_t victim = pickWearVictim();
+
+  if (FLASH_LOG_NO_PAGE != victim) {
+    return victim;
+  }
+  for (uint32_t page = 0UL; page < FLASH_LOG_PAGE_COUNT; page++) {
+    FL_Page_t *info = &flashLogPages[page];
+    if ((FL_PAGE_USED != info->state) || (page == activePage)) {
+      continue;
+    }
+    if ((FLASH_LOG_NO_PAGE == victim)
+        || (info->liveBytes < flashLogPages[victim].liveBytes)
+        || ((info->liveBytes == flashLogPages[victim].liveBytes)
+            && (info->eraseCount < flashLogPages[victim].eraseCount))) {
+      victim = page;
+    }
+  }
+  return victim;
+}
+
+static RAIL_Status_t collectPage(uint32_t victim)
+{
+  RAIL_Status_t status;
+  const volatile uint32_t *word = pageAddress(victim)
+                                 + (FLASH_LOG_PAGE_HEADER_SIZE / 4);
+  const volatile uint32_t *end = pageAddress(victim)
+                        + (flashLogPages[victim].writeOffset / 4);
+  // Tombstones only need to be kept while older pages may still hold
+  // records for their key.
+  bool dropTombstones = (oldestUsedPage() == victim);
+
+  while ((word < end) && (flashLogPages[victim].liveBytes > 0UL)) {
+    uint16_t key = recordKey(word);
+    uint32_t len = recordLength(word);
+    uint32_t size = FLASH_LOG_RECORD_SIZE(len);
+
+    if ((key < FLASH_LOG_KEY_COUNT) && (flashLogIndex[key] == word)) {
+      if ((0UL == len) && dropTombstones) {
+        indexUpdate(key, NULL);
+      } else {
+        if ((FLASH_LOG_NO_PAGE == activePage)
+            || (flashLogPages[activePage].writeOffset + size
+                > (uint32_t)FLASH_DATA_PAGE_SIZE)) {
+          uint32_t page = leastWornFreePage();
+          if (FLASH_LOG_NO_PAGE == page) {
+            return RAIL_STATUS_INVALID_STATE;
+          }
+          status = openPage(page);
+          if (RAIL_STATUS_NO_ERROR != status) {
+            return status;
+          }
+        }
+        status = appendRecord(key, (const volatile uint8_t *)&word[1], len);
+        if (RAIL_STATUS_NO_ERROR != status) {
+          return status;
+        }
+      }
+    }
+    word += size / 4;
+  }
+
+  flashLogStats.collections++;
+  return erasePage(victim);
+}
+
+static RAIL_Status_t reclaimEmptyPages(void)
+{
+  for (uint32_t page = 0UL; page < FLASH_LOG_PAGE_COUNT; page++) {
+    if ((FL_PAGE_USED == flashLogPages[page].state)
+        && (page != activePage)
+        && (0UL == flashLogPages[page].liveBytes)) {
+      RAIL_Status_t status = erasePage(page);
+      if (RAIL_STATUS_NO_ERROR != status) {
+        return status;
+      }
+    }
+  }
+  return RAIL_STATUS_NO_ERROR;
+}
+
+static RAIL_Status_t reserveSpace(uint32_t size)
+{
+  RAIL_Status_t status;
+  uint32_t victim;
+
+  // Each pass either opens a page or reclaims one, so the loop is bounded
+  // unless the log is full.
+  for (uint32_t attempt = 0UL; attempt < 2UL * FLASH_LOG_PAGE_COUNT; attempt++) {
+    status = RAIL_STATUS_NO_ERROR;
+    if (0UL == countFreePages()) {
+      // Power was lost while garbage collection was copying records into the
+      // reserve page. Finish collecting the victim into the active page to
+      // restore the reserve before appending anything else.
+      status = reclaimEmptyPages();
+      if ((RAIL_STATUS_NO_ERROR == status) && (0UL == countFreePages())) {
+        victim = pickVictim();
+        status = (FLASH_LOG_NO_PAGE == victim) ? RAIL_STATUS_INVALID_STATE
+                 : collectPage(victim);
+      }
+    } else if ((FLASH_LOG_NO_PAGE != activePage)
+               && (flashLogPages[activePage].writeOffset + size
+                   <= (uint32_t)FLASH_DATA_PAGE_SIZE)) {
+      return RAIL_STATUS_NO_ERROR;
+    } else {
+      status = reclaimEmptyPages();
+      if (RAIL_STATUS_NO_ERROR != status) {
+        return status;
+      }
+      victim = pickWearVictim();
+      if (FLASH_LOG_NO_PAGE != victim) {
+        status = collectPage(victim);
+      } else if (countFreePages() > 1UL) {
+        status = openPage(leastWornFreePage());
+      } else {
+        // Only the reserve page is left; garbage collection may open it.
+        victim = pickVictim();
+        if (FLASH_LOG_NO_PAGE == victim) {
+          // The active page is the only one in use; move it to the reserve.
+          victim = activePage;
+          activePage = FLASH_LOG_NO_PAGE;
+        }
+        status = (FLASH_LOG_NO_PAGE == victim) ? RAIL_STATUS_INVALID_STATE
+                 : collectPage(victim);
+      }
+    }
+    if (RAIL_STATUS_NO_ERROR != status) {
+      return status;
+    }
+  }
+  return RAIL_STATUS_INVALID_STATE;
+}
+
+static RAIL_Status_t writeRecord(uint16_t key, const uint8_t *data, uint32_t len)
+{
+  RAIL_Status_t status;
+  uint32_t size = FLASH_LOG_RECORD_SIZE(len);
+  uint32_t liveTotal = 0UL;
+
+  // Refuse writes that cannot fit even after collecting every page, keeping
+  // one page in reserve.
+  for (uint32_t page = 0UL; page < FLASH_LOG_PAGE_COUNT; page++) {
+    liveTotal += flashLogPages[page].liveBytes;
+  }
+  if (NULL != flashLogIndex[key]) {
+    liveTotal -= FLASH_LOG_RECORD_SIZE(recordLength(flashLogIndex[key]));
+  }
+  if (liveTotal + size > (FLASH_LOG_PAGE_COUNT - 1UL)
+      * ((uint32_t)FLASH_DATA_PAGE_SIZE - FLASH_LOG_PAGE_HEADER_SIZE)) {
+    return RAIL_STATUS_INVALID_STATE;
+  }
+
+  MSC_Init();
+  status = reserveSpace(size);
+  if (RAIL_STATUS_NO_ERROR == status) {
+    status = appendRecord(key, data, len);
+  }
+  MSC_Deinit();
+
+  return status;
+}
+
+static bool pageIsErased(const volatile uint32_t *address)
+{
+  for (uint32_t i = 2UL; i < (uint32_t)FLASH_DATA_PAGE_SIZE / 4; i++) {
+    if (FLASH_DEFAULT_VALUE != address[i]) {
+      return false;
+    }
+  }
+  return FLASH_DEFAULT_VALUE == address[0];
+}
+
+static void scanPage(uint32_t page)
+{
+  FL_Page_t *info = &flashLogPages[page];
+  const volatile uint32_t *base = pageAddress(page);
+  const volatile uint32_t *word = base + (FLASH_LOG_PAGE_HEADER_SIZE / 4);
+  const volatile uint32_t *end = base + ((uint32_t)FLASH_DATA_PAGE_SIZE / 4);
+
+  while ((word < end) && (FLASH_DEFAULT_VALUE != *word)) {
+    uint16_t key = recordKey(word);
+    uint32_t len = recordLength(word);
+    uint32_t size = FLASH_LOG_RECORD_SIZE(len);
+
+    if ((key >= FLASH_LOG_KEY_COUNT)
+        || (size > (uint32_t)(end - word) * sizeof(uint32_t))) {
+      // A damaged record header; the rest of the page cannot be parsed, so
+      // close the page for writing.
+      word = end;
+      break;
+    }
+    if (word[(size / 4) - 1UL] == recordCommit(word[0],
+                                               (const volatile uint8_t *)&word[1])) {
+      indexUpdate(key, word);
+    }
+    word += size / 4;
+  }
+  info->writeOffset = (uint32_t)(word - base) * sizeof(uint32_t);
+}
+
+RAIL_Status_t FL_Init(void)
+{
+  RAIL_Status_t status = RAIL_STATUS_NO_ERROR;
+  uint32_t maxErase = 0UL;
+  bool dirty[FLASH_LOG_PAGE_COUNT];
+
+  memset(flashLogIndex, 0, sizeof(flashLogIndex));
+  memset(&flashLogStats, 0, sizeof(flashLogStats));
+  activePage = FLASH_LOG_NO_PAGE;
+  nextSequence = 0UL;
+
+  // Classify pages from their headers.
+  for (uint32_t page = 0UL; page < FLASH_LOG_PAGE_COUNT; page++) {
+    FL_Page_t *info = &flashLogPages[page];
+    const volatile uint32_t *address = pageAddress(page);
+
+    info->eraseCount = address[1];
+    info->sequence = 0UL;
+    info->writeOffset = 0UL;
+    info->liveBytes = 0UL;
+    dirty[page] = false;
+    if (FLASH_LOG_PREFIX == address[0]) {
+      info->state = FL_PAGE_USED;
+      info->sequence = address[2];
+      if (info->sequence >= nextSequence) {
+        nextSequence = info->sequence + 1UL;
+      }
+    } else {
+      info->state = FL_PAGE_FREE;
+      dirty[page] = !pageIsErased(address);
+    }
+    if ((FLASH_DEFAULT_VALUE != info->eraseCount)
+        && (info->eraseCount > maxErase)) {
+      maxErase = info->eraseCount;
+    }
+  }
+
+  // Replay used pages from oldest to newest, so that later records override
+  // earlier ones.
+  for (;;) {
+    uint32_t page = FLASH_LOG_NO_PAGE;
+    for (uint32_t i = 0UL; i < FLASH_LOG_PAGE_COUNT; i++) {
+      if ((FL_PAGE_USED == flashLogPages[i].state)
+          && (0UL == flashLogPages[i].writeOffset)
+          && ((FLASH_LOG_NO_PAGE == page)
+              || (flashLogPages[i].sequence < flashLogPages[page].sequence))) {
+        page = i;
+      }
+    }
+    if (FLASH_LOG_NO_PAGE == page) {
+      break;
+    }
+    scanPage(page);
+    activePage = page;
+  }
+
+  MSC_Init();
+  for (uint32_t page = 0UL; page < FLASH_LOG_PAGE_COUNT; page++) {
+    FL_Page_t *info = &flashLogPages[page];
+    // Pages which lost their erase count inherit the highest known one.
+    if (FLASH_DEFAULT_VALUE == info->eraseCount) {
+      info->eraseCount = maxErase;
+      if ((FL_PAGE_FREE == info->state) && !dirty[page]) {
+        // Record the estimate; the page only holds erased words.
+        if (mscReturnOk != programWords(&pageAddress(page)[1],
+                                        &info->eraseCount,
+                                        sizeof(uint32_t))) {
+          status = RAIL_STATUS_INVALID_STATE;
+        }
+      }
+    }
+    if (dirty[page] && (RAIL_STATUS_NO_ERROR == status)) {
+      status = erasePage(page);
+    }
+  }
+  MSC_Deinit();
+
+  initialized = (RAIL_STATUS_NO_ERROR == status);
+  return status;
+}
+
+RAIL_Status_t FL_Format(void)
+{
+  RAIL_Status_t status = RAIL_STATUS_NO_ERROR;
+
+  if (!initialized) {
+    return RAIL_STATUS_INVALID_CALL;
+  }
+  memset(flashLogIndex, 0, sizeof(flashLogIndex));
+  MSC_Init();
+  for (uint32_t page = 0UL; page < FLASH_LOG_PAGE_COUNT; page++) {
+    if ((RAIL_STATUS_NO_ERROR == status)
+        && !pageIsErased(pageAddress(page))) {
+      status = erasePage(page);
+    }
+  }
+  MSC_Deinit();
+  activePage = FLASH_LOG_NO_PAGE;
+  return status;
+}
+
+RAIL_Status_t FL_WriteRecord(uint16_t key, const uint8_t *data, uint32_t len)
+{
+  if ((key >= FLASH_LOG_KEY_COUNT) || (NULL == data)
+      || (0UL == len) || (len > FLASH_LOG_MAX_RECORD_LENGTH)) {
+    return RAIL_STATUS_INVALID_PARAMETER;
+  }
+  if (!initialized) {
+    return RAIL_STATUS_INVALID_CALL;
+  }
+  flashLogStats.bytesRequested += len;
+  return writeRecord(key, data, len);
+}
+
+RAIL_Status_t FL_ReadRecord(uint16_t key, uint8_t **data, uint32_t *len)
+{
+  const volatile uint32_t *record;
+
+  if ((key >= FLASH_LOG_KEY_COUNT) || (NULL == data)) {
+    return RAIL_STATUS_INVALID_PARAMETER;
+  }
+  if (!initialized) {
+    return RAIL_STATUS_INVALID_CALL;
+  }
+  record = flashLogIndex[key];
+  if ((NULL == record) || (0UL == recordLength(record))) {
+    return RAIL_STATUS_INVALID_CALL; // no record exists for the key
+  }
+  if (NULL != len) {
+    *len = recordLength(record);
+  }
+  *data = (uint8_t *)&record[1];
+  return RAIL_STATUS_NO_ERROR;
+}
+
+RAIL_Status_t FL_DeleteRecord(uint16_t key)
+{
+  if (key >= FLASH_LOG_KEY_COUNT) {
+    return RAIL_STATUS_INVALID_PARAMETER;
+  }
+  if (!initialized) {
+    return RAIL_STATUS_INVALID_CALL;
+  }
+  if ((NULL == flashLogIndex[key]) || (0UL == recordLength(flashLogIndex[key]))) {
+    return RAIL_STATUS_INVALID_CALL; // no record exists for the key
+  }
+  return writeRecord(key, NULL, 0UL);
+}
+
+RAIL_Status_t FL_Collect(void)
+{
+  RAIL_Status_t status;
+  uint32_t victim;
+
+  if (!initialized) {
+    return RAIL_STATUS_INVALID_CALL;
+  }
+  victim = pickVictim();
+  if (FLASH_LOG_NO_PAGE == victim) {
+    return RAIL_STATUS_INVALID_STATE;
+  }
+  MSC_Init();
+  status = collectPage(victim);
+  MSC_Deinit();
+  return status;
+}
+
+uint32_t FL_GetMaxRecordLength(void)
+{
+  return FLASH_LOG_MAX_RECORD_LENGTH;
+}
+
+void FL_GetStats(FL_Stats_t *stats)
+{
+  if (NULL == stats) {
+    return;
+  }
+  *stats = flashLogStats;
+  stats->minEraseCount = FLASH_DEFAULT_VALUE;
+  stats->maxEraseCount = 0UL;
+  for (uint32_t page = 0UL; page < FLASH_LOG_PAGE_COUNT; page++) {
+    if (flashLogPages[page].eraseCount < stats->minEraseCount) {
+      stats->minEraseCount = flashLogPages[page].eraseCount;
+    }
+    if (flashLogPages[page].eraseCount > stats->maxEraseCount) {
+      stats->maxEraseCount = flashLogPages[page].eraseCount;
+    }
+  }
+}
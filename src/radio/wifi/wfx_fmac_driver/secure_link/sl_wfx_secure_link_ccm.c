@@ -0,0 +1,441 @@
+/*
+ *  Software AES-CCM backend for the secure link host API
+ *
+ *  Implements sl_wfx_host_encode_secure_link_data() and
+ *  sl_wfx_host_decode_secure_link_data() with AES-128 in CCM mode (12 bytes
+ *  nonce, 16 bytes tag, no additional data). The AES key schedule is expanded
+ *  once per session key and the data is processed in place in the driver
+ *  buffer.
+ */
+
+#include "sl_wfx_secure_link_ccm.h"
+
+#if defined(SL_WFX_USE_SECURE_LINK) && defined(SL_WFX_USE_SECURE_LINK_CCM)
+
+#include <string.h>
+
+/******************************************************
+*                      Macros
+******************************************************/
+
+#define SL_WFX_CCM_ROTL8(x)  (((x) << 8) | ((x) >> 24))
+#define SL_WFX_CCM_ROTL16(x) (((x) << 16) | ((x) >> 16))
+#define SL_WFX_CCM_ROTL24(x) (((x) << 24) | ((x) >> 8))
+
+/******************************************************
+*                    Constants
+******************************************************/
+
+#define SL_WFX_CCM_BLOCK_SIZE   16
+#define SL_WFX_CCM_ROUND_COUNT  10
+/* Size of the length field: 15 - nonce size */
+#define SL_WFX_CCM_LENGTH_SIZE  (15 - SL_WFX_SECURE_LINK_NONCE_SIZE_BYTES)
+/* Flags of the B0 block: no additional data, tag size and length field size */
+#define SL_WFX_CCM_B0_FLAGS     ((((SL_WFX_SECURE_LINK_CCM_TAG_SIZE - 2) / 2) << 3) | (SL_WFX_CCM_LENGTH_SIZE - 1))
+/* Flags of the counter blocks: length field size only */
+#define SL_WFX_CCM_CTR_FLAGS    (SL_WFX_CCM_LENGTH_SIZE - 1)
+
+/* AES forward S-box */
+static const uint8_t sl_wfx_ccm_sbox[256] = {
+  0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+  0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+  0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+  0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+  0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+  0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+  0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+  0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+  0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+  0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+  0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+  0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+  0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+  0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+  0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+  0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16
+};
+
+/* AES forward table, the other three tables are byte rotations of this one */
+static const uint32_t sl_wfx_ccm_ft[256] = {
+  0xA56363C6, 0x847C7CF8, 0x997777EE, 0x8D7B7BF6, 0x0DF2F2FF, 0xBD6B6BD6, 0xB16F6FDE, 0x54C5C591,
+  0x50303060, 0x03010102, 0xA96767CE, 0x7D2B2B56, 0x19FEFEE7, 0x62D7D7B5, 0xE6ABAB4D, 0x9A7676EC,
+  0x45CACA8F, 0x9D82821F, 0x40C9C989, 0x877D7DFA, 0x15FAFAEF, 0xEB5959B2, 0xC947478E, 0x0BF0F0FB,
+  0xECADAD41, 0x67D4D4B3, 0xFDA2A25F, 0xEAAFAF45, 0xBF9C9C23, 0xF7A4A453, 0x967272E4, 0x5BC0C09B,
+  0xC2B7B775, 0x1CFDFDE1, 0xAE93933D, 0x6A26264C, 0x5A36366C, 0x413F3F7E, 0x02F7F7F5, 0x4FCCCC83,
+  0x5C343468, 0xF4A5A551, 0x34E5E5D1, 0x08F1F1F9, 0x937171E2, 0x73D8D8AB, 0x53313162, 0x3F15152A,
+  0x0C040408, 0x52C7C795, 0x65232346, 0x5EC3C39D, 0x28181830, 0xA1969637, 0x0F05050A, 0xB59A9A2F,
+  0x0907070E, 0x36121224, 0x9B80801B, 0x3DE2E2DF, 0x26EBEBCD, 0x6927274E, 0xCDB2B27F, 0x9F7575EA,
+  0x1B090912, 0x9E83831D, 0x742C2C58, 0x2E1A1A34, 0x2D1B1B36, 0xB26E6EDC, 0xEE5A5AB4, 0xFBA0A05B,
+  0xF65252A4, 0x4D3B3B76, 0x61D6D6B7, 0xCEB3B37D, 0x7B292952, 0x3EE3E3DD, 0x712F2F5E, 0x97848413,
+  0xF55353A6, 0x68D1D1B9, 0x00000000, 0x2CEDEDC1, 0x60202040, 0x1FFCFCE3, 0xC8B1B179, 0xED5B5BB6,
+  0xBE6A6AD4, 0x46CBCB8D, 0xD9BEBE67, 0x4B393972, 0xDE4A4A94, 0xD44C4C98, 0xE85858B0, 0x4ACFCF85,
+  0x6BD0D0BB, 0x2AEFEFC5, 0xE5AAAA4F, 0x16FBFBED, 0xC5434386, 0xD74D4D9A, 0x55333366, 0x94858511,
+  0xCF45458A, 0x10F9F9E9, 0x06020204, 0x817F7FFE, 0xF05050A0, 0x443C3C78, 0xBA9F9F25, 0xE3A8A84B,
+  0xF35151A2, 0xFEA3A35D, 0xC0404080, 0x8A8F8F05, 0xAD92923F, 0xBC9D9D21, 0x48383870, 0x04F5F5F1,
+  0xDFBCBC63, 0xC1B6B677, 0x75DADAAF, 0x63212142, 0x30101020, 0x1AFFFFE5, 0x0EF3F3FD, 0x6DD2D2BF,
+  0x4CCDCD81, 0x140C0C18, 0x35131326, 0x2FECECC3, 0xE15F5FBE, 0xA2979735, 0xCC444488, 0x3917172E,
+  0x57C4C493, 0xF2A7A755, 0x827E7EFC, 0x473D3D7A, 0xAC6464C8, 0xE75D5DBA, 0x2B191932, 0x957373E6,
+  0xA06060C0, 0x98818119, 0xD14F4F9E, 0x7FDCDCA3, 0x66222244, 0x7E2A2A54, 0xAB90903B, 0x8388880B,
+  0xCA46468C, 0x29EEEEC7, 0xD3B8B86B, 0x3C141428, 0x79DEDEA7, 0xE25E5EBC, 0x1D0B0B16, 0x76DBDBAD,
+  0x3BE0E0DB, 0x56323264, 0x4E3A3A74, 0x1E0A0A14, 0xDB494992, 0x0A06060C, 0x6C242448, 0xE45C5CB8,
+  0x5DC2C29F, 0x6ED3D3BD, 0xEFACAC43, 0xA66262C4, 0xA8919139, 0xA4959531, 0x37E4E4D3, 0x8B7979F2,
+  0x32E7E7D5, 0x43C8C88B, 0x5937376E, 0xB76D6DDA, 0x8C8D8D01, 0x64D5D5B1, 0xD24E4E9C, 0xE0A9A949,
+  0xB46C6CD8, 0xFA5656AC, 0x07F4F4F3, 0x25EAEACF, 0xAF6565CA, 0x8E7A7AF4, 0xE9AEAE47, 0x18080810,
+  0xD5BABA6F, 0x887878F0, 0x6F25254A, 0x722E2E5C, 0x241C1C38, 0xF1A6A657, 0xC7B4B473, 0x51C6C697,
+  0x23E8E8CB, 0x7CDDDDA1, 0x9C7474E8, 0x211F1F3E, 0xDD4B4B96, 0xDCBDBD61, 0x868B8B0D, 0x858A8A0F,
+  0x907070E0, 0x423E3E7C, 0xC4B5B571, 0xAA6666CC, 0xD8484890, 0x05030306, 0x01F6F6F7, 0x120E0E1C,
+  0xA36161C2, 0x5F35356A, 0xF95757AE, 0xD0B9B969, 0x91868617, 0x58C1C199, 0x271D1D3A, 0xB99E9E27,
+  0x38E1E1D9, 0x13F8F8EB, 0xB398982B, 0x33111122, 0xBB6969D2, 0x70D9D9A9, 0x898E8E07, 0xA7949433,
+  0xB69B9B2D, 0x221E1E3C, 0x92878715, 0x20E9E9C9, 0x49CECE87, 0xFF5555AA, 0x78282850, 0x7ADFDFA5,
+  0x8F8C8C03, 0xF8A1A159, 0x80898909, 0x170D0D1A, 0xDABFBF65, 0x31E6E6D7, 0xC6424284, 0xB86868D0,
+  0xC3414182, 0xB0999929, 0x772D2D5A, 0x110F0F1E, 0xCBB0B07B, 0xFC5454A8, 0xD6BBBB6D, 0x3A16162C
+};
+
+static const uint8_t sl_wfx_ccm_rcon[SL_WFX_CCM_ROUND_COUNT] = {
+  0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36
+};
+
+/******************************************************
+*                    Structures
+******************************************************/
+
+typedef struct {
+  uint8_t  key[SL_WFX_SECURE_LINK_SESSION_KEY_LENGTH];
+  uint32_t round_keys[4 * (SL_WFX_CCM_ROUND_COUNT + 1)];
+  uint8_t  valid;
+} sl_wfx_ccm_key_schedule_t;
+
+/******************************************************
+*               Function Declarations
+******************************************************/
+
+static uint32_t sl_wfx_ccm_load_32(const uint8_t *buffer);
+static void sl_wfx_ccm_store_32(uint8_t *buffer, uint32_t value);
+static const uint32_t *sl_wfx_ccm_get_round_keys(const uint8_t *session_key);
+static void sl_wfx_ccm_encrypt_block(const uint32_t *round_keys, const uint8_t *input, uint8_t *output);
+static void sl_wfx_ccm_init(const uint32_t *round_keys,
+                            const uint8_t *nonce,
+                            uint32_t length,
+                            uint8_t *mac,
+                            uint8_t *counter);
+static void sl_wfx_ccm_increment_counter(uint8_t *counter);
+
+/******************************************************
+*               Variable Definitions
+******************************************************/
+
+extern sl_wfx_context_t *sl_wfx_context;
+
+static sl_wfx_ccm_key_schedule_t sl_wfx_ccm_key_schedule;
+
+/******************************************************
+*               Function Definitions
+******************************************************/
+
+/**************************************************************************//**
+ * @brief Expand the AES key schedule of a session key
+ *
+ * @param session_key is the 16 bytes session key
+ *
+ * @note Called when a new session key is negotiated so that the key schedule
+ * is ready before the first encrypted message. The encode and decode functions
+ * expand the schedule themselves if the session key changed.
+ *****************************************************************************/
+void sl_wfx_secure_link_ccm_set_key(const uint8_t *session_key)
+{
+  uint32_t *round_keys = sl_wfx_ccm_key_schedule.round_keys;
+  uint32_t temp;
+  uint8_t i;
+
+  for (i = 0; i < 4; i++) {
+    round_keys[i] = sl_wfx_ccm_load_32(session_key + 4 * i);
+  }
+
+  for (i = 0; i < SL_WFX_CCM_ROUND_COUNT; i++, round_keys += 4) {
+    temp = round_keys[3];
+    round_keys[4] = round_keys[0] ^ sl_wfx_ccm_rcon[i]
+                    ^ ((uint32_t)sl_wfx_ccm_sbox[(temp >> 8) & 0xFF])
+                    ^ ((uint32_t)sl_wfx_ccm_sbox[(temp >> 16) & 0xFF] << 8)
+                    ^ ((uint32_t)sl_wfx_ccm_sbox[(temp >> 24) & 0xFF] << 16)
+                    ^ ((uint32_t)sl_wfx_ccm_sbox[temp & 0xFF] << 24);
+    round_keys[5] = round_keys[1] ^ round_keys[4];
+    round_keys[6] = round_keys[2] ^ round_keys[5];
+    round_keys[7] = round_keys[3] ^ round_keys[6];
+  }
+
+  memcpy(sl_wfx_ccm_key_schedule.key, session_key, SL_WFX_SECURE_LINK_SESSION_KEY_LENGTH);
+  sl_wfx_ccm_key_schedule.valid = 1;
+}
+
+/**************************************************************************//**
+ * @brief Encrypt and authenticate data in place
+ *
+ * @param session_key is the 16 bytes session key
+ * @param nonce is the 12 bytes nonce
+ * @param data is the data to encrypt, overwritten with the encrypted data
+ * @param length is the length of the data
+ * @param tag is where the 16 bytes tag is written
+ * @returns Always returns SL_STATUS_OK
+ *
+ * @note tag may directly follow data in the same buffer
+ *****************************************************************************/
+sl_status_t sl_wfx_secure_link_ccm_encrypt(const uint8_t *session_key,
+                                           const uint8_t *nonce,
+                                           uint8_t *data,
+                                           uint32_t length,
+                                           uint8_t *tag)
+{
+  const uint32_t *round_keys = sl_wfx_ccm_get_round_keys(session_key);
+  uint8_t mac[SL_WFX_CCM_BLOCK_SIZE];
+  uint8_t counter[SL_WFX_CCM_BLOCK_SIZE];
+  uint8_t stream[SL_WFX_CCM_BLOCK_SIZE];
+  uint32_t block_length;
+  uint32_t i;
+
+  sl_wfx_ccm_init(round_keys, nonce, length, mac, counter);
+
+  while (length > 0) {
+    block_length = (length < SL_WFX_CCM_BLOCK_SIZE) ? length : SL_WFX_CCM_BLOCK_SIZE;
+
+    sl_wfx_ccm_increment_counter(counter);
+    sl_wfx_ccm_encrypt_block(round_keys, counter, stream);
+    for (i = 0; i < block_length; i++) {
+      mac[i] ^= data[i];
+      data[i] ^= stream[i];
+    }
+    sl_wfx_ccm_encrypt_block(round_keys, mac, mac);
+
+    data += block_length;
+    length -= block_length;
+  }
+
+  /* The tag is the CBC-MAC encrypted with the counter block 0 */
+  memset(&counter[SL_WFX_CCM_BLOCK_SIZE - SL_WFX_CCM_LENGTH_SIZE], 0, SL_WFX_CCM_LENGTH_SIZE);
+  sl_wfx_ccm_encrypt_block(round_keys, counter, stream);
+  for (i = 0; i < SL_WFX_SECURE_LINK_CCM_TAG_SIZE; i++) {
+    tag[i] = mac[i] ^ stream[i];
+  }
+
+  return SL_STATUS_OK;
+}
+
+/**************************************************************************//**
+ * @brief Decrypt and verify data in place
+ *
+ * @param session_key is the 16 bytes session key
+ * @param nonce is the 12 bytes nonce
+ * @param data is the data to decrypt, overwritten with the decrypted data
+ * @param length is the length of the data
+ * @param tag is the 16 bytes tag to verify
+ * @returns Returns SL_STATUS_OK if the tag matches, SL_STATUS_FAIL otherwise
+ *****************************************************************************/
+sl_status_t sl_wfx_secure_link_ccm_decrypt(const uint8_t *session_key,
+                                           const uint8_t *nonce,
+                                           uint8_t *data,
+                                           uint32_t length,
+                                           const uint8_t *tag)
+{
+  const uint32_t *round_keys = sl_wfx_ccm_get_round_keys(session_key);
+  uint8_t mac[SL_WFX_CCM_BLOCK_SIZE];
+  uint8_t counter[SL_WFX_CCM_BLOCK_SIZE];
+  uint8_t stream[SL_WFX_CCM_BLOCK_SIZE];
+  uint32_t block_length;
+  uint32_t i;
+  uint8_t diff = 0;
+
+  sl_wfx_ccm_init(round_keys, nonce, length, mac, counter);
+
+  while (length > 0) {
+    block_length = (length < SL_WFX_CCM_BLOCK_SIZE) ? length : SL_WFX_CCM_BLOCK_SIZE;
+
+    sl_wfx_ccm_increment_counter(counter);
+    sl_wfx_ccm_encrypt_block(round_keys, counter, stream);
+    for (i = 0; i < block_length; i++) {
+      data[i] ^= stream[i];
+      mac[i] ^= data[i];
+    }
+    sl_wfx_ccm_encrypt_block(round_keys, mac, mac);
+
+    data += block_length;
+    length -= block_length;
+  }
+
+  memset(&counter[SL_WFX_CCM_BLOCK_SIZE - SL_WFX_CCM_LENGTH_SIZE], 0, SL_WFX_CCM_LENGTH_SIZE);
+  sl_wfx_ccm_encrypt_block(round_keys, counter, stream);
+
+  /* Compare the whole tag to not leak the position of the first mismatch */
+  for (i = 0; i < SL_WFX_SECURE_LINK_CCM_TAG_SIZE; i++) {
+    diff |= tag[i] ^ mac[i] ^ stream[i];
+  }
+
+  return (diff == 0) ? SL_STATUS_OK : SL_STATUS_FAIL;
+}
+
+/**************************************************************************//**
+ * @brief Decode a packet
+ *
+ * @param buffer is the pointer to the encrypted part of the packet
+ * @param length is the length of the encrypted part
+ * @param session_key is the pointer to the context session key
+ * @returns Returns SL_STATUS_OK if successful, SL_STATUS_FAIL otherwise
+ *
+ * @note The tag follows the encrypted part. Only the RX counter is used in the
+ * nonce of the received packets.
+ *****************************************************************************/
+sl_status_t sl_wfx_host_decode_secure_link_data(uint8_t *buffer,
+                                                uint32_t length,
+                                                uint8_t *session_key)
+{
+  sl_wfx_nonce_t nonce = { 0, 0, 0 };
+
+  nonce.rx_packet_count = sl_wfx_context->secure_link_nonce.rx_packet_count;
+
+  return sl_wfx_secure_link_ccm_decrypt(session_key, (uint8_t *)&nonce, buffer, length, buffer + length);
+}
+
+/**************************************************************************//**
+ * @brief Encode a packet
+ *
+ * @param buffer is the pointer to the message that will be encrypted
+ * @param data_length is the length of the payload to be encrypted
+ * @param session_key is the pointer to context session key
+ * @param nonce is the pointer to the encryption nonce
+ * @returns Returns SL_STATUS_OK if successful, SL_STATUS_FAIL otherwise
+ *
+ * @note The message length stays in clear, the encryption starts at the
+ * message info field. The tag is written after the encrypted part.
+ *****************************************************************************/
+sl_status_t sl_wfx_host_encode_secure_link_data(sl_wfx_generic_message_t *buffer,
+                                                uint32_t data_length,
+                                                uint8_t *session_key,
+                                                uint8_t *nonce)
+{
+  uint8_t *data = (uint8_t *)&buffer->header.info;
+
+  return sl_wfx_secure_link_ccm_encrypt(session_key, nonce, data, data_length, data + data_length);
+}
+
+/******************************************************
+*               Static Functions
+******************************************************/
+
+static uint32_t sl_wfx_ccm_load_32(const uint8_t *buffer)
+{
+  return (uint32_t)buffer[0]
+         | ((uint32_t)buffer[1] << 8)
+         | ((uint32_t)buffer[2] << 16)
+         | ((uint32_t)buffer[3] << 24);
+}
+
+static void sl_wfx_ccm_store_32(uint8_t *buffer, uint32_t value)
+{
+  buffer[0] = (uint8_t)value;
+  buffer[1] = (uint8_t)(value >> 8);
+  buffer[2] = (uint8_t)(value >> 16);
+  buffer[3] = (uint8_t)(value >> 24);
+}
+
+static const uint32_t *sl_wfx_ccm_get_round_keys(const uint8_t *session_key)
+{
+  if (!sl_wfx_ccm_key_schedule.valid
+      || memcmp(sl_wfx_ccm_key_schedule.key, session_key, SL_WFX_SECURE_LINK_SESSION_KEY_LENGTH) != 0) {
+    sl_wfx_secure_link_ccm_set_key(session_key);
+  }
+
+  return sl_wfx_ccm_key_schedule.round_keys;
+}
+
+static void sl_wfx_ccm_encrypt_block(const uint32_t *round_keys, const uint8_t *input, uint8_t *output)
+{
+  uint32_t s0, s1, s2, s3;
+  uint32_t t0, t1, t2, t3;
+  uint8_t round;
+
+  s0 = sl_wfx_ccm_load_32(input) ^ round_keys[0];
+  s1 = sl_wfx_ccm_load_32(input + 4) ^ round_keys[1];
+  s2 = sl_wfx_ccm_load_32(input + 8) ^ round_keys[2];
+  s3 = sl_wfx_ccm_load_32(input + 12) ^ round_keys[3];
+
+  for (round = 1; round < SL_WFX_CCM_ROUND_COUNT; round++) {
+    round_keys += 4;
+    t0 = round_keys[0] ^ sl_wfx_ccm_ft[s0 & 0xFF]
+         ^ SL_WFX_CCM_ROTL8(sl_wfx_ccm_ft[(s1 >> 8) & 0xFF])
+         ^ SL_WFX_CCM_ROTL16(sl_wfx_ccm_ft[(s2 >> 16) & 0xFF])
+         ^ SL_WFX_CCM_ROTL24(sl_wfx_ccm_ft[s3 >> 24]);
+    t1 = round_keys[1] ^ sl_wfx_ccm_ft[s1 & 0xFF]
+         ^ SL_WFX_CCM_ROTL8(sl_wfx_ccm_ft[(s2 >> 8) & 0xFF])
+         ^ SL_WFX_CCM_ROTL16(sl_wfx_ccm_ft[(s3 >> 16) & 0xFF])
+         ^ SL_WFX_CCM_ROTL24(sl_wfx_ccm_ft[s0 >> 24]);
+    t2 = round_keys[2] ^ sl_wfx_ccm_ft[s2 & 0xFF]
+         ^ SL_WFX_CCM_ROTL8(sl_wfx_ccm_ft[(s3 >> 8) & 0xFF])
+         ^ SL_WFX_CCM_ROTL16(sl_wfx_ccm_ft[(s0 >> 16) & 0xFF])
+         ^ SL_WFX_CCM_ROTL24(sl_wfx_ccm_ft[s1 >> 24]);
+    t3 = round_keys[3] ^ sl_wfx_ccm_ft[s3 & 0xFF]
+         ^ SL_WFX_CCM_ROTL8(sl_wfx_ccm_ft[(s0 >> 8) & 0xFF])
+         ^ SL_WFX_CCM_ROTL16(sl_wfx_ccm_ft[(s1 >> 16) & 0xFF])
+         ^ SL_WFX_CCM_ROTL24(sl_wfx_ccm_ft[s2 >> 24]);
+    s0 = t0;
+    s1 = t1;
+    s2 = t2;
+    s3 = t3;
+  }
+
+  /* Last round has no MixColumns */
+  round_keys += 4;
+  t0 = round_keys[0] ^ (uint32_t)sl_wfx_ccm_sbox[s0 & 0xFF]
+       ^ ((uint32_t)sl_wfx_ccm_sbox[(s1 >> 8) & 0xFF] << 8)
+       ^ ((uint32_t)sl_wfx_ccm_sbox[(s2 >> 16) & 0xFF] << 16)
+       ^ ((uint32_t)sl_wfx_ccm_sbox[s3 >> 24] << 24);
+  t1 = round_keys[1] ^ (uint32_t)sl_wfx_ccm_sbox[s1 & 0xFF]
+       ^ ((uint32_t)sl_wfx_ccm_sbox[(s2 >> 8) & 0xFF] << 8)
+       ^ ((uint32_t)sl_wfx_ccm_sbox[(s3 >> 16) & 0xFF] << 16)
+       ^ ((uint32_t)sl_wfx_ccm_sbox[s0 >> 24] << 24);
+  t2 = round_keys[2] ^ (uint32_t)sl_wfx_ccm_sbox[s2 & 0xFF]
+       ^ ((uint32_t)sl_wfx_ccm_sbox[(s3 >> 8) & 0xFF] << 8)
+       ^ ((uint32_t)sl_wfx_ccm_sbox[(s0 >> 16) & 0xFF] << 16)
+       ^ ((uint32_t)sl_wfx_ccm_sbox[s1 >> 24] << 24);
+  t3 = round_keys[3] ^ (uint32_t)sl_wfx_ccm_sbox[s3 & 0xFF]
+       ^ ((uint32_t)sl_wfx_ccm_sbox[(s0 >> 8) & 0xFF] << 8)
+       ^ ((uint32_t)sl_wfx_ccm_sbox[(s1 >> 16) & 0xFF] << 16)
+       ^ ((uint32_t)sl_wfx_ccm_sbox[s2 >> 24] << 24);
+
+  sl_wfx_ccm_store_32(output, t0);
+  sl_wfx_ccm_store_32(output + 4, t1);
+  sl_wfx_ccm_store_32(output + 8, t2);
+  sl_wfx_ccm_store_32(output + 12, t3);
+}
+
+static void sl_wfx_ccm_init(const uint32_t *round_keys,
+                            const uint8_t *nonce,
+                            uint32_t length,
+                            uint8_t *mac,
+                            uint8_t *counter)
+{
+  uint8_t i;
+
+  /* B0 = flags | nonce | length, the CBC-MAC starts with E(B0) */
+  mac[0] = SL_WFX_CCM_B0_FLAGS;
+  memcpy(&mac[1], nonce, SL_WFX_SECURE_LINK_NONCE_SIZE_BYTES);
+  for (i = 0; i < SL_WFX_CCM_LENGTH_SIZE; i++) {
+    mac[SL_WFX_CCM_BLOCK_SIZE - 1 - i] = (uint8_t)(length >> (8 * i));
+  }
+  sl_wfx_ccm_encrypt_block(round_keys, mac, mac);
+
+  /* A0 = flags | nonce | 0 */
+  counter[0] = SL_WFX_CCM_CTR_FLAGS;
+  memcpy(&counter[1], nonce, SL_WFX_SECURE_LINK_NONCE_SIZE_BYTES);
+  memset(&counter[SL_WFX_CCM_BLOCK_SIZE - SL_WFX_CCM_LENGTH_SIZE], 0, SL_WFX_CCM_LENGTH_SIZE);
+}
+
+static void sl_wfx_ccm_increment_counter(uint8_t *counter)
+{
+  uint8_t i;
+
+  for (i = SL_WFX_CCM_BLOCK_SIZE - 1; i >= SL_WFX_CCM_BLOCK_SIZE - SL_WFX_CCM_LENGTH_SIZE; i--) {
+    if (++counter[i] != 0) {
+      break;
+    }
+  }
+}
+
+#endif //SL_WFX_USE_SECURE_LINK && SL_WFX_USE_SECURE_LINK_CCM
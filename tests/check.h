@@ -0,0 +1,34 @@
+/*
+ *  Checks shared by the host tests
+ *
+ *  CHECK() prints the condition that failed and counts it, the test goes on.
+ *  main() returns check_report(), which prints the summary and gives the
+ *  exit status.
+ */
+
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <stdio.h>
+
+#define CHECK(condition)                                                  \
+  do {                                                                    \
+    if (!(condition)) {                                                   \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition);         \
+      failures++;                                                         \
+    }                                                                     \
+  } while (0)
+
+static unsigned failures;
+
+static inline int check_report(void)
+{
+  if (failures != 0) {
+    printf("%u check(s) failed\n", failures);
+    return 1;
+  }
+  printf("all checks passed\n");
+  return 0;
+}
+
+#endif // CHECK_H
@@ -0,0 +1,452 @@
+/*
+ *  Micro-benchmarks of emlib functions against the register level device
+ *  model
+ *
+ *  Usage: bench_emlib [iterations]
+ *
+ *  The calculations run with trapping off: their register accesses, if any,
+ *  are plain memory accesses and the host time is the time of the code.
+ *  CMU_ClockFreqGet() and I2C_Transfer() also run trapped, to count their
+ *  register accesses and, for the transfer, the device time they take. The
+ *  same transfers then go through the I2C transaction queue, for the bus
+ *  time, throughput and idle gaps of back to back transactions. SPI bytes
+ *  go through USART_SpiTransfer() one at a time and through
+ *  USART_SpiTransferBuffer(), for the bus time per byte of each. SHA_Update()
+ *  and CRYPTO_SHA_Update() hash a message in chunks of several sizes, the
+ *  first for its host throughput, the second trapped, for its throughput in
+ *  device time.
+ *  Trapped host times are dominated by the two signals per access and are
+ *  not comparable with the untrapped ones.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sim.h"
+#include "em_cmu.h"
+#include "em_crypto.h"
+#include "em_i2c.h"
+#include "em_i2c_utils.h"
+#include "em_iadc.h"
+#include "em_sha_utils.h"
+#include "em_timer.h"
+#include "em_usart.h"
+#include "em_usart_utils.h"
+
+#define EEPROM_ADDRESS      0x50
+#define I2C_BYTES           16
+#define I2C_TICK_US         100U
+#define SPI_BYTES           16U
+#define SHA_MESSAGE_SIZE    1024U
+
+static unsigned long iterations = 1000000;
+static volatile uint32_t sink;
+
+static I2C_Queue_TypeDef      i2c_queue;
+static I2C_QueueEntry_TypeDef i2c_queue_entries[2];
+static volatile unsigned long i2c_queue_left;
+
+static double now_s(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static void report(const char *name, double seconds, unsigned long calls)
+{
+  printf("%-36s %10.1f ns/call\n", name, seconds * 1e9 / calls);
+}
+
+static void bench_usart_baudrate(void)
+{
+  static const USART_OVS_TypeDef ovs[4] = {
+    usartOVS16, usartOVS8, usartOVS6, usartOVS4
+  };
+  double start = now_s();
+
+  for (unsigned long i = 0; i < iterations; i++) {
+    sink += USART_BaudrateCalc(38000000, (uint32_t)(i & 0xFFFFF) << 3, false,
+                               ovs[i & 3]);
+  }
+  report("USART_BaudrateCalc", now_s() - start, iterations);
+}
+
+static void bench_cmu_clock_freq(void)
+{
+  static const CMU_Clock_TypeDef clocks[4] = {
+    cmuClock_HCLK, cmuClock_PCLK, cmuClock_USART0, cmuClock_TIMER0
+  };
+  unsigned long trapped = iterations / 100;
+  sim_stats_t   stats;
+  double        start = now_s();
+
+  for (unsigned long i = 0; i < iterations; i++) {
+    sink += CMU_ClockFreqGet(clocks[i & 3]);
+  }
+  report("CMU_ClockFreqGet", now_s() - start, iterations);
+
+  sim_trap_set(true);
+  sim_stats_clear();
+  start = now_s();
+  for (unsigned long i = 0; i < trapped; i++) {
+    sink += CMU_ClockFreqGet(clocks[i & 3]);
+  }
+  report("CMU_ClockFreqGet, trapped", now_s() - start, trapped);
+  sim_stats_get(&stats);
+  printf("%-36s %10.2f reads/call\n", "", (double)stats.reads / trapped);
+  sim_trap_set(false);
+}
+
+static void bench_iadc_timebase(void)
+{
+  double start = now_s();
+
+  for (unsigned long i = 0; i < iterations; i++) {
+    sink += IADC_calcTimebase(IADC0, 1000000U + (uint32_t)(i & 0xFFFF) * 1000U);
+  }
+  report("IADC_calcTimebase", now_s() - start, iterations);
+}
+
+/* An EEPROM block write and its read back */
+static void i2c_bench_sequences(I2C_TransferSeq_TypeDef seq[2])
+{
+  static uint8_t write[1 + I2C_BYTES];
+  static uint8_t read[I2C_BYTES];
+  static uint8_t pointer = 0;
+
+  for (unsigned i = 0; i < sizeof(write); i++) {
+    write[i] = (uint8_t)i;
+  }
+  seq[0].addr        = EEPROM_ADDRESS << 1;
+  seq[0].flags       = I2C_FLAG_WRITE;
+  seq[0].buf[0].data = write;
+  seq[0].buf[0].len  = sizeof(write);
+  seq[1].addr        = EEPROM_ADDRESS << 1;
+  seq[1].flags       = I2C_FLAG_WRITE_READ;
+  seq[1].buf[0].data = &pointer;
+  seq[1].buf[0].len  = 1;
+  seq[1].buf[1].data = read;
+  seq[1].buf[1].len  = sizeof(read);
+}
+
+/* Writes and reads back an EEPROM block, one I2C_TransferInit() and its
+   I2C_Transfer() polling loop per direction */
+static void bench_i2c_transfer(void)
+{
+  static sim_eeprom_t     eeprom;
+  I2C_Init_TypeDef        init      = I2C_INIT_DEFAULT;
+  unsigned long           transfers = iterations / 1000;
+  I2C_TransferSeq_TypeDef seq[2];
+  unsigned long           calls = 0;
+  sim_stats_t             stats;
+  uint64_t                sim_start;
+  double                  start;
+
+  i2c_bench_sequences(seq);
+  sim_trap_set(true);
+  sim_eeprom_init(&eeprom, EEPROM_ADDRESS);
+  sim_i2c_attach(I2C0, &eeprom.slave);
+  CMU_ClockEnable(cmuClock_I2C0, true);
+  I2C_Init(I2C0, &init);
+
+  sim_stats_clear();
+  sim_start = sim_time();
+  start     = now_s();
+  for (unsigned long i = 0; i < transfers; i++) {
+    I2C_TransferSeq_TypeDef   *s   = &seq[i & 1];
+    I2C_TransferReturn_TypeDef ret = I2C_TransferInit(I2C0, s);
+
+    while (ret == i2cTransferInProgress) {
+      ret = I2C_Transfer(I2C0);
+      calls++;
+    }
+    if (ret != i2cTransferDone) {
+      printf("I2C transfer failed: %d\n", ret);
+      exit(1);
+    }
+  }
+  report("I2C_Transfer, trapped", now_s() - start, calls);
+  sim_stats_get(&stats);
+  printf("%-36s %10.2f calls/transfer\n", "", (double)calls / transfers);
+  printf("%-36s %10.2f accesses/call\n", "",
+         (double)(stats.reads + stats.writes) / calls);
+  printf("%-36s %10.1f us/transfer of %u bytes on the bus\n", "",
+         (double)(sim_time() - sim_start) / 1000.0 / transfers, I2C_BYTES);
+
+  I2C_Reset(I2C0);
+  CMU_ClockEnable(cmuClock_I2C0, false);
+  sim_i2c_detach(I2C0, &eeprom.slave);
+  sim_trap_set(false);
+}
+
+void I2C0_IRQHandler(void)
+{
+  I2C_QueueIrqHandler(&i2c_queue);
+}
+
+void TIMER0_IRQHandler(void)
+{
+  TIMER_IntClear(TIMER0, TIMER_IntGet(TIMER0));
+  I2C_QueueTick(&i2c_queue);
+}
+
+/* Submits the sequence again until the benchmark has queued enough */
+static void i2c_queue_refill(I2C_TransferSeq_TypeDef *seq,
+                             I2C_TransferReturn_TypeDef result, void *arg)
+{
+  if (result != i2cTransferDone) {
+    printf("I2C queued transfer failed: %d\n", result);
+    exit(1);
+  }
+  if (i2c_queue_left > 0) {
+    i2c_queue_left--;
+    I2C_QueueSubmit(&i2c_queue, seq, i2c_queue_refill, NULL, 0);
+  }
+}
+
+/* The same transfers through the I2C transaction queue, kept two deep by the
+   completion callbacks, with TIMER0 ticking the queue */
+static void bench_i2c_queue(void)
+{
+  static sim_eeprom_t     eeprom;
+  I2C_Init_TypeDef        init      = I2C_INIT_DEFAULT;
+  TIMER_Init_TypeDef      timer     = TIMER_INIT_DEFAULT;
+  unsigned long           transfers = iterations / 1000;
+  I2C_TransferSeq_TypeDef seq[2];
+  I2C_QueueStats_TypeDef  stats;
+  sim_stats_t             accesses;
+  uint64_t                sim_start;
+  double                  sim_seconds;
+  double                  start;
+
+  i2c_bench_sequences(seq);
+  sim_trap_set(true);
+  sim_eeprom_init(&eeprom, EEPROM_ADDRESS);
+  sim_i2c_attach(I2C0, &eeprom.slave);
+  CMU_ClockEnable(cmuClock_I2C0, true);
+  I2C_QueueInit(&i2c_queue, I2C0, &init, i2c_queue_entries, 2);
+
+  timer.enable = false;
+  TIMER_Init(TIMER0, &timer);
+  TIMER_TopSet(TIMER0, CMU_ClockFreqGet(cmuClock_TIMER0) / (1000000U / I2C_TICK_US) - 1U);
+  TIMER_IntClear(TIMER0, _TIMER_IF_MASK);
+  TIMER_IntEnable(TIMER0, TIMER_IEN_OF);
+  NVIC_EnableIRQ(TIMER0_IRQn);
+  TIMER_Enable(TIMER0, true);
+
+  sim_stats_clear();
+  sim_start      = sim_time();
+  start          = now_s();
+  i2c_queue_left = transfers - 1;
+  I2C_QueueSubmit(&i2c_queue, &seq[0], i2c_queue_refill, NULL, 0);
+  if (i2c_queue_left > 0) {
+    i2c_queue_left--;
+    I2C_QueueSubmit(&i2c_queue, &seq[1], i2c_queue_refill, NULL, 0);
+  }
+  while (I2C_QueuePending(&i2c_queue) != 0) {
+    __WFI();
+  }
+  sim_seconds = (double)(sim_time() - sim_start) * 1e-9;
+  report("I2C_QueueIrqHandler, trapped", now_s() - start, sim_irq_count(I2C0_IRQn));
+  sim_stats_get(&accesses);
+  I2C_QueueGetStats(&i2c_queue, &stats);
+  printf("%-36s %10.2f calls/transfer\n", "",
+         (double)sim_irq_count(I2C0_IRQn) / transfers);
+  printf("%-36s %10.2f accesses/transfer, ticks included\n", "",
+         (double)(accesses.reads + accesses.writes) / transfers);
+  printf("%-36s %10.1f us/transfer of %u bytes on the bus\n", "",
+         sim_seconds * 1e6 / transfers, I2C_BYTES);
+  printf("%-36s %10.0f bytes/s, %.0f over busy ticks\n", "",
+         stats.bytes / sim_seconds,
+         stats.bytes / (stats.busyTicks * I2C_TICK_US * 1e-6));
+  printf("%-36s %10u idle gaps in %lu transfers\n", "",
+         (unsigned)stats.idleGaps, transfers);
+
+  TIMER_Enable(TIMER0, false);
+  NVIC_DisableIRQ(TIMER0_IRQn);
+  TIMER_Reset(TIMER0);
+  NVIC_DisableIRQ(I2C0_IRQn);
+  I2C_Reset(I2C0);
+  CMU_ClockEnable(cmuClock_I2C0, false);
+  sim_i2c_detach(I2C0, &eeprom.slave);
+  sim_trap_set(false);
+}
+
+/* Bus time per byte with USART0 as an SPI master looping its frames back,
+   one USART_SpiTransfer() per byte against USART_SpiTransferBuffer() */
+static void bench_usart_spi(void)
+{
+  static uint8_t         tx[SPI_BYTES];
+  static uint8_t         rx[SPI_BYTES];
+  USART_InitSync_TypeDef init   = USART_INITSYNC_DEFAULT;
+  unsigned long          rounds = iterations / 1000;
+  double                 bytes  = (double)rounds * SPI_BYTES;
+  sim_stats_t            stats;
+  uint64_t               sim_start;
+  double                 start;
+
+  for (unsigned i = 0; i < SPI_BYTES; i++) {
+    tx[i] = (uint8_t)i;
+  }
+  sim_trap_set(true);
+  init.baudrate = 8000000;
+  init.enable   = usartDisable;
+  USART_InitSync(USART0, &init);
+  USART0->CTRL_SET = USART_CTRL_LOOPBK;
+  USART_Enable(USART0, usartEnable);
+
+  sim_stats_clear();
+  sim_start = sim_time();
+  start     = now_s();
+  for (unsigned long r = 0; r < rounds; r++) {
+    for (unsigned i = 0; i < SPI_BYTES; i++) {
+      rx[i] = USART_SpiTransfer(USART0, tx[i]);
+    }
+  }
+  report("USART_SpiTransfer, trapped", now_s() - start, rounds * SPI_BYTES);
+  sim_stats_get(&stats);
+  printf("%-36s %10.2f accesses/byte\n", "",
+         (double)(stats.reads + stats.writes) / bytes);
+  printf("%-36s %10.1f ns/byte on the bus at %u bit/s\n", "",
+         (double)(sim_time() - sim_start) / bytes,
+         (unsigned)USART_BaudrateGet(USART0));
+
+  sim_stats_clear();
+  sim_start = sim_time();
+  start     = now_s();
+  for (unsigned long r = 0; r < rounds; r++) {
+    USART_SpiTransferBuffer(USART0, tx, rx, SPI_BYTES);
+  }
+  report("USART_SpiTransferBuffer, trapped", now_s() - start, rounds);
+  sim_stats_get(&stats);
+  printf("%-36s %10.2f accesses/byte\n", "",
+         (double)(stats.reads + stats.writes) / bytes);
+  printf("%-36s %10.1f ns/byte on the bus, %u bytes a call\n", "",
+         (double)(sim_time() - sim_start) / bytes, SPI_BYTES);
+
+  USART_Reset(USART0);
+  sim_trap_set(false);
+}
+
+/* Hashes bytes bytes of the message in chunks, in software */
+static double sha_soft(SHA_Mode_TypeDef mode, const uint8_t *message,
+                       uint32_t chunk, unsigned long bytes)
+{
+  SHA_Context_TypeDef ctx;
+  uint8_t             digest[SHA_SHA256_DIGEST_SIZE];
+  double              start = now_s();
+
+  SHA_Init(&ctx, mode);
+  for (unsigned long done = 0; done < bytes; done += chunk) {
+    SHA_Update(&ctx, message + done % SHA_MESSAGE_SIZE, chunk);
+  }
+  SHA_Final(&ctx, digest);
+  sink += digest[0];
+  return now_s() - start;
+}
+
+/* The same on the CRYPTO model, returning the device time */
+static double sha_crypto(CRYPTO_ShaMode_TypeDef mode, const uint8_t *message,
+                         uint32_t chunk, unsigned long bytes)
+{
+  CRYPTO_SHA_Context_TypeDef ctx;
+  uint8_t                    digest[CRYPTO_SHA256_DIGEST_SIZE_IN_BYTES];
+  uint64_t                   sim_start = sim_time();
+
+  CRYPTO_SHA_Init(&ctx, CRYPTO, mode);
+  for (unsigned long done = 0; done < bytes; done += chunk) {
+    CRYPTO_SHA_Update(&ctx, message + done % SHA_MESSAGE_SIZE, chunk);
+  }
+  CRYPTO_SHA_Final(&ctx, digest);
+  sink += digest[0];
+  return (double)(sim_time() - sim_start) * 1e-9;
+}
+
+/* SHA_Update() and CRYPTO_SHA_Update() over a message fed in chunks of
+   several sizes, the software hash with trapping off, the CRYPTO one
+   trapped for its device time and register accesses */
+static void bench_sha(void)
+{
+  static const uint32_t chunks[] = { 16, 64, 256, SHA_MESSAGE_SIZE };
+  static const struct {
+    const char            *name;
+    SHA_Mode_TypeDef       soft;
+    CRYPTO_ShaMode_TypeDef crypto;
+  } modes[] = {
+    { "SHA-1", shaModeSha1, cryptoShaSha1 },
+    { "SHA-256", shaModeSha256, cryptoShaSha256 },
+  };
+  static uint8_t message[SHA_MESSAGE_SIZE];
+  // Whole messages, for every chunk size to end on one
+  unsigned long  soft_bytes   = (iterations / 64 + 1) * SHA_MESSAGE_SIZE;
+  unsigned long  crypto_bytes = (iterations / 100000 + 1) * SHA_MESSAGE_SIZE;
+  char           name[40];
+  sim_stats_t    stats;
+
+  for (unsigned i = 0; i < SHA_MESSAGE_SIZE; i++) {
+    message[i] = (uint8_t)(i * 167U + 13U);
+  }
+  for (unsigned m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+    for (unsigned c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+      double seconds = sha_soft(modes[m].soft, message, chunks[c], soft_bytes);
+
+      snprintf(name, sizeof(name), "SHA_Update %s, %u B chunks",
+               modes[m].name, (unsigned)chunks[c]);
+      printf("%-36s %10.0f bytes/s\n", name, soft_bytes / seconds);
+    }
+  }
+
+  sim_trap_set(true);
+  CMU_ClockEnable(cmuClock_CRYPTOACC, true);
+  for (unsigned m = 0; m < sizeof(modes) / sizeof(modes[0]); m++) {
+    for (unsigned c = 0; c < sizeof(chunks) / sizeof(chunks[0]); c++) {
+      double seconds;
+
+      sim_stats_clear();
+      seconds = sha_crypto(modes[m].crypto, message, chunks[c], crypto_bytes);
+      sim_stats_get(&stats);
+      snprintf(name, sizeof(name), "CRYPTO_SHA_Update %s, %u B",
+               modes[m].name, (unsigned)chunks[c]);
+      printf("%-36s %10.0f bytes/s of device time\n", name,
+             crypto_bytes / seconds);
+      printf("%-36s %10.2f accesses/byte\n", "",
+             (double)(stats.reads + stats.writes) / crypto_bytes);
+    }
+  }
+  CMU_ClockEnable(cmuClock_CRYPTOACC, false);
+  sim_trap_set(false);
+}
+
+int main(int argc, char **argv)
+{
+  if (argc > 1) {
+    iterations = strtoul(argv[1], NULL, 0);
+  }
+  if (iterations < 1000) {
+    fprintf(stderr, "usage: %s [iterations, at least 1000]\n", argv[0]);
+    return 2;
+  }
+
+  sim_init();
+  CMU_ClockEnable(cmuClock_GPIO, true);
+  CMU_ClockEnable(cmuClock_USART0, true);
+  CMU_ClockEnable(cmuClock_TIMER0, true);
+  CMU_ClockEnable(cmuClock_IADC0, true);
+  CMU_HFRCODPLLBandSet(cmuHFRCODPLLFreq_38M0Hz);
+  CMU_ClockSelectSet(cmuClock_SYSCLK, cmuSelect_HFRCODPLL);
+  sim_time_limit_set(UINT64_MAX);
+  sim_trap_set(false);
+
+  bench_usart_baudrate();
+  bench_cmu_clock_freq();
+  bench_iadc_timebase();
+  bench_i2c_transfer();
+  bench_i2c_queue();
+  bench_usart_spi();
+  bench_sha();
+  return 0;
+}
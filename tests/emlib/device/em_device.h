@@ -0,0 +1,261 @@
+/*
+ *  Simulated EFR32 Series 2 device for the host builds of emlib
+ *
+ *  The device is modelled on an EFR32xG22 with 512 kB of flash and 32 kB of
+ *  RAM, plus a Series 1 CRYPTO block. The registers and bit fields are in
+ *  sim_regs.h; sim.c maps the peripherals at the addresses below and the
+ *  sim_*.c models implement their behaviour.
+ */
+
+#ifndef EM_DEVICE_H
+#define EM_DEVICE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Part identification */
+#define EFR32MG22C224F512IM40
+#define _SILICON_LABS_32B_SERIES_2
+#define _SILICON_LABS_32B_SERIES               2
+#define _SILICON_LABS_32B_SERIES_2_CONFIG_2
+#define _SILICON_LABS_32B_SERIES_2_CONFIG      2
+#define _SILICON_LABS_GECKO_INTERNAL_SDID      205
+#define _SILICON_LABS_GECKO_INTERNAL_SDID_205
+#define _SILICON_LABS_EFR32_RADIO_2G4HZ        2
+#define _SILICON_LABS_EFR32_RADIO_TYPE         _SILICON_LABS_EFR32_RADIO_2G4HZ
+#define _EFR32_MIGHTY_FAMILY                   1
+#define _EFR_DEVICE
+#define _SILICON_LABS_32B_PLATFORM_2
+#define _SILICON_LABS_32B_PLATFORM             2
+
+/* Interrupt numbers */
+typedef enum IRQn {
+  NonMaskableInt_IRQn    = -14,
+  HardFault_IRQn         = -13,
+  MemoryManagement_IRQn  = -12,
+  BusFault_IRQn          = -11,
+  UsageFault_IRQn        = -10,
+  SecureFault_IRQn       = -9,
+  SVCall_IRQn            = -5,
+  DebugMonitor_IRQn      = -4,
+  PendSV_IRQn            = -2,
+  SysTick_IRQn           = -1,
+
+  CRYPTO_IRQn            = 0,
+  EMU_IRQn               = 6,
+  TIMER0_IRQn            = 7,
+  TIMER1_IRQn            = 8,
+  TIMER2_IRQn            = 9,
+  TIMER3_IRQn            = 10,
+  TIMER4_IRQn            = 11,
+  USART0_RX_IRQn         = 13,
+  USART0_TX_IRQn         = 14,
+  USART1_RX_IRQn         = 15,
+  USART1_TX_IRQn         = 16,
+  SYSCFG_IRQn            = 20,
+  LDMA_IRQn              = 21,
+  LFXO_IRQn              = 22,
+  LFRCO_IRQn             = 23,
+  ULFRCO_IRQn            = 24,
+  GPIO_ODD_IRQn          = 25,
+  GPIO_EVEN_IRQn         = 26,
+  I2C0_IRQn              = 27,
+  I2C1_IRQn              = 28,
+  IADC_IRQn              = 35,
+  MSC_IRQn               = 36,
+  HFXO0_IRQn             = 37,
+  HFRCO0_IRQn            = 38,
+  CMU_IRQn               = 40,
+  FSRCO_IRQn             = 45,
+  DPLL0_IRQn             = 46,
+  EUART0_RX_IRQn         = 47,
+  EUART0_TX_IRQn         = 48,
+} IRQn_Type;
+
+#define EXT_IRQ_COUNT                          50
+
+#include "host_core.h"
+#include "system_sim.h"
+
+/* Memory map */
+#define FLASH_MEM_BASE                         (0x08000000UL)
+#define FLASH_MEM_SIZE                         (0x00080000UL)
+#define FLASH_BASE                             FLASH_MEM_BASE
+#define FLASH_SIZE                             FLASH_MEM_SIZE
+#define FLASH_PAGE_SIZE                        (0x00002000UL)
+#define MSC_FLASH_PAGE_SIZE                    FLASH_PAGE_SIZE
+#define SRAM_BASE                              (0x20000000UL)
+#define SRAM_SIZE                              (0x00008000UL)
+#define RAM_MEM_BASE                           SRAM_BASE
+#define RAM_MEM_SIZE                           SRAM_SIZE
+#define DEVINFO_BASE                           (0x0FE08000UL)
+
+#define PER_REG_BLOCK_SET_OFFSET               0x1000UL
+#define PER_REG_BLOCK_CLR_OFFSET               0x2000UL
+#define PER_REG_BLOCK_TOGGLE_OFFSET            0x3000UL
+
+/* Peripheral counts */
+#define CMU_PRESENT
+#define CMU_COUNT                              1
+#define EMU_PRESENT
+#define EMU_COUNT                              1
+#define HFXO_PRESENT
+#define HFXO_COUNT                             1
+#define HFRCO_PRESENT
+#define HFRCO_COUNT                            1
+#define FSRCO_PRESENT
+#define FSRCO_COUNT                            1
+#define DPLL_PRESENT
+#define DPLL_COUNT                             1
+#define LFXO_PRESENT
+#define LFXO_COUNT                             1
+#define LFRCO_PRESENT
+#define LFRCO_COUNT                            1
+#define ULFRCO_PRESENT
+#define ULFRCO_COUNT                           1
+#define MSC_PRESENT
+#define MSC_COUNT                              1
+#define GPIO_PRESENT
+#define GPIO_COUNT                             1
+#define LDMA_PRESENT
+#define LDMA_COUNT                             1
+#define LDMAXBAR_PRESENT
+#define LDMAXBAR_COUNT                         1
+#define TIMER_PRESENT
+#define TIMER_COUNT                            5
+#define USART_PRESENT
+#define USART_COUNT                            2
+#define EUART_PRESENT
+#define EUART_COUNT                            1
+#define I2C_PRESENT
+#define I2C_COUNT                              2
+#define IADC_PRESENT
+#define IADC_COUNT                             1
+#define SYSCFG_PRESENT
+#define SYSCFG_COUNT                           1
+#define CRYPTO_PRESENT
+#define CRYPTO_COUNT                           1
+#define PRS_PRESENT
+#define PRS_COUNT                              1
+
+/* Peripherals with SET, CLR and TGL register aliases */
+#define CMU_HAS_SET_CLEAR
+#define EMU_HAS_SET_CLEAR
+#define GPIO_HAS_SET_CLEAR
+#define I2C_HAS_SET_CLEAR
+#define IADC_HAS_SET_CLEAR
+#define LDMA_HAS_SET_CLEAR
+#define LDMAXBAR_HAS_SET_CLEAR
+#define MSC_HAS_SET_CLEAR
+#define PRS_HAS_SET_CLEAR
+#define SYSCFG_HAS_SET_CLEAR
+#define TIMER_HAS_SET_CLEAR
+#define USART_HAS_SET_CLEAR
+#define EUSART_HAS_SET_CLEAR
+
+/* Peripheral parameters */
+#define DMA_CHAN_COUNT                         8
+#define LDMA_CH_NUM                            8
+#define LDMA_CH_BITS                           0xFF
+#define TIMER_CC_COUNT                         3
+#define IADC0_CONFIGNUM                        2
+#define IADC0_ENTRIES                          16
+#define GPIO_PA_INDEX                          0
+#define GPIO_PA_COUNT                          9
+#define GPIO_PA_MASK                           0x01FFUL
+#define GPIO_PB_INDEX                          1
+#define GPIO_PB_COUNT                          5
+#define GPIO_PB_MASK                           0x001FUL
+#define GPIO_PC_INDEX                          2
+#define GPIO_PC_COUNT                          8
+#define GPIO_PC_MASK                           0x00FFUL
+#define GPIO_PD_INDEX                          3
+#define GPIO_PD_COUNT                          4
+#define GPIO_PD_MASK                           0x000FUL
+
+#include "sim_regs.h"
+
+/* Peripheral base addresses */
+#define EMU_BASE                               (0x40004000UL)
+#define CMU_BASE                               (0x40008000UL)
+#define HFXO0_BASE                             (0x4000C000UL)
+#define HFRCO0_BASE                            (0x40010000UL)
+#define FSRCO_BASE                             (0x40018000UL)
+#define DPLL0_BASE                             (0x4001C000UL)
+#define LFXO_BASE                              (0x40020000UL)
+#define LFRCO_BASE                             (0x40024000UL)
+#define ULFRCO_BASE                            (0x40028000UL)
+#define MSC_BASE                               (0x40030000UL)
+#define GPIO_BASE                              (0x4003C000UL)
+#define LDMA_BASE                              (0x40040000UL)
+#define LDMAXBAR_BASE                          (0x40044000UL)
+#define PRS_BASE                               (0x40038000UL)
+#define TIMER0_BASE                            (0x40048000UL)
+#define TIMER1_BASE                            (0x4004C000UL)
+#define TIMER2_BASE                            (0x40050000UL)
+#define TIMER3_BASE                            (0x40054000UL)
+#define TIMER4_BASE                            (0x40058000UL)
+#define USART0_BASE                            (0x4005C000UL)
+#define USART1_BASE                            (0x40060000UL)
+#define I2C1_BASE                              (0x40068000UL)
+#define SYSCFG_BASE                            (0x4007C000UL)
+#define CRYPTO0_BASE                           (0x400F0000UL)
+#define IADC0_BASE                             (0x4A004000UL)
+#define I2C0_BASE                              (0x4A010000UL)
+#define EUART0_BASE                            (0x4A040000UL)
+
+/* Peripheral declarations */
+#define EMU                                    ((EMU_TypeDef *)EMU_BASE)
+#define CMU                                    ((CMU_TypeDef *)CMU_BASE)
+#define HFXO0                                  ((HFXO_TypeDef *)HFXO0_BASE)
+#define HFRCO0                                 ((HFRCO_TypeDef *)HFRCO0_BASE)
+#define FSRCO                                  ((FSRCO_TypeDef *)FSRCO_BASE)
+#define DPLL0                                  ((DPLL_TypeDef *)DPLL0_BASE)
+#define LFXO                                   ((LFXO_TypeDef *)LFXO_BASE)
+#define LFRCO                                  ((LFRCO_TypeDef *)LFRCO_BASE)
+#define ULFRCO                                 ((ULFRCO_TypeDef *)ULFRCO_BASE)
+#define MSC                                    ((MSC_TypeDef *)MSC_BASE)
+#define GPIO                                   ((GPIO_TypeDef *)GPIO_BASE)
+#define LDMA                                   ((LDMA_TypeDef *)LDMA_BASE)
+#define LDMAXBAR                               ((LDMAXBAR_TypeDef *)LDMAXBAR_BASE)
+#define PRS                                    ((PRS_TypeDef *)PRS_BASE)
+#define TIMER0                                 ((TIMER_TypeDef *)TIMER0_BASE)
+#define TIMER1                                 ((TIMER_TypeDef *)TIMER1_BASE)
+#define TIMER2                                 ((TIMER_TypeDef *)TIMER2_BASE)
+#define TIMER3                                 ((TIMER_TypeDef *)TIMER3_BASE)
+#define TIMER4                                 ((TIMER_TypeDef *)TIMER4_BASE)
+#define USART0                                 ((USART_TypeDef *)USART0_BASE)
+#define USART1                                 ((USART_TypeDef *)USART1_BASE)
+#define I2C0                                   ((I2C_TypeDef *)I2C0_BASE)
+#define I2C1                                   ((I2C_TypeDef *)I2C1_BASE)
+#define SYSCFG                                 ((SYSCFG_TypeDef *)SYSCFG_BASE)
+#define CRYPTO0                                ((CRYPTO_TypeDef *)CRYPTO0_BASE)
+#define CRYPTO                                 CRYPTO0
+#define IADC0                                  ((IADC_TypeDef *)IADC0_BASE)
+#define EUART0                                 ((EUSART_TypeDef *)EUART0_BASE)
+#define DEVINFO                                ((DEVINFO_TypeDef *)DEVINFO_BASE)
+
+/* Instance numbering helpers */
+#define TIMER_NUM(ref)                         (((ref) == TIMER0) ? 0  \
+                                                : ((ref) == TIMER1) ? 1  \
+                                                : ((ref) == TIMER2) ? 2  \
+                                                : ((ref) == TIMER3) ? 3  \
+                                                : ((ref) == TIMER4) ? 4  \
+                                                : -1)
+#define USART_NUM(ref)                         (((ref) == USART0) ? 0  \
+                                                : ((ref) == USART1) ? 1  \
+                                                : -1)
+#define I2C_NUM(ref)                           (((ref) == I2C0) ? 0  \
+                                                : ((ref) == I2C1) ? 1  \
+                                                : -1)
+#define EUSART_NUM(ref)                        (((ref) == EUART0) ? 0 : -1)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // EM_DEVICE_H
@@ -0,0 +1,285 @@
+/*
+ *  Host replacement for the CMSIS Cortex-M33 core header, included by
+ *  em_device.h once IRQn_Type is defined
+ *
+ *  The system control space sits at its usual address and is modelled by
+ *  sim.c like the peripherals. PRIMASK and BASEPRI are variables, and the
+ *  points where a real core may take an interrupt (enabling interrupts,
+ *  lowering BASEPRI, WFI, enabling or pending an IRQ) call sim_irq_poll(),
+ *  which runs the pending handlers.
+ */
+
+#ifndef HOST_CORE_H
+#define HOST_CORE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __CM33_REV                0x0004U
+#define __NVIC_PRIO_BITS          3U
+#define __MPU_PRESENT             1U
+#define __FPU_PRESENT             1U
+#define __VTOR_PRESENT            1U
+
+#define __I                       volatile const
+#define __O                       volatile
+#define __IO                      volatile
+#define __IM                      volatile const
+#define __OM                      volatile
+#define __IOM                     volatile
+
+#define __ASM                     __asm
+#define __INLINE                  inline
+#define __STATIC_INLINE           static inline
+#define __STATIC_FORCEINLINE      static inline __attribute__((always_inline))
+#define __WEAK                    __attribute__((weak))
+#define __PACKED                  __attribute__((packed))
+#define __ALIGNED(x)              __attribute__((aligned(x)))
+#define __NO_RETURN               __attribute__((__noreturn__))
+#define __USED                    __attribute__((used))
+
+typedef struct {
+  __IOM uint32_t ISER[16];
+  uint32_t       RESERVED0[16];
+  __IOM uint32_t ICER[16];
+  uint32_t       RESERVED1[16];
+  __IOM uint32_t ISPR[16];
+  uint32_t       RESERVED2[16];
+  __IOM uint32_t ICPR[16];
+  uint32_t       RESERVED3[16];
+  __IOM uint32_t IABR[16];
+  uint32_t       RESERVED4[16];
+  __IOM uint32_t ITNS[16];
+  uint32_t       RESERVED5[16];
+  __IOM uint8_t  IPR[496];
+} NVIC_Type;
+
+typedef struct {
+  __IM  uint32_t CPUID;
+  __IOM uint32_t ICSR;
+  __IOM uint32_t VTOR;
+  __IOM uint32_t AIRCR;
+  __IOM uint32_t SCR;
+  __IOM uint32_t CCR;
+  __IOM uint8_t  SHPR[12];
+  __IOM uint32_t SHCSR;
+  __IOM uint32_t CFSR;
+  __IOM uint32_t HFSR;
+  __IOM uint32_t DFSR;
+  __IOM uint32_t MMFAR;
+  __IOM uint32_t BFAR;
+  __IOM uint32_t AFSR;
+  uint32_t       RESERVED0[18];
+  __IOM uint32_t CPACR;
+} SCB_Type;
+
+typedef struct {
+  __IOM uint32_t DHCSR;
+  __OM  uint32_t DCRSR;
+  __IOM uint32_t DCRDR;
+  __IOM uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+  __IOM uint32_t CTRL;
+  __IOM uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+  uint32_t primask;
+  uint32_t basepri;
+} sim_core_t;
+
+extern sim_core_t sim_core;
+
+#define SCS_BASE                  0xE000E000UL
+#define DWT_BASE                  0xE0001000UL
+#define NVIC_BASE                 (SCS_BASE + 0x0100UL)
+#define SCB_BASE                  (SCS_BASE + 0x0D00UL)
+#define CoreDebug_BASE            (SCS_BASE + 0x0DF0UL)
+
+#define NVIC                      ((NVIC_Type *)NVIC_BASE)
+#define SCB                       ((SCB_Type *)SCB_BASE)
+#define CoreDebug                 ((CoreDebug_Type *)CoreDebug_BASE)
+#define DWT                       ((DWT_Type *)DWT_BASE)
+
+#define SCB_ICSR_VECTACTIVE_Pos   0U
+#define SCB_ICSR_VECTACTIVE_Msk   (0x1FFUL << SCB_ICSR_VECTACTIVE_Pos)
+#define SCB_VTOR_TBLOFF_Pos       7U
+#define SCB_VTOR_TBLOFF_Msk       (0x1FFFFFFUL << SCB_VTOR_TBLOFF_Pos)
+#define SCB_SCR_SLEEPDEEP_Pos     2U
+#define SCB_SCR_SLEEPDEEP_Msk     (1UL << SCB_SCR_SLEEPDEEP_Pos)
+#define SCB_SCR_SLEEPONEXIT_Pos   1U
+#define SCB_SCR_SLEEPONEXIT_Msk   (1UL << SCB_SCR_SLEEPONEXIT_Pos)
+#define CoreDebug_DHCSR_C_DEBUGEN_Pos  0U
+#define CoreDebug_DHCSR_C_DEBUGEN_Msk  (1UL << CoreDebug_DHCSR_C_DEBUGEN_Pos)
+#define CoreDebug_DEMCR_TRCENA_Pos     24U
+#define CoreDebug_DEMCR_TRCENA_Msk     (1UL << CoreDebug_DEMCR_TRCENA_Pos)
+#define DWT_CTRL_CYCCNTENA_Pos    0U
+#define DWT_CTRL_CYCCNTENA_Msk    (1UL << DWT_CTRL_CYCCNTENA_Pos)
+
+/* Runs the handlers of the pending and enabled interrupts the current
+   PRIMASK and BASEPRI let through, see sim.c */
+void sim_irq_poll(void);
+/* Called by __WFI() and __WFE(), lets the models make progress */
+void sim_wait_for_event(void);
+
+/* Core register access */
+
+static inline uint32_t __get_PRIMASK(void)
+{
+  return sim_core.primask;
+}
+
+static inline void __set_PRIMASK(uint32_t primask)
+{
+  sim_core.primask = primask & 1U;
+  sim_irq_poll();
+}
+
+static inline void __disable_irq(void)
+{
+  sim_core.primask = 1U;
+}
+
+static inline void __enable_irq(void)
+{
+  sim_core.primask = 0U;
+  sim_irq_poll();
+}
+
+static inline uint32_t __get_BASEPRI(void)
+{
+  return sim_core.basepri;
+}
+
+static inline void __set_BASEPRI(uint32_t basepri)
+{
+  sim_core.basepri = basepri & 0xFFU;
+  sim_irq_poll();
+}
+
+static inline void __DSB(void)
+{
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline void __DMB(void)
+{
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline void __ISB(void)
+{
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+static inline void __NOP(void)
+{
+}
+
+static inline void __WFI(void)
+{
+  sim_wait_for_event();
+}
+
+static inline void __WFE(void)
+{
+  sim_wait_for_event();
+}
+
+static inline void __SEV(void)
+{
+}
+
+static inline uint32_t __REV(uint32_t value)
+{
+  return __builtin_bswap32(value);
+}
+
+static inline uint32_t __RBIT(uint32_t value)
+{
+  uint32_t result = 0;
+
+  for (int i = 0; i < 32; i++) {
+    result = (result << 1) | (value & 1U);
+    value >>= 1;
+  }
+  return result;
+}
+
+static inline uint8_t __CLZ(uint32_t value)
+{
+  return (value == 0U) ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+/* NVIC access */
+
+static inline void NVIC_EnableIRQ(IRQn_Type irq)
+{
+  if (irq >= 0) {
+    NVIC->ISER[irq >> 5] = 1UL << (irq & 0x1F);
+    sim_irq_poll();
+  }
+}
+
+static inline void NVIC_DisableIRQ(IRQn_Type irq)
+{
+  if (irq >= 0) {
+    NVIC->ICER[irq >> 5] = 1UL << (irq & 0x1F);
+  }
+}
+
+static inline uint32_t NVIC_GetEnableIRQ(IRQn_Type irq)
+{
+  return (irq >= 0) ? ((NVIC->ISER[irq >> 5] >> (irq & 0x1F)) & 1UL) : 0UL;
+}
+
+static inline void NVIC_SetPendingIRQ(IRQn_Type irq)
+{
+  if (irq >= 0) {
+    NVIC->ISPR[irq >> 5] = 1UL << (irq & 0x1F);
+    sim_irq_poll();
+  }
+}
+
+static inline void NVIC_ClearPendingIRQ(IRQn_Type irq)
+{
+  if (irq >= 0) {
+    NVIC->ICPR[irq >> 5] = 1UL << (irq & 0x1F);
+  }
+}
+
+static inline uint32_t NVIC_GetPendingIRQ(IRQn_Type irq)
+{
+  return (irq >= 0) ? ((NVIC->ISPR[irq >> 5] >> (irq & 0x1F)) & 1UL) : 0UL;
+}
+
+static inline void NVIC_SetPriority(IRQn_Type irq, uint32_t priority)
+{
+  if (irq >= 0) {
+    NVIC->IPR[irq] = (uint8_t)(priority << (8U - __NVIC_PRIO_BITS));
+  } else {
+    SCB->SHPR[(irq & 0xF) - 4] = (uint8_t)(priority << (8U - __NVIC_PRIO_BITS));
+  }
+}
+
+static inline uint32_t NVIC_GetPriority(IRQn_Type irq)
+{
+  if (irq >= 0) {
+    return NVIC->IPR[irq] >> (8U - __NVIC_PRIO_BITS);
+  }
+  return SCB->SHPR[(irq & 0xF) - 4] >> (8U - __NVIC_PRIO_BITS);
+}
+
+void __NVIC_SystemReset(void);
+#define NVIC_SystemReset          __NVIC_SystemReset
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_CORE_H
@@ -0,0 +1,6240 @@
+/*
+ *  Register and bit field definitions of the simulated device, included by
+ *  em_device.h
+ *
+ *  The registers and fields are the ones emlib uses. Where emlib computes
+ *  with a field (clock selects, prescalers, dividers, DMA descriptors, IADC
+ *  settings) its position and values follow the EFR32xG22 reference manual,
+ *  the other fields are packed in name order. Every peripheral but DEVINFO
+ *  has SET, CLR and TGL aliases of its registers at offsets 0x1000, 0x2000
+ *  and 0x3000.
+ */
+
+#ifndef SIM_REGS_H
+#define SIM_REGS_H
+
+/******************************************************************************
+ * CMU
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t CALCMD;
+  __IOM uint32_t CALCNT;
+  __IOM uint32_t CALCTRL;
+  __IOM uint32_t CLKEN0;
+  __IOM uint32_t CLKEN1;
+  __IOM uint32_t CRYPTOACCCLKCTRL;
+  __IOM uint32_t DPLLREFCLKCTRL;
+  __IOM uint32_t EM01GRPACLKCTRL;
+  __IOM uint32_t EM01GRPBCLKCTRL;
+  __IOM uint32_t EM23GRPACLKCTRL;
+  __IOM uint32_t EM4GRPACLKCTRL;
+  __IOM uint32_t EUART0CLKCTRL;
+  __IOM uint32_t EXPORTCLKCTRL;
+  __IOM uint32_t IADCCLKCTRL;
+  __IOM uint32_t IEN;
+  __IOM uint32_t IF;
+  __IOM uint32_t LOCK;
+  __IOM uint32_t RTCCCLKCTRL;
+  __IOM uint32_t STATUS;
+  __IOM uint32_t SYSCLKCTRL;
+  __IOM uint32_t WDOG0CLKCTRL;
+  __IOM uint32_t WDOGLOCK;
+  uint32_t RESERVED0[1002];
+  __IOM uint32_t CALCMD_SET;
+  __IOM uint32_t CALCNT_SET;
+  __IOM uint32_t CALCTRL_SET;
+  __IOM uint32_t CLKEN0_SET;
+  __IOM uint32_t CLKEN1_SET;
+  __IOM uint32_t CRYPTOACCCLKCTRL_SET;
+  __IOM uint32_t DPLLREFCLKCTRL_SET;
+  __IOM uint32_t EM01GRPACLKCTRL_SET;
+  __IOM uint32_t EM01GRPBCLKCTRL_SET;
+  __IOM uint32_t EM23GRPACLKCTRL_SET;
+  __IOM uint32_t EM4GRPACLKCTRL_SET;
+  __IOM uint32_t EUART0CLKCTRL_SET;
+  __IOM uint32_t EXPORTCLKCTRL_SET;
+  __IOM uint32_t IADCCLKCTRL_SET;
+  __IOM uint32_t IEN_SET;
+  __IOM uint32_t IF_SET;
+  __IOM uint32_t LOCK_SET;
+  __IOM uint32_t RTCCCLKCTRL_SET;
+  __IOM uint32_t STATUS_SET;
+  __IOM uint32_t SYSCLKCTRL_SET;
+  __IOM uint32_t WDOG0CLKCTRL_SET;
+  __IOM uint32_t WDOGLOCK_SET;
+  uint32_t RESERVED1[1002];
+  __IOM uint32_t CALCMD_CLR;
+  __IOM uint32_t CALCNT_CLR;
+  __IOM uint32_t CALCTRL_CLR;
+  __IOM uint32_t CLKEN0_CLR;
+  __IOM uint32_t CLKEN1_CLR;
+  __IOM uint32_t CRYPTOACCCLKCTRL_CLR;
+  __IOM uint32_t DPLLREFCLKCTRL_CLR;
+  __IOM uint32_t EM01GRPACLKCTRL_CLR;
+  __IOM uint32_t EM01GRPBCLKCTRL_CLR;
+  __IOM uint32_t EM23GRPACLKCTRL_CLR;
+  __IOM uint32_t EM4GRPACLKCTRL_CLR;
+  __IOM uint32_t EUART0CLKCTRL_CLR;
+  __IOM uint32_t EXPORTCLKCTRL_CLR;
+  __IOM uint32_t IADCCLKCTRL_CLR;
+  __IOM uint32_t IEN_CLR;
+  __IOM uint32_t IF_CLR;
+  __IOM uint32_t LOCK_CLR;
+  __IOM uint32_t RTCCCLKCTRL_CLR;
+  __IOM uint32_t STATUS_CLR;
+  __IOM uint32_t SYSCLKCTRL_CLR;
+  __IOM uint32_t WDOG0CLKCTRL_CLR;
+  __IOM uint32_t WDOGLOCK_CLR;
+  uint32_t RESERVED2[1002];
+  __IOM uint32_t CALCMD_TGL;
+  __IOM uint32_t CALCNT_TGL;
+  __IOM uint32_t CALCTRL_TGL;
+  __IOM uint32_t CLKEN0_TGL;
+  __IOM uint32_t CLKEN1_TGL;
+  __IOM uint32_t CRYPTOACCCLKCTRL_TGL;
+  __IOM uint32_t DPLLREFCLKCTRL_TGL;
+  __IOM uint32_t EM01GRPACLKCTRL_TGL;
+  __IOM uint32_t EM01GRPBCLKCTRL_TGL;
+  __IOM uint32_t EM23GRPACLKCTRL_TGL;
+  __IOM uint32_t EM4GRPACLKCTRL_TGL;
+  __IOM uint32_t EUART0CLKCTRL_TGL;
+  __IOM uint32_t EXPORTCLKCTRL_TGL;
+  __IOM uint32_t IADCCLKCTRL_TGL;
+  __IOM uint32_t IEN_TGL;
+  __IOM uint32_t IF_TGL;
+  __IOM uint32_t LOCK_TGL;
+  __IOM uint32_t RTCCCLKCTRL_TGL;
+  __IOM uint32_t STATUS_TGL;
+  __IOM uint32_t SYSCLKCTRL_TGL;
+  __IOM uint32_t WDOG0CLKCTRL_TGL;
+  __IOM uint32_t WDOGLOCK_TGL;
+  uint32_t RESERVED3[1002];
+} CMU_TypeDef;
+
+/* Bit fields for CMU CALCMD */
+#define _CMU_CALCMD_RESETVALUE                            0x00000000UL
+#define _CMU_CALCMD_MASK                                  0x00000003UL
+#define CMU_CALCMD_CALSTART                               (0x1UL << 0)
+#define _CMU_CALCMD_CALSTART_SHIFT                        0
+#define _CMU_CALCMD_CALSTART_MASK                         0x1UL
+#define _CMU_CALCMD_CALSTART_DEFAULT                      0x00000000UL
+#define CMU_CALCMD_CALSTART_DEFAULT                       (_CMU_CALCMD_CALSTART_DEFAULT << 0)
+#define CMU_CALCMD_CALSTOP                                (0x1UL << 1)
+#define _CMU_CALCMD_CALSTOP_SHIFT                         1
+#define _CMU_CALCMD_CALSTOP_MASK                          0x2UL
+#define _CMU_CALCMD_CALSTOP_DEFAULT                       0x00000000UL
+#define CMU_CALCMD_CALSTOP_DEFAULT                        (_CMU_CALCMD_CALSTOP_DEFAULT << 1)
+
+/* Bit fields for CMU CALCNT */
+#define _CMU_CALCNT_RESETVALUE                            0x00000000UL
+#define _CMU_CALCNT_MASK                                  0x00000000UL
+
+/* Bit fields for CMU CALCTRL */
+#define _CMU_CALCTRL_RESETVALUE                           0x00000000UL
+#define _CMU_CALCTRL_MASK                                 0xFF8FFFFFUL
+#define _CMU_CALCTRL_CALTOP_SHIFT                         0
+#define _CMU_CALCTRL_CALTOP_MASK                          0xFFFFFUL
+#define _CMU_CALCTRL_CALTOP_DEFAULT                       0x00000000UL
+#define CMU_CALCTRL_CALTOP_DEFAULT                        (_CMU_CALCTRL_CALTOP_DEFAULT << 0)
+#define CMU_CALCTRL_CONT                                  (0x1UL << 23)
+#define _CMU_CALCTRL_CONT_SHIFT                           23
+#define _CMU_CALCTRL_CONT_MASK                            0x800000UL
+#define _CMU_CALCTRL_CONT_DEFAULT                         0x00000000UL
+#define CMU_CALCTRL_CONT_DEFAULT                          (_CMU_CALCTRL_CONT_DEFAULT << 23)
+#define _CMU_CALCTRL_UPSEL_SHIFT                          24
+#define _CMU_CALCTRL_UPSEL_MASK                           0xF000000UL
+#define _CMU_CALCTRL_UPSEL_DEFAULT                        0x00000000UL
+#define CMU_CALCTRL_UPSEL_DEFAULT                         (_CMU_CALCTRL_UPSEL_DEFAULT << 24)
+#define _CMU_CALCTRL_UPSEL_HFXO                           0x00000001UL
+#define _CMU_CALCTRL_UPSEL_LFXO                           0x00000002UL
+#define _CMU_CALCTRL_UPSEL_HFRCODPLL                      0x00000003UL
+#define _CMU_CALCTRL_UPSEL_FSRCO                          0x00000004UL
+#define _CMU_CALCTRL_UPSEL_LFRCO                          0x00000005UL
+#define _CMU_CALCTRL_UPSEL_ULFRCO                         0x00000006UL
+#define _CMU_CALCTRL_UPSEL_PRS                            0x00000007UL
+#define CMU_CALCTRL_UPSEL_HFXO                            (_CMU_CALCTRL_UPSEL_HFXO << 24)
+#define CMU_CALCTRL_UPSEL_LFXO                            (_CMU_CALCTRL_UPSEL_LFXO << 24)
+#define CMU_CALCTRL_UPSEL_HFRCODPLL                       (_CMU_CALCTRL_UPSEL_HFRCODPLL << 24)
+#define CMU_CALCTRL_UPSEL_FSRCO                           (_CMU_CALCTRL_UPSEL_FSRCO << 24)
+#define CMU_CALCTRL_UPSEL_LFRCO                           (_CMU_CALCTRL_UPSEL_LFRCO << 24)
+#define CMU_CALCTRL_UPSEL_ULFRCO                          (_CMU_CALCTRL_UPSEL_ULFRCO << 24)
+#define CMU_CALCTRL_UPSEL_PRS                             (_CMU_CALCTRL_UPSEL_PRS << 24)
+#define _CMU_CALCTRL_DOWNSEL_SHIFT                        28
+#define _CMU_CALCTRL_DOWNSEL_MASK                         0xF0000000UL
+#define _CMU_CALCTRL_DOWNSEL_DEFAULT                      0x00000000UL
+#define CMU_CALCTRL_DOWNSEL_DEFAULT                       (_CMU_CALCTRL_DOWNSEL_DEFAULT << 28)
+#define _CMU_CALCTRL_DOWNSEL_HCLK                         0x00000001UL
+#define _CMU_CALCTRL_DOWNSEL_HFXO                         0x00000002UL
+#define _CMU_CALCTRL_DOWNSEL_LFXO                         0x00000003UL
+#define _CMU_CALCTRL_DOWNSEL_HFRCODPLL                    0x00000004UL
+#define _CMU_CALCTRL_DOWNSEL_FSRCO                        0x00000005UL
+#define _CMU_CALCTRL_DOWNSEL_LFRCO                        0x00000006UL
+#define _CMU_CALCTRL_DOWNSEL_ULFRCO                       0x00000007UL
+#define _CMU_CALCTRL_DOWNSEL_PRS                          0x00000008UL
+#define CMU_CALCTRL_DOWNSEL_HCLK                          (_CMU_CALCTRL_DOWNSEL_HCLK << 28)
+#define CMU_CALCTRL_DOWNSEL_HFXO                          (_CMU_CALCTRL_DOWNSEL_HFXO << 28)
+#define CMU_CALCTRL_DOWNSEL_LFXO                          (_CMU_CALCTRL_DOWNSEL_LFXO << 28)
+#define CMU_CALCTRL_DOWNSEL_HFRCODPLL                     (_CMU_CALCTRL_DOWNSEL_HFRCODPLL << 28)
+#define CMU_CALCTRL_DOWNSEL_FSRCO                         (_CMU_CALCTRL_DOWNSEL_FSRCO << 28)
+#define CMU_CALCTRL_DOWNSEL_LFRCO                         (_CMU_CALCTRL_DOWNSEL_LFRCO << 28)
+#define CMU_CALCTRL_DOWNSEL_ULFRCO                        (_CMU_CALCTRL_DOWNSEL_ULFRCO << 28)
+#define CMU_CALCTRL_DOWNSEL_PRS                           (_CMU_CALCTRL_DOWNSEL_PRS << 28)
+
+/* Bit fields for CMU CLKEN0 */
+#define _CMU_CLKEN0_RESETVALUE                            0x00000000UL
+#define _CMU_CLKEN0_MASK                                  0xFFFFFFFFUL
+#define CMU_CLKEN0_AMUXCP0                                (0x1UL << 0)
+#define _CMU_CLKEN0_AMUXCP0_SHIFT                         0
+#define _CMU_CLKEN0_AMUXCP0_MASK                          0x1UL
+#define _CMU_CLKEN0_AMUXCP0_DEFAULT                       0x00000000UL
+#define CMU_CLKEN0_AMUXCP0_DEFAULT                        (_CMU_CLKEN0_AMUXCP0_DEFAULT << 0)
+#define CMU_CLKEN0_BURAM                                  (0x1UL << 1)
+#define _CMU_CLKEN0_BURAM_SHIFT                           1
+#define _CMU_CLKEN0_BURAM_MASK                            0x2UL
+#define _CMU_CLKEN0_BURAM_DEFAULT                         0x00000000UL
+#define CMU_CLKEN0_BURAM_DEFAULT                          (_CMU_CLKEN0_BURAM_DEFAULT << 1)
+#define CMU_CLKEN0_BURTC                                  (0x1UL << 2)
+#define _CMU_CLKEN0_BURTC_SHIFT                           2
+#define _CMU_CLKEN0_BURTC_MASK                            0x4UL
+#define _CMU_CLKEN0_BURTC_DEFAULT                         0x00000000UL
+#define CMU_CLKEN0_BURTC_DEFAULT                          (_CMU_CLKEN0_BURTC_DEFAULT << 2)
+#define CMU_CLKEN0_DCDC                                   (0x1UL << 3)
+#define _CMU_CLKEN0_DCDC_SHIFT                            3
+#define _CMU_CLKEN0_DCDC_MASK                             0x8UL
+#define _CMU_CLKEN0_DCDC_DEFAULT                          0x00000000UL
+#define CMU_CLKEN0_DCDC_DEFAULT                           (_CMU_CLKEN0_DCDC_DEFAULT << 3)
+#define CMU_CLKEN0_DPLL0                                  (0x1UL << 4)
+#define _CMU_CLKEN0_DPLL0_SHIFT                           4
+#define _CMU_CLKEN0_DPLL0_MASK                            0x10UL
+#define _CMU_CLKEN0_DPLL0_DEFAULT                         0x00000000UL
+#define CMU_CLKEN0_DPLL0_DEFAULT                          (_CMU_CLKEN0_DPLL0_DEFAULT << 4)
+#define CMU_CLKEN0_EUART0                                 (0x1UL << 5)
+#define _CMU_CLKEN0_EUART0_SHIFT                          5
+#define _CMU_CLKEN0_EUART0_MASK                           0x20UL
+#define _CMU_CLKEN0_EUART0_DEFAULT                        0x00000000UL
+#define CMU_CLKEN0_EUART0_DEFAULT                         (_CMU_CLKEN0_EUART0_DEFAULT << 5)
+#define CMU_CLKEN0_FSRCO                                  (0x1UL << 6)
+#define _CMU_CLKEN0_FSRCO_SHIFT                           6
+#define _CMU_CLKEN0_FSRCO_MASK                            0x40UL
+#define _CMU_CLKEN0_FSRCO_DEFAULT                         0x00000000UL
+#define CMU_CLKEN0_FSRCO_DEFAULT                          (_CMU_CLKEN0_FSRCO_DEFAULT << 6)
+#define CMU_CLKEN0_GPCRC                                  (0x1UL << 7)
+#define _CMU_CLKEN0_GPCRC_SHIFT                           7
+#define _CMU_CLKEN0_GPCRC_MASK                            0x80UL
+#define _CMU_CLKEN0_GPCRC_DEFAULT                         0x00000000UL
+#define CMU_CLKEN0_GPCRC_DEFAULT                          (_CMU_CLKEN0_GPCRC_DEFAULT << 7)
+#define CMU_CLKEN0_GPIO                                   (0x1UL << 8)
+#define _CMU_CLKEN0_GPIO_SHIFT                            8
+#define _CMU_CLKEN0_GPIO_MASK                             0x100UL
+#define _CMU_CLKEN0_GPIO_DEFAULT                          0x00000000UL
+#define CMU_CLKEN0_GPIO_DEFAULT                           (_CMU_CLKEN0_GPIO_DEFAULT << 8)
+#define CMU_CLKEN0_HFRCO0                                 (0x1UL << 9)
+#define _CMU_CLKEN0_HFRCO0_SHIFT                          9
+#define _CMU_CLKEN0_HFRCO0_MASK                           0x200UL
+#define _CMU_CLKEN0_HFRCO0_DEFAULT                        0x00000000UL
+#define CMU_CLKEN0_HFRCO0_DEFAULT                         (_CMU_CLKEN0_HFRCO0_DEFAULT << 9)
+#define CMU_CLKEN0_HFXO0                                  (0x1UL << 10)
+#define _CMU_CLKEN0_HFXO0_SHIFT                           10
+#define _CMU_CLKEN0_HFXO0_MASK                            0x400UL
+#define _CMU_CLKEN0_HFXO0_DEFAULT                         0x00000000UL
+#define CMU_CLKEN0_HFXO0_DEFAULT                          (_CMU_CLKEN0_HFXO0_DEFAULT << 10)
+#define CMU_CLKEN0_I2C0                                   (0x1UL << 11)
+#define _CMU_CLKEN0_I2C0_SHIFT                            11
+#define _CMU_CLKEN0_I2C0_MASK                             0x800UL
+#define _CMU_CLKEN0_I2C0_DEFAULT                          0x00000000UL
+#define CMU_CLKEN0_I2C0_DEFAULT                           (_CMU_CLKEN0_I2C0_DEFAULT << 11)
+#define CMU_CLKEN0_I2C1                                   (0x1UL << 12)
+#define _CMU_CLKEN0_I2C1_SHIFT                            12
+#define _CMU_CLKEN0_I2C1_MASK                             0x1000UL
+#define _CMU_CLKEN0_I2C1_DEFAULT                          0x00000000UL
+#define CMU_CLKEN0_I2C1_DEFAULT                           (_CMU_CLKEN0_I2C1_DEFAULT << 12)
+#define CMU_CLKEN0_IADC0                                  (0x1UL << 13)
+#define _CMU_CLKEN0_IADC0_SHIFT                           13
+#define _CMU_CLKEN0_IADC0_MASK                            0x2000UL
+#define _CMU_CLKEN0_IADC0_DEFAULT                         0x00000000UL
+#define CMU_CLKEN0_IADC0_DEFAULT                          (_CMU_CLKEN0_IADC0_DEFAULT << 13)
+#define CMU_CLKEN0_LDMA                                   (0x1UL << 14)
+#define _CMU_CLKEN0_LDMA_SHIFT                            14
+#define _CMU_CLKEN0_LDMA_MASK                             0x4000UL
+#define _CMU_CLKEN0_LDMA_DEFAULT                          0x00000000UL
+#define CMU_CLKEN0_LDMA_DEFAULT                           (_CMU_CLKEN0_LDMA_DEFAULT << 14)
+#define CMU_CLKEN0_LDMAXBAR                               (0x1UL << 15)
+#define _CMU_CLKEN0_LDMAXBAR_SHIFT                        15
+#define _CMU_CLKEN0_LDMAXBAR_MASK                         0x8000UL
+#define _CMU_CLKEN0_LDMAXBAR_DEFAULT                      0x00000000UL
+#define CMU_CLKEN0_LDMAXBAR_DEFAULT                       (_CMU_CLKEN0_LDMAXBAR_DEFAULT << 15)
+#define CMU_CLKEN0_LETIMER0                               (0x1UL << 16)
+#define _CMU_CLKEN0_LETIMER0_SHIFT                        16
+#define _CMU_CLKEN0_LETIMER0_MASK                         0x10000UL
+#define _CMU_CLKEN0_LETIMER0_DEFAULT                      0x00000000UL
+#define CMU_CLKEN0_LETIMER0_DEFAULT                       (_CMU_CLKEN0_LETIMER0_DEFAULT << 16)
+#define CMU_CLKEN0_LFRCO                                  (0x1UL << 17)
+#define _CMU_CLKEN0_LFRCO_SHIFT                           17
+#define _CMU_CLKEN0_LFRCO_MASK                            0x20000UL
+#define _CMU_CLKEN0_LFRCO_DEFAULT                         0x00000000UL
+#define CMU_CLKEN0_LFRCO_DEFAULT                          (_CMU_CLKEN0_LFRCO_DEFAULT << 17)
+#define CMU_CLKEN0_LFXO                                   (0x1UL << 18)
+#define _CMU_CLKEN0_LFXO_SHIFT                            18
+#define _CMU_CLKEN0_LFXO_MASK                             0x40000UL
+#define _CMU_CLKEN0_LFXO_DEFAULT                          0x00000000UL
+#define CMU_CLKEN0_LFXO_DEFAULT                           (_CMU_CLKEN0_LFXO_DEFAULT << 18)
+#define CMU_CLKEN0_PDM                                    (0x1UL << 19)
+#define _CMU_CLKEN0_PDM_SHIFT                             19
+#define _CMU_CLKEN0_PDM_MASK                              0x80000UL
+#define _CMU_CLKEN0_PDM_DEFAULT                           0x00000000UL
+#define CMU_CLKEN0_PDM_DEFAULT                            (_CMU_CLKEN0_PDM_DEFAULT << 19)
+#define CMU_CLKEN0_PRS                                    (0x1UL << 20)
+#define _CMU_CLKEN0_PRS_SHIFT                             20
+#define _CMU_CLKEN0_PRS_MASK                              0x100000UL
+#define _CMU_CLKEN0_PRS_DEFAULT                           0x00000000UL
+#define CMU_CLKEN0_PRS_DEFAULT                            (_CMU_CLKEN0_PRS_DEFAULT << 20)
+#define CMU_CLKEN0_RADIOAES                               (0x1UL << 21)
+#define _CMU_CLKEN0_RADIOAES_SHIFT                        21
+#define _CMU_CLKEN0_RADIOAES_MASK                         0x200000UL
+#define _CMU_CLKEN0_RADIOAES_DEFAULT                      0x00000000UL
+#define CMU_CLKEN0_RADIOAES_DEFAULT                       (_CMU_CLKEN0_RADIOAES_DEFAULT << 21)
+#define CMU_CLKEN0_RTCC                                   (0x1UL << 22)
+#define _CMU_CLKEN0_RTCC_SHIFT                            22
+#define _CMU_CLKEN0_RTCC_MASK                             0x400000UL
+#define _CMU_CLKEN0_RTCC_DEFAULT                          0x00000000UL
+#define CMU_CLKEN0_RTCC_DEFAULT                           (_CMU_CLKEN0_RTCC_DEFAULT << 22)
+#define CMU_CLKEN0_SYSCFG                                 (0x1UL << 23)
+#define _CMU_CLKEN0_SYSCFG_SHIFT                          23
+#define _CMU_CLKEN0_SYSCFG_MASK                           0x800000UL
+#define _CMU_CLKEN0_SYSCFG_DEFAULT                        0x00000000UL
+#define CMU_CLKEN0_SYSCFG_DEFAULT                         (_CMU_CLKEN0_SYSCFG_DEFAULT << 23)
+#define CMU_CLKEN0_TIMER0                                 (0x1UL << 24)
+#define _CMU_CLKEN0_TIMER0_SHIFT                          24
+#define _CMU_CLKEN0_TIMER0_MASK                           0x1000000UL
+#define _CMU_CLKEN0_TIMER0_DEFAULT                        0x00000000UL
+#define CMU_CLKEN0_TIMER0_DEFAULT                         (_CMU_CLKEN0_TIMER0_DEFAULT << 24)
+#define CMU_CLKEN0_TIMER1                                 (0x1UL << 25)
+#define _CMU_CLKEN0_TIMER1_SHIFT                          25
+#define _CMU_CLKEN0_TIMER1_MASK                           0x2000000UL
+#define _CMU_CLKEN0_TIMER1_DEFAULT                        0x00000000UL
+#define CMU_CLKEN0_TIMER1_DEFAULT                         (_CMU_CLKEN0_TIMER1_DEFAULT << 25)
+#define CMU_CLKEN0_TIMER2                                 (0x1UL << 26)
+#define _CMU_CLKEN0_TIMER2_SHIFT                          26
+#define _CMU_CLKEN0_TIMER2_MASK                           0x4000000UL
+#define _CMU_CLKEN0_TIMER2_DEFAULT                        0x00000000UL
+#define CMU_CLKEN0_TIMER2_DEFAULT                         (_CMU_CLKEN0_TIMER2_DEFAULT << 26)
+#define CMU_CLKEN0_TIMER3                                 (0x1UL << 27)
+#define _CMU_CLKEN0_TIMER3_SHIFT                          27
+#define _CMU_CLKEN0_TIMER3_MASK                           0x8000000UL
+#define _CMU_CLKEN0_TIMER3_DEFAULT                        0x00000000UL
+#define CMU_CLKEN0_TIMER3_DEFAULT                         (_CMU_CLKEN0_TIMER3_DEFAULT << 27)
+#define CMU_CLKEN0_ULFRCO                                 (0x1UL << 28)
+#define _CMU_CLKEN0_ULFRCO_SHIFT                          28
+#define _CMU_CLKEN0_ULFRCO_MASK                           0x10000000UL
+#define _CMU_CLKEN0_ULFRCO_DEFAULT                        0x00000000UL
+#define CMU_CLKEN0_ULFRCO_DEFAULT                         (_CMU_CLKEN0_ULFRCO_DEFAULT << 28)
+#define CMU_CLKEN0_USART0                                 (0x1UL << 29)
+#define _CMU_CLKEN0_USART0_SHIFT                          29
+#define _CMU_CLKEN0_USART0_MASK                           0x20000000UL
+#define _CMU_CLKEN0_USART0_DEFAULT                        0x00000000UL
+#define CMU_CLKEN0_USART0_DEFAULT                         (_CMU_CLKEN0_USART0_DEFAULT << 29)
+#define CMU_CLKEN0_USART1                                 (0x1UL << 30)
+#define _CMU_CLKEN0_USART1_SHIFT                          30
+#define _CMU_CLKEN0_USART1_MASK                           0x40000000UL
+#define _CMU_CLKEN0_USART1_DEFAULT                        0x00000000UL
+#define CMU_CLKEN0_USART1_DEFAULT                         (_CMU_CLKEN0_USART1_DEFAULT << 30)
+#define CMU_CLKEN0_WDOG0                                  (0x1UL << 31)
+#define _CMU_CLKEN0_WDOG0_SHIFT                           31
+#define _CMU_CLKEN0_WDOG0_MASK                            0x80000000UL
+#define _CMU_CLKEN0_WDOG0_DEFAULT                         0x00000000UL
+#define CMU_CLKEN0_WDOG0_DEFAULT                          (_CMU_CLKEN0_WDOG0_DEFAULT << 31)
+
+/* Bit fields for CMU CLKEN1 */
+#define _CMU_CLKEN1_RESETVALUE                            0x00000000UL
+#define _CMU_CLKEN1_MASK                                  0x0000003FUL
+#define CMU_CLKEN1_CRYPTOACC                              (0x1UL << 0)
+#define _CMU_CLKEN1_CRYPTOACC_SHIFT                       0
+#define _CMU_CLKEN1_CRYPTOACC_MASK                        0x1UL
+#define _CMU_CLKEN1_CRYPTOACC_DEFAULT                     0x00000000UL
+#define CMU_CLKEN1_CRYPTOACC_DEFAULT                      (_CMU_CLKEN1_CRYPTOACC_DEFAULT << 0)
+#define CMU_CLKEN1_ICACHE0                                (0x1UL << 1)
+#define _CMU_CLKEN1_ICACHE0_SHIFT                         1
+#define _CMU_CLKEN1_ICACHE0_MASK                          0x2UL
+#define _CMU_CLKEN1_ICACHE0_DEFAULT                       0x00000000UL
+#define CMU_CLKEN1_ICACHE0_DEFAULT                        (_CMU_CLKEN1_ICACHE0_DEFAULT << 1)
+#define CMU_CLKEN1_IFADCDEBUG                             (0x1UL << 2)
+#define _CMU_CLKEN1_IFADCDEBUG_SHIFT                      2
+#define _CMU_CLKEN1_IFADCDEBUG_MASK                       0x4UL
+#define _CMU_CLKEN1_IFADCDEBUG_DEFAULT                    0x00000000UL
+#define CMU_CLKEN1_IFADCDEBUG_DEFAULT                     (_CMU_CLKEN1_IFADCDEBUG_DEFAULT << 2)
+#define CMU_CLKEN1_MSC                                    (0x1UL << 3)
+#define _CMU_CLKEN1_MSC_SHIFT                             3
+#define _CMU_CLKEN1_MSC_MASK                              0x8UL
+#define _CMU_CLKEN1_MSC_DEFAULT                           0x00000000UL
+#define CMU_CLKEN1_MSC_DEFAULT                            (_CMU_CLKEN1_MSC_DEFAULT << 3)
+#define CMU_CLKEN1_SMU                                    (0x1UL << 4)
+#define _CMU_CLKEN1_SMU_SHIFT                             4
+#define _CMU_CLKEN1_SMU_MASK                              0x10UL
+#define _CMU_CLKEN1_SMU_DEFAULT                           0x00000000UL
+#define CMU_CLKEN1_SMU_DEFAULT                            (_CMU_CLKEN1_SMU_DEFAULT << 4)
+#define CMU_CLKEN1_TIMER4                                 (0x1UL << 5)
+#define _CMU_CLKEN1_TIMER4_SHIFT                          5
+#define _CMU_CLKEN1_TIMER4_MASK                           0x20UL
+#define _CMU_CLKEN1_TIMER4_DEFAULT                        0x00000000UL
+#define CMU_CLKEN1_TIMER4_DEFAULT                         (_CMU_CLKEN1_TIMER4_DEFAULT << 5)
+
+/* Bit fields for CMU CRYPTOACCCLKCTRL */
+#define _CMU_CRYPTOACCCLKCTRL_RESETVALUE                  0x00000000UL
+#define _CMU_CRYPTOACCCLKCTRL_MASK                        0x00000003UL
+#define CMU_CRYPTOACCCLKCTRL_AESEN                        (0x1UL << 0)
+#define _CMU_CRYPTOACCCLKCTRL_AESEN_SHIFT                 0
+#define _CMU_CRYPTOACCCLKCTRL_AESEN_MASK                  0x1UL
+#define _CMU_CRYPTOACCCLKCTRL_AESEN_DEFAULT               0x00000000UL
+#define CMU_CRYPTOACCCLKCTRL_AESEN_DEFAULT                (_CMU_CRYPTOACCCLKCTRL_AESEN_DEFAULT << 0)
+#define CMU_CRYPTOACCCLKCTRL_PKEN                         (0x1UL << 1)
+#define _CMU_CRYPTOACCCLKCTRL_PKEN_SHIFT                  1
+#define _CMU_CRYPTOACCCLKCTRL_PKEN_MASK                   0x2UL
+#define _CMU_CRYPTOACCCLKCTRL_PKEN_DEFAULT                0x00000000UL
+#define CMU_CRYPTOACCCLKCTRL_PKEN_DEFAULT                 (_CMU_CRYPTOACCCLKCTRL_PKEN_DEFAULT << 1)
+
+/* Bit fields for CMU DPLLREFCLKCTRL */
+#define _CMU_DPLLREFCLKCTRL_RESETVALUE                    0x00000000UL
+#define _CMU_DPLLREFCLKCTRL_MASK                          0x00000003UL
+#define _CMU_DPLLREFCLKCTRL_CLKSEL_SHIFT                  0
+#define _CMU_DPLLREFCLKCTRL_CLKSEL_MASK                   0x3UL
+#define _CMU_DPLLREFCLKCTRL_CLKSEL_DEFAULT                0x00000000UL
+#define CMU_DPLLREFCLKCTRL_CLKSEL_DEFAULT                 (_CMU_DPLLREFCLKCTRL_CLKSEL_DEFAULT << 0)
+#define _CMU_DPLLREFCLKCTRL_CLKSEL_DISABLED               0x00000000UL
+#define _CMU_DPLLREFCLKCTRL_CLKSEL_HFXO                   0x00000001UL
+#define _CMU_DPLLREFCLKCTRL_CLKSEL_LFXO                   0x00000002UL
+#define _CMU_DPLLREFCLKCTRL_CLKSEL_CLKIN0                 0x00000003UL
+#define CMU_DPLLREFCLKCTRL_CLKSEL_DISABLED                (_CMU_DPLLREFCLKCTRL_CLKSEL_DISABLED << 0)
+#define CMU_DPLLREFCLKCTRL_CLKSEL_HFXO                    (_CMU_DPLLREFCLKCTRL_CLKSEL_HFXO << 0)
+#define CMU_DPLLREFCLKCTRL_CLKSEL_LFXO                    (_CMU_DPLLREFCLKCTRL_CLKSEL_LFXO << 0)
+#define CMU_DPLLREFCLKCTRL_CLKSEL_CLKIN0                  (_CMU_DPLLREFCLKCTRL_CLKSEL_CLKIN0 << 0)
+
+/* Bit fields for CMU EM01GRPACLKCTRL */
+#define _CMU_EM01GRPACLKCTRL_RESETVALUE                   0x00000001UL
+#define _CMU_EM01GRPACLKCTRL_MASK                         0x00000003UL
+#define _CMU_EM01GRPACLKCTRL_CLKSEL_SHIFT                 0
+#define _CMU_EM01GRPACLKCTRL_CLKSEL_MASK                  0x3UL
+#define _CMU_EM01GRPACLKCTRL_CLKSEL_DEFAULT               0x00000001UL
+#define CMU_EM01GRPACLKCTRL_CLKSEL_DEFAULT                (_CMU_EM01GRPACLKCTRL_CLKSEL_DEFAULT << 0)
+#define _CMU_EM01GRPACLKCTRL_CLKSEL_HFRCODPLL             0x00000001UL
+#define _CMU_EM01GRPACLKCTRL_CLKSEL_HFXO                  0x00000002UL
+#define _CMU_EM01GRPACLKCTRL_CLKSEL_FSRCO                 0x00000003UL
+#define CMU_EM01GRPACLKCTRL_CLKSEL_HFRCODPLL              (_CMU_EM01GRPACLKCTRL_CLKSEL_HFRCODPLL << 0)
+#define CMU_EM01GRPACLKCTRL_CLKSEL_HFXO                   (_CMU_EM01GRPACLKCTRL_CLKSEL_HFXO << 0)
+#define CMU_EM01GRPACLKCTRL_CLKSEL_FSRCO                  (_CMU_EM01GRPACLKCTRL_CLKSEL_FSRCO << 0)
+
+/* Bit fields for CMU EM01GRPBCLKCTRL */
+#define _CMU_EM01GRPBCLKCTRL_RESETVALUE                   0x00000001UL
+#define _CMU_EM01GRPBCLKCTRL_MASK                         0x00000007UL
+#define _CMU_EM01GRPBCLKCTRL_CLKSEL_SHIFT                 0
+#define _CMU_EM01GRPBCLKCTRL_CLKSEL_MASK                  0x7UL
+#define _CMU_EM01GRPBCLKCTRL_CLKSEL_DEFAULT               0x00000001UL
+#define CMU_EM01GRPBCLKCTRL_CLKSEL_DEFAULT                (_CMU_EM01GRPBCLKCTRL_CLKSEL_DEFAULT << 0)
+#define _CMU_EM01GRPBCLKCTRL_CLKSEL_HFRCODPLL             0x00000001UL
+#define _CMU_EM01GRPBCLKCTRL_CLKSEL_HFXO                  0x00000002UL
+#define _CMU_EM01GRPBCLKCTRL_CLKSEL_FSRCO                 0x00000003UL
+#define _CMU_EM01GRPBCLKCTRL_CLKSEL_CLKIN0                0x00000004UL
+#define _CMU_EM01GRPBCLKCTRL_CLKSEL_HFRCODPLLRT           0x00000005UL
+#define _CMU_EM01GRPBCLKCTRL_CLKSEL_HFXORT                0x00000006UL
+#define CMU_EM01GRPBCLKCTRL_CLKSEL_HFRCODPLL              (_CMU_EM01GRPBCLKCTRL_CLKSEL_HFRCODPLL << 0)
+#define CMU_EM01GRPBCLKCTRL_CLKSEL_HFXO                   (_CMU_EM01GRPBCLKCTRL_CLKSEL_HFXO << 0)
+#define CMU_EM01GRPBCLKCTRL_CLKSEL_FSRCO                  (_CMU_EM01GRPBCLKCTRL_CLKSEL_FSRCO << 0)
+#define CMU_EM01GRPBCLKCTRL_CLKSEL_CLKIN0                 (_CMU_EM01GRPBCLKCTRL_CLKSEL_CLKIN0 << 0)
+#define CMU_EM01GRPBCLKCTRL_CLKSEL_HFRCODPLLRT            (_CMU_EM01GRPBCLKCTRL_CLKSEL_HFRCODPLLRT << 0)
+#define CMU_EM01GRPBCLKCTRL_CLKSEL_HFXORT                 (_CMU_EM01GRPBCLKCTRL_CLKSEL_HFXORT << 0)
+
+/* Bit fields for CMU EM23GRPACLKCTRL */
+#define _CMU_EM23GRPACLKCTRL_RESETVALUE                   0x00000001UL
+#define _CMU_EM23GRPACLKCTRL_MASK                         0x00000003UL
+#define _CMU_EM23GRPACLKCTRL_CLKSEL_SHIFT                 0
+#define _CMU_EM23GRPACLKCTRL_CLKSEL_MASK                  0x3UL
+#define _CMU_EM23GRPACLKCTRL_CLKSEL_DEFAULT               0x00000001UL
+#define CMU_EM23GRPACLKCTRL_CLKSEL_DEFAULT                (_CMU_EM23GRPACLKCTRL_CLKSEL_DEFAULT << 0)
+#define _CMU_EM23GRPACLKCTRL_CLKSEL_LFRCO                 0x00000001UL
+#define _CMU_EM23GRPACLKCTRL_CLKSEL_LFXO                  0x00000002UL
+#define _CMU_EM23GRPACLKCTRL_CLKSEL_ULFRCO                0x00000003UL
+#define CMU_EM23GRPACLKCTRL_CLKSEL_LFRCO                  (_CMU_EM23GRPACLKCTRL_CLKSEL_LFRCO << 0)
+#define CMU_EM23GRPACLKCTRL_CLKSEL_LFXO                   (_CMU_EM23GRPACLKCTRL_CLKSEL_LFXO << 0)
+#define CMU_EM23GRPACLKCTRL_CLKSEL_ULFRCO                 (_CMU_EM23GRPACLKCTRL_CLKSEL_ULFRCO << 0)
+
+/* Bit fields for CMU EM4GRPACLKCTRL */
+#define _CMU_EM4GRPACLKCTRL_RESETVALUE                    0x00000001UL
+#define _CMU_EM4GRPACLKCTRL_MASK                          0x00000003UL
+#define _CMU_EM4GRPACLKCTRL_CLKSEL_SHIFT                  0
+#define _CMU_EM4GRPACLKCTRL_CLKSEL_MASK                   0x3UL
+#define _CMU_EM4GRPACLKCTRL_CLKSEL_DEFAULT                0x00000001UL
+#define CMU_EM4GRPACLKCTRL_CLKSEL_DEFAULT                 (_CMU_EM4GRPACLKCTRL_CLKSEL_DEFAULT << 0)
+#define _CMU_EM4GRPACLKCTRL_CLKSEL_LFRCO                  0x00000001UL
+#define _CMU_EM4GRPACLKCTRL_CLKSEL_LFXO                   0x00000002UL
+#define _CMU_EM4GRPACLKCTRL_CLKSEL_ULFRCO                 0x00000003UL
+#define CMU_EM4GRPACLKCTRL_CLKSEL_LFRCO                   (_CMU_EM4GRPACLKCTRL_CLKSEL_LFRCO << 0)
+#define CMU_EM4GRPACLKCTRL_CLKSEL_LFXO                    (_CMU_EM4GRPACLKCTRL_CLKSEL_LFXO << 0)
+#define CMU_EM4GRPACLKCTRL_CLKSEL_ULFRCO                  (_CMU_EM4GRPACLKCTRL_CLKSEL_ULFRCO << 0)
+
+/* Bit fields for CMU EUART0CLKCTRL */
+#define _CMU_EUART0CLKCTRL_RESETVALUE                     0x00000001UL
+#define _CMU_EUART0CLKCTRL_MASK                           0x00000003UL
+#define _CMU_EUART0CLKCTRL_CLKSEL_SHIFT                   0
+#define _CMU_EUART0CLKCTRL_CLKSEL_MASK                    0x3UL
+#define _CMU_EUART0CLKCTRL_CLKSEL_DEFAULT                 0x00000001UL
+#define CMU_EUART0CLKCTRL_CLKSEL_DEFAULT                  (_CMU_EUART0CLKCTRL_CLKSEL_DEFAULT << 0)
+#define _CMU_EUART0CLKCTRL_CLKSEL_EM01GRPACLK             0x00000001UL
+#define _CMU_EUART0CLKCTRL_CLKSEL_EM23GRPACLK             0x00000002UL
+#define CMU_EUART0CLKCTRL_CLKSEL_EM01GRPACLK              (_CMU_EUART0CLKCTRL_CLKSEL_EM01GRPACLK << 0)
+#define CMU_EUART0CLKCTRL_CLKSEL_EM23GRPACLK              (_CMU_EUART0CLKCTRL_CLKSEL_EM23GRPACLK << 0)
+
+/* Bit fields for CMU EXPORTCLKCTRL */
+#define _CMU_EXPORTCLKCTRL_RESETVALUE                     0x00000000UL
+#define _CMU_EXPORTCLKCTRL_MASK                           0x1F000F0FUL
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL0_SHIFT               0
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL0_MASK                0xFUL
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL0_DEFAULT             0x00000000UL
+#define CMU_EXPORTCLKCTRL_CLKOUTSEL0_DEFAULT              (_CMU_EXPORTCLKCTRL_CLKOUTSEL0_DEFAULT << 0)
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL0_DISABLED            0x00000000UL
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL0_HCLK                0x00000001UL
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL0_HFEXPCLK            0x00000002UL
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL0_ULFRCO              0x00000003UL
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL0_LFRCO               0x00000004UL
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL0_LFXO                0x00000005UL
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL0_HFRCODPLL           0x00000006UL
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL0_HFXO                0x00000007UL
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL0_FSRCO               0x00000008UL
+#define CMU_EXPORTCLKCTRL_CLKOUTSEL0_DISABLED             (_CMU_EXPORTCLKCTRL_CLKOUTSEL0_DISABLED << 0)
+#define CMU_EXPORTCLKCTRL_CLKOUTSEL0_HCLK                 (_CMU_EXPORTCLKCTRL_CLKOUTSEL0_HCLK << 0)
+#define CMU_EXPORTCLKCTRL_CLKOUTSEL0_HFEXPCLK             (_CMU_EXPORTCLKCTRL_CLKOUTSEL0_HFEXPCLK << 0)
+#define CMU_EXPORTCLKCTRL_CLKOUTSEL0_ULFRCO               (_CMU_EXPORTCLKCTRL_CLKOUTSEL0_ULFRCO << 0)
+#define CMU_EXPORTCLKCTRL_CLKOUTSEL0_LFRCO                (_CMU_EXPORTCLKCTRL_CLKOUTSEL0_LFRCO << 0)
+#define CMU_EXPORTCLKCTRL_CLKOUTSEL0_LFXO                 (_CMU_EXPORTCLKCTRL_CLKOUTSEL0_LFXO << 0)
+#define CMU_EXPORTCLKCTRL_CLKOUTSEL0_HFRCODPLL            (_CMU_EXPORTCLKCTRL_CLKOUTSEL0_HFRCODPLL << 0)
+#define CMU_EXPORTCLKCTRL_CLKOUTSEL0_HFXO                 (_CMU_EXPORTCLKCTRL_CLKOUTSEL0_HFXO << 0)
+#define CMU_EXPORTCLKCTRL_CLKOUTSEL0_FSRCO                (_CMU_EXPORTCLKCTRL_CLKOUTSEL0_FSRCO << 0)
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL1_SHIFT               8
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL1_MASK                0xF00UL
+#define _CMU_EXPORTCLKCTRL_CLKOUTSEL1_DEFAULT             0x00000000UL
+#define CMU_EXPORTCLKCTRL_CLKOUTSEL1_DEFAULT              (_CMU_EXPORTCLKCTRL_CLKOUTSEL1_DEFAULT << 8)
+#define _CMU_EXPORTCLKCTRL_PRESC_SHIFT                    24
+#define _CMU_EXPORTCLKCTRL_PRESC_MASK                     0x1F000000UL
+#define _CMU_EXPORTCLKCTRL_PRESC_DEFAULT                  0x00000000UL
+#define CMU_EXPORTCLKCTRL_PRESC_DEFAULT                   (_CMU_EXPORTCLKCTRL_PRESC_DEFAULT << 24)
+
+/* Bit fields for CMU IADCCLKCTRL */
+#define _CMU_IADCCLKCTRL_RESETVALUE                       0x00000001UL
+#define _CMU_IADCCLKCTRL_MASK                             0x00000003UL
+#define _CMU_IADCCLKCTRL_CLKSEL_SHIFT                     0
+#define _CMU_IADCCLKCTRL_CLKSEL_MASK                      0x3UL
+#define _CMU_IADCCLKCTRL_CLKSEL_DEFAULT                   0x00000001UL
+#define CMU_IADCCLKCTRL_CLKSEL_DEFAULT                    (_CMU_IADCCLKCTRL_CLKSEL_DEFAULT << 0)
+#define _CMU_IADCCLKCTRL_CLKSEL_EM01GRPACLK               0x00000001UL
+#define _CMU_IADCCLKCTRL_CLKSEL_FSRCO                     0x00000002UL
+#define CMU_IADCCLKCTRL_CLKSEL_EM01GRPACLK                (_CMU_IADCCLKCTRL_CLKSEL_EM01GRPACLK << 0)
+#define CMU_IADCCLKCTRL_CLKSEL_FSRCO                      (_CMU_IADCCLKCTRL_CLKSEL_FSRCO << 0)
+
+/* Bit fields for CMU IEN */
+#define _CMU_IEN_RESETVALUE                               0x00000000UL
+#define _CMU_IEN_MASK                                     0x00000000UL
+
+/* Bit fields for CMU IF */
+#define _CMU_IF_RESETVALUE                                0x00000000UL
+#define _CMU_IF_MASK                                      0x00000000UL
+
+/* Bit fields for CMU LOCK */
+#define _CMU_LOCK_RESETVALUE                              0x00000000UL
+#define _CMU_LOCK_MASK                                    0x0000FFFFUL
+#define _CMU_LOCK_LOCKKEY_SHIFT                           0
+#define _CMU_LOCK_LOCKKEY_MASK                            0xFFFFUL
+#define _CMU_LOCK_LOCKKEY_DEFAULT                         0x00000000UL
+#define CMU_LOCK_LOCKKEY_DEFAULT                          (_CMU_LOCK_LOCKKEY_DEFAULT << 0)
+#define _CMU_LOCK_LOCKKEY_UNLOCK                          0x000093F7UL
+#define CMU_LOCK_LOCKKEY_UNLOCK                           (_CMU_LOCK_LOCKKEY_UNLOCK << 0)
+
+/* Bit fields for CMU RTCCCLKCTRL */
+#define _CMU_RTCCCLKCTRL_RESETVALUE                       0x00000001UL
+#define _CMU_RTCCCLKCTRL_MASK                             0x00000003UL
+#define _CMU_RTCCCLKCTRL_CLKSEL_SHIFT                     0
+#define _CMU_RTCCCLKCTRL_CLKSEL_MASK                      0x3UL
+#define _CMU_RTCCCLKCTRL_CLKSEL_DEFAULT                   0x00000001UL
+#define CMU_RTCCCLKCTRL_CLKSEL_DEFAULT                    (_CMU_RTCCCLKCTRL_CLKSEL_DEFAULT << 0)
+#define _CMU_RTCCCLKCTRL_CLKSEL_LFRCO                     0x00000001UL
+#define _CMU_RTCCCLKCTRL_CLKSEL_LFXO                      0x00000002UL
+#define _CMU_RTCCCLKCTRL_CLKSEL_ULFRCO                    0x00000003UL
+#define CMU_RTCCCLKCTRL_CLKSEL_LFRCO                      (_CMU_RTCCCLKCTRL_CLKSEL_LFRCO << 0)
+#define CMU_RTCCCLKCTRL_CLKSEL_LFXO                       (_CMU_RTCCCLKCTRL_CLKSEL_LFXO << 0)
+#define CMU_RTCCCLKCTRL_CLKSEL_ULFRCO                     (_CMU_RTCCCLKCTRL_CLKSEL_ULFRCO << 0)
+
+/* Bit fields for CMU STATUS */
+#define _CMU_STATUS_RESETVALUE                            0x00000000UL
+#define _CMU_STATUS_MASK                                  0x00000001UL
+#define CMU_STATUS_CALRDY                                 (0x1UL << 0)
+#define _CMU_STATUS_CALRDY_SHIFT                          0
+#define _CMU_STATUS_CALRDY_MASK                           0x1UL
+#define _CMU_STATUS_CALRDY_DEFAULT                        0x00000000UL
+#define CMU_STATUS_CALRDY_DEFAULT                         (_CMU_STATUS_CALRDY_DEFAULT << 0)
+
+/* Bit fields for CMU SYSCLKCTRL */
+#define _CMU_SYSCLKCTRL_RESETVALUE                        0x00000001UL
+#define _CMU_SYSCLKCTRL_MASK                              0x0001F407UL
+#define _CMU_SYSCLKCTRL_CLKSEL_SHIFT                      0
+#define _CMU_SYSCLKCTRL_CLKSEL_MASK                       0x7UL
+#define _CMU_SYSCLKCTRL_CLKSEL_DEFAULT                    0x00000001UL
+#define CMU_SYSCLKCTRL_CLKSEL_DEFAULT                     (_CMU_SYSCLKCTRL_CLKSEL_DEFAULT << 0)
+#define _CMU_SYSCLKCTRL_CLKSEL_FSRCO                      0x00000001UL
+#define _CMU_SYSCLKCTRL_CLKSEL_HFRCODPLL                  0x00000002UL
+#define _CMU_SYSCLKCTRL_CLKSEL_HFXO                       0x00000003UL
+#define _CMU_SYSCLKCTRL_CLKSEL_CLKIN0                     0x00000004UL
+#define CMU_SYSCLKCTRL_CLKSEL_FSRCO                       (_CMU_SYSCLKCTRL_CLKSEL_FSRCO << 0)
+#define CMU_SYSCLKCTRL_CLKSEL_HFRCODPLL                   (_CMU_SYSCLKCTRL_CLKSEL_HFRCODPLL << 0)
+#define CMU_SYSCLKCTRL_CLKSEL_HFXO                        (_CMU_SYSCLKCTRL_CLKSEL_HFXO << 0)
+#define CMU_SYSCLKCTRL_CLKSEL_CLKIN0                      (_CMU_SYSCLKCTRL_CLKSEL_CLKIN0 << 0)
+#define CMU_SYSCLKCTRL_PCLKPRESC                          (0x1UL << 10)
+#define _CMU_SYSCLKCTRL_PCLKPRESC_SHIFT                   10
+#define _CMU_SYSCLKCTRL_PCLKPRESC_MASK                    0x400UL
+#define _CMU_SYSCLKCTRL_PCLKPRESC_DEFAULT                 0x00000000UL
+#define CMU_SYSCLKCTRL_PCLKPRESC_DEFAULT                  (_CMU_SYSCLKCTRL_PCLKPRESC_DEFAULT << 10)
+#define _CMU_SYSCLKCTRL_PCLKPRESC_DIV1                    0x00000000UL
+#define _CMU_SYSCLKCTRL_PCLKPRESC_DIV2                    0x00000001UL
+#define CMU_SYSCLKCTRL_PCLKPRESC_DIV1                     (_CMU_SYSCLKCTRL_PCLKPRESC_DIV1 << 10)
+#define CMU_SYSCLKCTRL_PCLKPRESC_DIV2                     (_CMU_SYSCLKCTRL_PCLKPRESC_DIV2 << 10)
+#define _CMU_SYSCLKCTRL_HCLKPRESC_SHIFT                   12
+#define _CMU_SYSCLKCTRL_HCLKPRESC_MASK                    0xF000UL
+#define _CMU_SYSCLKCTRL_HCLKPRESC_DEFAULT                 0x00000000UL
+#define CMU_SYSCLKCTRL_HCLKPRESC_DEFAULT                  (_CMU_SYSCLKCTRL_HCLKPRESC_DEFAULT << 12)
+#define _CMU_SYSCLKCTRL_HCLKPRESC_DIV1                    0x00000000UL
+#define _CMU_SYSCLKCTRL_HCLKPRESC_DIV2                    0x00000001UL
+#define _CMU_SYSCLKCTRL_HCLKPRESC_DIV4                    0x00000003UL
+#define _CMU_SYSCLKCTRL_HCLKPRESC_DIV8                    0x00000007UL
+#define _CMU_SYSCLKCTRL_HCLKPRESC_DIV16                   0x0000000FUL
+#define CMU_SYSCLKCTRL_HCLKPRESC_DIV1                     (_CMU_SYSCLKCTRL_HCLKPRESC_DIV1 << 12)
+#define CMU_SYSCLKCTRL_HCLKPRESC_DIV2                     (_CMU_SYSCLKCTRL_HCLKPRESC_DIV2 << 12)
+#define CMU_SYSCLKCTRL_HCLKPRESC_DIV4                     (_CMU_SYSCLKCTRL_HCLKPRESC_DIV4 << 12)
+#define CMU_SYSCLKCTRL_HCLKPRESC_DIV8                     (_CMU_SYSCLKCTRL_HCLKPRESC_DIV8 << 12)
+#define CMU_SYSCLKCTRL_HCLKPRESC_DIV16                    (_CMU_SYSCLKCTRL_HCLKPRESC_DIV16 << 12)
+#define CMU_SYSCLKCTRL_RHCLKPRESC                         (0x1UL << 16)
+#define _CMU_SYSCLKCTRL_RHCLKPRESC_SHIFT                  16
+#define _CMU_SYSCLKCTRL_RHCLKPRESC_MASK                   0x10000UL
+#define _CMU_SYSCLKCTRL_RHCLKPRESC_DEFAULT                0x00000000UL
+#define CMU_SYSCLKCTRL_RHCLKPRESC_DEFAULT                 (_CMU_SYSCLKCTRL_RHCLKPRESC_DEFAULT << 16)
+#define _CMU_SYSCLKCTRL_RHCLKPRESC_DIV1                   0x00000000UL
+#define _CMU_SYSCLKCTRL_RHCLKPRESC_DIV2                   0x00000001UL
+#define CMU_SYSCLKCTRL_RHCLKPRESC_DIV1                    (_CMU_SYSCLKCTRL_RHCLKPRESC_DIV1 << 16)
+#define CMU_SYSCLKCTRL_RHCLKPRESC_DIV2                    (_CMU_SYSCLKCTRL_RHCLKPRESC_DIV2 << 16)
+
+/* Bit fields for CMU WDOG0CLKCTRL */
+#define _CMU_WDOG0CLKCTRL_RESETVALUE                      0x00000001UL
+#define _CMU_WDOG0CLKCTRL_MASK                            0x00000007UL
+#define _CMU_WDOG0CLKCTRL_CLKSEL_SHIFT                    0
+#define _CMU_WDOG0CLKCTRL_CLKSEL_MASK                     0x7UL
+#define _CMU_WDOG0CLKCTRL_CLKSEL_DEFAULT                  0x00000001UL
+#define CMU_WDOG0CLKCTRL_CLKSEL_DEFAULT                   (_CMU_WDOG0CLKCTRL_CLKSEL_DEFAULT << 0)
+#define _CMU_WDOG0CLKCTRL_CLKSEL_LFRCO                    0x00000001UL
+#define _CMU_WDOG0CLKCTRL_CLKSEL_LFXO                     0x00000002UL
+#define _CMU_WDOG0CLKCTRL_CLKSEL_ULFRCO                   0x00000003UL
+#define _CMU_WDOG0CLKCTRL_CLKSEL_HCLKDIV1024              0x00000004UL
+#define CMU_WDOG0CLKCTRL_CLKSEL_LFRCO                     (_CMU_WDOG0CLKCTRL_CLKSEL_LFRCO << 0)
+#define CMU_WDOG0CLKCTRL_CLKSEL_LFXO                      (_CMU_WDOG0CLKCTRL_CLKSEL_LFXO << 0)
+#define CMU_WDOG0CLKCTRL_CLKSEL_ULFRCO                    (_CMU_WDOG0CLKCTRL_CLKSEL_ULFRCO << 0)
+#define CMU_WDOG0CLKCTRL_CLKSEL_HCLKDIV1024               (_CMU_WDOG0CLKCTRL_CLKSEL_HCLKDIV1024 << 0)
+
+/* Bit fields for CMU WDOGLOCK */
+#define _CMU_WDOGLOCK_RESETVALUE                          0x00000000UL
+#define _CMU_WDOGLOCK_MASK                                0x0000FFFFUL
+#define _CMU_WDOGLOCK_LOCKKEY_SHIFT                       0
+#define _CMU_WDOGLOCK_LOCKKEY_MASK                        0xFFFFUL
+#define _CMU_WDOGLOCK_LOCKKEY_DEFAULT                     0x00000000UL
+#define CMU_WDOGLOCK_LOCKKEY_DEFAULT                      (_CMU_WDOGLOCK_LOCKKEY_DEFAULT << 0)
+#define _CMU_WDOGLOCK_LOCKKEY_UNLOCK                      0x00005257UL
+#define CMU_WDOGLOCK_LOCKKEY_UNLOCK                       (_CMU_WDOGLOCK_LOCKKEY_UNLOCK << 0)
+
+/******************************************************************************
+ * EMU
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t LOCK;
+  uint32_t RESERVED0[1023];
+  __IOM uint32_t LOCK_SET;
+  uint32_t RESERVED1[1023];
+  __IOM uint32_t LOCK_CLR;
+  uint32_t RESERVED2[1023];
+  __IOM uint32_t LOCK_TGL;
+  uint32_t RESERVED3[1023];
+} EMU_TypeDef;
+
+/* Bit fields for EMU LOCK */
+#define _EMU_LOCK_RESETVALUE                              0x00000000UL
+#define _EMU_LOCK_MASK                                    0x0000FFFFUL
+#define _EMU_LOCK_LOCKKEY_SHIFT                           0
+#define _EMU_LOCK_LOCKKEY_MASK                            0xFFFFUL
+#define _EMU_LOCK_LOCKKEY_DEFAULT                         0x00000000UL
+#define EMU_LOCK_LOCKKEY_DEFAULT                          (_EMU_LOCK_LOCKKEY_DEFAULT << 0)
+#define _EMU_LOCK_LOCKKEY_UNLOCK                          0x0000ADE8UL
+#define EMU_LOCK_LOCKKEY_UNLOCK                           (_EMU_LOCK_LOCKKEY_UNLOCK << 0)
+
+/******************************************************************************
+ * HFXO
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t CFG;
+  __IOM uint32_t CMD;
+  __IOM uint32_t CTRL;
+  __IOM uint32_t LOCK;
+  __IOM uint32_t STATUS;
+  __IOM uint32_t XTALCFG;
+  __IOM uint32_t XTALCTRL;
+  uint32_t RESERVED0[1017];
+  __IOM uint32_t CFG_SET;
+  __IOM uint32_t CMD_SET;
+  __IOM uint32_t CTRL_SET;
+  __IOM uint32_t LOCK_SET;
+  __IOM uint32_t STATUS_SET;
+  __IOM uint32_t XTALCFG_SET;
+  __IOM uint32_t XTALCTRL_SET;
+  uint32_t RESERVED1[1017];
+  __IOM uint32_t CFG_CLR;
+  __IOM uint32_t CMD_CLR;
+  __IOM uint32_t CTRL_CLR;
+  __IOM uint32_t LOCK_CLR;
+  __IOM uint32_t STATUS_CLR;
+  __IOM uint32_t XTALCFG_CLR;
+  __IOM uint32_t XTALCTRL_CLR;
+  uint32_t RESERVED2[1017];
+  __IOM uint32_t CFG_TGL;
+  __IOM uint32_t CMD_TGL;
+  __IOM uint32_t CTRL_TGL;
+  __IOM uint32_t LOCK_TGL;
+  __IOM uint32_t STATUS_TGL;
+  __IOM uint32_t XTALCFG_TGL;
+  __IOM uint32_t XTALCTRL_TGL;
+  uint32_t RESERVED3[1017];
+} HFXO_TypeDef;
+
+/* Bit fields for HFXO CFG */
+#define _HFXO_CFG_RESETVALUE                              0x00000000UL
+#define _HFXO_CFG_MASK                                    0x000003FFUL
+#define _HFXO_CFG_ENXIDCBIASANA_SHIFT                     0
+#define _HFXO_CFG_ENXIDCBIASANA_MASK                      0xFFUL
+#define _HFXO_CFG_ENXIDCBIASANA_DEFAULT                   0x00000000UL
+#define HFXO_CFG_ENXIDCBIASANA_DEFAULT                    (_HFXO_CFG_ENXIDCBIASANA_DEFAULT << 0)
+#define HFXO_CFG_MODE                                     (0x1UL << 8)
+#define _HFXO_CFG_MODE_SHIFT                              8
+#define _HFXO_CFG_MODE_MASK                               0x100UL
+#define _HFXO_CFG_MODE_DEFAULT                            0x00000000UL
+#define HFXO_CFG_MODE_DEFAULT                             (_HFXO_CFG_MODE_DEFAULT << 8)
+#define _HFXO_CFG_MODE_XTAL                               0x00000000UL
+#define _HFXO_CFG_MODE_EXTCLK                             0x00000001UL
+#define HFXO_CFG_MODE_XTAL                                (_HFXO_CFG_MODE_XTAL << 8)
+#define HFXO_CFG_MODE_EXTCLK                              (_HFXO_CFG_MODE_EXTCLK << 8)
+#define HFXO_CFG_SQBUFSCHTRGANA                           (0x1UL << 9)
+#define _HFXO_CFG_SQBUFSCHTRGANA_SHIFT                    9
+#define _HFXO_CFG_SQBUFSCHTRGANA_MASK                     0x200UL
+#define _HFXO_CFG_SQBUFSCHTRGANA_DEFAULT                  0x00000000UL
+#define HFXO_CFG_SQBUFSCHTRGANA_DEFAULT                   (_HFXO_CFG_SQBUFSCHTRGANA_DEFAULT << 9)
+
+/* Bit fields for HFXO CMD */
+#define _HFXO_CMD_RESETVALUE                              0x00000000UL
+#define _HFXO_CMD_MASK                                    0x00000001UL
+#define HFXO_CMD_MANUALOVERRIDE                           (0x1UL << 0)
+#define _HFXO_CMD_MANUALOVERRIDE_SHIFT                    0
+#define _HFXO_CMD_MANUALOVERRIDE_MASK                     0x1UL
+#define _HFXO_CMD_MANUALOVERRIDE_DEFAULT                  0x00000000UL
+#define HFXO_CMD_MANUALOVERRIDE_DEFAULT                   (_HFXO_CMD_MANUALOVERRIDE_DEFAULT << 0)
+
+/* Bit fields for HFXO CTRL */
+#define _HFXO_CTRL_RESETVALUE                             0x00000000UL
+#define _HFXO_CTRL_MASK                                   0x0003FFFFUL
+#define HFXO_CTRL_DISONDEMAND                             (0x1UL << 0)
+#define _HFXO_CTRL_DISONDEMAND_SHIFT                      0
+#define _HFXO_CTRL_DISONDEMAND_MASK                       0x1UL
+#define _HFXO_CTRL_DISONDEMAND_DEFAULT                    0x00000000UL
+#define HFXO_CTRL_DISONDEMAND_DEFAULT                     (_HFXO_CTRL_DISONDEMAND_DEFAULT << 0)
+#define HFXO_CTRL_FORCEEN                                 (0x1UL << 1)
+#define _HFXO_CTRL_FORCEEN_SHIFT                          1
+#define _HFXO_CTRL_FORCEEN_MASK                           0x2UL
+#define _HFXO_CTRL_FORCEEN_DEFAULT                        0x00000000UL
+#define HFXO_CTRL_FORCEEN_DEFAULT                         (_HFXO_CTRL_FORCEEN_DEFAULT << 1)
+#define _HFXO_CTRL_FORCEXI2GNDANA_SHIFT                   2
+#define _HFXO_CTRL_FORCEXI2GNDANA_MASK                    0x3FCUL
+#define _HFXO_CTRL_FORCEXI2GNDANA_DEFAULT                 0x00000000UL
+#define HFXO_CTRL_FORCEXI2GNDANA_DEFAULT                  (_HFXO_CTRL_FORCEXI2GNDANA_DEFAULT << 2)
+#define _HFXO_CTRL_FORCEXO2GNDANA_SHIFT                   10
+#define _HFXO_CTRL_FORCEXO2GNDANA_MASK                    0x3FC00UL
+#define _HFXO_CTRL_FORCEXO2GNDANA_DEFAULT                 0x00000000UL
+#define HFXO_CTRL_FORCEXO2GNDANA_DEFAULT                  (_HFXO_CTRL_FORCEXO2GNDANA_DEFAULT << 10)
+
+/* Bit fields for HFXO LOCK */
+#define _HFXO_LOCK_RESETVALUE                             0x00000000UL
+#define _HFXO_LOCK_MASK                                   0x0000FFFFUL
+#define _HFXO_LOCK_LOCKKEY_SHIFT                          0
+#define _HFXO_LOCK_LOCKKEY_MASK                           0xFFFFUL
+#define _HFXO_LOCK_LOCKKEY_DEFAULT                        0x00000000UL
+#define HFXO_LOCK_LOCKKEY_DEFAULT                         (_HFXO_LOCK_LOCKKEY_DEFAULT << 0)
+#define _HFXO_LOCK_LOCKKEY_UNLOCK                         0x0000580EUL
+#define HFXO_LOCK_LOCKKEY_UNLOCK                          (_HFXO_LOCK_LOCKKEY_UNLOCK << 0)
+
+/* Bit fields for HFXO STATUS */
+#define _HFXO_STATUS_RESETVALUE                           0x00000000UL
+#define _HFXO_STATUS_MASK                                 0x0000000FUL
+#define HFXO_STATUS_COREBIASOPTRDY                        (0x1UL << 0)
+#define _HFXO_STATUS_COREBIASOPTRDY_SHIFT                 0
+#define _HFXO_STATUS_COREBIASOPTRDY_MASK                  0x1UL
+#define _HFXO_STATUS_COREBIASOPTRDY_DEFAULT               0x00000000UL
+#define HFXO_STATUS_COREBIASOPTRDY_DEFAULT                (_HFXO_STATUS_COREBIASOPTRDY_DEFAULT << 0)
+#define HFXO_STATUS_ENS                                   (0x1UL << 1)
+#define _HFXO_STATUS_ENS_SHIFT                            1
+#define _HFXO_STATUS_ENS_MASK                             0x2UL
+#define _HFXO_STATUS_ENS_DEFAULT                          0x00000000UL
+#define HFXO_STATUS_ENS_DEFAULT                           (_HFXO_STATUS_ENS_DEFAULT << 1)
+#define HFXO_STATUS_FSMLOCK                               (0x1UL << 2)
+#define _HFXO_STATUS_FSMLOCK_SHIFT                        2
+#define _HFXO_STATUS_FSMLOCK_MASK                         0x4UL
+#define _HFXO_STATUS_FSMLOCK_DEFAULT                      0x00000000UL
+#define HFXO_STATUS_FSMLOCK_DEFAULT                       (_HFXO_STATUS_FSMLOCK_DEFAULT << 2)
+#define HFXO_STATUS_RDY                                   (0x1UL << 3)
+#define _HFXO_STATUS_RDY_SHIFT                            3
+#define _HFXO_STATUS_RDY_MASK                             0x8UL
+#define _HFXO_STATUS_RDY_DEFAULT                          0x00000000UL
+#define HFXO_STATUS_RDY_DEFAULT                           (_HFXO_STATUS_RDY_DEFAULT << 3)
+
+/* Bit fields for HFXO XTALCFG */
+#define _HFXO_XTALCFG_RESETVALUE                          0x00000000UL
+#define _HFXO_XTALCFG_MASK                                0x0FFFFFFFUL
+#define _HFXO_XTALCFG_COREBIASSTARTUPI_SHIFT              0
+#define _HFXO_XTALCFG_COREBIASSTARTUPI_MASK               0x3FUL
+#define _HFXO_XTALCFG_COREBIASSTARTUPI_DEFAULT            0x00000000UL
+#define HFXO_XTALCFG_COREBIASSTARTUPI_DEFAULT             (_HFXO_XTALCFG_COREBIASSTARTUPI_DEFAULT << 0)
+#define _HFXO_XTALCFG_COREBIASSTARTUP_SHIFT               6
+#define _HFXO_XTALCFG_COREBIASSTARTUP_MASK                0xFC0UL
+#define _HFXO_XTALCFG_COREBIASSTARTUP_DEFAULT             0x00000000UL
+#define HFXO_XTALCFG_COREBIASSTARTUP_DEFAULT              (_HFXO_XTALCFG_COREBIASSTARTUP_DEFAULT << 6)
+#define _HFXO_XTALCFG_CTUNEXISTARTUP_SHIFT                12
+#define _HFXO_XTALCFG_CTUNEXISTARTUP_MASK                 0xF000UL
+#define _HFXO_XTALCFG_CTUNEXISTARTUP_DEFAULT              0x00000000UL
+#define HFXO_XTALCFG_CTUNEXISTARTUP_DEFAULT               (_HFXO_XTALCFG_CTUNEXISTARTUP_DEFAULT << 12)
+#define _HFXO_XTALCFG_CTUNEXOSTARTUP_SHIFT                16
+#define _HFXO_XTALCFG_CTUNEXOSTARTUP_MASK                 0xF0000UL
+#define _HFXO_XTALCFG_CTUNEXOSTARTUP_DEFAULT              0x00000000UL
+#define HFXO_XTALCFG_CTUNEXOSTARTUP_DEFAULT               (_HFXO_XTALCFG_CTUNEXOSTARTUP_DEFAULT << 16)
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_SHIFT                 20
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_MASK                  0xF00000UL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_DEFAULT               0x00000000UL
+#define HFXO_XTALCFG_TIMEOUTSTEADY_DEFAULT                (_HFXO_XTALCFG_TIMEOUTSTEADY_DEFAULT << 20)
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T16US                 0x00000000UL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T41US                 0x00000001UL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T83US                 0x00000002UL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T125US                0x00000003UL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T166US                0x00000004UL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T208US                0x00000005UL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T250US                0x00000006UL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T333US                0x00000007UL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T416US                0x00000008UL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T500US                0x00000009UL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T666US                0x0000000AUL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T833US                0x0000000BUL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T1666US               0x0000000CUL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T2500US               0x0000000DUL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T4166US               0x0000000EUL
+#define _HFXO_XTALCFG_TIMEOUTSTEADY_T7500US               0x0000000FUL
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T16US                  (_HFXO_XTALCFG_TIMEOUTSTEADY_T16US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T41US                  (_HFXO_XTALCFG_TIMEOUTSTEADY_T41US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T83US                  (_HFXO_XTALCFG_TIMEOUTSTEADY_T83US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T125US                 (_HFXO_XTALCFG_TIMEOUTSTEADY_T125US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T166US                 (_HFXO_XTALCFG_TIMEOUTSTEADY_T166US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T208US                 (_HFXO_XTALCFG_TIMEOUTSTEADY_T208US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T250US                 (_HFXO_XTALCFG_TIMEOUTSTEADY_T250US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T333US                 (_HFXO_XTALCFG_TIMEOUTSTEADY_T333US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T416US                 (_HFXO_XTALCFG_TIMEOUTSTEADY_T416US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T500US                 (_HFXO_XTALCFG_TIMEOUTSTEADY_T500US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T666US                 (_HFXO_XTALCFG_TIMEOUTSTEADY_T666US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T833US                 (_HFXO_XTALCFG_TIMEOUTSTEADY_T833US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T1666US                (_HFXO_XTALCFG_TIMEOUTSTEADY_T1666US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T2500US                (_HFXO_XTALCFG_TIMEOUTSTEADY_T2500US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T4166US                (_HFXO_XTALCFG_TIMEOUTSTEADY_T4166US << 20)
+#define HFXO_XTALCFG_TIMEOUTSTEADY_T7500US                (_HFXO_XTALCFG_TIMEOUTSTEADY_T7500US << 20)
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_SHIFT                  24
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_MASK                   0xF000000UL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_DEFAULT                0x00000000UL
+#define HFXO_XTALCFG_TIMEOUTCBLSB_DEFAULT                 (_HFXO_XTALCFG_TIMEOUTCBLSB_DEFAULT << 24)
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T8US                   0x00000000UL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T20US                  0x00000001UL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T41US                  0x00000002UL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T62US                  0x00000003UL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T83US                  0x00000004UL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T104US                 0x00000005UL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T125US                 0x00000006UL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T166US                 0x00000007UL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T208US                 0x00000008UL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T250US                 0x00000009UL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T333US                 0x0000000AUL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T416US                 0x0000000BUL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T833US                 0x0000000CUL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T1250US                0x0000000DUL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T2083US                0x0000000EUL
+#define _HFXO_XTALCFG_TIMEOUTCBLSB_T3750US                0x0000000FUL
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T8US                    (_HFXO_XTALCFG_TIMEOUTCBLSB_T8US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T20US                   (_HFXO_XTALCFG_TIMEOUTCBLSB_T20US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T41US                   (_HFXO_XTALCFG_TIMEOUTCBLSB_T41US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T62US                   (_HFXO_XTALCFG_TIMEOUTCBLSB_T62US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T83US                   (_HFXO_XTALCFG_TIMEOUTCBLSB_T83US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T104US                  (_HFXO_XTALCFG_TIMEOUTCBLSB_T104US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T125US                  (_HFXO_XTALCFG_TIMEOUTCBLSB_T125US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T166US                  (_HFXO_XTALCFG_TIMEOUTCBLSB_T166US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T208US                  (_HFXO_XTALCFG_TIMEOUTCBLSB_T208US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T250US                  (_HFXO_XTALCFG_TIMEOUTCBLSB_T250US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T333US                  (_HFXO_XTALCFG_TIMEOUTCBLSB_T333US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T416US                  (_HFXO_XTALCFG_TIMEOUTCBLSB_T416US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T833US                  (_HFXO_XTALCFG_TIMEOUTCBLSB_T833US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T1250US                 (_HFXO_XTALCFG_TIMEOUTCBLSB_T1250US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T2083US                 (_HFXO_XTALCFG_TIMEOUTCBLSB_T2083US << 24)
+#define HFXO_XTALCFG_TIMEOUTCBLSB_T3750US                 (_HFXO_XTALCFG_TIMEOUTCBLSB_T3750US << 24)
+
+/* Bit fields for HFXO XTALCTRL */
+#define _HFXO_XTALCTRL_RESETVALUE                         0x00000000UL
+#define _HFXO_XTALCTRL_MASK                               0x1FFFFFFFUL
+#define _HFXO_XTALCTRL_COREBIASANA_SHIFT                  0
+#define _HFXO_XTALCTRL_COREBIASANA_MASK                   0xFFUL
+#define _HFXO_XTALCTRL_COREBIASANA_DEFAULT                0x00000000UL
+#define HFXO_XTALCTRL_COREBIASANA_DEFAULT                 (_HFXO_XTALCTRL_COREBIASANA_DEFAULT << 0)
+#define _HFXO_XTALCTRL_CTUNEXIANA_SHIFT                   8
+#define _HFXO_XTALCTRL_CTUNEXIANA_MASK                    0xFF00UL
+#define _HFXO_XTALCTRL_CTUNEXIANA_DEFAULT                 0x00000000UL
+#define HFXO_XTALCTRL_CTUNEXIANA_DEFAULT                  (_HFXO_XTALCTRL_CTUNEXIANA_DEFAULT << 8)
+#define _HFXO_XTALCTRL_CTUNEXOANA_SHIFT                   16
+#define _HFXO_XTALCTRL_CTUNEXOANA_MASK                    0xFF0000UL
+#define _HFXO_XTALCTRL_CTUNEXOANA_DEFAULT                 0x00000000UL
+#define HFXO_XTALCTRL_CTUNEXOANA_DEFAULT                  (_HFXO_XTALCTRL_CTUNEXOANA_DEFAULT << 16)
+#define _HFXO_XTALCTRL_COREDGENANA_SHIFT                  24
+#define _HFXO_XTALCTRL_COREDGENANA_MASK                   0x3000000UL
+#define _HFXO_XTALCTRL_COREDGENANA_DEFAULT                0x00000000UL
+#define HFXO_XTALCTRL_COREDGENANA_DEFAULT                 (_HFXO_XTALCTRL_COREDGENANA_DEFAULT << 24)
+#define _HFXO_XTALCTRL_COREDGENANA_NONE                   0x00000000UL
+#define _HFXO_XTALCTRL_COREDGENANA_DGEN100                0x00000001UL
+#define _HFXO_XTALCTRL_COREDGENANA_DGEN33                 0x00000002UL
+#define _HFXO_XTALCTRL_COREDGENANA_DGEN50                 0x00000003UL
+#define HFXO_XTALCTRL_COREDGENANA_NONE                    (_HFXO_XTALCTRL_COREDGENANA_NONE << 24)
+#define HFXO_XTALCTRL_COREDGENANA_DGEN100                 (_HFXO_XTALCTRL_COREDGENANA_DGEN100 << 24)
+#define HFXO_XTALCTRL_COREDGENANA_DGEN33                  (_HFXO_XTALCTRL_COREDGENANA_DGEN33 << 24)
+#define HFXO_XTALCTRL_COREDGENANA_DGEN50                  (_HFXO_XTALCTRL_COREDGENANA_DGEN50 << 24)
+#define _HFXO_XTALCTRL_CTUNEFIXANA_SHIFT                  26
+#define _HFXO_XTALCTRL_CTUNEFIXANA_MASK                   0xC000000UL
+#define _HFXO_XTALCTRL_CTUNEFIXANA_DEFAULT                0x00000000UL
+#define HFXO_XTALCTRL_CTUNEFIXANA_DEFAULT                 (_HFXO_XTALCTRL_CTUNEFIXANA_DEFAULT << 26)
+#define _HFXO_XTALCTRL_CTUNEFIXANA_NONE                   0x00000000UL
+#define _HFXO_XTALCTRL_CTUNEFIXANA_BOTH                   0x00000001UL
+#define _HFXO_XTALCTRL_CTUNEFIXANA_XI                     0x00000002UL
+#define _HFXO_XTALCTRL_CTUNEFIXANA_XO                     0x00000003UL
+#define HFXO_XTALCTRL_CTUNEFIXANA_NONE                    (_HFXO_XTALCTRL_CTUNEFIXANA_NONE << 26)
+#define HFXO_XTALCTRL_CTUNEFIXANA_BOTH                    (_HFXO_XTALCTRL_CTUNEFIXANA_BOTH << 26)
+#define HFXO_XTALCTRL_CTUNEFIXANA_XI                      (_HFXO_XTALCTRL_CTUNEFIXANA_XI << 26)
+#define HFXO_XTALCTRL_CTUNEFIXANA_XO                      (_HFXO_XTALCTRL_CTUNEFIXANA_XO << 26)
+#define HFXO_XTALCTRL_SKIPCOREBIASOPT                     (0x1UL << 28)
+#define _HFXO_XTALCTRL_SKIPCOREBIASOPT_SHIFT              28
+#define _HFXO_XTALCTRL_SKIPCOREBIASOPT_MASK               0x10000000UL
+#define _HFXO_XTALCTRL_SKIPCOREBIASOPT_DEFAULT            0x00000000UL
+#define HFXO_XTALCTRL_SKIPCOREBIASOPT_DEFAULT             (_HFXO_XTALCTRL_SKIPCOREBIASOPT_DEFAULT << 28)
+
+/******************************************************************************
+ * HFRCO
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t CAL;
+  __IOM uint32_t STATUS;
+  uint32_t RESERVED0[1022];
+  __IOM uint32_t CAL_SET;
+  __IOM uint32_t STATUS_SET;
+  uint32_t RESERVED1[1022];
+  __IOM uint32_t CAL_CLR;
+  __IOM uint32_t STATUS_CLR;
+  uint32_t RESERVED2[1022];
+  __IOM uint32_t CAL_TGL;
+  __IOM uint32_t STATUS_TGL;
+  uint32_t RESERVED3[1022];
+} HFRCO_TypeDef;
+
+/* Bit fields for HFRCO CAL */
+#define _HFRCO_CAL_RESETVALUE                             0x00000000UL
+#define _HFRCO_CAL_MASK                                   0x061F007FUL
+#define _HFRCO_CAL_TUNING_SHIFT                           0
+#define _HFRCO_CAL_TUNING_MASK                            0x7FUL
+#define _HFRCO_CAL_TUNING_DEFAULT                         0x00000000UL
+#define HFRCO_CAL_TUNING_DEFAULT                          (_HFRCO_CAL_TUNING_DEFAULT << 0)
+#define _HFRCO_CAL_FREQRANGE_SHIFT                        16
+#define _HFRCO_CAL_FREQRANGE_MASK                         0x1F0000UL
+#define _HFRCO_CAL_FREQRANGE_DEFAULT                      0x00000000UL
+#define HFRCO_CAL_FREQRANGE_DEFAULT                       (_HFRCO_CAL_FREQRANGE_DEFAULT << 16)
+#define _HFRCO_CAL_CLKDIV_SHIFT                           25
+#define _HFRCO_CAL_CLKDIV_MASK                            0x6000000UL
+#define _HFRCO_CAL_CLKDIV_DEFAULT                         0x00000000UL
+#define HFRCO_CAL_CLKDIV_DEFAULT                          (_HFRCO_CAL_CLKDIV_DEFAULT << 25)
+#define _HFRCO_CAL_CLKDIV_DIV1                            0x00000000UL
+#define _HFRCO_CAL_CLKDIV_DIV2                            0x00000001UL
+#define _HFRCO_CAL_CLKDIV_DIV4                            0x00000002UL
+#define HFRCO_CAL_CLKDIV_DIV1                             (_HFRCO_CAL_CLKDIV_DIV1 << 25)
+#define HFRCO_CAL_CLKDIV_DIV2                             (_HFRCO_CAL_CLKDIV_DIV2 << 25)
+#define HFRCO_CAL_CLKDIV_DIV4                             (_HFRCO_CAL_CLKDIV_DIV4 << 25)
+
+/* Bit fields for HFRCO STATUS */
+#define _HFRCO_STATUS_RESETVALUE                          0x00000000UL
+#define _HFRCO_STATUS_MASK                                0x00000001UL
+#define HFRCO_STATUS_SYNCBUSY                             (0x1UL << 0)
+#define _HFRCO_STATUS_SYNCBUSY_SHIFT                      0
+#define _HFRCO_STATUS_SYNCBUSY_MASK                       0x1UL
+#define _HFRCO_STATUS_SYNCBUSY_DEFAULT                    0x00000000UL
+#define HFRCO_STATUS_SYNCBUSY_DEFAULT                     (_HFRCO_STATUS_SYNCBUSY_DEFAULT << 0)
+
+/******************************************************************************
+ * FSRCO
+ *****************************************************************************/
+
+typedef struct {
+  uint32_t RESERVED0[1024];
+  uint32_t RESERVED1[1024];
+  uint32_t RESERVED2[1024];
+  uint32_t RESERVED3[1024];
+} FSRCO_TypeDef;
+
+/******************************************************************************
+ * DPLL
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t CFG;
+  __IOM uint32_t CFG1;
+  __IOM uint32_t EN;
+  __IOM uint32_t IF;
+  __IOM uint32_t STATUS;
+  uint32_t RESERVED0[1019];
+  __IOM uint32_t CFG_SET;
+  __IOM uint32_t CFG1_SET;
+  __IOM uint32_t EN_SET;
+  __IOM uint32_t IF_SET;
+  __IOM uint32_t STATUS_SET;
+  uint32_t RESERVED1[1019];
+  __IOM uint32_t CFG_CLR;
+  __IOM uint32_t CFG1_CLR;
+  __IOM uint32_t EN_CLR;
+  __IOM uint32_t IF_CLR;
+  __IOM uint32_t STATUS_CLR;
+  uint32_t RESERVED2[1019];
+  __IOM uint32_t CFG_TGL;
+  __IOM uint32_t CFG1_TGL;
+  __IOM uint32_t EN_TGL;
+  __IOM uint32_t IF_TGL;
+  __IOM uint32_t STATUS_TGL;
+  uint32_t RESERVED3[1019];
+} DPLL_TypeDef;
+
+/* Bit fields for DPLL CFG */
+#define _DPLL_CFG_RESETVALUE                              0x00000000UL
+#define _DPLL_CFG_MASK                                    0x0000001FUL
+#define DPLL_CFG_AUTORECOVER                              (0x1UL << 0)
+#define _DPLL_CFG_AUTORECOVER_SHIFT                       0
+#define _DPLL_CFG_AUTORECOVER_MASK                        0x1UL
+#define _DPLL_CFG_AUTORECOVER_DEFAULT                     0x00000000UL
+#define DPLL_CFG_AUTORECOVER_DEFAULT                      (_DPLL_CFG_AUTORECOVER_DEFAULT << 0)
+#define DPLL_CFG_DITHEN                                   (0x1UL << 1)
+#define _DPLL_CFG_DITHEN_SHIFT                            1
+#define _DPLL_CFG_DITHEN_MASK                             0x2UL
+#define _DPLL_CFG_DITHEN_DEFAULT                          0x00000000UL
+#define DPLL_CFG_DITHEN_DEFAULT                           (_DPLL_CFG_DITHEN_DEFAULT << 1)
+#define DPLL_CFG_EDGESEL                                  (0x1UL << 2)
+#define _DPLL_CFG_EDGESEL_SHIFT                           2
+#define _DPLL_CFG_EDGESEL_MASK                            0x4UL
+#define _DPLL_CFG_EDGESEL_DEFAULT                         0x00000000UL
+#define DPLL_CFG_EDGESEL_DEFAULT                          (_DPLL_CFG_EDGESEL_DEFAULT << 2)
+#define _DPLL_CFG_MODE_SHIFT                              3
+#define _DPLL_CFG_MODE_MASK                               0x18UL
+#define _DPLL_CFG_MODE_DEFAULT                            0x00000000UL
+#define DPLL_CFG_MODE_DEFAULT                             (_DPLL_CFG_MODE_DEFAULT << 3)
+#define _DPLL_CFG_MODE_FLL                                0x00000001UL
+#define _DPLL_CFG_MODE_PLL                                0x00000002UL
+#define DPLL_CFG_MODE_FLL                                 (_DPLL_CFG_MODE_FLL << 3)
+#define DPLL_CFG_MODE_PLL                                 (_DPLL_CFG_MODE_PLL << 3)
+
+/* Bit fields for DPLL CFG1 */
+#define _DPLL_CFG1_RESETVALUE                             0x00000000UL
+#define _DPLL_CFG1_MASK                                   0x0FFF0FFFUL
+#define _DPLL_CFG1_M_SHIFT                                0
+#define _DPLL_CFG1_M_MASK                                 0xFFFUL
+#define _DPLL_CFG1_M_DEFAULT                              0x00000000UL
+#define DPLL_CFG1_M_DEFAULT                               (_DPLL_CFG1_M_DEFAULT << 0)
+#define _DPLL_CFG1_N_SHIFT                                16
+#define _DPLL_CFG1_N_MASK                                 0xFFF0000UL
+#define _DPLL_CFG1_N_DEFAULT                              0x00000000UL
+#define DPLL_CFG1_N_DEFAULT                               (_DPLL_CFG1_N_DEFAULT << 16)
+
+/* Bit fields for DPLL EN */
+#define _DPLL_EN_RESETVALUE                               0x00000000UL
+#define _DPLL_EN_MASK                                     0x00000001UL
+#define DPLL_EN_EN                                        (0x1UL << 0)
+#define _DPLL_EN_EN_SHIFT                                 0
+#define _DPLL_EN_EN_MASK                                  0x1UL
+#define _DPLL_EN_EN_DEFAULT                               0x00000000UL
+#define DPLL_EN_EN_DEFAULT                                (_DPLL_EN_EN_DEFAULT << 0)
+
+/* Bit fields for DPLL IF */
+#define _DPLL_IF_RESETVALUE                               0x00000000UL
+#define _DPLL_IF_MASK                                     0x00000007UL
+#define DPLL_IF_LOCK                                      (0x1UL << 0)
+#define _DPLL_IF_LOCK_SHIFT                               0
+#define _DPLL_IF_LOCK_MASK                                0x1UL
+#define _DPLL_IF_LOCK_DEFAULT                             0x00000000UL
+#define DPLL_IF_LOCK_DEFAULT                              (_DPLL_IF_LOCK_DEFAULT << 0)
+#define DPLL_IF_LOCKFAILHIGH                              (0x1UL << 1)
+#define _DPLL_IF_LOCKFAILHIGH_SHIFT                       1
+#define _DPLL_IF_LOCKFAILHIGH_MASK                        0x2UL
+#define _DPLL_IF_LOCKFAILHIGH_DEFAULT                     0x00000000UL
+#define DPLL_IF_LOCKFAILHIGH_DEFAULT                      (_DPLL_IF_LOCKFAILHIGH_DEFAULT << 1)
+#define DPLL_IF_LOCKFAILLOW                               (0x1UL << 2)
+#define _DPLL_IF_LOCKFAILLOW_SHIFT                        2
+#define _DPLL_IF_LOCKFAILLOW_MASK                         0x4UL
+#define _DPLL_IF_LOCKFAILLOW_DEFAULT                      0x00000000UL
+#define DPLL_IF_LOCKFAILLOW_DEFAULT                       (_DPLL_IF_LOCKFAILLOW_DEFAULT << 2)
+
+/* Bit fields for DPLL STATUS */
+#define _DPLL_STATUS_RESETVALUE                           0x00000000UL
+#define _DPLL_STATUS_MASK                                 0x00000003UL
+#define DPLL_STATUS_ENS                                   (0x1UL << 0)
+#define _DPLL_STATUS_ENS_SHIFT                            0
+#define _DPLL_STATUS_ENS_MASK                             0x1UL
+#define _DPLL_STATUS_ENS_DEFAULT                          0x00000000UL
+#define DPLL_STATUS_ENS_DEFAULT                           (_DPLL_STATUS_ENS_DEFAULT << 0)
+#define DPLL_STATUS_RDY                                   (0x1UL << 1)
+#define _DPLL_STATUS_RDY_SHIFT                            1
+#define _DPLL_STATUS_RDY_MASK                             0x2UL
+#define _DPLL_STATUS_RDY_DEFAULT                          0x00000000UL
+#define DPLL_STATUS_RDY_DEFAULT                           (_DPLL_STATUS_RDY_DEFAULT << 1)
+
+/******************************************************************************
+ * LFXO
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t CAL;
+  __IOM uint32_t CFG;
+  __IOM uint32_t CTRL;
+  __IOM uint32_t LOCK;
+  __IOM uint32_t STATUS;
+  uint32_t RESERVED0[1019];
+  __IOM uint32_t CAL_SET;
+  __IOM uint32_t CFG_SET;
+  __IOM uint32_t CTRL_SET;
+  __IOM uint32_t LOCK_SET;
+  __IOM uint32_t STATUS_SET;
+  uint32_t RESERVED1[1019];
+  __IOM uint32_t CAL_CLR;
+  __IOM uint32_t CFG_CLR;
+  __IOM uint32_t CTRL_CLR;
+  __IOM uint32_t LOCK_CLR;
+  __IOM uint32_t STATUS_CLR;
+  uint32_t RESERVED2[1019];
+  __IOM uint32_t CAL_TGL;
+  __IOM uint32_t CFG_TGL;
+  __IOM uint32_t CTRL_TGL;
+  __IOM uint32_t LOCK_TGL;
+  __IOM uint32_t STATUS_TGL;
+  uint32_t RESERVED3[1019];
+} LFXO_TypeDef;
+
+/* Bit fields for LFXO CAL */
+#define _LFXO_CAL_RESETVALUE                              0x00000000UL
+#define _LFXO_CAL_MASK                                    0x0000037FUL
+#define _LFXO_CAL_CAPTUNE_SHIFT                           0
+#define _LFXO_CAL_CAPTUNE_MASK                            0x7FUL
+#define _LFXO_CAL_CAPTUNE_DEFAULT                         0x00000000UL
+#define LFXO_CAL_CAPTUNE_DEFAULT                          (_LFXO_CAL_CAPTUNE_DEFAULT << 0)
+#define _LFXO_CAL_GAIN_SHIFT                              8
+#define _LFXO_CAL_GAIN_MASK                               0x300UL
+#define _LFXO_CAL_GAIN_DEFAULT                            0x00000000UL
+#define LFXO_CAL_GAIN_DEFAULT                             (_LFXO_CAL_GAIN_DEFAULT << 8)
+
+/* Bit fields for LFXO CFG */
+#define _LFXO_CFG_RESETVALUE                              0x00000000UL
+#define _LFXO_CFG_MASK                                    0x000000FFUL
+#define LFXO_CFG_AGC                                      (0x1UL << 0)
+#define _LFXO_CFG_AGC_SHIFT                               0
+#define _LFXO_CFG_AGC_MASK                                0x1UL
+#define _LFXO_CFG_AGC_DEFAULT                             0x00000000UL
+#define LFXO_CFG_AGC_DEFAULT                              (_LFXO_CFG_AGC_DEFAULT << 0)
+#define LFXO_CFG_HIGHAMPL                                 (0x1UL << 1)
+#define _LFXO_CFG_HIGHAMPL_SHIFT                          1
+#define _LFXO_CFG_HIGHAMPL_MASK                           0x2UL
+#define _LFXO_CFG_HIGHAMPL_DEFAULT                        0x00000000UL
+#define LFXO_CFG_HIGHAMPL_DEFAULT                         (_LFXO_CFG_HIGHAMPL_DEFAULT << 1)
+#define _LFXO_CFG_MODE_SHIFT                              2
+#define _LFXO_CFG_MODE_MASK                               0xCUL
+#define _LFXO_CFG_MODE_DEFAULT                            0x00000000UL
+#define LFXO_CFG_MODE_DEFAULT                             (_LFXO_CFG_MODE_DEFAULT << 2)
+#define _LFXO_CFG_MODE_XTAL                               0x00000000UL
+#define _LFXO_CFG_MODE_BUFEXTCLK                          0x00000001UL
+#define _LFXO_CFG_MODE_DIGEXTCLK                          0x00000002UL
+#define LFXO_CFG_MODE_XTAL                                (_LFXO_CFG_MODE_XTAL << 2)
+#define LFXO_CFG_MODE_BUFEXTCLK                           (_LFXO_CFG_MODE_BUFEXTCLK << 2)
+#define LFXO_CFG_MODE_DIGEXTCLK                           (_LFXO_CFG_MODE_DIGEXTCLK << 2)
+#define _LFXO_CFG_TIMEOUT_SHIFT                           4
+#define _LFXO_CFG_TIMEOUT_MASK                            0xF0UL
+#define _LFXO_CFG_TIMEOUT_DEFAULT                         0x00000000UL
+#define LFXO_CFG_TIMEOUT_DEFAULT                          (_LFXO_CFG_TIMEOUT_DEFAULT << 4)
+#define _LFXO_CFG_TIMEOUT_CYCLES16K                       0x00000001UL
+#define _LFXO_CFG_TIMEOUT_CYCLES1K                        0x00000002UL
+#define _LFXO_CFG_TIMEOUT_CYCLES2                         0x00000003UL
+#define _LFXO_CFG_TIMEOUT_CYCLES256                       0x00000004UL
+#define _LFXO_CFG_TIMEOUT_CYCLES2K                        0x00000005UL
+#define _LFXO_CFG_TIMEOUT_CYCLES32K                       0x00000006UL
+#define _LFXO_CFG_TIMEOUT_CYCLES4K                        0x00000007UL
+#define _LFXO_CFG_TIMEOUT_CYCLES8K                        0x00000008UL
+#define LFXO_CFG_TIMEOUT_CYCLES16K                        (_LFXO_CFG_TIMEOUT_CYCLES16K << 4)
+#define LFXO_CFG_TIMEOUT_CYCLES1K                         (_LFXO_CFG_TIMEOUT_CYCLES1K << 4)
+#define LFXO_CFG_TIMEOUT_CYCLES2                          (_LFXO_CFG_TIMEOUT_CYCLES2 << 4)
+#define LFXO_CFG_TIMEOUT_CYCLES256                        (_LFXO_CFG_TIMEOUT_CYCLES256 << 4)
+#define LFXO_CFG_TIMEOUT_CYCLES2K                         (_LFXO_CFG_TIMEOUT_CYCLES2K << 4)
+#define LFXO_CFG_TIMEOUT_CYCLES32K                        (_LFXO_CFG_TIMEOUT_CYCLES32K << 4)
+#define LFXO_CFG_TIMEOUT_CYCLES4K                         (_LFXO_CFG_TIMEOUT_CYCLES4K << 4)
+#define LFXO_CFG_TIMEOUT_CYCLES8K                         (_LFXO_CFG_TIMEOUT_CYCLES8K << 4)
+
+/* Bit fields for LFXO CTRL */
+#define _LFXO_CTRL_RESETVALUE                             0x00000000UL
+#define _LFXO_CTRL_MASK                                   0x0000000FUL
+#define LFXO_CTRL_DISONDEMAND                             (0x1UL << 0)
+#define _LFXO_CTRL_DISONDEMAND_SHIFT                      0
+#define _LFXO_CTRL_DISONDEMAND_MASK                       0x1UL
+#define _LFXO_CTRL_DISONDEMAND_DEFAULT                    0x00000000UL
+#define LFXO_CTRL_DISONDEMAND_DEFAULT                     (_LFXO_CTRL_DISONDEMAND_DEFAULT << 0)
+#define LFXO_CTRL_FAILDETEM4WUEN                          (0x1UL << 1)
+#define _LFXO_CTRL_FAILDETEM4WUEN_SHIFT                   1
+#define _LFXO_CTRL_FAILDETEM4WUEN_MASK                    0x2UL
+#define _LFXO_CTRL_FAILDETEM4WUEN_DEFAULT                 0x00000000UL
+#define LFXO_CTRL_FAILDETEM4WUEN_DEFAULT                  (_LFXO_CTRL_FAILDETEM4WUEN_DEFAULT << 1)
+#define LFXO_CTRL_FAILDETEN                               (0x1UL << 2)
+#define _LFXO_CTRL_FAILDETEN_SHIFT                        2
+#define _LFXO_CTRL_FAILDETEN_MASK                         0x4UL
+#define _LFXO_CTRL_FAILDETEN_DEFAULT                      0x00000000UL
+#define LFXO_CTRL_FAILDETEN_DEFAULT                       (_LFXO_CTRL_FAILDETEN_DEFAULT << 2)
+#define LFXO_CTRL_FORCEEN                                 (0x1UL << 3)
+#define _LFXO_CTRL_FORCEEN_SHIFT                          3
+#define _LFXO_CTRL_FORCEEN_MASK                           0x8UL
+#define _LFXO_CTRL_FORCEEN_DEFAULT                        0x00000000UL
+#define LFXO_CTRL_FORCEEN_DEFAULT                         (_LFXO_CTRL_FORCEEN_DEFAULT << 3)
+
+/* Bit fields for LFXO LOCK */
+#define _LFXO_LOCK_RESETVALUE                             0x00000000UL
+#define _LFXO_LOCK_MASK                                   0x0000FFFFUL
+#define _LFXO_LOCK_LOCKKEY_SHIFT                          0
+#define _LFXO_LOCK_LOCKKEY_MASK                           0xFFFFUL
+#define _LFXO_LOCK_LOCKKEY_DEFAULT                        0x00000000UL
+#define LFXO_LOCK_LOCKKEY_DEFAULT                         (_LFXO_LOCK_LOCKKEY_DEFAULT << 0)
+#define _LFXO_LOCK_LOCKKEY_UNLOCK                         0x00001A20UL
+#define LFXO_LOCK_LOCKKEY_UNLOCK                          (_LFXO_LOCK_LOCKKEY_UNLOCK << 0)
+
+/* Bit fields for LFXO STATUS */
+#define _LFXO_STATUS_RESETVALUE                           0x00000000UL
+#define _LFXO_STATUS_MASK                                 0x00010001UL
+#define LFXO_STATUS_RDY                                   (0x1UL << 0)
+#define _LFXO_STATUS_RDY_SHIFT                            0
+#define _LFXO_STATUS_RDY_MASK                             0x1UL
+#define _LFXO_STATUS_RDY_DEFAULT                          0x00000000UL
+#define LFXO_STATUS_RDY_DEFAULT                           (_LFXO_STATUS_RDY_DEFAULT << 0)
+#define LFXO_STATUS_ENS                                   (0x1UL << 16)
+#define _LFXO_STATUS_ENS_SHIFT                            16
+#define _LFXO_STATUS_ENS_MASK                             0x10000UL
+#define _LFXO_STATUS_ENS_DEFAULT                          0x00000000UL
+#define LFXO_STATUS_ENS_DEFAULT                           (_LFXO_STATUS_ENS_DEFAULT << 16)
+
+/******************************************************************************
+ * LFRCO
+ *****************************************************************************/
+
+typedef struct {
+  uint32_t RESERVED0[1024];
+  uint32_t RESERVED1[1024];
+  uint32_t RESERVED2[1024];
+  uint32_t RESERVED3[1024];
+} LFRCO_TypeDef;
+
+/******************************************************************************
+ * ULFRCO
+ *****************************************************************************/
+
+typedef struct {
+  uint32_t RESERVED0[1024];
+  uint32_t RESERVED1[1024];
+  uint32_t RESERVED2[1024];
+  uint32_t RESERVED3[1024];
+} ULFRCO_TypeDef;
+
+/******************************************************************************
+ * MSC
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t ADDRB;
+  __IOM uint32_t IEN;
+  __IOM uint32_t IF;
+  __IOM uint32_t IFC;
+  __IOM uint32_t IFS;
+  __IOM uint32_t LOCK;
+  __IOM uint32_t MISCLOCKWORD;
+  __IOM uint32_t READCTRL;
+  __IOM uint32_t STATUS;
+  __IOM uint32_t WDATA;
+  __IOM uint32_t WRITECMD;
+  __IOM uint32_t WRITECTRL;
+  uint32_t RESERVED0[1012];
+  __IOM uint32_t ADDRB_SET;
+  __IOM uint32_t IEN_SET;
+  __IOM uint32_t IF_SET;
+  __IOM uint32_t IFC_SET;
+  __IOM uint32_t IFS_SET;
+  __IOM uint32_t LOCK_SET;
+  __IOM uint32_t MISCLOCKWORD_SET;
+  __IOM uint32_t READCTRL_SET;
+  __IOM uint32_t STATUS_SET;
+  __IOM uint32_t WDATA_SET;
+  __IOM uint32_t WRITECMD_SET;
+  __IOM uint32_t WRITECTRL_SET;
+  uint32_t RESERVED1[1012];
+  __IOM uint32_t ADDRB_CLR;
+  __IOM uint32_t IEN_CLR;
+  __IOM uint32_t IF_CLR;
+  __IOM uint32_t IFC_CLR;
+  __IOM uint32_t IFS_CLR;
+  __IOM uint32_t LOCK_CLR;
+  __IOM uint32_t MISCLOCKWORD_CLR;
+  __IOM uint32_t READCTRL_CLR;
+  __IOM uint32_t STATUS_CLR;
+  __IOM uint32_t WDATA_CLR;
+  __IOM uint32_t WRITECMD_CLR;
+  __IOM uint32_t WRITECTRL_CLR;
+  uint32_t RESERVED2[1012];
+  __IOM uint32_t ADDRB_TGL;
+  __IOM uint32_t IEN_TGL;
+  __IOM uint32_t IF_TGL;
+  __IOM uint32_t IFC_TGL;
+  __IOM uint32_t IFS_TGL;
+  __IOM uint32_t LOCK_TGL;
+  __IOM uint32_t MISCLOCKWORD_TGL;
+  __IOM uint32_t READCTRL_TGL;
+  __IOM uint32_t STATUS_TGL;
+  __IOM uint32_t WDATA_TGL;
+  __IOM uint32_t WRITECMD_TGL;
+  __IOM uint32_t WRITECTRL_TGL;
+  uint32_t RESERVED3[1012];
+} MSC_TypeDef;
+
+/* Bit fields for MSC ADDRB */
+#define _MSC_ADDRB_RESETVALUE                             0x00000000UL
+#define _MSC_ADDRB_MASK                                   0x00000000UL
+
+/* Bit fields for MSC IEN */
+#define _MSC_IEN_RESETVALUE                               0x00000000UL
+#define _MSC_IEN_MASK                                     0x00000000UL
+
+/* Bit fields for MSC IF */
+#define _MSC_IF_RESETVALUE                                0x00000000UL
+#define _MSC_IF_MASK                                      0x00000000UL
+
+/* Bit fields for MSC IFC */
+#define _MSC_IFC_RESETVALUE                               0x00000000UL
+#define _MSC_IFC_MASK                                     0x00000000UL
+
+/* Bit fields for MSC IFS */
+#define _MSC_IFS_RESETVALUE                               0x00000000UL
+#define _MSC_IFS_MASK                                     0x00000000UL
+
+/* Bit fields for MSC LOCK */
+#define _MSC_LOCK_RESETVALUE                              0x00000000UL
+#define _MSC_LOCK_MASK                                    0x0000FFFFUL
+#define _MSC_LOCK_LOCKKEY_SHIFT                           0
+#define _MSC_LOCK_LOCKKEY_MASK                            0xFFFFUL
+#define _MSC_LOCK_LOCKKEY_DEFAULT                         0x00000000UL
+#define MSC_LOCK_LOCKKEY_DEFAULT                          (_MSC_LOCK_LOCKKEY_DEFAULT << 0)
+#define _MSC_LOCK_LOCKKEY_LOCK                            0x00000000UL
+#define _MSC_LOCK_LOCKKEY_UNLOCK                          0x00001B71UL
+#define MSC_LOCK_LOCKKEY_LOCK                             (_MSC_LOCK_LOCKKEY_LOCK << 0)
+#define MSC_LOCK_LOCKKEY_UNLOCK                           (_MSC_LOCK_LOCKKEY_UNLOCK << 0)
+
+/* Bit fields for MSC MISCLOCKWORD */
+#define _MSC_MISCLOCKWORD_RESETVALUE                      0x00000000UL
+#define _MSC_MISCLOCKWORD_MASK                            0x00000001UL
+#define MSC_MISCLOCKWORD_MELOCKBIT                        (0x1UL << 0)
+#define _MSC_MISCLOCKWORD_MELOCKBIT_SHIFT                 0
+#define _MSC_MISCLOCKWORD_MELOCKBIT_MASK                  0x1UL
+#define _MSC_MISCLOCKWORD_MELOCKBIT_DEFAULT               0x00000000UL
+#define MSC_MISCLOCKWORD_MELOCKBIT_DEFAULT                (_MSC_MISCLOCKWORD_MELOCKBIT_DEFAULT << 0)
+
+/* Bit fields for MSC READCTRL */
+#define _MSC_READCTRL_RESETVALUE                          0x00000000UL
+#define _MSC_READCTRL_MASK                                0x00300001UL
+#define MSC_READCTRL_DOUTBUFEN                            (0x1UL << 0)
+#define _MSC_READCTRL_DOUTBUFEN_SHIFT                     0
+#define _MSC_READCTRL_DOUTBUFEN_MASK                      0x1UL
+#define _MSC_READCTRL_DOUTBUFEN_DEFAULT                   0x00000000UL
+#define MSC_READCTRL_DOUTBUFEN_DEFAULT                    (_MSC_READCTRL_DOUTBUFEN_DEFAULT << 0)
+#define _MSC_READCTRL_MODE_SHIFT                          20
+#define _MSC_READCTRL_MODE_MASK                           0x300000UL
+#define _MSC_READCTRL_MODE_DEFAULT                        0x00000000UL
+#define MSC_READCTRL_MODE_DEFAULT                         (_MSC_READCTRL_MODE_DEFAULT << 20)
+#define _MSC_READCTRL_MODE_WS0                            0x00000000UL
+#define _MSC_READCTRL_MODE_WS1                            0x00000001UL
+#define MSC_READCTRL_MODE_WS0                             (_MSC_READCTRL_MODE_WS0 << 20)
+#define MSC_READCTRL_MODE_WS1                             (_MSC_READCTRL_MODE_WS1 << 20)
+
+/* Bit fields for MSC STATUS */
+#define _MSC_STATUS_RESETVALUE                            0x00000000UL
+#define _MSC_STATUS_MASK                                  0x0001001FUL
+#define MSC_STATUS_BUSY                                   (0x1UL << 0)
+#define _MSC_STATUS_BUSY_SHIFT                            0
+#define _MSC_STATUS_BUSY_MASK                             0x1UL
+#define _MSC_STATUS_BUSY_DEFAULT                          0x00000000UL
+#define MSC_STATUS_BUSY_DEFAULT                           (_MSC_STATUS_BUSY_DEFAULT << 0)
+#define MSC_STATUS_INVADDR                                (0x1UL << 1)
+#define _MSC_STATUS_INVADDR_SHIFT                         1
+#define _MSC_STATUS_INVADDR_MASK                          0x2UL
+#define _MSC_STATUS_INVADDR_DEFAULT                       0x00000000UL
+#define MSC_STATUS_INVADDR_DEFAULT                        (_MSC_STATUS_INVADDR_DEFAULT << 1)
+#define MSC_STATUS_LOCKED                                 (0x1UL << 2)
+#define _MSC_STATUS_LOCKED_SHIFT                          2
+#define _MSC_STATUS_LOCKED_MASK                           0x4UL
+#define _MSC_STATUS_LOCKED_DEFAULT                        0x00000000UL
+#define MSC_STATUS_LOCKED_DEFAULT                         (_MSC_STATUS_LOCKED_DEFAULT << 2)
+#define MSC_STATUS_PENDING                                (0x1UL << 3)
+#define _MSC_STATUS_PENDING_SHIFT                         3
+#define _MSC_STATUS_PENDING_MASK                          0x8UL
+#define _MSC_STATUS_PENDING_DEFAULT                       0x00000000UL
+#define MSC_STATUS_PENDING_DEFAULT                        (_MSC_STATUS_PENDING_DEFAULT << 3)
+#define MSC_STATUS_WDATAREADY                             (0x1UL << 4)
+#define _MSC_STATUS_WDATAREADY_SHIFT                      4
+#define _MSC_STATUS_WDATAREADY_MASK                       0x10UL
+#define _MSC_STATUS_WDATAREADY_DEFAULT                    0x00000000UL
+#define MSC_STATUS_WDATAREADY_DEFAULT                     (_MSC_STATUS_WDATAREADY_DEFAULT << 4)
+#define MSC_STATUS_REGLOCK                                (0x1UL << 16)
+#define _MSC_STATUS_REGLOCK_SHIFT                         16
+#define _MSC_STATUS_REGLOCK_MASK                          0x10000UL
+#define _MSC_STATUS_REGLOCK_DEFAULT                       0x00000000UL
+#define MSC_STATUS_REGLOCK_DEFAULT                        (_MSC_STATUS_REGLOCK_DEFAULT << 16)
+#define _MSC_STATUS_REGLOCK_UNLOCKED                      0x00000000UL
+#define _MSC_STATUS_REGLOCK_LOCKED                        0x00000001UL
+#define MSC_STATUS_REGLOCK_UNLOCKED                       (_MSC_STATUS_REGLOCK_UNLOCKED << 16)
+#define MSC_STATUS_REGLOCK_LOCKED                         (_MSC_STATUS_REGLOCK_LOCKED << 16)
+
+/* Bit fields for MSC WDATA */
+#define _MSC_WDATA_RESETVALUE                             0x00000000UL
+#define _MSC_WDATA_MASK                                   0x00000000UL
+
+/* Bit fields for MSC WRITECMD */
+#define _MSC_WRITECMD_RESETVALUE                          0x00000000UL
+#define _MSC_WRITECMD_MASK                                0x00000007UL
+#define MSC_WRITECMD_ERASEMAIN0                           (0x1UL << 0)
+#define _MSC_WRITECMD_ERASEMAIN0_SHIFT                    0
+#define _MSC_WRITECMD_ERASEMAIN0_MASK                     0x1UL
+#define _MSC_WRITECMD_ERASEMAIN0_DEFAULT                  0x00000000UL
+#define MSC_WRITECMD_ERASEMAIN0_DEFAULT                   (_MSC_WRITECMD_ERASEMAIN0_DEFAULT << 0)
+#define MSC_WRITECMD_ERASEPAGE                            (0x1UL << 1)
+#define _MSC_WRITECMD_ERASEPAGE_SHIFT                     1
+#define _MSC_WRITECMD_ERASEPAGE_MASK                      0x2UL
+#define _MSC_WRITECMD_ERASEPAGE_DEFAULT                   0x00000000UL
+#define MSC_WRITECMD_ERASEPAGE_DEFAULT                    (_MSC_WRITECMD_ERASEPAGE_DEFAULT << 1)
+#define MSC_WRITECMD_WRITEEND                             (0x1UL << 2)
+#define _MSC_WRITECMD_WRITEEND_SHIFT                      2
+#define _MSC_WRITECMD_WRITEEND_MASK                       0x4UL
+#define _MSC_WRITECMD_WRITEEND_DEFAULT                    0x00000000UL
+#define MSC_WRITECMD_WRITEEND_DEFAULT                     (_MSC_WRITECMD_WRITEEND_DEFAULT << 2)
+
+/* Bit fields for MSC WRITECTRL */
+#define _MSC_WRITECTRL_RESETVALUE                         0x00000000UL
+#define _MSC_WRITECTRL_MASK                               0x00000001UL
+#define MSC_WRITECTRL_WREN                                (0x1UL << 0)
+#define _MSC_WRITECTRL_WREN_SHIFT                         0
+#define _MSC_WRITECTRL_WREN_MASK                          0x1UL
+#define _MSC_WRITECTRL_WREN_DEFAULT                       0x00000000UL
+#define MSC_WRITECTRL_WREN_DEFAULT                        (_MSC_WRITECTRL_WREN_DEFAULT << 0)
+
+/******************************************************************************
+ * GPIO
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t CTRL;
+  __IOM uint32_t MODEL;
+  __IOM uint32_t MODEH;
+  __IOM uint32_t DOUT;
+  __IOM uint32_t DIN;
+  __IOM uint32_t DOUTTGL;
+} GPIO_PORT_TypeDef;
+
+typedef struct {
+  __IOM uint32_t ROUTEEN;
+  __IOM uint32_t CLKIN0ROUTE;
+  __IOM uint32_t CLKOUT0ROUTE;
+  __IOM uint32_t CLKOUT1ROUTE;
+  __IOM uint32_t CLKOUT2ROUTE;
+} GPIO_CMUROUTE_TypeDef;
+
+typedef struct {
+  __IOM uint32_t ROUTEEN;
+  __IOM uint32_t CTSROUTE;
+  __IOM uint32_t RTSROUTE;
+  __IOM uint32_t RXROUTE;
+  __IOM uint32_t TXROUTE;
+} GPIO_EUARTROUTE_TypeDef;
+
+typedef struct {
+  __IOM uint32_t ROUTEEN;
+  __IOM uint32_t SCLROUTE;
+  __IOM uint32_t SDAROUTE;
+} GPIO_I2CROUTE_TypeDef;
+
+typedef struct {
+  __IOM uint32_t ROUTEEN;
+  __IOM uint32_t CSROUTE;
+  __IOM uint32_t CTSROUTE;
+  __IOM uint32_t RTSROUTE;
+  __IOM uint32_t RXROUTE;
+  __IOM uint32_t CLKROUTE;
+  __IOM uint32_t TXROUTE;
+} GPIO_USARTROUTE_TypeDef;
+
+typedef struct {
+  __IOM uint32_t DBGROUTEPEN;
+  __IOM uint32_t EXTIFALL;
+  __IOM uint32_t EXTIPSELL;
+  __IOM uint32_t EXTIRISE;
+  __IOM uint32_t IEN;
+  __IOM uint32_t IF;
+  __IOM uint32_t IFC;
+  __IOM uint32_t IFS;
+  __IOM uint32_t LOCK;
+  GPIO_PORT_TypeDef P[4];
+  GPIO_CMUROUTE_TypeDef CMUROUTE;
+  GPIO_EUARTROUTE_TypeDef EUARTROUTE[1];
+  GPIO_I2CROUTE_TypeDef I2CROUTE[2];
+  GPIO_USARTROUTE_TypeDef USARTROUTE[2];
+  uint32_t RESERVED0[961];
+  __IOM uint32_t DBGROUTEPEN_SET;
+  __IOM uint32_t EXTIFALL_SET;
+  __IOM uint32_t EXTIPSELL_SET;
+  __IOM uint32_t EXTIRISE_SET;
+  __IOM uint32_t IEN_SET;
+  __IOM uint32_t IF_SET;
+  __IOM uint32_t IFC_SET;
+  __IOM uint32_t IFS_SET;
+  __IOM uint32_t LOCK_SET;
+  GPIO_PORT_TypeDef P_SET[4];
+  GPIO_CMUROUTE_TypeDef CMUROUTE_SET;
+  GPIO_EUARTROUTE_TypeDef EUARTROUTE_SET[1];
+  GPIO_I2CROUTE_TypeDef I2CROUTE_SET[2];
+  GPIO_USARTROUTE_TypeDef USARTROUTE_SET[2];
+  uint32_t RESERVED1[961];
+  __IOM uint32_t DBGROUTEPEN_CLR;
+  __IOM uint32_t EXTIFALL_CLR;
+  __IOM uint32_t EXTIPSELL_CLR;
+  __IOM uint32_t EXTIRISE_CLR;
+  __IOM uint32_t IEN_CLR;
+  __IOM uint32_t IF_CLR;
+  __IOM uint32_t IFC_CLR;
+  __IOM uint32_t IFS_CLR;
+  __IOM uint32_t LOCK_CLR;
+  GPIO_PORT_TypeDef P_CLR[4];
+  GPIO_CMUROUTE_TypeDef CMUROUTE_CLR;
+  GPIO_EUARTROUTE_TypeDef EUARTROUTE_CLR[1];
+  GPIO_I2CROUTE_TypeDef I2CROUTE_CLR[2];
+  GPIO_USARTROUTE_TypeDef USARTROUTE_CLR[2];
+  uint32_t RESERVED2[961];
+  __IOM uint32_t DBGROUTEPEN_TGL;
+  __IOM uint32_t EXTIFALL_TGL;
+  __IOM uint32_t EXTIPSELL_TGL;
+  __IOM uint32_t EXTIRISE_TGL;
+  __IOM uint32_t IEN_TGL;
+  __IOM uint32_t IF_TGL;
+  __IOM uint32_t IFC_TGL;
+  __IOM uint32_t IFS_TGL;
+  __IOM uint32_t LOCK_TGL;
+  GPIO_PORT_TypeDef P_TGL[4];
+  GPIO_CMUROUTE_TypeDef CMUROUTE_TGL;
+  GPIO_EUARTROUTE_TypeDef EUARTROUTE_TGL[1];
+  GPIO_I2CROUTE_TypeDef I2CROUTE_TGL[2];
+  GPIO_USARTROUTE_TypeDef USARTROUTE_TGL[2];
+  uint32_t RESERVED3[961];
+} GPIO_TypeDef;
+
+/* Bit fields for GPIO DBGROUTEPEN */
+#define _GPIO_DBGROUTEPEN_RESETVALUE                      0x0000000FUL
+#define _GPIO_DBGROUTEPEN_MASK                            0x0000000FUL
+#define GPIO_DBGROUTEPEN_SWCLKTCKPEN                      (0x1UL << 0)
+#define _GPIO_DBGROUTEPEN_SWCLKTCKPEN_SHIFT               0
+#define _GPIO_DBGROUTEPEN_SWCLKTCKPEN_MASK                0x1UL
+#define GPIO_DBGROUTEPEN_SWDIOTMSPEN                      (0x1UL << 1)
+#define _GPIO_DBGROUTEPEN_SWDIOTMSPEN_SHIFT               1
+#define _GPIO_DBGROUTEPEN_SWDIOTMSPEN_MASK                0x2UL
+
+/* Bit fields for GPIO EXTIFALL */
+#define _GPIO_EXTIFALL_RESETVALUE                         0x00000000UL
+#define _GPIO_EXTIFALL_MASK                               0x00000000UL
+
+/* Bit fields for GPIO EXTIPSELL */
+#define _GPIO_EXTIPSELL_RESETVALUE                        0x00000000UL
+#define _GPIO_EXTIPSELL_MASK                              0x000001FFUL
+#define _GPIO_EXTIPSELL_EXTIPSEL0_SHIFT                   0
+#define _GPIO_EXTIPSELL_EXTIPSEL0_MASK                    0xFFUL
+#define _GPIO_EXTIPSELL_EXTIPSEL0_DEFAULT                 0x00000000UL
+#define GPIO_EXTIPSELL_EXTIPSEL0_DEFAULT                  (_GPIO_EXTIPSELL_EXTIPSEL0_DEFAULT << 0)
+#define GPIO_EXTIPSELL_EXTIPSEL1                          (0x1UL << 8)
+#define _GPIO_EXTIPSELL_EXTIPSEL1_SHIFT                   8
+#define _GPIO_EXTIPSELL_EXTIPSEL1_MASK                    0x100UL
+#define _GPIO_EXTIPSELL_EXTIPSEL1_DEFAULT                 0x00000000UL
+#define GPIO_EXTIPSELL_EXTIPSEL1_DEFAULT                  (_GPIO_EXTIPSELL_EXTIPSEL1_DEFAULT << 8)
+
+/* Bit fields for GPIO EXTIRISE */
+#define _GPIO_EXTIRISE_RESETVALUE                         0x00000000UL
+#define _GPIO_EXTIRISE_MASK                               0x00000000UL
+
+/* Bit fields for GPIO IEN */
+#define _GPIO_IEN_RESETVALUE                              0x00000000UL
+#define _GPIO_IEN_MASK                                    0x00000000UL
+
+/* Bit fields for GPIO IF */
+#define _GPIO_IF_RESETVALUE                               0x00000000UL
+#define _GPIO_IF_MASK                                     0x00000000UL
+
+/* Bit fields for GPIO IFC */
+#define _GPIO_IFC_RESETVALUE                              0x00000000UL
+#define _GPIO_IFC_MASK                                    0x00000000UL
+
+/* Bit fields for GPIO IFS */
+#define _GPIO_IFS_RESETVALUE                              0x00000000UL
+#define _GPIO_IFS_MASK                                    0x00000000UL
+
+/* Bit fields for GPIO LOCK */
+#define _GPIO_LOCK_RESETVALUE                             0x00000000UL
+#define _GPIO_LOCK_MASK                                   0x0000FFFFUL
+#define _GPIO_LOCK_LOCKKEY_SHIFT                          0
+#define _GPIO_LOCK_LOCKKEY_MASK                           0xFFFFUL
+#define _GPIO_LOCK_LOCKKEY_DEFAULT                        0x00000000UL
+#define GPIO_LOCK_LOCKKEY_DEFAULT                         (_GPIO_LOCK_LOCKKEY_DEFAULT << 0)
+#define _GPIO_LOCK_LOCKKEY_UNLOCK                         0x0000A534UL
+#define GPIO_LOCK_LOCKKEY_UNLOCK                          (_GPIO_LOCK_LOCKKEY_UNLOCK << 0)
+
+/* Bit fields for GPIO P_MODEL */
+#define _GPIO_P_MODEL_RESETVALUE                          0x00000000UL
+#define _GPIO_P_MODEL_MASK                                0x0000000FUL
+#define _GPIO_P_MODEL_MODE0_SHIFT                         0
+#define _GPIO_P_MODEL_MODE0_MASK                          0xFUL
+#define _GPIO_P_MODEL_MODE0_DEFAULT                       0x00000000UL
+#define GPIO_P_MODEL_MODE0_DEFAULT                        (_GPIO_P_MODEL_MODE0_DEFAULT << 0)
+#define _GPIO_P_MODEL_MODE0_DISABLED                      0x00000000UL
+#define _GPIO_P_MODEL_MODE0_INPUT                         0x00000001UL
+#define _GPIO_P_MODEL_MODE0_INPUTPULL                     0x00000002UL
+#define _GPIO_P_MODEL_MODE0_INPUTPULLFILTER               0x00000003UL
+#define _GPIO_P_MODEL_MODE0_PUSHPULL                      0x00000004UL
+#define _GPIO_P_MODEL_MODE0_WIREDAND                      0x00000005UL
+#define _GPIO_P_MODEL_MODE0_WIREDANDFILTER                0x00000006UL
+#define _GPIO_P_MODEL_MODE0_WIREDANDPULLUP                0x00000007UL
+#define _GPIO_P_MODEL_MODE0_WIREDANDPULLUPFILTER          0x00000008UL
+#define _GPIO_P_MODEL_MODE0_WIREDOR                       0x00000009UL
+#define _GPIO_P_MODEL_MODE0_WIREDORPULLDOWN               0x0000000AUL
+#define GPIO_P_MODEL_MODE0_DISABLED                       (_GPIO_P_MODEL_MODE0_DISABLED << 0)
+#define GPIO_P_MODEL_MODE0_INPUT                          (_GPIO_P_MODEL_MODE0_INPUT << 0)
+#define GPIO_P_MODEL_MODE0_INPUTPULL                      (_GPIO_P_MODEL_MODE0_INPUTPULL << 0)
+#define GPIO_P_MODEL_MODE0_INPUTPULLFILTER                (_GPIO_P_MODEL_MODE0_INPUTPULLFILTER << 0)
+#define GPIO_P_MODEL_MODE0_PUSHPULL                       (_GPIO_P_MODEL_MODE0_PUSHPULL << 0)
+#define GPIO_P_MODEL_MODE0_WIREDAND                       (_GPIO_P_MODEL_MODE0_WIREDAND << 0)
+#define GPIO_P_MODEL_MODE0_WIREDANDFILTER                 (_GPIO_P_MODEL_MODE0_WIREDANDFILTER << 0)
+#define GPIO_P_MODEL_MODE0_WIREDANDPULLUP                 (_GPIO_P_MODEL_MODE0_WIREDANDPULLUP << 0)
+#define GPIO_P_MODEL_MODE0_WIREDANDPULLUPFILTER           (_GPIO_P_MODEL_MODE0_WIREDANDPULLUPFILTER << 0)
+#define GPIO_P_MODEL_MODE0_WIREDOR                        (_GPIO_P_MODEL_MODE0_WIREDOR << 0)
+#define GPIO_P_MODEL_MODE0_WIREDORPULLDOWN                (_GPIO_P_MODEL_MODE0_WIREDORPULLDOWN << 0)
+
+/* Bit fields for GPIO CMU_ROUTEEN */
+#define _GPIO_CMU_ROUTEEN_RESETVALUE                      0x00000000UL
+#define _GPIO_CMU_ROUTEEN_MASK                            0x00000001UL
+#define GPIO_CMU_ROUTEEN_CLKOUT0PEN                       (0x1UL << 0)
+#define _GPIO_CMU_ROUTEEN_CLKOUT0PEN_SHIFT                0
+#define _GPIO_CMU_ROUTEEN_CLKOUT0PEN_MASK                 0x1UL
+#define _GPIO_CMU_ROUTEEN_CLKOUT0PEN_DEFAULT              0x00000000UL
+#define GPIO_CMU_ROUTEEN_CLKOUT0PEN_DEFAULT               (_GPIO_CMU_ROUTEEN_CLKOUT0PEN_DEFAULT << 0)
+
+/* Bit fields for GPIO CMU_CLKOUT0ROUTE */
+#define _GPIO_CMU_CLKOUT0ROUTE_RESETVALUE                 0x00000000UL
+#define _GPIO_CMU_CLKOUT0ROUTE_MASK                       0x00000003UL
+#define GPIO_CMU_CLKOUT0ROUTE_PIN                         (0x1UL << 0)
+#define _GPIO_CMU_CLKOUT0ROUTE_PIN_SHIFT                  0
+#define _GPIO_CMU_CLKOUT0ROUTE_PIN_MASK                   0x1UL
+#define _GPIO_CMU_CLKOUT0ROUTE_PIN_DEFAULT                0x00000000UL
+#define GPIO_CMU_CLKOUT0ROUTE_PIN_DEFAULT                 (_GPIO_CMU_CLKOUT0ROUTE_PIN_DEFAULT << 0)
+#define GPIO_CMU_CLKOUT0ROUTE_PORT                        (0x1UL << 1)
+#define _GPIO_CMU_CLKOUT0ROUTE_PORT_SHIFT                 1
+#define _GPIO_CMU_CLKOUT0ROUTE_PORT_MASK                  0x2UL
+#define _GPIO_CMU_CLKOUT0ROUTE_PORT_DEFAULT               0x00000000UL
+#define GPIO_CMU_CLKOUT0ROUTE_PORT_DEFAULT                (_GPIO_CMU_CLKOUT0ROUTE_PORT_DEFAULT << 1)
+
+/* Bit fields for GPIO CMU_CLKOUT1ROUTE */
+#define _GPIO_CMU_CLKOUT1ROUTE_RESETVALUE                 0x00000000UL
+#define _GPIO_CMU_CLKOUT1ROUTE_MASK                       0x00000003UL
+#define GPIO_CMU_CLKOUT1ROUTE_PIN                         (0x1UL << 0)
+#define _GPIO_CMU_CLKOUT1ROUTE_PIN_SHIFT                  0
+#define _GPIO_CMU_CLKOUT1ROUTE_PIN_MASK                   0x1UL
+#define _GPIO_CMU_CLKOUT1ROUTE_PIN_DEFAULT                0x00000000UL
+#define GPIO_CMU_CLKOUT1ROUTE_PIN_DEFAULT                 (_GPIO_CMU_CLKOUT1ROUTE_PIN_DEFAULT << 0)
+#define GPIO_CMU_CLKOUT1ROUTE_PORT                        (0x1UL << 1)
+#define _GPIO_CMU_CLKOUT1ROUTE_PORT_SHIFT                 1
+#define _GPIO_CMU_CLKOUT1ROUTE_PORT_MASK                  0x2UL
+#define _GPIO_CMU_CLKOUT1ROUTE_PORT_DEFAULT               0x00000000UL
+#define GPIO_CMU_CLKOUT1ROUTE_PORT_DEFAULT                (_GPIO_CMU_CLKOUT1ROUTE_PORT_DEFAULT << 1)
+
+/* Bit fields for GPIO CMU_CLKOUT2ROUTE */
+#define _GPIO_CMU_CLKOUT2ROUTE_RESETVALUE                 0x00000000UL
+#define _GPIO_CMU_CLKOUT2ROUTE_MASK                       0x00000003UL
+#define GPIO_CMU_CLKOUT2ROUTE_PIN                         (0x1UL << 0)
+#define _GPIO_CMU_CLKOUT2ROUTE_PIN_SHIFT                  0
+#define _GPIO_CMU_CLKOUT2ROUTE_PIN_MASK                   0x1UL
+#define _GPIO_CMU_CLKOUT2ROUTE_PIN_DEFAULT                0x00000000UL
+#define GPIO_CMU_CLKOUT2ROUTE_PIN_DEFAULT                 (_GPIO_CMU_CLKOUT2ROUTE_PIN_DEFAULT << 0)
+#define GPIO_CMU_CLKOUT2ROUTE_PORT                        (0x1UL << 1)
+#define _GPIO_CMU_CLKOUT2ROUTE_PORT_SHIFT                 1
+#define _GPIO_CMU_CLKOUT2ROUTE_PORT_MASK                  0x2UL
+#define _GPIO_CMU_CLKOUT2ROUTE_PORT_DEFAULT               0x00000000UL
+#define GPIO_CMU_CLKOUT2ROUTE_PORT_DEFAULT                (_GPIO_CMU_CLKOUT2ROUTE_PORT_DEFAULT << 1)
+
+/* Bit fields for GPIO EUART_ROUTEEN */
+#define _GPIO_EUART_ROUTEEN_RESETVALUE                    0x00000000UL
+#define _GPIO_EUART_ROUTEEN_MASK                          0x00000001UL
+#define GPIO_EUART_ROUTEEN_RTSPEN                         (0x1UL << 0)
+#define _GPIO_EUART_ROUTEEN_RTSPEN_SHIFT                  0
+#define _GPIO_EUART_ROUTEEN_RTSPEN_MASK                   0x1UL
+#define _GPIO_EUART_ROUTEEN_RTSPEN_DEFAULT                0x00000000UL
+#define GPIO_EUART_ROUTEEN_RTSPEN_DEFAULT                 (_GPIO_EUART_ROUTEEN_RTSPEN_DEFAULT << 0)
+
+/* Bit fields for GPIO USART_ROUTEEN */
+#define _GPIO_USART_ROUTEEN_RESETVALUE                    0x00000000UL
+#define _GPIO_USART_ROUTEEN_MASK                          0x00000001UL
+#define GPIO_USART_ROUTEEN_RTSPEN                         (0x1UL << 0)
+#define _GPIO_USART_ROUTEEN_RTSPEN_SHIFT                  0
+#define _GPIO_USART_ROUTEEN_RTSPEN_MASK                   0x1UL
+#define _GPIO_USART_ROUTEEN_RTSPEN_DEFAULT                0x00000000UL
+#define GPIO_USART_ROUTEEN_RTSPEN_DEFAULT                 (_GPIO_USART_ROUTEEN_RTSPEN_DEFAULT << 0)
+
+/******************************************************************************
+ * LDMA
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t CFG;
+  __IOM uint32_t LOOP;
+  __IOM uint32_t CTRL;
+  __IOM uint32_t SRC;
+  __IOM uint32_t DST;
+  __IOM uint32_t LINK;
+} LDMA_CH_TypeDef;
+
+typedef struct {
+  __IOM uint32_t CHDIS;
+  __IOM uint32_t CHDONE;
+  __IOM uint32_t CHEN;
+  __IOM uint32_t CHSTATUS;
+  __IOM uint32_t CTRL;
+  __IOM uint32_t DBGHALT;
+  __IOM uint32_t EN;
+  __IOM uint32_t IEN;
+  __IOM uint32_t IF;
+  __IOM uint32_t IFC;
+  __IOM uint32_t IFS;
+  __IOM uint32_t LINKLOAD;
+  __IOM uint32_t REQDIS;
+  __IOM uint32_t SYNCHWEN;
+  LDMA_CH_TypeDef CH[8];
+  uint32_t RESERVED0[962];
+  __IOM uint32_t CHDIS_SET;
+  __IOM uint32_t CHDONE_SET;
+  __IOM uint32_t CHEN_SET;
+  __IOM uint32_t CHSTATUS_SET;
+  __IOM uint32_t CTRL_SET;
+  __IOM uint32_t DBGHALT_SET;
+  __IOM uint32_t EN_SET;
+  __IOM uint32_t IEN_SET;
+  __IOM uint32_t IF_SET;
+  __IOM uint32_t IFC_SET;
+  __IOM uint32_t IFS_SET;
+  __IOM uint32_t LINKLOAD_SET;
+  __IOM uint32_t REQDIS_SET;
+  __IOM uint32_t SYNCHWEN_SET;
+  LDMA_CH_TypeDef CH_SET[8];
+  uint32_t RESERVED1[962];
+  __IOM uint32_t CHDIS_CLR;
+  __IOM uint32_t CHDONE_CLR;
+  __IOM uint32_t CHEN_CLR;
+  __IOM uint32_t CHSTATUS_CLR;
+  __IOM uint32_t CTRL_CLR;
+  __IOM uint32_t DBGHALT_CLR;
+  __IOM uint32_t EN_CLR;
+  __IOM uint32_t IEN_CLR;
+  __IOM uint32_t IF_CLR;
+  __IOM uint32_t IFC_CLR;
+  __IOM uint32_t IFS_CLR;
+  __IOM uint32_t LINKLOAD_CLR;
+  __IOM uint32_t REQDIS_CLR;
+  __IOM uint32_t SYNCHWEN_CLR;
+  LDMA_CH_TypeDef CH_CLR[8];
+  uint32_t RESERVED2[962];
+  __IOM uint32_t CHDIS_TGL;
+  __IOM uint32_t CHDONE_TGL;
+  __IOM uint32_t CHEN_TGL;
+  __IOM uint32_t CHSTATUS_TGL;
+  __IOM uint32_t CTRL_TGL;
+  __IOM uint32_t DBGHALT_TGL;
+  __IOM uint32_t EN_TGL;
+  __IOM uint32_t IEN_TGL;
+  __IOM uint32_t IF_TGL;
+  __IOM uint32_t IFC_TGL;
+  __IOM uint32_t IFS_TGL;
+  __IOM uint32_t LINKLOAD_TGL;
+  __IOM uint32_t REQDIS_TGL;
+  __IOM uint32_t SYNCHWEN_TGL;
+  LDMA_CH_TypeDef CH_TGL[8];
+  uint32_t RESERVED3[962];
+} LDMA_TypeDef;
+
+/* Bit fields for LDMA CHDIS */
+#define _LDMA_CHDIS_RESETVALUE                            0x00000000UL
+#define _LDMA_CHDIS_MASK                                  0x000000FFUL
+#define _LDMA_CHDIS_CHDIS_SHIFT                           0
+#define _LDMA_CHDIS_CHDIS_MASK                            0xFFUL
+#define _LDMA_CHDIS_CHDIS_DEFAULT                         0x00000000UL
+#define LDMA_CHDIS_CHDIS_DEFAULT                          (_LDMA_CHDIS_CHDIS_DEFAULT << 0)
+
+/* Bit fields for LDMA CHDONE */
+#define _LDMA_CHDONE_RESETVALUE                           0x00000000UL
+#define _LDMA_CHDONE_MASK                                 0x000000FFUL
+#define _LDMA_CHDONE_CHDONE_SHIFT                         0
+#define _LDMA_CHDONE_CHDONE_MASK                          0xFFUL
+#define _LDMA_CHDONE_CHDONE_DEFAULT                       0x00000000UL
+#define LDMA_CHDONE_CHDONE_DEFAULT                        (_LDMA_CHDONE_CHDONE_DEFAULT << 0)
+
+/* Bit fields for LDMA CHEN */
+#define _LDMA_CHEN_RESETVALUE                             0x00000000UL
+#define _LDMA_CHEN_MASK                                   0x000000FFUL
+#define _LDMA_CHEN_CHEN_SHIFT                             0
+#define _LDMA_CHEN_CHEN_MASK                              0xFFUL
+#define _LDMA_CHEN_CHEN_DEFAULT                           0x00000000UL
+#define LDMA_CHEN_CHEN_DEFAULT                            (_LDMA_CHEN_CHEN_DEFAULT << 0)
+
+/* Bit fields for LDMA CHSTATUS */
+#define _LDMA_CHSTATUS_RESETVALUE                         0x00000000UL
+#define _LDMA_CHSTATUS_MASK                               0x000000FFUL
+#define _LDMA_CHSTATUS_CHSTATUS_SHIFT                     0
+#define _LDMA_CHSTATUS_CHSTATUS_MASK                      0xFFUL
+#define _LDMA_CHSTATUS_CHSTATUS_DEFAULT                   0x00000000UL
+#define LDMA_CHSTATUS_CHSTATUS_DEFAULT                    (_LDMA_CHSTATUS_CHSTATUS_DEFAULT << 0)
+
+/* Bit fields for LDMA CTRL */
+#define _LDMA_CTRL_RESETVALUE                             0x00000000UL
+#define _LDMA_CTRL_MASK                                   0x1F000000UL
+#define _LDMA_CTRL_NUMFIXED_SHIFT                         24
+#define _LDMA_CTRL_NUMFIXED_MASK                          0x1F000000UL
+#define _LDMA_CTRL_NUMFIXED_DEFAULT                       0x00000000UL
+#define LDMA_CTRL_NUMFIXED_DEFAULT                        (_LDMA_CTRL_NUMFIXED_DEFAULT << 24)
+
+/* Bit fields for LDMA DBGHALT */
+#define _LDMA_DBGHALT_RESETVALUE                          0x00000000UL
+#define _LDMA_DBGHALT_MASK                                0x000000FFUL
+#define _LDMA_DBGHALT_DBGHALT_SHIFT                       0
+#define _LDMA_DBGHALT_DBGHALT_MASK                        0xFFUL
+#define _LDMA_DBGHALT_DBGHALT_DEFAULT                     0x00000000UL
+#define LDMA_DBGHALT_DBGHALT_DEFAULT                      (_LDMA_DBGHALT_DBGHALT_DEFAULT << 0)
+
+/* Bit fields for LDMA EN */
+#define _LDMA_EN_RESETVALUE                               0x00000000UL
+#define _LDMA_EN_MASK                                     0x00000001UL
+#define LDMA_EN_EN                                        (0x1UL << 0)
+#define _LDMA_EN_EN_SHIFT                                 0
+#define _LDMA_EN_EN_MASK                                  0x1UL
+#define _LDMA_EN_EN_DEFAULT                               0x00000000UL
+#define LDMA_EN_EN_DEFAULT                                (_LDMA_EN_EN_DEFAULT << 0)
+
+/* Bit fields for LDMA IEN */
+#define _LDMA_IEN_RESETVALUE                              0x00000000UL
+#define _LDMA_IEN_MASK                                    0x800000FFUL
+#define _LDMA_IEN_CHDONE_SHIFT                            0
+#define _LDMA_IEN_CHDONE_MASK                             0xFFUL
+#define _LDMA_IEN_CHDONE_DEFAULT                          0x00000000UL
+#define LDMA_IEN_CHDONE_DEFAULT                           (_LDMA_IEN_CHDONE_DEFAULT << 0)
+#define LDMA_IEN_ERROR                                    (0x1UL << 31)
+#define _LDMA_IEN_ERROR_SHIFT                             31
+#define _LDMA_IEN_ERROR_MASK                              0x80000000UL
+#define _LDMA_IEN_ERROR_DEFAULT                           0x00000000UL
+#define LDMA_IEN_ERROR_DEFAULT                            (_LDMA_IEN_ERROR_DEFAULT << 31)
+
+/* Bit fields for LDMA IF */
+#define _LDMA_IF_RESETVALUE                               0x00000000UL
+#define _LDMA_IF_MASK                                     0x800000FFUL
+#define _LDMA_IF_DONE_SHIFT                               0
+#define _LDMA_IF_DONE_MASK                                0xFFUL
+#define _LDMA_IF_DONE_DEFAULT                             0x00000000UL
+#define LDMA_IF_DONE_DEFAULT                              (_LDMA_IF_DONE_DEFAULT << 0)
+#define LDMA_IF_ERROR                                     (0x1UL << 31)
+#define _LDMA_IF_ERROR_SHIFT                              31
+#define _LDMA_IF_ERROR_MASK                               0x80000000UL
+#define _LDMA_IF_ERROR_DEFAULT                            0x00000000UL
+#define LDMA_IF_ERROR_DEFAULT                             (_LDMA_IF_ERROR_DEFAULT << 31)
+
+/* Bit fields for LDMA IFC */
+#define _LDMA_IFC_RESETVALUE                              0x00000000UL
+#define _LDMA_IFC_MASK                                    0x000000FFUL
+#define _LDMA_IFC_DONE_SHIFT                              0
+#define _LDMA_IFC_DONE_MASK                               0xFFUL
+#define _LDMA_IFC_DONE_DEFAULT                            0x00000000UL
+#define LDMA_IFC_DONE_DEFAULT                             (_LDMA_IFC_DONE_DEFAULT << 0)
+
+/* Bit fields for LDMA IFS */
+#define _LDMA_IFS_RESETVALUE                              0x00000000UL
+#define _LDMA_IFS_MASK                                    0x000000FFUL
+#define _LDMA_IFS_DONE_SHIFT                              0
+#define _LDMA_IFS_DONE_MASK                               0xFFUL
+#define _LDMA_IFS_DONE_DEFAULT                            0x00000000UL
+#define LDMA_IFS_DONE_DEFAULT                             (_LDMA_IFS_DONE_DEFAULT << 0)
+
+/* Bit fields for LDMA LINKLOAD */
+#define _LDMA_LINKLOAD_RESETVALUE                         0x00000000UL
+#define _LDMA_LINKLOAD_MASK                               0x000000FFUL
+#define _LDMA_LINKLOAD_LINKLOAD_SHIFT                     0
+#define _LDMA_LINKLOAD_LINKLOAD_MASK                      0xFFUL
+#define _LDMA_LINKLOAD_LINKLOAD_DEFAULT                   0x00000000UL
+#define LDMA_LINKLOAD_LINKLOAD_DEFAULT                    (_LDMA_LINKLOAD_LINKLOAD_DEFAULT << 0)
+
+/* Bit fields for LDMA REQDIS */
+#define _LDMA_REQDIS_RESETVALUE                           0x00000000UL
+#define _LDMA_REQDIS_MASK                                 0x000000FFUL
+#define _LDMA_REQDIS_REQDIS_SHIFT                         0
+#define _LDMA_REQDIS_REQDIS_MASK                          0xFFUL
+#define _LDMA_REQDIS_REQDIS_DEFAULT                       0x00000000UL
+#define LDMA_REQDIS_REQDIS_DEFAULT                        (_LDMA_REQDIS_REQDIS_DEFAULT << 0)
+
+/* Bit fields for LDMA SYNCHWEN */
+#define _LDMA_SYNCHWEN_RESETVALUE                         0x00000000UL
+#define _LDMA_SYNCHWEN_MASK                               0x00FF00FFUL
+#define _LDMA_SYNCHWEN_SYNCSETEN_SHIFT                    0
+#define _LDMA_SYNCHWEN_SYNCSETEN_MASK                     0xFFUL
+#define _LDMA_SYNCHWEN_SYNCSETEN_DEFAULT                  0x00000000UL
+#define LDMA_SYNCHWEN_SYNCSETEN_DEFAULT                   (_LDMA_SYNCHWEN_SYNCSETEN_DEFAULT << 0)
+#define _LDMA_SYNCHWEN_SYNCCLREN_SHIFT                    16
+#define _LDMA_SYNCHWEN_SYNCCLREN_MASK                     0xFF0000UL
+#define _LDMA_SYNCHWEN_SYNCCLREN_DEFAULT                  0x00000000UL
+#define LDMA_SYNCHWEN_SYNCCLREN_DEFAULT                   (_LDMA_SYNCHWEN_SYNCCLREN_DEFAULT << 16)
+
+/* Bit fields for LDMA CH_CFG */
+#define _LDMA_CH_CFG_RESETVALUE                           0x00000000UL
+#define _LDMA_CH_CFG_MASK                                 0x00330000UL
+#define _LDMA_CH_CFG_ARBSLOTS_SHIFT                       16
+#define _LDMA_CH_CFG_ARBSLOTS_MASK                        0x30000UL
+#define _LDMA_CH_CFG_ARBSLOTS_DEFAULT                     0x00000000UL
+#define LDMA_CH_CFG_ARBSLOTS_DEFAULT                      (_LDMA_CH_CFG_ARBSLOTS_DEFAULT << 16)
+#define _LDMA_CH_CFG_ARBSLOTS_ONE                         0x00000000UL
+#define _LDMA_CH_CFG_ARBSLOTS_TWO                         0x00000001UL
+#define _LDMA_CH_CFG_ARBSLOTS_FOUR                        0x00000002UL
+#define _LDMA_CH_CFG_ARBSLOTS_EIGHT                       0x00000003UL
+#define LDMA_CH_CFG_ARBSLOTS_ONE                          (_LDMA_CH_CFG_ARBSLOTS_ONE << 16)
+#define LDMA_CH_CFG_ARBSLOTS_TWO                          (_LDMA_CH_CFG_ARBSLOTS_TWO << 16)
+#define LDMA_CH_CFG_ARBSLOTS_FOUR                         (_LDMA_CH_CFG_ARBSLOTS_FOUR << 16)
+#define LDMA_CH_CFG_ARBSLOTS_EIGHT                        (_LDMA_CH_CFG_ARBSLOTS_EIGHT << 16)
+#define LDMA_CH_CFG_SRCINCSIGN                            (0x1UL << 20)
+#define _LDMA_CH_CFG_SRCINCSIGN_SHIFT                     20
+#define _LDMA_CH_CFG_SRCINCSIGN_MASK                      0x100000UL
+#define _LDMA_CH_CFG_SRCINCSIGN_DEFAULT                   0x00000000UL
+#define LDMA_CH_CFG_SRCINCSIGN_DEFAULT                    (_LDMA_CH_CFG_SRCINCSIGN_DEFAULT << 20)
+#define _LDMA_CH_CFG_SRCINCSIGN_POSITIVE                  0x00000000UL
+#define _LDMA_CH_CFG_SRCINCSIGN_NEGATIVE                  0x00000001UL
+#define LDMA_CH_CFG_SRCINCSIGN_POSITIVE                   (_LDMA_CH_CFG_SRCINCSIGN_POSITIVE << 20)
+#define LDMA_CH_CFG_SRCINCSIGN_NEGATIVE                   (_LDMA_CH_CFG_SRCINCSIGN_NEGATIVE << 20)
+#define LDMA_CH_CFG_DSTINCSIGN                            (0x1UL << 21)
+#define _LDMA_CH_CFG_DSTINCSIGN_SHIFT                     21
+#define _LDMA_CH_CFG_DSTINCSIGN_MASK                      0x200000UL
+#define _LDMA_CH_CFG_DSTINCSIGN_DEFAULT                   0x00000000UL
+#define LDMA_CH_CFG_DSTINCSIGN_DEFAULT                    (_LDMA_CH_CFG_DSTINCSIGN_DEFAULT << 21)
+#define _LDMA_CH_CFG_DSTINCSIGN_POSITIVE                  0x00000000UL
+#define _LDMA_CH_CFG_DSTINCSIGN_NEGATIVE                  0x00000001UL
+#define LDMA_CH_CFG_DSTINCSIGN_POSITIVE                   (_LDMA_CH_CFG_DSTINCSIGN_POSITIVE << 21)
+#define LDMA_CH_CFG_DSTINCSIGN_NEGATIVE                   (_LDMA_CH_CFG_DSTINCSIGN_NEGATIVE << 21)
+
+/* Bit fields for LDMA CH_LOOP */
+#define _LDMA_CH_LOOP_RESETVALUE                          0x00000000UL
+#define _LDMA_CH_LOOP_MASK                                0x000000FFUL
+#define _LDMA_CH_LOOP_LOOPCNT_SHIFT                       0
+#define _LDMA_CH_LOOP_LOOPCNT_MASK                        0xFFUL
+#define _LDMA_CH_LOOP_LOOPCNT_DEFAULT                     0x00000000UL
+#define LDMA_CH_LOOP_LOOPCNT_DEFAULT                      (_LDMA_CH_LOOP_LOOPCNT_DEFAULT << 0)
+
+/* Bit fields for LDMA CH_CTRL */
+#define _LDMA_CH_CTRL_RESETVALUE                          0x00000000UL
+#define _LDMA_CH_CTRL_MASK                                0xFFFFFFFBUL
+#define _LDMA_CH_CTRL_STRUCTTYPE_SHIFT                    0
+#define _LDMA_CH_CTRL_STRUCTTYPE_MASK                     0x3UL
+#define _LDMA_CH_CTRL_STRUCTTYPE_DEFAULT                  0x00000000UL
+#define LDMA_CH_CTRL_STRUCTTYPE_DEFAULT                   (_LDMA_CH_CTRL_STRUCTTYPE_DEFAULT << 0)
+#define _LDMA_CH_CTRL_STRUCTTYPE_TRANSFER                 0x00000000UL
+#define _LDMA_CH_CTRL_STRUCTTYPE_SYNCHRONIZE              0x00000001UL
+#define _LDMA_CH_CTRL_STRUCTTYPE_WRITE                    0x00000002UL
+#define LDMA_CH_CTRL_STRUCTTYPE_TRANSFER                  (_LDMA_CH_CTRL_STRUCTTYPE_TRANSFER << 0)
+#define LDMA_CH_CTRL_STRUCTTYPE_SYNCHRONIZE               (_LDMA_CH_CTRL_STRUCTTYPE_SYNCHRONIZE << 0)
+#define LDMA_CH_CTRL_STRUCTTYPE_WRITE                     (_LDMA_CH_CTRL_STRUCTTYPE_WRITE << 0)
+#define LDMA_CH_CTRL_STRUCTREQ                            (0x1UL << 3)
+#define _LDMA_CH_CTRL_STRUCTREQ_SHIFT                     3
+#define _LDMA_CH_CTRL_STRUCTREQ_MASK                      0x8UL
+#define _LDMA_CH_CTRL_STRUCTREQ_DEFAULT                   0x00000000UL
+#define LDMA_CH_CTRL_STRUCTREQ_DEFAULT                    (_LDMA_CH_CTRL_STRUCTREQ_DEFAULT << 3)
+#define _LDMA_CH_CTRL_XFERCNT_SHIFT                       4
+#define _LDMA_CH_CTRL_XFERCNT_MASK                        0x7FF0UL
+#define _LDMA_CH_CTRL_XFERCNT_DEFAULT                     0x00000000UL
+#define LDMA_CH_CTRL_XFERCNT_DEFAULT                      (_LDMA_CH_CTRL_XFERCNT_DEFAULT << 4)
+#define LDMA_CH_CTRL_BYTESWAP                             (0x1UL << 15)
+#define _LDMA_CH_CTRL_BYTESWAP_SHIFT                      15
+#define _LDMA_CH_CTRL_BYTESWAP_MASK                       0x8000UL
+#define _LDMA_CH_CTRL_BYTESWAP_DEFAULT                    0x00000000UL
+#define LDMA_CH_CTRL_BYTESWAP_DEFAULT                     (_LDMA_CH_CTRL_BYTESWAP_DEFAULT << 15)
+#define _LDMA_CH_CTRL_BLOCKSIZE_SHIFT                     16
+#define _LDMA_CH_CTRL_BLOCKSIZE_MASK                      0xF0000UL
+#define _LDMA_CH_CTRL_BLOCKSIZE_DEFAULT                   0x00000000UL
+#define LDMA_CH_CTRL_BLOCKSIZE_DEFAULT                    (_LDMA_CH_CTRL_BLOCKSIZE_DEFAULT << 16)
+#define _LDMA_CH_CTRL_BLOCKSIZE_UNIT1                     0x00000000UL
+#define _LDMA_CH_CTRL_BLOCKSIZE_UNIT2                     0x00000001UL
+#define _LDMA_CH_CTRL_BLOCKSIZE_UNIT3                     0x00000002UL
+#define _LDMA_CH_CTRL_BLOCKSIZE_UNIT4                     0x00000003UL
+#define _LDMA_CH_CTRL_BLOCKSIZE_UNIT6                     0x00000004UL
+#define _LDMA_CH_CTRL_BLOCKSIZE_UNIT8                     0x00000005UL
+#define _LDMA_CH_CTRL_BLOCKSIZE_UNIT16                    0x00000007UL
+#define _LDMA_CH_CTRL_BLOCKSIZE_UNIT32                    0x00000009UL
+#define _LDMA_CH_CTRL_BLOCKSIZE_UNIT64                    0x0000000AUL
+#define _LDMA_CH_CTRL_BLOCKSIZE_UNIT128                   0x0000000BUL
+#define _LDMA_CH_CTRL_BLOCKSIZE_UNIT256                   0x0000000CUL
+#define _LDMA_CH_CTRL_BLOCKSIZE_UNIT512                   0x0000000DUL
+#define _LDMA_CH_CTRL_BLOCKSIZE_UNIT1024                  0x0000000EUL
+#define _LDMA_CH_CTRL_BLOCKSIZE_ALL                       0x0000000FUL
+#define LDMA_CH_CTRL_BLOCKSIZE_UNIT1                      (_LDMA_CH_CTRL_BLOCKSIZE_UNIT1 << 16)
+#define LDMA_CH_CTRL_BLOCKSIZE_UNIT2                      (_LDMA_CH_CTRL_BLOCKSIZE_UNIT2 << 16)
+#define LDMA_CH_CTRL_BLOCKSIZE_UNIT3                      (_LDMA_CH_CTRL_BLOCKSIZE_UNIT3 << 16)
+#define LDMA_CH_CTRL_BLOCKSIZE_UNIT4                      (_LDMA_CH_CTRL_BLOCKSIZE_UNIT4 << 16)
+#define LDMA_CH_CTRL_BLOCKSIZE_UNIT6                      (_LDMA_CH_CTRL_BLOCKSIZE_UNIT6 << 16)
+#define LDMA_CH_CTRL_BLOCKSIZE_UNIT8                      (_LDMA_CH_CTRL_BLOCKSIZE_UNIT8 << 16)
+#define LDMA_CH_CTRL_BLOCKSIZE_UNIT16                     (_LDMA_CH_CTRL_BLOCKSIZE_UNIT16 << 16)
+#define LDMA_CH_CTRL_BLOCKSIZE_UNIT32                     (_LDMA_CH_CTRL_BLOCKSIZE_UNIT32 << 16)
+#define LDMA_CH_CTRL_BLOCKSIZE_UNIT64                     (_LDMA_CH_CTRL_BLOCKSIZE_UNIT64 << 16)
+#define LDMA_CH_CTRL_BLOCKSIZE_UNIT128                    (_LDMA_CH_CTRL_BLOCKSIZE_UNIT128 << 16)
+#define LDMA_CH_CTRL_BLOCKSIZE_UNIT256                    (_LDMA_CH_CTRL_BLOCKSIZE_UNIT256 << 16)
+#define LDMA_CH_CTRL_BLOCKSIZE_UNIT512                    (_LDMA_CH_CTRL_BLOCKSIZE_UNIT512 << 16)
+#define LDMA_CH_CTRL_BLOCKSIZE_UNIT1024                   (_LDMA_CH_CTRL_BLOCKSIZE_UNIT1024 << 16)
+#define LDMA_CH_CTRL_BLOCKSIZE_ALL                        (_LDMA_CH_CTRL_BLOCKSIZE_ALL << 16)
+#define LDMA_CH_CTRL_DONEIEN                              (0x1UL << 20)
+#define _LDMA_CH_CTRL_DONEIEN_SHIFT                       20
+#define _LDMA_CH_CTRL_DONEIEN_MASK                        0x100000UL
+#define _LDMA_CH_CTRL_DONEIEN_DEFAULT                     0x00000000UL
+#define LDMA_CH_CTRL_DONEIEN_DEFAULT                      (_LDMA_CH_CTRL_DONEIEN_DEFAULT << 20)
+#define LDMA_CH_CTRL_REQMODE                              (0x1UL << 21)
+#define _LDMA_CH_CTRL_REQMODE_SHIFT                       21
+#define _LDMA_CH_CTRL_REQMODE_MASK                        0x200000UL
+#define _LDMA_CH_CTRL_REQMODE_DEFAULT                     0x00000000UL
+#define LDMA_CH_CTRL_REQMODE_DEFAULT                      (_LDMA_CH_CTRL_REQMODE_DEFAULT << 21)
+#define _LDMA_CH_CTRL_REQMODE_BLOCK                       0x00000000UL
+#define _LDMA_CH_CTRL_REQMODE_ALL                         0x00000001UL
+#define LDMA_CH_CTRL_REQMODE_BLOCK                        (_LDMA_CH_CTRL_REQMODE_BLOCK << 21)
+#define LDMA_CH_CTRL_REQMODE_ALL                          (_LDMA_CH_CTRL_REQMODE_ALL << 21)
+#define LDMA_CH_CTRL_DECLOOPCNT                           (0x1UL << 22)
+#define _LDMA_CH_CTRL_DECLOOPCNT_SHIFT                    22
+#define _LDMA_CH_CTRL_DECLOOPCNT_MASK                     0x400000UL
+#define _LDMA_CH_CTRL_DECLOOPCNT_DEFAULT                  0x00000000UL
+#define LDMA_CH_CTRL_DECLOOPCNT_DEFAULT                   (_LDMA_CH_CTRL_DECLOOPCNT_DEFAULT << 22)
+#define LDMA_CH_CTRL_IGNORESREQ                           (0x1UL << 23)
+#define _LDMA_CH_CTRL_IGNORESREQ_SHIFT                    23
+#define _LDMA_CH_CTRL_IGNORESREQ_MASK                     0x800000UL
+#define _LDMA_CH_CTRL_IGNORESREQ_DEFAULT                  0x00000000UL
+#define LDMA_CH_CTRL_IGNORESREQ_DEFAULT                   (_LDMA_CH_CTRL_IGNORESREQ_DEFAULT << 23)
+#define _LDMA_CH_CTRL_SRCINC_SHIFT                        24
+#define _LDMA_CH_CTRL_SRCINC_MASK                         0x3000000UL
+#define _LDMA_CH_CTRL_SRCINC_DEFAULT                      0x00000000UL
+#define LDMA_CH_CTRL_SRCINC_DEFAULT                       (_LDMA_CH_CTRL_SRCINC_DEFAULT << 24)
+#define _LDMA_CH_CTRL_SRCINC_ONE                          0x00000000UL
+#define _LDMA_CH_CTRL_SRCINC_TWO                          0x00000001UL
+#define _LDMA_CH_CTRL_SRCINC_FOUR                         0x00000002UL
+#define _LDMA_CH_CTRL_SRCINC_NONE                         0x00000003UL
+#define LDMA_CH_CTRL_SRCINC_ONE                           (_LDMA_CH_CTRL_SRCINC_ONE << 24)
+#define LDMA_CH_CTRL_SRCINC_TWO                           (_LDMA_CH_CTRL_SRCINC_TWO << 24)
+#define LDMA_CH_CTRL_SRCINC_FOUR                          (_LDMA_CH_CTRL_SRCINC_FOUR << 24)
+#define LDMA_CH_CTRL_SRCINC_NONE                          (_LDMA_CH_CTRL_SRCINC_NONE << 24)
+#define _LDMA_CH_CTRL_SIZE_SHIFT                          26
+#define _LDMA_CH_CTRL_SIZE_MASK                           0xC000000UL
+#define _LDMA_CH_CTRL_SIZE_DEFAULT                        0x00000000UL
+#define LDMA_CH_CTRL_SIZE_DEFAULT                         (_LDMA_CH_CTRL_SIZE_DEFAULT << 26)
+#define _LDMA_CH_CTRL_SIZE_BYTE                           0x00000000UL
+#define _LDMA_CH_CTRL_SIZE_HALFWORD                       0x00000001UL
+#define _LDMA_CH_CTRL_SIZE_WORD                           0x00000002UL
+#define LDMA_CH_CTRL_SIZE_BYTE                            (_LDMA_CH_CTRL_SIZE_BYTE << 26)
+#define LDMA_CH_CTRL_SIZE_HALFWORD                        (_LDMA_CH_CTRL_SIZE_HALFWORD << 26)
+#define LDMA_CH_CTRL_SIZE_WORD                            (_LDMA_CH_CTRL_SIZE_WORD << 26)
+#define _LDMA_CH_CTRL_DSTINC_SHIFT                        28
+#define _LDMA_CH_CTRL_DSTINC_MASK                         0x30000000UL
+#define _LDMA_CH_CTRL_DSTINC_DEFAULT                      0x00000000UL
+#define LDMA_CH_CTRL_DSTINC_DEFAULT                       (_LDMA_CH_CTRL_DSTINC_DEFAULT << 28)
+#define _LDMA_CH_CTRL_DSTINC_ONE                          0x00000000UL
+#define _LDMA_CH_CTRL_DSTINC_TWO                          0x00000001UL
+#define _LDMA_CH_CTRL_DSTINC_FOUR                         0x00000002UL
+#define _LDMA_CH_CTRL_DSTINC_NONE                         0x00000003UL
+#define LDMA_CH_CTRL_DSTINC_ONE                           (_LDMA_CH_CTRL_DSTINC_ONE << 28)
+#define LDMA_CH_CTRL_DSTINC_TWO                           (_LDMA_CH_CTRL_DSTINC_TWO << 28)
+#define LDMA_CH_CTRL_DSTINC_FOUR                          (_LDMA_CH_CTRL_DSTINC_FOUR << 28)
+#define LDMA_CH_CTRL_DSTINC_NONE                          (_LDMA_CH_CTRL_DSTINC_NONE << 28)
+#define LDMA_CH_CTRL_SRCMODE                              (0x1UL << 30)
+#define _LDMA_CH_CTRL_SRCMODE_SHIFT                       30
+#define _LDMA_CH_CTRL_SRCMODE_MASK                        0x40000000UL
+#define _LDMA_CH_CTRL_SRCMODE_DEFAULT                     0x00000000UL
+#define LDMA_CH_CTRL_SRCMODE_DEFAULT                      (_LDMA_CH_CTRL_SRCMODE_DEFAULT << 30)
+#define _LDMA_CH_CTRL_SRCMODE_ABSOLUTE                    0x00000000UL
+#define _LDMA_CH_CTRL_SRCMODE_RELATIVE                    0x00000001UL
+#define LDMA_CH_CTRL_SRCMODE_ABSOLUTE                     (_LDMA_CH_CTRL_SRCMODE_ABSOLUTE << 30)
+#define LDMA_CH_CTRL_SRCMODE_RELATIVE                     (_LDMA_CH_CTRL_SRCMODE_RELATIVE << 30)
+#define LDMA_CH_CTRL_DSTMODE                              (0x1UL << 31)
+#define _LDMA_CH_CTRL_DSTMODE_SHIFT                       31
+#define _LDMA_CH_CTRL_DSTMODE_MASK                        0x80000000UL
+#define _LDMA_CH_CTRL_DSTMODE_DEFAULT                     0x00000000UL
+#define LDMA_CH_CTRL_DSTMODE_DEFAULT                      (_LDMA_CH_CTRL_DSTMODE_DEFAULT << 31)
+#define _LDMA_CH_CTRL_DSTMODE_ABSOLUTE                    0x00000000UL
+#define _LDMA_CH_CTRL_DSTMODE_RELATIVE                    0x00000001UL
+#define LDMA_CH_CTRL_DSTMODE_ABSOLUTE                     (_LDMA_CH_CTRL_DSTMODE_ABSOLUTE << 31)
+#define LDMA_CH_CTRL_DSTMODE_RELATIVE                     (_LDMA_CH_CTRL_DSTMODE_RELATIVE << 31)
+
+/* Bit fields for LDMA CH_LINK */
+#define _LDMA_CH_LINK_RESETVALUE                          0x00000000UL
+#define _LDMA_CH_LINK_MASK                                0xFFFFFFFFUL
+#define LDMA_CH_LINK_LINKMODE                             (0x1UL << 0)
+#define _LDMA_CH_LINK_LINKMODE_SHIFT                      0
+#define _LDMA_CH_LINK_LINKMODE_MASK                       0x1UL
+#define _LDMA_CH_LINK_LINKMODE_DEFAULT                    0x00000000UL
+#define LDMA_CH_LINK_LINKMODE_DEFAULT                     (_LDMA_CH_LINK_LINKMODE_DEFAULT << 0)
+#define _LDMA_CH_LINK_LINKMODE_ABSOLUTE                   0x00000000UL
+#define _LDMA_CH_LINK_LINKMODE_RELATIVE                   0x00000001UL
+#define LDMA_CH_LINK_LINKMODE_ABSOLUTE                    (_LDMA_CH_LINK_LINKMODE_ABSOLUTE << 0)
+#define LDMA_CH_LINK_LINKMODE_RELATIVE                    (_LDMA_CH_LINK_LINKMODE_RELATIVE << 0)
+#define LDMA_CH_LINK_LINK                                 (0x1UL << 1)
+#define _LDMA_CH_LINK_LINK_SHIFT                          1
+#define _LDMA_CH_LINK_LINK_MASK                           0x2UL
+#define _LDMA_CH_LINK_LINK_DEFAULT                        0x00000000UL
+#define LDMA_CH_LINK_LINK_DEFAULT                         (_LDMA_CH_LINK_LINK_DEFAULT << 1)
+#define _LDMA_CH_LINK_LINKADDR_SHIFT                      2
+#define _LDMA_CH_LINK_LINKADDR_MASK                       0xFFFFFFFCUL
+#define _LDMA_CH_LINK_LINKADDR_DEFAULT                    0x00000000UL
+#define LDMA_CH_LINK_LINKADDR_DEFAULT                     (_LDMA_CH_LINK_LINKADDR_DEFAULT << 2)
+
+/******************************************************************************
+ * LDMAXBAR
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t REQSEL;
+} LDMAXBAR_CH_TypeDef;
+
+typedef struct {
+  LDMAXBAR_CH_TypeDef CH[8];
+  uint32_t RESERVED0[1016];
+  LDMAXBAR_CH_TypeDef CH_SET[8];
+  uint32_t RESERVED1[1016];
+  LDMAXBAR_CH_TypeDef CH_CLR[8];
+  uint32_t RESERVED2[1016];
+  LDMAXBAR_CH_TypeDef CH_TGL[8];
+  uint32_t RESERVED3[1016];
+} LDMAXBAR_TypeDef;
+
+/* Bit fields for LDMAXBAR CH_REQSEL */
+#define _LDMAXBAR_CH_REQSEL_RESETVALUE                    0x00000000UL
+#define _LDMAXBAR_CH_REQSEL_MASK                          0x000003FFUL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_SHIFT                  0
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_MASK                   0x3FUL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_DEFAULT                0x00000000UL
+#define LDMAXBAR_CH_REQSEL_SIGSEL_DEFAULT                 (_LDMAXBAR_CH_REQSEL_SIGSEL_DEFAULT << 0)
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_EUART0RXFL             0x00000001UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_EUART0TXFL             0x00000002UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_I2C0RXDATAV            0x00000003UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_I2C0TXBL               0x00000004UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_I2C1RXDATAV            0x00000005UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_I2C1TXBL               0x00000006UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_IADC0IADC_SCAN         0x00000007UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_IADC0IADC_SINGLE       0x00000008UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_LDMAXBARPRSREQ0        0x00000009UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_LDMAXBARPRSREQ1        0x0000000AUL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_MSCWDATA               0x0000000BUL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0CC0              0x0000000CUL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0CC1              0x0000000DUL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0CC2              0x0000000EUL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0UFOF             0x0000000FUL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1CC0              0x00000010UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1CC1              0x00000011UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1CC2              0x00000012UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1UFOF             0x00000013UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2CC0              0x00000014UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2CC1              0x00000015UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2CC2              0x00000016UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2UFOF             0x00000017UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3CC0              0x00000018UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3CC1              0x00000019UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3CC2              0x0000001AUL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3UFOF             0x0000001BUL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4CC0              0x0000001CUL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4CC1              0x0000001DUL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4CC2              0x0000001EUL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4UFOF             0x0000001FUL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_USART0RXDATAV          0x00000020UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_USART0RXDATAVRIGHT     0x00000021UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_USART0TXBL             0x00000022UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_USART0TXBLRIGHT        0x00000023UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_USART0TXEMPTY          0x00000024UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_USART1RXDATAV          0x00000025UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_USART1RXDATAVRIGHT     0x00000026UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_USART1TXBL             0x00000027UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_USART1TXBLRIGHT        0x00000028UL
+#define _LDMAXBAR_CH_REQSEL_SIGSEL_USART1TXEMPTY          0x00000029UL
+#define LDMAXBAR_CH_REQSEL_SIGSEL_EUART0RXFL              (_LDMAXBAR_CH_REQSEL_SIGSEL_EUART0RXFL << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_EUART0TXFL              (_LDMAXBAR_CH_REQSEL_SIGSEL_EUART0TXFL << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_I2C0RXDATAV             (_LDMAXBAR_CH_REQSEL_SIGSEL_I2C0RXDATAV << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_I2C0TXBL                (_LDMAXBAR_CH_REQSEL_SIGSEL_I2C0TXBL << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_I2C1RXDATAV             (_LDMAXBAR_CH_REQSEL_SIGSEL_I2C1RXDATAV << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_I2C1TXBL                (_LDMAXBAR_CH_REQSEL_SIGSEL_I2C1TXBL << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_IADC0IADC_SCAN          (_LDMAXBAR_CH_REQSEL_SIGSEL_IADC0IADC_SCAN << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_IADC0IADC_SINGLE        (_LDMAXBAR_CH_REQSEL_SIGSEL_IADC0IADC_SINGLE << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_LDMAXBARPRSREQ0         (_LDMAXBAR_CH_REQSEL_SIGSEL_LDMAXBARPRSREQ0 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_LDMAXBARPRSREQ1         (_LDMAXBAR_CH_REQSEL_SIGSEL_LDMAXBARPRSREQ1 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_MSCWDATA                (_LDMAXBAR_CH_REQSEL_SIGSEL_MSCWDATA << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0CC0               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0CC0 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0CC1               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0CC1 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0CC2               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0CC2 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0UFOF              (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0UFOF << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1CC0               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1CC0 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1CC1               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1CC1 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1CC2               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1CC2 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1UFOF              (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1UFOF << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2CC0               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2CC0 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2CC1               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2CC1 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2CC2               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2CC2 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2UFOF              (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2UFOF << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3CC0               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3CC0 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3CC1               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3CC1 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3CC2               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3CC2 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3UFOF              (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3UFOF << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4CC0               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4CC0 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4CC1               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4CC1 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4CC2               (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4CC2 << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4UFOF              (_LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4UFOF << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_USART0RXDATAV           (_LDMAXBAR_CH_REQSEL_SIGSEL_USART0RXDATAV << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_USART0RXDATAVRIGHT      (_LDMAXBAR_CH_REQSEL_SIGSEL_USART0RXDATAVRIGHT << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_USART0TXBL              (_LDMAXBAR_CH_REQSEL_SIGSEL_USART0TXBL << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_USART0TXBLRIGHT         (_LDMAXBAR_CH_REQSEL_SIGSEL_USART0TXBLRIGHT << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_USART0TXEMPTY           (_LDMAXBAR_CH_REQSEL_SIGSEL_USART0TXEMPTY << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_USART1RXDATAV           (_LDMAXBAR_CH_REQSEL_SIGSEL_USART1RXDATAV << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_USART1RXDATAVRIGHT      (_LDMAXBAR_CH_REQSEL_SIGSEL_USART1RXDATAVRIGHT << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_USART1TXBL              (_LDMAXBAR_CH_REQSEL_SIGSEL_USART1TXBL << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_USART1TXBLRIGHT         (_LDMAXBAR_CH_REQSEL_SIGSEL_USART1TXBLRIGHT << 0)
+#define LDMAXBAR_CH_REQSEL_SIGSEL_USART1TXEMPTY           (_LDMAXBAR_CH_REQSEL_SIGSEL_USART1TXEMPTY << 0)
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_SHIFT               6
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_MASK                0x3C0UL
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_DEFAULT             0x00000000UL
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_DEFAULT              (_LDMAXBAR_CH_REQSEL_SOURCESEL_DEFAULT << 6)
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_NONE                0x00000000UL
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_EUART0              0x00000001UL
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_I2C0                0x00000002UL
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_I2C1                0x00000003UL
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_IADC0               0x00000004UL
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_LDMAXBAR            0x00000005UL
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_MSC                 0x00000006UL
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER0              0x00000007UL
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER1              0x00000008UL
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER2              0x00000009UL
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER3              0x0000000AUL
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER4              0x0000000BUL
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_USART0              0x0000000CUL
+#define _LDMAXBAR_CH_REQSEL_SOURCESEL_USART1              0x0000000DUL
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_NONE                 (_LDMAXBAR_CH_REQSEL_SOURCESEL_NONE << 6)
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_EUART0               (_LDMAXBAR_CH_REQSEL_SOURCESEL_EUART0 << 6)
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_I2C0                 (_LDMAXBAR_CH_REQSEL_SOURCESEL_I2C0 << 6)
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_I2C1                 (_LDMAXBAR_CH_REQSEL_SOURCESEL_I2C1 << 6)
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_IADC0                (_LDMAXBAR_CH_REQSEL_SOURCESEL_IADC0 << 6)
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_LDMAXBAR             (_LDMAXBAR_CH_REQSEL_SOURCESEL_LDMAXBAR << 6)
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_MSC                  (_LDMAXBAR_CH_REQSEL_SOURCESEL_MSC << 6)
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER0               (_LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER0 << 6)
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER1               (_LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER1 << 6)
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER2               (_LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER2 << 6)
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER3               (_LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER3 << 6)
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER4               (_LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER4 << 6)
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_USART0               (_LDMAXBAR_CH_REQSEL_SOURCESEL_USART0 << 6)
+#define LDMAXBAR_CH_REQSEL_SOURCESEL_USART1               (_LDMAXBAR_CH_REQSEL_SOURCESEL_USART1 << 6)
+
+/******************************************************************************
+ * TIMER
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t CFG;
+  __IOM uint32_t CTRL;
+  __IOM uint32_t OC;
+  __IOM uint32_t OCB;
+  __IOM uint32_t ICF;
+  __IOM uint32_t ICOF;
+} TIMER_CC_TypeDef;
+
+typedef struct {
+  __IOM uint32_t CFG;
+  __IOM uint32_t CMD;
+  __IOM uint32_t CNT;
+  __IOM uint32_t CTRL;
+  __IOM uint32_t DTCFG;
+  __IOM uint32_t DTCTRL;
+  __IOM uint32_t DTFAULT;
+  __IOM uint32_t DTFAULTC;
+  __IOM uint32_t DTFCFG;
+  __IOM uint32_t DTLOCK;
+  __IOM uint32_t DTOGEN;
+  __IOM uint32_t DTTIMECFG;
+  __IOM uint32_t EN;
+  __IOM uint32_t IEN;
+  __IOM uint32_t IF;
+  __IOM uint32_t IFC;
+  __IOM uint32_t IFS;
+  __IOM uint32_t STATUS;
+  __IOM uint32_t TOP;
+  __IOM uint32_t TOPB;
+  TIMER_CC_TypeDef CC[3];
+  uint32_t RESERVED0[986];
+  __IOM uint32_t CFG_SET;
+  __IOM uint32_t CMD_SET;
+  __IOM uint32_t CNT_SET;
+  __IOM uint32_t CTRL_SET;
+  __IOM uint32_t DTCFG_SET;
+  __IOM uint32_t DTCTRL_SET;
+  __IOM uint32_t DTFAULT_SET;
+  __IOM uint32_t DTFAULTC_SET;
+  __IOM uint32_t DTFCFG_SET;
+  __IOM uint32_t DTLOCK_SET;
+  __IOM uint32_t DTOGEN_SET;
+  __IOM uint32_t DTTIMECFG_SET;
+  __IOM uint32_t EN_SET;
+  __IOM uint32_t IEN_SET;
+  __IOM uint32_t IF_SET;
+  __IOM uint32_t IFC_SET;
+  __IOM uint32_t IFS_SET;
+  __IOM uint32_t STATUS_SET;
+  __IOM uint32_t TOP_SET;
+  __IOM uint32_t TOPB_SET;
+  TIMER_CC_TypeDef CC_SET[3];
+  uint32_t RESERVED1[986];
+  __IOM uint32_t CFG_CLR;
+  __IOM uint32_t CMD_CLR;
+  __IOM uint32_t CNT_CLR;
+  __IOM uint32_t CTRL_CLR;
+  __IOM uint32_t DTCFG_CLR;
+  __IOM uint32_t DTCTRL_CLR;
+  __IOM uint32_t DTFAULT_CLR;
+  __IOM uint32_t DTFAULTC_CLR;
+  __IOM uint32_t DTFCFG_CLR;
+  __IOM uint32_t DTLOCK_CLR;
+  __IOM uint32_t DTOGEN_CLR;
+  __IOM uint32_t DTTIMECFG_CLR;
+  __IOM uint32_t EN_CLR;
+  __IOM uint32_t IEN_CLR;
+  __IOM uint32_t IF_CLR;
+  __IOM uint32_t IFC_CLR;
+  __IOM uint32_t IFS_CLR;
+  __IOM uint32_t STATUS_CLR;
+  __IOM uint32_t TOP_CLR;
+  __IOM uint32_t TOPB_CLR;
+  TIMER_CC_TypeDef CC_CLR[3];
+  uint32_t RESERVED2[986];
+  __IOM uint32_t CFG_TGL;
+  __IOM uint32_t CMD_TGL;
+  __IOM uint32_t CNT_TGL;
+  __IOM uint32_t CTRL_TGL;
+  __IOM uint32_t DTCFG_TGL;
+  __IOM uint32_t DTCTRL_TGL;
+  __IOM uint32_t DTFAULT_TGL;
+  __IOM uint32_t DTFAULTC_TGL;
+  __IOM uint32_t DTFCFG_TGL;
+  __IOM uint32_t DTLOCK_TGL;
+  __IOM uint32_t DTOGEN_TGL;
+  __IOM uint32_t DTTIMECFG_TGL;
+  __IOM uint32_t EN_TGL;
+  __IOM uint32_t IEN_TGL;
+  __IOM uint32_t IF_TGL;
+  __IOM uint32_t IFC_TGL;
+  __IOM uint32_t IFS_TGL;
+  __IOM uint32_t STATUS_TGL;
+  __IOM uint32_t TOP_TGL;
+  __IOM uint32_t TOPB_TGL;
+  TIMER_CC_TypeDef CC_TGL[3];
+  uint32_t RESERVED3[986];
+} TIMER_TypeDef;
+
+/* Bit fields for TIMER CFG */
+#define _TIMER_CFG_RESETVALUE                             0x00000000UL
+#define _TIMER_CFG_MASK                                   0x0FFC03FFUL
+#define _TIMER_CFG_MODE_SHIFT                             0
+#define _TIMER_CFG_MODE_MASK                              0x3UL
+#define _TIMER_CFG_MODE_DEFAULT                           0x00000000UL
+#define TIMER_CFG_MODE_DEFAULT                            (_TIMER_CFG_MODE_DEFAULT << 0)
+#define _TIMER_CFG_MODE_UP                                0x00000000UL
+#define _TIMER_CFG_MODE_DOWN                              0x00000001UL
+#define _TIMER_CFG_MODE_UPDOWN                            0x00000002UL
+#define _TIMER_CFG_MODE_QDEC                              0x00000003UL
+#define TIMER_CFG_MODE_UP                                 (_TIMER_CFG_MODE_UP << 0)
+#define TIMER_CFG_MODE_DOWN                               (_TIMER_CFG_MODE_DOWN << 0)
+#define TIMER_CFG_MODE_UPDOWN                             (_TIMER_CFG_MODE_UPDOWN << 0)
+#define TIMER_CFG_MODE_QDEC                               (_TIMER_CFG_MODE_QDEC << 0)
+#define TIMER_CFG_ATI                                     (0x1UL << 2)
+#define _TIMER_CFG_ATI_SHIFT                              2
+#define _TIMER_CFG_ATI_MASK                               0x4UL
+#define _TIMER_CFG_ATI_DEFAULT                            0x00000000UL
+#define TIMER_CFG_ATI_DEFAULT                             (_TIMER_CFG_ATI_DEFAULT << 2)
+#define TIMER_CFG_DEBUGRUN                                (0x1UL << 3)
+#define _TIMER_CFG_DEBUGRUN_SHIFT                         3
+#define _TIMER_CFG_DEBUGRUN_MASK                          0x8UL
+#define _TIMER_CFG_DEBUGRUN_DEFAULT                       0x00000000UL
+#define TIMER_CFG_DEBUGRUN_DEFAULT                        (_TIMER_CFG_DEBUGRUN_DEFAULT << 3)
+#define TIMER_CFG_DMACLRACT                               (0x1UL << 4)
+#define _TIMER_CFG_DMACLRACT_SHIFT                        4
+#define _TIMER_CFG_DMACLRACT_MASK                         0x10UL
+#define _TIMER_CFG_DMACLRACT_DEFAULT                      0x00000000UL
+#define TIMER_CFG_DMACLRACT_DEFAULT                       (_TIMER_CFG_DMACLRACT_DEFAULT << 4)
+#define TIMER_CFG_QDM                                     (0x1UL << 5)
+#define _TIMER_CFG_QDM_SHIFT                              5
+#define _TIMER_CFG_QDM_MASK                               0x20UL
+#define _TIMER_CFG_QDM_DEFAULT                            0x00000000UL
+#define TIMER_CFG_QDM_DEFAULT                             (_TIMER_CFG_QDM_DEFAULT << 5)
+#define _TIMER_CFG_QDM_X2                                 0x00000000UL
+#define _TIMER_CFG_QDM_X4                                 0x00000001UL
+#define TIMER_CFG_QDM_X2                                  (_TIMER_CFG_QDM_X2 << 5)
+#define TIMER_CFG_QDM_X4                                  (_TIMER_CFG_QDM_X4 << 5)
+#define TIMER_CFG_OSMEN                                   (0x1UL << 6)
+#define _TIMER_CFG_OSMEN_SHIFT                            6
+#define _TIMER_CFG_OSMEN_MASK                             0x40UL
+#define _TIMER_CFG_OSMEN_DEFAULT                          0x00000000UL
+#define TIMER_CFG_OSMEN_DEFAULT                           (_TIMER_CFG_OSMEN_DEFAULT << 6)
+#define TIMER_CFG_SYNC                                    (0x1UL << 7)
+#define _TIMER_CFG_SYNC_SHIFT                             7
+#define _TIMER_CFG_SYNC_MASK                              0x80UL
+#define _TIMER_CFG_SYNC_DEFAULT                           0x00000000UL
+#define TIMER_CFG_SYNC_DEFAULT                            (_TIMER_CFG_SYNC_DEFAULT << 7)
+#define _TIMER_CFG_CLKSEL_SHIFT                           8
+#define _TIMER_CFG_CLKSEL_MASK                            0x300UL
+#define _TIMER_CFG_CLKSEL_DEFAULT                         0x00000000UL
+#define TIMER_CFG_CLKSEL_DEFAULT                          (_TIMER_CFG_CLKSEL_DEFAULT << 8)
+#define _TIMER_CFG_CLKSEL_PRESCEM01GRPACLK                0x00000000UL
+#define _TIMER_CFG_CLKSEL_CC1                             0x00000001UL
+#define _TIMER_CFG_CLKSEL_TIMEROUF                        0x00000002UL
+#define TIMER_CFG_CLKSEL_PRESCEM01GRPACLK                 (_TIMER_CFG_CLKSEL_PRESCEM01GRPACLK << 8)
+#define TIMER_CFG_CLKSEL_CC1                              (_TIMER_CFG_CLKSEL_CC1 << 8)
+#define TIMER_CFG_CLKSEL_TIMEROUF                         (_TIMER_CFG_CLKSEL_TIMEROUF << 8)
+#define _TIMER_CFG_PRESC_SHIFT                            18
+#define _TIMER_CFG_PRESC_MASK                             0xFFC0000UL
+#define _TIMER_CFG_PRESC_DEFAULT                          0x00000000UL
+#define TIMER_CFG_PRESC_DEFAULT                           (_TIMER_CFG_PRESC_DEFAULT << 18)
+#define _TIMER_CFG_PRESC_DIV1                             0x00000000UL
+#define _TIMER_CFG_PRESC_DIV2                             0x00000001UL
+#define _TIMER_CFG_PRESC_DIV4                             0x00000003UL
+#define _TIMER_CFG_PRESC_DIV8                             0x00000007UL
+#define _TIMER_CFG_PRESC_DIV16                            0x0000000FUL
+#define _TIMER_CFG_PRESC_DIV32                            0x0000001FUL
+#define _TIMER_CFG_PRESC_DIV64                            0x0000003FUL
+#define _TIMER_CFG_PRESC_DIV128                           0x0000007FUL
+#define _TIMER_CFG_PRESC_DIV256                           0x000000FFUL
+#define _TIMER_CFG_PRESC_DIV512                           0x000001FFUL
+#define _TIMER_CFG_PRESC_DIV1024                          0x000003FFUL
+#define TIMER_CFG_PRESC_DIV1                              (_TIMER_CFG_PRESC_DIV1 << 18)
+#define TIMER_CFG_PRESC_DIV2                              (_TIMER_CFG_PRESC_DIV2 << 18)
+#define TIMER_CFG_PRESC_DIV4                              (_TIMER_CFG_PRESC_DIV4 << 18)
+#define TIMER_CFG_PRESC_DIV8                              (_TIMER_CFG_PRESC_DIV8 << 18)
+#define TIMER_CFG_PRESC_DIV16                             (_TIMER_CFG_PRESC_DIV16 << 18)
+#define TIMER_CFG_PRESC_DIV32                             (_TIMER_CFG_PRESC_DIV32 << 18)
+#define TIMER_CFG_PRESC_DIV64                             (_TIMER_CFG_PRESC_DIV64 << 18)
+#define TIMER_CFG_PRESC_DIV128                            (_TIMER_CFG_PRESC_DIV128 << 18)
+#define TIMER_CFG_PRESC_DIV256                            (_TIMER_CFG_PRESC_DIV256 << 18)
+#define TIMER_CFG_PRESC_DIV512                            (_TIMER_CFG_PRESC_DIV512 << 18)
+#define TIMER_CFG_PRESC_DIV1024                           (_TIMER_CFG_PRESC_DIV1024 << 18)
+
+/* Bit fields for TIMER CMD */
+#define _TIMER_CMD_RESETVALUE                             0x00000000UL
+#define _TIMER_CMD_MASK                                   0x00000003UL
+#define TIMER_CMD_START                                   (0x1UL << 0)
+#define _TIMER_CMD_START_SHIFT                            0
+#define _TIMER_CMD_START_MASK                             0x1UL
+#define _TIMER_CMD_START_DEFAULT                          0x00000000UL
+#define TIMER_CMD_START_DEFAULT                           (_TIMER_CMD_START_DEFAULT << 0)
+#define TIMER_CMD_STOP                                    (0x1UL << 1)
+#define _TIMER_CMD_STOP_SHIFT                             1
+#define _TIMER_CMD_STOP_MASK                              0x2UL
+#define _TIMER_CMD_STOP_DEFAULT                           0x00000000UL
+#define TIMER_CMD_STOP_DEFAULT                            (_TIMER_CMD_STOP_DEFAULT << 1)
+
+/* Bit fields for TIMER CNT */
+#define _TIMER_CNT_RESETVALUE                             0x00000000UL
+#define _TIMER_CNT_MASK                                   0x00000000UL
+
+/* Bit fields for TIMER CTRL */
+#define _TIMER_CTRL_RESETVALUE                            0x00000000UL
+#define _TIMER_CTRL_MASK                                  0x0000000FUL
+#define _TIMER_CTRL_FALLA_SHIFT                           0
+#define _TIMER_CTRL_FALLA_MASK                            0x3UL
+#define _TIMER_CTRL_FALLA_DEFAULT                         0x00000000UL
+#define TIMER_CTRL_FALLA_DEFAULT                          (_TIMER_CTRL_FALLA_DEFAULT << 0)
+#define _TIMER_CTRL_FALLA_NONE                            0x00000000UL
+#define _TIMER_CTRL_FALLA_RELOADSTART                     0x00000001UL
+#define _TIMER_CTRL_FALLA_START                           0x00000002UL
+#define _TIMER_CTRL_FALLA_STOP                            0x00000003UL
+#define TIMER_CTRL_FALLA_NONE                             (_TIMER_CTRL_FALLA_NONE << 0)
+#define TIMER_CTRL_FALLA_RELOADSTART                      (_TIMER_CTRL_FALLA_RELOADSTART << 0)
+#define TIMER_CTRL_FALLA_START                            (_TIMER_CTRL_FALLA_START << 0)
+#define TIMER_CTRL_FALLA_STOP                             (_TIMER_CTRL_FALLA_STOP << 0)
+#define TIMER_CTRL_RISEA                                  (0x1UL << 2)
+#define _TIMER_CTRL_RISEA_SHIFT                           2
+#define _TIMER_CTRL_RISEA_MASK                            0x4UL
+#define _TIMER_CTRL_RISEA_DEFAULT                         0x00000000UL
+#define TIMER_CTRL_RISEA_DEFAULT                          (_TIMER_CTRL_RISEA_DEFAULT << 2)
+#define TIMER_CTRL_X2CNT                                  (0x1UL << 3)
+#define _TIMER_CTRL_X2CNT_SHIFT                           3
+#define _TIMER_CTRL_X2CNT_MASK                            0x8UL
+#define _TIMER_CTRL_X2CNT_DEFAULT                         0x00000000UL
+#define TIMER_CTRL_X2CNT_DEFAULT                          (_TIMER_CTRL_X2CNT_DEFAULT << 3)
+
+/* Bit fields for TIMER DTCFG */
+#define _TIMER_DTCFG_RESETVALUE                           0x00000000UL
+#define _TIMER_DTCFG_MASK                                 0x00000007UL
+#define TIMER_DTCFG_DTDAS                                 (0x1UL << 0)
+#define _TIMER_DTCFG_DTDAS_SHIFT                          0
+#define _TIMER_DTCFG_DTDAS_MASK                           0x1UL
+#define _TIMER_DTCFG_DTDAS_DEFAULT                        0x00000000UL
+#define TIMER_DTCFG_DTDAS_DEFAULT                         (_TIMER_DTCFG_DTDAS_DEFAULT << 0)
+#define TIMER_DTCFG_DTEN                                  (0x1UL << 1)
+#define _TIMER_DTCFG_DTEN_SHIFT                           1
+#define _TIMER_DTCFG_DTEN_MASK                            0x2UL
+#define _TIMER_DTCFG_DTEN_DEFAULT                         0x00000000UL
+#define TIMER_DTCFG_DTEN_DEFAULT                          (_TIMER_DTCFG_DTEN_DEFAULT << 1)
+#define TIMER_DTCFG_DTPRSEN                               (0x1UL << 2)
+#define _TIMER_DTCFG_DTPRSEN_SHIFT                        2
+#define _TIMER_DTCFG_DTPRSEN_MASK                         0x4UL
+#define _TIMER_DTCFG_DTPRSEN_DEFAULT                      0x00000000UL
+#define TIMER_DTCFG_DTPRSEN_DEFAULT                       (_TIMER_DTCFG_DTPRSEN_DEFAULT << 2)
+
+/* Bit fields for TIMER DTCTRL */
+#define _TIMER_DTCTRL_RESETVALUE                          0x00000000UL
+#define _TIMER_DTCTRL_MASK                                0x00000007UL
+#define TIMER_DTCTRL_DTCINV                               (0x1UL << 0)
+#define _TIMER_DTCTRL_DTCINV_SHIFT                        0
+#define _TIMER_DTCTRL_DTCINV_MASK                         0x1UL
+#define _TIMER_DTCTRL_DTCINV_DEFAULT                      0x00000000UL
+#define TIMER_DTCTRL_DTCINV_DEFAULT                       (_TIMER_DTCTRL_DTCINV_DEFAULT << 0)
+#define TIMER_DTCTRL_DTEN                                 (0x1UL << 1)
+#define _TIMER_DTCTRL_DTEN_SHIFT                          1
+#define _TIMER_DTCTRL_DTEN_MASK                           0x2UL
+#define _TIMER_DTCTRL_DTEN_DEFAULT                        0x00000000UL
+#define TIMER_DTCTRL_DTEN_DEFAULT                         (_TIMER_DTCTRL_DTEN_DEFAULT << 1)
+#define TIMER_DTCTRL_DTIPOL                               (0x1UL << 2)
+#define _TIMER_DTCTRL_DTIPOL_SHIFT                        2
+#define _TIMER_DTCTRL_DTIPOL_MASK                         0x4UL
+#define _TIMER_DTCTRL_DTIPOL_DEFAULT                      0x00000000UL
+#define TIMER_DTCTRL_DTIPOL_DEFAULT                       (_TIMER_DTCTRL_DTIPOL_DEFAULT << 2)
+
+/* Bit fields for TIMER DTFAULT */
+#define _TIMER_DTFAULT_RESETVALUE                         0x00000000UL
+#define _TIMER_DTFAULT_MASK                               0x00000000UL
+
+/* Bit fields for TIMER DTFAULTC */
+#define _TIMER_DTFAULTC_RESETVALUE                        0x00000000UL
+#define _TIMER_DTFAULTC_MASK                              0x00000000UL
+
+/* Bit fields for TIMER DTFCFG */
+#define _TIMER_DTFCFG_RESETVALUE                          0x00000000UL
+#define _TIMER_DTFCFG_MASK                                0x0000003FUL
+#define TIMER_DTFCFG_DTDBGFEN                             (0x1UL << 0)
+#define _TIMER_DTFCFG_DTDBGFEN_SHIFT                      0
+#define _TIMER_DTFCFG_DTDBGFEN_MASK                       0x1UL
+#define _TIMER_DTFCFG_DTDBGFEN_DEFAULT                    0x00000000UL
+#define TIMER_DTFCFG_DTDBGFEN_DEFAULT                     (_TIMER_DTFCFG_DTDBGFEN_DEFAULT << 0)
+#define _TIMER_DTFCFG_DTFA_SHIFT                          1
+#define _TIMER_DTFCFG_DTFA_MASK                           0x6UL
+#define _TIMER_DTFCFG_DTFA_DEFAULT                        0x00000000UL
+#define TIMER_DTFCFG_DTFA_DEFAULT                         (_TIMER_DTFCFG_DTFA_DEFAULT << 1)
+#define _TIMER_DTFCFG_DTFA_NONE                           0x00000000UL
+#define _TIMER_DTFCFG_DTFA_CLEAR                          0x00000001UL
+#define _TIMER_DTFCFG_DTFA_INACTIVE                       0x00000002UL
+#define _TIMER_DTFCFG_DTFA_TRISTATE                       0x00000003UL
+#define TIMER_DTFCFG_DTFA_NONE                            (_TIMER_DTFCFG_DTFA_NONE << 1)
+#define TIMER_DTFCFG_DTFA_CLEAR                           (_TIMER_DTFCFG_DTFA_CLEAR << 1)
+#define TIMER_DTFCFG_DTFA_INACTIVE                        (_TIMER_DTFCFG_DTFA_INACTIVE << 1)
+#define TIMER_DTFCFG_DTFA_TRISTATE                        (_TIMER_DTFCFG_DTFA_TRISTATE << 1)
+#define TIMER_DTFCFG_DTLOCKUPFEN                          (0x1UL << 3)
+#define _TIMER_DTFCFG_DTLOCKUPFEN_SHIFT                   3
+#define _TIMER_DTFCFG_DTLOCKUPFEN_MASK                    0x8UL
+#define _TIMER_DTFCFG_DTLOCKUPFEN_DEFAULT                 0x00000000UL
+#define TIMER_DTFCFG_DTLOCKUPFEN_DEFAULT                  (_TIMER_DTFCFG_DTLOCKUPFEN_DEFAULT << 3)
+#define TIMER_DTFCFG_DTPRS0FEN                            (0x1UL << 4)
+#define _TIMER_DTFCFG_DTPRS0FEN_SHIFT                     4
+#define _TIMER_DTFCFG_DTPRS0FEN_MASK                      0x10UL
+#define _TIMER_DTFCFG_DTPRS0FEN_DEFAULT                   0x00000000UL
+#define TIMER_DTFCFG_DTPRS0FEN_DEFAULT                    (_TIMER_DTFCFG_DTPRS0FEN_DEFAULT << 4)
+#define TIMER_DTFCFG_DTPRS1FEN                            (0x1UL << 5)
+#define _TIMER_DTFCFG_DTPRS1FEN_SHIFT                     5
+#define _TIMER_DTFCFG_DTPRS1FEN_MASK                      0x20UL
+#define _TIMER_DTFCFG_DTPRS1FEN_DEFAULT                   0x00000000UL
+#define TIMER_DTFCFG_DTPRS1FEN_DEFAULT                    (_TIMER_DTFCFG_DTPRS1FEN_DEFAULT << 5)
+
+/* Bit fields for TIMER DTLOCK */
+#define _TIMER_DTLOCK_RESETVALUE                          0x00000000UL
+#define _TIMER_DTLOCK_MASK                                0x00000001UL
+#define TIMER_DTLOCK_DTILOCKKEY                           (0x1UL << 0)
+#define _TIMER_DTLOCK_DTILOCKKEY_SHIFT                    0
+#define _TIMER_DTLOCK_DTILOCKKEY_MASK                     0x1UL
+#define _TIMER_DTLOCK_DTILOCKKEY_DEFAULT                  0x00000000UL
+#define TIMER_DTLOCK_DTILOCKKEY_DEFAULT                   (_TIMER_DTLOCK_DTILOCKKEY_DEFAULT << 0)
+#define _TIMER_DTLOCK_DTILOCKKEY_UNLOCK                   0x00000001UL
+#define TIMER_DTLOCK_DTILOCKKEY_UNLOCK                    (_TIMER_DTLOCK_DTILOCKKEY_UNLOCK << 0)
+
+/* Bit fields for TIMER DTOGEN */
+#define _TIMER_DTOGEN_RESETVALUE                          0x00000000UL
+#define _TIMER_DTOGEN_MASK                                0x00000000UL
+
+/* Bit fields for TIMER DTTIMECFG */
+#define _TIMER_DTTIMECFG_RESETVALUE                       0x00000000UL
+#define _TIMER_DTTIMECFG_MASK                             0x00000007UL
+#define TIMER_DTTIMECFG_DTFALLT                           (0x1UL << 0)
+#define _TIMER_DTTIMECFG_DTFALLT_SHIFT                    0
+#define _TIMER_DTTIMECFG_DTFALLT_MASK                     0x1UL
+#define _TIMER_DTTIMECFG_DTFALLT_DEFAULT                  0x00000000UL
+#define TIMER_DTTIMECFG_DTFALLT_DEFAULT                   (_TIMER_DTTIMECFG_DTFALLT_DEFAULT << 0)
+#define TIMER_DTTIMECFG_DTPRESC                           (0x1UL << 1)
+#define _TIMER_DTTIMECFG_DTPRESC_SHIFT                    1
+#define _TIMER_DTTIMECFG_DTPRESC_MASK                     0x2UL
+#define _TIMER_DTTIMECFG_DTPRESC_DEFAULT                  0x00000000UL
+#define TIMER_DTTIMECFG_DTPRESC_DEFAULT                   (_TIMER_DTTIMECFG_DTPRESC_DEFAULT << 1)
+#define TIMER_DTTIMECFG_DTRISET                           (0x1UL << 2)
+#define _TIMER_DTTIMECFG_DTRISET_SHIFT                    2
+#define _TIMER_DTTIMECFG_DTRISET_MASK                     0x4UL
+#define _TIMER_DTTIMECFG_DTRISET_DEFAULT                  0x00000000UL
+#define TIMER_DTTIMECFG_DTRISET_DEFAULT                   (_TIMER_DTTIMECFG_DTRISET_DEFAULT << 2)
+
+/* Bit fields for TIMER EN */
+#define _TIMER_EN_RESETVALUE                              0x00000000UL
+#define _TIMER_EN_MASK                                    0x00000001UL
+#define TIMER_EN_EN                                       (0x1UL << 0)
+#define _TIMER_EN_EN_SHIFT                                0
+#define _TIMER_EN_EN_MASK                                 0x1UL
+#define _TIMER_EN_EN_DEFAULT                              0x00000000UL
+#define TIMER_EN_EN_DEFAULT                               (_TIMER_EN_EN_DEFAULT << 0)
+
+/* Bit fields for TIMER IEN */
+#define _TIMER_IEN_RESETVALUE                             0x00000000UL
+#define _TIMER_IEN_MASK                                   0x00000077UL
+#define TIMER_IEN_OF                                      (0x1UL << 0)
+#define _TIMER_IEN_OF_SHIFT                               0
+#define _TIMER_IEN_OF_MASK                                0x1UL
+#define _TIMER_IEN_OF_DEFAULT                             0x00000000UL
+#define TIMER_IEN_OF_DEFAULT                              (_TIMER_IEN_OF_DEFAULT << 0)
+#define TIMER_IEN_UF                                      (0x1UL << 1)
+#define _TIMER_IEN_UF_SHIFT                               1
+#define _TIMER_IEN_UF_MASK                                0x2UL
+#define _TIMER_IEN_UF_DEFAULT                             0x00000000UL
+#define TIMER_IEN_UF_DEFAULT                              (_TIMER_IEN_UF_DEFAULT << 1)
+#define TIMER_IEN_DIRCHG                                  (0x1UL << 2)
+#define _TIMER_IEN_DIRCHG_SHIFT                           2
+#define _TIMER_IEN_DIRCHG_MASK                            0x4UL
+#define _TIMER_IEN_DIRCHG_DEFAULT                         0x00000000UL
+#define TIMER_IEN_DIRCHG_DEFAULT                          (_TIMER_IEN_DIRCHG_DEFAULT << 2)
+#define TIMER_IEN_CC0                                     (0x1UL << 4)
+#define _TIMER_IEN_CC0_SHIFT                              4
+#define _TIMER_IEN_CC0_MASK                               0x10UL
+#define _TIMER_IEN_CC0_DEFAULT                            0x00000000UL
+#define TIMER_IEN_CC0_DEFAULT                             (_TIMER_IEN_CC0_DEFAULT << 4)
+#define TIMER_IEN_CC1                                     (0x1UL << 5)
+#define _TIMER_IEN_CC1_SHIFT                              5
+#define _TIMER_IEN_CC1_MASK                               0x20UL
+#define _TIMER_IEN_CC1_DEFAULT                            0x00000000UL
+#define TIMER_IEN_CC1_DEFAULT                             (_TIMER_IEN_CC1_DEFAULT << 5)
+#define TIMER_IEN_CC2                                     (0x1UL << 6)
+#define _TIMER_IEN_CC2_SHIFT                              6
+#define _TIMER_IEN_CC2_MASK                               0x40UL
+#define _TIMER_IEN_CC2_DEFAULT                            0x00000000UL
+#define TIMER_IEN_CC2_DEFAULT                             (_TIMER_IEN_CC2_DEFAULT << 6)
+
+/* Bit fields for TIMER IF */
+#define _TIMER_IF_RESETVALUE                              0x00000000UL
+#define _TIMER_IF_MASK                                    0x00000077UL
+#define TIMER_IF_OF                                       (0x1UL << 0)
+#define _TIMER_IF_OF_SHIFT                                0
+#define _TIMER_IF_OF_MASK                                 0x1UL
+#define _TIMER_IF_OF_DEFAULT                              0x00000000UL
+#define TIMER_IF_OF_DEFAULT                               (_TIMER_IF_OF_DEFAULT << 0)
+#define TIMER_IF_UF                                       (0x1UL << 1)
+#define _TIMER_IF_UF_SHIFT                                1
+#define _TIMER_IF_UF_MASK                                 0x2UL
+#define _TIMER_IF_UF_DEFAULT                              0x00000000UL
+#define TIMER_IF_UF_DEFAULT                               (_TIMER_IF_UF_DEFAULT << 1)
+#define TIMER_IF_DIRCHG                                   (0x1UL << 2)
+#define _TIMER_IF_DIRCHG_SHIFT                            2
+#define _TIMER_IF_DIRCHG_MASK                             0x4UL
+#define _TIMER_IF_DIRCHG_DEFAULT                          0x00000000UL
+#define TIMER_IF_DIRCHG_DEFAULT                           (_TIMER_IF_DIRCHG_DEFAULT << 2)
+#define TIMER_IF_CC0                                      (0x1UL << 4)
+#define _TIMER_IF_CC0_SHIFT                               4
+#define _TIMER_IF_CC0_MASK                                0x10UL
+#define _TIMER_IF_CC0_DEFAULT                             0x00000000UL
+#define TIMER_IF_CC0_DEFAULT                              (_TIMER_IF_CC0_DEFAULT << 4)
+#define TIMER_IF_CC1                                      (0x1UL << 5)
+#define _TIMER_IF_CC1_SHIFT                               5
+#define _TIMER_IF_CC1_MASK                                0x20UL
+#define _TIMER_IF_CC1_DEFAULT                             0x00000000UL
+#define TIMER_IF_CC1_DEFAULT                              (_TIMER_IF_CC1_DEFAULT << 5)
+#define TIMER_IF_CC2                                      (0x1UL << 6)
+#define _TIMER_IF_CC2_SHIFT                               6
+#define _TIMER_IF_CC2_MASK                                0x40UL
+#define _TIMER_IF_CC2_DEFAULT                             0x00000000UL
+#define TIMER_IF_CC2_DEFAULT                              (_TIMER_IF_CC2_DEFAULT << 6)
+
+/* Bit fields for TIMER IFC */
+#define _TIMER_IFC_RESETVALUE                             0x00000000UL
+#define _TIMER_IFC_MASK                                   0x00000000UL
+
+/* Bit fields for TIMER IFS */
+#define _TIMER_IFS_RESETVALUE                             0x00000000UL
+#define _TIMER_IFS_MASK                                   0x00000000UL
+
+/* Bit fields for TIMER STATUS */
+#define _TIMER_STATUS_RESETVALUE                          0x00000000UL
+#define _TIMER_STATUS_MASK                                0x0000000FUL
+#define TIMER_STATUS_RUNNING                              (0x1UL << 0)
+#define _TIMER_STATUS_RUNNING_SHIFT                       0
+#define _TIMER_STATUS_RUNNING_MASK                        0x1UL
+#define _TIMER_STATUS_RUNNING_DEFAULT                     0x00000000UL
+#define TIMER_STATUS_RUNNING_DEFAULT                      (_TIMER_STATUS_RUNNING_DEFAULT << 0)
+#define TIMER_STATUS_DIR                                  (0x1UL << 1)
+#define _TIMER_STATUS_DIR_SHIFT                           1
+#define _TIMER_STATUS_DIR_MASK                            0x2UL
+#define _TIMER_STATUS_DIR_DEFAULT                         0x00000000UL
+#define TIMER_STATUS_DIR_DEFAULT                          (_TIMER_STATUS_DIR_DEFAULT << 1)
+#define TIMER_STATUS_TOPBV                                (0x1UL << 2)
+#define _TIMER_STATUS_TOPBV_SHIFT                         2
+#define _TIMER_STATUS_TOPBV_MASK                          0x4UL
+#define _TIMER_STATUS_TOPBV_DEFAULT                       0x00000000UL
+#define TIMER_STATUS_TOPBV_DEFAULT                        (_TIMER_STATUS_TOPBV_DEFAULT << 2)
+#define TIMER_STATUS_SYNCBUSY                             (0x1UL << 3)
+#define _TIMER_STATUS_SYNCBUSY_SHIFT                      3
+#define _TIMER_STATUS_SYNCBUSY_MASK                       0x8UL
+#define _TIMER_STATUS_SYNCBUSY_DEFAULT                    0x00000000UL
+#define TIMER_STATUS_SYNCBUSY_DEFAULT                     (_TIMER_STATUS_SYNCBUSY_DEFAULT << 3)
+
+/* Bit fields for TIMER TOP */
+#define _TIMER_TOP_RESETVALUE                             0x0000FFFFUL
+#define _TIMER_TOP_MASK                                   0x0000FFFFUL
+#define _TIMER_TOP_TOP_SHIFT                              0
+#define _TIMER_TOP_TOP_MASK                               0xFFFFUL
+#define _TIMER_TOP_TOP_DEFAULT                            0x0000FFFFUL
+#define TIMER_TOP_TOP_DEFAULT                             (_TIMER_TOP_TOP_DEFAULT << 0)
+
+/* Bit fields for TIMER TOPB */
+#define _TIMER_TOPB_RESETVALUE                            0x00000000UL
+#define _TIMER_TOPB_MASK                                  0x0000FFFFUL
+#define _TIMER_TOPB_TOPB_SHIFT                            0
+#define _TIMER_TOPB_TOPB_MASK                             0xFFFFUL
+#define _TIMER_TOPB_TOPB_DEFAULT                          0x00000000UL
+#define TIMER_TOPB_TOPB_DEFAULT                           (_TIMER_TOPB_TOPB_DEFAULT << 0)
+
+/* Bit fields for TIMER CC_CFG */
+#define _TIMER_CC_CFG_RESETVALUE                          0x00000000UL
+#define _TIMER_CC_CFG_MASK                                0x0020007FUL
+#define _TIMER_CC_CFG_MODE_SHIFT                          0
+#define _TIMER_CC_CFG_MODE_MASK                           0x3UL
+#define _TIMER_CC_CFG_MODE_DEFAULT                        0x00000000UL
+#define TIMER_CC_CFG_MODE_DEFAULT                         (_TIMER_CC_CFG_MODE_DEFAULT << 0)
+#define _TIMER_CC_CFG_MODE_OFF                            0x00000000UL
+#define _TIMER_CC_CFG_MODE_INPUTCAPTURE                   0x00000001UL
+#define _TIMER_CC_CFG_MODE_OUTPUTCOMPARE                  0x00000002UL
+#define _TIMER_CC_CFG_MODE_PWM                            0x00000003UL
+#define TIMER_CC_CFG_MODE_OFF                             (_TIMER_CC_CFG_MODE_OFF << 0)
+#define TIMER_CC_CFG_MODE_INPUTCAPTURE                    (_TIMER_CC_CFG_MODE_INPUTCAPTURE << 0)
+#define TIMER_CC_CFG_MODE_OUTPUTCOMPARE                   (_TIMER_CC_CFG_MODE_OUTPUTCOMPARE << 0)
+#define TIMER_CC_CFG_MODE_PWM                             (_TIMER_CC_CFG_MODE_PWM << 0)
+#define TIMER_CC_CFG_COIST                                (0x1UL << 2)
+#define _TIMER_CC_CFG_COIST_SHIFT                         2
+#define _TIMER_CC_CFG_COIST_MASK                          0x4UL
+#define _TIMER_CC_CFG_COIST_DEFAULT                       0x00000000UL
+#define TIMER_CC_CFG_COIST_DEFAULT                        (_TIMER_CC_CFG_COIST_DEFAULT << 2)
+#define _TIMER_CC_CFG_INSEL_SHIFT                         3
+#define _TIMER_CC_CFG_INSEL_MASK                          0x38UL
+#define _TIMER_CC_CFG_INSEL_DEFAULT                       0x00000000UL
+#define TIMER_CC_CFG_INSEL_DEFAULT                        (_TIMER_CC_CFG_INSEL_DEFAULT << 3)
+#define _TIMER_CC_CFG_INSEL_PIN                           0x00000001UL
+#define _TIMER_CC_CFG_INSEL_PRSASYNCLEVEL                 0x00000002UL
+#define _TIMER_CC_CFG_INSEL_PRSASYNCPULSE                 0x00000003UL
+#define _TIMER_CC_CFG_INSEL_PRSSYNC                       0x00000004UL
+#define TIMER_CC_CFG_INSEL_PIN                            (_TIMER_CC_CFG_INSEL_PIN << 3)
+#define TIMER_CC_CFG_INSEL_PRSASYNCLEVEL                  (_TIMER_CC_CFG_INSEL_PRSASYNCLEVEL << 3)
+#define TIMER_CC_CFG_INSEL_PRSASYNCPULSE                  (_TIMER_CC_CFG_INSEL_PRSASYNCPULSE << 3)
+#define TIMER_CC_CFG_INSEL_PRSSYNC                        (_TIMER_CC_CFG_INSEL_PRSSYNC << 3)
+#define TIMER_CC_CFG_PRSCONF                              (0x1UL << 6)
+#define _TIMER_CC_CFG_PRSCONF_SHIFT                       6
+#define _TIMER_CC_CFG_PRSCONF_MASK                        0x40UL
+#define _TIMER_CC_CFG_PRSCONF_DEFAULT                     0x00000000UL
+#define TIMER_CC_CFG_PRSCONF_DEFAULT                      (_TIMER_CC_CFG_PRSCONF_DEFAULT << 6)
+#define TIMER_CC_CFG_FILT                                 (0x1UL << 21)
+#define _TIMER_CC_CFG_FILT_SHIFT                          21
+#define _TIMER_CC_CFG_FILT_MASK                           0x200000UL
+#define _TIMER_CC_CFG_FILT_DEFAULT                        0x00000000UL
+#define TIMER_CC_CFG_FILT_DEFAULT                         (_TIMER_CC_CFG_FILT_DEFAULT << 21)
+#define _TIMER_CC_CFG_FILT_DISABLE                        0x00000000UL
+#define _TIMER_CC_CFG_FILT_ENABLE                         0x00000001UL
+#define TIMER_CC_CFG_FILT_DISABLE                         (_TIMER_CC_CFG_FILT_DISABLE << 21)
+#define TIMER_CC_CFG_FILT_ENABLE                          (_TIMER_CC_CFG_FILT_ENABLE << 21)
+
+/* Bit fields for TIMER CC_CTRL */
+#define _TIMER_CC_CTRL_RESETVALUE                         0x00000000UL
+#define _TIMER_CC_CTRL_MASK                               0x000003FFUL
+#define TIMER_CC_CTRL_CMOA                                (0x1UL << 0)
+#define _TIMER_CC_CTRL_CMOA_SHIFT                         0
+#define _TIMER_CC_CTRL_CMOA_MASK                          0x1UL
+#define _TIMER_CC_CTRL_CMOA_DEFAULT                       0x00000000UL
+#define TIMER_CC_CTRL_CMOA_DEFAULT                        (_TIMER_CC_CTRL_CMOA_DEFAULT << 0)
+#define TIMER_CC_CTRL_COFOA                               (0x1UL << 1)
+#define _TIMER_CC_CTRL_COFOA_SHIFT                        1
+#define _TIMER_CC_CTRL_COFOA_MASK                         0x2UL
+#define _TIMER_CC_CTRL_COFOA_DEFAULT                      0x00000000UL
+#define TIMER_CC_CTRL_COFOA_DEFAULT                       (_TIMER_CC_CTRL_COFOA_DEFAULT << 1)
+#define _TIMER_CC_CTRL_CUFOA_SHIFT                        2
+#define _TIMER_CC_CTRL_CUFOA_MASK                         0xCUL
+#define _TIMER_CC_CTRL_CUFOA_DEFAULT                      0x00000000UL
+#define TIMER_CC_CTRL_CUFOA_DEFAULT                       (_TIMER_CC_CTRL_CUFOA_DEFAULT << 2)
+#define _TIMER_CC_CTRL_CUFOA_NONE                         0x00000000UL
+#define _TIMER_CC_CTRL_CUFOA_CLEAR                        0x00000001UL
+#define _TIMER_CC_CTRL_CUFOA_SET                          0x00000002UL
+#define _TIMER_CC_CTRL_CUFOA_TOGGLE                       0x00000003UL
+#define TIMER_CC_CTRL_CUFOA_NONE                          (_TIMER_CC_CTRL_CUFOA_NONE << 2)
+#define TIMER_CC_CTRL_CUFOA_CLEAR                         (_TIMER_CC_CTRL_CUFOA_CLEAR << 2)
+#define TIMER_CC_CTRL_CUFOA_SET                           (_TIMER_CC_CTRL_CUFOA_SET << 2)
+#define TIMER_CC_CTRL_CUFOA_TOGGLE                        (_TIMER_CC_CTRL_CUFOA_TOGGLE << 2)
+#define _TIMER_CC_CTRL_ICEDGE_SHIFT                       4
+#define _TIMER_CC_CTRL_ICEDGE_MASK                        0x30UL
+#define _TIMER_CC_CTRL_ICEDGE_DEFAULT                     0x00000000UL
+#define TIMER_CC_CTRL_ICEDGE_DEFAULT                      (_TIMER_CC_CTRL_ICEDGE_DEFAULT << 4)
+#define _TIMER_CC_CTRL_ICEDGE_NONE                        0x00000000UL
+#define _TIMER_CC_CTRL_ICEDGE_BOTH                        0x00000001UL
+#define _TIMER_CC_CTRL_ICEDGE_FALLING                     0x00000002UL
+#define _TIMER_CC_CTRL_ICEDGE_RISING                      0x00000003UL
+#define TIMER_CC_CTRL_ICEDGE_NONE                         (_TIMER_CC_CTRL_ICEDGE_NONE << 4)
+#define TIMER_CC_CTRL_ICEDGE_BOTH                         (_TIMER_CC_CTRL_ICEDGE_BOTH << 4)
+#define TIMER_CC_CTRL_ICEDGE_FALLING                      (_TIMER_CC_CTRL_ICEDGE_FALLING << 4)
+#define TIMER_CC_CTRL_ICEDGE_RISING                       (_TIMER_CC_CTRL_ICEDGE_RISING << 4)
+#define _TIMER_CC_CTRL_ICEVCTRL_SHIFT                     6
+#define _TIMER_CC_CTRL_ICEVCTRL_MASK                      0x1C0UL
+#define _TIMER_CC_CTRL_ICEVCTRL_DEFAULT                   0x00000000UL
+#define TIMER_CC_CTRL_ICEVCTRL_DEFAULT                    (_TIMER_CC_CTRL_ICEVCTRL_DEFAULT << 6)
+#define _TIMER_CC_CTRL_ICEVCTRL_EVERYEDGE                 0x00000001UL
+#define _TIMER_CC_CTRL_ICEVCTRL_EVERYSECONDEDGE           0x00000002UL
+#define _TIMER_CC_CTRL_ICEVCTRL_FALLING                   0x00000003UL
+#define _TIMER_CC_CTRL_ICEVCTRL_RISING                    0x00000004UL
+#define TIMER_CC_CTRL_ICEVCTRL_EVERYEDGE                  (_TIMER_CC_CTRL_ICEVCTRL_EVERYEDGE << 6)
+#define TIMER_CC_CTRL_ICEVCTRL_EVERYSECONDEDGE            (_TIMER_CC_CTRL_ICEVCTRL_EVERYSECONDEDGE << 6)
+#define TIMER_CC_CTRL_ICEVCTRL_FALLING                    (_TIMER_CC_CTRL_ICEVCTRL_FALLING << 6)
+#define TIMER_CC_CTRL_ICEVCTRL_RISING                     (_TIMER_CC_CTRL_ICEVCTRL_RISING << 6)
+#define TIMER_CC_CTRL_OUTINV                              (0x1UL << 9)
+#define _TIMER_CC_CTRL_OUTINV_SHIFT                       9
+#define _TIMER_CC_CTRL_OUTINV_MASK                        0x200UL
+#define _TIMER_CC_CTRL_OUTINV_DEFAULT                     0x00000000UL
+#define TIMER_CC_CTRL_OUTINV_DEFAULT                      (_TIMER_CC_CTRL_OUTINV_DEFAULT << 9)
+
+/******************************************************************************
+ * USART
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t CLKDIV;
+  __IOM uint32_t CMD;
+  __IOM uint32_t CTRL;
+  __IOM uint32_t CTRLX;
+  __IOM uint32_t EN;
+  __IOM uint32_t FRAME;
+  __IOM uint32_t I2SCTRL;
+  __IOM uint32_t IEN;
+  __IOM uint32_t IF;
+  __IOM uint32_t IFC;
+  __IOM uint32_t IFS;
+  __IOM uint32_t IRCTRL;
+  __IOM uint32_t RXDATA;
+  __IOM uint32_t RXDATAX;
+  __IOM uint32_t RXDOUBLE;
+  __IOM uint32_t RXDOUBLEX;
+  __IOM uint32_t STATUS;
+  __IOM uint32_t TIMING;
+  __IOM uint32_t TRIGCTRL;
+  __IOM uint32_t TXDATA;
+  __IOM uint32_t TXDATAX;
+  __IOM uint32_t TXDOUBLE;
+  __IOM uint32_t TXDOUBLEX;
+  uint32_t RESERVED0[1001];
+  __IOM uint32_t CLKDIV_SET;
+  __IOM uint32_t CMD_SET;
+  __IOM uint32_t CTRL_SET;
+  __IOM uint32_t CTRLX_SET;
+  __IOM uint32_t EN_SET;
+  __IOM uint32_t FRAME_SET;
+  __IOM uint32_t I2SCTRL_SET;
+  __IOM uint32_t IEN_SET;
+  __IOM uint32_t IF_SET;
+  __IOM uint32_t IFC_SET;
+  __IOM uint32_t IFS_SET;
+  __IOM uint32_t IRCTRL_SET;
+  __IOM uint32_t RXDATA_SET;
+  __IOM uint32_t RXDATAX_SET;
+  __IOM uint32_t RXDOUBLE_SET;
+  __IOM uint32_t RXDOUBLEX_SET;
+  __IOM uint32_t STATUS_SET;
+  __IOM uint32_t TIMING_SET;
+  __IOM uint32_t TRIGCTRL_SET;
+  __IOM uint32_t TXDATA_SET;
+  __IOM uint32_t TXDATAX_SET;
+  __IOM uint32_t TXDOUBLE_SET;
+  __IOM uint32_t TXDOUBLEX_SET;
+  uint32_t RESERVED1[1001];
+  __IOM uint32_t CLKDIV_CLR;
+  __IOM uint32_t CMD_CLR;
+  __IOM uint32_t CTRL_CLR;
+  __IOM uint32_t CTRLX_CLR;
+  __IOM uint32_t EN_CLR;
+  __IOM uint32_t FRAME_CLR;
+  __IOM uint32_t I2SCTRL_CLR;
+  __IOM uint32_t IEN_CLR;
+  __IOM uint32_t IF_CLR;
+  __IOM uint32_t IFC_CLR;
+  __IOM uint32_t IFS_CLR;
+  __IOM uint32_t IRCTRL_CLR;
+  __IOM uint32_t RXDATA_CLR;
+  __IOM uint32_t RXDATAX_CLR;
+  __IOM uint32_t RXDOUBLE_CLR;
+  __IOM uint32_t RXDOUBLEX_CLR;
+  __IOM uint32_t STATUS_CLR;
+  __IOM uint32_t TIMING_CLR;
+  __IOM uint32_t TRIGCTRL_CLR;
+  __IOM uint32_t TXDATA_CLR;
+  __IOM uint32_t TXDATAX_CLR;
+  __IOM uint32_t TXDOUBLE_CLR;
+  __IOM uint32_t TXDOUBLEX_CLR;
+  uint32_t RESERVED2[1001];
+  __IOM uint32_t CLKDIV_TGL;
+  __IOM uint32_t CMD_TGL;
+  __IOM uint32_t CTRL_TGL;
+  __IOM uint32_t CTRLX_TGL;
+  __IOM uint32_t EN_TGL;
+  __IOM uint32_t FRAME_TGL;
+  __IOM uint32_t I2SCTRL_TGL;
+  __IOM uint32_t IEN_TGL;
+  __IOM uint32_t IF_TGL;
+  __IOM uint32_t IFC_TGL;
+  __IOM uint32_t IFS_TGL;
+  __IOM uint32_t IRCTRL_TGL;
+  __IOM uint32_t RXDATA_TGL;
+  __IOM uint32_t RXDATAX_TGL;
+  __IOM uint32_t RXDOUBLE_TGL;
+  __IOM uint32_t RXDOUBLEX_TGL;
+  __IOM uint32_t STATUS_TGL;
+  __IOM uint32_t TIMING_TGL;
+  __IOM uint32_t TRIGCTRL_TGL;
+  __IOM uint32_t TXDATA_TGL;
+  __IOM uint32_t TXDATAX_TGL;
+  __IOM uint32_t TXDOUBLE_TGL;
+  __IOM uint32_t TXDOUBLEX_TGL;
+  uint32_t RESERVED3[1001];
+} USART_TypeDef;
+
+/* Bit fields for USART CLKDIV */
+#define _USART_CLKDIV_RESETVALUE                          0x00000000UL
+#define _USART_CLKDIV_MASK                                0x007FFFF8UL
+#define _USART_CLKDIV_DIV_SHIFT                           3
+#define _USART_CLKDIV_DIV_MASK                            0x7FFFF8UL
+#define _USART_CLKDIV_DIV_DEFAULT                         0x00000000UL
+#define USART_CLKDIV_DIV_DEFAULT                          (_USART_CLKDIV_DIV_DEFAULT << 3)
+
+/* Bit fields for USART CMD */
+#define _USART_CMD_RESETVALUE                             0x00000000UL
+#define _USART_CMD_MASK                                   0x00000FFFUL
+#define USART_CMD_RXEN                                    (0x1UL << 0)
+#define _USART_CMD_RXEN_SHIFT                             0
+#define _USART_CMD_RXEN_MASK                              0x1UL
+#define _USART_CMD_RXEN_DEFAULT                           0x00000000UL
+#define USART_CMD_RXEN_DEFAULT                            (_USART_CMD_RXEN_DEFAULT << 0)
+#define USART_CMD_RXDIS                                   (0x1UL << 1)
+#define _USART_CMD_RXDIS_SHIFT                            1
+#define _USART_CMD_RXDIS_MASK                             0x2UL
+#define _USART_CMD_RXDIS_DEFAULT                          0x00000000UL
+#define USART_CMD_RXDIS_DEFAULT                           (_USART_CMD_RXDIS_DEFAULT << 1)
+#define USART_CMD_RXBLOCKEN                               (0x1UL << 2)
+#define _USART_CMD_RXBLOCKEN_SHIFT                        2
+#define _USART_CMD_RXBLOCKEN_MASK                         0x4UL
+#define _USART_CMD_RXBLOCKEN_DEFAULT                      0x00000000UL
+#define USART_CMD_RXBLOCKEN_DEFAULT                       (_USART_CMD_RXBLOCKEN_DEFAULT << 2)
+#define USART_CMD_RXBLOCKDIS                              (0x1UL << 3)
+#define _USART_CMD_RXBLOCKDIS_SHIFT                       3
+#define _USART_CMD_RXBLOCKDIS_MASK                        0x8UL
+#define _USART_CMD_RXBLOCKDIS_DEFAULT                     0x00000000UL
+#define USART_CMD_RXBLOCKDIS_DEFAULT                      (_USART_CMD_RXBLOCKDIS_DEFAULT << 3)
+#define USART_CMD_TXEN                                    (0x1UL << 4)
+#define _USART_CMD_TXEN_SHIFT                             4
+#define _USART_CMD_TXEN_MASK                              0x10UL
+#define _USART_CMD_TXEN_DEFAULT                           0x00000000UL
+#define USART_CMD_TXEN_DEFAULT                            (_USART_CMD_TXEN_DEFAULT << 4)
+#define USART_CMD_TXDIS                                   (0x1UL << 5)
+#define _USART_CMD_TXDIS_SHIFT                            5
+#define _USART_CMD_TXDIS_MASK                             0x20UL
+#define _USART_CMD_TXDIS_DEFAULT                          0x00000000UL
+#define USART_CMD_TXDIS_DEFAULT                           (_USART_CMD_TXDIS_DEFAULT << 5)
+#define USART_CMD_MASTEREN                                (0x1UL << 6)
+#define _USART_CMD_MASTEREN_SHIFT                         6
+#define _USART_CMD_MASTEREN_MASK                          0x40UL
+#define _USART_CMD_MASTEREN_DEFAULT                       0x00000000UL
+#define USART_CMD_MASTEREN_DEFAULT                        (_USART_CMD_MASTEREN_DEFAULT << 6)
+#define USART_CMD_MASTERDIS                               (0x1UL << 7)
+#define _USART_CMD_MASTERDIS_SHIFT                        7
+#define _USART_CMD_MASTERDIS_MASK                         0x80UL
+#define _USART_CMD_MASTERDIS_DEFAULT                      0x00000000UL
+#define USART_CMD_MASTERDIS_DEFAULT                       (_USART_CMD_MASTERDIS_DEFAULT << 7)
+#define USART_CMD_TXTRIEN                                 (0x1UL << 8)
+#define _USART_CMD_TXTRIEN_SHIFT                          8
+#define _USART_CMD_TXTRIEN_MASK                           0x100UL
+#define _USART_CMD_TXTRIEN_DEFAULT                        0x00000000UL
+#define USART_CMD_TXTRIEN_DEFAULT                         (_USART_CMD_TXTRIEN_DEFAULT << 8)
+#define USART_CMD_TXTRIDIS                                (0x1UL << 9)
+#define _USART_CMD_TXTRIDIS_SHIFT                         9
+#define _USART_CMD_TXTRIDIS_MASK                          0x200UL
+#define _USART_CMD_TXTRIDIS_DEFAULT                       0x00000000UL
+#define USART_CMD_TXTRIDIS_DEFAULT                        (_USART_CMD_TXTRIDIS_DEFAULT << 9)
+#define USART_CMD_CLEARTX                                 (0x1UL << 10)
+#define _USART_CMD_CLEARTX_SHIFT                          10
+#define _USART_CMD_CLEARTX_MASK                           0x400UL
+#define _USART_CMD_CLEARTX_DEFAULT                        0x00000000UL
+#define USART_CMD_CLEARTX_DEFAULT                         (_USART_CMD_CLEARTX_DEFAULT << 10)
+#define USART_CMD_CLEARRX                                 (0x1UL << 11)
+#define _USART_CMD_CLEARRX_SHIFT                          11
+#define _USART_CMD_CLEARRX_MASK                           0x800UL
+#define _USART_CMD_CLEARRX_DEFAULT                        0x00000000UL
+#define USART_CMD_CLEARRX_DEFAULT                         (_USART_CMD_CLEARRX_DEFAULT << 11)
+
+/* Bit fields for USART CTRL */
+#define _USART_CTRL_RESETVALUE                            0x00000000UL
+#define _USART_CTRL_MASK                                  0x00001FFFUL
+#define USART_CTRL_SYNC                                   (0x1UL << 0)
+#define _USART_CTRL_SYNC_SHIFT                            0
+#define _USART_CTRL_SYNC_MASK                             0x1UL
+#define _USART_CTRL_SYNC_DEFAULT                          0x00000000UL
+#define USART_CTRL_SYNC_DEFAULT                           (_USART_CTRL_SYNC_DEFAULT << 0)
+#define USART_CTRL_LOOPBK                                 (0x1UL << 1)
+#define _USART_CTRL_LOOPBK_SHIFT                          1
+#define _USART_CTRL_LOOPBK_MASK                           0x2UL
+#define _USART_CTRL_LOOPBK_DEFAULT                        0x00000000UL
+#define USART_CTRL_LOOPBK_DEFAULT                         (_USART_CTRL_LOOPBK_DEFAULT << 1)
+#define USART_CTRL_AUTOCS                                 (0x1UL << 2)
+#define _USART_CTRL_AUTOCS_SHIFT                          2
+#define _USART_CTRL_AUTOCS_MASK                           0x4UL
+#define _USART_CTRL_AUTOCS_DEFAULT                        0x00000000UL
+#define USART_CTRL_AUTOCS_DEFAULT                         (_USART_CTRL_AUTOCS_DEFAULT << 2)
+#define USART_CTRL_AUTOTX                                 (0x1UL << 3)
+#define _USART_CTRL_AUTOTX_SHIFT                          3
+#define _USART_CTRL_AUTOTX_MASK                           0x8UL
+#define _USART_CTRL_AUTOTX_DEFAULT                        0x00000000UL
+#define USART_CTRL_AUTOTX_DEFAULT                         (_USART_CTRL_AUTOTX_DEFAULT << 3)
+#define USART_CTRL_CLKPHA                                 (0x1UL << 4)
+#define _USART_CTRL_CLKPHA_SHIFT                          4
+#define _USART_CTRL_CLKPHA_MASK                           0x10UL
+#define _USART_CTRL_CLKPHA_DEFAULT                        0x00000000UL
+#define USART_CTRL_CLKPHA_DEFAULT                         (_USART_CTRL_CLKPHA_DEFAULT << 4)
+#define _USART_CTRL_CLKPHA_SAMPLELEADING                  0x00000000UL
+#define _USART_CTRL_CLKPHA_SAMPLETRAILING                 0x00000001UL
+#define USART_CTRL_CLKPHA_SAMPLELEADING                   (_USART_CTRL_CLKPHA_SAMPLELEADING << 4)
+#define USART_CTRL_CLKPHA_SAMPLETRAILING                  (_USART_CTRL_CLKPHA_SAMPLETRAILING << 4)
+#define _USART_CTRL_OVS_SHIFT                             5
+#define _USART_CTRL_OVS_MASK                              0x60UL
+#define _USART_CTRL_OVS_DEFAULT                           0x00000000UL
+#define USART_CTRL_OVS_DEFAULT                            (_USART_CTRL_OVS_DEFAULT << 5)
+#define _USART_CTRL_OVS_X16                               0x00000000UL
+#define _USART_CTRL_OVS_X8                                0x00000001UL
+#define _USART_CTRL_OVS_X6                                0x00000002UL
+#define _USART_CTRL_OVS_X4                                0x00000003UL
+#define USART_CTRL_OVS_X16                                (_USART_CTRL_OVS_X16 << 5)
+#define USART_CTRL_OVS_X8                                 (_USART_CTRL_OVS_X8 << 5)
+#define USART_CTRL_OVS_X6                                 (_USART_CTRL_OVS_X6 << 5)
+#define USART_CTRL_OVS_X4                                 (_USART_CTRL_OVS_X4 << 5)
+#define USART_CTRL_CLKPOL                                 (0x1UL << 7)
+#define _USART_CTRL_CLKPOL_SHIFT                          7
+#define _USART_CTRL_CLKPOL_MASK                           0x80UL
+#define _USART_CTRL_CLKPOL_DEFAULT                        0x00000000UL
+#define USART_CTRL_CLKPOL_DEFAULT                         (_USART_CTRL_CLKPOL_DEFAULT << 7)
+#define _USART_CTRL_CLKPOL_IDLELOW                        0x00000000UL
+#define _USART_CTRL_CLKPOL_IDLEHIGH                       0x00000001UL
+#define USART_CTRL_CLKPOL_IDLELOW                         (_USART_CTRL_CLKPOL_IDLELOW << 7)
+#define USART_CTRL_CLKPOL_IDLEHIGH                        (_USART_CTRL_CLKPOL_IDLEHIGH << 7)
+#define USART_CTRL_MSBF                                   (0x1UL << 8)
+#define _USART_CTRL_MSBF_SHIFT                            8
+#define _USART_CTRL_MSBF_MASK                             0x100UL
+#define _USART_CTRL_MSBF_DEFAULT                          0x00000000UL
+#define USART_CTRL_MSBF_DEFAULT                           (_USART_CTRL_MSBF_DEFAULT << 8)
+#define USART_CTRL_MVDIS                                  (0x1UL << 9)
+#define _USART_CTRL_MVDIS_SHIFT                           9
+#define _USART_CTRL_MVDIS_MASK                            0x200UL
+#define _USART_CTRL_MVDIS_DEFAULT                         0x00000000UL
+#define USART_CTRL_MVDIS_DEFAULT                          (_USART_CTRL_MVDIS_DEFAULT << 9)
+#define USART_CTRL_RXINV                                  (0x1UL << 10)
+#define _USART_CTRL_RXINV_SHIFT                           10
+#define _USART_CTRL_RXINV_MASK                            0x400UL
+#define _USART_CTRL_RXINV_DEFAULT                         0x00000000UL
+#define USART_CTRL_RXINV_DEFAULT                          (_USART_CTRL_RXINV_DEFAULT << 10)
+#define USART_CTRL_TXINV                                  (0x1UL << 11)
+#define _USART_CTRL_TXINV_SHIFT                           11
+#define _USART_CTRL_TXINV_MASK                            0x800UL
+#define _USART_CTRL_TXINV_DEFAULT                         0x00000000UL
+#define USART_CTRL_TXINV_DEFAULT                          (_USART_CTRL_TXINV_DEFAULT << 11)
+#define USART_CTRL_TXBIL                                  (0x1UL << 12)
+#define _USART_CTRL_TXBIL_SHIFT                           12
+#define _USART_CTRL_TXBIL_MASK                            0x1000UL
+#define _USART_CTRL_TXBIL_DEFAULT                         0x00000000UL
+#define _USART_CTRL_TXBIL_EMPTY                           0x00000000UL
+#define _USART_CTRL_TXBIL_HALFFULL                        0x00000001UL
+#define USART_CTRL_TXBIL_DEFAULT                          (_USART_CTRL_TXBIL_DEFAULT << 12)
+#define USART_CTRL_TXBIL_EMPTY                            (_USART_CTRL_TXBIL_EMPTY << 12)
+#define USART_CTRL_TXBIL_HALFFULL                         (_USART_CTRL_TXBIL_HALFFULL << 12)
+
+/* Bit fields for USART CTRLX */
+#define _USART_CTRLX_RESETVALUE                           0x00000000UL
+#define _USART_CTRLX_MASK                                 0x00000003UL
+#define USART_CTRLX_CTSEN                                 (0x1UL << 0)
+#define _USART_CTRLX_CTSEN_SHIFT                          0
+#define _USART_CTRLX_CTSEN_MASK                           0x1UL
+#define _USART_CTRLX_CTSEN_DEFAULT                        0x00000000UL
+#define USART_CTRLX_CTSEN_DEFAULT                         (_USART_CTRLX_CTSEN_DEFAULT << 0)
+#define USART_CTRLX_RXPRSEN                               (0x1UL << 1)
+#define _USART_CTRLX_RXPRSEN_SHIFT                        1
+#define _USART_CTRLX_RXPRSEN_MASK                         0x2UL
+#define _USART_CTRLX_RXPRSEN_DEFAULT                      0x00000000UL
+#define USART_CTRLX_RXPRSEN_DEFAULT                       (_USART_CTRLX_RXPRSEN_DEFAULT << 1)
+
+/* Bit fields for USART EN */
+#define _USART_EN_RESETVALUE                              0x00000000UL
+#define _USART_EN_MASK                                    0x00000001UL
+#define USART_EN_EN                                       (0x1UL << 0)
+#define _USART_EN_EN_SHIFT                                0
+#define _USART_EN_EN_MASK                                 0x1UL
+#define _USART_EN_EN_DEFAULT                              0x00000000UL
+#define USART_EN_EN_DEFAULT                               (_USART_EN_EN_DEFAULT << 0)
+
+/* Bit fields for USART FRAME */
+#define _USART_FRAME_RESETVALUE                           0x00001005UL
+#define _USART_FRAME_MASK                                 0x0000330FUL
+#define _USART_FRAME_DATABITS_SHIFT                       0
+#define _USART_FRAME_DATABITS_MASK                        0xFUL
+#define _USART_FRAME_DATABITS_DEFAULT                     0x00000005UL
+#define USART_FRAME_DATABITS_DEFAULT                      (_USART_FRAME_DATABITS_DEFAULT << 0)
+#define _USART_FRAME_DATABITS_FOUR                        0x00000001UL
+#define _USART_FRAME_DATABITS_FIVE                        0x00000002UL
+#define _USART_FRAME_DATABITS_SIX                         0x00000003UL
+#define _USART_FRAME_DATABITS_SEVEN                       0x00000004UL
+#define _USART_FRAME_DATABITS_EIGHT                       0x00000005UL
+#define _USART_FRAME_DATABITS_NINE                        0x00000006UL
+#define _USART_FRAME_DATABITS_TEN                         0x00000007UL
+#define _USART_FRAME_DATABITS_ELEVEN                      0x00000008UL
+#define _USART_FRAME_DATABITS_TWELVE                      0x00000009UL
+#define _USART_FRAME_DATABITS_THIRTEEN                    0x0000000AUL
+#define _USART_FRAME_DATABITS_FOURTEEN                    0x0000000BUL
+#define _USART_FRAME_DATABITS_FIFTEEN                     0x0000000CUL
+#define _USART_FRAME_DATABITS_SIXTEEN                     0x0000000DUL
+#define USART_FRAME_DATABITS_FOUR                         (_USART_FRAME_DATABITS_FOUR << 0)
+#define USART_FRAME_DATABITS_FIVE                         (_USART_FRAME_DATABITS_FIVE << 0)
+#define USART_FRAME_DATABITS_SIX                          (_USART_FRAME_DATABITS_SIX << 0)
+#define USART_FRAME_DATABITS_SEVEN                        (_USART_FRAME_DATABITS_SEVEN << 0)
+#define USART_FRAME_DATABITS_EIGHT                        (_USART_FRAME_DATABITS_EIGHT << 0)
+#define USART_FRAME_DATABITS_NINE                         (_USART_FRAME_DATABITS_NINE << 0)
+#define USART_FRAME_DATABITS_TEN                          (_USART_FRAME_DATABITS_TEN << 0)
+#define USART_FRAME_DATABITS_ELEVEN                       (_USART_FRAME_DATABITS_ELEVEN << 0)
+#define USART_FRAME_DATABITS_TWELVE                       (_USART_FRAME_DATABITS_TWELVE << 0)
+#define USART_FRAME_DATABITS_THIRTEEN                     (_USART_FRAME_DATABITS_THIRTEEN << 0)
+#define USART_FRAME_DATABITS_FOURTEEN                     (_USART_FRAME_DATABITS_FOURTEEN << 0)
+#define USART_FRAME_DATABITS_FIFTEEN                      (_USART_FRAME_DATABITS_FIFTEEN << 0)
+#define USART_FRAME_DATABITS_SIXTEEN                      (_USART_FRAME_DATABITS_SIXTEEN << 0)
+#define _USART_FRAME_PARITY_SHIFT                         8
+#define _USART_FRAME_PARITY_MASK                          0x300UL
+#define _USART_FRAME_PARITY_DEFAULT                       0x00000000UL
+#define USART_FRAME_PARITY_DEFAULT                        (_USART_FRAME_PARITY_DEFAULT << 8)
+#define _USART_FRAME_PARITY_NONE                          0x00000000UL
+#define _USART_FRAME_PARITY_EVEN                          0x00000002UL
+#define _USART_FRAME_PARITY_ODD                           0x00000003UL
+#define USART_FRAME_PARITY_NONE                           (_USART_FRAME_PARITY_NONE << 8)
+#define USART_FRAME_PARITY_EVEN                           (_USART_FRAME_PARITY_EVEN << 8)
+#define USART_FRAME_PARITY_ODD                            (_USART_FRAME_PARITY_ODD << 8)
+#define _USART_FRAME_STOPBITS_SHIFT                       12
+#define _USART_FRAME_STOPBITS_MASK                        0x3000UL
+#define _USART_FRAME_STOPBITS_DEFAULT                     0x00000001UL
+#define USART_FRAME_STOPBITS_DEFAULT                      (_USART_FRAME_STOPBITS_DEFAULT << 12)
+#define _USART_FRAME_STOPBITS_HALF                        0x00000000UL
+#define _USART_FRAME_STOPBITS_ONE                         0x00000001UL
+#define _USART_FRAME_STOPBITS_ONEANDAHALF                 0x00000002UL
+#define _USART_FRAME_STOPBITS_TWO                         0x00000003UL
+#define USART_FRAME_STOPBITS_HALF                         (_USART_FRAME_STOPBITS_HALF << 12)
+#define USART_FRAME_STOPBITS_ONE                          (_USART_FRAME_STOPBITS_ONE << 12)
+#define USART_FRAME_STOPBITS_ONEANDAHALF                  (_USART_FRAME_STOPBITS_ONEANDAHALF << 12)
+#define USART_FRAME_STOPBITS_TWO                          (_USART_FRAME_STOPBITS_TWO << 12)
+
+/* Bit fields for USART I2SCTRL */
+#define _USART_I2SCTRL_RESETVALUE                         0x00000000UL
+#define _USART_I2SCTRL_MASK                               0x000007FFUL
+#define USART_I2SCTRL_DELAY                               (0x1UL << 0)
+#define _USART_I2SCTRL_DELAY_SHIFT                        0
+#define _USART_I2SCTRL_DELAY_MASK                         0x1UL
+#define _USART_I2SCTRL_DELAY_DEFAULT                      0x00000000UL
+#define USART_I2SCTRL_DELAY_DEFAULT                       (_USART_I2SCTRL_DELAY_DEFAULT << 0)
+#define USART_I2SCTRL_DMASPLIT                            (0x1UL << 1)
+#define _USART_I2SCTRL_DMASPLIT_SHIFT                     1
+#define _USART_I2SCTRL_DMASPLIT_MASK                      0x2UL
+#define _USART_I2SCTRL_DMASPLIT_DEFAULT                   0x00000000UL
+#define USART_I2SCTRL_DMASPLIT_DEFAULT                    (_USART_I2SCTRL_DMASPLIT_DEFAULT << 1)
+#define USART_I2SCTRL_EN                                  (0x1UL << 2)
+#define _USART_I2SCTRL_EN_SHIFT                           2
+#define _USART_I2SCTRL_EN_MASK                            0x4UL
+#define _USART_I2SCTRL_EN_DEFAULT                         0x00000000UL
+#define USART_I2SCTRL_EN_DEFAULT                          (_USART_I2SCTRL_EN_DEFAULT << 2)
+#define USART_I2SCTRL_I2SEN                               (0x1UL << 3)
+#define _USART_I2SCTRL_I2SEN_SHIFT                        3
+#define _USART_I2SCTRL_I2SEN_MASK                         0x8UL
+#define _USART_I2SCTRL_I2SEN_DEFAULT                      0x00000000UL
+#define USART_I2SCTRL_I2SEN_DEFAULT                       (_USART_I2SCTRL_I2SEN_DEFAULT << 3)
+#define _USART_I2SCTRL_I2SFORMAT_SHIFT                    4
+#define _USART_I2SCTRL_I2SFORMAT_MASK                     0xF0UL
+#define _USART_I2SCTRL_I2SFORMAT_DEFAULT                  0x00000000UL
+#define USART_I2SCTRL_I2SFORMAT_DEFAULT                   (_USART_I2SCTRL_I2SFORMAT_DEFAULT << 4)
+#define _USART_I2SCTRL_I2SFORMAT_W16D16                   0x00000001UL
+#define _USART_I2SCTRL_I2SFORMAT_W16D8                    0x00000002UL
+#define _USART_I2SCTRL_I2SFORMAT_W32D16                   0x00000003UL
+#define _USART_I2SCTRL_I2SFORMAT_W32D24                   0x00000004UL
+#define _USART_I2SCTRL_I2SFORMAT_W32D24M                  0x00000005UL
+#define _USART_I2SCTRL_I2SFORMAT_W32D32                   0x00000006UL
+#define _USART_I2SCTRL_I2SFORMAT_W32D8                    0x00000007UL
+#define _USART_I2SCTRL_I2SFORMAT_W8D8                     0x00000008UL
+#define USART_I2SCTRL_I2SFORMAT_W16D16                    (_USART_I2SCTRL_I2SFORMAT_W16D16 << 4)
+#define USART_I2SCTRL_I2SFORMAT_W16D8                     (_USART_I2SCTRL_I2SFORMAT_W16D8 << 4)
+#define USART_I2SCTRL_I2SFORMAT_W32D16                    (_USART_I2SCTRL_I2SFORMAT_W32D16 << 4)
+#define USART_I2SCTRL_I2SFORMAT_W32D24                    (_USART_I2SCTRL_I2SFORMAT_W32D24 << 4)
+#define USART_I2SCTRL_I2SFORMAT_W32D24M                   (_USART_I2SCTRL_I2SFORMAT_W32D24M << 4)
+#define USART_I2SCTRL_I2SFORMAT_W32D32                    (_USART_I2SCTRL_I2SFORMAT_W32D32 << 4)
+#define USART_I2SCTRL_I2SFORMAT_W32D8                     (_USART_I2SCTRL_I2SFORMAT_W32D8 << 4)
+#define USART_I2SCTRL_I2SFORMAT_W8D8                      (_USART_I2SCTRL_I2SFORMAT_W8D8 << 4)
+#define _USART_I2SCTRL_I2SJUSTIFY_SHIFT                   8
+#define _USART_I2SCTRL_I2SJUSTIFY_MASK                    0x300UL
+#define _USART_I2SCTRL_I2SJUSTIFY_DEFAULT                 0x00000000UL
+#define USART_I2SCTRL_I2SJUSTIFY_DEFAULT                  (_USART_I2SCTRL_I2SJUSTIFY_DEFAULT << 8)
+#define _USART_I2SCTRL_I2SJUSTIFY_LEFT                    0x00000001UL
+#define _USART_I2SCTRL_I2SJUSTIFY_RIGHT                   0x00000002UL
+#define USART_I2SCTRL_I2SJUSTIFY_LEFT                     (_USART_I2SCTRL_I2SJUSTIFY_LEFT << 8)
+#define USART_I2SCTRL_I2SJUSTIFY_RIGHT                    (_USART_I2SCTRL_I2SJUSTIFY_RIGHT << 8)
+#define USART_I2SCTRL_MONO                                (0x1UL << 10)
+#define _USART_I2SCTRL_MONO_SHIFT                         10
+#define _USART_I2SCTRL_MONO_MASK                          0x400UL
+#define _USART_I2SCTRL_MONO_DEFAULT                       0x00000000UL
+#define USART_I2SCTRL_MONO_DEFAULT                        (_USART_I2SCTRL_MONO_DEFAULT << 10)
+
+/* Bit fields for USART IEN */
+#define _USART_IEN_RESETVALUE                             0x00000000UL
+#define _USART_IEN_MASK                                   0x000003FFUL
+#define USART_IEN_TXC                                     (0x1UL << 0)
+#define _USART_IEN_TXC_SHIFT                              0
+#define _USART_IEN_TXC_MASK                               0x1UL
+#define _USART_IEN_TXC_DEFAULT                            0x00000000UL
+#define USART_IEN_TXC_DEFAULT                             (_USART_IEN_TXC_DEFAULT << 0)
+#define USART_IEN_TXBL                                    (0x1UL << 1)
+#define _USART_IEN_TXBL_SHIFT                             1
+#define _USART_IEN_TXBL_MASK                              0x2UL
+#define _USART_IEN_TXBL_DEFAULT                           0x00000000UL
+#define USART_IEN_TXBL_DEFAULT                            (_USART_IEN_TXBL_DEFAULT << 1)
+#define USART_IEN_RXDATAV                                 (0x1UL << 2)
+#define _USART_IEN_RXDATAV_SHIFT                          2
+#define _USART_IEN_RXDATAV_MASK                           0x4UL
+#define _USART_IEN_RXDATAV_DEFAULT                        0x00000000UL
+#define USART_IEN_RXDATAV_DEFAULT                         (_USART_IEN_RXDATAV_DEFAULT << 2)
+#define USART_IEN_RXFULL                                  (0x1UL << 3)
+#define _USART_IEN_RXFULL_SHIFT                           3
+#define _USART_IEN_RXFULL_MASK                            0x8UL
+#define _USART_IEN_RXFULL_DEFAULT                         0x00000000UL
+#define USART_IEN_RXFULL_DEFAULT                          (_USART_IEN_RXFULL_DEFAULT << 3)
+#define USART_IEN_RXOF                                    (0x1UL << 4)
+#define _USART_IEN_RXOF_SHIFT                             4
+#define _USART_IEN_RXOF_MASK                              0x10UL
+#define _USART_IEN_RXOF_DEFAULT                           0x00000000UL
+#define USART_IEN_RXOF_DEFAULT                            (_USART_IEN_RXOF_DEFAULT << 4)
+#define USART_IEN_RXUF                                    (0x1UL << 5)
+#define _USART_IEN_RXUF_SHIFT                             5
+#define _USART_IEN_RXUF_MASK                              0x20UL
+#define _USART_IEN_RXUF_DEFAULT                           0x00000000UL
+#define USART_IEN_RXUF_DEFAULT                            (_USART_IEN_RXUF_DEFAULT << 5)
+#define USART_IEN_TXOF                                    (0x1UL << 6)
+#define _USART_IEN_TXOF_SHIFT                             6
+#define _USART_IEN_TXOF_MASK                              0x40UL
+#define _USART_IEN_TXOF_DEFAULT                           0x00000000UL
+#define USART_IEN_TXOF_DEFAULT                            (_USART_IEN_TXOF_DEFAULT << 6)
+#define USART_IEN_TXUF                                    (0x1UL << 7)
+#define _USART_IEN_TXUF_SHIFT                             7
+#define _USART_IEN_TXUF_MASK                              0x80UL
+#define _USART_IEN_TXUF_DEFAULT                           0x00000000UL
+#define USART_IEN_TXUF_DEFAULT                            (_USART_IEN_TXUF_DEFAULT << 7)
+#define USART_IEN_PERR                                    (0x1UL << 8)
+#define _USART_IEN_PERR_SHIFT                             8
+#define _USART_IEN_PERR_MASK                              0x100UL
+#define _USART_IEN_PERR_DEFAULT                           0x00000000UL
+#define USART_IEN_PERR_DEFAULT                            (_USART_IEN_PERR_DEFAULT << 8)
+#define USART_IEN_FERR                                    (0x1UL << 9)
+#define _USART_IEN_FERR_SHIFT                             9
+#define _USART_IEN_FERR_MASK                              0x200UL
+#define _USART_IEN_FERR_DEFAULT                           0x00000000UL
+#define USART_IEN_FERR_DEFAULT                            (_USART_IEN_FERR_DEFAULT << 9)
+
+/* Bit fields for USART IF */
+#define _USART_IF_RESETVALUE                              0x00000000UL
+#define _USART_IF_MASK                                    0x000003FFUL
+#define USART_IF_TXC                                      (0x1UL << 0)
+#define _USART_IF_TXC_SHIFT                               0
+#define _USART_IF_TXC_MASK                                0x1UL
+#define _USART_IF_TXC_DEFAULT                             0x00000000UL
+#define USART_IF_TXC_DEFAULT                              (_USART_IF_TXC_DEFAULT << 0)
+#define USART_IF_TXBL                                     (0x1UL << 1)
+#define _USART_IF_TXBL_SHIFT                              1
+#define _USART_IF_TXBL_MASK                               0x2UL
+#define _USART_IF_TXBL_DEFAULT                            0x00000000UL
+#define USART_IF_TXBL_DEFAULT                             (_USART_IF_TXBL_DEFAULT << 1)
+#define USART_IF_RXDATAV                                  (0x1UL << 2)
+#define _USART_IF_RXDATAV_SHIFT                           2
+#define _USART_IF_RXDATAV_MASK                            0x4UL
+#define _USART_IF_RXDATAV_DEFAULT                         0x00000000UL
+#define USART_IF_RXDATAV_DEFAULT                          (_USART_IF_RXDATAV_DEFAULT << 2)
+#define USART_IF_RXFULL                                   (0x1UL << 3)
+#define _USART_IF_RXFULL_SHIFT                            3
+#define _USART_IF_RXFULL_MASK                             0x8UL
+#define _USART_IF_RXFULL_DEFAULT                          0x00000000UL
+#define USART_IF_RXFULL_DEFAULT                           (_USART_IF_RXFULL_DEFAULT << 3)
+#define USART_IF_RXOF                                     (0x1UL << 4)
+#define _USART_IF_RXOF_SHIFT                              4
+#define _USART_IF_RXOF_MASK                               0x10UL
+#define _USART_IF_RXOF_DEFAULT                            0x00000000UL
+#define USART_IF_RXOF_DEFAULT                             (_USART_IF_RXOF_DEFAULT << 4)
+#define USART_IF_RXUF                                     (0x1UL << 5)
+#define _USART_IF_RXUF_SHIFT                              5
+#define _USART_IF_RXUF_MASK                               0x20UL
+#define _USART_IF_RXUF_DEFAULT                            0x00000000UL
+#define USART_IF_RXUF_DEFAULT                             (_USART_IF_RXUF_DEFAULT << 5)
+#define USART_IF_TXOF                                     (0x1UL << 6)
+#define _USART_IF_TXOF_SHIFT                              6
+#define _USART_IF_TXOF_MASK                               0x40UL
+#define _USART_IF_TXOF_DEFAULT                            0x00000000UL
+#define USART_IF_TXOF_DEFAULT                             (_USART_IF_TXOF_DEFAULT << 6)
+#define USART_IF_TXUF                                     (0x1UL << 7)
+#define _USART_IF_TXUF_SHIFT                              7
+#define _USART_IF_TXUF_MASK                               0x80UL
+#define _USART_IF_TXUF_DEFAULT                            0x00000000UL
+#define USART_IF_TXUF_DEFAULT                             (_USART_IF_TXUF_DEFAULT << 7)
+#define USART_IF_PERR                                     (0x1UL << 8)
+#define _USART_IF_PERR_SHIFT                              8
+#define _USART_IF_PERR_MASK                               0x100UL
+#define _USART_IF_PERR_DEFAULT                            0x00000000UL
+#define USART_IF_PERR_DEFAULT                             (_USART_IF_PERR_DEFAULT << 8)
+#define USART_IF_FERR                                     (0x1UL << 9)
+#define _USART_IF_FERR_SHIFT                              9
+#define _USART_IF_FERR_MASK                               0x200UL
+#define _USART_IF_FERR_DEFAULT                            0x00000000UL
+#define USART_IF_FERR_DEFAULT                             (_USART_IF_FERR_DEFAULT << 9)
+
+/* Bit fields for USART IFC */
+#define _USART_IFC_RESETVALUE                             0x00000000UL
+#define _USART_IFC_MASK                                   0x00000000UL
+
+/* Bit fields for USART IFS */
+#define _USART_IFS_RESETVALUE                             0x00000000UL
+#define _USART_IFS_MASK                                   0x00000000UL
+
+/* Bit fields for USART IRCTRL */
+#define _USART_IRCTRL_RESETVALUE                          0x00000000UL
+#define _USART_IRCTRL_MASK                                0x0000001FUL
+#define USART_IRCTRL_IREN                                 (0x1UL << 0)
+#define _USART_IRCTRL_IREN_SHIFT                          0
+#define _USART_IRCTRL_IREN_MASK                           0x1UL
+#define _USART_IRCTRL_IREN_DEFAULT                        0x00000000UL
+#define USART_IRCTRL_IREN_DEFAULT                         (_USART_IRCTRL_IREN_DEFAULT << 0)
+#define USART_IRCTRL_IRFILT                               (0x1UL << 1)
+#define _USART_IRCTRL_IRFILT_SHIFT                        1
+#define _USART_IRCTRL_IRFILT_MASK                         0x2UL
+#define _USART_IRCTRL_IRFILT_DEFAULT                      0x00000000UL
+#define USART_IRCTRL_IRFILT_DEFAULT                       (_USART_IRCTRL_IRFILT_DEFAULT << 1)
+#define USART_IRCTRL_IRPRSEN                              (0x1UL << 2)
+#define _USART_IRCTRL_IRPRSEN_SHIFT                       2
+#define _USART_IRCTRL_IRPRSEN_MASK                        0x4UL
+#define _USART_IRCTRL_IRPRSEN_DEFAULT                     0x00000000UL
+#define USART_IRCTRL_IRPRSEN_DEFAULT                      (_USART_IRCTRL_IRPRSEN_DEFAULT << 2)
+#define _USART_IRCTRL_IRPW_SHIFT                          3
+#define _USART_IRCTRL_IRPW_MASK                           0x18UL
+#define _USART_IRCTRL_IRPW_DEFAULT                        0x00000000UL
+#define USART_IRCTRL_IRPW_DEFAULT                         (_USART_IRCTRL_IRPW_DEFAULT << 3)
+#define _USART_IRCTRL_IRPW_ONE                            0x00000000UL
+#define _USART_IRCTRL_IRPW_FOUR                           0x00000001UL
+#define _USART_IRCTRL_IRPW_THREE                          0x00000002UL
+#define _USART_IRCTRL_IRPW_TWO                            0x00000003UL
+#define USART_IRCTRL_IRPW_ONE                             (_USART_IRCTRL_IRPW_ONE << 3)
+#define USART_IRCTRL_IRPW_FOUR                            (_USART_IRCTRL_IRPW_FOUR << 3)
+#define USART_IRCTRL_IRPW_THREE                           (_USART_IRCTRL_IRPW_THREE << 3)
+#define USART_IRCTRL_IRPW_TWO                             (_USART_IRCTRL_IRPW_TWO << 3)
+
+/* Bit fields for USART RXDATA */
+#define _USART_RXDATA_RESETVALUE                          0x00000000UL
+#define _USART_RXDATA_MASK                                0x00000000UL
+
+/* Bit fields for USART RXDATAX */
+#define _USART_RXDATAX_RESETVALUE                         0x00000000UL
+#define _USART_RXDATAX_MASK                               0x00000000UL
+
+/* Bit fields for USART RXDOUBLE */
+#define _USART_RXDOUBLE_RESETVALUE                        0x00000000UL
+#define _USART_RXDOUBLE_MASK                              0x0000FFFFUL
+#define _USART_RXDOUBLE_RXDATA0_SHIFT                     0
+#define _USART_RXDOUBLE_RXDATA0_MASK                      0xFFUL
+#define _USART_RXDOUBLE_RXDATA0_DEFAULT                   0x00000000UL
+#define USART_RXDOUBLE_RXDATA0_DEFAULT                    (_USART_RXDOUBLE_RXDATA0_DEFAULT << 0)
+#define _USART_RXDOUBLE_RXDATA1_SHIFT                     8
+#define _USART_RXDOUBLE_RXDATA1_MASK                      0xFF00UL
+#define _USART_RXDOUBLE_RXDATA1_DEFAULT                   0x00000000UL
+#define USART_RXDOUBLE_RXDATA1_DEFAULT                    (_USART_RXDOUBLE_RXDATA1_DEFAULT << 8)
+
+/* Bit fields for USART RXDOUBLEX */
+#define _USART_RXDOUBLEX_RESETVALUE                       0x00000000UL
+#define _USART_RXDOUBLEX_MASK                             0x00000000UL
+
+/* Bit fields for USART STATUS */
+#define _USART_STATUS_RESETVALUE                          0x00000000UL
+#define _USART_STATUS_MASK                                0x000021FFUL
+#define USART_STATUS_RXENS                                (0x1UL << 0)
+#define _USART_STATUS_RXENS_SHIFT                         0
+#define _USART_STATUS_RXENS_MASK                          0x1UL
+#define _USART_STATUS_RXENS_DEFAULT                       0x00000000UL
+#define USART_STATUS_RXENS_DEFAULT                        (_USART_STATUS_RXENS_DEFAULT << 0)
+#define USART_STATUS_TXENS                                (0x1UL << 1)
+#define _USART_STATUS_TXENS_SHIFT                         1
+#define _USART_STATUS_TXENS_MASK                          0x2UL
+#define _USART_STATUS_TXENS_DEFAULT                       0x00000000UL
+#define USART_STATUS_TXENS_DEFAULT                        (_USART_STATUS_TXENS_DEFAULT << 1)
+#define USART_STATUS_MASTER                               (0x1UL << 2)
+#define _USART_STATUS_MASTER_SHIFT                        2
+#define _USART_STATUS_MASTER_MASK                         0x4UL
+#define _USART_STATUS_MASTER_DEFAULT                      0x00000000UL
+#define USART_STATUS_MASTER_DEFAULT                       (_USART_STATUS_MASTER_DEFAULT << 2)
+#define USART_STATUS_RXBLOCK                              (0x1UL << 3)
+#define _USART_STATUS_RXBLOCK_SHIFT                       3
+#define _USART_STATUS_RXBLOCK_MASK                        0x8UL
+#define _USART_STATUS_RXBLOCK_DEFAULT                     0x00000000UL
+#define USART_STATUS_RXBLOCK_DEFAULT                      (_USART_STATUS_RXBLOCK_DEFAULT << 3)
+#define USART_STATUS_TXTRI                                (0x1UL << 4)
+#define _USART_STATUS_TXTRI_SHIFT                         4
+#define _USART_STATUS_TXTRI_MASK                          0x10UL
+#define _USART_STATUS_TXTRI_DEFAULT                       0x00000000UL
+#define USART_STATUS_TXTRI_DEFAULT                        (_USART_STATUS_TXTRI_DEFAULT << 4)
+#define USART_STATUS_TXC                                  (0x1UL << 5)
+#define _USART_STATUS_TXC_SHIFT                           5
+#define _USART_STATUS_TXC_MASK                            0x20UL
+#define _USART_STATUS_TXC_DEFAULT                         0x00000000UL
+#define USART_STATUS_TXC_DEFAULT                          (_USART_STATUS_TXC_DEFAULT << 5)
+#define USART_STATUS_TXBL                                 (0x1UL << 6)
+#define _USART_STATUS_TXBL_SHIFT                          6
+#define _USART_STATUS_TXBL_MASK                           0x40UL
+#define _USART_STATUS_TXBL_DEFAULT                        0x00000000UL
+#define USART_STATUS_TXBL_DEFAULT                         (_USART_STATUS_TXBL_DEFAULT << 6)
+#define USART_STATUS_RXDATAV                              (0x1UL << 7)
+#define _USART_STATUS_RXDATAV_SHIFT                       7
+#define _USART_STATUS_RXDATAV_MASK                        0x80UL
+#define _USART_STATUS_RXDATAV_DEFAULT                     0x00000000UL
+#define USART_STATUS_RXDATAV_DEFAULT                      (_USART_STATUS_RXDATAV_DEFAULT << 7)
+#define USART_STATUS_RXFULL                               (0x1UL << 8)
+#define _USART_STATUS_RXFULL_SHIFT                        8
+#define _USART_STATUS_RXFULL_MASK                         0x100UL
+#define _USART_STATUS_RXFULL_DEFAULT                      0x00000000UL
+#define USART_STATUS_RXFULL_DEFAULT                       (_USART_STATUS_RXFULL_DEFAULT << 8)
+#define USART_STATUS_TXIDLE                               (0x1UL << 13)
+#define _USART_STATUS_TXIDLE_SHIFT                        13
+#define _USART_STATUS_TXIDLE_MASK                         0x2000UL
+#define _USART_STATUS_TXIDLE_DEFAULT                      0x00000000UL
+#define USART_STATUS_TXIDLE_DEFAULT                       (_USART_STATUS_TXIDLE_DEFAULT << 13)
+
+/* Bit fields for USART TIMING */
+#define _USART_TIMING_RESETVALUE                          0x00000000UL
+#define _USART_TIMING_MASK                                0x0000FFFFUL
+#define _USART_TIMING_CSHOLD_SHIFT                        0
+#define _USART_TIMING_CSHOLD_MASK                         0xFFUL
+#define _USART_TIMING_CSHOLD_DEFAULT                      0x00000000UL
+#define USART_TIMING_CSHOLD_DEFAULT                       (_USART_TIMING_CSHOLD_DEFAULT << 0)
+#define _USART_TIMING_CSSETUP_SHIFT                       8
+#define _USART_TIMING_CSSETUP_MASK                        0xFF00UL
+#define _USART_TIMING_CSSETUP_DEFAULT                     0x00000000UL
+#define USART_TIMING_CSSETUP_DEFAULT                      (_USART_TIMING_CSSETUP_DEFAULT << 8)
+
+/* Bit fields for USART TRIGCTRL */
+#define _USART_TRIGCTRL_RESETVALUE                        0x00000000UL
+#define _USART_TRIGCTRL_MASK                              0x00000007UL
+#define USART_TRIGCTRL_AUTOTXTEN                          (0x1UL << 0)
+#define _USART_TRIGCTRL_AUTOTXTEN_SHIFT                   0
+#define _USART_TRIGCTRL_AUTOTXTEN_MASK                    0x1UL
+#define _USART_TRIGCTRL_AUTOTXTEN_DEFAULT                 0x00000000UL
+#define USART_TRIGCTRL_AUTOTXTEN_DEFAULT                  (_USART_TRIGCTRL_AUTOTXTEN_DEFAULT << 0)
+#define USART_TRIGCTRL_RXTEN                              (0x1UL << 1)
+#define _USART_TRIGCTRL_RXTEN_SHIFT                       1
+#define _USART_TRIGCTRL_RXTEN_MASK                        0x2UL
+#define _USART_TRIGCTRL_RXTEN_DEFAULT                     0x00000000UL
+#define USART_TRIGCTRL_RXTEN_DEFAULT                      (_USART_TRIGCTRL_RXTEN_DEFAULT << 1)
+#define USART_TRIGCTRL_TXTEN                              (0x1UL << 2)
+#define _USART_TRIGCTRL_TXTEN_SHIFT                       2
+#define _USART_TRIGCTRL_TXTEN_MASK                        0x4UL
+#define _USART_TRIGCTRL_TXTEN_DEFAULT                     0x00000000UL
+#define USART_TRIGCTRL_TXTEN_DEFAULT                      (_USART_TRIGCTRL_TXTEN_DEFAULT << 2)
+
+/* Bit fields for USART TXDATA */
+#define _USART_TXDATA_RESETVALUE                          0x00000000UL
+#define _USART_TXDATA_MASK                                0x00000000UL
+
+/* Bit fields for USART TXDATAX */
+#define _USART_TXDATAX_RESETVALUE                         0x00000000UL
+#define _USART_TXDATAX_MASK                               0x00000000UL
+
+/* Bit fields for USART TXDOUBLE */
+#define _USART_TXDOUBLE_RESETVALUE                        0x00000000UL
+#define _USART_TXDOUBLE_MASK                              0x0000FFFFUL
+#define _USART_TXDOUBLE_TXDATA0_SHIFT                     0
+#define _USART_TXDOUBLE_TXDATA0_MASK                      0xFFUL
+#define _USART_TXDOUBLE_TXDATA0_DEFAULT                   0x00000000UL
+#define USART_TXDOUBLE_TXDATA0_DEFAULT                    (_USART_TXDOUBLE_TXDATA0_DEFAULT << 0)
+#define _USART_TXDOUBLE_TXDATA1_SHIFT                     8
+#define _USART_TXDOUBLE_TXDATA1_MASK                      0xFF00UL
+#define _USART_TXDOUBLE_TXDATA1_DEFAULT                   0x00000000UL
+#define USART_TXDOUBLE_TXDATA1_DEFAULT                    (_USART_TXDOUBLE_TXDATA1_DEFAULT << 8)
+
+/* Bit fields for USART TXDOUBLEX */
+#define _USART_TXDOUBLEX_RESETVALUE                       0x00000000UL
+#define _USART_TXDOUBLEX_MASK                             0x00000000UL
+
+/******************************************************************************
+ * EUSART
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t CFG0;
+  __IOM uint32_t CFG1;
+  __IOM uint32_t CLKDIV;
+  __IOM uint32_t CMD;
+  __IOM uint32_t EN;
+  __IOM uint32_t FRAMECFG;
+  __IOM uint32_t IEN;
+  __IOM uint32_t IF;
+  __IOM uint32_t IRHFCFG;
+  __IOM uint32_t IRLFCFG;
+  __IOM uint32_t RXDATA;
+  __IOM uint32_t SIGFRAMECFG;
+  __IOM uint32_t STARTFRAMECFG;
+  __IOM uint32_t STATUS;
+  __IOM uint32_t SYNCBUSY;
+  __IOM uint32_t TIMINGCFG;
+  __IOM uint32_t TRIGCTRL;
+  __IOM uint32_t TXDATA;
+  uint32_t RESERVED0[1006];
+  __IOM uint32_t CFG0_SET;
+  __IOM uint32_t CFG1_SET;
+  __IOM uint32_t CLKDIV_SET;
+  __IOM uint32_t CMD_SET;
+  __IOM uint32_t EN_SET;
+  __IOM uint32_t FRAMECFG_SET;
+  __IOM uint32_t IEN_SET;
+  __IOM uint32_t IF_SET;
+  __IOM uint32_t IRHFCFG_SET;
+  __IOM uint32_t IRLFCFG_SET;
+  __IOM uint32_t RXDATA_SET;
+  __IOM uint32_t SIGFRAMECFG_SET;
+  __IOM uint32_t STARTFRAMECFG_SET;
+  __IOM uint32_t STATUS_SET;
+  __IOM uint32_t SYNCBUSY_SET;
+  __IOM uint32_t TIMINGCFG_SET;
+  __IOM uint32_t TRIGCTRL_SET;
+  __IOM uint32_t TXDATA_SET;
+  uint32_t RESERVED1[1006];
+  __IOM uint32_t CFG0_CLR;
+  __IOM uint32_t CFG1_CLR;
+  __IOM uint32_t CLKDIV_CLR;
+  __IOM uint32_t CMD_CLR;
+  __IOM uint32_t EN_CLR;
+  __IOM uint32_t FRAMECFG_CLR;
+  __IOM uint32_t IEN_CLR;
+  __IOM uint32_t IF_CLR;
+  __IOM uint32_t IRHFCFG_CLR;
+  __IOM uint32_t IRLFCFG_CLR;
+  __IOM uint32_t RXDATA_CLR;
+  __IOM uint32_t SIGFRAMECFG_CLR;
+  __IOM uint32_t STARTFRAMECFG_CLR;
+  __IOM uint32_t STATUS_CLR;
+  __IOM uint32_t SYNCBUSY_CLR;
+  __IOM uint32_t TIMINGCFG_CLR;
+  __IOM uint32_t TRIGCTRL_CLR;
+  __IOM uint32_t TXDATA_CLR;
+  uint32_t RESERVED2[1006];
+  __IOM uint32_t CFG0_TGL;
+  __IOM uint32_t CFG1_TGL;
+  __IOM uint32_t CLKDIV_TGL;
+  __IOM uint32_t CMD_TGL;
+  __IOM uint32_t EN_TGL;
+  __IOM uint32_t FRAMECFG_TGL;
+  __IOM uint32_t IEN_TGL;
+  __IOM uint32_t IF_TGL;
+  __IOM uint32_t IRHFCFG_TGL;
+  __IOM uint32_t IRLFCFG_TGL;
+  __IOM uint32_t RXDATA_TGL;
+  __IOM uint32_t SIGFRAMECFG_TGL;
+  __IOM uint32_t STARTFRAMECFG_TGL;
+  __IOM uint32_t STATUS_TGL;
+  __IOM uint32_t SYNCBUSY_TGL;
+  __IOM uint32_t TIMINGCFG_TGL;
+  __IOM uint32_t TRIGCTRL_TGL;
+  __IOM uint32_t TXDATA_TGL;
+  uint32_t RESERVED3[1006];
+} EUSART_TypeDef;
+
+/* Bit fields for EUSART CFG0 */
+#define _EUSART_CFG0_RESETVALUE                           0x00000000UL
+#define _EUSART_CFG0_MASK                                 0x00003FFFUL
+#define EUSART_CFG0_AUTOBAUDEN                            (0x1UL << 0)
+#define _EUSART_CFG0_AUTOBAUDEN_SHIFT                     0
+#define _EUSART_CFG0_AUTOBAUDEN_MASK                      0x1UL
+#define _EUSART_CFG0_AUTOBAUDEN_DEFAULT                   0x00000000UL
+#define EUSART_CFG0_AUTOBAUDEN_DEFAULT                    (_EUSART_CFG0_AUTOBAUDEN_DEFAULT << 0)
+#define EUSART_CFG0_AUTOTRI                               (0x1UL << 1)
+#define _EUSART_CFG0_AUTOTRI_SHIFT                        1
+#define _EUSART_CFG0_AUTOTRI_MASK                         0x2UL
+#define _EUSART_CFG0_AUTOTRI_DEFAULT                      0x00000000UL
+#define EUSART_CFG0_AUTOTRI_DEFAULT                       (_EUSART_CFG0_AUTOTRI_DEFAULT << 1)
+#define EUSART_CFG0_CCEN                                  (0x1UL << 2)
+#define _EUSART_CFG0_CCEN_SHIFT                           2
+#define _EUSART_CFG0_CCEN_MASK                            0x4UL
+#define _EUSART_CFG0_CCEN_DEFAULT                         0x00000000UL
+#define EUSART_CFG0_CCEN_DEFAULT                          (_EUSART_CFG0_CCEN_DEFAULT << 2)
+#define EUSART_CFG0_ERRSDMA                               (0x1UL << 3)
+#define _EUSART_CFG0_ERRSDMA_SHIFT                        3
+#define _EUSART_CFG0_ERRSDMA_MASK                         0x8UL
+#define _EUSART_CFG0_ERRSDMA_DEFAULT                      0x00000000UL
+#define EUSART_CFG0_ERRSDMA_DEFAULT                       (_EUSART_CFG0_ERRSDMA_DEFAULT << 3)
+#define EUSART_CFG0_LOOPBK                                (0x1UL << 4)
+#define _EUSART_CFG0_LOOPBK_SHIFT                         4
+#define _EUSART_CFG0_LOOPBK_MASK                          0x10UL
+#define _EUSART_CFG0_LOOPBK_DEFAULT                       0x00000000UL
+#define EUSART_CFG0_LOOPBK_DEFAULT                        (_EUSART_CFG0_LOOPBK_DEFAULT << 4)
+#define _EUSART_CFG0_OVS_SHIFT                            5
+#define _EUSART_CFG0_OVS_MASK                             0xE0UL
+#define _EUSART_CFG0_OVS_DEFAULT                          0x00000000UL
+#define EUSART_CFG0_OVS_DEFAULT                           (_EUSART_CFG0_OVS_DEFAULT << 5)
+#define _EUSART_CFG0_OVS_X16                              0x00000000UL
+#define _EUSART_CFG0_OVS_X8                               0x00000001UL
+#define _EUSART_CFG0_OVS_X6                               0x00000002UL
+#define _EUSART_CFG0_OVS_X4                               0x00000003UL
+#define _EUSART_CFG0_OVS_DISABLE                          0x00000004UL
+#define EUSART_CFG0_OVS_X16                               (_EUSART_CFG0_OVS_X16 << 5)
+#define EUSART_CFG0_OVS_X8                                (_EUSART_CFG0_OVS_X8 << 5)
+#define EUSART_CFG0_OVS_X6                                (_EUSART_CFG0_OVS_X6 << 5)
+#define EUSART_CFG0_OVS_X4                                (_EUSART_CFG0_OVS_X4 << 5)
+#define EUSART_CFG0_OVS_DISABLE                           (_EUSART_CFG0_OVS_DISABLE << 5)
+#define EUSART_CFG0_MPAB                                  (0x1UL << 8)
+#define _EUSART_CFG0_MPAB_SHIFT                           8
+#define _EUSART_CFG0_MPAB_MASK                            0x100UL
+#define _EUSART_CFG0_MPAB_DEFAULT                         0x00000000UL
+#define EUSART_CFG0_MPAB_DEFAULT                          (_EUSART_CFG0_MPAB_DEFAULT << 8)
+#define EUSART_CFG0_MPM                                   (0x1UL << 9)
+#define _EUSART_CFG0_MPM_SHIFT                            9
+#define _EUSART_CFG0_MPM_MASK                             0x200UL
+#define _EUSART_CFG0_MPM_DEFAULT                          0x00000000UL
+#define EUSART_CFG0_MPM_DEFAULT                           (_EUSART_CFG0_MPM_DEFAULT << 9)
+#define EUSART_CFG0_MSBF                                  (0x1UL << 10)
+#define _EUSART_CFG0_MSBF_SHIFT                           10
+#define _EUSART_CFG0_MSBF_MASK                            0x400UL
+#define _EUSART_CFG0_MSBF_DEFAULT                         0x00000000UL
+#define EUSART_CFG0_MSBF_DEFAULT                          (_EUSART_CFG0_MSBF_DEFAULT << 10)
+#define EUSART_CFG0_MVDIS                                 (0x1UL << 11)
+#define _EUSART_CFG0_MVDIS_SHIFT                          11
+#define _EUSART_CFG0_MVDIS_MASK                           0x800UL
+#define _EUSART_CFG0_MVDIS_DEFAULT                        0x00000000UL
+#define EUSART_CFG0_MVDIS_DEFAULT                         (_EUSART_CFG0_MVDIS_DEFAULT << 11)
+#define EUSART_CFG0_RXINV                                 (0x1UL << 12)
+#define _EUSART_CFG0_RXINV_SHIFT                          12
+#define _EUSART_CFG0_RXINV_MASK                           0x1000UL
+#define _EUSART_CFG0_RXINV_DEFAULT                        0x00000000UL
+#define EUSART_CFG0_RXINV_DEFAULT                         (_EUSART_CFG0_RXINV_DEFAULT << 12)
+#define _EUSART_CFG0_RXINV_DISABLE                        0x00000000UL
+#define _EUSART_CFG0_RXINV_ENABLE                         0x00000001UL
+#define EUSART_CFG0_RXINV_DISABLE                         (_EUSART_CFG0_RXINV_DISABLE << 12)
+#define EUSART_CFG0_RXINV_ENABLE                          (_EUSART_CFG0_RXINV_ENABLE << 12)
+#define EUSART_CFG0_TXINV                                 (0x1UL << 13)
+#define _EUSART_CFG0_TXINV_SHIFT                          13
+#define _EUSART_CFG0_TXINV_MASK                           0x2000UL
+#define _EUSART_CFG0_TXINV_DEFAULT                        0x00000000UL
+#define EUSART_CFG0_TXINV_DEFAULT                         (_EUSART_CFG0_TXINV_DEFAULT << 13)
+#define _EUSART_CFG0_TXINV_DISABLE                        0x00000000UL
+#define _EUSART_CFG0_TXINV_ENABLE                         0x00000001UL
+#define EUSART_CFG0_TXINV_DISABLE                         (_EUSART_CFG0_TXINV_DISABLE << 13)
+#define EUSART_CFG0_TXINV_ENABLE                          (_EUSART_CFG0_TXINV_ENABLE << 13)
+
+/* Bit fields for EUSART CFG1 */
+#define _EUSART_CFG1_RESETVALUE                           0x00000000UL
+#define _EUSART_CFG1_MASK                                 0x0000001FUL
+#define EUSART_CFG1_CTSEN                                 (0x1UL << 0)
+#define _EUSART_CFG1_CTSEN_SHIFT                          0
+#define _EUSART_CFG1_CTSEN_MASK                           0x1UL
+#define _EUSART_CFG1_CTSEN_DEFAULT                        0x00000000UL
+#define EUSART_CFG1_CTSEN_DEFAULT                         (_EUSART_CFG1_CTSEN_DEFAULT << 0)
+#define EUSART_CFG1_RXDMAWU                               (0x1UL << 1)
+#define _EUSART_CFG1_RXDMAWU_SHIFT                        1
+#define _EUSART_CFG1_RXDMAWU_MASK                         0x2UL
+#define _EUSART_CFG1_RXDMAWU_DEFAULT                      0x00000000UL
+#define EUSART_CFG1_RXDMAWU_DEFAULT                       (_EUSART_CFG1_RXDMAWU_DEFAULT << 1)
+#define EUSART_CFG1_RXPRSEN                               (0x1UL << 2)
+#define _EUSART_CFG1_RXPRSEN_SHIFT                        2
+#define _EUSART_CFG1_RXPRSEN_MASK                         0x4UL
+#define _EUSART_CFG1_RXPRSEN_DEFAULT                      0x00000000UL
+#define EUSART_CFG1_RXPRSEN_DEFAULT                       (_EUSART_CFG1_RXPRSEN_DEFAULT << 2)
+#define EUSART_CFG1_SFUBRX                                (0x1UL << 3)
+#define _EUSART_CFG1_SFUBRX_SHIFT                         3
+#define _EUSART_CFG1_SFUBRX_MASK                          0x8UL
+#define _EUSART_CFG1_SFUBRX_DEFAULT                       0x00000000UL
+#define EUSART_CFG1_SFUBRX_DEFAULT                        (_EUSART_CFG1_SFUBRX_DEFAULT << 3)
+#define EUSART_CFG1_TXDMAWU                               (0x1UL << 4)
+#define _EUSART_CFG1_TXDMAWU_SHIFT                        4
+#define _EUSART_CFG1_TXDMAWU_MASK                         0x10UL
+#define _EUSART_CFG1_TXDMAWU_DEFAULT                      0x00000000UL
+#define EUSART_CFG1_TXDMAWU_DEFAULT                       (_EUSART_CFG1_TXDMAWU_DEFAULT << 4)
+
+/* Bit fields for EUSART CLKDIV */
+#define _EUSART_CLKDIV_RESETVALUE                         0x00000000UL
+#define _EUSART_CLKDIV_MASK                               0x007FFFF8UL
+#define _EUSART_CLKDIV_DIV_SHIFT                          3
+#define _EUSART_CLKDIV_DIV_MASK                           0x7FFFF8UL
+#define _EUSART_CLKDIV_DIV_DEFAULT                        0x00000000UL
+#define EUSART_CLKDIV_DIV_DEFAULT                         (_EUSART_CLKDIV_DIV_DEFAULT << 3)
+
+/* Bit fields for EUSART CMD */
+#define _EUSART_CMD_RESETVALUE                            0x00000000UL
+#define _EUSART_CMD_MASK                                  0x000001FFUL
+#define EUSART_CMD_CLEARTX                                (0x1UL << 0)
+#define _EUSART_CMD_CLEARTX_SHIFT                         0
+#define _EUSART_CMD_CLEARTX_MASK                          0x1UL
+#define _EUSART_CMD_CLEARTX_DEFAULT                       0x00000000UL
+#define EUSART_CMD_CLEARTX_DEFAULT                        (_EUSART_CMD_CLEARTX_DEFAULT << 0)
+#define EUSART_CMD_RXBLOCKDIS                             (0x1UL << 1)
+#define _EUSART_CMD_RXBLOCKDIS_SHIFT                      1
+#define _EUSART_CMD_RXBLOCKDIS_MASK                       0x2UL
+#define _EUSART_CMD_RXBLOCKDIS_DEFAULT                    0x00000000UL
+#define EUSART_CMD_RXBLOCKDIS_DEFAULT                     (_EUSART_CMD_RXBLOCKDIS_DEFAULT << 1)
+#define EUSART_CMD_RXBLOCKEN                              (0x1UL << 2)
+#define _EUSART_CMD_RXBLOCKEN_SHIFT                       2
+#define _EUSART_CMD_RXBLOCKEN_MASK                        0x4UL
+#define _EUSART_CMD_RXBLOCKEN_DEFAULT                     0x00000000UL
+#define EUSART_CMD_RXBLOCKEN_DEFAULT                      (_EUSART_CMD_RXBLOCKEN_DEFAULT << 2)
+#define EUSART_CMD_RXDIS                                  (0x1UL << 3)
+#define _EUSART_CMD_RXDIS_SHIFT                           3
+#define _EUSART_CMD_RXDIS_MASK                            0x8UL
+#define _EUSART_CMD_RXDIS_DEFAULT                         0x00000000UL
+#define EUSART_CMD_RXDIS_DEFAULT                          (_EUSART_CMD_RXDIS_DEFAULT << 3)
+#define EUSART_CMD_RXEN                                   (0x1UL << 4)
+#define _EUSART_CMD_RXEN_SHIFT                            4
+#define _EUSART_CMD_RXEN_MASK                             0x10UL
+#define _EUSART_CMD_RXEN_DEFAULT                          0x00000000UL
+#define EUSART_CMD_RXEN_DEFAULT                           (_EUSART_CMD_RXEN_DEFAULT << 4)
+#define EUSART_CMD_TXDIS                                  (0x1UL << 5)
+#define _EUSART_CMD_TXDIS_SHIFT                           5
+#define _EUSART_CMD_TXDIS_MASK                            0x20UL
+#define _EUSART_CMD_TXDIS_DEFAULT                         0x00000000UL
+#define EUSART_CMD_TXDIS_DEFAULT                          (_EUSART_CMD_TXDIS_DEFAULT << 5)
+#define EUSART_CMD_TXEN                                   (0x1UL << 6)
+#define _EUSART_CMD_TXEN_SHIFT                            6
+#define _EUSART_CMD_TXEN_MASK                             0x40UL
+#define _EUSART_CMD_TXEN_DEFAULT                          0x00000000UL
+#define EUSART_CMD_TXEN_DEFAULT                           (_EUSART_CMD_TXEN_DEFAULT << 6)
+#define EUSART_CMD_TXTRIDIS                               (0x1UL << 7)
+#define _EUSART_CMD_TXTRIDIS_SHIFT                        7
+#define _EUSART_CMD_TXTRIDIS_MASK                         0x80UL
+#define _EUSART_CMD_TXTRIDIS_DEFAULT                      0x00000000UL
+#define EUSART_CMD_TXTRIDIS_DEFAULT                       (_EUSART_CMD_TXTRIDIS_DEFAULT << 7)
+#define EUSART_CMD_TXTRIEN                                (0x1UL << 8)
+#define _EUSART_CMD_TXTRIEN_SHIFT                         8
+#define _EUSART_CMD_TXTRIEN_MASK                          0x100UL
+#define _EUSART_CMD_TXTRIEN_DEFAULT                       0x00000000UL
+#define EUSART_CMD_TXTRIEN_DEFAULT                        (_EUSART_CMD_TXTRIEN_DEFAULT << 8)
+
+/* Bit fields for EUSART EN */
+#define _EUSART_EN_RESETVALUE                             0x00000000UL
+#define _EUSART_EN_MASK                                   0x00000001UL
+#define EUSART_EN_EN                                      (0x1UL << 0)
+#define _EUSART_EN_EN_SHIFT                               0
+#define _EUSART_EN_EN_MASK                                0x1UL
+#define _EUSART_EN_EN_DEFAULT                             0x00000000UL
+#define EUSART_EN_EN_DEFAULT                              (_EUSART_EN_EN_DEFAULT << 0)
+
+/* Bit fields for EUSART FRAMECFG */
+#define _EUSART_FRAMECFG_RESETVALUE                       0x00001002UL
+#define _EUSART_FRAMECFG_MASK                             0x0000330FUL
+#define _EUSART_FRAMECFG_DATABITS_SHIFT                   0
+#define _EUSART_FRAMECFG_DATABITS_MASK                    0xFUL
+#define _EUSART_FRAMECFG_DATABITS_DEFAULT                 0x00000002UL
+#define EUSART_FRAMECFG_DATABITS_DEFAULT                  (_EUSART_FRAMECFG_DATABITS_DEFAULT << 0)
+#define _EUSART_FRAMECFG_DATABITS_SEVEN                   0x00000001UL
+#define _EUSART_FRAMECFG_DATABITS_EIGHT                   0x00000002UL
+#define _EUSART_FRAMECFG_DATABITS_NINE                    0x00000003UL
+#define EUSART_FRAMECFG_DATABITS_SEVEN                    (_EUSART_FRAMECFG_DATABITS_SEVEN << 0)
+#define EUSART_FRAMECFG_DATABITS_EIGHT                    (_EUSART_FRAMECFG_DATABITS_EIGHT << 0)
+#define EUSART_FRAMECFG_DATABITS_NINE                     (_EUSART_FRAMECFG_DATABITS_NINE << 0)
+#define _EUSART_FRAMECFG_PARITY_SHIFT                     8
+#define _EUSART_FRAMECFG_PARITY_MASK                      0x300UL
+#define _EUSART_FRAMECFG_PARITY_DEFAULT                   0x00000000UL
+#define EUSART_FRAMECFG_PARITY_DEFAULT                    (_EUSART_FRAMECFG_PARITY_DEFAULT << 8)
+#define _EUSART_FRAMECFG_PARITY_NONE                      0x00000000UL
+#define _EUSART_FRAMECFG_PARITY_EVEN                      0x00000002UL
+#define _EUSART_FRAMECFG_PARITY_ODD                       0x00000003UL
+#define EUSART_FRAMECFG_PARITY_NONE                       (_EUSART_FRAMECFG_PARITY_NONE << 8)
+#define EUSART_FRAMECFG_PARITY_EVEN                       (_EUSART_FRAMECFG_PARITY_EVEN << 8)
+#define EUSART_FRAMECFG_PARITY_ODD                        (_EUSART_FRAMECFG_PARITY_ODD << 8)
+#define _EUSART_FRAMECFG_STOPBITS_SHIFT                   12
+#define _EUSART_FRAMECFG_STOPBITS_MASK                    0x3000UL
+#define _EUSART_FRAMECFG_STOPBITS_DEFAULT                 0x00000001UL
+#define EUSART_FRAMECFG_STOPBITS_DEFAULT                  (_EUSART_FRAMECFG_STOPBITS_DEFAULT << 12)
+#define _EUSART_FRAMECFG_STOPBITS_HALF                    0x00000000UL
+#define _EUSART_FRAMECFG_STOPBITS_ONE                     0x00000001UL
+#define _EUSART_FRAMECFG_STOPBITS_ONEANDAHALF             0x00000002UL
+#define _EUSART_FRAMECFG_STOPBITS_TWO                     0x00000003UL
+#define EUSART_FRAMECFG_STOPBITS_HALF                     (_EUSART_FRAMECFG_STOPBITS_HALF << 12)
+#define EUSART_FRAMECFG_STOPBITS_ONE                      (_EUSART_FRAMECFG_STOPBITS_ONE << 12)
+#define EUSART_FRAMECFG_STOPBITS_ONEANDAHALF              (_EUSART_FRAMECFG_STOPBITS_ONEANDAHALF << 12)
+#define EUSART_FRAMECFG_STOPBITS_TWO                      (_EUSART_FRAMECFG_STOPBITS_TWO << 12)
+
+/* Bit fields for EUSART IEN */
+#define _EUSART_IEN_RESETVALUE                            0x00000000UL
+#define _EUSART_IEN_MASK                                  0x0000037FUL
+#define EUSART_IEN_TXC                                    (0x1UL << 0)
+#define _EUSART_IEN_TXC_SHIFT                             0
+#define _EUSART_IEN_TXC_MASK                              0x1UL
+#define _EUSART_IEN_TXC_DEFAULT                           0x00000000UL
+#define EUSART_IEN_TXC_DEFAULT                            (_EUSART_IEN_TXC_DEFAULT << 0)
+#define EUSART_IEN_TXFL                                   (0x1UL << 1)
+#define _EUSART_IEN_TXFL_SHIFT                            1
+#define _EUSART_IEN_TXFL_MASK                             0x2UL
+#define _EUSART_IEN_TXFL_DEFAULT                          0x00000000UL
+#define EUSART_IEN_TXFL_DEFAULT                           (_EUSART_IEN_TXFL_DEFAULT << 1)
+#define EUSART_IEN_RXFL                                   (0x1UL << 2)
+#define _EUSART_IEN_RXFL_SHIFT                            2
+#define _EUSART_IEN_RXFL_MASK                             0x4UL
+#define _EUSART_IEN_RXFL_DEFAULT                          0x00000000UL
+#define EUSART_IEN_RXFL_DEFAULT                           (_EUSART_IEN_RXFL_DEFAULT << 2)
+#define EUSART_IEN_RXFULL                                 (0x1UL << 3)
+#define _EUSART_IEN_RXFULL_SHIFT                          3
+#define _EUSART_IEN_RXFULL_MASK                           0x8UL
+#define _EUSART_IEN_RXFULL_DEFAULT                        0x00000000UL
+#define EUSART_IEN_RXFULL_DEFAULT                         (_EUSART_IEN_RXFULL_DEFAULT << 3)
+#define EUSART_IEN_RXOF                                   (0x1UL << 4)
+#define _EUSART_IEN_RXOF_SHIFT                            4
+#define _EUSART_IEN_RXOF_MASK                             0x10UL
+#define _EUSART_IEN_RXOF_DEFAULT                          0x00000000UL
+#define EUSART_IEN_RXOF_DEFAULT                           (_EUSART_IEN_RXOF_DEFAULT << 4)
+#define EUSART_IEN_RXUF                                   (0x1UL << 5)
+#define _EUSART_IEN_RXUF_SHIFT                            5
+#define _EUSART_IEN_RXUF_MASK                             0x20UL
+#define _EUSART_IEN_RXUF_DEFAULT                          0x00000000UL
+#define EUSART_IEN_RXUF_DEFAULT                           (_EUSART_IEN_RXUF_DEFAULT << 5)
+#define EUSART_IEN_TXOF                                   (0x1UL << 6)
+#define _EUSART_IEN_TXOF_SHIFT                            6
+#define _EUSART_IEN_TXOF_MASK                             0x40UL
+#define _EUSART_IEN_TXOF_DEFAULT                          0x00000000UL
+#define EUSART_IEN_TXOF_DEFAULT                           (_EUSART_IEN_TXOF_DEFAULT << 6)
+#define EUSART_IEN_PERR                                   (0x1UL << 8)
+#define _EUSART_IEN_PERR_SHIFT                            8
+#define _EUSART_IEN_PERR_MASK                             0x100UL
+#define _EUSART_IEN_PERR_DEFAULT                          0x00000000UL
+#define EUSART_IEN_PERR_DEFAULT                           (_EUSART_IEN_PERR_DEFAULT << 8)
+#define EUSART_IEN_FERR                                   (0x1UL << 9)
+#define _EUSART_IEN_FERR_SHIFT                            9
+#define _EUSART_IEN_FERR_MASK                             0x200UL
+#define _EUSART_IEN_FERR_DEFAULT                          0x00000000UL
+#define EUSART_IEN_FERR_DEFAULT                           (_EUSART_IEN_FERR_DEFAULT << 9)
+
+/* Bit fields for EUSART IF */
+#define _EUSART_IF_RESETVALUE                             0x00000000UL
+#define _EUSART_IF_MASK                                   0x0000037FUL
+#define EUSART_IF_TXC                                     (0x1UL << 0)
+#define _EUSART_IF_TXC_SHIFT                              0
+#define _EUSART_IF_TXC_MASK                               0x1UL
+#define _EUSART_IF_TXC_DEFAULT                            0x00000000UL
+#define EUSART_IF_TXC_DEFAULT                             (_EUSART_IF_TXC_DEFAULT << 0)
+#define EUSART_IF_TXFL                                    (0x1UL << 1)
+#define _EUSART_IF_TXFL_SHIFT                             1
+#define _EUSART_IF_TXFL_MASK                              0x2UL
+#define _EUSART_IF_TXFL_DEFAULT                           0x00000000UL
+#define EUSART_IF_TXFL_DEFAULT                            (_EUSART_IF_TXFL_DEFAULT << 1)
+#define EUSART_IF_RXFL                                    (0x1UL << 2)
+#define _EUSART_IF_RXFL_SHIFT                             2
+#define _EUSART_IF_RXFL_MASK                              0x4UL
+#define _EUSART_IF_RXFL_DEFAULT                           0x00000000UL
+#define EUSART_IF_RXFL_DEFAULT                            (_EUSART_IF_RXFL_DEFAULT << 2)
+#define EUSART_IF_RXFULL                                  (0x1UL << 3)
+#define _EUSART_IF_RXFULL_SHIFT                           3
+#define _EUSART_IF_RXFULL_MASK                            0x8UL
+#define _EUSART_IF_RXFULL_DEFAULT                         0x00000000UL
+#define EUSART_IF_RXFULL_DEFAULT                          (_EUSART_IF_RXFULL_DEFAULT << 3)
+#define EUSART_IF_RXOF                                    (0x1UL << 4)
+#define _EUSART_IF_RXOF_SHIFT                             4
+#define _EUSART_IF_RXOF_MASK                              0x10UL
+#define _EUSART_IF_RXOF_DEFAULT                           0x00000000UL
+#define EUSART_IF_RXOF_DEFAULT                            (_EUSART_IF_RXOF_DEFAULT << 4)
+#define EUSART_IF_RXUF                                    (0x1UL << 5)
+#define _EUSART_IF_RXUF_SHIFT                             5
+#define _EUSART_IF_RXUF_MASK                              0x20UL
+#define _EUSART_IF_RXUF_DEFAULT                           0x00000000UL
+#define EUSART_IF_RXUF_DEFAULT                            (_EUSART_IF_RXUF_DEFAULT << 5)
+#define EUSART_IF_TXOF                                    (0x1UL << 6)
+#define _EUSART_IF_TXOF_SHIFT                             6
+#define _EUSART_IF_TXOF_MASK                              0x40UL
+#define _EUSART_IF_TXOF_DEFAULT                           0x00000000UL
+#define EUSART_IF_TXOF_DEFAULT                            (_EUSART_IF_TXOF_DEFAULT << 6)
+#define EUSART_IF_PERR                                    (0x1UL << 8)
+#define _EUSART_IF_PERR_SHIFT                             8
+#define _EUSART_IF_PERR_MASK                              0x100UL
+#define _EUSART_IF_PERR_DEFAULT                           0x00000000UL
+#define EUSART_IF_PERR_DEFAULT                            (_EUSART_IF_PERR_DEFAULT << 8)
+#define EUSART_IF_FERR                                    (0x1UL << 9)
+#define _EUSART_IF_FERR_SHIFT                             9
+#define _EUSART_IF_FERR_MASK                              0x200UL
+#define _EUSART_IF_FERR_DEFAULT                           0x00000000UL
+#define EUSART_IF_FERR_DEFAULT                            (_EUSART_IF_FERR_DEFAULT << 9)
+
+/* Bit fields for EUSART IRHFCFG */
+#define _EUSART_IRHFCFG_RESETVALUE                        0x00000000UL
+#define _EUSART_IRHFCFG_MASK                              0x0000000FUL
+#define EUSART_IRHFCFG_IRHFEN                             (0x1UL << 0)
+#define _EUSART_IRHFCFG_IRHFEN_SHIFT                      0
+#define _EUSART_IRHFCFG_IRHFEN_MASK                       0x1UL
+#define _EUSART_IRHFCFG_IRHFEN_DEFAULT                    0x00000000UL
+#define EUSART_IRHFCFG_IRHFEN_DEFAULT                     (_EUSART_IRHFCFG_IRHFEN_DEFAULT << 0)
+#define EUSART_IRHFCFG_IRHFFILT                           (0x1UL << 1)
+#define _EUSART_IRHFCFG_IRHFFILT_SHIFT                    1
+#define _EUSART_IRHFCFG_IRHFFILT_MASK                     0x2UL
+#define _EUSART_IRHFCFG_IRHFFILT_DEFAULT                  0x00000000UL
+#define EUSART_IRHFCFG_IRHFFILT_DEFAULT                   (_EUSART_IRHFCFG_IRHFFILT_DEFAULT << 1)
+#define _EUSART_IRHFCFG_IRHFFILT_DISABLE                  0x00000000UL
+#define _EUSART_IRHFCFG_IRHFFILT_ENABLE                   0x00000001UL
+#define EUSART_IRHFCFG_IRHFFILT_DISABLE                   (_EUSART_IRHFCFG_IRHFFILT_DISABLE << 1)
+#define EUSART_IRHFCFG_IRHFFILT_ENABLE                    (_EUSART_IRHFCFG_IRHFFILT_ENABLE << 1)
+#define _EUSART_IRHFCFG_IRHFPW_SHIFT                      2
+#define _EUSART_IRHFCFG_IRHFPW_MASK                       0xCUL
+#define _EUSART_IRHFCFG_IRHFPW_DEFAULT                    0x00000000UL
+#define EUSART_IRHFCFG_IRHFPW_DEFAULT                     (_EUSART_IRHFCFG_IRHFPW_DEFAULT << 2)
+#define _EUSART_IRHFCFG_IRHFPW_ONE                        0x00000000UL
+#define _EUSART_IRHFCFG_IRHFPW_FOUR                       0x00000001UL
+#define _EUSART_IRHFCFG_IRHFPW_THREE                      0x00000002UL
+#define _EUSART_IRHFCFG_IRHFPW_TWO                        0x00000003UL
+#define EUSART_IRHFCFG_IRHFPW_ONE                         (_EUSART_IRHFCFG_IRHFPW_ONE << 2)
+#define EUSART_IRHFCFG_IRHFPW_FOUR                        (_EUSART_IRHFCFG_IRHFPW_FOUR << 2)
+#define EUSART_IRHFCFG_IRHFPW_THREE                       (_EUSART_IRHFCFG_IRHFPW_THREE << 2)
+#define EUSART_IRHFCFG_IRHFPW_TWO                         (_EUSART_IRHFCFG_IRHFPW_TWO << 2)
+
+/* Bit fields for EUSART IRLFCFG */
+#define _EUSART_IRLFCFG_RESETVALUE                        0x00000000UL
+#define _EUSART_IRLFCFG_MASK                              0x00000001UL
+#define EUSART_IRLFCFG_IRLFEN                             (0x1UL << 0)
+#define _EUSART_IRLFCFG_IRLFEN_SHIFT                      0
+#define _EUSART_IRLFCFG_IRLFEN_MASK                       0x1UL
+#define _EUSART_IRLFCFG_IRLFEN_DEFAULT                    0x00000000UL
+#define EUSART_IRLFCFG_IRLFEN_DEFAULT                     (_EUSART_IRLFCFG_IRLFEN_DEFAULT << 0)
+
+/* Bit fields for EUSART RXDATA */
+#define _EUSART_RXDATA_RESETVALUE                         0x00000000UL
+#define _EUSART_RXDATA_MASK                               0x00000000UL
+
+/* Bit fields for EUSART SIGFRAMECFG */
+#define _EUSART_SIGFRAMECFG_RESETVALUE                    0x00000000UL
+#define _EUSART_SIGFRAMECFG_MASK                          0x00000000UL
+
+/* Bit fields for EUSART STARTFRAMECFG */
+#define _EUSART_STARTFRAMECFG_RESETVALUE                  0x00000000UL
+#define _EUSART_STARTFRAMECFG_MASK                        0x00000000UL
+
+/* Bit fields for EUSART STATUS */
+#define _EUSART_STATUS_RESETVALUE                         0x00000000UL
+#define _EUSART_STATUS_MASK                               0x000031FBUL
+#define EUSART_STATUS_RXENS                               (0x1UL << 0)
+#define _EUSART_STATUS_RXENS_SHIFT                        0
+#define _EUSART_STATUS_RXENS_MASK                         0x1UL
+#define _EUSART_STATUS_RXENS_DEFAULT                      0x00000000UL
+#define EUSART_STATUS_RXENS_DEFAULT                       (_EUSART_STATUS_RXENS_DEFAULT << 0)
+#define EUSART_STATUS_TXENS                               (0x1UL << 1)
+#define _EUSART_STATUS_TXENS_SHIFT                        1
+#define _EUSART_STATUS_TXENS_MASK                         0x2UL
+#define _EUSART_STATUS_TXENS_DEFAULT                      0x00000000UL
+#define EUSART_STATUS_TXENS_DEFAULT                       (_EUSART_STATUS_TXENS_DEFAULT << 1)
+#define EUSART_STATUS_RXBLOCK                             (0x1UL << 3)
+#define _EUSART_STATUS_RXBLOCK_SHIFT                      3
+#define _EUSART_STATUS_RXBLOCK_MASK                       0x8UL
+#define _EUSART_STATUS_RXBLOCK_DEFAULT                    0x00000000UL
+#define EUSART_STATUS_RXBLOCK_DEFAULT                     (_EUSART_STATUS_RXBLOCK_DEFAULT << 3)
+#define EUSART_STATUS_TXTRI                               (0x1UL << 4)
+#define _EUSART_STATUS_TXTRI_SHIFT                        4
+#define _EUSART_STATUS_TXTRI_MASK                         0x10UL
+#define _EUSART_STATUS_TXTRI_DEFAULT                      0x00000000UL
+#define EUSART_STATUS_TXTRI_DEFAULT                       (_EUSART_STATUS_TXTRI_DEFAULT << 4)
+#define EUSART_STATUS_TXC                                 (0x1UL << 5)
+#define _EUSART_STATUS_TXC_SHIFT                          5
+#define _EUSART_STATUS_TXC_MASK                           0x20UL
+#define _EUSART_STATUS_TXC_DEFAULT                        0x00000000UL
+#define EUSART_STATUS_TXC_DEFAULT                         (_EUSART_STATUS_TXC_DEFAULT << 5)
+#define EUSART_STATUS_TXFL                                (0x1UL << 6)
+#define _EUSART_STATUS_TXFL_SHIFT                         6
+#define _EUSART_STATUS_TXFL_MASK                          0x40UL
+#define _EUSART_STATUS_TXFL_DEFAULT                       0x00000000UL
+#define EUSART_STATUS_TXFL_DEFAULT                        (_EUSART_STATUS_TXFL_DEFAULT << 6)
+#define EUSART_STATUS_RXFL                                (0x1UL << 7)
+#define _EUSART_STATUS_RXFL_SHIFT                         7
+#define _EUSART_STATUS_RXFL_MASK                          0x80UL
+#define _EUSART_STATUS_RXFL_DEFAULT                       0x00000000UL
+#define EUSART_STATUS_RXFL_DEFAULT                        (_EUSART_STATUS_RXFL_DEFAULT << 7)
+#define EUSART_STATUS_RXFULL                              (0x1UL << 8)
+#define _EUSART_STATUS_RXFULL_SHIFT                       8
+#define _EUSART_STATUS_RXFULL_MASK                        0x100UL
+#define _EUSART_STATUS_RXFULL_DEFAULT                     0x00000000UL
+#define EUSART_STATUS_RXFULL_DEFAULT                      (_EUSART_STATUS_RXFULL_DEFAULT << 8)
+#define EUSART_STATUS_RXIDLE                              (0x1UL << 12)
+#define _EUSART_STATUS_RXIDLE_SHIFT                       12
+#define _EUSART_STATUS_RXIDLE_MASK                        0x1000UL
+#define _EUSART_STATUS_RXIDLE_DEFAULT                     0x00000000UL
+#define EUSART_STATUS_RXIDLE_DEFAULT                      (_EUSART_STATUS_RXIDLE_DEFAULT << 12)
+#define EUSART_STATUS_TXIDLE                              (0x1UL << 13)
+#define _EUSART_STATUS_TXIDLE_SHIFT                       13
+#define _EUSART_STATUS_TXIDLE_MASK                        0x2000UL
+#define _EUSART_STATUS_TXIDLE_DEFAULT                     0x00000000UL
+#define EUSART_STATUS_TXIDLE_DEFAULT                      (_EUSART_STATUS_TXIDLE_DEFAULT << 13)
+
+/* Bit fields for EUSART SYNCBUSY */
+#define _EUSART_SYNCBUSY_RESETVALUE                       0x00000000UL
+#define _EUSART_SYNCBUSY_MASK                             0x0003FFFFUL
+#define _EUSART_SYNCBUSY_DIV_SHIFT                        0
+#define _EUSART_SYNCBUSY_DIV_MASK                         0xFFUL
+#define _EUSART_SYNCBUSY_DIV_DEFAULT                      0x00000000UL
+#define EUSART_SYNCBUSY_DIV_DEFAULT                       (_EUSART_SYNCBUSY_DIV_DEFAULT << 0)
+#define EUSART_SYNCBUSY_RXBLOCKDIS                        (0x1UL << 8)
+#define _EUSART_SYNCBUSY_RXBLOCKDIS_SHIFT                 8
+#define _EUSART_SYNCBUSY_RXBLOCKDIS_MASK                  0x100UL
+#define _EUSART_SYNCBUSY_RXBLOCKDIS_DEFAULT               0x00000000UL
+#define EUSART_SYNCBUSY_RXBLOCKDIS_DEFAULT                (_EUSART_SYNCBUSY_RXBLOCKDIS_DEFAULT << 8)
+#define EUSART_SYNCBUSY_RXBLOCKEN                         (0x1UL << 9)
+#define _EUSART_SYNCBUSY_RXBLOCKEN_SHIFT                  9
+#define _EUSART_SYNCBUSY_RXBLOCKEN_MASK                   0x200UL
+#define _EUSART_SYNCBUSY_RXBLOCKEN_DEFAULT                0x00000000UL
+#define EUSART_SYNCBUSY_RXBLOCKEN_DEFAULT                 (_EUSART_SYNCBUSY_RXBLOCKEN_DEFAULT << 9)
+#define EUSART_SYNCBUSY_RXDIS                             (0x1UL << 10)
+#define _EUSART_SYNCBUSY_RXDIS_SHIFT                      10
+#define _EUSART_SYNCBUSY_RXDIS_MASK                       0x400UL
+#define _EUSART_SYNCBUSY_RXDIS_DEFAULT                    0x00000000UL
+#define EUSART_SYNCBUSY_RXDIS_DEFAULT                     (_EUSART_SYNCBUSY_RXDIS_DEFAULT << 10)
+#define EUSART_SYNCBUSY_RXEN                              (0x1UL << 11)
+#define _EUSART_SYNCBUSY_RXEN_SHIFT                       11
+#define _EUSART_SYNCBUSY_RXEN_MASK                        0x800UL
+#define _EUSART_SYNCBUSY_RXEN_DEFAULT                     0x00000000UL
+#define EUSART_SYNCBUSY_RXEN_DEFAULT                      (_EUSART_SYNCBUSY_RXEN_DEFAULT << 11)
+#define EUSART_SYNCBUSY_RXTEN                             (0x1UL << 12)
+#define _EUSART_SYNCBUSY_RXTEN_SHIFT                      12
+#define _EUSART_SYNCBUSY_RXTEN_MASK                       0x1000UL
+#define _EUSART_SYNCBUSY_RXTEN_DEFAULT                    0x00000000UL
+#define EUSART_SYNCBUSY_RXTEN_DEFAULT                     (_EUSART_SYNCBUSY_RXTEN_DEFAULT << 12)
+#define EUSART_SYNCBUSY_TXDIS                             (0x1UL << 13)
+#define _EUSART_SYNCBUSY_TXDIS_SHIFT                      13
+#define _EUSART_SYNCBUSY_TXDIS_MASK                       0x2000UL
+#define _EUSART_SYNCBUSY_TXDIS_DEFAULT                    0x00000000UL
+#define EUSART_SYNCBUSY_TXDIS_DEFAULT                     (_EUSART_SYNCBUSY_TXDIS_DEFAULT << 13)
+#define EUSART_SYNCBUSY_TXEN                              (0x1UL << 14)
+#define _EUSART_SYNCBUSY_TXEN_SHIFT                       14
+#define _EUSART_SYNCBUSY_TXEN_MASK                        0x4000UL
+#define _EUSART_SYNCBUSY_TXEN_DEFAULT                     0x00000000UL
+#define EUSART_SYNCBUSY_TXEN_DEFAULT                      (_EUSART_SYNCBUSY_TXEN_DEFAULT << 14)
+#define EUSART_SYNCBUSY_TXTEN                             (0x1UL << 15)
+#define _EUSART_SYNCBUSY_TXTEN_SHIFT                      15
+#define _EUSART_SYNCBUSY_TXTEN_MASK                       0x8000UL
+#define _EUSART_SYNCBUSY_TXTEN_DEFAULT                    0x00000000UL
+#define EUSART_SYNCBUSY_TXTEN_DEFAULT                     (_EUSART_SYNCBUSY_TXTEN_DEFAULT << 15)
+#define EUSART_SYNCBUSY_TXTRIDIS                          (0x1UL << 16)
+#define _EUSART_SYNCBUSY_TXTRIDIS_SHIFT                   16
+#define _EUSART_SYNCBUSY_TXTRIDIS_MASK                    0x10000UL
+#define _EUSART_SYNCBUSY_TXTRIDIS_DEFAULT                 0x00000000UL
+#define EUSART_SYNCBUSY_TXTRIDIS_DEFAULT                  (_EUSART_SYNCBUSY_TXTRIDIS_DEFAULT << 16)
+#define EUSART_SYNCBUSY_TXTRIEN                           (0x1UL << 17)
+#define _EUSART_SYNCBUSY_TXTRIEN_SHIFT                    17
+#define _EUSART_SYNCBUSY_TXTRIEN_MASK                     0x20000UL
+#define _EUSART_SYNCBUSY_TXTRIEN_DEFAULT                  0x00000000UL
+#define EUSART_SYNCBUSY_TXTRIEN_DEFAULT                   (_EUSART_SYNCBUSY_TXTRIEN_DEFAULT << 17)
+
+/* Bit fields for EUSART TIMINGCFG */
+#define _EUSART_TIMINGCFG_RESETVALUE                      0x00000000UL
+#define _EUSART_TIMINGCFG_MASK                            0x00000000UL
+
+/* Bit fields for EUSART TRIGCTRL */
+#define _EUSART_TRIGCTRL_RESETVALUE                       0x00000000UL
+#define _EUSART_TRIGCTRL_MASK                             0x00000003UL
+#define EUSART_TRIGCTRL_RXTEN                             (0x1UL << 0)
+#define _EUSART_TRIGCTRL_RXTEN_SHIFT                      0
+#define _EUSART_TRIGCTRL_RXTEN_MASK                       0x1UL
+#define _EUSART_TRIGCTRL_RXTEN_DEFAULT                    0x00000000UL
+#define EUSART_TRIGCTRL_RXTEN_DEFAULT                     (_EUSART_TRIGCTRL_RXTEN_DEFAULT << 0)
+#define EUSART_TRIGCTRL_TXTEN                             (0x1UL << 1)
+#define _EUSART_TRIGCTRL_TXTEN_SHIFT                      1
+#define _EUSART_TRIGCTRL_TXTEN_MASK                       0x2UL
+#define _EUSART_TRIGCTRL_TXTEN_DEFAULT                    0x00000000UL
+#define EUSART_TRIGCTRL_TXTEN_DEFAULT                     (_EUSART_TRIGCTRL_TXTEN_DEFAULT << 1)
+
+/* Bit fields for EUSART TXDATA */
+#define _EUSART_TXDATA_RESETVALUE                         0x00000000UL
+#define _EUSART_TXDATA_MASK                               0x00000000UL
+
+/******************************************************************************
+ * I2C
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t CLKDIV;
+  __IOM uint32_t CMD;
+  __IOM uint32_t CTRL;
+  __IOM uint32_t EN;
+  __IOM uint32_t IEN;
+  __IOM uint32_t IF;
+  __IOM uint32_t IFC;
+  __IOM uint32_t IFS;
+  __IOM uint32_t RXDATA;
+  __IOM uint32_t SADDR;
+  __IOM uint32_t SADDRMASK;
+  __IOM uint32_t STATE;
+  __IOM uint32_t STATUS;
+  __IOM uint32_t TXDATA;
+  uint32_t RESERVED0[1010];
+  __IOM uint32_t CLKDIV_SET;
+  __IOM uint32_t CMD_SET;
+  __IOM uint32_t CTRL_SET;
+  __IOM uint32_t EN_SET;
+  __IOM uint32_t IEN_SET;
+  __IOM uint32_t IF_SET;
+  __IOM uint32_t IFC_SET;
+  __IOM uint32_t IFS_SET;
+  __IOM uint32_t RXDATA_SET;
+  __IOM uint32_t SADDR_SET;
+  __IOM uint32_t SADDRMASK_SET;
+  __IOM uint32_t STATE_SET;
+  __IOM uint32_t STATUS_SET;
+  __IOM uint32_t TXDATA_SET;
+  uint32_t RESERVED1[1010];
+  __IOM uint32_t CLKDIV_CLR;
+  __IOM uint32_t CMD_CLR;
+  __IOM uint32_t CTRL_CLR;
+  __IOM uint32_t EN_CLR;
+  __IOM uint32_t IEN_CLR;
+  __IOM uint32_t IF_CLR;
+  __IOM uint32_t IFC_CLR;
+  __IOM uint32_t IFS_CLR;
+  __IOM uint32_t RXDATA_CLR;
+  __IOM uint32_t SADDR_CLR;
+  __IOM uint32_t SADDRMASK_CLR;
+  __IOM uint32_t STATE_CLR;
+  __IOM uint32_t STATUS_CLR;
+  __IOM uint32_t TXDATA_CLR;
+  uint32_t RESERVED2[1010];
+  __IOM uint32_t CLKDIV_TGL;
+  __IOM uint32_t CMD_TGL;
+  __IOM uint32_t CTRL_TGL;
+  __IOM uint32_t EN_TGL;
+  __IOM uint32_t IEN_TGL;
+  __IOM uint32_t IF_TGL;
+  __IOM uint32_t IFC_TGL;
+  __IOM uint32_t IFS_TGL;
+  __IOM uint32_t RXDATA_TGL;
+  __IOM uint32_t SADDR_TGL;
+  __IOM uint32_t SADDRMASK_TGL;
+  __IOM uint32_t STATE_TGL;
+  __IOM uint32_t STATUS_TGL;
+  __IOM uint32_t TXDATA_TGL;
+  uint32_t RESERVED3[1010];
+} I2C_TypeDef;
+
+/* Bit fields for I2C CLKDIV */
+#define _I2C_CLKDIV_RESETVALUE                            0x00000000UL
+#define _I2C_CLKDIV_MASK                                  0x000001FFUL
+#define _I2C_CLKDIV_DIV_SHIFT                             0
+#define _I2C_CLKDIV_DIV_MASK                              0x1FFUL
+#define _I2C_CLKDIV_DIV_DEFAULT                           0x00000000UL
+#define I2C_CLKDIV_DIV_DEFAULT                            (_I2C_CLKDIV_DIV_DEFAULT << 0)
+
+/* Bit fields for I2C CMD */
+#define _I2C_CMD_RESETVALUE                               0x00000000UL
+#define _I2C_CMD_MASK                                     0x0000007FUL
+#define I2C_CMD_ABORT                                     (0x1UL << 0)
+#define _I2C_CMD_ABORT_SHIFT                              0
+#define _I2C_CMD_ABORT_MASK                               0x1UL
+#define _I2C_CMD_ABORT_DEFAULT                            0x00000000UL
+#define I2C_CMD_ABORT_DEFAULT                             (_I2C_CMD_ABORT_DEFAULT << 0)
+#define I2C_CMD_ACK                                       (0x1UL << 1)
+#define _I2C_CMD_ACK_SHIFT                                1
+#define _I2C_CMD_ACK_MASK                                 0x2UL
+#define _I2C_CMD_ACK_DEFAULT                              0x00000000UL
+#define I2C_CMD_ACK_DEFAULT                               (_I2C_CMD_ACK_DEFAULT << 1)
+#define I2C_CMD_CLEARPC                                   (0x1UL << 2)
+#define _I2C_CMD_CLEARPC_SHIFT                            2
+#define _I2C_CMD_CLEARPC_MASK                             0x4UL
+#define _I2C_CMD_CLEARPC_DEFAULT                          0x00000000UL
+#define I2C_CMD_CLEARPC_DEFAULT                           (_I2C_CMD_CLEARPC_DEFAULT << 2)
+#define I2C_CMD_CLEARTX                                   (0x1UL << 3)
+#define _I2C_CMD_CLEARTX_SHIFT                            3
+#define _I2C_CMD_CLEARTX_MASK                             0x8UL
+#define _I2C_CMD_CLEARTX_DEFAULT                          0x00000000UL
+#define I2C_CMD_CLEARTX_DEFAULT                           (_I2C_CMD_CLEARTX_DEFAULT << 3)
+#define I2C_CMD_NACK                                      (0x1UL << 4)
+#define _I2C_CMD_NACK_SHIFT                               4
+#define _I2C_CMD_NACK_MASK                                0x10UL
+#define _I2C_CMD_NACK_DEFAULT                             0x00000000UL
+#define I2C_CMD_NACK_DEFAULT                              (_I2C_CMD_NACK_DEFAULT << 4)
+#define I2C_CMD_START                                     (0x1UL << 5)
+#define _I2C_CMD_START_SHIFT                              5
+#define _I2C_CMD_START_MASK                               0x20UL
+#define _I2C_CMD_START_DEFAULT                            0x00000000UL
+#define I2C_CMD_START_DEFAULT                             (_I2C_CMD_START_DEFAULT << 5)
+#define I2C_CMD_STOP                                      (0x1UL << 6)
+#define _I2C_CMD_STOP_SHIFT                               6
+#define _I2C_CMD_STOP_MASK                                0x40UL
+#define _I2C_CMD_STOP_DEFAULT                             0x00000000UL
+#define I2C_CMD_STOP_DEFAULT                              (_I2C_CMD_STOP_DEFAULT << 6)
+
+/* Bit fields for I2C CTRL */
+#define _I2C_CTRL_RESETVALUE                              0x00000000UL
+#define _I2C_CTRL_MASK                                    0x00003001UL
+#define I2C_CTRL_SLAVE                                    (0x1UL << 0)
+#define _I2C_CTRL_SLAVE_SHIFT                             0
+#define _I2C_CTRL_SLAVE_MASK                              0x1UL
+#define _I2C_CTRL_SLAVE_DEFAULT                           0x00000000UL
+#define I2C_CTRL_SLAVE_DEFAULT                            (_I2C_CTRL_SLAVE_DEFAULT << 0)
+#define _I2C_CTRL_CLHR_SHIFT                              12
+#define _I2C_CTRL_CLHR_MASK                               0x3000UL
+#define _I2C_CTRL_CLHR_DEFAULT                            0x00000000UL
+#define I2C_CTRL_CLHR_DEFAULT                             (_I2C_CTRL_CLHR_DEFAULT << 12)
+#define _I2C_CTRL_CLHR_STANDARD                           0x00000000UL
+#define _I2C_CTRL_CLHR_ASYMMETRIC                         0x00000001UL
+#define _I2C_CTRL_CLHR_FAST                               0x00000002UL
+#define I2C_CTRL_CLHR_STANDARD                            (_I2C_CTRL_CLHR_STANDARD << 12)
+#define I2C_CTRL_CLHR_ASYMMETRIC                          (_I2C_CTRL_CLHR_ASYMMETRIC << 12)
+#define I2C_CTRL_CLHR_FAST                                (_I2C_CTRL_CLHR_FAST << 12)
+
+/* Bit fields for I2C EN */
+#define _I2C_EN_RESETVALUE                                0x00000000UL
+#define _I2C_EN_MASK                                      0x00000001UL
+#define I2C_EN_EN                                         (0x1UL << 0)
+#define _I2C_EN_EN_SHIFT                                  0
+#define _I2C_EN_EN_MASK                                   0x1UL
+#define _I2C_EN_EN_DEFAULT                                0x00000000UL
+#define I2C_EN_EN_DEFAULT                                 (_I2C_EN_EN_DEFAULT << 0)
+
+/* Bit fields for I2C IEN */
+#define _I2C_IEN_RESETVALUE                               0x00000000UL
+#define _I2C_IEN_MASK                                     0x0007FFFFUL
+#define I2C_IEN_START                                     (0x1UL << 0)
+#define _I2C_IEN_START_SHIFT                              0
+#define _I2C_IEN_START_MASK                               0x1UL
+#define _I2C_IEN_START_DEFAULT                            0x00000000UL
+#define I2C_IEN_START_DEFAULT                             (_I2C_IEN_START_DEFAULT << 0)
+#define I2C_IEN_RSTART                                    (0x1UL << 1)
+#define _I2C_IEN_RSTART_SHIFT                             1
+#define _I2C_IEN_RSTART_MASK                              0x2UL
+#define _I2C_IEN_RSTART_DEFAULT                           0x00000000UL
+#define I2C_IEN_RSTART_DEFAULT                            (_I2C_IEN_RSTART_DEFAULT << 1)
+#define I2C_IEN_ADDR                                      (0x1UL << 2)
+#define _I2C_IEN_ADDR_SHIFT                               2
+#define _I2C_IEN_ADDR_MASK                                0x4UL
+#define _I2C_IEN_ADDR_DEFAULT                             0x00000000UL
+#define I2C_IEN_ADDR_DEFAULT                              (_I2C_IEN_ADDR_DEFAULT << 2)
+#define I2C_IEN_TXC                                       (0x1UL << 3)
+#define _I2C_IEN_TXC_SHIFT                                3
+#define _I2C_IEN_TXC_MASK                                 0x8UL
+#define _I2C_IEN_TXC_DEFAULT                              0x00000000UL
+#define I2C_IEN_TXC_DEFAULT                               (_I2C_IEN_TXC_DEFAULT << 3)
+#define I2C_IEN_TXBL                                      (0x1UL << 4)
+#define _I2C_IEN_TXBL_SHIFT                               4
+#define _I2C_IEN_TXBL_MASK                                0x10UL
+#define _I2C_IEN_TXBL_DEFAULT                             0x00000000UL
+#define I2C_IEN_TXBL_DEFAULT                              (_I2C_IEN_TXBL_DEFAULT << 4)
+#define I2C_IEN_RXDATAV                                   (0x1UL << 5)
+#define _I2C_IEN_RXDATAV_SHIFT                            5
+#define _I2C_IEN_RXDATAV_MASK                             0x20UL
+#define _I2C_IEN_RXDATAV_DEFAULT                          0x00000000UL
+#define I2C_IEN_RXDATAV_DEFAULT                           (_I2C_IEN_RXDATAV_DEFAULT << 5)
+#define I2C_IEN_ACK                                       (0x1UL << 6)
+#define _I2C_IEN_ACK_SHIFT                                6
+#define _I2C_IEN_ACK_MASK                                 0x40UL
+#define _I2C_IEN_ACK_DEFAULT                              0x00000000UL
+#define I2C_IEN_ACK_DEFAULT                               (_I2C_IEN_ACK_DEFAULT << 6)
+#define I2C_IEN_NACK                                      (0x1UL << 7)
+#define _I2C_IEN_NACK_SHIFT                               7
+#define _I2C_IEN_NACK_MASK                                0x80UL
+#define _I2C_IEN_NACK_DEFAULT                             0x00000000UL
+#define I2C_IEN_NACK_DEFAULT                              (_I2C_IEN_NACK_DEFAULT << 7)
+#define I2C_IEN_MSTOP                                     (0x1UL << 8)
+#define _I2C_IEN_MSTOP_SHIFT                              8
+#define _I2C_IEN_MSTOP_MASK                               0x100UL
+#define _I2C_IEN_MSTOP_DEFAULT                            0x00000000UL
+#define I2C_IEN_MSTOP_DEFAULT                             (_I2C_IEN_MSTOP_DEFAULT << 8)
+#define I2C_IEN_ARBLOST                                   (0x1UL << 9)
+#define _I2C_IEN_ARBLOST_SHIFT                            9
+#define _I2C_IEN_ARBLOST_MASK                             0x200UL
+#define _I2C_IEN_ARBLOST_DEFAULT                          0x00000000UL
+#define I2C_IEN_ARBLOST_DEFAULT                           (_I2C_IEN_ARBLOST_DEFAULT << 9)
+#define I2C_IEN_BUSERR                                    (0x1UL << 10)
+#define _I2C_IEN_BUSERR_SHIFT                             10
+#define _I2C_IEN_BUSERR_MASK                              0x400UL
+#define _I2C_IEN_BUSERR_DEFAULT                           0x00000000UL
+#define I2C_IEN_BUSERR_DEFAULT                            (_I2C_IEN_BUSERR_DEFAULT << 10)
+#define I2C_IEN_BUSHOLD                                   (0x1UL << 11)
+#define _I2C_IEN_BUSHOLD_SHIFT                            11
+#define _I2C_IEN_BUSHOLD_MASK                             0x800UL
+#define _I2C_IEN_BUSHOLD_DEFAULT                          0x00000000UL
+#define I2C_IEN_BUSHOLD_DEFAULT                           (_I2C_IEN_BUSHOLD_DEFAULT << 11)
+#define I2C_IEN_TXOF                                      (0x1UL << 12)
+#define _I2C_IEN_TXOF_SHIFT                               12
+#define _I2C_IEN_TXOF_MASK                                0x1000UL
+#define _I2C_IEN_TXOF_DEFAULT                             0x00000000UL
+#define I2C_IEN_TXOF_DEFAULT                              (_I2C_IEN_TXOF_DEFAULT << 12)
+#define I2C_IEN_RXUF                                      (0x1UL << 13)
+#define _I2C_IEN_RXUF_SHIFT                               13
+#define _I2C_IEN_RXUF_MASK                                0x2000UL
+#define _I2C_IEN_RXUF_DEFAULT                             0x00000000UL
+#define I2C_IEN_RXUF_DEFAULT                              (_I2C_IEN_RXUF_DEFAULT << 13)
+#define I2C_IEN_BITO                                      (0x1UL << 14)
+#define _I2C_IEN_BITO_SHIFT                               14
+#define _I2C_IEN_BITO_MASK                                0x4000UL
+#define _I2C_IEN_BITO_DEFAULT                             0x00000000UL
+#define I2C_IEN_BITO_DEFAULT                              (_I2C_IEN_BITO_DEFAULT << 14)
+#define I2C_IEN_CLTO                                      (0x1UL << 15)
+#define _I2C_IEN_CLTO_SHIFT                               15
+#define _I2C_IEN_CLTO_MASK                                0x8000UL
+#define _I2C_IEN_CLTO_DEFAULT                             0x00000000UL
+#define I2C_IEN_CLTO_DEFAULT                              (_I2C_IEN_CLTO_DEFAULT << 15)
+#define I2C_IEN_SSTOP                                     (0x1UL << 16)
+#define _I2C_IEN_SSTOP_SHIFT                              16
+#define _I2C_IEN_SSTOP_MASK                               0x10000UL
+#define _I2C_IEN_SSTOP_DEFAULT                            0x00000000UL
+#define I2C_IEN_SSTOP_DEFAULT                             (_I2C_IEN_SSTOP_DEFAULT << 16)
+#define I2C_IEN_RXFULL                                    (0x1UL << 17)
+#define _I2C_IEN_RXFULL_SHIFT                             17
+#define _I2C_IEN_RXFULL_MASK                              0x20000UL
+#define _I2C_IEN_RXFULL_DEFAULT                           0x00000000UL
+#define I2C_IEN_RXFULL_DEFAULT                            (_I2C_IEN_RXFULL_DEFAULT << 17)
+#define I2C_IEN_CLERR                                     (0x1UL << 18)
+#define _I2C_IEN_CLERR_SHIFT                              18
+#define _I2C_IEN_CLERR_MASK                               0x40000UL
+#define _I2C_IEN_CLERR_DEFAULT                            0x00000000UL
+#define I2C_IEN_CLERR_DEFAULT                             (_I2C_IEN_CLERR_DEFAULT << 18)
+
+/* Bit fields for I2C IF */
+#define _I2C_IF_RESETVALUE                                0x00000000UL
+#define _I2C_IF_MASK                                      0x0007FFFFUL
+#define I2C_IF_START                                      (0x1UL << 0)
+#define _I2C_IF_START_SHIFT                               0
+#define _I2C_IF_START_MASK                                0x1UL
+#define _I2C_IF_START_DEFAULT                             0x00000000UL
+#define I2C_IF_START_DEFAULT                              (_I2C_IF_START_DEFAULT << 0)
+#define I2C_IF_RSTART                                     (0x1UL << 1)
+#define _I2C_IF_RSTART_SHIFT                              1
+#define _I2C_IF_RSTART_MASK                               0x2UL
+#define _I2C_IF_RSTART_DEFAULT                            0x00000000UL
+#define I2C_IF_RSTART_DEFAULT                             (_I2C_IF_RSTART_DEFAULT << 1)
+#define I2C_IF_ADDR                                       (0x1UL << 2)
+#define _I2C_IF_ADDR_SHIFT                                2
+#define _I2C_IF_ADDR_MASK                                 0x4UL
+#define _I2C_IF_ADDR_DEFAULT                              0x00000000UL
+#define I2C_IF_ADDR_DEFAULT                               (_I2C_IF_ADDR_DEFAULT << 2)
+#define I2C_IF_TXC                                        (0x1UL << 3)
+#define _I2C_IF_TXC_SHIFT                                 3
+#define _I2C_IF_TXC_MASK                                  0x8UL
+#define _I2C_IF_TXC_DEFAULT                               0x00000000UL
+#define I2C_IF_TXC_DEFAULT                                (_I2C_IF_TXC_DEFAULT << 3)
+#define I2C_IF_TXBL                                       (0x1UL << 4)
+#define _I2C_IF_TXBL_SHIFT                                4
+#define _I2C_IF_TXBL_MASK                                 0x10UL
+#define _I2C_IF_TXBL_DEFAULT                              0x00000000UL
+#define I2C_IF_TXBL_DEFAULT                               (_I2C_IF_TXBL_DEFAULT << 4)
+#define I2C_IF_RXDATAV                                    (0x1UL << 5)
+#define _I2C_IF_RXDATAV_SHIFT                             5
+#define _I2C_IF_RXDATAV_MASK                              0x20UL
+#define _I2C_IF_RXDATAV_DEFAULT                           0x00000000UL
+#define I2C_IF_RXDATAV_DEFAULT                            (_I2C_IF_RXDATAV_DEFAULT << 5)
+#define I2C_IF_ACK                                        (0x1UL << 6)
+#define _I2C_IF_ACK_SHIFT                                 6
+#define _I2C_IF_ACK_MASK                                  0x40UL
+#define _I2C_IF_ACK_DEFAULT                               0x00000000UL
+#define I2C_IF_ACK_DEFAULT                                (_I2C_IF_ACK_DEFAULT << 6)
+#define I2C_IF_NACK                                       (0x1UL << 7)
+#define _I2C_IF_NACK_SHIFT                                7
+#define _I2C_IF_NACK_MASK                                 0x80UL
+#define _I2C_IF_NACK_DEFAULT                              0x00000000UL
+#define I2C_IF_NACK_DEFAULT                               (_I2C_IF_NACK_DEFAULT << 7)
+#define I2C_IF_MSTOP                                      (0x1UL << 8)
+#define _I2C_IF_MSTOP_SHIFT                               8
+#define _I2C_IF_MSTOP_MASK                                0x100UL
+#define _I2C_IF_MSTOP_DEFAULT                             0x00000000UL
+#define I2C_IF_MSTOP_DEFAULT                              (_I2C_IF_MSTOP_DEFAULT << 8)
+#define I2C_IF_ARBLOST                                    (0x1UL << 9)
+#define _I2C_IF_ARBLOST_SHIFT                             9
+#define _I2C_IF_ARBLOST_MASK                              0x200UL
+#define _I2C_IF_ARBLOST_DEFAULT                           0x00000000UL
+#define I2C_IF_ARBLOST_DEFAULT                            (_I2C_IF_ARBLOST_DEFAULT << 9)
+#define I2C_IF_BUSERR                                     (0x1UL << 10)
+#define _I2C_IF_BUSERR_SHIFT                              10
+#define _I2C_IF_BUSERR_MASK                               0x400UL
+#define _I2C_IF_BUSERR_DEFAULT                            0x00000000UL
+#define I2C_IF_BUSERR_DEFAULT                             (_I2C_IF_BUSERR_DEFAULT << 10)
+#define I2C_IF_BUSHOLD                                    (0x1UL << 11)
+#define _I2C_IF_BUSHOLD_SHIFT                             11
+#define _I2C_IF_BUSHOLD_MASK                              0x800UL
+#define _I2C_IF_BUSHOLD_DEFAULT                           0x00000000UL
+#define I2C_IF_BUSHOLD_DEFAULT                            (_I2C_IF_BUSHOLD_DEFAULT << 11)
+#define I2C_IF_TXOF                                       (0x1UL << 12)
+#define _I2C_IF_TXOF_SHIFT                                12
+#define _I2C_IF_TXOF_MASK                                 0x1000UL
+#define _I2C_IF_TXOF_DEFAULT                              0x00000000UL
+#define I2C_IF_TXOF_DEFAULT                               (_I2C_IF_TXOF_DEFAULT << 12)
+#define I2C_IF_RXUF                                       (0x1UL << 13)
+#define _I2C_IF_RXUF_SHIFT                                13
+#define _I2C_IF_RXUF_MASK                                 0x2000UL
+#define _I2C_IF_RXUF_DEFAULT                              0x00000000UL
+#define I2C_IF_RXUF_DEFAULT                               (_I2C_IF_RXUF_DEFAULT << 13)
+#define I2C_IF_BITO                                       (0x1UL << 14)
+#define _I2C_IF_BITO_SHIFT                                14
+#define _I2C_IF_BITO_MASK                                 0x4000UL
+#define _I2C_IF_BITO_DEFAULT                              0x00000000UL
+#define I2C_IF_BITO_DEFAULT                               (_I2C_IF_BITO_DEFAULT << 14)
+#define I2C_IF_CLTO                                       (0x1UL << 15)
+#define _I2C_IF_CLTO_SHIFT                                15
+#define _I2C_IF_CLTO_MASK                                 0x8000UL
+#define _I2C_IF_CLTO_DEFAULT                              0x00000000UL
+#define I2C_IF_CLTO_DEFAULT                               (_I2C_IF_CLTO_DEFAULT << 15)
+#define I2C_IF_SSTOP                                      (0x1UL << 16)
+#define _I2C_IF_SSTOP_SHIFT                               16
+#define _I2C_IF_SSTOP_MASK                                0x10000UL
+#define _I2C_IF_SSTOP_DEFAULT                             0x00000000UL
+#define I2C_IF_SSTOP_DEFAULT                              (_I2C_IF_SSTOP_DEFAULT << 16)
+#define I2C_IF_RXFULL                                     (0x1UL << 17)
+#define _I2C_IF_RXFULL_SHIFT                              17
+#define _I2C_IF_RXFULL_MASK                               0x20000UL
+#define _I2C_IF_RXFULL_DEFAULT                            0x00000000UL
+#define I2C_IF_RXFULL_DEFAULT                             (_I2C_IF_RXFULL_DEFAULT << 17)
+#define I2C_IF_CLERR                                      (0x1UL << 18)
+#define _I2C_IF_CLERR_SHIFT                               18
+#define _I2C_IF_CLERR_MASK                                0x40000UL
+#define _I2C_IF_CLERR_DEFAULT                             0x00000000UL
+#define I2C_IF_CLERR_DEFAULT                              (_I2C_IF_CLERR_DEFAULT << 18)
+
+/* Bit fields for I2C IFC */
+#define _I2C_IFC_RESETVALUE                               0x00000000UL
+#define _I2C_IFC_MASK                                     0x00000000UL
+
+/* Bit fields for I2C IFS */
+#define _I2C_IFS_RESETVALUE                               0x00000000UL
+#define _I2C_IFS_MASK                                     0x00000000UL
+
+/* Bit fields for I2C RXDATA */
+#define _I2C_RXDATA_RESETVALUE                            0x00000000UL
+#define _I2C_RXDATA_MASK                                  0x00000000UL
+
+/* Bit fields for I2C SADDR */
+#define _I2C_SADDR_RESETVALUE                             0x00000000UL
+#define _I2C_SADDR_MASK                                   0x00000000UL
+
+/* Bit fields for I2C SADDRMASK */
+#define _I2C_SADDRMASK_RESETVALUE                         0x00000000UL
+#define _I2C_SADDRMASK_MASK                               0x00000000UL
+
+/* Bit fields for I2C STATE */
+#define _I2C_STATE_RESETVALUE                             0x00000000UL
+#define _I2C_STATE_MASK                                   0x0000001FUL
+#define I2C_STATE_BUSY                                    (0x1UL << 0)
+#define _I2C_STATE_BUSY_SHIFT                             0
+#define _I2C_STATE_BUSY_MASK                              0x1UL
+#define _I2C_STATE_BUSY_DEFAULT                           0x00000000UL
+#define I2C_STATE_BUSY_DEFAULT                            (_I2C_STATE_BUSY_DEFAULT << 0)
+#define I2C_STATE_MASTER                                  (0x1UL << 1)
+#define _I2C_STATE_MASTER_SHIFT                           1
+#define _I2C_STATE_MASTER_MASK                            0x2UL
+#define _I2C_STATE_MASTER_DEFAULT                         0x00000000UL
+#define I2C_STATE_MASTER_DEFAULT                          (_I2C_STATE_MASTER_DEFAULT << 1)
+#define I2C_STATE_TRANSMITTER                             (0x1UL << 2)
+#define _I2C_STATE_TRANSMITTER_SHIFT                      2
+#define _I2C_STATE_TRANSMITTER_MASK                       0x4UL
+#define _I2C_STATE_TRANSMITTER_DEFAULT                    0x00000000UL
+#define I2C_STATE_TRANSMITTER_DEFAULT                     (_I2C_STATE_TRANSMITTER_DEFAULT << 2)
+#define I2C_STATE_NACKED                                  (0x1UL << 3)
+#define _I2C_STATE_NACKED_SHIFT                           3
+#define _I2C_STATE_NACKED_MASK                            0x8UL
+#define _I2C_STATE_NACKED_DEFAULT                         0x00000000UL
+#define I2C_STATE_NACKED_DEFAULT                          (_I2C_STATE_NACKED_DEFAULT << 3)
+#define I2C_STATE_BUSHOLD                                 (0x1UL << 4)
+#define _I2C_STATE_BUSHOLD_SHIFT                          4
+#define _I2C_STATE_BUSHOLD_MASK                           0x10UL
+#define _I2C_STATE_BUSHOLD_DEFAULT                        0x00000000UL
+#define I2C_STATE_BUSHOLD_DEFAULT                         (_I2C_STATE_BUSHOLD_DEFAULT << 4)
+
+/* Bit fields for I2C STATUS */
+#define _I2C_STATUS_RESETVALUE                            0x00000000UL
+#define _I2C_STATUS_MASK                                  0x000003FFUL
+#define I2C_STATUS_PSTART                                 (0x1UL << 0)
+#define _I2C_STATUS_PSTART_SHIFT                          0
+#define _I2C_STATUS_PSTART_MASK                           0x1UL
+#define _I2C_STATUS_PSTART_DEFAULT                        0x00000000UL
+#define I2C_STATUS_PSTART_DEFAULT                         (_I2C_STATUS_PSTART_DEFAULT << 0)
+#define I2C_STATUS_PSTOP                                  (0x1UL << 1)
+#define _I2C_STATUS_PSTOP_SHIFT                           1
+#define _I2C_STATUS_PSTOP_MASK                            0x2UL
+#define _I2C_STATUS_PSTOP_DEFAULT                         0x00000000UL
+#define I2C_STATUS_PSTOP_DEFAULT                          (_I2C_STATUS_PSTOP_DEFAULT << 1)
+#define I2C_STATUS_PACK                                   (0x1UL << 2)
+#define _I2C_STATUS_PACK_SHIFT                            2
+#define _I2C_STATUS_PACK_MASK                             0x4UL
+#define _I2C_STATUS_PACK_DEFAULT                          0x00000000UL
+#define I2C_STATUS_PACK_DEFAULT                           (_I2C_STATUS_PACK_DEFAULT << 2)
+#define I2C_STATUS_PNACK                                  (0x1UL << 3)
+#define _I2C_STATUS_PNACK_SHIFT                           3
+#define _I2C_STATUS_PNACK_MASK                            0x8UL
+#define _I2C_STATUS_PNACK_DEFAULT                         0x00000000UL
+#define I2C_STATUS_PNACK_DEFAULT                          (_I2C_STATUS_PNACK_DEFAULT << 3)
+#define I2C_STATUS_PCONT                                  (0x1UL << 4)
+#define _I2C_STATUS_PCONT_SHIFT                           4
+#define _I2C_STATUS_PCONT_MASK                            0x10UL
+#define _I2C_STATUS_PCONT_DEFAULT                         0x00000000UL
+#define I2C_STATUS_PCONT_DEFAULT                          (_I2C_STATUS_PCONT_DEFAULT << 4)
+#define I2C_STATUS_PABORT                                 (0x1UL << 5)
+#define _I2C_STATUS_PABORT_SHIFT                          5
+#define _I2C_STATUS_PABORT_MASK                           0x20UL
+#define _I2C_STATUS_PABORT_DEFAULT                        0x00000000UL
+#define I2C_STATUS_PABORT_DEFAULT                         (_I2C_STATUS_PABORT_DEFAULT << 5)
+#define I2C_STATUS_TXC                                    (0x1UL << 6)
+#define _I2C_STATUS_TXC_SHIFT                             6
+#define _I2C_STATUS_TXC_MASK                              0x40UL
+#define _I2C_STATUS_TXC_DEFAULT                           0x00000000UL
+#define I2C_STATUS_TXC_DEFAULT                            (_I2C_STATUS_TXC_DEFAULT << 6)
+#define I2C_STATUS_TXBL                                   (0x1UL << 7)
+#define _I2C_STATUS_TXBL_SHIFT                            7
+#define _I2C_STATUS_TXBL_MASK                             0x80UL
+#define _I2C_STATUS_TXBL_DEFAULT                          0x00000000UL
+#define I2C_STATUS_TXBL_DEFAULT                           (_I2C_STATUS_TXBL_DEFAULT << 7)
+#define I2C_STATUS_RXDATAV                                (0x1UL << 8)
+#define _I2C_STATUS_RXDATAV_SHIFT                         8
+#define _I2C_STATUS_RXDATAV_MASK                          0x100UL
+#define _I2C_STATUS_RXDATAV_DEFAULT                       0x00000000UL
+#define I2C_STATUS_RXDATAV_DEFAULT                        (_I2C_STATUS_RXDATAV_DEFAULT << 8)
+#define I2C_STATUS_RXFULL                                 (0x1UL << 9)
+#define _I2C_STATUS_RXFULL_SHIFT                          9
+#define _I2C_STATUS_RXFULL_MASK                           0x200UL
+#define _I2C_STATUS_RXFULL_DEFAULT                        0x00000000UL
+#define I2C_STATUS_RXFULL_DEFAULT                         (_I2C_STATUS_RXFULL_DEFAULT << 9)
+
+/* Bit fields for I2C TXDATA */
+#define _I2C_TXDATA_RESETVALUE                            0x00000000UL
+#define _I2C_TXDATA_MASK                                  0x00000000UL
+
+/******************************************************************************
+ * IADC
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t CFG;
+  __IOM uint32_t SCALE;
+  __IOM uint32_t SCHED;
+} IADC_CfgTypeDef;
+
+typedef struct {
+  __IOM uint32_t SCAN;
+} IADC_ScanTypeDef;
+
+typedef struct {
+  __IOM uint32_t CMD;
+  __IOM uint32_t CMPTHR;
+  __IOM uint32_t CTRL;
+  __IOM uint32_t EN;
+  __IOM uint32_t IEN;
+  __IOM uint32_t IF;
+  __IOM uint32_t MASKREQ;
+  __IOM uint32_t SCANDATA;
+  __IOM uint32_t SCANFIFOCFG;
+  __IOM uint32_t SCANFIFODATA;
+  __IOM uint32_t SCANFIFOSTAT;
+  __IOM uint32_t SINGLE;
+  __IOM uint32_t SINGLEDATA;
+  __IOM uint32_t SINGLEFIFOCFG;
+  __IOM uint32_t SINGLEFIFODATA;
+  __IOM uint32_t SINGLEFIFOSTAT;
+  __IOM uint32_t STATUS;
+  __IOM uint32_t STMASK;
+  __IOM uint32_t TIMER;
+  __IOM uint32_t TRIGGER;
+  IADC_CfgTypeDef CFG[2];
+  IADC_ScanTypeDef SCANTABLE[16];
+  uint32_t RESERVED0[982];
+  __IOM uint32_t CMD_SET;
+  __IOM uint32_t CMPTHR_SET;
+  __IOM uint32_t CTRL_SET;
+  __IOM uint32_t EN_SET;
+  __IOM uint32_t IEN_SET;
+  __IOM uint32_t IF_SET;
+  __IOM uint32_t MASKREQ_SET;
+  __IOM uint32_t SCANDATA_SET;
+  __IOM uint32_t SCANFIFOCFG_SET;
+  __IOM uint32_t SCANFIFODATA_SET;
+  __IOM uint32_t SCANFIFOSTAT_SET;
+  __IOM uint32_t SINGLE_SET;
+  __IOM uint32_t SINGLEDATA_SET;
+  __IOM uint32_t SINGLEFIFOCFG_SET;
+  __IOM uint32_t SINGLEFIFODATA_SET;
+  __IOM uint32_t SINGLEFIFOSTAT_SET;
+  __IOM uint32_t STATUS_SET;
+  __IOM uint32_t STMASK_SET;
+  __IOM uint32_t TIMER_SET;
+  __IOM uint32_t TRIGGER_SET;
+  IADC_CfgTypeDef CFG_SET[2];
+  IADC_ScanTypeDef SCANTABLE_SET[16];
+  uint32_t RESERVED1[982];
+  __IOM uint32_t CMD_CLR;
+  __IOM uint32_t CMPTHR_CLR;
+  __IOM uint32_t CTRL_CLR;
+  __IOM uint32_t EN_CLR;
+  __IOM uint32_t IEN_CLR;
+  __IOM uint32_t IF_CLR;
+  __IOM uint32_t MASKREQ_CLR;
+  __IOM uint32_t SCANDATA_CLR;
+  __IOM uint32_t SCANFIFOCFG_CLR;
+  __IOM uint32_t SCANFIFODATA_CLR;
+  __IOM uint32_t SCANFIFOSTAT_CLR;
+  __IOM uint32_t SINGLE_CLR;
+  __IOM uint32_t SINGLEDATA_CLR;
+  __IOM uint32_t SINGLEFIFOCFG_CLR;
+  __IOM uint32_t SINGLEFIFODATA_CLR;
+  __IOM uint32_t SINGLEFIFOSTAT_CLR;
+  __IOM uint32_t STATUS_CLR;
+  __IOM uint32_t STMASK_CLR;
+  __IOM uint32_t TIMER_CLR;
+  __IOM uint32_t TRIGGER_CLR;
+  IADC_CfgTypeDef CFG_CLR[2];
+  IADC_ScanTypeDef SCANTABLE_CLR[16];
+  uint32_t RESERVED2[982];
+  __IOM uint32_t CMD_TGL;
+  __IOM uint32_t CMPTHR_TGL;
+  __IOM uint32_t CTRL_TGL;
+  __IOM uint32_t EN_TGL;
+  __IOM uint32_t IEN_TGL;
+  __IOM uint32_t IF_TGL;
+  __IOM uint32_t MASKREQ_TGL;
+  __IOM uint32_t SCANDATA_TGL;
+  __IOM uint32_t SCANFIFOCFG_TGL;
+  __IOM uint32_t SCANFIFODATA_TGL;
+  __IOM uint32_t SCANFIFOSTAT_TGL;
+  __IOM uint32_t SINGLE_TGL;
+  __IOM uint32_t SINGLEDATA_TGL;
+  __IOM uint32_t SINGLEFIFOCFG_TGL;
+  __IOM uint32_t SINGLEFIFODATA_TGL;
+  __IOM uint32_t SINGLEFIFOSTAT_TGL;
+  __IOM uint32_t STATUS_TGL;
+  __IOM uint32_t STMASK_TGL;
+  __IOM uint32_t TIMER_TGL;
+  __IOM uint32_t TRIGGER_TGL;
+  IADC_CfgTypeDef CFG_TGL[2];
+  IADC_ScanTypeDef SCANTABLE_TGL[16];
+  uint32_t RESERVED3[982];
+} IADC_TypeDef;
+
+/* Bit fields for IADC CMD */
+#define _IADC_CMD_RESETVALUE                              0x00000000UL
+#define _IADC_CMD_MASK                                    0x0000003FUL
+#define IADC_CMD_SCANSTART                                (0x1UL << 0)
+#define _IADC_CMD_SCANSTART_SHIFT                         0
+#define _IADC_CMD_SCANSTART_MASK                          0x1UL
+#define _IADC_CMD_SCANSTART_DEFAULT                       0x00000000UL
+#define IADC_CMD_SCANSTART_DEFAULT                        (_IADC_CMD_SCANSTART_DEFAULT << 0)
+#define IADC_CMD_SCANSTOP                                 (0x1UL << 1)
+#define _IADC_CMD_SCANSTOP_SHIFT                          1
+#define _IADC_CMD_SCANSTOP_MASK                           0x2UL
+#define _IADC_CMD_SCANSTOP_DEFAULT                        0x00000000UL
+#define IADC_CMD_SCANSTOP_DEFAULT                         (_IADC_CMD_SCANSTOP_DEFAULT << 1)
+#define IADC_CMD_SINGLESTART                              (0x1UL << 2)
+#define _IADC_CMD_SINGLESTART_SHIFT                       2
+#define _IADC_CMD_SINGLESTART_MASK                        0x4UL
+#define _IADC_CMD_SINGLESTART_DEFAULT                     0x00000000UL
+#define IADC_CMD_SINGLESTART_DEFAULT                      (_IADC_CMD_SINGLESTART_DEFAULT << 2)
+#define IADC_CMD_SINGLESTOP                               (0x1UL << 3)
+#define _IADC_CMD_SINGLESTOP_SHIFT                        3
+#define _IADC_CMD_SINGLESTOP_MASK                         0x8UL
+#define _IADC_CMD_SINGLESTOP_DEFAULT                      0x00000000UL
+#define IADC_CMD_SINGLESTOP_DEFAULT                       (_IADC_CMD_SINGLESTOP_DEFAULT << 3)
+#define IADC_CMD_TIMERDIS                                 (0x1UL << 4)
+#define _IADC_CMD_TIMERDIS_SHIFT                          4
+#define _IADC_CMD_TIMERDIS_MASK                           0x10UL
+#define _IADC_CMD_TIMERDIS_DEFAULT                        0x00000000UL
+#define IADC_CMD_TIMERDIS_DEFAULT                         (_IADC_CMD_TIMERDIS_DEFAULT << 4)
+#define IADC_CMD_TIMEREN                                  (0x1UL << 5)
+#define _IADC_CMD_TIMEREN_SHIFT                           5
+#define _IADC_CMD_TIMEREN_MASK                            0x20UL
+#define _IADC_CMD_TIMEREN_DEFAULT                         0x00000000UL
+#define IADC_CMD_TIMEREN_DEFAULT                          (_IADC_CMD_TIMEREN_DEFAULT << 5)
+
+/* Bit fields for IADC CMPTHR */
+#define _IADC_CMPTHR_RESETVALUE                           0x00000000UL
+#define _IADC_CMPTHR_MASK                                 0xFFFFFFFFUL
+#define _IADC_CMPTHR_ADLT_SHIFT                           0
+#define _IADC_CMPTHR_ADLT_MASK                            0xFFFFUL
+#define _IADC_CMPTHR_ADLT_DEFAULT                         0x00000000UL
+#define IADC_CMPTHR_ADLT_DEFAULT                          (_IADC_CMPTHR_ADLT_DEFAULT << 0)
+#define _IADC_CMPTHR_ADGT_SHIFT                           16
+#define _IADC_CMPTHR_ADGT_MASK                            0xFFFF0000UL
+#define _IADC_CMPTHR_ADGT_DEFAULT                         0x00000000UL
+#define IADC_CMPTHR_ADGT_DEFAULT                          (_IADC_CMPTHR_ADGT_DEFAULT << 16)
+
+/* Bit fields for IADC CTRL */
+#define _IADC_CTRL_RESETVALUE                             0x00000000UL
+#define _IADC_CTRL_MASK                                   0x707F3007UL
+#define IADC_CTRL_ADCCLKSUSPEND0                          (0x1UL << 0)
+#define _IADC_CTRL_ADCCLKSUSPEND0_SHIFT                   0
+#define _IADC_CTRL_ADCCLKSUSPEND0_MASK                    0x1UL
+#define _IADC_CTRL_ADCCLKSUSPEND0_DEFAULT                 0x00000000UL
+#define IADC_CTRL_ADCCLKSUSPEND0_DEFAULT                  (_IADC_CTRL_ADCCLKSUSPEND0_DEFAULT << 0)
+#define IADC_CTRL_ADCCLKSUSPEND1                          (0x1UL << 1)
+#define _IADC_CTRL_ADCCLKSUSPEND1_SHIFT                   1
+#define _IADC_CTRL_ADCCLKSUSPEND1_MASK                    0x2UL
+#define _IADC_CTRL_ADCCLKSUSPEND1_DEFAULT                 0x00000000UL
+#define IADC_CTRL_ADCCLKSUSPEND1_DEFAULT                  (_IADC_CTRL_ADCCLKSUSPEND1_DEFAULT << 1)
+#define IADC_CTRL_DBGHALT                                 (0x1UL << 2)
+#define _IADC_CTRL_DBGHALT_SHIFT                          2
+#define _IADC_CTRL_DBGHALT_MASK                           0x4UL
+#define _IADC_CTRL_DBGHALT_DEFAULT                        0x00000000UL
+#define IADC_CTRL_DBGHALT_DEFAULT                         (_IADC_CTRL_DBGHALT_DEFAULT << 2)
+#define _IADC_CTRL_WARMUPMODE_SHIFT                       12
+#define _IADC_CTRL_WARMUPMODE_MASK                        0x3000UL
+#define _IADC_CTRL_WARMUPMODE_DEFAULT                     0x00000000UL
+#define IADC_CTRL_WARMUPMODE_DEFAULT                      (_IADC_CTRL_WARMUPMODE_DEFAULT << 12)
+#define _IADC_CTRL_WARMUPMODE_NORMAL                      0x00000000UL
+#define _IADC_CTRL_WARMUPMODE_KEEPINSTANDBY               0x00000001UL
+#define _IADC_CTRL_WARMUPMODE_KEEPWARM                    0x00000002UL
+#define IADC_CTRL_WARMUPMODE_NORMAL                       (_IADC_CTRL_WARMUPMODE_NORMAL << 12)
+#define IADC_CTRL_WARMUPMODE_KEEPINSTANDBY                (_IADC_CTRL_WARMUPMODE_KEEPINSTANDBY << 12)
+#define IADC_CTRL_WARMUPMODE_KEEPWARM                     (_IADC_CTRL_WARMUPMODE_KEEPWARM << 12)
+#define _IADC_CTRL_TIMEBASE_SHIFT                         16
+#define _IADC_CTRL_TIMEBASE_MASK                          0x7F0000UL
+#define _IADC_CTRL_TIMEBASE_DEFAULT                       0x00000000UL
+#define IADC_CTRL_TIMEBASE_DEFAULT                        (_IADC_CTRL_TIMEBASE_DEFAULT << 16)
+#define _IADC_CTRL_HSCLKRATE_SHIFT                        28
+#define _IADC_CTRL_HSCLKRATE_MASK                         0x70000000UL
+#define _IADC_CTRL_HSCLKRATE_DEFAULT                      0x00000000UL
+#define IADC_CTRL_HSCLKRATE_DEFAULT                       (_IADC_CTRL_HSCLKRATE_DEFAULT << 28)
+#define _IADC_CTRL_HSCLKRATE_DIV1                         0x00000000UL
+#define _IADC_CTRL_HSCLKRATE_DIV2                         0x00000001UL
+#define _IADC_CTRL_HSCLKRATE_DIV3                         0x00000002UL
+#define _IADC_CTRL_HSCLKRATE_DIV4                         0x00000003UL
+#define IADC_CTRL_HSCLKRATE_DIV1                          (_IADC_CTRL_HSCLKRATE_DIV1 << 28)
+#define IADC_CTRL_HSCLKRATE_DIV2                          (_IADC_CTRL_HSCLKRATE_DIV2 << 28)
+#define IADC_CTRL_HSCLKRATE_DIV3                          (_IADC_CTRL_HSCLKRATE_DIV3 << 28)
+#define IADC_CTRL_HSCLKRATE_DIV4                          (_IADC_CTRL_HSCLKRATE_DIV4 << 28)
+
+/* Bit fields for IADC EN */
+#define _IADC_EN_RESETVALUE                               0x00000000UL
+#define _IADC_EN_MASK                                     0x00000001UL
+#define IADC_EN_EN                                        (0x1UL << 0)
+#define _IADC_EN_EN_SHIFT                                 0
+#define _IADC_EN_EN_MASK                                  0x1UL
+#define _IADC_EN_EN_DEFAULT                               0x00000000UL
+#define IADC_EN_EN_DEFAULT                                (_IADC_EN_EN_DEFAULT << 0)
+
+/* Bit fields for IADC IEN */
+#define _IADC_IEN_RESETVALUE                              0x00000000UL
+#define _IADC_IEN_MASK                                    0x000F038FUL
+#define IADC_IEN_SINGLEFIFODVL                            (0x1UL << 0)
+#define _IADC_IEN_SINGLEFIFODVL_SHIFT                     0
+#define _IADC_IEN_SINGLEFIFODVL_MASK                      0x1UL
+#define _IADC_IEN_SINGLEFIFODVL_DEFAULT                   0x00000000UL
+#define IADC_IEN_SINGLEFIFODVL_DEFAULT                    (_IADC_IEN_SINGLEFIFODVL_DEFAULT << 0)
+#define IADC_IEN_SCANFIFODVL                              (0x1UL << 1)
+#define _IADC_IEN_SCANFIFODVL_SHIFT                       1
+#define _IADC_IEN_SCANFIFODVL_MASK                        0x2UL
+#define _IADC_IEN_SCANFIFODVL_DEFAULT                     0x00000000UL
+#define IADC_IEN_SCANFIFODVL_DEFAULT                      (_IADC_IEN_SCANFIFODVL_DEFAULT << 1)
+#define IADC_IEN_SINGLECMP                                (0x1UL << 2)
+#define _IADC_IEN_SINGLECMP_SHIFT                         2
+#define _IADC_IEN_SINGLECMP_MASK                          0x4UL
+#define _IADC_IEN_SINGLECMP_DEFAULT                       0x00000000UL
+#define IADC_IEN_SINGLECMP_DEFAULT                        (_IADC_IEN_SINGLECMP_DEFAULT << 2)
+#define IADC_IEN_SCANCMP                                  (0x1UL << 3)
+#define _IADC_IEN_SCANCMP_SHIFT                           3
+#define _IADC_IEN_SCANCMP_MASK                            0x8UL
+#define _IADC_IEN_SCANCMP_DEFAULT                         0x00000000UL
+#define IADC_IEN_SCANCMP_DEFAULT                          (_IADC_IEN_SCANCMP_DEFAULT << 3)
+#define IADC_IEN_SCANENTRYDONE                            (0x1UL << 7)
+#define _IADC_IEN_SCANENTRYDONE_SHIFT                     7
+#define _IADC_IEN_SCANENTRYDONE_MASK                      0x80UL
+#define _IADC_IEN_SCANENTRYDONE_DEFAULT                   0x00000000UL
+#define IADC_IEN_SCANENTRYDONE_DEFAULT                    (_IADC_IEN_SCANENTRYDONE_DEFAULT << 7)
+#define IADC_IEN_SCANTABLEDONE                            (0x1UL << 8)
+#define _IADC_IEN_SCANTABLEDONE_SHIFT                     8
+#define _IADC_IEN_SCANTABLEDONE_MASK                      0x100UL
+#define _IADC_IEN_SCANTABLEDONE_DEFAULT                   0x00000000UL
+#define IADC_IEN_SCANTABLEDONE_DEFAULT                    (_IADC_IEN_SCANTABLEDONE_DEFAULT << 8)
+#define IADC_IEN_SINGLEDONE                               (0x1UL << 9)
+#define _IADC_IEN_SINGLEDONE_SHIFT                        9
+#define _IADC_IEN_SINGLEDONE_MASK                         0x200UL
+#define _IADC_IEN_SINGLEDONE_DEFAULT                      0x00000000UL
+#define IADC_IEN_SINGLEDONE_DEFAULT                       (_IADC_IEN_SINGLEDONE_DEFAULT << 9)
+#define IADC_IEN_SINGLEFIFOOF                             (0x1UL << 16)
+#define _IADC_IEN_SINGLEFIFOOF_SHIFT                      16
+#define _IADC_IEN_SINGLEFIFOOF_MASK                       0x10000UL
+#define _IADC_IEN_SINGLEFIFOOF_DEFAULT                    0x00000000UL
+#define IADC_IEN_SINGLEFIFOOF_DEFAULT                     (_IADC_IEN_SINGLEFIFOOF_DEFAULT << 16)
+#define IADC_IEN_SCANFIFOOF                               (0x1UL << 17)
+#define _IADC_IEN_SCANFIFOOF_SHIFT                        17
+#define _IADC_IEN_SCANFIFOOF_MASK                         0x20000UL
+#define _IADC_IEN_SCANFIFOOF_DEFAULT                      0x00000000UL
+#define IADC_IEN_SCANFIFOOF_DEFAULT                       (_IADC_IEN_SCANFIFOOF_DEFAULT << 17)
+#define IADC_IEN_SINGLEFIFOUF                             (0x1UL << 18)
+#define _IADC_IEN_SINGLEFIFOUF_SHIFT                      18
+#define _IADC_IEN_SINGLEFIFOUF_MASK                       0x40000UL
+#define _IADC_IEN_SINGLEFIFOUF_DEFAULT                    0x00000000UL
+#define IADC_IEN_SINGLEFIFOUF_DEFAULT                     (_IADC_IEN_SINGLEFIFOUF_DEFAULT << 18)
+#define IADC_IEN_SCANFIFOUF                               (0x1UL << 19)
+#define _IADC_IEN_SCANFIFOUF_SHIFT                        19
+#define _IADC_IEN_SCANFIFOUF_MASK                         0x80000UL
+#define _IADC_IEN_SCANFIFOUF_DEFAULT                      0x00000000UL
+#define IADC_IEN_SCANFIFOUF_DEFAULT                       (_IADC_IEN_SCANFIFOUF_DEFAULT << 19)
+
+/* Bit fields for IADC IF */
+#define _IADC_IF_RESETVALUE                               0x00000000UL
+#define _IADC_IF_MASK                                     0x000F038FUL
+#define IADC_IF_SINGLEFIFODVL                             (0x1UL << 0)
+#define _IADC_IF_SINGLEFIFODVL_SHIFT                      0
+#define _IADC_IF_SINGLEFIFODVL_MASK                       0x1UL
+#define _IADC_IF_SINGLEFIFODVL_DEFAULT                    0x00000000UL
+#define IADC_IF_SINGLEFIFODVL_DEFAULT                     (_IADC_IF_SINGLEFIFODVL_DEFAULT << 0)
+#define IADC_IF_SCANFIFODVL                               (0x1UL << 1)
+#define _IADC_IF_SCANFIFODVL_SHIFT                        1
+#define _IADC_IF_SCANFIFODVL_MASK                         0x2UL
+#define _IADC_IF_SCANFIFODVL_DEFAULT                      0x00000000UL
+#define IADC_IF_SCANFIFODVL_DEFAULT                       (_IADC_IF_SCANFIFODVL_DEFAULT << 1)
+#define IADC_IF_SINGLECMP                                 (0x1UL << 2)
+#define _IADC_IF_SINGLECMP_SHIFT                          2
+#define _IADC_IF_SINGLECMP_MASK                           0x4UL
+#define _IADC_IF_SINGLECMP_DEFAULT                        0x00000000UL
+#define IADC_IF_SINGLECMP_DEFAULT                         (_IADC_IF_SINGLECMP_DEFAULT << 2)
+#define IADC_IF_SCANCMP                                   (0x1UL << 3)
+#define _IADC_IF_SCANCMP_SHIFT                            3
+#define _IADC_IF_SCANCMP_MASK                             0x8UL
+#define _IADC_IF_SCANCMP_DEFAULT                          0x00000000UL
+#define IADC_IF_SCANCMP_DEFAULT                           (_IADC_IF_SCANCMP_DEFAULT << 3)
+#define IADC_IF_SCANENTRYDONE                             (0x1UL << 7)
+#define _IADC_IF_SCANENTRYDONE_SHIFT                      7
+#define _IADC_IF_SCANENTRYDONE_MASK                       0x80UL
+#define _IADC_IF_SCANENTRYDONE_DEFAULT                    0x00000000UL
+#define IADC_IF_SCANENTRYDONE_DEFAULT                     (_IADC_IF_SCANENTRYDONE_DEFAULT << 7)
+#define IADC_IF_SCANTABLEDONE                             (0x1UL << 8)
+#define _IADC_IF_SCANTABLEDONE_SHIFT                      8
+#define _IADC_IF_SCANTABLEDONE_MASK                       0x100UL
+#define _IADC_IF_SCANTABLEDONE_DEFAULT                    0x00000000UL
+#define IADC_IF_SCANTABLEDONE_DEFAULT                     (_IADC_IF_SCANTABLEDONE_DEFAULT << 8)
+#define IADC_IF_SINGLEDONE                                (0x1UL << 9)
+#define _IADC_IF_SINGLEDONE_SHIFT                         9
+#define _IADC_IF_SINGLEDONE_MASK                          0x200UL
+#define _IADC_IF_SINGLEDONE_DEFAULT                       0x00000000UL
+#define IADC_IF_SINGLEDONE_DEFAULT                        (_IADC_IF_SINGLEDONE_DEFAULT << 9)
+#define IADC_IF_SINGLEFIFOOF                              (0x1UL << 16)
+#define _IADC_IF_SINGLEFIFOOF_SHIFT                       16
+#define _IADC_IF_SINGLEFIFOOF_MASK                        0x10000UL
+#define _IADC_IF_SINGLEFIFOOF_DEFAULT                     0x00000000UL
+#define IADC_IF_SINGLEFIFOOF_DEFAULT                      (_IADC_IF_SINGLEFIFOOF_DEFAULT << 16)
+#define IADC_IF_SCANFIFOOF                                (0x1UL << 17)
+#define _IADC_IF_SCANFIFOOF_SHIFT                         17
+#define _IADC_IF_SCANFIFOOF_MASK                          0x20000UL
+#define _IADC_IF_SCANFIFOOF_DEFAULT                       0x00000000UL
+#define IADC_IF_SCANFIFOOF_DEFAULT                        (_IADC_IF_SCANFIFOOF_DEFAULT << 17)
+#define IADC_IF_SINGLEFIFOUF                              (0x1UL << 18)
+#define _IADC_IF_SINGLEFIFOUF_SHIFT                       18
+#define _IADC_IF_SINGLEFIFOUF_MASK                        0x40000UL
+#define _IADC_IF_SINGLEFIFOUF_DEFAULT                     0x00000000UL
+#define IADC_IF_SINGLEFIFOUF_DEFAULT                      (_IADC_IF_SINGLEFIFOUF_DEFAULT << 18)
+#define IADC_IF_SCANFIFOUF                                (0x1UL << 19)
+#define _IADC_IF_SCANFIFOUF_SHIFT                         19
+#define _IADC_IF_SCANFIFOUF_MASK                          0x80000UL
+#define _IADC_IF_SCANFIFOUF_DEFAULT                       0x00000000UL
+#define IADC_IF_SCANFIFOUF_DEFAULT                        (_IADC_IF_SCANFIFOUF_DEFAULT << 19)
+
+/* Bit fields for IADC MASKREQ */
+#define _IADC_MASKREQ_RESETVALUE                          0x00000000UL
+#define _IADC_MASKREQ_MASK                                0x000000FFUL
+#define _IADC_MASKREQ_MASKREQ_SHIFT                       0
+#define _IADC_MASKREQ_MASKREQ_MASK                        0xFFUL
+#define _IADC_MASKREQ_MASKREQ_DEFAULT                     0x00000000UL
+#define IADC_MASKREQ_MASKREQ_DEFAULT                      (_IADC_MASKREQ_MASKREQ_DEFAULT << 0)
+
+/* Bit fields for IADC SCANDATA */
+#define _IADC_SCANDATA_RESETVALUE                         0x00000000UL
+#define _IADC_SCANDATA_MASK                               0x00000000UL
+
+/* Bit fields for IADC SCANFIFOCFG */
+#define _IADC_SCANFIFOCFG_RESETVALUE                      0x00000000UL
+#define _IADC_SCANFIFOCFG_MASK                            0x0000013FUL
+#define _IADC_SCANFIFOCFG_ALIGNMENT_SHIFT                 0
+#define _IADC_SCANFIFOCFG_ALIGNMENT_MASK                  0x7UL
+#define _IADC_SCANFIFOCFG_ALIGNMENT_DEFAULT               0x00000000UL
+#define IADC_SCANFIFOCFG_ALIGNMENT_DEFAULT                (_IADC_SCANFIFOCFG_ALIGNMENT_DEFAULT << 0)
+#define _IADC_SCANFIFOCFG_ALIGNMENT_RIGHT12               0x00000000UL
+#define _IADC_SCANFIFOCFG_ALIGNMENT_RIGHT16               0x00000001UL
+#define _IADC_SCANFIFOCFG_ALIGNMENT_RIGHT20               0x00000002UL
+#define _IADC_SCANFIFOCFG_ALIGNMENT_LEFT12                0x00000003UL
+#define _IADC_SCANFIFOCFG_ALIGNMENT_LEFT16                0x00000004UL
+#define _IADC_SCANFIFOCFG_ALIGNMENT_LEFT20                0x00000005UL
+#define IADC_SCANFIFOCFG_ALIGNMENT_RIGHT12                (_IADC_SCANFIFOCFG_ALIGNMENT_RIGHT12 << 0)
+#define IADC_SCANFIFOCFG_ALIGNMENT_RIGHT16                (_IADC_SCANFIFOCFG_ALIGNMENT_RIGHT16 << 0)
+#define IADC_SCANFIFOCFG_ALIGNMENT_RIGHT20                (_IADC_SCANFIFOCFG_ALIGNMENT_RIGHT20 << 0)
+#define IADC_SCANFIFOCFG_ALIGNMENT_LEFT12                 (_IADC_SCANFIFOCFG_ALIGNMENT_LEFT12 << 0)
+#define IADC_SCANFIFOCFG_ALIGNMENT_LEFT16                 (_IADC_SCANFIFOCFG_ALIGNMENT_LEFT16 << 0)
+#define IADC_SCANFIFOCFG_ALIGNMENT_LEFT20                 (_IADC_SCANFIFOCFG_ALIGNMENT_LEFT20 << 0)
+#define IADC_SCANFIFOCFG_SHOWID                           (0x1UL << 3)
+#define _IADC_SCANFIFOCFG_SHOWID_SHIFT                    3
+#define _IADC_SCANFIFOCFG_SHOWID_MASK                     0x8UL
+#define _IADC_SCANFIFOCFG_SHOWID_DEFAULT                  0x00000000UL
+#define IADC_SCANFIFOCFG_SHOWID_DEFAULT                   (_IADC_SCANFIFOCFG_SHOWID_DEFAULT << 3)
+#define _IADC_SCANFIFOCFG_DVL_SHIFT                       4
+#define _IADC_SCANFIFOCFG_DVL_MASK                        0x30UL
+#define _IADC_SCANFIFOCFG_DVL_DEFAULT                     0x00000000UL
+#define IADC_SCANFIFOCFG_DVL_DEFAULT                      (_IADC_SCANFIFOCFG_DVL_DEFAULT << 4)
+#define IADC_SCANFIFOCFG_DMAWUFIFOSCAN                    (0x1UL << 8)
+#define _IADC_SCANFIFOCFG_DMAWUFIFOSCAN_SHIFT             8
+#define _IADC_SCANFIFOCFG_DMAWUFIFOSCAN_MASK              0x100UL
+#define _IADC_SCANFIFOCFG_DMAWUFIFOSCAN_DEFAULT           0x00000000UL
+#define IADC_SCANFIFOCFG_DMAWUFIFOSCAN_DEFAULT            (_IADC_SCANFIFOCFG_DMAWUFIFOSCAN_DEFAULT << 8)
+
+/* Bit fields for IADC SCANFIFODATA */
+#define _IADC_SCANFIFODATA_RESETVALUE                     0x00000000UL
+#define _IADC_SCANFIFODATA_MASK                           0x00000000UL
+
+/* Bit fields for IADC SCANFIFOSTAT */
+#define _IADC_SCANFIFOSTAT_RESETVALUE                     0x00000000UL
+#define _IADC_SCANFIFOSTAT_MASK                           0x0000000FUL
+#define _IADC_SCANFIFOSTAT_FIFOREADCNT_SHIFT              0
+#define _IADC_SCANFIFOSTAT_FIFOREADCNT_MASK               0xFUL
+#define _IADC_SCANFIFOSTAT_FIFOREADCNT_DEFAULT            0x00000000UL
+#define IADC_SCANFIFOSTAT_FIFOREADCNT_DEFAULT             (_IADC_SCANFIFOSTAT_FIFOREADCNT_DEFAULT << 0)
+
+/* Bit fields for IADC SINGLE */
+#define _IADC_SINGLE_RESETVALUE                           0x00000000UL
+#define _IADC_SINGLE_MASK                                 0x0003FFFFUL
+#define _IADC_SINGLE_PINNEG_SHIFT                         0
+#define _IADC_SINGLE_PINNEG_MASK                          0xFUL
+#define _IADC_SINGLE_PINNEG_DEFAULT                       0x00000000UL
+#define IADC_SINGLE_PINNEG_DEFAULT                        (_IADC_SINGLE_PINNEG_DEFAULT << 0)
+#define _IADC_SINGLE_PORTNEG_SHIFT                        4
+#define _IADC_SINGLE_PORTNEG_MASK                         0xF0UL
+#define _IADC_SINGLE_PORTNEG_DEFAULT                      0x00000000UL
+#define IADC_SINGLE_PORTNEG_DEFAULT                       (_IADC_SINGLE_PORTNEG_DEFAULT << 4)
+#define _IADC_SINGLE_PORTNEG_GND                          0x00000000UL
+#define _IADC_SINGLE_PORTNEG_PADREFNEG                    0x00000006UL
+#define _IADC_SINGLE_PORTNEG_PORTA                        0x00000008UL
+#define _IADC_SINGLE_PORTNEG_PORTB                        0x00000009UL
+#define _IADC_SINGLE_PORTNEG_PORTC                        0x0000000AUL
+#define _IADC_SINGLE_PORTNEG_PORTD                        0x0000000BUL
+#define IADC_SINGLE_PORTNEG_GND                           (_IADC_SINGLE_PORTNEG_GND << 4)
+#define IADC_SINGLE_PORTNEG_PADREFNEG                     (_IADC_SINGLE_PORTNEG_PADREFNEG << 4)
+#define IADC_SINGLE_PORTNEG_PORTA                         (_IADC_SINGLE_PORTNEG_PORTA << 4)
+#define IADC_SINGLE_PORTNEG_PORTB                         (_IADC_SINGLE_PORTNEG_PORTB << 4)
+#define IADC_SINGLE_PORTNEG_PORTC                         (_IADC_SINGLE_PORTNEG_PORTC << 4)
+#define IADC_SINGLE_PORTNEG_PORTD                         (_IADC_SINGLE_PORTNEG_PORTD << 4)
+#define _IADC_SINGLE_PINPOS_SHIFT                         8
+#define _IADC_SINGLE_PINPOS_MASK                          0xF00UL
+#define _IADC_SINGLE_PINPOS_DEFAULT                       0x00000000UL
+#define IADC_SINGLE_PINPOS_DEFAULT                        (_IADC_SINGLE_PINPOS_DEFAULT << 8)
+#define _IADC_SINGLE_PORTPOS_SHIFT                        12
+#define _IADC_SINGLE_PORTPOS_MASK                         0xF000UL
+#define _IADC_SINGLE_PORTPOS_DEFAULT                      0x00000000UL
+#define IADC_SINGLE_PORTPOS_DEFAULT                       (_IADC_SINGLE_PORTPOS_DEFAULT << 12)
+#define _IADC_SINGLE_PORTPOS_GND                          0x00000000UL
+#define _IADC_SINGLE_PORTPOS_SUPPLY                       0x00000001UL
+#define _IADC_SINGLE_PORTPOS_PADREFPOS                    0x00000006UL
+#define _IADC_SINGLE_PORTPOS_PORTA                        0x00000008UL
+#define _IADC_SINGLE_PORTPOS_PORTB                        0x00000009UL
+#define _IADC_SINGLE_PORTPOS_PORTC                        0x0000000AUL
+#define _IADC_SINGLE_PORTPOS_PORTD                        0x0000000BUL
+#define IADC_SINGLE_PORTPOS_GND                           (_IADC_SINGLE_PORTPOS_GND << 12)
+#define IADC_SINGLE_PORTPOS_SUPPLY                        (_IADC_SINGLE_PORTPOS_SUPPLY << 12)
+#define IADC_SINGLE_PORTPOS_PADREFPOS                     (_IADC_SINGLE_PORTPOS_PADREFPOS << 12)
+#define IADC_SINGLE_PORTPOS_PORTA                         (_IADC_SINGLE_PORTPOS_PORTA << 12)
+#define IADC_SINGLE_PORTPOS_PORTB                         (_IADC_SINGLE_PORTPOS_PORTB << 12)
+#define IADC_SINGLE_PORTPOS_PORTC                         (_IADC_SINGLE_PORTPOS_PORTC << 12)
+#define IADC_SINGLE_PORTPOS_PORTD                         (_IADC_SINGLE_PORTPOS_PORTD << 12)
+#define IADC_SINGLE_CFG                                   (0x1UL << 16)
+#define _IADC_SINGLE_CFG_SHIFT                            16
+#define _IADC_SINGLE_CFG_MASK                             0x10000UL
+#define _IADC_SINGLE_CFG_DEFAULT                          0x00000000UL
+#define IADC_SINGLE_CFG_DEFAULT                           (_IADC_SINGLE_CFG_DEFAULT << 16)
+#define IADC_SINGLE_CMP                                   (0x1UL << 17)
+#define _IADC_SINGLE_CMP_SHIFT                            17
+#define _IADC_SINGLE_CMP_MASK                             0x20000UL
+#define _IADC_SINGLE_CMP_DEFAULT                          0x00000000UL
+#define IADC_SINGLE_CMP_DEFAULT                           (_IADC_SINGLE_CMP_DEFAULT << 17)
+
+/* Bit fields for IADC SINGLEDATA */
+#define _IADC_SINGLEDATA_RESETVALUE                       0x00000000UL
+#define _IADC_SINGLEDATA_MASK                             0x00000000UL
+
+/* Bit fields for IADC SINGLEFIFOCFG */
+#define _IADC_SINGLEFIFOCFG_RESETVALUE                    0x00000000UL
+#define _IADC_SINGLEFIFOCFG_MASK                          0x0000013FUL
+#define _IADC_SINGLEFIFOCFG_ALIGNMENT_SHIFT               0
+#define _IADC_SINGLEFIFOCFG_ALIGNMENT_MASK                0x7UL
+#define _IADC_SINGLEFIFOCFG_ALIGNMENT_DEFAULT             0x00000000UL
+#define IADC_SINGLEFIFOCFG_ALIGNMENT_DEFAULT              (_IADC_SINGLEFIFOCFG_ALIGNMENT_DEFAULT << 0)
+#define _IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT12             0x00000000UL
+#define _IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT16             0x00000001UL
+#define _IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT20             0x00000002UL
+#define _IADC_SINGLEFIFOCFG_ALIGNMENT_LEFT12              0x00000003UL
+#define _IADC_SINGLEFIFOCFG_ALIGNMENT_LEFT16              0x00000004UL
+#define _IADC_SINGLEFIFOCFG_ALIGNMENT_LEFT20              0x00000005UL
+#define IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT12              (_IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT12 << 0)
+#define IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT16              (_IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT16 << 0)
+#define IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT20              (_IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT20 << 0)
+#define IADC_SINGLEFIFOCFG_ALIGNMENT_LEFT12               (_IADC_SINGLEFIFOCFG_ALIGNMENT_LEFT12 << 0)
+#define IADC_SINGLEFIFOCFG_ALIGNMENT_LEFT16               (_IADC_SINGLEFIFOCFG_ALIGNMENT_LEFT16 << 0)
+#define IADC_SINGLEFIFOCFG_ALIGNMENT_LEFT20               (_IADC_SINGLEFIFOCFG_ALIGNMENT_LEFT20 << 0)
+#define IADC_SINGLEFIFOCFG_SHOWID                         (0x1UL << 3)
+#define _IADC_SINGLEFIFOCFG_SHOWID_SHIFT                  3
+#define _IADC_SINGLEFIFOCFG_SHOWID_MASK                   0x8UL
+#define _IADC_SINGLEFIFOCFG_SHOWID_DEFAULT                0x00000000UL
+#define IADC_SINGLEFIFOCFG_SHOWID_DEFAULT                 (_IADC_SINGLEFIFOCFG_SHOWID_DEFAULT << 3)
+#define _IADC_SINGLEFIFOCFG_DVL_SHIFT                     4
+#define _IADC_SINGLEFIFOCFG_DVL_MASK                      0x30UL
+#define _IADC_SINGLEFIFOCFG_DVL_DEFAULT                   0x00000000UL
+#define IADC_SINGLEFIFOCFG_DVL_DEFAULT                    (_IADC_SINGLEFIFOCFG_DVL_DEFAULT << 4)
+#define IADC_SINGLEFIFOCFG_DMAWUFIFOSINGLE                (0x1UL << 8)
+#define _IADC_SINGLEFIFOCFG_DMAWUFIFOSINGLE_SHIFT         8
+#define _IADC_SINGLEFIFOCFG_DMAWUFIFOSINGLE_MASK          0x100UL
+#define _IADC_SINGLEFIFOCFG_DMAWUFIFOSINGLE_DEFAULT       0x00000000UL
+#define IADC_SINGLEFIFOCFG_DMAWUFIFOSINGLE_DEFAULT        (_IADC_SINGLEFIFOCFG_DMAWUFIFOSINGLE_DEFAULT << 8)
+
+/* Bit fields for IADC SINGLEFIFODATA */
+#define _IADC_SINGLEFIFODATA_RESETVALUE                   0x00000000UL
+#define _IADC_SINGLEFIFODATA_MASK                         0x00000000UL
+
+/* Bit fields for IADC SINGLEFIFOSTAT */
+#define _IADC_SINGLEFIFOSTAT_RESETVALUE                   0x00000000UL
+#define _IADC_SINGLEFIFOSTAT_MASK                         0x0000000FUL
+#define _IADC_SINGLEFIFOSTAT_FIFOREADCNT_SHIFT            0
+#define _IADC_SINGLEFIFOSTAT_FIFOREADCNT_MASK             0xFUL
+#define _IADC_SINGLEFIFOSTAT_FIFOREADCNT_DEFAULT          0x00000000UL
+#define IADC_SINGLEFIFOSTAT_FIFOREADCNT_DEFAULT           (_IADC_SINGLEFIFOSTAT_FIFOREADCNT_DEFAULT << 0)
+
+/* Bit fields for IADC STATUS */
+#define _IADC_STATUS_RESETVALUE                           0x00000000UL
+#define _IADC_STATUS_MASK                                 0x000001FFUL
+#define IADC_STATUS_CONVERTING                            (0x1UL << 0)
+#define _IADC_STATUS_CONVERTING_SHIFT                     0
+#define _IADC_STATUS_CONVERTING_MASK                      0x1UL
+#define _IADC_STATUS_CONVERTING_DEFAULT                   0x00000000UL
+#define IADC_STATUS_CONVERTING_DEFAULT                    (_IADC_STATUS_CONVERTING_DEFAULT << 0)
+#define IADC_STATUS_MASKREQWRITEPENDING                   (0x1UL << 1)
+#define _IADC_STATUS_MASKREQWRITEPENDING_SHIFT            1
+#define _IADC_STATUS_MASKREQWRITEPENDING_MASK             0x2UL
+#define _IADC_STATUS_MASKREQWRITEPENDING_DEFAULT          0x00000000UL
+#define IADC_STATUS_MASKREQWRITEPENDING_DEFAULT           (_IADC_STATUS_MASKREQWRITEPENDING_DEFAULT << 1)
+#define IADC_STATUS_SCANFIFODV                            (0x1UL << 2)
+#define _IADC_STATUS_SCANFIFODV_SHIFT                     2
+#define _IADC_STATUS_SCANFIFODV_MASK                      0x4UL
+#define _IADC_STATUS_SCANFIFODV_DEFAULT                   0x00000000UL
+#define IADC_STATUS_SCANFIFODV_DEFAULT                    (_IADC_STATUS_SCANFIFODV_DEFAULT << 2)
+#define IADC_STATUS_SCANQUEUEPENDING                      (0x1UL << 3)
+#define _IADC_STATUS_SCANQUEUEPENDING_SHIFT               3
+#define _IADC_STATUS_SCANQUEUEPENDING_MASK                0x8UL
+#define _IADC_STATUS_SCANQUEUEPENDING_DEFAULT             0x00000000UL
+#define IADC_STATUS_SCANQUEUEPENDING_DEFAULT              (_IADC_STATUS_SCANQUEUEPENDING_DEFAULT << 3)
+#define IADC_STATUS_SINGLEFIFODV                          (0x1UL << 4)
+#define _IADC_STATUS_SINGLEFIFODV_SHIFT                   4
+#define _IADC_STATUS_SINGLEFIFODV_MASK                    0x10UL
+#define _IADC_STATUS_SINGLEFIFODV_DEFAULT                 0x00000000UL
+#define IADC_STATUS_SINGLEFIFODV_DEFAULT                  (_IADC_STATUS_SINGLEFIFODV_DEFAULT << 4)
+#define IADC_STATUS_SINGLEQUEUEPENDING                    (0x1UL << 5)
+#define _IADC_STATUS_SINGLEQUEUEPENDING_SHIFT             5
+#define _IADC_STATUS_SINGLEQUEUEPENDING_MASK              0x20UL
+#define _IADC_STATUS_SINGLEQUEUEPENDING_DEFAULT           0x00000000UL
+#define IADC_STATUS_SINGLEQUEUEPENDING_DEFAULT            (_IADC_STATUS_SINGLEQUEUEPENDING_DEFAULT << 5)
+#define IADC_STATUS_SINGLEWRITEPENDING                    (0x1UL << 6)
+#define _IADC_STATUS_SINGLEWRITEPENDING_SHIFT             6
+#define _IADC_STATUS_SINGLEWRITEPENDING_MASK              0x40UL
+#define _IADC_STATUS_SINGLEWRITEPENDING_DEFAULT           0x00000000UL
+#define IADC_STATUS_SINGLEWRITEPENDING_DEFAULT            (_IADC_STATUS_SINGLEWRITEPENDING_DEFAULT << 6)
+#define IADC_STATUS_SYNCBUSY                              (0x1UL << 7)
+#define _IADC_STATUS_SYNCBUSY_SHIFT                       7
+#define _IADC_STATUS_SYNCBUSY_MASK                        0x80UL
+#define _IADC_STATUS_SYNCBUSY_DEFAULT                     0x00000000UL
+#define IADC_STATUS_SYNCBUSY_DEFAULT                      (_IADC_STATUS_SYNCBUSY_DEFAULT << 7)
+#define IADC_STATUS_TIMERACTIVE                           (0x1UL << 8)
+#define _IADC_STATUS_TIMERACTIVE_SHIFT                    8
+#define _IADC_STATUS_TIMERACTIVE_MASK                     0x100UL
+#define _IADC_STATUS_TIMERACTIVE_DEFAULT                  0x00000000UL
+#define IADC_STATUS_TIMERACTIVE_DEFAULT                   (_IADC_STATUS_TIMERACTIVE_DEFAULT << 8)
+
+/* Bit fields for IADC STMASK */
+#define _IADC_STMASK_RESETVALUE                           0x00000000UL
+#define _IADC_STMASK_MASK                                 0x00000001UL
+#define IADC_STMASK_STMASK                                (0x1UL << 0)
+#define _IADC_STMASK_STMASK_SHIFT                         0
+#define _IADC_STMASK_STMASK_MASK                          0x1UL
+#define _IADC_STMASK_STMASK_DEFAULT                       0x00000000UL
+#define IADC_STMASK_STMASK_DEFAULT                        (_IADC_STMASK_STMASK_DEFAULT << 0)
+
+/* Bit fields for IADC TIMER */
+#define _IADC_TIMER_RESETVALUE                            0x00000000UL
+#define _IADC_TIMER_MASK                                  0x0000FFFFUL
+#define _IADC_TIMER_TIMER_SHIFT                           0
+#define _IADC_TIMER_TIMER_MASK                            0xFFFFUL
+#define _IADC_TIMER_TIMER_DEFAULT                         0x00000000UL
+#define IADC_TIMER_TIMER_DEFAULT                          (_IADC_TIMER_TIMER_DEFAULT << 0)
+
+/* Bit fields for IADC TRIGGER */
+#define _IADC_TRIGGER_RESETVALUE                          0x00000000UL
+#define _IADC_TRIGGER_MASK                                0x00011717UL
+#define _IADC_TRIGGER_SCANTRIGSEL_SHIFT                   0
+#define _IADC_TRIGGER_SCANTRIGSEL_MASK                    0x7UL
+#define _IADC_TRIGGER_SCANTRIGSEL_DEFAULT                 0x00000000UL
+#define IADC_TRIGGER_SCANTRIGSEL_DEFAULT                  (_IADC_TRIGGER_SCANTRIGSEL_DEFAULT << 0)
+#define _IADC_TRIGGER_SCANTRIGSEL_IMMEDIATE               0x00000000UL
+#define _IADC_TRIGGER_SCANTRIGSEL_TIMER                   0x00000001UL
+#define _IADC_TRIGGER_SCANTRIGSEL_PRSCLKGRP               0x00000002UL
+#define _IADC_TRIGGER_SCANTRIGSEL_PRSPOS                  0x00000003UL
+#define _IADC_TRIGGER_SCANTRIGSEL_PRSNEG                  0x00000004UL
+#define IADC_TRIGGER_SCANTRIGSEL_IMMEDIATE                (_IADC_TRIGGER_SCANTRIGSEL_IMMEDIATE << 0)
+#define IADC_TRIGGER_SCANTRIGSEL_TIMER                    (_IADC_TRIGGER_SCANTRIGSEL_TIMER << 0)
+#define IADC_TRIGGER_SCANTRIGSEL_PRSCLKGRP                (_IADC_TRIGGER_SCANTRIGSEL_PRSCLKGRP << 0)
+#define IADC_TRIGGER_SCANTRIGSEL_PRSPOS                   (_IADC_TRIGGER_SCANTRIGSEL_PRSPOS << 0)
+#define IADC_TRIGGER_SCANTRIGSEL_PRSNEG                   (_IADC_TRIGGER_SCANTRIGSEL_PRSNEG << 0)
+#define IADC_TRIGGER_SCANTRIGACTION                       (0x1UL << 4)
+#define _IADC_TRIGGER_SCANTRIGACTION_SHIFT                4
+#define _IADC_TRIGGER_SCANTRIGACTION_MASK                 0x10UL
+#define _IADC_TRIGGER_SCANTRIGACTION_DEFAULT              0x00000000UL
+#define IADC_TRIGGER_SCANTRIGACTION_DEFAULT               (_IADC_TRIGGER_SCANTRIGACTION_DEFAULT << 4)
+#define _IADC_TRIGGER_SCANTRIGACTION_ONCE                 0x00000000UL
+#define _IADC_TRIGGER_SCANTRIGACTION_CONTINUOUS           0x00000001UL
+#define IADC_TRIGGER_SCANTRIGACTION_ONCE                  (_IADC_TRIGGER_SCANTRIGACTION_ONCE << 4)
+#define IADC_TRIGGER_SCANTRIGACTION_CONTINUOUS            (_IADC_TRIGGER_SCANTRIGACTION_CONTINUOUS << 4)
+#define _IADC_TRIGGER_SINGLETRIGSEL_SHIFT                 8
+#define _IADC_TRIGGER_SINGLETRIGSEL_MASK                  0x700UL
+#define _IADC_TRIGGER_SINGLETRIGSEL_DEFAULT               0x00000000UL
+#define IADC_TRIGGER_SINGLETRIGSEL_DEFAULT                (_IADC_TRIGGER_SINGLETRIGSEL_DEFAULT << 8)
+#define _IADC_TRIGGER_SINGLETRIGSEL_IMMEDIATE             0x00000000UL
+#define _IADC_TRIGGER_SINGLETRIGSEL_TIMER                 0x00000001UL
+#define _IADC_TRIGGER_SINGLETRIGSEL_PRSCLKGRP             0x00000002UL
+#define _IADC_TRIGGER_SINGLETRIGSEL_PRSPOS                0x00000003UL
+#define _IADC_TRIGGER_SINGLETRIGSEL_PRSNEG                0x00000004UL
+#define IADC_TRIGGER_SINGLETRIGSEL_IMMEDIATE              (_IADC_TRIGGER_SINGLETRIGSEL_IMMEDIATE << 8)
+#define IADC_TRIGGER_SINGLETRIGSEL_TIMER                  (_IADC_TRIGGER_SINGLETRIGSEL_TIMER << 8)
+#define IADC_TRIGGER_SINGLETRIGSEL_PRSCLKGRP              (_IADC_TRIGGER_SINGLETRIGSEL_PRSCLKGRP << 8)
+#define IADC_TRIGGER_SINGLETRIGSEL_PRSPOS                 (_IADC_TRIGGER_SINGLETRIGSEL_PRSPOS << 8)
+#define IADC_TRIGGER_SINGLETRIGSEL_PRSNEG                 (_IADC_TRIGGER_SINGLETRIGSEL_PRSNEG << 8)
+#define IADC_TRIGGER_SINGLETRIGACTION                     (0x1UL << 12)
+#define _IADC_TRIGGER_SINGLETRIGACTION_SHIFT              12
+#define _IADC_TRIGGER_SINGLETRIGACTION_MASK               0x1000UL
+#define _IADC_TRIGGER_SINGLETRIGACTION_DEFAULT            0x00000000UL
+#define IADC_TRIGGER_SINGLETRIGACTION_DEFAULT             (_IADC_TRIGGER_SINGLETRIGACTION_DEFAULT << 12)
+#define _IADC_TRIGGER_SINGLETRIGACTION_ONCE               0x00000000UL
+#define _IADC_TRIGGER_SINGLETRIGACTION_CONTINUOUS         0x00000001UL
+#define IADC_TRIGGER_SINGLETRIGACTION_ONCE                (_IADC_TRIGGER_SINGLETRIGACTION_ONCE << 12)
+#define IADC_TRIGGER_SINGLETRIGACTION_CONTINUOUS          (_IADC_TRIGGER_SINGLETRIGACTION_CONTINUOUS << 12)
+#define IADC_TRIGGER_SINGLETAILGATE                       (0x1UL << 16)
+#define _IADC_TRIGGER_SINGLETAILGATE_SHIFT                16
+#define _IADC_TRIGGER_SINGLETAILGATE_MASK                 0x10000UL
+#define _IADC_TRIGGER_SINGLETAILGATE_DEFAULT              0x00000000UL
+#define IADC_TRIGGER_SINGLETAILGATE_DEFAULT               (_IADC_TRIGGER_SINGLETAILGATE_DEFAULT << 16)
+
+/* Bit fields for IADC CFG */
+#define _IADC_CFG_RESETVALUE                              0x00000000UL
+#define _IADC_CFG_MASK                                    0x3007701FUL
+#define _IADC_CFG_ADCMODE_SHIFT                           0
+#define _IADC_CFG_ADCMODE_MASK                            0x3UL
+#define _IADC_CFG_ADCMODE_DEFAULT                         0x00000000UL
+#define IADC_CFG_ADCMODE_DEFAULT                          (_IADC_CFG_ADCMODE_DEFAULT << 0)
+#define _IADC_CFG_ADCMODE_NORMAL                          0x00000000UL
+#define _IADC_CFG_ADCMODE_HIGHSPEED                       0x00000001UL
+#define _IADC_CFG_ADCMODE_HIGHACCURACY                    0x00000002UL
+#define IADC_CFG_ADCMODE_NORMAL                           (_IADC_CFG_ADCMODE_NORMAL << 0)
+#define IADC_CFG_ADCMODE_HIGHSPEED                        (_IADC_CFG_ADCMODE_HIGHSPEED << 0)
+#define IADC_CFG_ADCMODE_HIGHACCURACY                     (_IADC_CFG_ADCMODE_HIGHACCURACY << 0)
+#define _IADC_CFG_OSRHS_SHIFT                             2
+#define _IADC_CFG_OSRHS_MASK                              0x1CUL
+#define _IADC_CFG_OSRHS_DEFAULT                           0x00000000UL
+#define IADC_CFG_OSRHS_DEFAULT                            (_IADC_CFG_OSRHS_DEFAULT << 2)
+#define _IADC_CFG_OSRHS_HISPD2                            0x00000000UL
+#define _IADC_CFG_OSRHS_HISPD4                            0x00000001UL
+#define _IADC_CFG_OSRHS_HISPD8                            0x00000002UL
+#define _IADC_CFG_OSRHS_HISPD16                           0x00000003UL
+#define _IADC_CFG_OSRHS_HISPD32                           0x00000004UL
+#define _IADC_CFG_OSRHS_HISPD64                           0x00000005UL
+#define IADC_CFG_OSRHS_HISPD2                             (_IADC_CFG_OSRHS_HISPD2 << 2)
+#define IADC_CFG_OSRHS_HISPD4                             (_IADC_CFG_OSRHS_HISPD4 << 2)
+#define IADC_CFG_OSRHS_HISPD8                             (_IADC_CFG_OSRHS_HISPD8 << 2)
+#define IADC_CFG_OSRHS_HISPD16                            (_IADC_CFG_OSRHS_HISPD16 << 2)
+#define IADC_CFG_OSRHS_HISPD32                            (_IADC_CFG_OSRHS_HISPD32 << 2)
+#define IADC_CFG_OSRHS_HISPD64                            (_IADC_CFG_OSRHS_HISPD64 << 2)
+#define _IADC_CFG_ANALOGGAIN_SHIFT                        12
+#define _IADC_CFG_ANALOGGAIN_MASK                         0x7000UL
+#define _IADC_CFG_ANALOGGAIN_DEFAULT                      0x00000000UL
+#define IADC_CFG_ANALOGGAIN_DEFAULT                       (_IADC_CFG_ANALOGGAIN_DEFAULT << 12)
+#define _IADC_CFG_ANALOGGAIN_ANAGAIN0P5                   0x00000000UL
+#define _IADC_CFG_ANALOGGAIN_ANAGAIN1                     0x00000001UL
+#define _IADC_CFG_ANALOGGAIN_ANAGAIN2                     0x00000002UL
+#define _IADC_CFG_ANALOGGAIN_ANAGAIN3                     0x00000003UL
+#define _IADC_CFG_ANALOGGAIN_ANAGAIN4                     0x00000004UL
+#define IADC_CFG_ANALOGGAIN_ANAGAIN0P5                    (_IADC_CFG_ANALOGGAIN_ANAGAIN0P5 << 12)
+#define IADC_CFG_ANALOGGAIN_ANAGAIN1                      (_IADC_CFG_ANALOGGAIN_ANAGAIN1 << 12)
+#define IADC_CFG_ANALOGGAIN_ANAGAIN2                      (_IADC_CFG_ANALOGGAIN_ANAGAIN2 << 12)
+#define IADC_CFG_ANALOGGAIN_ANAGAIN3                      (_IADC_CFG_ANALOGGAIN_ANAGAIN3 << 12)
+#define IADC_CFG_ANALOGGAIN_ANAGAIN4                      (_IADC_CFG_ANALOGGAIN_ANAGAIN4 << 12)
+#define _IADC_CFG_REFSEL_SHIFT                            16
+#define _IADC_CFG_REFSEL_MASK                             0x70000UL
+#define _IADC_CFG_REFSEL_DEFAULT                          0x00000000UL
+#define IADC_CFG_REFSEL_DEFAULT                           (_IADC_CFG_REFSEL_DEFAULT << 16)
+#define _IADC_CFG_REFSEL_VBGR                             0x00000000UL
+#define _IADC_CFG_REFSEL_VREF                             0x00000001UL
+#define _IADC_CFG_REFSEL_VDDX                             0x00000002UL
+#define _IADC_CFG_REFSEL_VDDX0P8BUF                       0x00000003UL
+#define IADC_CFG_REFSEL_VBGR                              (_IADC_CFG_REFSEL_VBGR << 16)
+#define IADC_CFG_REFSEL_VREF                              (_IADC_CFG_REFSEL_VREF << 16)
+#define IADC_CFG_REFSEL_VDDX                              (_IADC_CFG_REFSEL_VDDX << 16)
+#define IADC_CFG_REFSEL_VDDX0P8BUF                        (_IADC_CFG_REFSEL_VDDX0P8BUF << 16)
+#define _IADC_CFG_TWOSCOMPL_SHIFT                         28
+#define _IADC_CFG_TWOSCOMPL_MASK                          0x30000000UL
+#define _IADC_CFG_TWOSCOMPL_DEFAULT                       0x00000000UL
+#define IADC_CFG_TWOSCOMPL_DEFAULT                        (_IADC_CFG_TWOSCOMPL_DEFAULT << 28)
+#define _IADC_CFG_TWOSCOMPL_AUTO                          0x00000000UL
+#define _IADC_CFG_TWOSCOMPL_FORCEUNIPOLAR                 0x00000001UL
+#define _IADC_CFG_TWOSCOMPL_FORCEBIPOLAR                  0x00000002UL
+#define IADC_CFG_TWOSCOMPL_AUTO                           (_IADC_CFG_TWOSCOMPL_AUTO << 28)
+#define IADC_CFG_TWOSCOMPL_FORCEUNIPOLAR                  (_IADC_CFG_TWOSCOMPL_FORCEUNIPOLAR << 28)
+#define IADC_CFG_TWOSCOMPL_FORCEBIPOLAR                   (_IADC_CFG_TWOSCOMPL_FORCEBIPOLAR << 28)
+
+/* Bit fields for IADC SCALE */
+#define _IADC_SCALE_RESETVALUE                            0x00000000UL
+#define _IADC_SCALE_MASK                                  0xFFFFFFFFUL
+#define _IADC_SCALE_OFFSET_SHIFT                          0
+#define _IADC_SCALE_OFFSET_MASK                           0x3FFFFUL
+#define _IADC_SCALE_OFFSET_DEFAULT                        0x00000000UL
+#define IADC_SCALE_OFFSET_DEFAULT                         (_IADC_SCALE_OFFSET_DEFAULT << 0)
+#define _IADC_SCALE_GAIN13LSB_SHIFT                       18
+#define _IADC_SCALE_GAIN13LSB_MASK                        0x7FFC0000UL
+#define _IADC_SCALE_GAIN13LSB_DEFAULT                     0x00000000UL
+#define IADC_SCALE_GAIN13LSB_DEFAULT                      (_IADC_SCALE_GAIN13LSB_DEFAULT << 18)
+#define IADC_SCALE_GAIN3MSB                               (0x1UL << 31)
+#define _IADC_SCALE_GAIN3MSB_SHIFT                        31
+#define _IADC_SCALE_GAIN3MSB_MASK                         0x80000000UL
+#define _IADC_SCALE_GAIN3MSB_DEFAULT                      0x00000000UL
+#define IADC_SCALE_GAIN3MSB_DEFAULT                       (_IADC_SCALE_GAIN3MSB_DEFAULT << 31)
+#define _IADC_SCALE_GAIN3MSB_GAIN011                      0x00000000UL
+#define _IADC_SCALE_GAIN3MSB_GAIN100                      0x00000001UL
+#define IADC_SCALE_GAIN3MSB_GAIN011                       (_IADC_SCALE_GAIN3MSB_GAIN011 << 31)
+#define IADC_SCALE_GAIN3MSB_GAIN100                       (_IADC_SCALE_GAIN3MSB_GAIN100 << 31)
+
+/* Bit fields for IADC SCHED */
+#define _IADC_SCHED_RESETVALUE                            0x00000000UL
+#define _IADC_SCHED_MASK                                  0x000003FFUL
+#define _IADC_SCHED_PRESCALE_SHIFT                        0
+#define _IADC_SCHED_PRESCALE_MASK                         0x3FFUL
+#define _IADC_SCHED_PRESCALE_DEFAULT                      0x00000000UL
+#define IADC_SCHED_PRESCALE_DEFAULT                       (_IADC_SCHED_PRESCALE_DEFAULT << 0)
+
+/* Bit fields for IADC SCAN */
+#define _IADC_SCAN_RESETVALUE                             0x00000000UL
+#define _IADC_SCAN_MASK                                   0x0003FFFFUL
+#define _IADC_SCAN_PINNEG_SHIFT                           0
+#define _IADC_SCAN_PINNEG_MASK                            0xFUL
+#define _IADC_SCAN_PINNEG_DEFAULT                         0x00000000UL
+#define IADC_SCAN_PINNEG_DEFAULT                          (_IADC_SCAN_PINNEG_DEFAULT << 0)
+#define _IADC_SCAN_PORTNEG_SHIFT                          4
+#define _IADC_SCAN_PORTNEG_MASK                           0xF0UL
+#define _IADC_SCAN_PORTNEG_DEFAULT                        0x00000000UL
+#define IADC_SCAN_PORTNEG_DEFAULT                         (_IADC_SCAN_PORTNEG_DEFAULT << 4)
+#define _IADC_SCAN_PORTNEG_GND                            0x00000000UL
+#define _IADC_SCAN_PORTNEG_PADREFNEG                      0x00000006UL
+#define _IADC_SCAN_PORTNEG_PORTA                          0x00000008UL
+#define _IADC_SCAN_PORTNEG_PORTB                          0x00000009UL
+#define _IADC_SCAN_PORTNEG_PORTC                          0x0000000AUL
+#define _IADC_SCAN_PORTNEG_PORTD                          0x0000000BUL
+#define IADC_SCAN_PORTNEG_GND                             (_IADC_SCAN_PORTNEG_GND << 4)
+#define IADC_SCAN_PORTNEG_PADREFNEG                       (_IADC_SCAN_PORTNEG_PADREFNEG << 4)
+#define IADC_SCAN_PORTNEG_PORTA                           (_IADC_SCAN_PORTNEG_PORTA << 4)
+#define IADC_SCAN_PORTNEG_PORTB                           (_IADC_SCAN_PORTNEG_PORTB << 4)
+#define IADC_SCAN_PORTNEG_PORTC                           (_IADC_SCAN_PORTNEG_PORTC << 4)
+#define IADC_SCAN_PORTNEG_PORTD                           (_IADC_SCAN_PORTNEG_PORTD << 4)
+#define _IADC_SCAN_PINPOS_SHIFT                           8
+#define _IADC_SCAN_PINPOS_MASK                            0xF00UL
+#define _IADC_SCAN_PINPOS_DEFAULT                         0x00000000UL
+#define IADC_SCAN_PINPOS_DEFAULT                          (_IADC_SCAN_PINPOS_DEFAULT << 8)
+#define _IADC_SCAN_PORTPOS_SHIFT                          12
+#define _IADC_SCAN_PORTPOS_MASK                           0xF000UL
+#define _IADC_SCAN_PORTPOS_DEFAULT                        0x00000000UL
+#define IADC_SCAN_PORTPOS_DEFAULT                         (_IADC_SCAN_PORTPOS_DEFAULT << 12)
+#define _IADC_SCAN_PORTPOS_GND                            0x00000000UL
+#define _IADC_SCAN_PORTPOS_SUPPLY                         0x00000001UL
+#define _IADC_SCAN_PORTPOS_PADREFPOS                      0x00000006UL
+#define _IADC_SCAN_PORTPOS_PORTA                          0x00000008UL
+#define _IADC_SCAN_PORTPOS_PORTB                          0x00000009UL
+#define _IADC_SCAN_PORTPOS_PORTC                          0x0000000AUL
+#define _IADC_SCAN_PORTPOS_PORTD                          0x0000000BUL
+#define IADC_SCAN_PORTPOS_GND                             (_IADC_SCAN_PORTPOS_GND << 12)
+#define IADC_SCAN_PORTPOS_SUPPLY                          (_IADC_SCAN_PORTPOS_SUPPLY << 12)
+#define IADC_SCAN_PORTPOS_PADREFPOS                       (_IADC_SCAN_PORTPOS_PADREFPOS << 12)
+#define IADC_SCAN_PORTPOS_PORTA                           (_IADC_SCAN_PORTPOS_PORTA << 12)
+#define IADC_SCAN_PORTPOS_PORTB                           (_IADC_SCAN_PORTPOS_PORTB << 12)
+#define IADC_SCAN_PORTPOS_PORTC                           (_IADC_SCAN_PORTPOS_PORTC << 12)
+#define IADC_SCAN_PORTPOS_PORTD                           (_IADC_SCAN_PORTPOS_PORTD << 12)
+#define IADC_SCAN_CFG                                     (0x1UL << 16)
+#define _IADC_SCAN_CFG_SHIFT                              16
+#define _IADC_SCAN_CFG_MASK                               0x10000UL
+#define _IADC_SCAN_CFG_DEFAULT                            0x00000000UL
+#define IADC_SCAN_CFG_DEFAULT                             (_IADC_SCAN_CFG_DEFAULT << 16)
+#define IADC_SCAN_CMP                                     (0x1UL << 17)
+#define _IADC_SCAN_CMP_SHIFT                              17
+#define _IADC_SCAN_CMP_MASK                               0x20000UL
+#define _IADC_SCAN_CMP_DEFAULT                            0x00000000UL
+#define IADC_SCAN_CMP_DEFAULT                             (_IADC_SCAN_CMP_DEFAULT << 17)
+
+/******************************************************************************
+ * SYSCFG
+ *****************************************************************************/
+
+typedef struct {
+  uint32_t RESERVED0[1024];
+  uint32_t RESERVED1[1024];
+  uint32_t RESERVED2[1024];
+  uint32_t RESERVED3[1024];
+} SYSCFG_TypeDef;
+
+/******************************************************************************
+ * CRYPTO
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t CMD;
+  __IOM uint32_t CTRL;
+  __IOM uint32_t DATA0;
+  __IOM uint32_t DATA1;
+  __IOM uint32_t DATA2;
+  __IOM uint32_t DDATA0;
+  __IOM uint32_t DDATA0BIG;
+  __IOM uint32_t DDATA0BYTE32;
+  __IOM uint32_t DDATA1;
+  __IOM uint32_t DDATA4;
+  __IOM uint32_t DSTATUS;
+  __IOM uint32_t IEN;
+  __IOM uint32_t IF;
+  __IOM uint32_t IFC;
+  __IOM uint32_t IFS;
+  __IOM uint32_t KEY;
+  __IOM uint32_t KEYBUF;
+  __IOM uint32_t QDATA1BIG;
+  __IOM uint32_t SEQ0;
+  __IOM uint32_t SEQ1;
+  __IOM uint32_t SEQ2;
+  __IOM uint32_t SEQ3;
+  __IOM uint32_t SEQ4;
+  __IOM uint32_t SEQCTRL;
+  __IOM uint32_t SEQCTRLB;
+  __IOM uint32_t STATUS;
+  __IOM uint32_t WAC;
+  uint32_t RESERVED0[997];
+  __IOM uint32_t CMD_SET;
+  __IOM uint32_t CTRL_SET;
+  __IOM uint32_t DATA0_SET;
+  __IOM uint32_t DATA1_SET;
+  __IOM uint32_t DATA2_SET;
+  __IOM uint32_t DDATA0_SET;
+  __IOM uint32_t DDATA0BIG_SET;
+  __IOM uint32_t DDATA0BYTE32_SET;
+  __IOM uint32_t DDATA1_SET;
+  __IOM uint32_t DDATA4_SET;
+  __IOM uint32_t DSTATUS_SET;
+  __IOM uint32_t IEN_SET;
+  __IOM uint32_t IF_SET;
+  __IOM uint32_t IFC_SET;
+  __IOM uint32_t IFS_SET;
+  __IOM uint32_t KEY_SET;
+  __IOM uint32_t KEYBUF_SET;
+  __IOM uint32_t QDATA1BIG_SET;
+  __IOM uint32_t SEQ0_SET;
+  __IOM uint32_t SEQ1_SET;
+  __IOM uint32_t SEQ2_SET;
+  __IOM uint32_t SEQ3_SET;
+  __IOM uint32_t SEQ4_SET;
+  __IOM uint32_t SEQCTRL_SET;
+  __IOM uint32_t SEQCTRLB_SET;
+  __IOM uint32_t STATUS_SET;
+  __IOM uint32_t WAC_SET;
+  uint32_t RESERVED1[997];
+  __IOM uint32_t CMD_CLR;
+  __IOM uint32_t CTRL_CLR;
+  __IOM uint32_t DATA0_CLR;
+  __IOM uint32_t DATA1_CLR;
+  __IOM uint32_t DATA2_CLR;
+  __IOM uint32_t DDATA0_CLR;
+  __IOM uint32_t DDATA0BIG_CLR;
+  __IOM uint32_t DDATA0BYTE32_CLR;
+  __IOM uint32_t DDATA1_CLR;
+  __IOM uint32_t DDATA4_CLR;
+  __IOM uint32_t DSTATUS_CLR;
+  __IOM uint32_t IEN_CLR;
+  __IOM uint32_t IF_CLR;
+  __IOM uint32_t IFC_CLR;
+  __IOM uint32_t IFS_CLR;
+  __IOM uint32_t KEY_CLR;
+  __IOM uint32_t KEYBUF_CLR;
+  __IOM uint32_t QDATA1BIG_CLR;
+  __IOM uint32_t SEQ0_CLR;
+  __IOM uint32_t SEQ1_CLR;
+  __IOM uint32_t SEQ2_CLR;
+  __IOM uint32_t SEQ3_CLR;
+  __IOM uint32_t SEQ4_CLR;
+  __IOM uint32_t SEQCTRL_CLR;
+  __IOM uint32_t SEQCTRLB_CLR;
+  __IOM uint32_t STATUS_CLR;
+  __IOM uint32_t WAC_CLR;
+  uint32_t RESERVED2[997];
+  __IOM uint32_t CMD_TGL;
+  __IOM uint32_t CTRL_TGL;
+  __IOM uint32_t DATA0_TGL;
+  __IOM uint32_t DATA1_TGL;
+  __IOM uint32_t DATA2_TGL;
+  __IOM uint32_t DDATA0_TGL;
+  __IOM uint32_t DDATA0BIG_TGL;
+  __IOM uint32_t DDATA0BYTE32_TGL;
+  __IOM uint32_t DDATA1_TGL;
+  __IOM uint32_t DDATA4_TGL;
+  __IOM uint32_t DSTATUS_TGL;
+  __IOM uint32_t IEN_TGL;
+  __IOM uint32_t IF_TGL;
+  __IOM uint32_t IFC_TGL;
+  __IOM uint32_t IFS_TGL;
+  __IOM uint32_t KEY_TGL;
+  __IOM uint32_t KEYBUF_TGL;
+  __IOM uint32_t QDATA1BIG_TGL;
+  __IOM uint32_t SEQ0_TGL;
+  __IOM uint32_t SEQ1_TGL;
+  __IOM uint32_t SEQ2_TGL;
+  __IOM uint32_t SEQ3_TGL;
+  __IOM uint32_t SEQ4_TGL;
+  __IOM uint32_t SEQCTRL_TGL;
+  __IOM uint32_t SEQCTRLB_TGL;
+  __IOM uint32_t STATUS_TGL;
+  __IOM uint32_t WAC_TGL;
+  uint32_t RESERVED3[997];
+} CRYPTO_TypeDef;
+
+/* Bit fields for CRYPTO CMD */
+#define _CRYPTO_CMD_RESETVALUE                            0x00000000UL
+#define _CRYPTO_CMD_MASK                                  0x000001FFUL
+#define _CRYPTO_CMD_INSTR_SHIFT                           0
+#define _CRYPTO_CMD_INSTR_MASK                            0xFFUL
+#define _CRYPTO_CMD_INSTR_DEFAULT                         0x00000000UL
+#define CRYPTO_CMD_INSTR_DEFAULT                          (_CRYPTO_CMD_INSTR_DEFAULT << 0)
+#define _CRYPTO_CMD_INSTR_END                             0x00000000UL
+#define _CRYPTO_CMD_INSTR_EXEC                            0x00000001UL
+#define _CRYPTO_CMD_INSTR_ADDIC                           0x00000002UL
+#define _CRYPTO_CMD_INSTR_AESDEC                          0x00000003UL
+#define _CRYPTO_CMD_INSTR_AESENC                          0x00000004UL
+#define _CRYPTO_CMD_INSTR_CCLR                            0x00000005UL
+#define _CRYPTO_CMD_INSTR_CLR                             0x00000006UL
+#define _CRYPTO_CMD_INSTR_DATA0TODATA1                    0x00000007UL
+#define _CRYPTO_CMD_INSTR_DATA0TODATA2                    0x00000008UL
+#define _CRYPTO_CMD_INSTR_DATA0TODATA3                    0x00000009UL
+#define _CRYPTO_CMD_INSTR_DATA1INC                        0x0000000AUL
+#define _CRYPTO_CMD_INSTR_DATA1TODATA0                    0x0000000BUL
+#define _CRYPTO_CMD_INSTR_DATA1TODATA0XOR                 0x0000000CUL
+#define _CRYPTO_CMD_INSTR_DATA1TODATA2                    0x0000000DUL
+#define _CRYPTO_CMD_INSTR_DATA2TODATA0                    0x0000000EUL
+#define _CRYPTO_CMD_INSTR_DATA2TODATA0XOR                 0x0000000FUL
+#define _CRYPTO_CMD_INSTR_DATA3TODATA0XOR                 0x00000010UL
+#define _CRYPTO_CMD_INSTR_DATATODMA0                      0x00000011UL
+#define _CRYPTO_CMD_INSTR_DDATA0TODDATA1                  0x00000012UL
+#define _CRYPTO_CMD_INSTR_DDATA0TODDATA2                  0x00000013UL
+#define _CRYPTO_CMD_INSTR_DDATA1TODDATA0                  0x00000014UL
+#define _CRYPTO_CMD_INSTR_DDATA2TODDATA1                  0x00000015UL
+#define _CRYPTO_CMD_INSTR_DMA0TODATA                      0x00000016UL
+#define _CRYPTO_CMD_INSTR_DMA1TODATA                      0x00000017UL
+#define _CRYPTO_CMD_INSTR_MADD32                          0x00000018UL
+#define _CRYPTO_CMD_INSTR_MULO                            0x00000019UL
+#define _CRYPTO_CMD_INSTR_SELDDATA0DDATA1                 0x0000001AUL
+#define _CRYPTO_CMD_INSTR_SELDDATA0DDATA2                 0x0000001BUL
+#define _CRYPTO_CMD_INSTR_SELDDATA1DDATA3                 0x0000001CUL
+#define _CRYPTO_CMD_INSTR_SELDDATA2DDATA3                 0x0000001DUL
+#define _CRYPTO_CMD_INSTR_SHA                             0x0000001EUL
+#define CRYPTO_CMD_INSTR_END                              (_CRYPTO_CMD_INSTR_END << 0)
+#define CRYPTO_CMD_INSTR_EXEC                             (_CRYPTO_CMD_INSTR_EXEC << 0)
+#define CRYPTO_CMD_INSTR_ADDIC                            (_CRYPTO_CMD_INSTR_ADDIC << 0)
+#define CRYPTO_CMD_INSTR_AESDEC                           (_CRYPTO_CMD_INSTR_AESDEC << 0)
+#define CRYPTO_CMD_INSTR_AESENC                           (_CRYPTO_CMD_INSTR_AESENC << 0)
+#define CRYPTO_CMD_INSTR_CCLR                             (_CRYPTO_CMD_INSTR_CCLR << 0)
+#define CRYPTO_CMD_INSTR_CLR                              (_CRYPTO_CMD_INSTR_CLR << 0)
+#define CRYPTO_CMD_INSTR_DATA0TODATA1                     (_CRYPTO_CMD_INSTR_DATA0TODATA1 << 0)
+#define CRYPTO_CMD_INSTR_DATA0TODATA2                     (_CRYPTO_CMD_INSTR_DATA0TODATA2 << 0)
+#define CRYPTO_CMD_INSTR_DATA0TODATA3                     (_CRYPTO_CMD_INSTR_DATA0TODATA3 << 0)
+#define CRYPTO_CMD_INSTR_DATA1INC                         (_CRYPTO_CMD_INSTR_DATA1INC << 0)
+#define CRYPTO_CMD_INSTR_DATA1TODATA0                     (_CRYPTO_CMD_INSTR_DATA1TODATA0 << 0)
+#define CRYPTO_CMD_INSTR_DATA1TODATA0XOR                  (_CRYPTO_CMD_INSTR_DATA1TODATA0XOR << 0)
+#define CRYPTO_CMD_INSTR_DATA1TODATA2                     (_CRYPTO_CMD_INSTR_DATA1TODATA2 << 0)
+#define CRYPTO_CMD_INSTR_DATA2TODATA0                     (_CRYPTO_CMD_INSTR_DATA2TODATA0 << 0)
+#define CRYPTO_CMD_INSTR_DATA2TODATA0XOR                  (_CRYPTO_CMD_INSTR_DATA2TODATA0XOR << 0)
+#define CRYPTO_CMD_INSTR_DATA3TODATA0XOR                  (_CRYPTO_CMD_INSTR_DATA3TODATA0XOR << 0)
+#define CRYPTO_CMD_INSTR_DATATODMA0                       (_CRYPTO_CMD_INSTR_DATATODMA0 << 0)
+#define CRYPTO_CMD_INSTR_DDATA0TODDATA1                   (_CRYPTO_CMD_INSTR_DDATA0TODDATA1 << 0)
+#define CRYPTO_CMD_INSTR_DDATA0TODDATA2                   (_CRYPTO_CMD_INSTR_DDATA0TODDATA2 << 0)
+#define CRYPTO_CMD_INSTR_DDATA1TODDATA0                   (_CRYPTO_CMD_INSTR_DDATA1TODDATA0 << 0)
+#define CRYPTO_CMD_INSTR_DDATA2TODDATA1                   (_CRYPTO_CMD_INSTR_DDATA2TODDATA1 << 0)
+#define CRYPTO_CMD_INSTR_DMA0TODATA                       (_CRYPTO_CMD_INSTR_DMA0TODATA << 0)
+#define CRYPTO_CMD_INSTR_DMA1TODATA                       (_CRYPTO_CMD_INSTR_DMA1TODATA << 0)
+#define CRYPTO_CMD_INSTR_MADD32                           (_CRYPTO_CMD_INSTR_MADD32 << 0)
+#define CRYPTO_CMD_INSTR_MULO                             (_CRYPTO_CMD_INSTR_MULO << 0)
+#define CRYPTO_CMD_INSTR_SELDDATA0DDATA1                  (_CRYPTO_CMD_INSTR_SELDDATA0DDATA1 << 0)
+#define CRYPTO_CMD_INSTR_SELDDATA0DDATA2                  (_CRYPTO_CMD_INSTR_SELDDATA0DDATA2 << 0)
+#define CRYPTO_CMD_INSTR_SELDDATA1DDATA3                  (_CRYPTO_CMD_INSTR_SELDDATA1DDATA3 << 0)
+#define CRYPTO_CMD_INSTR_SELDDATA2DDATA3                  (_CRYPTO_CMD_INSTR_SELDDATA2DDATA3 << 0)
+#define CRYPTO_CMD_INSTR_SHA                              (_CRYPTO_CMD_INSTR_SHA << 0)
+#define CRYPTO_CMD_SEQSTART                               (0x1UL << 8)
+#define _CRYPTO_CMD_SEQSTART_SHIFT                        8
+#define _CRYPTO_CMD_SEQSTART_MASK                         0x100UL
+#define _CRYPTO_CMD_SEQSTART_DEFAULT                      0x00000000UL
+#define CRYPTO_CMD_SEQSTART_DEFAULT                       (_CRYPTO_CMD_SEQSTART_DEFAULT << 8)
+
+/* Bit fields for CRYPTO CTRL */
+#define _CRYPTO_CTRL_RESETVALUE                           0x00000000UL
+#define _CRYPTO_CTRL_MASK                                 0x3333007FUL
+#define _CRYPTO_CTRL_AES_SHIFT                            0
+#define _CRYPTO_CTRL_AES_MASK                             0x3UL
+#define _CRYPTO_CTRL_AES_DEFAULT                          0x00000000UL
+#define CRYPTO_CTRL_AES_DEFAULT                           (_CRYPTO_CTRL_AES_DEFAULT << 0)
+#define _CRYPTO_CTRL_AES_AES128                           0x00000001UL
+#define _CRYPTO_CTRL_AES_AES256                           0x00000002UL
+#define CRYPTO_CTRL_AES_AES128                            (_CRYPTO_CTRL_AES_AES128 << 0)
+#define CRYPTO_CTRL_AES_AES256                            (_CRYPTO_CTRL_AES_AES256 << 0)
+#define _CRYPTO_CTRL_INCWIDTH_SHIFT                       2
+#define _CRYPTO_CTRL_INCWIDTH_MASK                        0x1CUL
+#define _CRYPTO_CTRL_INCWIDTH_DEFAULT                     0x00000000UL
+#define CRYPTO_CTRL_INCWIDTH_DEFAULT                      (_CRYPTO_CTRL_INCWIDTH_DEFAULT << 2)
+#define _CRYPTO_CTRL_INCWIDTH_INCWIDTH1                   0x00000001UL
+#define _CRYPTO_CTRL_INCWIDTH_INCWIDTH2                   0x00000002UL
+#define _CRYPTO_CTRL_INCWIDTH_INCWIDTH3                   0x00000003UL
+#define _CRYPTO_CTRL_INCWIDTH_INCWIDTH4                   0x00000004UL
+#define CRYPTO_CTRL_INCWIDTH_INCWIDTH1                    (_CRYPTO_CTRL_INCWIDTH_INCWIDTH1 << 2)
+#define CRYPTO_CTRL_INCWIDTH_INCWIDTH2                    (_CRYPTO_CTRL_INCWIDTH_INCWIDTH2 << 2)
+#define CRYPTO_CTRL_INCWIDTH_INCWIDTH3                    (_CRYPTO_CTRL_INCWIDTH_INCWIDTH3 << 2)
+#define CRYPTO_CTRL_INCWIDTH_INCWIDTH4                    (_CRYPTO_CTRL_INCWIDTH_INCWIDTH4 << 2)
+#define _CRYPTO_CTRL_SHA_SHIFT                            5
+#define _CRYPTO_CTRL_SHA_MASK                             0x60UL
+#define _CRYPTO_CTRL_SHA_DEFAULT                          0x00000000UL
+#define CRYPTO_CTRL_SHA_DEFAULT                           (_CRYPTO_CTRL_SHA_DEFAULT << 5)
+#define _CRYPTO_CTRL_SHA_SHA1                             0x00000001UL
+#define _CRYPTO_CTRL_SHA_SHA2                             0x00000002UL
+#define CRYPTO_CTRL_SHA_SHA1                              (_CRYPTO_CTRL_SHA_SHA1 << 5)
+#define CRYPTO_CTRL_SHA_SHA2                              (_CRYPTO_CTRL_SHA_SHA2 << 5)
+#define _CRYPTO_CTRL_DMA0MODE_SHIFT                       16
+#define _CRYPTO_CTRL_DMA0MODE_MASK                        0x30000UL
+#define _CRYPTO_CTRL_DMA0MODE_DEFAULT                     0x00000000UL
+#define CRYPTO_CTRL_DMA0MODE_DEFAULT                      (_CRYPTO_CTRL_DMA0MODE_DEFAULT << 16)
+#define _CRYPTO_CTRL_DMA0MODE_FULL                        0x00000000UL
+#define _CRYPTO_CTRL_DMA0MODE_LENLIMIT                    0x00000001UL
+#define _CRYPTO_CTRL_DMA0MODE_FULLBYTE                    0x00000002UL
+#define _CRYPTO_CTRL_DMA0MODE_LENLIMITBYTE                0x00000003UL
+#define CRYPTO_CTRL_DMA0MODE_FULL                         (_CRYPTO_CTRL_DMA0MODE_FULL << 16)
+#define CRYPTO_CTRL_DMA0MODE_LENLIMIT                     (_CRYPTO_CTRL_DMA0MODE_LENLIMIT << 16)
+#define CRYPTO_CTRL_DMA0MODE_FULLBYTE                     (_CRYPTO_CTRL_DMA0MODE_FULLBYTE << 16)
+#define CRYPTO_CTRL_DMA0MODE_LENLIMITBYTE                 (_CRYPTO_CTRL_DMA0MODE_LENLIMITBYTE << 16)
+#define _CRYPTO_CTRL_DMA0RSEL_SHIFT                       20
+#define _CRYPTO_CTRL_DMA0RSEL_MASK                        0x300000UL
+#define _CRYPTO_CTRL_DMA0RSEL_DEFAULT                     0x00000000UL
+#define CRYPTO_CTRL_DMA0RSEL_DEFAULT                      (_CRYPTO_CTRL_DMA0RSEL_DEFAULT << 20)
+#define _CRYPTO_CTRL_DMA0RSEL_DATA0                       0x00000000UL
+#define _CRYPTO_CTRL_DMA0RSEL_DDATA0                      0x00000001UL
+#define _CRYPTO_CTRL_DMA0RSEL_DDATA0BIG                   0x00000002UL
+#define _CRYPTO_CTRL_DMA0RSEL_QDATA0                      0x00000003UL
+#define CRYPTO_CTRL_DMA0RSEL_DATA0                        (_CRYPTO_CTRL_DMA0RSEL_DATA0 << 20)
+#define CRYPTO_CTRL_DMA0RSEL_DDATA0                       (_CRYPTO_CTRL_DMA0RSEL_DDATA0 << 20)
+#define CRYPTO_CTRL_DMA0RSEL_DDATA0BIG                    (_CRYPTO_CTRL_DMA0RSEL_DDATA0BIG << 20)
+#define CRYPTO_CTRL_DMA0RSEL_QDATA0                       (_CRYPTO_CTRL_DMA0RSEL_QDATA0 << 20)
+#define _CRYPTO_CTRL_DMA1MODE_SHIFT                       24
+#define _CRYPTO_CTRL_DMA1MODE_MASK                        0x3000000UL
+#define _CRYPTO_CTRL_DMA1MODE_DEFAULT                     0x00000000UL
+#define CRYPTO_CTRL_DMA1MODE_DEFAULT                      (_CRYPTO_CTRL_DMA1MODE_DEFAULT << 24)
+#define _CRYPTO_CTRL_DMA1MODE_FULL                        0x00000000UL
+#define _CRYPTO_CTRL_DMA1MODE_LENLIMIT                    0x00000001UL
+#define _CRYPTO_CTRL_DMA1MODE_FULLBYTE                    0x00000002UL
+#define _CRYPTO_CTRL_DMA1MODE_LENLIMITBYTE                0x00000003UL
+#define CRYPTO_CTRL_DMA1MODE_FULL                         (_CRYPTO_CTRL_DMA1MODE_FULL << 24)
+#define CRYPTO_CTRL_DMA1MODE_LENLIMIT                     (_CRYPTO_CTRL_DMA1MODE_LENLIMIT << 24)
+#define CRYPTO_CTRL_DMA1MODE_FULLBYTE                     (_CRYPTO_CTRL_DMA1MODE_FULLBYTE << 24)
+#define CRYPTO_CTRL_DMA1MODE_LENLIMITBYTE                 (_CRYPTO_CTRL_DMA1MODE_LENLIMITBYTE << 24)
+#define _CRYPTO_CTRL_DMA1RSEL_SHIFT                       28
+#define _CRYPTO_CTRL_DMA1RSEL_MASK                        0x30000000UL
+#define _CRYPTO_CTRL_DMA1RSEL_DEFAULT                     0x00000000UL
+#define CRYPTO_CTRL_DMA1RSEL_DEFAULT                      (_CRYPTO_CTRL_DMA1RSEL_DEFAULT << 28)
+#define _CRYPTO_CTRL_DMA1RSEL_DATA1                       0x00000000UL
+#define _CRYPTO_CTRL_DMA1RSEL_DDATA1                      0x00000001UL
+#define _CRYPTO_CTRL_DMA1RSEL_QDATA1                      0x00000002UL
+#define _CRYPTO_CTRL_DMA1RSEL_QDATA1BIG                   0x00000003UL
+#define CRYPTO_CTRL_DMA1RSEL_DATA1                        (_CRYPTO_CTRL_DMA1RSEL_DATA1 << 28)
+#define CRYPTO_CTRL_DMA1RSEL_DDATA1                       (_CRYPTO_CTRL_DMA1RSEL_DDATA1 << 28)
+#define CRYPTO_CTRL_DMA1RSEL_QDATA1                       (_CRYPTO_CTRL_DMA1RSEL_QDATA1 << 28)
+#define CRYPTO_CTRL_DMA1RSEL_QDATA1BIG                    (_CRYPTO_CTRL_DMA1RSEL_QDATA1BIG << 28)
+
+/* Bit fields for CRYPTO DATA0 */
+#define _CRYPTO_DATA0_RESETVALUE                          0x00000000UL
+#define _CRYPTO_DATA0_MASK                                0x00000000UL
+
+/* Bit fields for CRYPTO DATA1 */
+#define _CRYPTO_DATA1_RESETVALUE                          0x00000000UL
+#define _CRYPTO_DATA1_MASK                                0x00000000UL
+
+/* Bit fields for CRYPTO DATA2 */
+#define _CRYPTO_DATA2_RESETVALUE                          0x00000000UL
+#define _CRYPTO_DATA2_MASK                                0x00000000UL
+
+/* Bit fields for CRYPTO DDATA0 */
+#define _CRYPTO_DDATA0_RESETVALUE                         0x00000000UL
+#define _CRYPTO_DDATA0_MASK                               0x00000000UL
+
+/* Bit fields for CRYPTO DDATA0BIG */
+#define _CRYPTO_DDATA0BIG_RESETVALUE                      0x00000000UL
+#define _CRYPTO_DDATA0BIG_MASK                            0x00000000UL
+
+/* Bit fields for CRYPTO DDATA0BYTE32 */
+#define _CRYPTO_DDATA0BYTE32_RESETVALUE                   0x00000000UL
+#define _CRYPTO_DDATA0BYTE32_MASK                         0x000000FFUL
+#define _CRYPTO_DDATA0BYTE32_DDATA0BYTE32_SHIFT           0
+#define _CRYPTO_DDATA0BYTE32_DDATA0BYTE32_MASK            0xFFUL
+#define _CRYPTO_DDATA0BYTE32_DDATA0BYTE32_DEFAULT         0x00000000UL
+#define CRYPTO_DDATA0BYTE32_DDATA0BYTE32_DEFAULT          (_CRYPTO_DDATA0BYTE32_DDATA0BYTE32_DEFAULT << 0)
+
+/* Bit fields for CRYPTO DDATA1 */
+#define _CRYPTO_DDATA1_RESETVALUE                         0x00000000UL
+#define _CRYPTO_DDATA1_MASK                               0x00000000UL
+
+/* Bit fields for CRYPTO DDATA4 */
+#define _CRYPTO_DDATA4_RESETVALUE                         0x00000000UL
+#define _CRYPTO_DDATA4_MASK                               0x00000000UL
+
+/* Bit fields for CRYPTO DSTATUS */
+#define _CRYPTO_DSTATUS_RESETVALUE                        0x00000000UL
+#define _CRYPTO_DSTATUS_MASK                              0xFFFFFFFFUL
+#define _CRYPTO_DSTATUS_CARRY_SHIFT                       0
+#define _CRYPTO_DSTATUS_CARRY_MASK                        0xFFUL
+#define _CRYPTO_DSTATUS_CARRY_DEFAULT                     0x00000000UL
+#define CRYPTO_DSTATUS_CARRY_DEFAULT                      (_CRYPTO_DSTATUS_CARRY_DEFAULT << 0)
+#define _CRYPTO_DSTATUS_DDATA0LSBS_SHIFT                  8
+#define _CRYPTO_DSTATUS_DDATA0LSBS_MASK                   0xFF00UL
+#define _CRYPTO_DSTATUS_DDATA0LSBS_DEFAULT                0x00000000UL
+#define CRYPTO_DSTATUS_DDATA0LSBS_DEFAULT                 (_CRYPTO_DSTATUS_DDATA0LSBS_DEFAULT << 8)
+#define _CRYPTO_DSTATUS_DDATA0MSBS_SHIFT                  16
+#define _CRYPTO_DSTATUS_DDATA0MSBS_MASK                   0xFF0000UL
+#define _CRYPTO_DSTATUS_DDATA0MSBS_DEFAULT                0x00000000UL
+#define CRYPTO_DSTATUS_DDATA0MSBS_DEFAULT                 (_CRYPTO_DSTATUS_DDATA0MSBS_DEFAULT << 16)
+#define _CRYPTO_DSTATUS_DDATA1MSB_SHIFT                   24
+#define _CRYPTO_DSTATUS_DDATA1MSB_MASK                    0xFF000000UL
+#define _CRYPTO_DSTATUS_DDATA1MSB_DEFAULT                 0x00000000UL
+#define CRYPTO_DSTATUS_DDATA1MSB_DEFAULT                  (_CRYPTO_DSTATUS_DDATA1MSB_DEFAULT << 24)
+
+/* Bit fields for CRYPTO IEN */
+#define _CRYPTO_IEN_RESETVALUE                            0x00000000UL
+#define _CRYPTO_IEN_MASK                                  0x00000003UL
+#define CRYPTO_IEN_INSTRDONE                              (0x1UL << 0)
+#define _CRYPTO_IEN_INSTRDONE_SHIFT                       0
+#define _CRYPTO_IEN_INSTRDONE_MASK                        0x1UL
+#define _CRYPTO_IEN_INSTRDONE_DEFAULT                     0x00000000UL
+#define CRYPTO_IEN_INSTRDONE_DEFAULT                      (_CRYPTO_IEN_INSTRDONE_DEFAULT << 0)
+#define CRYPTO_IEN_SEQDONE                                (0x1UL << 1)
+#define _CRYPTO_IEN_SEQDONE_SHIFT                         1
+#define _CRYPTO_IEN_SEQDONE_MASK                          0x2UL
+#define _CRYPTO_IEN_SEQDONE_DEFAULT                       0x00000000UL
+#define CRYPTO_IEN_SEQDONE_DEFAULT                        (_CRYPTO_IEN_SEQDONE_DEFAULT << 1)
+
+/* Bit fields for CRYPTO IF */
+#define _CRYPTO_IF_RESETVALUE                             0x00000000UL
+#define _CRYPTO_IF_MASK                                   0x00000003UL
+#define CRYPTO_IF_INSTRDONE                               (0x1UL << 0)
+#define _CRYPTO_IF_INSTRDONE_SHIFT                        0
+#define _CRYPTO_IF_INSTRDONE_MASK                         0x1UL
+#define _CRYPTO_IF_INSTRDONE_DEFAULT                      0x00000000UL
+#define CRYPTO_IF_INSTRDONE_DEFAULT                       (_CRYPTO_IF_INSTRDONE_DEFAULT << 0)
+#define CRYPTO_IF_SEQDONE                                 (0x1UL << 1)
+#define _CRYPTO_IF_SEQDONE_SHIFT                          1
+#define _CRYPTO_IF_SEQDONE_MASK                           0x2UL
+#define _CRYPTO_IF_SEQDONE_DEFAULT                        0x00000000UL
+#define CRYPTO_IF_SEQDONE_DEFAULT                         (_CRYPTO_IF_SEQDONE_DEFAULT << 1)
+
+/* Bit fields for CRYPTO IFC */
+#define _CRYPTO_IFC_RESETVALUE                            0x00000000UL
+#define _CRYPTO_IFC_MASK                                  0x00000000UL
+
+/* Bit fields for CRYPTO IFS */
+#define _CRYPTO_IFS_RESETVALUE                            0x00000000UL
+#define _CRYPTO_IFS_MASK                                  0x00000000UL
+
+/* Bit fields for CRYPTO KEY */
+#define _CRYPTO_KEY_RESETVALUE                            0x00000000UL
+#define _CRYPTO_KEY_MASK                                  0x00000000UL
+
+/* Bit fields for CRYPTO KEYBUF */
+#define _CRYPTO_KEYBUF_RESETVALUE                         0x00000000UL
+#define _CRYPTO_KEYBUF_MASK                               0x00000000UL
+
+/* Bit fields for CRYPTO QDATA1BIG */
+#define _CRYPTO_QDATA1BIG_RESETVALUE                      0x00000000UL
+#define _CRYPTO_QDATA1BIG_MASK                            0x00000000UL
+
+/* Bit fields for CRYPTO SEQ0 */
+#define _CRYPTO_SEQ0_RESETVALUE                           0x00000000UL
+#define _CRYPTO_SEQ0_MASK                                 0x00000000UL
+
+/* Bit fields for CRYPTO SEQ1 */
+#define _CRYPTO_SEQ1_RESETVALUE                           0x00000000UL
+#define _CRYPTO_SEQ1_MASK                                 0x00000000UL
+
+/* Bit fields for CRYPTO SEQ2 */
+#define _CRYPTO_SEQ2_RESETVALUE                           0x00000000UL
+#define _CRYPTO_SEQ2_MASK                                 0x00000000UL
+
+/* Bit fields for CRYPTO SEQ3 */
+#define _CRYPTO_SEQ3_RESETVALUE                           0x00000000UL
+#define _CRYPTO_SEQ3_MASK                                 0x00000000UL
+
+/* Bit fields for CRYPTO SEQ4 */
+#define _CRYPTO_SEQ4_RESETVALUE                           0x00000000UL
+#define _CRYPTO_SEQ4_MASK                                 0x00000000UL
+
+/* Bit fields for CRYPTO SEQCTRL */
+#define _CRYPTO_SEQCTRL_RESETVALUE                        0x00000000UL
+#define _CRYPTO_SEQCTRL_MASK                              0x00303FFFUL
+#define _CRYPTO_SEQCTRL_LENGTHA_SHIFT                     0
+#define _CRYPTO_SEQCTRL_LENGTHA_MASK                      0x3FFFUL
+#define _CRYPTO_SEQCTRL_LENGTHA_DEFAULT                   0x00000000UL
+#define CRYPTO_SEQCTRL_LENGTHA_DEFAULT                    (_CRYPTO_SEQCTRL_LENGTHA_DEFAULT << 0)
+#define _CRYPTO_SEQCTRL_BLOCKSIZE_SHIFT                   20
+#define _CRYPTO_SEQCTRL_BLOCKSIZE_MASK                    0x300000UL
+#define _CRYPTO_SEQCTRL_BLOCKSIZE_DEFAULT                 0x00000000UL
+#define CRYPTO_SEQCTRL_BLOCKSIZE_DEFAULT                  (_CRYPTO_SEQCTRL_BLOCKSIZE_DEFAULT << 20)
+#define _CRYPTO_SEQCTRL_BLOCKSIZE_16BYTES                 0x00000000UL
+#define _CRYPTO_SEQCTRL_BLOCKSIZE_32BYTES                 0x00000001UL
+#define _CRYPTO_SEQCTRL_BLOCKSIZE_64BYTES                 0x00000002UL
+#define CRYPTO_SEQCTRL_BLOCKSIZE_16BYTES                  (_CRYPTO_SEQCTRL_BLOCKSIZE_16BYTES << 20)
+#define CRYPTO_SEQCTRL_BLOCKSIZE_32BYTES                  (_CRYPTO_SEQCTRL_BLOCKSIZE_32BYTES << 20)
+#define CRYPTO_SEQCTRL_BLOCKSIZE_64BYTES                  (_CRYPTO_SEQCTRL_BLOCKSIZE_64BYTES << 20)
+
+/* Bit fields for CRYPTO SEQCTRLB */
+#define _CRYPTO_SEQCTRLB_RESETVALUE                       0x00000000UL
+#define _CRYPTO_SEQCTRLB_MASK                             0x00000000UL
+
+/* Bit fields for CRYPTO STATUS */
+#define _CRYPTO_STATUS_RESETVALUE                         0x00000000UL
+#define _CRYPTO_STATUS_MASK                               0x00000007UL
+#define CRYPTO_STATUS_DMAACTIVE                           (0x1UL << 0)
+#define _CRYPTO_STATUS_DMAACTIVE_SHIFT                    0
+#define _CRYPTO_STATUS_DMAACTIVE_MASK                     0x1UL
+#define _CRYPTO_STATUS_DMAACTIVE_DEFAULT                  0x00000000UL
+#define CRYPTO_STATUS_DMAACTIVE_DEFAULT                   (_CRYPTO_STATUS_DMAACTIVE_DEFAULT << 0)
+#define CRYPTO_STATUS_INSTRRUNNING                        (0x1UL << 1)
+#define _CRYPTO_STATUS_INSTRRUNNING_SHIFT                 1
+#define _CRYPTO_STATUS_INSTRRUNNING_MASK                  0x2UL
+#define _CRYPTO_STATUS_INSTRRUNNING_DEFAULT               0x00000000UL
+#define CRYPTO_STATUS_INSTRRUNNING_DEFAULT                (_CRYPTO_STATUS_INSTRRUNNING_DEFAULT << 1)
+#define CRYPTO_STATUS_SEQRUNNING                          (0x1UL << 2)
+#define _CRYPTO_STATUS_SEQRUNNING_SHIFT                   2
+#define _CRYPTO_STATUS_SEQRUNNING_MASK                    0x4UL
+#define _CRYPTO_STATUS_SEQRUNNING_DEFAULT                 0x00000000UL
+#define CRYPTO_STATUS_SEQRUNNING_DEFAULT                  (_CRYPTO_STATUS_SEQRUNNING_DEFAULT << 2)
+
+/* Bit fields for CRYPTO WAC */
+#define _CRYPTO_WAC_RESETVALUE                            0x00000000UL
+#define _CRYPTO_WAC_MASK                                  0x000003FFUL
+#define _CRYPTO_WAC_MODOP_SHIFT                           0
+#define _CRYPTO_WAC_MODOP_MASK                            0x3UL
+#define _CRYPTO_WAC_MODOP_DEFAULT                         0x00000000UL
+#define CRYPTO_WAC_MODOP_DEFAULT                          (_CRYPTO_WAC_MODOP_DEFAULT << 0)
+#define _CRYPTO_WAC_MODOP_BINARY                          0x00000001UL
+#define _CRYPTO_WAC_MODOP_REGULAR                         0x00000002UL
+#define CRYPTO_WAC_MODOP_BINARY                           (_CRYPTO_WAC_MODOP_BINARY << 0)
+#define CRYPTO_WAC_MODOP_REGULAR                          (_CRYPTO_WAC_MODOP_REGULAR << 0)
+#define _CRYPTO_WAC_MODULUS_SHIFT                         2
+#define _CRYPTO_WAC_MODULUS_MASK                          0x3CUL
+#define _CRYPTO_WAC_MODULUS_DEFAULT                       0x00000000UL
+#define CRYPTO_WAC_MODULUS_DEFAULT                        (_CRYPTO_WAC_MODULUS_DEFAULT << 2)
+#define _CRYPTO_WAC_MODULUS_BIN128                        0x00000001UL
+#define _CRYPTO_WAC_MODULUS_BIN256                        0x00000002UL
+#define _CRYPTO_WAC_MODULUS_ECCBIN163KN                   0x00000003UL
+#define _CRYPTO_WAC_MODULUS_ECCBIN163N                    0x00000004UL
+#define _CRYPTO_WAC_MODULUS_ECCBIN163P                    0x00000005UL
+#define _CRYPTO_WAC_MODULUS_ECCBIN233KN                   0x00000006UL
+#define _CRYPTO_WAC_MODULUS_ECCBIN233N                    0x00000007UL
+#define _CRYPTO_WAC_MODULUS_ECCBIN233P                    0x00000008UL
+#define _CRYPTO_WAC_MODULUS_ECCPRIME192N                  0x00000009UL
+#define _CRYPTO_WAC_MODULUS_ECCPRIME192P                  0x0000000AUL
+#define _CRYPTO_WAC_MODULUS_ECCPRIME224N                  0x0000000BUL
+#define _CRYPTO_WAC_MODULUS_ECCPRIME224P                  0x0000000CUL
+#define _CRYPTO_WAC_MODULUS_ECCPRIME256N                  0x0000000DUL
+#define _CRYPTO_WAC_MODULUS_ECCPRIME256P                  0x0000000EUL
+#define _CRYPTO_WAC_MODULUS_GCMBIN128                     0x0000000FUL
+#define CRYPTO_WAC_MODULUS_BIN128                         (_CRYPTO_WAC_MODULUS_BIN128 << 2)
+#define CRYPTO_WAC_MODULUS_BIN256                         (_CRYPTO_WAC_MODULUS_BIN256 << 2)
+#define CRYPTO_WAC_MODULUS_ECCBIN163KN                    (_CRYPTO_WAC_MODULUS_ECCBIN163KN << 2)
+#define CRYPTO_WAC_MODULUS_ECCBIN163N                     (_CRYPTO_WAC_MODULUS_ECCBIN163N << 2)
+#define CRYPTO_WAC_MODULUS_ECCBIN163P                     (_CRYPTO_WAC_MODULUS_ECCBIN163P << 2)
+#define CRYPTO_WAC_MODULUS_ECCBIN233KN                    (_CRYPTO_WAC_MODULUS_ECCBIN233KN << 2)
+#define CRYPTO_WAC_MODULUS_ECCBIN233N                     (_CRYPTO_WAC_MODULUS_ECCBIN233N << 2)
+#define CRYPTO_WAC_MODULUS_ECCBIN233P                     (_CRYPTO_WAC_MODULUS_ECCBIN233P << 2)
+#define CRYPTO_WAC_MODULUS_ECCPRIME192N                   (_CRYPTO_WAC_MODULUS_ECCPRIME192N << 2)
+#define CRYPTO_WAC_MODULUS_ECCPRIME192P                   (_CRYPTO_WAC_MODULUS_ECCPRIME192P << 2)
+#define CRYPTO_WAC_MODULUS_ECCPRIME224N                   (_CRYPTO_WAC_MODULUS_ECCPRIME224N << 2)
+#define CRYPTO_WAC_MODULUS_ECCPRIME224P                   (_CRYPTO_WAC_MODULUS_ECCPRIME224P << 2)
+#define CRYPTO_WAC_MODULUS_ECCPRIME256N                   (_CRYPTO_WAC_MODULUS_ECCPRIME256N << 2)
+#define CRYPTO_WAC_MODULUS_ECCPRIME256P                   (_CRYPTO_WAC_MODULUS_ECCPRIME256P << 2)
+#define CRYPTO_WAC_MODULUS_GCMBIN128                      (_CRYPTO_WAC_MODULUS_GCMBIN128 << 2)
+#define _CRYPTO_WAC_MULWIDTH_SHIFT                        6
+#define _CRYPTO_WAC_MULWIDTH_MASK                         0xC0UL
+#define _CRYPTO_WAC_MULWIDTH_DEFAULT                      0x00000000UL
+#define CRYPTO_WAC_MULWIDTH_DEFAULT                       (_CRYPTO_WAC_MULWIDTH_DEFAULT << 6)
+#define _CRYPTO_WAC_MULWIDTH_MUL128                       0x00000001UL
+#define _CRYPTO_WAC_MULWIDTH_MUL256                       0x00000002UL
+#define _CRYPTO_WAC_MULWIDTH_MULMOD                       0x00000003UL
+#define CRYPTO_WAC_MULWIDTH_MUL128                        (_CRYPTO_WAC_MULWIDTH_MUL128 << 6)
+#define CRYPTO_WAC_MULWIDTH_MUL256                        (_CRYPTO_WAC_MULWIDTH_MUL256 << 6)
+#define CRYPTO_WAC_MULWIDTH_MULMOD                        (_CRYPTO_WAC_MULWIDTH_MULMOD << 6)
+#define _CRYPTO_WAC_RESULTWIDTH_SHIFT                     8
+#define _CRYPTO_WAC_RESULTWIDTH_MASK                      0x300UL
+#define _CRYPTO_WAC_RESULTWIDTH_DEFAULT                   0x00000000UL
+#define CRYPTO_WAC_RESULTWIDTH_DEFAULT                    (_CRYPTO_WAC_RESULTWIDTH_DEFAULT << 8)
+#define _CRYPTO_WAC_RESULTWIDTH_128BIT                    0x00000001UL
+#define _CRYPTO_WAC_RESULTWIDTH_256BIT                    0x00000002UL
+#define _CRYPTO_WAC_RESULTWIDTH_260BIT                    0x00000003UL
+#define CRYPTO_WAC_RESULTWIDTH_128BIT                     (_CRYPTO_WAC_RESULTWIDTH_128BIT << 8)
+#define CRYPTO_WAC_RESULTWIDTH_256BIT                     (_CRYPTO_WAC_RESULTWIDTH_256BIT << 8)
+#define CRYPTO_WAC_RESULTWIDTH_260BIT                     (_CRYPTO_WAC_RESULTWIDTH_260BIT << 8)
+
+/******************************************************************************
+ * DEVINFO
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t HFRCODPLLCAL;
+} DEVINFO_HFRCODPLLCAL_TypeDef;
+
+typedef struct {
+  __IOM uint32_t HFRCOEM23CAL;
+} DEVINFO_HFRCOEM23CAL_TypeDef;
+
+typedef struct {
+  __IOM uint32_t INFO;
+  __IOM uint32_t PART;
+  __IOM uint32_t MEMINFO;
+  __IOM uint32_t MSIZE;
+  __IOM uint32_t PKGINFO;
+  __IOM uint32_t CUSTOMINFO;
+  __IOM uint32_t SWFIX;
+  __IOM uint32_t SWCAPA0;
+  __IOM uint32_t SWCAPA1;
+  __IOM uint32_t EXTINFO;
+  __IOM uint32_t EUI48L;
+  __IOM uint32_t EUI48H;
+  __IOM uint32_t EUI64L;
+  __IOM uint32_t EUI64H;
+  __IOM uint32_t CALTEMP;
+  __IOM uint32_t EMUTEMP;
+  __IOM uint32_t IADC0GAIN0;
+  __IOM uint32_t IADC0GAIN1;
+  __IOM uint32_t IADC0NORMALOFFSETCAL0;
+  __IOM uint32_t IADC0NORMALOFFSETCAL1;
+  __IOM uint32_t IADC0OFFSETCAL0;
+  DEVINFO_HFRCODPLLCAL_TypeDef HFRCODPLLCAL[18];
+  DEVINFO_HFRCOEM23CAL_TypeDef HFRCOEM23CAL[18];
+} DEVINFO_TypeDef;
+
+/* Bit fields for DEVINFO INFO */
+#define _DEVINFO_INFO_RESETVALUE                          0x00000000UL
+#define _DEVINFO_INFO_MASK                                0xFF000000UL
+#define _DEVINFO_INFO_PRODREV_SHIFT                       24
+#define _DEVINFO_INFO_PRODREV_MASK                        0xFF000000UL
+#define _DEVINFO_INFO_PRODREV_DEFAULT                     0x00000000UL
+#define DEVINFO_INFO_PRODREV_DEFAULT                      (_DEVINFO_INFO_PRODREV_DEFAULT << 24)
+
+/* Bit fields for DEVINFO PART */
+#define _DEVINFO_PART_RESETVALUE                          0x00000000UL
+#define _DEVINFO_PART_MASK                                0x3F3FFFFFUL
+#define _DEVINFO_PART_DEVICENUM_SHIFT                     0
+#define _DEVINFO_PART_DEVICENUM_MASK                      0xFFFFUL
+#define _DEVINFO_PART_DEVICENUM_DEFAULT                   0x00000000UL
+#define DEVINFO_PART_DEVICENUM_DEFAULT                    (_DEVINFO_PART_DEVICENUM_DEFAULT << 0)
+#define _DEVINFO_PART_FAMILYNUM_SHIFT                     16
+#define _DEVINFO_PART_FAMILYNUM_MASK                      0x3F0000UL
+#define _DEVINFO_PART_FAMILYNUM_DEFAULT                   0x00000000UL
+#define DEVINFO_PART_FAMILYNUM_DEFAULT                    (_DEVINFO_PART_FAMILYNUM_DEFAULT << 16)
+#define _DEVINFO_PART_FAMILY_SHIFT                        24
+#define _DEVINFO_PART_FAMILY_MASK                         0x3F000000UL
+#define _DEVINFO_PART_FAMILY_DEFAULT                      0x00000000UL
+#define DEVINFO_PART_FAMILY_DEFAULT                       (_DEVINFO_PART_FAMILY_DEFAULT << 24)
+#define _DEVINFO_PART_FAMILY_FG                           0x00000000UL
+#define _DEVINFO_PART_FAMILY_MG                           0x00000001UL
+#define _DEVINFO_PART_FAMILY_BG                           0x00000002UL
+#define DEVINFO_PART_FAMILY_FG                            (_DEVINFO_PART_FAMILY_FG << 24)
+#define DEVINFO_PART_FAMILY_MG                            (_DEVINFO_PART_FAMILY_MG << 24)
+#define DEVINFO_PART_FAMILY_BG                            (_DEVINFO_PART_FAMILY_BG << 24)
+
+/* Bit fields for DEVINFO MEMINFO */
+#define _DEVINFO_MEMINFO_RESETVALUE                       0x00000000UL
+#define _DEVINFO_MEMINFO_MASK                             0xFF000000UL
+#define _DEVINFO_MEMINFO_FLASHPAGESIZE_SHIFT              24
+#define _DEVINFO_MEMINFO_FLASHPAGESIZE_MASK               0xFF000000UL
+#define _DEVINFO_MEMINFO_FLASHPAGESIZE_DEFAULT            0x00000000UL
+#define DEVINFO_MEMINFO_FLASHPAGESIZE_DEFAULT             (_DEVINFO_MEMINFO_FLASHPAGESIZE_DEFAULT << 24)
+
+/* Bit fields for DEVINFO MSIZE */
+#define _DEVINFO_MSIZE_RESETVALUE                         0x00000000UL
+#define _DEVINFO_MSIZE_MASK                               0x07FFFFFFUL
+#define _DEVINFO_MSIZE_FLASH_SHIFT                        0
+#define _DEVINFO_MSIZE_FLASH_MASK                         0xFFFFUL
+#define _DEVINFO_MSIZE_FLASH_DEFAULT                      0x00000000UL
+#define DEVINFO_MSIZE_FLASH_DEFAULT                       (_DEVINFO_MSIZE_FLASH_DEFAULT << 0)
+#define _DEVINFO_MSIZE_SRAM_SHIFT                         16
+#define _DEVINFO_MSIZE_SRAM_MASK                          0x7FF0000UL
+#define _DEVINFO_MSIZE_SRAM_DEFAULT                       0x00000000UL
+#define DEVINFO_MSIZE_SRAM_DEFAULT                        (_DEVINFO_MSIZE_SRAM_DEFAULT << 16)
+
+/* Bit fields for DEVINFO PKGINFO */
+#define _DEVINFO_PKGINFO_RESETVALUE                       0x00000000UL
+#define _DEVINFO_PKGINFO_MASK                             0x00000000UL
+
+/* Bit fields for DEVINFO CUSTOMINFO */
+#define _DEVINFO_CUSTOMINFO_RESETVALUE                    0x00000000UL
+#define _DEVINFO_CUSTOMINFO_MASK                          0x00000000UL
+
+/* Bit fields for DEVINFO SWFIX */
+#define _DEVINFO_SWFIX_RESETVALUE                         0x00000000UL
+#define _DEVINFO_SWFIX_MASK                               0x00000000UL
+
+/* Bit fields for DEVINFO SWCAPA0 */
+#define _DEVINFO_SWCAPA0_RESETVALUE                       0x00000000UL
+#define _DEVINFO_SWCAPA0_MASK                             0x00000000UL
+
+/* Bit fields for DEVINFO SWCAPA1 */
+#define _DEVINFO_SWCAPA1_RESETVALUE                       0x00000000UL
+#define _DEVINFO_SWCAPA1_MASK                             0x00000000UL
+
+/* Bit fields for DEVINFO EXTINFO */
+#define _DEVINFO_EXTINFO_RESETVALUE                       0x00000000UL
+#define _DEVINFO_EXTINFO_MASK                             0x00000000UL
+
+/* Bit fields for DEVINFO EUI48L */
+#define _DEVINFO_EUI48L_RESETVALUE                        0x00000000UL
+#define _DEVINFO_EUI48L_MASK                              0x00000000UL
+
+/* Bit fields for DEVINFO EUI48H */
+#define _DEVINFO_EUI48H_RESETVALUE                        0x00000000UL
+#define _DEVINFO_EUI48H_MASK                              0x00000000UL
+
+/* Bit fields for DEVINFO EUI64L */
+#define _DEVINFO_EUI64L_RESETVALUE                        0x00000000UL
+#define _DEVINFO_EUI64L_MASK                              0x00000000UL
+
+/* Bit fields for DEVINFO EUI64H */
+#define _DEVINFO_EUI64H_RESETVALUE                        0x00000000UL
+#define _DEVINFO_EUI64H_MASK                              0x00000000UL
+
+/* Bit fields for DEVINFO CALTEMP */
+#define _DEVINFO_CALTEMP_RESETVALUE                       0x00000000UL
+#define _DEVINFO_CALTEMP_MASK                             0x000000FFUL
+#define _DEVINFO_CALTEMP_TEMP_SHIFT                       0
+#define _DEVINFO_CALTEMP_TEMP_MASK                        0xFFUL
+#define _DEVINFO_CALTEMP_TEMP_DEFAULT                     0x00000000UL
+#define DEVINFO_CALTEMP_TEMP_DEFAULT                      (_DEVINFO_CALTEMP_TEMP_DEFAULT << 0)
+
+/* Bit fields for DEVINFO EMUTEMP */
+#define _DEVINFO_EMUTEMP_RESETVALUE                       0x00000000UL
+#define _DEVINFO_EMUTEMP_MASK                             0x00000000UL
+
+/* Bit fields for DEVINFO IADC0GAIN0 */
+#define _DEVINFO_IADC0GAIN0_RESETVALUE                    0x00000000UL
+#define _DEVINFO_IADC0GAIN0_MASK                          0xFFFFFFFFUL
+#define _DEVINFO_IADC0GAIN0_GAINCANA1_SHIFT               0
+#define _DEVINFO_IADC0GAIN0_GAINCANA1_MASK                0xFFFFUL
+#define _DEVINFO_IADC0GAIN0_GAINCANA1_DEFAULT             0x00000000UL
+#define DEVINFO_IADC0GAIN0_GAINCANA1_DEFAULT              (_DEVINFO_IADC0GAIN0_GAINCANA1_DEFAULT << 0)
+#define _DEVINFO_IADC0GAIN0_GAINCANA2_SHIFT               16
+#define _DEVINFO_IADC0GAIN0_GAINCANA2_MASK                0xFFFF0000UL
+#define _DEVINFO_IADC0GAIN0_GAINCANA2_DEFAULT             0x00000000UL
+#define DEVINFO_IADC0GAIN0_GAINCANA2_DEFAULT              (_DEVINFO_IADC0GAIN0_GAINCANA2_DEFAULT << 16)
+
+/* Bit fields for DEVINFO IADC0GAIN1 */
+#define _DEVINFO_IADC0GAIN1_RESETVALUE                    0x00000000UL
+#define _DEVINFO_IADC0GAIN1_MASK                          0xFFFFFFFFUL
+#define _DEVINFO_IADC0GAIN1_GAINCANA3_SHIFT               0
+#define _DEVINFO_IADC0GAIN1_GAINCANA3_MASK                0xFFFFUL
+#define _DEVINFO_IADC0GAIN1_GAINCANA3_DEFAULT             0x00000000UL
+#define DEVINFO_IADC0GAIN1_GAINCANA3_DEFAULT              (_DEVINFO_IADC0GAIN1_GAINCANA3_DEFAULT << 0)
+#define _DEVINFO_IADC0GAIN1_GAINCANA4_SHIFT               16
+#define _DEVINFO_IADC0GAIN1_GAINCANA4_MASK                0xFFFF0000UL
+#define _DEVINFO_IADC0GAIN1_GAINCANA4_DEFAULT             0x00000000UL
+#define DEVINFO_IADC0GAIN1_GAINCANA4_DEFAULT              (_DEVINFO_IADC0GAIN1_GAINCANA4_DEFAULT << 16)
+
+/* Bit fields for DEVINFO IADC0NORMALOFFSETCAL0 */
+#define _DEVINFO_IADC0NORMALOFFSETCAL0_RESETVALUE         0x00000000UL
+#define _DEVINFO_IADC0NORMALOFFSETCAL0_MASK               0xFFFFFFFFUL
+#define _DEVINFO_IADC0NORMALOFFSETCAL0_OFFSETANA1NORM_SHIFT 0
+#define _DEVINFO_IADC0NORMALOFFSETCAL0_OFFSETANA1NORM_MASK 0xFFFFUL
+#define _DEVINFO_IADC0NORMALOFFSETCAL0_OFFSETANA1NORM_DEFAULT 0x00000000UL
+#define DEVINFO_IADC0NORMALOFFSETCAL0_OFFSETANA1NORM_DEFAULT (_DEVINFO_IADC0NORMALOFFSETCAL0_OFFSETANA1NORM_DEFAULT << 0)
+#define _DEVINFO_IADC0NORMALOFFSETCAL0_OFFSETANA2NORM_SHIFT 16
+#define _DEVINFO_IADC0NORMALOFFSETCAL0_OFFSETANA2NORM_MASK 0xFFFF0000UL
+#define _DEVINFO_IADC0NORMALOFFSETCAL0_OFFSETANA2NORM_DEFAULT 0x00000000UL
+#define DEVINFO_IADC0NORMALOFFSETCAL0_OFFSETANA2NORM_DEFAULT (_DEVINFO_IADC0NORMALOFFSETCAL0_OFFSETANA2NORM_DEFAULT << 16)
+
+/* Bit fields for DEVINFO IADC0NORMALOFFSETCAL1 */
+#define _DEVINFO_IADC0NORMALOFFSETCAL1_RESETVALUE         0x00000000UL
+#define _DEVINFO_IADC0NORMALOFFSETCAL1_MASK               0x0000FFFFUL
+#define _DEVINFO_IADC0NORMALOFFSETCAL1_OFFSETANA3NORM_SHIFT 0
+#define _DEVINFO_IADC0NORMALOFFSETCAL1_OFFSETANA3NORM_MASK 0xFFFFUL
+#define _DEVINFO_IADC0NORMALOFFSETCAL1_OFFSETANA3NORM_DEFAULT 0x00000000UL
+#define DEVINFO_IADC0NORMALOFFSETCAL1_OFFSETANA3NORM_DEFAULT (_DEVINFO_IADC0NORMALOFFSETCAL1_OFFSETANA3NORM_DEFAULT << 0)
+
+/* Bit fields for DEVINFO IADC0OFFSETCAL0 */
+#define _DEVINFO_IADC0OFFSETCAL0_RESETVALUE               0x00000000UL
+#define _DEVINFO_IADC0OFFSETCAL0_MASK                     0x0000FFFFUL
+#define _DEVINFO_IADC0OFFSETCAL0_OFFSETANABASE_SHIFT      0
+#define _DEVINFO_IADC0OFFSETCAL0_OFFSETANABASE_MASK       0xFFFFUL
+#define _DEVINFO_IADC0OFFSETCAL0_OFFSETANABASE_DEFAULT    0x00000000UL
+#define DEVINFO_IADC0OFFSETCAL0_OFFSETANABASE_DEFAULT     (_DEVINFO_IADC0OFFSETCAL0_OFFSETANABASE_DEFAULT << 0)
+
+/******************************************************************************
+ * PRS
+ *****************************************************************************/
+
+typedef struct {
+  __IOM uint32_t CONSUMER_EUART0_RX;
+  __IOM uint32_t CONSUMER_EUART0_TRIGGER;
+  __IOM uint32_t CONSUMER_IADC0_SCANTRIGGER;
+  __IOM uint32_t CONSUMER_IADC0_SINGLETRIGGER;
+  __IOM uint32_t CONSUMER_LDMAXBAR_DMAREQ0;
+  __IOM uint32_t CONSUMER_LDMAXBAR_DMAREQ1;
+  __IOM uint32_t CONSUMER_TIMER0_CC0;
+  __IOM uint32_t CONSUMER_TIMER0_CC1;
+  __IOM uint32_t CONSUMER_TIMER0_CC2;
+  __IOM uint32_t CONSUMER_TIMER0_DTI;
+  __IOM uint32_t CONSUMER_TIMER0_DTIFS1;
+  __IOM uint32_t CONSUMER_TIMER0_DTIFS2;
+  __IOM uint32_t CONSUMER_TIMER1_CC0;
+  __IOM uint32_t CONSUMER_TIMER1_CC1;
+  __IOM uint32_t CONSUMER_TIMER1_CC2;
+  __IOM uint32_t CONSUMER_TIMER1_DTI;
+  __IOM uint32_t CONSUMER_TIMER1_DTIFS1;
+  __IOM uint32_t CONSUMER_TIMER1_DTIFS2;
+  __IOM uint32_t CONSUMER_USART0_CLK;
+  __IOM uint32_t CONSUMER_USART0_IR;
+  __IOM uint32_t CONSUMER_USART0_RX;
+  __IOM uint32_t CONSUMER_USART0_TRIGGER;
+  __IOM uint32_t CONSUMER_USART1_CLK;
+  __IOM uint32_t CONSUMER_USART1_IR;
+  __IOM uint32_t CONSUMER_USART1_RX;
+  __IOM uint32_t CONSUMER_USART1_TRIGGER;
+  uint32_t RESERVED0[998];
+  __IOM uint32_t CONSUMER_EUART0_RX_SET;
+  __IOM uint32_t CONSUMER_EUART0_TRIGGER_SET;
+  __IOM uint32_t CONSUMER_IADC0_SCANTRIGGER_SET;
+  __IOM uint32_t CONSUMER_IADC0_SINGLETRIGGER_SET;
+  __IOM uint32_t CONSUMER_LDMAXBAR_DMAREQ0_SET;
+  __IOM uint32_t CONSUMER_LDMAXBAR_DMAREQ1_SET;
+  __IOM uint32_t CONSUMER_TIMER0_CC0_SET;
+  __IOM uint32_t CONSUMER_TIMER0_CC1_SET;
+  __IOM uint32_t CONSUMER_TIMER0_CC2_SET;
+  __IOM uint32_t CONSUMER_TIMER0_DTI_SET;
+  __IOM uint32_t CONSUMER_TIMER0_DTIFS1_SET;
+  __IOM uint32_t CONSUMER_TIMER0_DTIFS2_SET;
+  __IOM uint32_t CONSUMER_TIMER1_CC0_SET;
+  __IOM uint32_t CONSUMER_TIMER1_CC1_SET;
+  __IOM uint32_t CONSUMER_TIMER1_CC2_SET;
+  __IOM uint32_t CONSUMER_TIMER1_DTI_SET;
+  __IOM uint32_t CONSUMER_TIMER1_DTIFS1_SET;
+  __IOM uint32_t CONSUMER_TIMER1_DTIFS2_SET;
+  __IOM uint32_t CONSUMER_USART0_CLK_SET;
+  __IOM uint32_t CONSUMER_USART0_IR_SET;
+  __IOM uint32_t CONSUMER_USART0_RX_SET;
+  __IOM uint32_t CONSUMER_USART0_TRIGGER_SET;
+  __IOM uint32_t CONSUMER_USART1_CLK_SET;
+  __IOM uint32_t CONSUMER_USART1_IR_SET;
+  __IOM uint32_t CONSUMER_USART1_RX_SET;
+  __IOM uint32_t CONSUMER_USART1_TRIGGER_SET;
+  uint32_t RESERVED1[998];
+  __IOM uint32_t CONSUMER_EUART0_RX_CLR;
+  __IOM uint32_t CONSUMER_EUART0_TRIGGER_CLR;
+  __IOM uint32_t CONSUMER_IADC0_SCANTRIGGER_CLR;
+  __IOM uint32_t CONSUMER_IADC0_SINGLETRIGGER_CLR;
+  __IOM uint32_t CONSUMER_LDMAXBAR_DMAREQ0_CLR;
+  __IOM uint32_t CONSUMER_LDMAXBAR_DMAREQ1_CLR;
+  __IOM uint32_t CONSUMER_TIMER0_CC0_CLR;
+  __IOM uint32_t CONSUMER_TIMER0_CC1_CLR;
+  __IOM uint32_t CONSUMER_TIMER0_CC2_CLR;
+  __IOM uint32_t CONSUMER_TIMER0_DTI_CLR;
+  __IOM uint32_t CONSUMER_TIMER0_DTIFS1_CLR;
+  __IOM uint32_t CONSUMER_TIMER0_DTIFS2_CLR;
+  __IOM uint32_t CONSUMER_TIMER1_CC0_CLR;
+  __IOM uint32_t CONSUMER_TIMER1_CC1_CLR;
+  __IOM uint32_t CONSUMER_TIMER1_CC2_CLR;
+  __IOM uint32_t CONSUMER_TIMER1_DTI_CLR;
+  __IOM uint32_t CONSUMER_TIMER1_DTIFS1_CLR;
+  __IOM uint32_t CONSUMER_TIMER1_DTIFS2_CLR;
+  __IOM uint32_t CONSUMER_USART0_CLK_CLR;
+  __IOM uint32_t CONSUMER_USART0_IR_CLR;
+  __IOM uint32_t CONSUMER_USART0_RX_CLR;
+  __IOM uint32_t CONSUMER_USART0_TRIGGER_CLR;
+  __IOM uint32_t CONSUMER_USART1_CLK_CLR;
+  __IOM uint32_t CONSUMER_USART1_IR_CLR;
+  __IOM uint32_t CONSUMER_USART1_RX_CLR;
+  __IOM uint32_t CONSUMER_USART1_TRIGGER_CLR;
+  uint32_t RESERVED2[998];
+  __IOM uint32_t CONSUMER_EUART0_RX_TGL;
+  __IOM uint32_t CONSUMER_EUART0_TRIGGER_TGL;
+  __IOM uint32_t CONSUMER_IADC0_SCANTRIGGER_TGL;
+  __IOM uint32_t CONSUMER_IADC0_SINGLETRIGGER_TGL;
+  __IOM uint32_t CONSUMER_LDMAXBAR_DMAREQ0_TGL;
+  __IOM uint32_t CONSUMER_LDMAXBAR_DMAREQ1_TGL;
+  __IOM uint32_t CONSUMER_TIMER0_CC0_TGL;
+  __IOM uint32_t CONSUMER_TIMER0_CC1_TGL;
+  __IOM uint32_t CONSUMER_TIMER0_CC2_TGL;
+  __IOM uint32_t CONSUMER_TIMER0_DTI_TGL;
+  __IOM uint32_t CONSUMER_TIMER0_DTIFS1_TGL;
+  __IOM uint32_t CONSUMER_TIMER0_DTIFS2_TGL;
+  __IOM uint32_t CONSUMER_TIMER1_CC0_TGL;
+  __IOM uint32_t CONSUMER_TIMER1_CC1_TGL;
+  __IOM uint32_t CONSUMER_TIMER1_CC2_TGL;
+  __IOM uint32_t CONSUMER_TIMER1_DTI_TGL;
+  __IOM uint32_t CONSUMER_TIMER1_DTIFS1_TGL;
+  __IOM uint32_t CONSUMER_TIMER1_DTIFS2_TGL;
+  __IOM uint32_t CONSUMER_USART0_CLK_TGL;
+  __IOM uint32_t CONSUMER_USART0_IR_TGL;
+  __IOM uint32_t CONSUMER_USART0_RX_TGL;
+  __IOM uint32_t CONSUMER_USART0_TRIGGER_TGL;
+  __IOM uint32_t CONSUMER_USART1_CLK_TGL;
+  __IOM uint32_t CONSUMER_USART1_IR_TGL;
+  __IOM uint32_t CONSUMER_USART1_RX_TGL;
+  __IOM uint32_t CONSUMER_USART1_TRIGGER_TGL;
+  uint32_t RESERVED3[998];
+} PRS_TypeDef;
+
+/* Bit fields for PRS CONSUMER_EUART0_RX */
+#define _PRS_CONSUMER_EUART0_RX_RESETVALUE                0x00000000UL
+#define _PRS_CONSUMER_EUART0_RX_MASK                      0x00000000UL
+
+/* Bit fields for PRS CONSUMER_EUART0_TRIGGER */
+#define _PRS_CONSUMER_EUART0_TRIGGER_RESETVALUE           0x00000000UL
+#define _PRS_CONSUMER_EUART0_TRIGGER_MASK                 0x00000000UL
+
+/* Bit fields for PRS CONSUMER_IADC0_SCANTRIGGER */
+#define _PRS_CONSUMER_IADC0_SCANTRIGGER_RESETVALUE        0x00000000UL
+#define _PRS_CONSUMER_IADC0_SCANTRIGGER_MASK              0x00000000UL
+
+/* Bit fields for PRS CONSUMER_IADC0_SINGLETRIGGER */
+#define _PRS_CONSUMER_IADC0_SINGLETRIGGER_RESETVALUE      0x00000000UL
+#define _PRS_CONSUMER_IADC0_SINGLETRIGGER_MASK            0x00000000UL
+
+/* Bit fields for PRS CONSUMER_LDMAXBAR_DMAREQ0 */
+#define _PRS_CONSUMER_LDMAXBAR_DMAREQ0_RESETVALUE         0x00000000UL
+#define _PRS_CONSUMER_LDMAXBAR_DMAREQ0_MASK               0x00000000UL
+
+/* Bit fields for PRS CONSUMER_LDMAXBAR_DMAREQ1 */
+#define _PRS_CONSUMER_LDMAXBAR_DMAREQ1_RESETVALUE         0x00000000UL
+#define _PRS_CONSUMER_LDMAXBAR_DMAREQ1_MASK               0x00000000UL
+
+/* Bit fields for PRS CONSUMER_TIMER0_CC0 */
+#define _PRS_CONSUMER_TIMER0_CC0_RESETVALUE               0x00000000UL
+#define _PRS_CONSUMER_TIMER0_CC0_MASK                     0x00000003UL
+#define PRS_CONSUMER_TIMER0_CC0_PRSSEL                    (0x1UL << 0)
+#define _PRS_CONSUMER_TIMER0_CC0_PRSSEL_SHIFT             0
+#define _PRS_CONSUMER_TIMER0_CC0_PRSSEL_MASK              0x1UL
+#define _PRS_CONSUMER_TIMER0_CC0_PRSSEL_DEFAULT           0x00000000UL
+#define PRS_CONSUMER_TIMER0_CC0_PRSSEL_DEFAULT            (_PRS_CONSUMER_TIMER0_CC0_PRSSEL_DEFAULT << 0)
+#define PRS_CONSUMER_TIMER0_CC0_SPRSSEL                   (0x1UL << 1)
+#define _PRS_CONSUMER_TIMER0_CC0_SPRSSEL_SHIFT            1
+#define _PRS_CONSUMER_TIMER0_CC0_SPRSSEL_MASK             0x2UL
+#define _PRS_CONSUMER_TIMER0_CC0_SPRSSEL_DEFAULT          0x00000000UL
+#define PRS_CONSUMER_TIMER0_CC0_SPRSSEL_DEFAULT           (_PRS_CONSUMER_TIMER0_CC0_SPRSSEL_DEFAULT << 1)
+
+/* Bit fields for PRS CONSUMER_TIMER0_CC1 */
+#define _PRS_CONSUMER_TIMER0_CC1_RESETVALUE               0x00000000UL
+#define _PRS_CONSUMER_TIMER0_CC1_MASK                     0x00000000UL
+
+/* Bit fields for PRS CONSUMER_TIMER0_CC2 */
+#define _PRS_CONSUMER_TIMER0_CC2_RESETVALUE               0x00000000UL
+#define _PRS_CONSUMER_TIMER0_CC2_MASK                     0x00000000UL
+
+/* Bit fields for PRS CONSUMER_TIMER0_DTI */
+#define _PRS_CONSUMER_TIMER0_DTI_RESETVALUE               0x00000000UL
+#define _PRS_CONSUMER_TIMER0_DTI_MASK                     0x00000000UL
+
+/* Bit fields for PRS CONSUMER_TIMER0_DTIFS1 */
+#define _PRS_CONSUMER_TIMER0_DTIFS1_RESETVALUE            0x00000000UL
+#define _PRS_CONSUMER_TIMER0_DTIFS1_MASK                  0x00000000UL
+
+/* Bit fields for PRS CONSUMER_TIMER0_DTIFS2 */
+#define _PRS_CONSUMER_TIMER0_DTIFS2_RESETVALUE            0x00000000UL
+#define _PRS_CONSUMER_TIMER0_DTIFS2_MASK                  0x00000000UL
+
+/* Bit fields for PRS CONSUMER_TIMER1_CC0 */
+#define _PRS_CONSUMER_TIMER1_CC0_RESETVALUE               0x00000000UL
+#define _PRS_CONSUMER_TIMER1_CC0_MASK                     0x00000000UL
+
+/* Bit fields for PRS CONSUMER_TIMER1_CC1 */
+#define _PRS_CONSUMER_TIMER1_CC1_RESETVALUE               0x00000000UL
+#define _PRS_CONSUMER_TIMER1_CC1_MASK                     0x00000000UL
+
+/* Bit fields for PRS CONSUMER_TIMER1_CC2 */
+#define _PRS_CONSUMER_TIMER1_CC2_RESETVALUE               0x00000000UL
+#define _PRS_CONSUMER_TIMER1_CC2_MASK                     0x00000000UL
+
+/* Bit fields for PRS CONSUMER_TIMER1_DTI */
+#define _PRS_CONSUMER_TIMER1_DTI_RESETVALUE               0x00000000UL
+#define _PRS_CONSUMER_TIMER1_DTI_MASK                     0x00000000UL
+
+/* Bit fields for PRS CONSUMER_TIMER1_DTIFS1 */
+#define _PRS_CONSUMER_TIMER1_DTIFS1_RESETVALUE            0x00000000UL
+#define _PRS_CONSUMER_TIMER1_DTIFS1_MASK                  0x00000000UL
+
+/* Bit fields for PRS CONSUMER_TIMER1_DTIFS2 */
+#define _PRS_CONSUMER_TIMER1_DTIFS2_RESETVALUE            0x00000000UL
+#define _PRS_CONSUMER_TIMER1_DTIFS2_MASK                  0x00000000UL
+
+/* Bit fields for PRS CONSUMER_USART0_CLK */
+#define _PRS_CONSUMER_USART0_CLK_RESETVALUE               0x00000000UL
+#define _PRS_CONSUMER_USART0_CLK_MASK                     0x00000000UL
+
+/* Bit fields for PRS CONSUMER_USART0_IR */
+#define _PRS_CONSUMER_USART0_IR_RESETVALUE                0x00000000UL
+#define _PRS_CONSUMER_USART0_IR_MASK                      0x00000000UL
+
+/* Bit fields for PRS CONSUMER_USART0_RX */
+#define _PRS_CONSUMER_USART0_RX_RESETVALUE                0x00000000UL
+#define _PRS_CONSUMER_USART0_RX_MASK                      0x00000000UL
+
+/* Bit fields for PRS CONSUMER_USART0_TRIGGER */
+#define _PRS_CONSUMER_USART0_TRIGGER_RESETVALUE           0x00000000UL
+#define _PRS_CONSUMER_USART0_TRIGGER_MASK                 0x00000000UL
+
+/* Bit fields for PRS CONSUMER_USART1_CLK */
+#define _PRS_CONSUMER_USART1_CLK_RESETVALUE               0x00000000UL
+#define _PRS_CONSUMER_USART1_CLK_MASK                     0x00000000UL
+
+/* Bit fields for PRS CONSUMER_USART1_IR */
+#define _PRS_CONSUMER_USART1_IR_RESETVALUE                0x00000000UL
+#define _PRS_CONSUMER_USART1_IR_MASK                      0x00000000UL
+
+/* Bit fields for PRS CONSUMER_USART1_RX */
+#define _PRS_CONSUMER_USART1_RX_RESETVALUE                0x00000000UL
+#define _PRS_CONSUMER_USART1_RX_MASK                      0x00000000UL
+
+/* Bit fields for PRS CONSUMER_USART1_TRIGGER */
+#define _PRS_CONSUMER_USART1_TRIGGER_RESETVALUE           0x00000000UL
+#define _PRS_CONSUMER_USART1_TRIGGER_MASK                 0x00000000UL
+
+#endif // SIM_REGS_H
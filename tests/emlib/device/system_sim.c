@@ -0,0 +1,112 @@
+/*
+ *  System clock functions of the simulated device
+ *
+ *  Like the CMSIS system file of a Series 2 device: the oscillator
+ *  frequencies are variables set by emlib, the SYSCLK and HCLK frequencies
+ *  are read from the CMU.
+ */
+
+#include "em_device.h"
+
+uint32_t SystemCoreClock = EFR32_FSRCO_FREQ;
+uint32_t SystemHfrcoFreq = EFR32_HFRCODPLL_FREQ;
+
+static uint32_t SystemHFXOClock  = EFR32_HFXO_FREQ;
+static uint32_t SystemLFXOClock  = EFR32_LFXO_FREQ;
+
+void SystemInit(void)
+{
+  SystemCoreClockUpdate();
+}
+
+uint32_t SystemSYSCLKGet(void)
+{
+  switch (CMU->SYSCLKCTRL & _CMU_SYSCLKCTRL_CLKSEL_MASK) {
+    case CMU_SYSCLKCTRL_CLKSEL_HFRCODPLL:
+      return SystemHfrcoFreq;
+
+    case CMU_SYSCLKCTRL_CLKSEL_HFXO:
+      return SystemHFXOClock;
+
+    case CMU_SYSCLKCTRL_CLKSEL_CLKIN0:
+      return EFR32_CLKIN0_FREQ;
+
+    case CMU_SYSCLKCTRL_CLKSEL_FSRCO:
+    default:
+      return EFR32_FSRCO_FREQ;
+  }
+}
+
+uint32_t SystemHCLKGet(void)
+{
+  uint32_t presc = (CMU->SYSCLKCTRL & _CMU_SYSCLKCTRL_HCLKPRESC_MASK)
+                   >> _CMU_SYSCLKCTRL_HCLKPRESC_SHIFT;
+
+  return SystemSYSCLKGet() / (presc + 1U);
+}
+
+uint32_t SystemCoreClockGet(void)
+{
+  SystemCoreClock = SystemHCLKGet();
+  return SystemCoreClock;
+}
+
+void SystemCoreClockUpdate(void)
+{
+  (void)SystemCoreClockGet();
+}
+
+uint32_t SystemMaxCoreClockGet(void)
+{
+  return EFR32_HFRCODPLL_MAX_FREQ;
+}
+
+uint32_t SystemFSRCOClockGet(void)
+{
+  return EFR32_FSRCO_FREQ;
+}
+
+uint32_t SystemHFRCODPLLClockGet(void)
+{
+  return SystemHfrcoFreq;
+}
+
+void SystemHFRCODPLLClockSet(uint32_t freq)
+{
+  SystemHfrcoFreq = freq;
+}
+
+uint32_t SystemHFXOClockGet(void)
+{
+  return SystemHFXOClock;
+}
+
+void SystemHFXOClockSet(uint32_t freq)
+{
+  SystemHFXOClock = freq;
+}
+
+uint32_t SystemCLKIN0Get(void)
+{
+  return EFR32_CLKIN0_FREQ;
+}
+
+uint32_t SystemLFRCOClockGet(void)
+{
+  return EFR32_LFRCO_FREQ;
+}
+
+uint32_t SystemULFRCOClockGet(void)
+{
+  return EFR32_ULFRCO_FREQ;
+}
+
+uint32_t SystemLFXOClockGet(void)
+{
+  return SystemLFXOClock;
+}
+
+void SystemLFXOClockSet(uint32_t freq)
+{
+  SystemLFXOClock = freq;
+}
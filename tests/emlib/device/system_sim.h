@@ -0,0 +1,47 @@
+/*
+ *  System clock functions of the simulated device, see system_sim.c
+ */
+
+#ifndef SYSTEM_SIM_H
+#define SYSTEM_SIM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EFR32_FSRCO_FREQ                       (20000000UL)
+#define EFR32_HFRCODPLL_FREQ                   (19000000UL)
+#define EFR32_HFRCODPLL_MAX_FREQ               (80000000UL)
+#define EFR32_HFXO_FREQ                        (38400000UL)
+#define EFR32_LFRCO_FREQ                       (32768UL)
+#define EFR32_ULFRCO_FREQ                      (1000UL)
+#define EFR32_LFXO_FREQ                        (32768UL)
+#define EFR32_CLKIN0_FREQ                      (0UL)
+
+extern uint32_t SystemCoreClock;
+extern uint32_t SystemHfrcoFreq;
+
+void SystemInit(void);
+uint32_t SystemCoreClockGet(void);
+void SystemCoreClockUpdate(void);
+uint32_t SystemSYSCLKGet(void);
+uint32_t SystemHCLKGet(void);
+uint32_t SystemMaxCoreClockGet(void);
+uint32_t SystemFSRCOClockGet(void);
+uint32_t SystemHFRCODPLLClockGet(void);
+void SystemHFRCODPLLClockSet(uint32_t freq);
+uint32_t SystemHFXOClockGet(void);
+void SystemHFXOClockSet(uint32_t freq);
+uint32_t SystemCLKIN0Get(void);
+uint32_t SystemLFRCOClockGet(void);
+uint32_t SystemULFRCOClockGet(void);
+uint32_t SystemLFXOClockGet(void);
+void SystemLFXOClockSet(uint32_t freq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SYSTEM_SIM_H
@@ -0,0 +1,796 @@
+/*
+ *  Register trapping, virtual time and interrupts of the simulated device
+ *
+ *  Each block is a memfd mapped twice: at its device address, where it is
+ *  inaccessible while trapping, and anywhere else for the models. An access
+ *  to the device mapping raises SIGSEGV. The handler runs the read hook,
+ *  opens the page and sets the trap flag, so the instruction completes and
+ *  raises SIGTRAP. That handler closes the page again, applies the alias
+ *  semantics, runs the write hook and dispatches the interrupts the access
+ *  made pending. Both handlers use SA_NODEFER: interrupt handlers run from
+ *  the SIGTRAP handler and access registers in turn.
+ *
+ *  Reading the same value from the same register POLL_READS times in a row,
+ *  with no register written in between, is taken as a polling loop: virtual
+ *  time then jumps to the next event, the only thing that can change the
+ *  value, so busy-waits on slow operations cost a few accesses.
+ *  sim_poll_skip_set() turns this off for tests timing events to the access.
+ *
+ *  The x86-64 page fault error code tells reads from writes. An instruction
+ *  reading and writing a register, e.g. "orl $1, (reg)", is seen as a write
+ *  only. gcc does not combine volatile accesses that way at -O2.
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "sim.h"
+
+#define PAGE_SIZE          4096U
+#define BLOCK_MAX          48U
+#define PENDING_MAX        4U
+#define POLL_READS         4U
+#define EFLAGS_TF          0x100U
+#define PF_WRITE           0x2U
+
+#define IRQ_WORDS          ((EXT_IRQ_COUNT + 31) / 32)
+#define DEFAULT_LIMIT_NS   10000000000ULL
+
+/* System control space, relative to SCS_BASE */
+#define SCS_ISER           0x100U
+#define SCS_ICER           0x180U
+#define SCS_ISPR           0x200U
+#define SCS_ICPR           0x280U
+#define SCS_IABR           0x300U
+#define SCS_IPR            0x400U
+#define SCS_ICSR           0xD04U
+#define SCS_AIRCR          0xD0CU
+
+typedef struct {
+  sim_block_t *block;
+  uint32_t     offset;     // Word aligned offset of the access
+  uint32_t     old;        // Register value before a write
+  bool         write;
+  void        *page;
+} access_t;
+
+typedef struct {
+  uint32_t enabled[IRQ_WORDS];
+  uint32_t pending[IRQ_WORDS];
+  uint32_t active[IRQ_WORDS];
+  uint32_t level[IRQ_WORDS];
+  uint32_t count[EXT_IRQ_COUNT];
+  unsigned running;        // Priority of the running handler, 256 in thread mode
+  int      vector;         // Active exception number, 0 in thread mode
+} nvic_t;
+
+typedef struct {
+  sim_block_t *block;      // Register read last, NULL after a write
+  uint32_t     offset;
+  uint32_t     value;
+  unsigned     count;      // Times the value was read in a row
+} poll_t;
+
+typedef struct {
+  uint64_t time;           // Virtual time of the last CYCCNT update
+  uint32_t cyccnt;
+} dwt_t;
+
+sim_core_t sim_core;
+
+static sim_block_t  blocks[BLOCK_MAX];
+static unsigned     block_count;
+static access_t     pending[PENDING_MAX];
+static unsigned     pending_count;
+static poll_t       poll;
+static bool         poll_skip = true;
+static bool         trapping = true;
+static bool         initialized;
+
+static uint64_t     now;
+static uint64_t     limit = DEFAULT_LIMIT_NS;
+static sim_event_t *events;
+static bool         running_events;
+
+static nvic_t       nvic;
+static dwt_t        dwt;
+static sim_block_t *scs_block;
+static sim_block_t *dwt_block;
+
+/* Interrupt handlers the test may define */
+#define SIM_IRQS(X)                                                       \
+  X(CRYPTO) X(EMU) X(TIMER0) X(TIMER1) X(TIMER2) X(TIMER3) X(TIMER4)      \
+  X(USART0_RX) X(USART0_TX) X(USART1_RX) X(USART1_TX) X(SYSCFG) X(LDMA)   \
+  X(LFXO) X(LFRCO) X(ULFRCO) X(GPIO_ODD) X(GPIO_EVEN) X(I2C0) X(I2C1)     \
+  X(IADC) X(MSC) X(HFXO0) X(HFRCO0) X(CMU) X(FSRCO) X(DPLL0)              \
+  X(EUART0_RX) X(EUART0_TX)
+
+#define SIM_IRQ_DECLARE(name) extern void name##_IRQHandler(void) __attribute__((weak));
+SIM_IRQS(SIM_IRQ_DECLARE)
+
+#define SIM_IRQ_VECTOR(name) [name##_IRQn] = name##_IRQHandler,
+static void (*const vectors[EXT_IRQ_COUNT])(void) = {
+  SIM_IRQS(SIM_IRQ_VECTOR)
+};
+
+#define SIM_IRQ_NAME(name) [name##_IRQn] = #name,
+static const char *const irq_names[EXT_IRQ_COUNT] = {
+  SIM_IRQS(SIM_IRQ_NAME)
+};
+
+/***************************************************************************//**
+ * Errors
+ ******************************************************************************/
+
+void sim_error(const char *format, ...)
+{
+  va_list args;
+
+  fflush(stdout);
+  fprintf(stderr, "sim error at %llu ns: ", (unsigned long long)now);
+  va_start(args, format);
+  vfprintf(stderr, format, args);
+  va_end(args);
+  fprintf(stderr, "\n");
+  exit(2);
+}
+
+void __NVIC_SystemReset(void)
+{
+  sim_error("system reset requested");
+}
+
+/***************************************************************************//**
+ * Blocks
+ ******************************************************************************/
+
+static int block_protection(const sim_block_t *block)
+{
+  if (trapping && !(block->flags & SIM_BLOCK_UNTRAPPED)) {
+    return PROT_NONE;
+  }
+  if (block->flags & SIM_BLOCK_READ_ONLY) {
+    return PROT_READ;
+  }
+  return PROT_READ | PROT_WRITE;
+}
+
+sim_block_t *sim_block_add(const char *name, uintptr_t base, uint32_t size,
+                           uint32_t flags, sim_read_hook_t read,
+                           sim_write_hook_t write, void *model)
+{
+  sim_block_t *block;
+  void        *device;
+  void        *shadow;
+  int          fd;
+
+  if (block_count == BLOCK_MAX) {
+    sim_error("too many blocks");
+  }
+  size  = (size + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+  block = &blocks[block_count++];
+  memset(block, 0, sizeof(*block));
+  block->name  = name;
+  block->base  = base;
+  block->size  = size;
+  block->flags = flags;
+  block->read  = read;
+  block->write = write;
+  block->model = model;
+
+  fd = memfd_create(name, 0);
+  if ((fd < 0) || (ftruncate(fd, size) != 0)) {
+    sim_error("%s: memfd: %s", name, strerror(errno));
+  }
+  shadow = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  device = mmap((void *)base, size, block_protection(block),
+                MAP_SHARED | MAP_FIXED_NOREPLACE, fd, 0);
+  close(fd);
+  if ((shadow == MAP_FAILED) || (device != (void *)base)) {
+    sim_error("%s: cannot map 0x%08lx, build with -no-pie",
+              name, (unsigned long)base);
+  }
+  block->regs = shadow;
+  return block;
+}
+
+sim_block_t *sim_block_find(uintptr_t address)
+{
+  for (unsigned i = 0; i < block_count; i++) {
+    if ((address >= blocks[i].base)
+        && (address - blocks[i].base < blocks[i].size)) {
+      return &blocks[i];
+    }
+  }
+  return NULL;
+}
+
+void sim_block_clock(sim_block_t *block, unsigned clken_reg, unsigned bit)
+{
+  block->clken_reg = (uint8_t)(clken_reg + 1);
+  block->clken_bit = (uint8_t)bit;
+}
+
+void sim_trap_set(bool trap)
+{
+  trapping = trap;
+  for (unsigned i = 0; i < block_count; i++) {
+    sim_block_t *block = &blocks[i];
+
+    if (block->flags & SIM_BLOCK_ALIASES) {
+      // Stores made while not trapping left values in the aliases
+      memset((void *)&block->regs[SIM_ALIAS_SET / 4], 0,
+             block->size - SIM_ALIAS_SET);
+    }
+    mprotect((void *)block->base, block->size, block_protection(block));
+  }
+}
+
+/* Splits an offset into the register offset and the alias, 0 for none */
+static uint32_t block_register(const sim_block_t *block, uint32_t offset,
+                               unsigned *alias)
+{
+  if (block->flags & SIM_BLOCK_ALIASES) {
+    *alias = offset >> 12;
+    return offset & 0xFFFU;
+  }
+  *alias = 0;
+  return offset;
+}
+
+static void block_check_clock(const sim_block_t *block)
+{
+  if ((block->clken_reg != 0)
+      && !sim_cmu_clock_enabled(block->clken_reg - 1U, block->clken_bit)) {
+    sim_error("%s accessed with its clock disabled", block->name);
+  }
+}
+
+/* Runs before a read, the register value is then in regs[offset] */
+static void access_read(sim_block_t *block, uint32_t offset)
+{
+  unsigned alias;
+  uint32_t reg = block_register(block, offset, &alias);
+
+  if (block->read != NULL) {
+    block->read(block, reg);
+  }
+  if (alias != 0) {
+    block->regs[offset / 4] = block->regs[reg / 4];
+  }
+}
+
+/* Runs after a write, value is the word in regs[offset] */
+static void access_write(sim_block_t *block, uint32_t offset, uint32_t old)
+{
+  unsigned alias;
+  uint32_t reg   = block_register(block, offset, &alias);
+  uint32_t value = block->regs[offset / 4];
+
+  if (alias != 0) {
+    block->regs[offset / 4] = 0;
+    if (alias == 1) {
+      block->regs[reg / 4] = old | value;
+    } else if (alias == 2) {
+      block->regs[reg / 4] = old & ~value;
+    } else {
+      block->regs[reg / 4] = old ^ value;
+    }
+  }
+  if (block->write != NULL) {
+    block->write(block, reg, old, value);
+  }
+}
+
+uint32_t sim_bus_read(uint32_t address, unsigned size)
+{
+  sim_block_t *block = sim_block_find(address);
+  uint32_t     value;
+  uint32_t     offset;
+
+  if (block == NULL) {
+    if (size == 1) {
+      return *(volatile uint8_t *)(uintptr_t)address;
+    }
+    if (size == 2) {
+      return *(volatile uint16_t *)(uintptr_t)address;
+    }
+    return *(volatile uint32_t *)(uintptr_t)address;
+  }
+  offset = (address - block->base) & ~3U;
+  if (!(block->flags & SIM_BLOCK_UNTRAPPED)) {
+    block_check_clock(block);
+    access_read(block, offset);
+  }
+  value = block->regs[offset / 4] >> ((address & 3U) * 8);
+  if ((block->flags & SIM_BLOCK_ALIASES) && (offset >= SIM_ALIAS_SET)) {
+    block->regs[offset / 4] = 0;
+  }
+  return (size == 4) ? value : (value & ((1U << (size * 8)) - 1U));
+}
+
+void sim_bus_write(uint32_t address, uint32_t value, unsigned size)
+{
+  sim_block_t *block = sim_block_find(address);
+  uint32_t     offset;
+  uint32_t     old;
+  uint32_t     shift;
+  uint32_t     mask;
+
+  if (block == NULL) {
+    if (size == 1) {
+      *(volatile uint8_t *)(uintptr_t)address = (uint8_t)value;
+    } else if (size == 2) {
+      *(volatile uint16_t *)(uintptr_t)address = (uint16_t)value;
+    } else {
+      *(volatile uint32_t *)(uintptr_t)address = value;
+    }
+    return;
+  }
+  if (block->flags & SIM_BLOCK_READ_ONLY) {
+    sim_error("bus write to read-only %s at 0x%08x", block->name, address);
+  }
+  offset = (address - block->base) & ~3U;
+  block_check_clock(block);
+  shift = (address & 3U) * 8;
+  mask  = (size == 4) ? 0xFFFFFFFFU : (((1U << (size * 8)) - 1U) << shift);
+  {
+    unsigned alias;
+    uint32_t reg = block_register(block, offset, &alias);
+
+    old = block->regs[reg / 4];
+    block->regs[offset / 4] = (alias != 0 ? 0 : old & ~mask) | ((value << shift) & mask);
+  }
+  if (!(block->flags & SIM_BLOCK_UNTRAPPED)) {
+    access_write(block, offset, old);
+  }
+}
+
+/***************************************************************************//**
+ * Trap handlers
+ ******************************************************************************/
+
+/* Called after the read hook: skips to the next event when the read looks
+   like one more turn of a polling loop */
+static void poll_check(sim_block_t *block, uint32_t offset)
+{
+  uint32_t value = block->regs[offset / 4];
+
+  if (!poll_skip) {
+    return;
+  }
+  if ((poll.block != block) || (poll.offset != offset) || (poll.value != value)) {
+    poll.block  = block;
+    poll.offset = offset;
+    poll.value  = value;
+    poll.count  = 1;
+    return;
+  }
+  if ((++poll.count >= POLL_READS) && (events != NULL)) {
+    sim_time_advance(events->due - now);
+    access_read(block, offset);
+    poll.value = block->regs[offset / 4];
+    poll.count = 1;
+  }
+}
+
+static void on_segv(int signal, siginfo_t *info, void *context)
+{
+  ucontext_t  *uc      = context;
+  uintptr_t    address = (uintptr_t)info->si_addr;
+  sim_block_t *block   = sim_block_find(address);
+  bool         write   = (uc->uc_mcontext.gregs[REG_ERR] & PF_WRITE) != 0;
+  access_t    *access;
+
+  (void)signal;
+  if (block == NULL) {
+    fprintf(stderr, "sim: invalid access to %p\n", info->si_addr);
+    abort();
+  }
+  if ((block->flags & SIM_BLOCK_READ_ONLY) && write) {
+    sim_error("write to read-only %s at 0x%08lx", block->name,
+              (unsigned long)address);
+  }
+  if (pending_count == PENDING_MAX) {
+    sim_error("too many register accesses in one instruction");
+  }
+
+  sim_time_advance(SIM_ACCESS_NS);
+  block_check_clock(block);
+
+  access         = &pending[pending_count++];
+  access->block  = block;
+  access->offset = (uint32_t)(address - block->base) & ~3U;
+  access->write  = write;
+  access->page   = (void *)(address & ~(uintptr_t)(PAGE_SIZE - 1));
+  if (write) {
+    unsigned alias;
+    uint32_t reg = block_register(block, access->offset, &alias);
+
+    block->writes++;
+    poll.block  = NULL;
+    access->old = block->regs[reg / 4];
+    if (alias != 0) {
+      block->regs[access->offset / 4] = 0;
+    }
+  } else {
+    block->reads++;
+    access_read(block, access->offset);
+    poll_check(block, access->offset);
+  }
+
+  mprotect(access->page, PAGE_SIZE, PROT_READ | PROT_WRITE);
+  uc->uc_mcontext.gregs[REG_EFL] |= EFLAGS_TF;
+}
+
+static void on_trap(int signal, siginfo_t *info, void *context)
+{
+  ucontext_t *uc = context;
+  access_t    done[PENDING_MAX];
+  unsigned    count = pending_count;
+
+  (void)signal;
+  (void)info;
+  if (count == 0) {
+    return;
+  }
+  uc->uc_mcontext.gregs[REG_EFL] &= ~(greg_t)EFLAGS_TF;
+  memcpy(done, pending, sizeof(done[0]) * count);
+  pending_count = 0;
+
+  for (unsigned i = 0; i < count; i++) {
+    mprotect(done[i].page, PAGE_SIZE, block_protection(done[i].block));
+  }
+  for (unsigned i = 0; i < count; i++) {
+    sim_block_t *block = done[i].block;
+
+    if (done[i].write) {
+      access_write(block, done[i].offset, done[i].old);
+    } else if ((block->flags & SIM_BLOCK_ALIASES)
+               && (done[i].offset >= SIM_ALIAS_SET)) {
+      block->regs[done[i].offset / 4] = 0;
+    }
+  }
+  sim_irq_poll();
+}
+
+/***************************************************************************//**
+ * Virtual time
+ ******************************************************************************/
+
+uint64_t sim_time(void)
+{
+  return now;
+}
+
+void sim_poll_skip_set(bool skip)
+{
+  poll_skip = skip;
+  poll.block = NULL;
+}
+
+void sim_time_limit_set(uint64_t limit_ns)
+{
+  limit = limit_ns;
+}
+
+void sim_time_advance(uint64_t ns)
+{
+  uint64_t target = now + ns;
+
+  if (!running_events) {
+    running_events = true;
+    while ((events != NULL) && (events->due <= target)) {
+      sim_event_t *event = events;
+
+      events        = event->next;
+      event->queued = false;
+      now           = event->due;
+      event->fn(event);
+    }
+    running_events = false;
+  }
+  now = target;
+  if (now > limit) {
+    sim_error("time limit reached, the code waits for something the models "
+              "do not do");
+  }
+}
+
+void sim_event_init(sim_event_t *event, void (*fn)(sim_event_t *event), void *arg)
+{
+  memset(event, 0, sizeof(*event));
+  event->fn  = fn;
+  event->arg = arg;
+}
+
+void sim_event_schedule(sim_event_t *event, uint64_t delay_ns)
+{
+  sim_event_t **link = &events;
+
+  sim_event_cancel(event);
+  event->due = now + delay_ns;
+  while ((*link != NULL) && ((*link)->due <= event->due)) {
+    link = &(*link)->next;
+  }
+  event->next   = *link;
+  event->queued = true;
+  *link         = event;
+}
+
+void sim_event_cancel(sim_event_t *event)
+{
+  if (event->queued) {
+    for (sim_event_t **link = &events; *link != NULL; link = &(*link)->next) {
+      if (*link == event) {
+        *link = event->next;
+        break;
+      }
+    }
+    event->queued = false;
+  }
+}
+
+uint64_t sim_cycles_ns(uint64_t cycles, uint32_t freq)
+{
+  if (freq == 0) {
+    sim_error("clock stopped");
+  }
+  return (cycles * 1000000000ULL + freq - 1) / freq;
+}
+
+/***************************************************************************//**
+ * NVIC
+ ******************************************************************************/
+
+static unsigned irq_priority(int irq)
+{
+  uint32_t ipr = scs_block->regs[(SCS_IPR + (uint32_t)irq) / 4];
+
+  return (ipr >> ((irq & 3) * 8)) & (0xFFU << (8U - __NVIC_PRIO_BITS)) & 0xFFU;
+}
+
+static bool irq_bit(const uint32_t *words, int irq)
+{
+  return (words[irq / 32] >> (irq % 32)) & 1U;
+}
+
+/* Highest priority interrupt that would preempt, -1 if none. WFI wakes up
+   for it regardless of PRIMASK. */
+static int irq_next(void)
+{
+  int      best          = -1;
+  unsigned best_priority = nvic.running;
+
+  for (int irq = 0; irq < EXT_IRQ_COUNT; irq++) {
+    unsigned priority;
+
+    if (!irq_bit(nvic.pending, irq) || !irq_bit(nvic.enabled, irq)
+        || irq_bit(nvic.active, irq)) {
+      continue;
+    }
+    priority = irq_priority(irq);
+    if ((sim_core.basepri != 0) && (priority >= sim_core.basepri)) {
+      continue;
+    }
+    if (priority < best_priority) {
+      best          = irq;
+      best_priority = priority;
+    }
+  }
+  return best;
+}
+
+static void irq_dispatch(int irq)
+{
+  unsigned running = nvic.running;
+  int      vector  = nvic.vector;
+  uint32_t bit     = 1U << (irq % 32);
+
+  if (vectors[irq] == NULL) {
+    sim_error("interrupt %s taken with no handler", irq_names[irq]);
+  }
+  nvic.pending[irq / 32] &= ~bit;
+  nvic.active[irq / 32]  |= bit;
+  nvic.running = irq_priority(irq);
+  nvic.vector  = irq + 16;
+  nvic.count[irq]++;
+
+  vectors[irq]();
+
+  nvic.active[irq / 32] &= ~bit;
+  nvic.running = running;
+  nvic.vector  = vector;
+  if (nvic.level[irq / 32] & bit) {
+    nvic.pending[irq / 32] |= bit;
+  }
+}
+
+void sim_irq_poll(void)
+{
+  int irq;
+
+  if (!initialized) {
+    return;
+  }
+  while ((sim_core.primask == 0) && ((irq = irq_next()) >= 0)) {
+    irq_dispatch(irq);
+  }
+}
+
+void sim_wait_for_event(void)
+{
+  if (irq_next() < 0) {
+    if (events == NULL) {
+      sim_error("WFI with no interrupt pending and no event scheduled");
+    }
+    sim_time_advance(events->due - now);
+  }
+  sim_irq_poll();
+}
+
+void sim_irq_line(IRQn_Type irq, bool level)
+{
+  uint32_t bit = 1U << (irq % 32);
+
+  if (level) {
+    nvic.level[irq / 32]   |= bit;
+    nvic.pending[irq / 32] |= bit;
+  } else {
+    nvic.level[irq / 32] &= ~bit;
+  }
+}
+
+void sim_irq_flags(sim_block_t *block, IRQn_Type irq, uint32_t if_offset,
+                   uint32_t ien_offset)
+{
+  sim_irq_line(irq, (block->regs[if_offset / 4] & block->regs[ien_offset / 4]) != 0);
+}
+
+uint32_t sim_irq_count(IRQn_Type irq)
+{
+  return nvic.count[irq];
+}
+
+static void scs_read(sim_block_t *block, uint32_t offset)
+{
+  uint32_t n = (offset & 0x7FU) / 4;
+
+  if ((offset >= SCS_ISER) && (offset < SCS_IPR) && (n >= IRQ_WORDS)) {
+    block->regs[offset / 4] = 0;
+  } else if ((offset >= SCS_ISER) && (offset < SCS_ISPR)) {
+    block->regs[offset / 4] = nvic.enabled[n];
+  } else if ((offset >= SCS_ISPR) && (offset < SCS_IABR)) {
+    block->regs[offset / 4] = nvic.pending[n];
+  } else if ((offset >= SCS_IABR) && (offset < SCS_IABR + 0x80U)) {
+    block->regs[offset / 4] = nvic.active[n];
+  } else if (offset == SCS_ICSR) {
+    block->regs[offset / 4] = (uint32_t)nvic.vector;
+  }
+}
+
+static void scs_write(sim_block_t *block, uint32_t offset, uint32_t old,
+                      uint32_t value)
+{
+  uint32_t n = (offset & 0x7FU) / 4;
+
+  (void)old;
+  if ((offset >= SCS_ISER) && (offset < SCS_IABR + 0x80U) && (n >= IRQ_WORDS)) {
+    return;
+  }
+  if ((offset >= SCS_ISER) && (offset < SCS_ICER)) {
+    nvic.enabled[n] |= value;
+  } else if ((offset >= SCS_ICER) && (offset < SCS_ISPR)) {
+    nvic.enabled[n] &= ~value;
+  } else if ((offset >= SCS_ISPR) && (offset < SCS_ICPR)) {
+    nvic.pending[n] |= value;
+  } else if ((offset >= SCS_ICPR) && (offset < SCS_IABR)) {
+    nvic.pending[n] &= ~value;
+  } else if ((offset == SCS_AIRCR) && ((value >> 16) == 0x05FAU)
+             && (value & 0x4U)) {
+    __NVIC_SystemReset();
+  }
+}
+
+static uint32_t dwt_cyccnt(void)
+{
+  if (!(dwt_block->regs[0] & DWT_CTRL_CYCCNTENA_Msk)) {
+    return dwt.cyccnt;
+  }
+  return dwt.cyccnt
+         + (uint32_t)((now - dwt.time) * sim_cmu_hclk() / 1000000000ULL);
+}
+
+static void dwt_read(sim_block_t *block, uint32_t offset)
+{
+  if (offset == offsetof(DWT_Type, CYCCNT)) {
+    block->regs[offset / 4] = dwt_cyccnt();
+  }
+}
+
+static void dwt_write(sim_block_t *block, uint32_t offset, uint32_t old,
+                      uint32_t value)
+{
+  if (offset == offsetof(DWT_Type, CYCCNT)) {
+    dwt.cyccnt = value;
+    dwt.time   = now;
+  } else if (offset == offsetof(DWT_Type, CTRL)) {
+    // Freeze or restart the counter where it stands
+    uint32_t ctrl = block->regs[0];
+
+    block->regs[0] = old;
+    dwt.cyccnt     = dwt_cyccnt();
+    dwt.time       = now;
+    block->regs[0] = ctrl;
+  }
+  (void)value;
+}
+
+void sim_nvic_init(void)
+{
+  scs_block = sim_block_add("SCS", SCS_BASE, PAGE_SIZE, 0,
+                            scs_read, scs_write, &nvic);
+  dwt_block = sim_block_add("DWT", DWT_BASE, PAGE_SIZE, 0,
+                            dwt_read, dwt_write, &dwt);
+  nvic.running = 256;
+}
+
+/***************************************************************************//**
+ * Setup and statistics
+ ******************************************************************************/
+
+void sim_init(void)
+{
+  struct sigaction action;
+
+  if (initialized) {
+    sim_error("sim_init() called twice");
+  }
+
+  memset(&action, 0, sizeof(action));
+  action.sa_flags = SA_SIGINFO | SA_NODEFER;
+  action.sa_sigaction = on_segv;
+  sigaction(SIGSEGV, &action, NULL);
+  action.sa_sigaction = on_trap;
+  sigaction(SIGTRAP, &action, NULL);
+
+  sim_nvic_init();
+  sim_cmu_init();
+  sim_misc_init();
+  sim_msc_init();
+  sim_ldma_init();
+  sim_timer_init();
+  sim_usart_init();
+  sim_eusart_init();
+  sim_i2c_init();
+  sim_iadc_init();
+  sim_crypto_init();
+
+  initialized = true;
+  SystemInit();
+}
+
+void sim_stats_get(sim_stats_t *stats)
+{
+  memset(stats, 0, sizeof(*stats));
+  for (unsigned i = 0; i < block_count; i++) {
+    stats->reads  += blocks[i].reads;
+    stats->writes += blocks[i].writes;
+  }
+}
+
+void sim_stats_clear(void)
+{
+  for (unsigned i = 0; i < block_count; i++) {
+    blocks[i].reads  = 0;
+    blocks[i].writes = 0;
+  }
+}
@@ -0,0 +1,236 @@
+/*
+ *  Register level simulator of the device in device/em_device.h
+ *
+ *  Every peripheral is a block of registers mapped at its device address. The
+ *  mapping is kept inaccessible, so each access emlib makes traps: sim.c
+ *  lets the instruction run on a second, writable mapping of the same memory,
+ *  single-steps it and then hands the access to the peripheral model. The
+ *  models (sim_*.c) see the registers through that second mapping and:
+ *
+ *  - refresh a register before it is read (status flags, counters, FIFOs)
+ *  - act on a register after it is written (commands, data registers)
+ *  - schedule events on a virtual clock, which advances with every register
+ *    access and jumps to the next event on WFI
+ *  - drive interrupt lines, which sim.c dispatches to the *_IRQHandler()
+ *    functions the test defines, honouring PRIMASK, BASEPRI and priorities
+ *
+ *  Writes to the SET, CLR and TGL aliases reach the model as writes to the
+ *  register itself. Reading a register of a peripheral whose CMU clock is
+ *  off, or writing a read-only mapping, stops the test with an error.
+ *
+ *  Benchmarks can turn trapping off with sim_trap_set(false): the registers
+ *  then behave as plain memory and accesses cost nothing.
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "em_device.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Virtual time taken by one register access */
+#define SIM_ACCESS_NS          20U
+
+/* Offset of the SET, CLR and TGL aliases of a register */
+#define SIM_ALIAS_SET          0x1000U
+#define SIM_ALIAS_CLR          0x2000U
+#define SIM_ALIAS_TGL          0x3000U
+
+typedef struct sim_block sim_block_t;
+
+/* Called before the register at offset is read, may update it */
+typedef void (*sim_read_hook_t)(sim_block_t *block, uint32_t offset);
+/* Called after the register at offset is written. old is its previous value,
+   value the word written, or the bits written through an alias. The register
+   already holds its new value. */
+typedef void (*sim_write_hook_t)(sim_block_t *block, uint32_t offset,
+                                 uint32_t old, uint32_t value);
+
+struct sim_block {
+  const char       *name;
+  uintptr_t         base;       // Device address
+  uint32_t          size;       // Bytes, including the aliases
+  uint32_t          flags;      // SIM_BLOCK_*
+  volatile uint32_t *regs;      // Writable mapping used by the models
+  sim_read_hook_t   read;
+  sim_write_hook_t  write;
+  uint8_t           clken_reg;  // 0: always clocked, else CMU CLKEN0 + 1 or CLKEN1 + 1
+  uint8_t           clken_bit;
+  void             *model;      // Model state
+  uint32_t          reads;      // Register accesses since sim_stats_clear()
+  uint32_t          writes;
+};
+
+#define SIM_BLOCK_ALIASES      0x1U  // SET, CLR and TGL aliases at 0x1000 steps
+#define SIM_BLOCK_READ_ONLY    0x2U  // Device mapping is read-only
+#define SIM_BLOCK_UNTRAPPED    0x4U  // Accessed as plain memory, no hooks
+
+/* Virtual time event, embedded in the model state */
+typedef struct sim_event {
+  uint64_t          due;
+  void            (*fn)(struct sim_event *event);
+  void             *arg;
+  bool              queued;
+  struct sim_event *next;
+} sim_event_t;
+
+/* Engine */
+
+/* Maps the device and resets every model, call once before using emlib */
+void sim_init(void);
+sim_block_t *sim_block_add(const char *name, uintptr_t base, uint32_t size,
+                           uint32_t flags, sim_read_hook_t read,
+                           sim_write_hook_t write, void *model);
+sim_block_t *sim_block_find(uintptr_t address);
+void sim_block_clock(sim_block_t *block, unsigned clken_reg, unsigned bit);
+
+/* Traps register accesses (the default) or lets them through as plain
+   memory, for benchmarks */
+void sim_trap_set(bool trap);
+
+/* Stops the test with a message naming the current virtual time */
+void sim_error(const char *format, ...)
+__attribute__((format(printf, 1, 2), noreturn));
+
+/* Register access from the models, as a bus master would do it, e.g. the
+   LDMA. Host memory is accessed directly. */
+uint32_t sim_bus_read(uint32_t address, unsigned size);
+void sim_bus_write(uint32_t address, uint32_t value, unsigned size);
+
+/* Virtual time */
+
+uint64_t sim_time(void);
+void sim_time_advance(uint64_t ns);
+/* Virtual time after which sim_error() stops a test waiting forever, default
+   10 seconds after sim_init() */
+void sim_time_limit_set(uint64_t limit_ns);
+/* Jumps to the next event when a read looks like a polling loop, the
+   default. Off, every access takes SIM_ACCESS_NS and events fall between
+   the accesses they are scheduled for. */
+void sim_poll_skip_set(bool skip);
+void sim_event_init(sim_event_t *event, void (*fn)(sim_event_t *event), void *arg);
+void sim_event_schedule(sim_event_t *event, uint64_t delay_ns);
+void sim_event_cancel(sim_event_t *event);
+/* Converts a number of cycles of a clock to nanoseconds, rounding up */
+uint64_t sim_cycles_ns(uint64_t cycles, uint32_t freq);
+
+/* Interrupts */
+
+/* Drives the interrupt line of a peripheral, level sensitive */
+void sim_irq_line(IRQn_Type irq, bool level);
+/* Drives the line from the IF and IEN registers of a block */
+void sim_irq_flags(sim_block_t *block, IRQn_Type irq, uint32_t if_offset,
+                   uint32_t ien_offset);
+/* Number of handlers run since sim_init() */
+uint32_t sim_irq_count(IRQn_Type irq);
+
+/* Statistics of the register accesses the code under test made */
+
+typedef struct {
+  uint32_t reads;
+  uint32_t writes;
+} sim_stats_t;
+
+void sim_stats_get(sim_stats_t *stats);
+void sim_stats_clear(void);
+
+/* Models, see the sim_*.c files */
+
+void sim_cmu_init(void);
+void sim_nvic_init(void);
+void sim_msc_init(void);
+void sim_ldma_init(void);
+void sim_timer_init(void);
+void sim_usart_init(void);
+void sim_eusart_init(void);
+void sim_i2c_init(void);
+void sim_iadc_init(void);
+void sim_crypto_init(void);
+void sim_misc_init(void);
+
+/* Clock frequencies as the clock tree is configured, in Hz */
+uint32_t sim_cmu_hclk(void);
+uint32_t sim_cmu_pclk(void);
+uint32_t sim_cmu_lspclk(void);
+uint32_t sim_cmu_em01grpaclk(void);
+uint32_t sim_cmu_iadcclk(void);
+uint32_t sim_cmu_euart0clk(void);
+bool sim_cmu_clock_enabled(unsigned clken_reg, unsigned bit);
+
+/* LDMA request lines, signal is a LDMAXBAR_CH_REQSEL_SIGSEL_* value of the
+   source, source a LDMAXBAR_CH_REQSEL_SOURCESEL_* value */
+void sim_ldma_request(uint32_t source, uint32_t signal, bool level);
+
+/* Serial lines. A USART transmits to the USART connected to it, and to itself
+   with CTRL LOOPBK set, the EUSART to itself with CFG0 LOOPBK set. Frames
+   sent to nothing are counted only. */
+void sim_usart_connect(USART_TypeDef *usart, USART_TypeDef *peer);
+uint32_t sim_usart_frames_sent(USART_TypeDef *usart);
+uint32_t sim_eusart_frames_sent(EUSART_TypeDef *eusart);
+
+/* I2C slaves. The model calls them for the bytes the master addresses to
+   them. */
+typedef struct sim_i2c_slave {
+  uint8_t  address;                                            // 7-bit
+  void   (*start)(struct sim_i2c_slave *slave, bool read);    // Addressed
+  bool   (*write)(struct sim_i2c_slave *slave, uint8_t data); // false to NACK
+  uint8_t (*read)(struct sim_i2c_slave *slave);
+  void   (*stop)(struct sim_i2c_slave *slave);
+  struct sim_i2c_slave *next;
+} sim_i2c_slave_t;
+
+void sim_i2c_attach(I2C_TypeDef *i2c, sim_i2c_slave_t *slave);
+void sim_i2c_detach(I2C_TypeDef *i2c, sim_i2c_slave_t *slave);
+/* Holds SCL low after the next address byte, for timeout tests */
+void sim_i2c_stall(I2C_TypeDef *i2c, bool stall);
+/* Ends the current transfer with a bus error, for recovery tests */
+void sim_i2c_bus_error(I2C_TypeDef *i2c);
+
+/* 24C-style EEPROM with a one byte address */
+typedef struct {
+  sim_i2c_slave_t slave;
+  uint8_t         memory[256];
+  uint8_t         pointer;
+  bool            addressed;
+} sim_eeprom_t;
+
+void sim_eeprom_init(sim_eeprom_t *eeprom, uint8_t address);
+
+/* IADC inputs, in millivolts, for the positive input mux values */
+void sim_iadc_input_set(uint32_t posinput, uint32_t millivolts);
+
+/* Flash: erases and programming go through the MSC model only */
+#define SIM_FLASH_SIZE         (512U * 1024U)
+#define SIM_FLASH_PAGE_SIZE    8192U
+
+typedef struct {
+  uint32_t page_erases;
+  uint32_t word_writes;
+  uint64_t busy_ns;        // Time the flash was busy writing or erasing
+} sim_flash_stats_t;
+
+void sim_flash_stats_get(sim_flash_stats_t *stats);
+/* Erases the whole flash without the MSC, e.g. between tests */
+void sim_flash_clear(void);
+/* Copies the SIM_FLASH_SIZE bytes of the flash out and back without the MSC,
+   to run tests from the same flash contents */
+void sim_flash_save(void *image);
+void sim_flash_restore(const void *image);
+/* Cuts the power during the operations-th program or erase operation from
+   now: the word being programmed is left half written, the page being erased
+   half erased, and the MSC stays locked until sim_flash_power_cycle() */
+void sim_flash_fail_after(uint32_t operations);
+void sim_flash_power_cycle(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SIM_H
@@ -0,0 +1,430 @@
+/*
+ *  CMU, oscillator and DPLL models
+ *
+ *  The clock tree follows the CMU select and prescaler registers. The
+ *  HFRCODPLL, HFXO and LFXO run at the frequencies system_sim.c holds, which
+ *  emlib sets when it changes a band or initializes an oscillator.
+ *
+ *  - HFXO and LFXO: FORCEEN starts the oscillator, ENS is set at once and
+ *    RDY after the startup time the timeout fields select. Clearing FORCEEN
+ *    stops it. The HFXO FSM lock clears on MANUALOVERRIDE.
+ *  - DPLL: enabling it locks after 100 reference clock cycles, or fails if
+ *    N and M do not give the HFRCODPLL frequency within 0.1%.
+ *  - Calibration: CALSTART counts the up clock for CALTOP + 1 down clock
+ *    cycles and sets CALRDY when done.
+ */
+
+#include "sim.h"
+
+#define DPLL_LOCK_CYCLES      100U
+#define HFXO_CORE_BIAS_NS     50000U
+
+typedef struct {
+  sim_block_t *cmu;
+  sim_block_t *emu;
+  sim_block_t *hfxo;
+  sim_block_t *hfrco;
+  sim_block_t *dpll;
+  sim_block_t *lfxo;
+  sim_event_t  calibration;
+  sim_event_t  hfxo_ready;
+  sim_event_t  lfxo_ready;
+  sim_event_t  dpll_lock;
+  uint32_t     dpll_result;   // IF flag the lock attempt ends with
+} cmu_model_t;
+
+static cmu_model_t cmu;
+
+#define CMU_REGS    ((CMU_TypeDef *)cmu.cmu->regs)
+#define HFXO_REGS   ((HFXO_TypeDef *)cmu.hfxo->regs)
+#define HFRCO_REGS  ((HFRCO_TypeDef *)cmu.hfrco->regs)
+#define DPLL_REGS   ((DPLL_TypeDef *)cmu.dpll->regs)
+#define LFXO_REGS   ((LFXO_TypeDef *)cmu.lfxo->regs)
+
+/***************************************************************************//**
+ * Clock tree
+ ******************************************************************************/
+
+static uint32_t lfxo_freq(void)
+{
+  return (LFXO_REGS->STATUS & LFXO_STATUS_RDY) ? SystemLFXOClockGet() : 0;
+}
+
+static uint32_t sysclk(void)
+{
+  switch (CMU_REGS->SYSCLKCTRL & _CMU_SYSCLKCTRL_CLKSEL_MASK) {
+    case CMU_SYSCLKCTRL_CLKSEL_HFRCODPLL:
+      return SystemHFRCODPLLClockGet();
+
+    case CMU_SYSCLKCTRL_CLKSEL_HFXO:
+      return SystemHFXOClockGet();
+
+    case CMU_SYSCLKCTRL_CLKSEL_CLKIN0:
+      return SystemCLKIN0Get();
+
+    case CMU_SYSCLKCTRL_CLKSEL_FSRCO:
+      return SystemFSRCOClockGet();
+
+    default:
+      return 0;
+  }
+}
+
+uint32_t sim_cmu_hclk(void)
+{
+  uint32_t presc = (CMU_REGS->SYSCLKCTRL & _CMU_SYSCLKCTRL_HCLKPRESC_MASK)
+                   >> _CMU_SYSCLKCTRL_HCLKPRESC_SHIFT;
+
+  return sysclk() / (presc + 1U);
+}
+
+uint32_t sim_cmu_pclk(void)
+{
+  uint32_t presc = (CMU_REGS->SYSCLKCTRL & _CMU_SYSCLKCTRL_PCLKPRESC_MASK)
+                   >> _CMU_SYSCLKCTRL_PCLKPRESC_SHIFT;
+
+  return sim_cmu_hclk() / (presc + 1U);
+}
+
+uint32_t sim_cmu_lspclk(void)
+{
+  return sim_cmu_pclk() / 2U;
+}
+
+uint32_t sim_cmu_em01grpaclk(void)
+{
+  switch (CMU_REGS->EM01GRPACLKCTRL & _CMU_EM01GRPACLKCTRL_CLKSEL_MASK) {
+    case CMU_EM01GRPACLKCTRL_CLKSEL_HFRCODPLL:
+      return SystemHFRCODPLLClockGet();
+
+    case CMU_EM01GRPACLKCTRL_CLKSEL_HFXO:
+      return SystemHFXOClockGet();
+
+    case CMU_EM01GRPACLKCTRL_CLKSEL_FSRCO:
+      return SystemFSRCOClockGet();
+
+    default:
+      return 0;
+  }
+}
+
+static uint32_t em23grpaclk(void)
+{
+  switch (CMU_REGS->EM23GRPACLKCTRL & _CMU_EM23GRPACLKCTRL_CLKSEL_MASK) {
+    case CMU_EM23GRPACLKCTRL_CLKSEL_LFRCO:
+      return SystemLFRCOClockGet();
+
+    case CMU_EM23GRPACLKCTRL_CLKSEL_LFXO:
+      return lfxo_freq();
+
+    case CMU_EM23GRPACLKCTRL_CLKSEL_ULFRCO:
+      return SystemULFRCOClockGet();
+
+    default:
+      return 0;
+  }
+}
+
+uint32_t sim_cmu_iadcclk(void)
+{
+  switch (CMU_REGS->IADCCLKCTRL & _CMU_IADCCLKCTRL_CLKSEL_MASK) {
+    case CMU_IADCCLKCTRL_CLKSEL_EM01GRPACLK:
+      return sim_cmu_em01grpaclk();
+
+    case CMU_IADCCLKCTRL_CLKSEL_FSRCO:
+      return SystemFSRCOClockGet();
+
+    default:
+      return 0;
+  }
+}
+
+uint32_t sim_cmu_euart0clk(void)
+{
+  switch (CMU_REGS->EUART0CLKCTRL & _CMU_EUART0CLKCTRL_CLKSEL_MASK) {
+    case CMU_EUART0CLKCTRL_CLKSEL_EM01GRPACLK:
+      return sim_cmu_em01grpaclk();
+
+    case CMU_EUART0CLKCTRL_CLKSEL_EM23GRPACLK:
+      return em23grpaclk();
+
+    default:
+      return 0;
+  }
+}
+
+bool sim_cmu_clock_enabled(unsigned clken_reg, unsigned bit)
+{
+  uint32_t clken = (clken_reg == 0) ? CMU_REGS->CLKEN0 : CMU_REGS->CLKEN1;
+
+  return (clken >> bit) & 1U;
+}
+
+/***************************************************************************//**
+ * Calibration
+ ******************************************************************************/
+
+static uint32_t calibration_clock(uint32_t select, bool up)
+{
+  if (up) {
+    switch (select << _CMU_CALCTRL_UPSEL_SHIFT) {
+      case CMU_CALCTRL_UPSEL_HFXO:      return SystemHFXOClockGet();
+      case CMU_CALCTRL_UPSEL_LFXO:      return lfxo_freq();
+      case CMU_CALCTRL_UPSEL_HFRCODPLL: return SystemHFRCODPLLClockGet();
+      case CMU_CALCTRL_UPSEL_FSRCO:     return SystemFSRCOClockGet();
+      case CMU_CALCTRL_UPSEL_LFRCO:     return SystemLFRCOClockGet();
+      case CMU_CALCTRL_UPSEL_ULFRCO:    return SystemULFRCOClockGet();
+      default:                          return 0;
+    }
+  }
+  switch (select << _CMU_CALCTRL_DOWNSEL_SHIFT) {
+    case CMU_CALCTRL_DOWNSEL_HCLK:      return sim_cmu_hclk();
+    case CMU_CALCTRL_DOWNSEL_HFXO:      return SystemHFXOClockGet();
+    case CMU_CALCTRL_DOWNSEL_LFXO:      return lfxo_freq();
+    case CMU_CALCTRL_DOWNSEL_HFRCODPLL: return SystemHFRCODPLLClockGet();
+    case CMU_CALCTRL_DOWNSEL_FSRCO:     return SystemFSRCOClockGet();
+    case CMU_CALCTRL_DOWNSEL_LFRCO:     return SystemLFRCOClockGet();
+    case CMU_CALCTRL_DOWNSEL_ULFRCO:    return SystemULFRCOClockGet();
+    default:                            return 0;
+  }
+}
+
+static void calibration_done(sim_event_t *event)
+{
+  (void)event;
+  CMU_REGS->STATUS |= CMU_STATUS_CALRDY;
+}
+
+static void calibration_start(void)
+{
+  uint32_t ctrl   = CMU_REGS->CALCTRL;
+  uint64_t top    = ((ctrl & _CMU_CALCTRL_CALTOP_MASK) >> _CMU_CALCTRL_CALTOP_SHIFT) + 1U;
+  uint32_t down   = calibration_clock((ctrl & _CMU_CALCTRL_DOWNSEL_MASK)
+                                      >> _CMU_CALCTRL_DOWNSEL_SHIFT, false);
+  uint32_t up     = calibration_clock((ctrl & _CMU_CALCTRL_UPSEL_MASK)
+                                      >> _CMU_CALCTRL_UPSEL_SHIFT, true);
+
+  if (down == 0) {
+    sim_error("CMU calibration started with a stopped down clock");
+  }
+  CMU_REGS->STATUS &= ~CMU_STATUS_CALRDY;
+  CMU_REGS->CALCNT  = (uint32_t)(top * up / down);
+  sim_event_schedule(&cmu.calibration, sim_cycles_ns(top, down));
+}
+
+static void cmu_write(sim_block_t *block, uint32_t offset, uint32_t old,
+                      uint32_t value)
+{
+  (void)block;
+  (void)old;
+  if (offset == offsetof(CMU_TypeDef, CALCMD)) {
+    CMU_REGS->CALCMD = 0;
+    if (value & CMU_CALCMD_CALSTART) {
+      calibration_start();
+    } else if (value & CMU_CALCMD_CALSTOP) {
+      sim_event_cancel(&cmu.calibration);
+    }
+  }
+}
+
+/***************************************************************************//**
+ * Oscillators
+ ******************************************************************************/
+
+static uint64_t hfxo_startup_ns(void)
+{
+  static const uint16_t steady_us[] = {
+    16, 41, 83, 125, 166, 208, 250, 333, 416, 500, 666, 833, 1666, 2500,
+    4166, 7500
+  };
+  uint32_t steady = (HFXO_REGS->XTALCFG & _HFXO_XTALCFG_TIMEOUTSTEADY_MASK)
+                    >> _HFXO_XTALCFG_TIMEOUTSTEADY_SHIFT;
+
+  return HFXO_CORE_BIAS_NS + steady_us[steady] * 1000ULL;
+}
+
+static void hfxo_ready(sim_event_t *event)
+{
+  (void)event;
+  HFXO_REGS->STATUS |= HFXO_STATUS_RDY | HFXO_STATUS_COREBIASOPTRDY
+                       | HFXO_STATUS_FSMLOCK;
+}
+
+static void hfxo_write(sim_block_t *block, uint32_t offset, uint32_t old,
+                       uint32_t value)
+{
+  (void)block;
+  if (offset == offsetof(HFXO_TypeDef, CTRL)) {
+    uint32_t ctrl = HFXO_REGS->CTRL;
+
+    if ((ctrl & HFXO_CTRL_FORCEEN) && !(old & HFXO_CTRL_FORCEEN)) {
+      HFXO_REGS->STATUS |= HFXO_STATUS_ENS;
+      sim_event_schedule(&cmu.hfxo_ready, hfxo_startup_ns());
+    } else if (!(ctrl & HFXO_CTRL_FORCEEN) && (old & HFXO_CTRL_FORCEEN)) {
+      sim_event_cancel(&cmu.hfxo_ready);
+      HFXO_REGS->STATUS = 0;
+    }
+  } else if (offset == offsetof(HFXO_TypeDef, CMD)) {
+    HFXO_REGS->CMD = 0;
+    if (value & HFXO_CMD_MANUALOVERRIDE) {
+      HFXO_REGS->STATUS &= ~HFXO_STATUS_FSMLOCK;
+    }
+  } else if (offset == offsetof(HFXO_TypeDef, STATUS)) {
+    HFXO_REGS->STATUS = old;
+  }
+}
+
+static uint32_t lfxo_startup_cycles(void)
+{
+  switch ((LFXO_REGS->CFG & _LFXO_CFG_TIMEOUT_MASK) >> _LFXO_CFG_TIMEOUT_SHIFT) {
+    case _LFXO_CFG_TIMEOUT_CYCLES2:   return 2;
+    case _LFXO_CFG_TIMEOUT_CYCLES256: return 256;
+    case _LFXO_CFG_TIMEOUT_CYCLES1K:  return 1024;
+    case _LFXO_CFG_TIMEOUT_CYCLES2K:  return 2048;
+    case _LFXO_CFG_TIMEOUT_CYCLES4K:  return 4096;
+    case _LFXO_CFG_TIMEOUT_CYCLES8K:  return 8192;
+    case _LFXO_CFG_TIMEOUT_CYCLES16K: return 16384;
+    case _LFXO_CFG_TIMEOUT_CYCLES32K: return 32768;
+    default:                          return 4096;
+  }
+}
+
+static void lfxo_ready(sim_event_t *event)
+{
+  (void)event;
+  LFXO_REGS->STATUS |= LFXO_STATUS_RDY;
+}
+
+static void lfxo_write(sim_block_t *block, uint32_t offset, uint32_t old,
+                       uint32_t value)
+{
+  (void)block;
+  (void)value;
+  if (offset == offsetof(LFXO_TypeDef, CTRL)) {
+    uint32_t ctrl = LFXO_REGS->CTRL;
+
+    if ((ctrl & LFXO_CTRL_FORCEEN) && !(old & LFXO_CTRL_FORCEEN)) {
+      LFXO_REGS->STATUS |= LFXO_STATUS_ENS;
+      sim_event_schedule(&cmu.lfxo_ready,
+                         sim_cycles_ns(lfxo_startup_cycles(), SystemLFXOClockGet()));
+    } else if (!(ctrl & LFXO_CTRL_FORCEEN) && (old & LFXO_CTRL_FORCEEN)) {
+      sim_event_cancel(&cmu.lfxo_ready);
+      LFXO_REGS->STATUS = 0;
+    }
+  } else if (offset == offsetof(LFXO_TypeDef, STATUS)) {
+    LFXO_REGS->STATUS = old;
+  }
+}
+
+/***************************************************************************//**
+ * DPLL
+ ******************************************************************************/
+
+static uint32_t dpll_reference(void)
+{
+  switch (CMU_REGS->DPLLREFCLKCTRL & _CMU_DPLLREFCLKCTRL_CLKSEL_MASK) {
+    case CMU_DPLLREFCLKCTRL_CLKSEL_HFXO:
+      return SystemHFXOClockGet();
+
+    case CMU_DPLLREFCLKCTRL_CLKSEL_LFXO:
+      return SystemLFXOClockGet();
+
+    case CMU_DPLLREFCLKCTRL_CLKSEL_CLKIN0:
+      return SystemCLKIN0Get();
+
+    default:
+      return 0;
+  }
+}
+
+static void dpll_locked(sim_event_t *event)
+{
+  (void)event;
+  DPLL_REGS->IF |= cmu.dpll_result;
+  if (cmu.dpll_result == DPLL_IF_LOCK) {
+    DPLL_REGS->STATUS |= DPLL_STATUS_RDY;
+  }
+}
+
+static void dpll_start(void)
+{
+  uint32_t cfg1   = DPLL_REGS->CFG1;
+  uint64_t n      = ((cfg1 & _DPLL_CFG1_N_MASK) >> _DPLL_CFG1_N_SHIFT) + 1U;
+  uint64_t m      = ((cfg1 & _DPLL_CFG1_M_MASK) >> _DPLL_CFG1_M_SHIFT) + 1U;
+  uint32_t ref    = dpll_reference();
+  uint64_t output = ref * n / m;
+  uint64_t target = SystemHFRCODPLLClockGet();
+
+  DPLL_REGS->STATUS |= DPLL_STATUS_ENS;
+  if (ref == 0) {
+    // No reference, the lock attempt never ends
+    return;
+  }
+  if (output * 1000U < target * 999U) {
+    cmu.dpll_result = DPLL_IF_LOCKFAILLOW;
+  } else if (output * 1000U > target * 1001U) {
+    cmu.dpll_result = DPLL_IF_LOCKFAILHIGH;
+  } else {
+    cmu.dpll_result = DPLL_IF_LOCK;
+  }
+  sim_event_schedule(&cmu.dpll_lock, sim_cycles_ns(DPLL_LOCK_CYCLES, ref));
+}
+
+static void dpll_write(sim_block_t *block, uint32_t offset, uint32_t old,
+                       uint32_t value)
+{
+  (void)block;
+  (void)value;
+  if (offset == offsetof(DPLL_TypeDef, EN)) {
+    uint32_t en = DPLL_REGS->EN;
+
+    if ((en & DPLL_EN_EN) && !(old & DPLL_EN_EN)) {
+      dpll_start();
+    } else if (!(en & DPLL_EN_EN) && (old & DPLL_EN_EN)) {
+      sim_event_cancel(&cmu.dpll_lock);
+      DPLL_REGS->STATUS = 0;
+    }
+  } else if (offset == offsetof(DPLL_TypeDef, STATUS)) {
+    DPLL_REGS->STATUS = old;
+  }
+}
+
+/***************************************************************************//**
+ * Setup
+ ******************************************************************************/
+
+void sim_cmu_init(void)
+{
+  cmu.cmu   = sim_block_add("CMU", CMU_BASE, sizeof(CMU_TypeDef),
+                            SIM_BLOCK_ALIASES, NULL, cmu_write, &cmu);
+  cmu.emu   = sim_block_add("EMU", EMU_BASE, sizeof(EMU_TypeDef),
+                            SIM_BLOCK_ALIASES, NULL, NULL, &cmu);
+  cmu.hfxo  = sim_block_add("HFXO0", HFXO0_BASE, sizeof(HFXO_TypeDef),
+                            SIM_BLOCK_ALIASES, NULL, hfxo_write, &cmu);
+  cmu.hfrco = sim_block_add("HFRCO0", HFRCO0_BASE, sizeof(HFRCO_TypeDef),
+                            SIM_BLOCK_ALIASES, NULL, NULL, &cmu);
+  cmu.dpll  = sim_block_add("DPLL0", DPLL0_BASE, sizeof(DPLL_TypeDef),
+                            SIM_BLOCK_ALIASES, NULL, dpll_write, &cmu);
+  cmu.lfxo  = sim_block_add("LFXO", LFXO_BASE, sizeof(LFXO_TypeDef),
+                            SIM_BLOCK_ALIASES, NULL, lfxo_write, &cmu);
+  sim_block_clock(cmu.hfxo, 0, _CMU_CLKEN0_HFXO0_SHIFT);
+  sim_block_clock(cmu.hfrco, 0, _CMU_CLKEN0_HFRCO0_SHIFT);
+  sim_block_clock(cmu.dpll, 0, _CMU_CLKEN0_DPLL0_SHIFT);
+  sim_block_clock(cmu.lfxo, 0, _CMU_CLKEN0_LFXO_SHIFT);
+
+  sim_event_init(&cmu.calibration, calibration_done, NULL);
+  sim_event_init(&cmu.hfxo_ready, hfxo_ready, NULL);
+  sim_event_init(&cmu.lfxo_ready, lfxo_ready, NULL);
+  sim_event_init(&cmu.dpll_lock, dpll_locked, NULL);
+
+  CMU_REGS->SYSCLKCTRL      = _CMU_SYSCLKCTRL_RESETVALUE;
+  CMU_REGS->EM01GRPACLKCTRL = _CMU_EM01GRPACLKCTRL_RESETVALUE;
+  CMU_REGS->EM01GRPBCLKCTRL = _CMU_EM01GRPBCLKCTRL_RESETVALUE;
+  CMU_REGS->EM23GRPACLKCTRL = _CMU_EM23GRPACLKCTRL_RESETVALUE;
+  CMU_REGS->EM4GRPACLKCTRL  = _CMU_EM4GRPACLKCTRL_RESETVALUE;
+  CMU_REGS->IADCCLKCTRL     = _CMU_IADCCLKCTRL_RESETVALUE;
+  CMU_REGS->EUART0CLKCTRL   = _CMU_EUART0CLKCTRL_RESETVALUE;
+  CMU_REGS->RTCCCLKCTRL     = _CMU_RTCCCLKCTRL_RESETVALUE;
+  CMU_REGS->WDOG0CLKCTRL    = _CMU_WDOG0CLKCTRL_RESETVALUE;
+  CMU_REGS->DPLLREFCLKCTRL  = _CMU_DPLLREFCLKCTRL_RESETVALUE;
+}
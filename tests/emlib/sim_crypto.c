@@ -0,0 +1,400 @@
+/*
+ *  CRYPTO model, the Series 1 block em_crypto drives
+ *
+ *  The data registers are ports: each write shifts a word in at the top of
+ *  the register, each read returns the bottom word and rotates it to the
+ *  top, so a full burst leaves the register as it was. The BIG ports
+ *  byte-swap the words. QDATA1 is a register of its own here, not DATA1 to
+ *  DATA4.
+ *
+ *  Instructions run from CMD INSTR, or as a sequence from SEQ0 to SEQ4 on
+ *  SEQSTART or when a sequence register is written with EXEC in it. The
+ *  sequence takes the sum of the instruction cycle counts of HCLK, during
+ *  which STATUS INSTRRUNNING and SEQRUNNING are set and the data registers
+ *  must not be accessed. Only the instructions of the SHA-1 and SHA-256
+ *  code are modelled:
+ *
+ *  - SELDDATA0DDATA1 selects the operands, the only selection modelled
+ *  - SHA runs the compression rounds of the CTRL SHA hash on the state in
+ *    DDATA0 and the block in QDATA1, without the final addition
+ *  - MADD32 adds DDATA1 to DDATA0 word by word
+ *  - DDATA0TODDATA1 and DDATA1TODDATA0 copy the registers
+ */
+
+#include <string.h>
+
+#include "sim.h"
+
+#define SEQ_LENGTH        20U
+#define SHA1_CYCLES       80U
+#define SHA256_CYCLES     64U
+
+typedef struct {
+  sim_block_t *block;
+  sim_event_t  done;
+  bool         running;
+  bool         sequence;        // Running a sequence, else one instruction
+  uint8_t      program[SEQ_LENGTH];
+  unsigned     length;
+  uint32_t     data[3][4];      // DATA0 to DATA2
+  uint32_t     ddata[5][8];     // DDATA0 to DDATA4, DDATA4 being KEYBUF
+  uint32_t     qdata1[16];
+  uint32_t     key[8];
+} crypto_model_t;
+
+static crypto_model_t crypto;
+
+#define REGS  ((CRYPTO_TypeDef *)crypto.block->regs)
+
+/***************************************************************************//**
+ * SHA compression rounds, without the final addition
+ ******************************************************************************/
+
+static uint32_t rol(uint32_t x, unsigned n)
+{
+  return (x << n) | (x >> (32U - n));
+}
+
+static uint32_t ror(uint32_t x, unsigned n)
+{
+  return (x >> n) | (x << (32U - n));
+}
+
+static void sha1_rounds(uint32_t state[8], const uint32_t block[16])
+{
+  uint32_t w[80];
+  uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+
+  memcpy(w, block, 16 * sizeof(w[0]));
+  for (unsigned i = 16; i < 80; i++) {
+    w[i] = rol(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+  }
+  for (unsigned i = 0; i < 80; i++) {
+    uint32_t f;
+    uint32_t k;
+    uint32_t t;
+
+    if (i < 20) {
+      f = (b & c) | (~b & d);
+      k = 0x5A827999U;
+    } else if (i < 40) {
+      f = b ^ c ^ d;
+      k = 0x6ED9EBA1U;
+    } else if (i < 60) {
+      f = (b & c) | (b & d) | (c & d);
+      k = 0x8F1BBCDCU;
+    } else {
+      f = b ^ c ^ d;
+      k = 0xCA62C1D6U;
+    }
+    t = rol(a, 5) + f + e + k + w[i];
+    e = d;
+    d = c;
+    c = rol(b, 30);
+    b = a;
+    a = t;
+  }
+  state[0] = a;
+  state[1] = b;
+  state[2] = c;
+  state[3] = d;
+  state[4] = e;
+}
+
+static void sha256_rounds(uint32_t state[8], const uint32_t block[16])
+{
+  static const uint32_t k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+  };
+  uint32_t w[64];
+  uint32_t s[8];
+
+  memcpy(w, block, 16 * sizeof(w[0]));
+  for (unsigned i = 16; i < 64; i++) {
+    uint32_t s0 = ror(w[i - 15], 7) ^ ror(w[i - 15], 18) ^ (w[i - 15] >> 3);
+    uint32_t s1 = ror(w[i - 2], 17) ^ ror(w[i - 2], 19) ^ (w[i - 2] >> 10);
+
+    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+  }
+  memcpy(s, state, sizeof(s));
+  for (unsigned i = 0; i < 64; i++) {
+    uint32_t t1 = s[7] + (ror(s[4], 6) ^ ror(s[4], 11) ^ ror(s[4], 25))
+                  + ((s[4] & s[5]) ^ (~s[4] & s[6])) + k[i] + w[i];
+    uint32_t t2 = (ror(s[0], 2) ^ ror(s[0], 13) ^ ror(s[0], 22))
+                  + ((s[0] & s[1]) ^ (s[0] & s[2]) ^ (s[1] & s[2]));
+
+    memmove(&s[1], &s[0], 7 * sizeof(s[0]));
+    s[4] += t1;
+    s[0]  = t1 + t2;
+  }
+  memcpy(state, s, sizeof(s));
+}
+
+/***************************************************************************//**
+ * Instructions
+ ******************************************************************************/
+
+static uint32_t sha_mode(void)
+{
+  return (REGS->CTRL & _CRYPTO_CTRL_SHA_MASK) >> _CRYPTO_CTRL_SHA_SHIFT;
+}
+
+static unsigned instruction_cycles(uint8_t instruction)
+{
+  if (instruction != CRYPTO_CMD_INSTR_SHA) {
+    return 1;
+  }
+  return (sha_mode() == _CRYPTO_CTRL_SHA_SHA1) ? SHA1_CYCLES : SHA256_CYCLES;
+}
+
+static void instruction_run(uint8_t instruction)
+{
+  switch (instruction) {
+    case CRYPTO_CMD_INSTR_SELDDATA0DDATA1:
+      break;
+
+    case CRYPTO_CMD_INSTR_DDATA0TODDATA1:
+      memcpy(crypto.ddata[1], crypto.ddata[0], sizeof(crypto.ddata[0]));
+      break;
+
+    case CRYPTO_CMD_INSTR_DDATA1TODDATA0:
+      memcpy(crypto.ddata[0], crypto.ddata[1], sizeof(crypto.ddata[0]));
+      break;
+
+    case CRYPTO_CMD_INSTR_MADD32:
+      for (unsigned i = 0; i < 8; i++) {
+        crypto.ddata[0][i] += crypto.ddata[1][i];
+      }
+      break;
+
+    case CRYPTO_CMD_INSTR_SHA:
+      if (sha_mode() == _CRYPTO_CTRL_SHA_SHA1) {
+        sha1_rounds(crypto.ddata[0], crypto.qdata1);
+      } else if (sha_mode() == _CRYPTO_CTRL_SHA_SHA2) {
+        sha256_rounds(crypto.ddata[0], crypto.qdata1);
+      } else {
+        sim_error("CRYPTO: SHA instruction with CTRL SHA not set");
+      }
+      break;
+
+    default:
+      sim_error("CRYPTO: instruction 0x%02x is not modelled", instruction);
+  }
+}
+
+static void status_update(void)
+{
+  REGS->STATUS = crypto.running
+                 ? (CRYPTO_STATUS_INSTRRUNNING
+                    | (crypto.sequence ? CRYPTO_STATUS_SEQRUNNING : 0U))
+                 : 0U;
+  sim_irq_flags(crypto.block, CRYPTO_IRQn, offsetof(CRYPTO_TypeDef, IF),
+                offsetof(CRYPTO_TypeDef, IEN));
+}
+
+static void run_done(sim_event_t *event)
+{
+  (void)event;
+  for (unsigned i = 0; i < crypto.length; i++) {
+    instruction_run(crypto.program[i]);
+  }
+  crypto.running = false;
+  REGS->IF      |= CRYPTO_IF_INSTRDONE | (crypto.sequence ? CRYPTO_IF_SEQDONE : 0U);
+  status_update();
+}
+
+static void run_start(const uint8_t *program, unsigned length, bool sequence)
+{
+  uint64_t cycles = 0;
+
+  if (crypto.running) {
+    sim_error("CRYPTO: instruction started while running");
+  }
+  memcpy(crypto.program, program, length);
+  crypto.length   = length;
+  crypto.sequence = sequence;
+  crypto.running  = true;
+  for (unsigned i = 0; i < length; i++) {
+    cycles += instruction_cycles(program[i]);
+  }
+  sim_event_schedule(&crypto.done, sim_cycles_ns(cycles, sim_cmu_hclk()));
+  status_update();
+}
+
+/* Runs SEQ0 to SEQ4 up to the first END or EXEC */
+static void sequence_start(void)
+{
+  uint8_t  program[SEQ_LENGTH];
+  unsigned length = 0;
+
+  for (unsigned i = 0; i < SEQ_LENGTH; i++) {
+    uint8_t instruction = (uint8_t)(crypto.block->regs[offsetof(CRYPTO_TypeDef, SEQ0) / 4 + i / 4]
+                                    >> ((i % 4) * 8));
+
+    if ((instruction == CRYPTO_CMD_INSTR_END)
+        || (instruction == CRYPTO_CMD_INSTR_EXEC)) {
+      break;
+    }
+    program[length++] = instruction;
+  }
+  run_start(program, length, true);
+}
+
+/***************************************************************************//**
+ * Registers
+ ******************************************************************************/
+
+static uint32_t bswap(uint32_t value)
+{
+  return __builtin_bswap32(value);
+}
+
+/* Port of a data register, NULL for the other registers */
+static uint32_t *port(uint32_t offset, unsigned *words, bool *big)
+{
+  *big = false;
+  switch (offset) {
+    case offsetof(CRYPTO_TypeDef, DATA0):
+    case offsetof(CRYPTO_TypeDef, DATA1):
+    case offsetof(CRYPTO_TypeDef, DATA2):
+      *words = 4;
+      return crypto.data[(offset - offsetof(CRYPTO_TypeDef, DATA0)) / 4];
+
+    case offsetof(CRYPTO_TypeDef, DDATA0BIG):
+      *big = true;
+      // Fall through
+    case offsetof(CRYPTO_TypeDef, DDATA0):
+      *words = 8;
+      return crypto.ddata[0];
+
+    case offsetof(CRYPTO_TypeDef, DDATA1):
+      *words = 8;
+      return crypto.ddata[1];
+
+    case offsetof(CRYPTO_TypeDef, DDATA4):
+    case offsetof(CRYPTO_TypeDef, KEYBUF):
+      *words = 8;
+      return crypto.ddata[4];
+
+    case offsetof(CRYPTO_TypeDef, KEY):
+      *words = 8;
+      return crypto.key;
+
+    case offsetof(CRYPTO_TypeDef, QDATA1BIG):
+      *big   = true;
+      *words = 16;
+      return crypto.qdata1;
+
+    default:
+      return NULL;
+  }
+}
+
+static void crypto_read(sim_block_t *block, uint32_t offset)
+{
+  unsigned  words;
+  bool      big;
+  uint32_t *reg = port(offset, &words, &big);
+  uint32_t  value;
+
+  if (offset == offsetof(CRYPTO_TypeDef, STATUS)) {
+    status_update();
+  }
+  if (reg == NULL) {
+    return;
+  }
+  if (crypto.running) {
+    sim_error("CRYPTO: data register read while running");
+  }
+  value = reg[0];
+  memmove(&reg[0], &reg[1], (words - 1) * sizeof(reg[0]));
+  reg[words - 1] = value;
+  block->regs[offset / 4] = big ? bswap(value) : value;
+}
+
+static void crypto_write(sim_block_t *block, uint32_t offset, uint32_t old,
+                         uint32_t value)
+{
+  unsigned  words;
+  bool      big;
+  uint32_t *reg = port(offset, &words, &big);
+
+  if (reg != NULL) {
+    if (crypto.running) {
+      sim_error("CRYPTO: data register written while running");
+    }
+    memmove(&reg[0], &reg[1], (words - 1) * sizeof(reg[0]));
+    reg[words - 1] = big ? bswap(value) : value;
+    return;
+  }
+  switch (offset) {
+    case offsetof(CRYPTO_TypeDef, CMD):
+      REGS->CMD = 0;
+      if (value & _CRYPTO_CMD_INSTR_MASK) {
+        uint8_t instruction = (uint8_t)(value & _CRYPTO_CMD_INSTR_MASK);
+
+        run_start(&instruction, 1, false);
+      }
+      if (value & CRYPTO_CMD_SEQSTART) {
+        sequence_start();
+      }
+      break;
+
+    case offsetof(CRYPTO_TypeDef, SEQ0):
+    case offsetof(CRYPTO_TypeDef, SEQ1):
+    case offsetof(CRYPTO_TypeDef, SEQ2):
+    case offsetof(CRYPTO_TypeDef, SEQ3):
+    case offsetof(CRYPTO_TypeDef, SEQ4):
+      for (unsigned i = 0; i < 4; i++) {
+        if (((value >> (i * 8)) & 0xFFU) == CRYPTO_CMD_INSTR_EXEC) {
+          sequence_start();
+          break;
+        }
+      }
+      break;
+
+    case offsetof(CRYPTO_TypeDef, IFC):
+      REGS->IFC = 0;
+      REGS->IF &= ~value;
+      status_update();
+      break;
+
+    case offsetof(CRYPTO_TypeDef, IFS):
+      REGS->IFS = 0;
+      REGS->IF |= value;
+      status_update();
+      break;
+
+    case offsetof(CRYPTO_TypeDef, IF):
+    case offsetof(CRYPTO_TypeDef, IEN):
+      status_update();
+      break;
+
+    case offsetof(CRYPTO_TypeDef, STATUS):
+      REGS->STATUS = old;
+      break;
+
+    default:
+      break;
+  }
+  (void)block;
+}
+
+void sim_crypto_init(void)
+{
+  crypto.block = sim_block_add("CRYPTO0", CRYPTO0_BASE, sizeof(CRYPTO_TypeDef),
+                               SIM_BLOCK_ALIASES, crypto_read, crypto_write,
+                               &crypto);
+  sim_block_clock(crypto.block, 1, _CMU_CLKEN1_CRYPTOACC_SHIFT);
+  sim_event_init(&crypto.done, run_done, NULL);
+}
@@ -0,0 +1,316 @@
+/*
+ *  EUSART model, for EUART0
+ *
+ *  Like the USART model, in asynchronous mode only, with the differences of
+ *  the EUSART:
+ *
+ *  - commands and CLKDIV take effect after synchronization to the EUART0
+ *    clock: their SYNCBUSY bits stay set for SYNC_CYCLES cycles, and the
+ *    command then updates STATUS
+ *  - the transmit and receive FIFOs hold FIFO_SIZE frames, TXFL is set while
+ *    the transmit FIFO has room and RXFL while the receive FIFO holds a frame
+ *  - frames are received back when CFG0 LOOPBK is set, and are only counted
+ *    otherwise
+ *
+ *  TXFL and RXFL drive the LDMA requests and follow the status in IF like the
+ *  RXFULL flag. Parity, framing errors and IrDA are not modelled.
+ */
+
+#include "sim.h"
+
+#define FIFO_SIZE       4U
+#define SYNC_CYCLES     3U
+
+#define RX_FLAGS        (EUSART_IF_RXFL | EUSART_IF_RXFULL | EUSART_IF_RXOF \
+                         | EUSART_IF_RXUF | EUSART_IF_PERR | EUSART_IF_FERR)
+#define LEVEL_FLAGS     (EUSART_IF_TXFL | EUSART_IF_RXFL | EUSART_IF_RXFULL)
+
+typedef struct {
+  sim_block_t *block;
+  uint16_t     tx_fifo[FIFO_SIZE];
+  unsigned     tx_count;
+  bool         shifting;
+  uint16_t     shift;
+  uint16_t     rx_fifo[FIFO_SIZE];
+  unsigned     rx_count;
+  uint32_t     command;       // CMD bits waiting for synchronization
+  uint32_t     frames_sent;
+  sim_event_t  frame_done;
+  sim_event_t  synced;
+} eusart_model_t;
+
+static eusart_model_t euart0;
+
+#define REGS  ((EUSART_TypeDef *)euart0.block->regs)
+
+static eusart_model_t *eusart_model(const EUSART_TypeDef *eusart)
+{
+  if ((uintptr_t)eusart != EUART0_BASE) {
+    sim_error("no EUSART at %p", (const void *)eusart);
+  }
+  return &euart0;
+}
+
+static uint32_t data_bits(void)
+{
+  return ((REGS->FRAMECFG & _EUSART_FRAMECFG_DATABITS_MASK)
+          >> _EUSART_FRAMECFG_DATABITS_SHIFT) + 6U;
+}
+
+/* Time one frame takes on the line */
+static uint64_t frame_ns(void)
+{
+  static const uint32_t oversampling[8] = { 16, 8, 6, 4, 1, 1, 1, 1 };
+  uint32_t              clkdiv = REGS->CLKDIV & _EUSART_CLKDIV_DIV_MASK;
+  uint32_t              freq   = sim_cmu_euart0clk();
+  uint32_t              ovs    = oversampling[(REGS->CFG0 & _EUSART_CFG0_OVS_MASK)
+                                              >> _EUSART_CFG0_OVS_SHIFT];
+  uint32_t              half_bits;
+  __uint128_t           scaled;
+
+  half_bits = 2 * (1 + data_bits())
+              + ((REGS->FRAMECFG & _EUSART_FRAMECFG_PARITY_MASK) != EUSART_FRAMECFG_PARITY_NONE ? 2 : 0)
+              + ((REGS->FRAMECFG & _EUSART_FRAMECFG_STOPBITS_MASK) >> _EUSART_FRAMECFG_STOPBITS_SHIFT) + 1;
+  if (freq == 0) {
+    sim_error("EUART0 transmits with its clock stopped");
+  }
+  // A bit lasts ovs * (256 + CLKDIV) / 256 clock cycles
+  scaled = (__uint128_t)half_bits * ovs * (256U + clkdiv) * 1000000000U;
+  return (uint64_t)((scaled + 512U * (uint64_t)freq - 1U) / (512U * (uint64_t)freq));
+}
+
+static void status_update(void)
+{
+  uint32_t status = REGS->STATUS & ~(EUSART_STATUS_TXFL | EUSART_STATUS_RXFL
+                                     | EUSART_STATUS_RXFULL | EUSART_STATUS_TXIDLE);
+  uint32_t level  = 0;
+  uint32_t flags;
+
+  if (euart0.tx_count < FIFO_SIZE) {
+    level  |= EUSART_IF_TXFL;
+    status |= EUSART_STATUS_TXFL;
+  }
+  if ((euart0.tx_count == 0) && !euart0.shifting) {
+    status |= EUSART_STATUS_TXIDLE;
+  }
+  if (euart0.rx_count != 0) {
+    level  |= EUSART_IF_RXFL;
+    status |= EUSART_STATUS_RXFL;
+  }
+  if (euart0.rx_count == FIFO_SIZE) {
+    level  |= EUSART_IF_RXFULL;
+    status |= EUSART_STATUS_RXFULL;
+  }
+  REGS->STATUS = status | EUSART_STATUS_RXIDLE;
+  REGS->IF     = (REGS->IF & ~LEVEL_FLAGS) | level;
+
+  flags = REGS->IF & REGS->IEN;
+  sim_irq_line(EUART0_RX_IRQn, (flags & RX_FLAGS) != 0);
+  sim_irq_line(EUART0_TX_IRQn, (flags & ~RX_FLAGS) != 0);
+  sim_ldma_request(LDMAXBAR_CH_REQSEL_SOURCESEL_EUART0,
+                   LDMAXBAR_CH_REQSEL_SIGSEL_EUART0RXFL, euart0.rx_count != 0);
+  sim_ldma_request(LDMAXBAR_CH_REQSEL_SOURCESEL_EUART0,
+                   LDMAXBAR_CH_REQSEL_SIGSEL_EUART0TXFL, euart0.tx_count < FIFO_SIZE);
+}
+
+static void receive(uint16_t frame)
+{
+  if (!(REGS->STATUS & EUSART_STATUS_RXENS)) {
+    return;
+  }
+  if (euart0.rx_count == FIFO_SIZE) {
+    REGS->IF |= EUSART_IF_RXOF;
+  } else {
+    euart0.rx_fifo[euart0.rx_count++] = frame;
+  }
+}
+
+static void shift_start(void)
+{
+  if (euart0.shifting || (euart0.tx_count == 0)
+      || !(REGS->STATUS & EUSART_STATUS_TXENS)) {
+    return;
+  }
+  euart0.shift = euart0.tx_fifo[0];
+  for (unsigned i = 1; i < euart0.tx_count; i++) {
+    euart0.tx_fifo[i - 1] = euart0.tx_fifo[i];
+  }
+  euart0.tx_count--;
+  euart0.shifting = true;
+  REGS->STATUS   &= ~EUSART_STATUS_TXC;
+  sim_event_schedule(&euart0.frame_done, frame_ns());
+}
+
+static void frame_done(sim_event_t *event)
+{
+  (void)event;
+  euart0.shifting = false;
+  euart0.frames_sent++;
+  if (REGS->CFG0 & EUSART_CFG0_LOOPBK) {
+    receive(euart0.shift & (uint16_t)((1U << data_bits()) - 1U));
+  }
+  shift_start();
+  if (!euart0.shifting) {
+    REGS->STATUS |= EUSART_STATUS_TXC;
+    REGS->IF     |= EUSART_IF_TXC;
+  }
+  status_update();
+}
+
+/* Applies the commands once synchronized */
+static void synced(sim_event_t *event)
+{
+  uint32_t command = euart0.command;
+
+  (void)event;
+  euart0.command = 0;
+  REGS->SYNCBUSY = 0;
+  if (command & EUSART_CMD_CLEARTX) {
+    euart0.tx_count = 0;
+  }
+  if (command & EUSART_CMD_RXDIS) {
+    REGS->STATUS &= ~EUSART_STATUS_RXENS;
+  }
+  if (command & EUSART_CMD_RXEN) {
+    REGS->STATUS |= EUSART_STATUS_RXENS;
+  }
+  if (command & EUSART_CMD_TXDIS) {
+    REGS->STATUS &= ~EUSART_STATUS_TXENS;
+  }
+  if (command & EUSART_CMD_TXEN) {
+    REGS->STATUS |= EUSART_STATUS_TXENS;
+  }
+  if (command & EUSART_CMD_RXBLOCKDIS) {
+    REGS->STATUS &= ~EUSART_STATUS_RXBLOCK;
+  }
+  if (command & EUSART_CMD_RXBLOCKEN) {
+    REGS->STATUS |= EUSART_STATUS_RXBLOCK;
+  }
+  if (command & EUSART_CMD_TXTRIDIS) {
+    REGS->STATUS &= ~EUSART_STATUS_TXTRI;
+  }
+  if (command & EUSART_CMD_TXTRIEN) {
+    REGS->STATUS |= EUSART_STATUS_TXTRI;
+  }
+  shift_start();
+  status_update();
+}
+
+static void sync_start(uint32_t syncbusy)
+{
+  REGS->SYNCBUSY |= syncbusy;
+  if (!euart0.synced.queued) {
+    sim_event_schedule(&euart0.synced, sim_cycles_ns(SYNC_CYCLES, sim_cmu_euart0clk()));
+  }
+}
+
+static uint32_t command_syncbusy(uint32_t command)
+{
+  static const uint32_t map[][2] = {
+    { EUSART_CMD_RXEN,       EUSART_SYNCBUSY_RXEN },
+    { EUSART_CMD_RXDIS,      EUSART_SYNCBUSY_RXDIS },
+    { EUSART_CMD_TXEN,       EUSART_SYNCBUSY_TXEN },
+    { EUSART_CMD_TXDIS,      EUSART_SYNCBUSY_TXDIS },
+    { EUSART_CMD_RXBLOCKEN,  EUSART_SYNCBUSY_RXBLOCKEN },
+    { EUSART_CMD_RXBLOCKDIS, EUSART_SYNCBUSY_RXBLOCKDIS },
+    { EUSART_CMD_TXTRIEN,    EUSART_SYNCBUSY_TXTRIEN },
+    { EUSART_CMD_TXTRIDIS,   EUSART_SYNCBUSY_TXTRIDIS },
+  };
+  uint32_t syncbusy = 0;
+
+  for (unsigned i = 0; i < sizeof(map) / sizeof(map[0]); i++) {
+    if (command & map[i][0]) {
+      syncbusy |= map[i][1];
+    }
+  }
+  return syncbusy;
+}
+
+static void eusart_read(sim_block_t *block, uint32_t offset)
+{
+  (void)block;
+  if (offset != offsetof(EUSART_TypeDef, RXDATA)) {
+    return;
+  }
+  if (euart0.rx_count == 0) {
+    REGS->IF    |= EUSART_IF_RXUF;
+    REGS->RXDATA = 0;
+  } else {
+    REGS->RXDATA = euart0.rx_fifo[0];
+    for (unsigned i = 1; i < euart0.rx_count; i++) {
+      euart0.rx_fifo[i - 1] = euart0.rx_fifo[i];
+    }
+    euart0.rx_count--;
+  }
+  status_update();
+}
+
+static void eusart_write(sim_block_t *block, uint32_t offset, uint32_t old,
+                         uint32_t value)
+{
+  (void)block;
+  switch (offset) {
+    case offsetof(EUSART_TypeDef, EN):
+      if (!(REGS->EN & EUSART_EN_EN)) {
+        sim_event_cancel(&euart0.frame_done);
+        sim_event_cancel(&euart0.synced);
+        euart0.shifting = false;
+        euart0.tx_count = 0;
+        euart0.rx_count = 0;
+        euart0.command  = 0;
+        REGS->SYNCBUSY  = 0;
+        REGS->STATUS    = 0;
+      }
+      break;
+
+    case offsetof(EUSART_TypeDef, CMD):
+      REGS->CMD = 0;
+      if (!(REGS->EN & EUSART_EN_EN)) {
+        sim_error("EUART0 command written while disabled");
+      }
+      euart0.command |= value;
+      sync_start(command_syncbusy(value));
+      break;
+
+    case offsetof(EUSART_TypeDef, CLKDIV):
+      if (REGS->EN & EUSART_EN_EN) {
+        sync_start(_EUSART_SYNCBUSY_DIV_MASK);
+      }
+      break;
+
+    case offsetof(EUSART_TypeDef, TXDATA):
+      if (euart0.tx_count == FIFO_SIZE) {
+        REGS->IF |= EUSART_IF_TXOF;
+      } else {
+        euart0.tx_fifo[euart0.tx_count++] = (uint16_t)(value & 0x3FFU);
+        REGS->STATUS &= ~EUSART_STATUS_TXC;
+        shift_start();
+      }
+      break;
+
+    case offsetof(EUSART_TypeDef, STATUS):
+    case offsetof(EUSART_TypeDef, SYNCBUSY):
+      block->regs[offset / 4] = old;
+      break;
+
+    default:
+      break;
+  }
+  status_update();
+}
+
+uint32_t sim_eusart_frames_sent(EUSART_TypeDef *eusart)
+{
+  return eusart_model(eusart)->frames_sent;
+}
+
+void sim_eusart_init(void)
+{
+  euart0.block = sim_block_add("EUART0", EUART0_BASE, sizeof(EUSART_TypeDef),
+                               SIM_BLOCK_ALIASES, eusart_read, eusart_write,
+                               &euart0);
+  sim_block_clock(euart0.block, 0, _CMU_CLKEN0_EUART0_SHIFT);
+  sim_event_init(&euart0.frame_done, frame_done, NULL);
+  sim_event_init(&euart0.synced, synced, NULL);
+  REGS->FRAMECFG = _EUSART_FRAMECFG_RESETVALUE;
+}
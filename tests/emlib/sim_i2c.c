@@ -0,0 +1,533 @@
+/*
+ *  I2C model, master mode
+ *
+ *  Commands and bytes take the bus time CLKDIV and CTRL CLHR give an SCL
+ *  period at the I2C clock, a bit per START, STOP, ACK and NACK and nine
+ *  per byte sent:
+ *
+ *  - START sends a start condition, or a repeated start while the master
+ *    holds the bus, and the byte written to TXDATA next is the address.
+ *    A slave attached with that address ACKs it, no slave NACKs it.
+ *  - bytes written to TXDATA go to the slave, which ACKs or NACKs each one
+ *  - after an ACKed read address the master receives bytes, each waiting for
+ *    an ACK or NACK command. A NACK command given while a byte is on its way
+ *    applies to that byte once received.
+ *  - STOP ends the transfer once the current byte is done, ABORT at once
+ *
+ *  RXDATAV and TXBL follow the buffers in IF and drive the LDMA requests,
+ *  the other flags stay set until cleared. sim_i2c_stall() leaves the master
+ *  waiting for the ACK of the next address byte until ABORT, as a slave
+ *  holding SCL low would. sim_i2c_bus_error() ends the transfer with BUSERR,
+ *  as a misplaced START or STOP does. Slave mode and arbitration are not
+ *  modelled.
+ */
+
+#include "sim.h"
+
+#define RX_BUFFER_SIZE  2U
+#define LEVEL_FLAGS     (I2C_IF_TXBL | I2C_IF_RXDATAV | I2C_IF_RXFULL)
+
+typedef enum {
+  PHASE_IDLE,
+  PHASE_START,        // Start condition on the bus
+  PHASE_HOLD,         // Master holds the bus, waiting for a command or TXDATA
+  PHASE_BYTE_OUT,     // Address or data byte on the bus
+  PHASE_BYTE_IN,      // Data byte coming from the slave
+  PHASE_ACK_WAIT,     // Byte received, waiting for ACK or NACK
+  PHASE_STOP
+} phase_t;
+
+typedef struct {
+  sim_block_t     *block;
+  uintptr_t        base;
+  const char      *name;
+  IRQn_Type        irq;
+  uint32_t         source;
+  uint32_t         rx_signal;
+  uint32_t         tx_signal;
+  unsigned         clken_bit;
+  uint32_t       (*clock)(void);
+  phase_t          phase;
+  bool             address_next;  // The next byte sent is an address
+  bool             reading;
+  bool             read_done;     // Last byte of the read NACKed
+  bool             pending_nack;
+  bool             pending_stop;
+  bool             pending_start;
+  bool             tx_valid;
+  uint8_t          tx_data;
+  uint8_t          shift;
+  uint8_t          rx_buffer[RX_BUFFER_SIZE];
+  unsigned         rx_count;
+  bool             stall;
+  sim_i2c_slave_t *slaves;
+  sim_i2c_slave_t *slave;        // Addressed slave
+  sim_event_t      step;
+} i2c_model_t;
+
+static i2c_model_t i2cs[I2C_COUNT] = {
+  { .base = I2C0_BASE, .name = "I2C0", .irq = I2C0_IRQn,
+    .source = LDMAXBAR_CH_REQSEL_SOURCESEL_I2C0,
+    .rx_signal = LDMAXBAR_CH_REQSEL_SIGSEL_I2C0RXDATAV,
+    .tx_signal = LDMAXBAR_CH_REQSEL_SIGSEL_I2C0TXBL,
+    .clken_bit = _CMU_CLKEN0_I2C0_SHIFT, .clock = sim_cmu_lspclk },
+  { .base = I2C1_BASE, .name = "I2C1", .irq = I2C1_IRQn,
+    .source = LDMAXBAR_CH_REQSEL_SOURCESEL_I2C1,
+    .rx_signal = LDMAXBAR_CH_REQSEL_SIGSEL_I2C1RXDATAV,
+    .tx_signal = LDMAXBAR_CH_REQSEL_SIGSEL_I2C1TXBL,
+    .clken_bit = _CMU_CLKEN0_I2C1_SHIFT, .clock = sim_cmu_pclk },
+};
+
+#define REGS(i2c)  ((I2C_TypeDef *)(i2c)->block->regs)
+
+static i2c_model_t *i2c_model(const I2C_TypeDef *i2c)
+{
+  for (unsigned i = 0; i < I2C_COUNT; i++) {
+    if (i2cs[i].base == (uintptr_t)i2c) {
+      return &i2cs[i];
+    }
+  }
+  sim_error("no I2C at %p", (const void *)i2c);
+}
+
+/* Time of a number of SCL periods */
+static uint64_t bits_ns(const i2c_model_t *i2c, unsigned bits)
+{
+  static const uint8_t n_sum[4] = { 4 + 4, 6 + 3, 11 + 6, 4 + 4 };
+  I2C_TypeDef         *regs   = REGS(i2c);
+  uint32_t             n      = n_sum[(regs->CTRL & _I2C_CTRL_CLHR_MASK) >> _I2C_CTRL_CLHR_SHIFT];
+  uint32_t             freq   = i2c->clock();
+
+  if (freq == 0) {
+    sim_error("%s runs with its clock stopped", i2c->name);
+  }
+  return sim_cycles_ns((uint64_t)bits * (n * ((regs->CLKDIV & _I2C_CLKDIV_DIV_MASK) + 1U) + 8U),
+                       freq);
+}
+
+static void status_update(i2c_model_t *i2c)
+{
+  I2C_TypeDef *regs   = REGS(i2c);
+  uint32_t     level  = 0;
+  uint32_t     status = 0;
+  uint32_t     state  = 0;
+
+  if (!i2c->tx_valid) {
+    level  |= I2C_IF_TXBL;
+    status |= I2C_STATUS_TXBL;
+  }
+  if (i2c->rx_count != 0) {
+    level  |= I2C_IF_RXDATAV;
+    status |= I2C_STATUS_RXDATAV;
+  }
+  if (i2c->rx_count == RX_BUFFER_SIZE) {
+    level  |= I2C_IF_RXFULL;
+    status |= I2C_STATUS_RXFULL;
+  }
+  if (i2c->pending_start) {
+    status |= I2C_STATUS_PSTART;
+  }
+  if (i2c->pending_stop) {
+    status |= I2C_STATUS_PSTOP;
+  }
+  if (i2c->pending_nack) {
+    status |= I2C_STATUS_PNACK;
+  }
+  if (i2c->phase != PHASE_IDLE) {
+    state |= I2C_STATE_BUSY | I2C_STATE_MASTER;
+    if (!i2c->reading || i2c->address_next) {
+      state |= I2C_STATE_TRANSMITTER;
+    }
+    if ((i2c->phase == PHASE_HOLD) || (i2c->phase == PHASE_ACK_WAIT)) {
+      state |= I2C_STATE_BUSHOLD;
+    }
+  }
+  regs->STATUS = status;
+  regs->STATE  = state;
+  regs->IF     = (regs->IF & ~LEVEL_FLAGS) | level;
+  sim_irq_flags(i2c->block, i2c->irq, offsetof(I2C_TypeDef, IF),
+                offsetof(I2C_TypeDef, IEN));
+  sim_ldma_request(i2c->source, i2c->rx_signal, i2c->rx_count != 0);
+  sim_ldma_request(i2c->source, i2c->tx_signal, !i2c->tx_valid);
+}
+
+static void phase_set(i2c_model_t *i2c, phase_t phase, unsigned bits)
+{
+  i2c->phase = phase;
+  sim_event_cancel(&i2c->step);
+  if (bits != 0) {
+    sim_event_schedule(&i2c->step, bits_ns(i2c, bits));
+  }
+}
+
+static void stop_start(i2c_model_t *i2c)
+{
+  i2c->pending_stop = false;
+  phase_set(i2c, PHASE_STOP, 1);
+}
+
+static void start_start(i2c_model_t *i2c)
+{
+  i2c->pending_start = false;
+  phase_set(i2c, PHASE_START, 1);
+}
+
+static void byte_out_start(i2c_model_t *i2c)
+{
+  i2c->shift    = i2c->tx_data;
+  i2c->tx_valid = false;
+  phase_set(i2c, PHASE_BYTE_OUT, 9);
+}
+
+/* Goes on from holding the bus: pending commands first, then TXDATA */
+static void hold(i2c_model_t *i2c)
+{
+  phase_set(i2c, PHASE_HOLD, 0);
+  if (i2c->pending_start) {
+    start_start(i2c);
+  } else if (i2c->pending_stop) {
+    stop_start(i2c);
+  } else if (i2c->tx_valid && (i2c->address_next || !i2c->reading)) {
+    byte_out_start(i2c);
+  }
+}
+
+static sim_i2c_slave_t *slave_find(const i2c_model_t *i2c, uint8_t address)
+{
+  for (sim_i2c_slave_t *slave = i2c->slaves; slave != NULL; slave = slave->next) {
+    if (slave->address == address) {
+      return slave;
+    }
+  }
+  return NULL;
+}
+
+/* Receives a byte, bits includes the ACK before it if any */
+static void byte_in_start(i2c_model_t *i2c, unsigned bits)
+{
+  sim_i2c_slave_t *slave = i2c->slave;
+
+  i2c->shift = ((slave != NULL) && (slave->read != NULL)) ? slave->read(slave) : 0xFFU;
+  phase_set(i2c, PHASE_BYTE_IN, bits);
+}
+
+static void address_done(i2c_model_t *i2c)
+{
+  I2C_TypeDef *regs = REGS(i2c);
+  uint8_t      byte = i2c->shift;
+
+  i2c->address_next = false;
+  i2c->reading      = (byte & 1U) != 0;
+  i2c->read_done    = false;
+  i2c->slave        = slave_find(i2c, byte >> 1);
+  if (i2c->slave == NULL) {
+    regs->IF |= I2C_IF_NACK;
+    hold(i2c);
+    return;
+  }
+  if (i2c->slave->start != NULL) {
+    i2c->slave->start(i2c->slave, i2c->reading);
+  }
+  regs->IF |= I2C_IF_ACK;
+  if (i2c->reading) {
+    byte_in_start(i2c, 8);
+  } else {
+    hold(i2c);
+  }
+}
+
+static void data_out_done(i2c_model_t *i2c)
+{
+  sim_i2c_slave_t *slave = i2c->slave;
+  bool             ack   = true;
+
+  if ((slave != NULL) && (slave->write != NULL)) {
+    ack = slave->write(slave, i2c->shift);
+  }
+  REGS(i2c)->IF |= ack ? I2C_IF_ACK : I2C_IF_NACK;
+  if (!i2c->tx_valid) {
+    REGS(i2c)->IF |= I2C_IF_TXC;
+  }
+  hold(i2c);
+}
+
+static void byte_in_done(i2c_model_t *i2c)
+{
+  I2C_TypeDef *regs = REGS(i2c);
+
+  if (i2c->rx_count == RX_BUFFER_SIZE) {
+    sim_error("%s: byte received with RXDATA full", i2c->name);
+  }
+  i2c->rx_buffer[i2c->rx_count++] = i2c->shift;
+  regs->IF |= I2C_IF_RXDATAV;
+  if (i2c->pending_nack) {
+    i2c->pending_nack = false;
+    i2c->read_done    = true;
+    hold(i2c);
+  } else {
+    phase_set(i2c, PHASE_ACK_WAIT, 0);
+  }
+}
+
+static void step(sim_event_t *event)
+{
+  i2c_model_t *i2c  = event->arg;
+  I2C_TypeDef *regs = REGS(i2c);
+
+  switch (i2c->phase) {
+    case PHASE_START:
+      i2c->address_next = true;
+      hold(i2c);
+      break;
+
+    case PHASE_BYTE_OUT:
+      if (!i2c->address_next) {
+        data_out_done(i2c);
+      } else if (!i2c->stall) {
+        address_done(i2c);
+      }
+      // Stalled: SCL stays low, the byte never ends
+      break;
+
+    case PHASE_BYTE_IN:
+      byte_in_done(i2c);
+      break;
+
+    case PHASE_STOP:
+      if ((i2c->slave != NULL) && (i2c->slave->stop != NULL)) {
+        i2c->slave->stop(i2c->slave);
+      }
+      i2c->slave = NULL;
+      regs->IF  |= I2C_IF_MSTOP;
+      phase_set(i2c, PHASE_IDLE, 0);
+      break;
+
+    default:
+      break;
+  }
+  status_update(i2c);
+}
+
+static void abort_transfer(i2c_model_t *i2c)
+{
+  sim_event_cancel(&i2c->step);
+  i2c->phase         = PHASE_IDLE;
+  i2c->slave         = NULL;
+  i2c->pending_nack  = false;
+  i2c->pending_stop  = false;
+  i2c->pending_start = false;
+  i2c->address_next  = false;
+}
+
+static void command(i2c_model_t *i2c, uint32_t cmd)
+{
+  if (cmd & I2C_CMD_ABORT) {
+    abort_transfer(i2c);
+  }
+  if (cmd & I2C_CMD_CLEARTX) {
+    i2c->tx_valid = false;
+  }
+  if (cmd & I2C_CMD_CLEARPC) {
+    i2c->pending_nack  = false;
+    i2c->pending_stop  = false;
+    i2c->pending_start = false;
+  }
+  if (cmd & I2C_CMD_ACK) {
+    if (i2c->phase == PHASE_ACK_WAIT) {
+      byte_in_start(i2c, 9);
+    }
+  }
+  if (cmd & I2C_CMD_NACK) {
+    if (i2c->phase == PHASE_ACK_WAIT) {
+      i2c->read_done = true;
+      hold(i2c);
+    } else if ((i2c->phase != PHASE_IDLE) && !i2c->read_done) {
+      i2c->pending_nack = true;
+    }
+  }
+  if (cmd & I2C_CMD_START) {
+    i2c->pending_start = true;
+    if ((i2c->phase == PHASE_IDLE) || (i2c->phase == PHASE_HOLD)) {
+      start_start(i2c);
+    }
+  }
+  if (cmd & I2C_CMD_STOP) {
+    i2c->pending_stop = true;
+    if ((i2c->phase == PHASE_HOLD) || (i2c->phase == PHASE_ACK_WAIT)) {
+      stop_start(i2c);
+    } else if (i2c->phase == PHASE_IDLE) {
+      i2c->pending_stop = false;
+    }
+  }
+}
+
+static void i2c_read(sim_block_t *block, uint32_t offset)
+{
+  i2c_model_t *i2c = block->model;
+
+  if (offset != offsetof(I2C_TypeDef, RXDATA)) {
+    return;
+  }
+  if (i2c->rx_count == 0) {
+    REGS(i2c)->IF    |= I2C_IF_RXUF;
+    REGS(i2c)->RXDATA = 0;
+  } else {
+    REGS(i2c)->RXDATA = i2c->rx_buffer[0];
+    i2c->rx_buffer[0] = i2c->rx_buffer[1];
+    i2c->rx_count--;
+  }
+  status_update(i2c);
+}
+
+static void i2c_write(sim_block_t *block, uint32_t offset, uint32_t old,
+                      uint32_t value)
+{
+  i2c_model_t *i2c  = block->model;
+  I2C_TypeDef *regs = REGS(i2c);
+
+  switch (offset) {
+    case offsetof(I2C_TypeDef, EN):
+      if (!(regs->EN & I2C_EN_EN)) {
+        abort_transfer(i2c);
+        i2c->tx_valid = false;
+        i2c->rx_count = 0;
+      }
+      break;
+
+    case offsetof(I2C_TypeDef, CMD):
+      regs->CMD = 0;
+      if (regs->EN & I2C_EN_EN) {
+        command(i2c, value);
+      }
+      break;
+
+    case offsetof(I2C_TypeDef, TXDATA):
+      if (i2c->tx_valid) {
+        regs->IF |= I2C_IF_TXOF;
+        break;
+      }
+      i2c->tx_data  = (uint8_t)value;
+      i2c->tx_valid = true;
+      if ((i2c->phase == PHASE_HOLD)
+          && (i2c->address_next || (!i2c->reading && (i2c->slave != NULL)))) {
+        byte_out_start(i2c);
+      }
+      break;
+
+    case offsetof(I2C_TypeDef, IFC):
+      regs->IF &= ~value;
+      regs->IFC = 0;
+      break;
+
+    case offsetof(I2C_TypeDef, IFS):
+      regs->IF |= value;
+      regs->IFS = 0;
+      break;
+
+    case offsetof(I2C_TypeDef, STATE):
+    case offsetof(I2C_TypeDef, STATUS):
+      block->regs[offset / 4] = old;
+      break;
+
+    case offsetof(I2C_TypeDef, CTRL):
+      if (regs->CTRL & I2C_CTRL_SLAVE) {
+        sim_error("%s: slave mode is not modelled", i2c->name);
+      }
+      break;
+
+    default:
+      break;
+  }
+  status_update(i2c);
+}
+
+void sim_i2c_attach(I2C_TypeDef *i2c, sim_i2c_slave_t *slave)
+{
+  i2c_model_t *model = i2c_model(i2c);
+
+  slave->next   = model->slaves;
+  model->slaves = slave;
+}
+
+void sim_i2c_detach(I2C_TypeDef *i2c, sim_i2c_slave_t *slave)
+{
+  sim_i2c_slave_t **link = &i2c_model(i2c)->slaves;
+
+  while (*link != NULL) {
+    if (*link == slave) {
+      *link = slave->next;
+      return;
+    }
+    link = &(*link)->next;
+  }
+}
+
+void sim_i2c_stall(I2C_TypeDef *i2c, bool stall)
+{
+  i2c_model(i2c)->stall = stall;
+}
+
+void sim_i2c_bus_error(I2C_TypeDef *i2c)
+{
+  i2c_model_t *model = i2c_model(i2c);
+
+  abort_transfer(model);
+  REGS(model)->IF |= I2C_IF_BUSERR;
+  status_update(model);
+}
+
+/***************************************************************************//**
+ * EEPROM slave
+ ******************************************************************************/
+
+static void eeprom_start(sim_i2c_slave_t *slave, bool read)
+{
+  sim_eeprom_t *eeprom = (sim_eeprom_t *)slave;
+
+  eeprom->addressed = !read;
+}
+
+static bool eeprom_write(sim_i2c_slave_t *slave, uint8_t data)
+{
+  sim_eeprom_t *eeprom = (sim_eeprom_t *)slave;
+
+  if (eeprom->addressed) {
+    eeprom->pointer   = data;
+    eeprom->addressed = false;
+  } else {
+    eeprom->memory[eeprom->pointer++] = data;
+  }
+  return true;
+}
+
+static uint8_t eeprom_read(sim_i2c_slave_t *slave)
+{
+  sim_eeprom_t *eeprom = (sim_eeprom_t *)slave;
+
+  return eeprom->memory[eeprom->pointer++];
+}
+
+void sim_eeprom_init(sim_eeprom_t *eeprom, uint8_t address)
+{
+  *eeprom = (sim_eeprom_t){
+    .slave = {
+      .address = address,
+      .start   = eeprom_start,
+      .write   = eeprom_write,
+      .read    = eeprom_read,
+    },
+  };
+}
+
+void sim_i2c_init(void)
+{
+  for (unsigned i = 0; i < I2C_COUNT; i++) {
+    i2c_model_t *i2c = &i2cs[i];
+
+    i2c->block = sim_block_add(i2c->name, i2c->base, sizeof(I2C_TypeDef),
+                               SIM_BLOCK_ALIASES, i2c_read, i2c_write, i2c);
+    sim_block_clock(i2c->block, 0, i2c->clken_bit);
+    sim_event_init(&i2c->step, step, i2c);
+    status_update(i2c);
+  }
+}
@@ -0,0 +1,393 @@
+/*
+ *  IADC model
+ *
+ *  Conversions take 4 * OSR + 2 ADC clock cycles, the ADC clock being the
+ *  IADC clock divided by CTRL HSCLKRATE and by the SCHED prescaler of the
+ *  configuration in use:
+ *
+ *  - SINGLESTART arms a conversion of the SINGLE input, SCANSTART one of
+ *    each scan table entry MASKREQ selects. The IMMEDIATE trigger starts
+ *    them at once, and again after each one with the CONTINUOUS action; the
+ *    TIMER trigger on every TIMER period until stopped. A single conversion
+ *    goes before the rest of a scan.
+ *  - the result is the voltage sim_iadc_input_set() gave the positive input
+ *    against the configured reference, 12 bits, aligned and tagged with its
+ *    ID as the FIFO configuration asks
+ *  - each FIFO holds FIFO_SIZE results, its DVL interrupt flag and LDMA
+ *    request are set from DVL + 1 results
+ *
+ *  Negative inputs, gain, comparators, the digital averaging and PRS triggers
+ *  are not modelled.
+ */
+
+#include "sim.h"
+
+#define FIFO_SIZE       4U
+#define SINGLE_ID       0x20U
+#define INPUTS          256U
+
+typedef struct {
+  uint32_t data[FIFO_SIZE];
+  unsigned count;
+} fifo_t;
+
+typedef struct {
+  sim_block_t *block;
+  fifo_t       single_fifo;
+  fifo_t       scan_fifo;
+  bool         single_armed;    // Started, waiting for the timer trigger
+  bool         single_pending;  // Triggered, waiting for the converter
+  bool         scan_armed;
+  bool         scan_pending;
+  bool         scan_running;    // A scan pass is under way
+  unsigned     scan_entry;      // Next entry of the pass
+  bool         converting;
+  bool         converting_scan;
+  bool         timer_active;
+  uint16_t     millivolts[INPUTS];
+  sim_event_t  conversion;
+  sim_event_t  timer;
+} iadc_model_t;
+
+static iadc_model_t iadc;
+
+#define REGS  ((IADC_TypeDef *)iadc.block->regs)
+
+static uint32_t field(uint32_t reg, uint32_t mask, unsigned shift)
+{
+  return (reg & mask) >> shift;
+}
+
+static uint32_t src_adc_clock(void)
+{
+  return sim_cmu_iadcclk()
+         / (field(REGS->CTRL, _IADC_CTRL_HSCLKRATE_MASK, _IADC_CTRL_HSCLKRATE_SHIFT) + 1U);
+}
+
+static uint64_t conversion_ns(unsigned cfg)
+{
+  uint32_t osr   = 2U << field(REGS->CFG[cfg].CFG, _IADC_CFG_OSRHS_MASK, _IADC_CFG_OSRHS_SHIFT);
+  uint32_t presc = field(REGS->CFG[cfg].SCHED, _IADC_SCHED_PRESCALE_MASK, _IADC_SCHED_PRESCALE_SHIFT);
+  uint32_t freq  = src_adc_clock();
+
+  if (freq == 0) {
+    sim_error("IADC0 converts with its clock stopped");
+  }
+  return sim_cycles_ns((uint64_t)(4U * osr + 2U) * (presc + 1U), freq);
+}
+
+/* 12-bit result of the input an entry (SINGLE or SCAN register) selects */
+static uint32_t result(uint32_t entry)
+{
+  static const uint32_t reference_mv[4] = { 1210, 1250, 3300, 2640 };
+  unsigned              cfg   = field(entry, _IADC_SCAN_CFG_MASK, _IADC_SCAN_CFG_SHIFT);
+  uint32_t              input = (entry >> _IADC_SCAN_PINPOS_SHIFT) & (INPUTS - 1U);
+  uint32_t              ref   = reference_mv[field(REGS->CFG[cfg].CFG, _IADC_CFG_REFSEL_MASK,
+                                                   _IADC_CFG_REFSEL_SHIFT) & 3U];
+  uint32_t              value = (uint32_t)(((uint64_t)iadc.millivolts[input] * 4095U + ref / 2U) / ref);
+
+  return (value > 4095U) ? 4095U : value;
+}
+
+/* The FIFO word of a result, per ALIGNMENT and SHOWID */
+static uint32_t fifo_word(uint32_t fifocfg, uint32_t value, unsigned id)
+{
+  uint32_t alignment = field(fifocfg, _IADC_SINGLEFIFOCFG_ALIGNMENT_MASK,
+                             _IADC_SINGLEFIFOCFG_ALIGNMENT_SHIFT);
+  bool     show_id   = (fifocfg & IADC_SINGLEFIFOCFG_SHOWID) != 0;
+
+  switch (alignment) {
+    case _IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT16:
+      value <<= 4;
+      break;
+    case _IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT20:
+      value <<= 8;
+      break;
+    case _IADC_SINGLEFIFOCFG_ALIGNMENT_LEFT12:
+      return (value << 20) | (show_id ? id : 0U);
+    case _IADC_SINGLEFIFOCFG_ALIGNMENT_LEFT16:
+      return (value << 16) | (show_id ? id : 0U);
+    case _IADC_SINGLEFIFOCFG_ALIGNMENT_LEFT20:
+      return (value << 12) | (show_id ? id : 0U);
+    default:
+      break;
+  }
+  return value | (show_id ? (uint32_t)id << 24 : 0U);
+}
+
+static unsigned fifo_dvl(uint32_t fifocfg)
+{
+  return field(fifocfg, _IADC_SINGLEFIFOCFG_DVL_MASK, _IADC_SINGLEFIFOCFG_DVL_SHIFT) + 1U;
+}
+
+static uint32_t fifo_pop(fifo_t *fifo, uint32_t underflow)
+{
+  uint32_t word;
+
+  if (fifo->count == 0) {
+    REGS->IF |= underflow;
+    return 0;
+  }
+  word = fifo->data[0];
+  for (unsigned i = 1; i < fifo->count; i++) {
+    fifo->data[i - 1] = fifo->data[i];
+  }
+  fifo->count--;
+  return word;
+}
+
+static void status_update(void)
+{
+  uint32_t status = 0;
+
+  if (iadc.converting) {
+    status |= IADC_STATUS_CONVERTING;
+  }
+  if (iadc.single_armed || iadc.single_pending) {
+    status |= IADC_STATUS_SINGLEQUEUEPENDING;
+  }
+  if (iadc.scan_armed || iadc.scan_pending || iadc.scan_running) {
+    status |= IADC_STATUS_SCANQUEUEPENDING;
+  }
+  if (iadc.timer_active) {
+    status |= IADC_STATUS_TIMERACTIVE;
+  }
+  if (iadc.single_fifo.count != 0) {
+    status |= IADC_STATUS_SINGLEFIFODV;
+  }
+  if (iadc.scan_fifo.count != 0) {
+    status |= IADC_STATUS_SCANFIFODV;
+  }
+  REGS->STATUS         = status;
+  REGS->SINGLEFIFOSTAT = iadc.single_fifo.count;
+  REGS->SCANFIFOSTAT   = iadc.scan_fifo.count;
+  sim_irq_flags(iadc.block, IADC_IRQn, offsetof(IADC_TypeDef, IF),
+                offsetof(IADC_TypeDef, IEN));
+  sim_ldma_request(LDMAXBAR_CH_REQSEL_SOURCESEL_IADC0,
+                   LDMAXBAR_CH_REQSEL_SIGSEL_IADC0IADC_SINGLE,
+                   iadc.single_fifo.count >= fifo_dvl(REGS->SINGLEFIFOCFG));
+  sim_ldma_request(LDMAXBAR_CH_REQSEL_SOURCESEL_IADC0,
+                   LDMAXBAR_CH_REQSEL_SIGSEL_IADC0IADC_SCAN,
+                   iadc.scan_fifo.count >= fifo_dvl(REGS->SCANFIFOCFG));
+}
+
+static bool timer_triggered(bool scan)
+{
+  uint32_t trigsel = scan
+                     ? field(REGS->TRIGGER, _IADC_TRIGGER_SCANTRIGSEL_MASK, _IADC_TRIGGER_SCANTRIGSEL_SHIFT)
+                     : field(REGS->TRIGGER, _IADC_TRIGGER_SINGLETRIGSEL_MASK, _IADC_TRIGGER_SINGLETRIGSEL_SHIFT);
+
+  if ((trigsel != _IADC_TRIGGER_SINGLETRIGSEL_IMMEDIATE)
+      && (trigsel != _IADC_TRIGGER_SINGLETRIGSEL_TIMER)) {
+    sim_error("IADC0: only the IMMEDIATE and TIMER triggers are modelled");
+  }
+  return trigsel == _IADC_TRIGGER_SINGLETRIGSEL_TIMER;
+}
+
+static bool continuous(bool scan)
+{
+  return scan ? (REGS->TRIGGER & IADC_TRIGGER_SCANTRIGACTION_CONTINUOUS) != 0
+         : (REGS->TRIGGER & IADC_TRIGGER_SINGLETRIGACTION_CONTINUOUS) != 0;
+}
+
+/* Next scan table entry of the pass, from entry on, 16 if none */
+static unsigned scan_next(unsigned entry)
+{
+  uint32_t mask = REGS->MASKREQ & _IADC_MASKREQ_MASKREQ_MASK;
+
+  while ((entry < 16U) && !(mask & (1U << entry))) {
+    entry++;
+  }
+  return entry;
+}
+
+static void conversion_start(void)
+{
+  uint32_t entry;
+
+  if (iadc.converting || !(REGS->EN & IADC_EN_EN)) {
+    return;
+  }
+  if (!iadc.scan_running && iadc.scan_pending && !iadc.single_pending) {
+    iadc.scan_pending = false;
+    iadc.scan_entry   = scan_next(0);
+    iadc.scan_running = iadc.scan_entry != 16U;
+  }
+  if (iadc.single_pending) {
+    iadc.single_pending  = false;
+    iadc.converting_scan = false;
+    entry                = REGS->SINGLE;
+  } else if (iadc.scan_running) {
+    iadc.converting_scan = true;
+    entry                = REGS->SCANTABLE[iadc.scan_entry].SCAN;
+  } else {
+    return;
+  }
+  iadc.converting = true;
+  sim_event_schedule(&iadc.conversion,
+                     conversion_ns(field(entry, _IADC_SCAN_CFG_MASK, _IADC_SCAN_CFG_SHIFT)));
+}
+
+static void fifo_push(fifo_t *fifo, uint32_t fifocfg, uint32_t word,
+                      uint32_t level_flag, uint32_t overflow_flag)
+{
+  if (fifo->count == FIFO_SIZE) {
+    REGS->IF |= overflow_flag;
+    return;
+  }
+  fifo->data[fifo->count++] = word;
+  if (fifo->count >= fifo_dvl(fifocfg)) {
+    REGS->IF |= level_flag;
+  }
+}
+
+static void conversion_done(sim_event_t *event)
+{
+  uint32_t entry;
+  uint32_t value;
+
+  (void)event;
+  iadc.converting = false;
+  if (!iadc.converting_scan) {
+    value = result(REGS->SINGLE);
+    REGS->SINGLEDATA = value;
+    fifo_push(&iadc.single_fifo, REGS->SINGLEFIFOCFG,
+              fifo_word(REGS->SINGLEFIFOCFG, value, SINGLE_ID),
+              IADC_IF_SINGLEFIFODVL, IADC_IF_SINGLEFIFOOF);
+    REGS->IF |= IADC_IF_SINGLEDONE;
+    if (!timer_triggered(false) && continuous(false)) {
+      iadc.single_pending = true;
+    }
+  } else {
+    entry = REGS->SCANTABLE[iadc.scan_entry].SCAN;
+    value = result(entry);
+    REGS->SCANDATA = value;
+    fifo_push(&iadc.scan_fifo, REGS->SCANFIFOCFG,
+              fifo_word(REGS->SCANFIFOCFG, value, iadc.scan_entry),
+              IADC_IF_SCANFIFODVL, IADC_IF_SCANFIFOOF);
+    REGS->IF |= IADC_IF_SCANENTRYDONE;
+    iadc.scan_entry = scan_next(iadc.scan_entry + 1U);
+    if (iadc.scan_entry == 16U) {
+      iadc.scan_running = false;
+      REGS->IF         |= IADC_IF_SCANTABLEDONE;
+      if (!timer_triggered(true) && continuous(true)) {
+        iadc.scan_pending = true;
+      }
+    }
+  }
+  conversion_start();
+  status_update();
+}
+
+/* TIMER period: triggers the conversions armed for it */
+static void timer_tick(sim_event_t *event)
+{
+  uint32_t cycles = field(REGS->TIMER, _IADC_TIMER_TIMER_MASK, _IADC_TIMER_TIMER_SHIFT);
+
+  (void)event;
+  iadc.single_pending |= iadc.single_armed;
+  iadc.scan_pending   |= iadc.scan_armed;
+  conversion_start();
+  sim_event_schedule(&iadc.timer, sim_cycles_ns(cycles + 1U, src_adc_clock()));
+  status_update();
+}
+
+static void iadc_read(sim_block_t *block, uint32_t offset)
+{
+  (void)block;
+  if (offset == offsetof(IADC_TypeDef, SINGLEFIFODATA)) {
+    REGS->SINGLEFIFODATA = fifo_pop(&iadc.single_fifo, IADC_IF_SINGLEFIFOUF);
+  } else if (offset == offsetof(IADC_TypeDef, SCANFIFODATA)) {
+    REGS->SCANFIFODATA = fifo_pop(&iadc.scan_fifo, IADC_IF_SCANFIFOUF);
+  } else {
+    return;
+  }
+  status_update();
+}
+
+static void iadc_write(sim_block_t *block, uint32_t offset, uint32_t old,
+                       uint32_t value)
+{
+  (void)block;
+  switch (offset) {
+    case offsetof(IADC_TypeDef, EN):
+      if (!(REGS->EN & IADC_EN_EN)) {
+        sim_event_cancel(&iadc.conversion);
+        sim_event_cancel(&iadc.timer);
+        iadc.converting     = false;
+        iadc.single_armed   = false;
+        iadc.single_pending = false;
+        iadc.scan_armed     = false;
+        iadc.scan_pending   = false;
+        iadc.scan_running   = false;
+        iadc.timer_active  = false;
+        iadc.single_fifo.count = 0;
+        iadc.scan_fifo.count   = 0;
+      }
+      break;
+
+    case offsetof(IADC_TypeDef, CMD):
+      REGS->CMD = 0;
+      if (value & IADC_CMD_SINGLESTOP) {
+        iadc.single_armed   = false;
+        iadc.single_pending = false;
+      }
+      if (value & IADC_CMD_SCANSTOP) {
+        iadc.scan_armed   = false;
+        iadc.scan_pending = false;
+        iadc.scan_running = false;
+      }
+      if (value & IADC_CMD_SINGLESTART) {
+        if (timer_triggered(false)) {
+          iadc.single_armed = true;
+        } else {
+          iadc.single_pending = true;
+        }
+      }
+      if (value & IADC_CMD_SCANSTART) {
+        if (timer_triggered(true)) {
+          iadc.scan_armed = true;
+        } else {
+          iadc.scan_pending = true;
+        }
+      }
+      if (value & IADC_CMD_TIMERDIS) {
+        iadc.timer_active = false;
+        sim_event_cancel(&iadc.timer);
+      }
+      if ((value & IADC_CMD_TIMEREN) && !iadc.timer_active) {
+        iadc.timer_active = true;
+        sim_event_schedule(&iadc.timer,
+                           sim_cycles_ns(field(REGS->TIMER, _IADC_TIMER_TIMER_MASK,
+                                               _IADC_TIMER_TIMER_SHIFT) + 1U,
+                                         src_adc_clock()));
+      }
+      conversion_start();
+      break;
+
+    case offsetof(IADC_TypeDef, STATUS):
+    case offsetof(IADC_TypeDef, SINGLEFIFOSTAT):
+    case offsetof(IADC_TypeDef, SCANFIFOSTAT):
+      block->regs[offset / 4] = old;
+      break;
+
+    default:
+      break;
+  }
+  status_update();
+}
+
+void sim_iadc_input_set(uint32_t posinput, uint32_t millivolts)
+{
+  iadc.millivolts[posinput & (INPUTS - 1U)] = (uint16_t)millivolts;
+}
+
+void sim_iadc_init(void)
+{
+  iadc.block = sim_block_add("IADC0", IADC0_BASE, sizeof(IADC_TypeDef),
+                             SIM_BLOCK_ALIASES, iadc_read, iadc_write, &iadc);
+  sim_block_clock(iadc.block, 0, _CMU_CLKEN0_IADC0_SHIFT);
+  sim_event_init(&iadc.conversion, conversion_done, NULL);
+  sim_event_init(&iadc.timer, timer_tick, NULL);
+  status_update();
+}
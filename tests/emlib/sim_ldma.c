@@ -0,0 +1,286 @@
+/*
+ *  LDMA and LDMAXBAR model
+ *
+ *  Channels run transfer descriptors, loaded from memory by LINKLOAD or
+ *  written to the channel registers before CHEN is set:
+ *
+ *  - a channel whose LDMAXBAR request line is high, or whose descriptor has
+ *    STRUCTREQ set, transfers one block (REQMODE BLOCK) or the rest of the
+ *    descriptor (REQMODE ALL) per request
+ *  - XFERCNT, SRC and DST advance in the channel registers as units move
+ *  - at the end of a descriptor DONEIEN sets the channel IF bit, DECLOOPCNT
+ *    follows the link while LOOPCNT is nonzero and ends the transfer after,
+ *    LINK loads the next descriptor, otherwise the channel stops and sets
+ *    its CHDONE bit
+ *
+ *  Transfers take no time: a request is served as soon as it is raised,
+ *  peripherals pace the transfers with their request lines. Memory is
+ *  accessed with sim_bus_read() and sim_bus_write(), so descriptors and
+ *  buffers must be static for their addresses to fit in 32 bits.
+ */
+
+#include "sim.h"
+
+#define REQUEST_LINES   64U
+
+typedef struct {
+  sim_block_t *ldma;
+  sim_block_t *xbar;
+  bool         requests[REQUEST_LINES];   // By SIGSEL, unique on this device
+  uint32_t     struct_request;            // Channels with a STRUCTREQ pending
+  uint32_t     descriptor[DMA_CHAN_COUNT];// Address of the current descriptor
+  bool         serving;
+} ldma_model_t;
+
+static ldma_model_t ldma;
+
+#define LDMA_REGS  ((LDMA_TypeDef *)ldma.ldma->regs)
+#define XBAR_REGS  ((LDMAXBAR_TypeDef *)ldma.xbar->regs)
+
+static const uint16_t block_units[16] = {
+  1, 2, 3, 4, 6, 8, 0, 16, 0, 32, 64, 128, 256, 512, 1024, 0
+};
+
+static void irq_update(void)
+{
+  sim_irq_flags(ldma.ldma, LDMA_IRQn, offsetof(LDMA_TypeDef, IF),
+                offsetof(LDMA_TypeDef, IEN));
+}
+
+static uint32_t field(uint32_t reg, uint32_t mask, unsigned shift)
+{
+  return (reg & mask) >> shift;
+}
+
+static void channel_stop(unsigned ch, bool done)
+{
+  uint32_t bit = 1U << ch;
+
+  LDMA_REGS->CHEN     &= ~bit;
+  LDMA_REGS->CHSTATUS &= ~bit;
+  ldma.struct_request &= ~bit;
+  if (done) {
+    LDMA_REGS->CHDONE |= bit;
+  }
+}
+
+static void descriptor_load(unsigned ch, uint32_t address)
+{
+  LDMA_CH_TypeDef *regs = &LDMA_REGS->CH[ch];
+  uint32_t         ctrl = sim_bus_read(address, 4);
+  uint32_t         src  = sim_bus_read(address + 4U, 4);
+  uint32_t         dst  = sim_bus_read(address + 8U, 4);
+
+  if (field(ctrl, _LDMA_CH_CTRL_STRUCTTYPE_MASK, _LDMA_CH_CTRL_STRUCTTYPE_SHIFT)
+      != _LDMA_CH_CTRL_STRUCTTYPE_TRANSFER) {
+    sim_error("LDMA: channel %u loads a descriptor type the model lacks", ch);
+  }
+  ldma.descriptor[ch] = address;
+  regs->SRC  = (ctrl & LDMA_CH_CTRL_SRCMODE) ? regs->SRC + src : src;
+  regs->DST  = (ctrl & LDMA_CH_CTRL_DSTMODE) ? regs->DST + dst : dst;
+  regs->CTRL = ctrl;
+  regs->LINK = sim_bus_read(address + 12U, 4);
+  if (ctrl & LDMA_CH_CTRL_STRUCTREQ) {
+    ldma.struct_request |= 1U << ch;
+  }
+}
+
+static uint32_t link_address(unsigned ch)
+{
+  uint32_t link = LDMA_REGS->CH[ch].LINK;
+
+  if (link & LDMA_CH_LINK_LINKMODE) {
+    return ldma.descriptor[ch] + (link & _LDMA_CH_LINK_LINKADDR_MASK);
+  }
+  return link & _LDMA_CH_LINK_LINKADDR_MASK;
+}
+
+static void channel_start(unsigned ch)
+{
+  LDMA_REGS->CHEN     |= 1U << ch;
+  LDMA_REGS->CHSTATUS |= 1U << ch;
+  LDMA_REGS->CHDONE   &= ~(1U << ch);
+}
+
+/* Ends the current descriptor, goes on with the next one if linked */
+static void descriptor_done(unsigned ch)
+{
+  LDMA_CH_TypeDef *regs = &LDMA_REGS->CH[ch];
+  uint32_t         ctrl = regs->CTRL;
+
+  if (ctrl & LDMA_CH_CTRL_DONEIEN) {
+    LDMA_REGS->IF |= 1U << ch;
+  }
+  if (ctrl & LDMA_CH_CTRL_DECLOOPCNT) {
+    if ((regs->LOOP & _LDMA_CH_LOOP_LOOPCNT_MASK) == 0) {
+      channel_stop(ch, true);
+      return;
+    }
+    regs->LOOP--;
+  }
+  if (regs->LINK & LDMA_CH_LINK_LINK) {
+    descriptor_load(ch, link_address(ch));
+  } else {
+    channel_stop(ch, true);
+  }
+}
+
+static uint32_t increment(uint32_t inc, unsigned size, bool negative)
+{
+  static const uint8_t units[4] = { 1, 2, 4, 0 };
+  uint32_t             step     = units[inc] * size;
+
+  return negative ? (uint32_t)-step : step;
+}
+
+static uint32_t swap(uint32_t value, unsigned size)
+{
+  if (size == 2) {
+    return ((value & 0xFFU) << 8) | ((value >> 8) & 0xFFU);
+  }
+  if (size == 4) {
+    return __builtin_bswap32(value);
+  }
+  return value;
+}
+
+/* Moves one block, or the rest of the descriptor */
+static void channel_transfer(unsigned ch)
+{
+  LDMA_CH_TypeDef *regs  = &LDMA_REGS->CH[ch];
+  uint32_t         ctrl  = regs->CTRL;
+  uint32_t         cfg   = regs->CFG;
+  unsigned         size  = 1U << field(ctrl, _LDMA_CH_CTRL_SIZE_MASK, _LDMA_CH_CTRL_SIZE_SHIFT);
+  uint32_t         src_step = increment(field(ctrl, _LDMA_CH_CTRL_SRCINC_MASK, _LDMA_CH_CTRL_SRCINC_SHIFT),
+                                        size, cfg & LDMA_CH_CFG_SRCINCSIGN);
+  uint32_t         dst_step = increment(field(ctrl, _LDMA_CH_CTRL_DSTINC_MASK, _LDMA_CH_CTRL_DSTINC_SHIFT),
+                                        size, cfg & LDMA_CH_CFG_DSTINCSIGN);
+  uint32_t         count = field(ctrl, _LDMA_CH_CTRL_XFERCNT_MASK, _LDMA_CH_CTRL_XFERCNT_SHIFT) + 1U;
+  uint32_t         units = block_units[field(ctrl, _LDMA_CH_CTRL_BLOCKSIZE_MASK,
+                                             _LDMA_CH_CTRL_BLOCKSIZE_SHIFT)];
+
+  if ((ctrl & LDMA_CH_CTRL_REQMODE) || (units == 0) || (units > count)) {
+    units = count;
+  }
+  for (uint32_t i = 0; i < units; i++) {
+    uint32_t value = sim_bus_read(regs->SRC, size);
+
+    if (ctrl & LDMA_CH_CTRL_BYTESWAP) {
+      value = swap(value, size);
+    }
+    sim_bus_write(regs->DST, value, size);
+    regs->SRC += src_step;
+    regs->DST += dst_step;
+    count--;
+    if (count != 0) {
+      regs->CTRL = (regs->CTRL & ~_LDMA_CH_CTRL_XFERCNT_MASK)
+                   | ((count - 1U) << _LDMA_CH_CTRL_XFERCNT_SHIFT);
+    }
+  }
+  if (count == 0) {
+    descriptor_done(ch);
+  }
+}
+
+static bool channel_requested(unsigned ch)
+{
+  uint32_t reqsel = XBAR_REGS->CH[ch].REQSEL;
+  uint32_t signal = reqsel & _LDMAXBAR_CH_REQSEL_SIGSEL_MASK;
+  uint32_t bit    = 1U << ch;
+
+  if (ldma.struct_request & bit) {
+    ldma.struct_request &= ~bit;
+    return true;
+  }
+  if ((reqsel & _LDMAXBAR_CH_REQSEL_SOURCESEL_MASK) == 0
+      || (LDMA_REGS->REQDIS & bit)) {
+    return false;
+  }
+  return ldma.requests[signal];
+}
+
+/* Serves the requests until every channel is idle or waits for one */
+static void serve(void)
+{
+  bool progress = true;
+
+  if (ldma.serving) {
+    return;
+  }
+  ldma.serving = true;
+  while (progress && (LDMA_REGS->EN & LDMA_EN_EN)) {
+    progress = false;
+    for (unsigned ch = 0; ch < DMA_CHAN_COUNT; ch++) {
+      if ((LDMA_REGS->CHEN & (1U << ch)) && channel_requested(ch)) {
+        channel_transfer(ch);
+        progress = true;
+      }
+    }
+  }
+  ldma.serving = false;
+  irq_update();
+}
+
+void sim_ldma_request(uint32_t source, uint32_t signal, bool level)
+{
+  (void)source;
+  ldma.requests[signal & _LDMAXBAR_CH_REQSEL_SIGSEL_MASK] = level;
+  if (level && (ldma.ldma != NULL)) {
+    serve();
+  }
+}
+
+static void ldma_write(sim_block_t *block, uint32_t offset, uint32_t old,
+                       uint32_t value)
+{
+  uint32_t bits;
+
+  (void)block;
+  if (offset == offsetof(LDMA_TypeDef, LINKLOAD)) {
+    LDMA_REGS->LINKLOAD = 0;
+    for (unsigned ch = 0; ch < DMA_CHAN_COUNT; ch++) {
+      if (value & (1U << ch)) {
+        channel_start(ch);
+        descriptor_load(ch, LDMA_REGS->CH[ch].LINK & _LDMA_CH_LINK_LINKADDR_MASK);
+      }
+    }
+  } else if (offset == offsetof(LDMA_TypeDef, CHEN)) {
+    bits = LDMA_REGS->CHEN;
+    for (unsigned ch = 0; ch < DMA_CHAN_COUNT; ch++) {
+      if (bits & ~old & (1U << ch)) {
+        channel_start(ch);
+      } else if (old & ~bits & (1U << ch)) {
+        channel_stop(ch, false);
+      }
+    }
+  } else if (offset == offsetof(LDMA_TypeDef, CHDIS)) {
+    LDMA_REGS->CHDIS = 0;
+    for (unsigned ch = 0; ch < DMA_CHAN_COUNT; ch++) {
+      if (value & (1U << ch)) {
+        channel_stop(ch, false);
+      }
+    }
+  } else if ((offset == offsetof(LDMA_TypeDef, IFC))
+             || (offset == offsetof(LDMA_TypeDef, IFS))) {
+    if (offset == offsetof(LDMA_TypeDef, IFC)) {
+      LDMA_REGS->IF &= ~value;
+    } else {
+      LDMA_REGS->IF |= value;
+    }
+    LDMA_REGS->IFC = 0;
+    LDMA_REGS->IFS = 0;
+  } else if (offset == offsetof(LDMA_TypeDef, CHSTATUS)) {
+    LDMA_REGS->CHSTATUS = old;
+  }
+  serve();
+}
+
+void sim_ldma_init(void)
+{
+  ldma.ldma = sim_block_add("LDMA", LDMA_BASE, sizeof(LDMA_TypeDef),
+                            SIM_BLOCK_ALIASES, NULL, ldma_write, &ldma);
+  ldma.xbar = sim_block_add("LDMAXBAR", LDMAXBAR_BASE, sizeof(LDMAXBAR_TypeDef),
+                            SIM_BLOCK_ALIASES, NULL, NULL, &ldma);
+  sim_block_clock(ldma.ldma, 0, _CMU_CLKEN0_LDMA_SHIFT);
+  sim_block_clock(ldma.xbar, 0, _CMU_CLKEN0_LDMAXBAR_SHIFT);
+}
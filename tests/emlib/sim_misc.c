@@ -0,0 +1,55 @@
+/*
+ *  Blocks emlib configures but whose behaviour is not modelled
+ *
+ *  GPIO, PRS, SYSCFG and the FSRCO, LFRCO and ULFRCO oscillators are plain
+ *  registers: emlib writes routes and consumers there and reads back what it
+ *  wrote, but no signal goes anywhere. DEVINFO is read-only and holds
+ *  calibration values that are nonzero, so emlib's checks for unprogrammed
+ *  parts pass, and a fixed EUI-64.
+ */
+
+#include "sim.h"
+
+static sim_block_t *devinfo;
+
+static void devinfo_init(void)
+{
+  DEVINFO_TypeDef *regs = (DEVINFO_TypeDef *)devinfo->regs;
+
+  regs->PART    = 0x0100CD00U | 22U;
+  regs->MSIZE   = (32U << 16) | 512U;
+  regs->EUI64L  = 0x89ABCDEFU;
+  regs->EUI64H  = 0x01234567U;
+  regs->CALTEMP = 25U;
+  for (unsigned i = 0; i < 18; i++) {
+    // Distinct per band, in the FREQRANGE and TUNING fields
+    regs->HFRCODPLLCAL[i].HFRCODPLLCAL = (i << 16) | 0x40U;
+    regs->HFRCOEM23CAL[i].HFRCOEM23CAL = (i << 16) | 0x40U;
+  }
+}
+
+void sim_misc_init(void)
+{
+  sim_block_t *block;
+
+  block = sim_block_add("GPIO", GPIO_BASE, sizeof(GPIO_TypeDef),
+                        SIM_BLOCK_ALIASES, NULL, NULL, NULL);
+  sim_block_clock(block, 0, _CMU_CLKEN0_GPIO_SHIFT);
+  block = sim_block_add("PRS", PRS_BASE, sizeof(PRS_TypeDef),
+                        SIM_BLOCK_ALIASES, NULL, NULL, NULL);
+  sim_block_clock(block, 0, _CMU_CLKEN0_PRS_SHIFT);
+  block = sim_block_add("SYSCFG", SYSCFG_BASE, sizeof(SYSCFG_TypeDef),
+                        SIM_BLOCK_ALIASES, NULL, NULL, NULL);
+  sim_block_clock(block, 0, _CMU_CLKEN0_SYSCFG_SHIFT);
+  sim_block_add("FSRCO", FSRCO_BASE, sizeof(FSRCO_TypeDef),
+                SIM_BLOCK_ALIASES, NULL, NULL, NULL);
+  sim_block_add("LFRCO", LFRCO_BASE, sizeof(LFRCO_TypeDef),
+                SIM_BLOCK_ALIASES, NULL, NULL, NULL);
+  sim_block_add("ULFRCO", ULFRCO_BASE, sizeof(ULFRCO_TypeDef),
+                SIM_BLOCK_ALIASES, NULL, NULL, NULL);
+
+  devinfo = sim_block_add("DEVINFO", DEVINFO_BASE, sizeof(DEVINFO_TypeDef),
+                          SIM_BLOCK_UNTRAPPED | SIM_BLOCK_READ_ONLY,
+                          NULL, NULL, NULL);
+  devinfo_init();
+}
@@ -0,0 +1,290 @@
+/*
+ *  MSC and flash model
+ *
+ *  The flash is mapped read-only at FLASH_BASE and changes only through the
+ *  MSC, like on the device:
+ *
+ *  - LOCK takes the unlock key, any other value locks the MSC registers
+ *  - ADDRB selects the word to program or the page to erase, an address
+ *    outside the flash sets INVADDR
+ *  - WDATA holds one word while the previous one is programmed: a word written
+ *    while the flash is busy clears WDATAREADY until programming starts.
+ *    Programming clears bits only and advances ADDRB, within the page.
+ *  - ERASEPAGE and ERASEMAIN0 set the page or the whole flash to 0xFF
+ *
+ *  WDATAREADY drives the MSCWDATA LDMA request. sim_flash_fail_after()
+ *  interrupts an operation as a power failure would: the word being
+ *  programmed is left half written, the page being erased half erased.
+ */
+
+#include <string.h>
+
+#include "sim.h"
+
+#define WORD_PROGRAM_NS       11000U
+#define PAGE_ERASE_NS         20000000U
+#define MASS_ERASE_NS         40000000U
+
+typedef enum {
+  OP_IDLE,
+  OP_PROGRAM,
+  OP_ERASE_PAGE,
+  OP_ERASE_MAIN
+} op_t;
+
+typedef struct {
+  sim_block_t      *msc;
+  sim_block_t      *flash;
+  sim_event_t       done;
+  op_t              op;
+  uint32_t          address;      // Word being programmed or page being erased
+  uint32_t          word;
+  bool              buffered;     // A word waits in WDATA
+  uint32_t          buffer;
+  uint32_t          fail_after;   // Operations before the power fails, 0 for never
+  bool              failed;
+  sim_flash_stats_t stats;
+} msc_model_t;
+
+static msc_model_t msc;
+
+#define MSC_REGS    ((MSC_TypeDef *)msc.msc->regs)
+#define FLASH_WORDS (msc.flash->regs)
+
+static bool flash_address(uint32_t address)
+{
+  return (address >= FLASH_BASE) && (address - FLASH_BASE < SIM_FLASH_SIZE);
+}
+
+static void status_update(void)
+{
+  uint32_t status = MSC_REGS->STATUS & ~(MSC_STATUS_BUSY | MSC_STATUS_WDATAREADY
+                                         | MSC_STATUS_PENDING | MSC_STATUS_LOCKED);
+
+  if (msc.op != OP_IDLE) {
+    status |= MSC_STATUS_BUSY;
+  }
+  if (msc.buffered) {
+    status |= MSC_STATUS_PENDING;
+  } else {
+    status |= MSC_STATUS_WDATAREADY;
+  }
+  if (msc.failed) {
+    status |= MSC_STATUS_LOCKED;
+  }
+  MSC_REGS->STATUS = status;
+  // After a power failure the LDMA drains into WDATA, which ignores it, as
+  // the CPU would
+  sim_ldma_request(LDMAXBAR_CH_REQSEL_SOURCESEL_MSC,
+                   LDMAXBAR_CH_REQSEL_SIGSEL_MSCWDATA,
+                   !msc.buffered && (msc.op != OP_ERASE_PAGE)
+                   && (msc.op != OP_ERASE_MAIN));
+}
+
+/* Counts an operation towards sim_flash_fail_after(), true if the power
+   fails during it */
+static bool power_fails(void)
+{
+  if ((msc.fail_after == 0) || (--msc.fail_after != 0)) {
+    return false;
+  }
+  msc.failed   = true;
+  msc.buffered = false;
+  return true;
+}
+
+static void operation_start(op_t op, uint64_t duration_ns)
+{
+  msc.op = op;
+  msc.stats.busy_ns += duration_ns;
+  sim_event_schedule(&msc.done, duration_ns);
+  status_update();
+}
+
+static void program_start(uint32_t word)
+{
+  uint32_t address = MSC_REGS->ADDRB;
+
+  if ((address & 3U) || !flash_address(address)) {
+    sim_error("MSC: programming invalid address 0x%08x", address);
+  }
+  msc.address = address;
+  msc.word    = word;
+  operation_start(OP_PROGRAM, WORD_PROGRAM_NS);
+}
+
+static void erase(uint32_t address, uint32_t size)
+{
+  memset((void *)&FLASH_WORDS[(address - FLASH_BASE) / 4], 0xFF, size);
+}
+
+static void operation_done(sim_event_t *event)
+{
+  op_t     op   = msc.op;
+  bool     fail = power_fails();
+  uint32_t index;
+
+  (void)event;
+  msc.op = OP_IDLE;
+  switch (op) {
+    case OP_PROGRAM:
+      index = (msc.address - FLASH_BASE) / 4;
+      // Only clears bits, half of them if the power fails
+      FLASH_WORDS[index] &= fail ? (msc.word | 0xFFFF0000U) : msc.word;
+      msc.stats.word_writes++;
+      if (((msc.address + 4U) & (SIM_FLASH_PAGE_SIZE - 1U)) != 0) {
+        MSC_REGS->ADDRB = msc.address + 4U;
+      }
+      if (msc.buffered) {
+        msc.buffered = false;
+        program_start(msc.buffer);
+        return;
+      }
+      break;
+
+    case OP_ERASE_PAGE:
+      erase(msc.address, fail ? SIM_FLASH_PAGE_SIZE / 2 : SIM_FLASH_PAGE_SIZE);
+      msc.stats.page_erases++;
+      break;
+
+    case OP_ERASE_MAIN:
+      erase(FLASH_BASE, fail ? SIM_FLASH_SIZE / 2 : SIM_FLASH_SIZE);
+      msc.stats.page_erases += SIM_FLASH_SIZE / SIM_FLASH_PAGE_SIZE;
+      break;
+
+    default:
+      break;
+  }
+  status_update();
+}
+
+static void msc_read(sim_block_t *block, uint32_t offset)
+{
+  (void)block;
+  if (offset == offsetof(MSC_TypeDef, STATUS)) {
+    status_update();
+  }
+}
+
+static void msc_write(sim_block_t *block, uint32_t offset, uint32_t old,
+                      uint32_t value)
+{
+  bool     locked = (MSC_REGS->STATUS & MSC_STATUS_REGLOCK) != 0;
+  uint32_t address;
+
+  (void)block;
+  if (offset == offsetof(MSC_TypeDef, LOCK)) {
+    MSC_REGS->LOCK = 0;
+    if (value == MSC_LOCK_LOCKKEY_UNLOCK) {
+      MSC_REGS->STATUS &= ~MSC_STATUS_REGLOCK;
+    } else {
+      MSC_REGS->STATUS |= MSC_STATUS_REGLOCK;
+    }
+    return;
+  }
+  if (offset == offsetof(MSC_TypeDef, STATUS)) {
+    MSC_REGS->STATUS = old;
+    return;
+  }
+  if (locked && ((offset == offsetof(MSC_TypeDef, WRITECTRL))
+                 || (offset == offsetof(MSC_TypeDef, ADDRB))
+                 || (offset == offsetof(MSC_TypeDef, MISCLOCKWORD)))) {
+    block->regs[offset / 4] = old;
+    return;
+  }
+
+  if (offset == offsetof(MSC_TypeDef, ADDRB)) {
+    if (flash_address(MSC_REGS->ADDRB)) {
+      MSC_REGS->STATUS &= ~MSC_STATUS_INVADDR;
+    } else {
+      MSC_REGS->STATUS |= MSC_STATUS_INVADDR;
+    }
+  } else if (offset == offsetof(MSC_TypeDef, WDATA)) {
+    if (locked || msc.failed || !(MSC_REGS->WRITECTRL & MSC_WRITECTRL_WREN)
+        || (MSC_REGS->STATUS & MSC_STATUS_INVADDR)) {
+      return;
+    }
+    if (msc.buffered) {
+      sim_error("MSC: WDATA written while not ready");
+    }
+    if (msc.op == OP_IDLE) {
+      program_start(value);
+    } else if (msc.op == OP_PROGRAM) {
+      msc.buffered = true;
+      msc.buffer   = value;
+      status_update();
+    } else {
+      sim_error("MSC: WDATA written during an erase");
+    }
+  } else if (offset == offsetof(MSC_TypeDef, WRITECMD)) {
+    MSC_REGS->WRITECMD = 0;
+    address = MSC_REGS->ADDRB;
+    if (locked || msc.failed || !(MSC_REGS->WRITECTRL & MSC_WRITECTRL_WREN)) {
+      return;
+    }
+    if ((value & (MSC_WRITECMD_ERASEPAGE | MSC_WRITECMD_ERASEMAIN0))
+        && (msc.op != OP_IDLE)) {
+      sim_error("MSC: erase started while busy");
+    }
+    if ((value & MSC_WRITECMD_ERASEPAGE) && flash_address(address)) {
+      msc.address = address & ~(SIM_FLASH_PAGE_SIZE - 1U);
+      operation_start(OP_ERASE_PAGE, PAGE_ERASE_NS);
+    } else if ((value & MSC_WRITECMD_ERASEMAIN0)
+               && !(MSC_REGS->MISCLOCKWORD & MSC_MISCLOCKWORD_MELOCKBIT)) {
+      operation_start(OP_ERASE_MAIN, MASS_ERASE_NS);
+    }
+    // WRITEEND: the buffered word, if any, is still programmed
+  }
+}
+
+void sim_flash_stats_get(sim_flash_stats_t *stats)
+{
+  *stats = msc.stats;
+}
+
+void sim_flash_clear(void)
+{
+  erase(FLASH_BASE, SIM_FLASH_SIZE);
+}
+
+void sim_flash_save(void *image)
+{
+  memcpy(image, (const void *)FLASH_WORDS, SIM_FLASH_SIZE);
+}
+
+void sim_flash_restore(const void *image)
+{
+  memcpy((void *)FLASH_WORDS, image, SIM_FLASH_SIZE);
+}
+
+void sim_flash_fail_after(uint32_t operations)
+{
+  msc.fail_after = operations;
+}
+
+void sim_flash_power_cycle(void)
+{
+  sim_event_cancel(&msc.done);
+  msc.op         = OP_IDLE;
+  msc.buffered   = false;
+  msc.failed     = false;
+  msc.fail_after = 0;
+  MSC_REGS->WRITECTRL = 0;
+  MSC_REGS->ADDRB     = 0;
+  MSC_REGS->STATUS    = 0;
+  status_update();
+}
+
+void sim_msc_init(void)
+{
+  msc.msc   = sim_block_add("MSC", MSC_BASE, sizeof(MSC_TypeDef),
+                            SIM_BLOCK_ALIASES, msc_read, msc_write, &msc);
+  msc.flash = sim_block_add("FLASH", FLASH_BASE, SIM_FLASH_SIZE,
+                            SIM_BLOCK_UNTRAPPED | SIM_BLOCK_READ_ONLY,
+                            NULL, NULL, &msc);
+  sim_block_clock(msc.msc, 1, _CMU_CLKEN1_MSC_SHIFT);
+  sim_event_init(&msc.done, operation_done, NULL);
+  sim_flash_clear();
+  MSC_REGS->MISCLOCKWORD = MSC_MISCLOCKWORD_MELOCKBIT;
+  status_update();
+}
@@ -0,0 +1,288 @@
+/*
+ *  TIMER model
+ *
+ *  The counter is computed from virtual time while the timer runs, from the
+ *  EM01GRPACLK divided by the CFG prescaler. Up and down counting are
+ *  modelled:
+ *
+ *  - the counter wraps at TOP, setting OF counting up and UF counting down,
+ *    and TOPB is loaded into TOP at the wrap when TOPBV is set
+ *  - compare channels in output compare or PWM mode set their CC flag when
+ *    the counter equals OC, and OCB is loaded into OC at the wrap
+ *  - the wrap and the compare matches pulse the UFOF and CC LDMA requests
+ *
+ *  Up/down counting, quadrature decoding, input capture and the dead time
+ *  insertion are not modelled.
+ */
+
+#include "sim.h"
+
+typedef struct {
+  sim_block_t *block;
+  IRQn_Type    irq;
+  uint32_t     source;          // LDMAXBAR SOURCESEL
+  uint32_t     signals[4];      // LDMAXBAR SIGSEL of CC0 to CC2 and UFOF
+  unsigned     clken_reg;
+  unsigned     clken_bit;
+  bool         running;
+  uint64_t     base_time;       // Virtual time of the tick the counter held base_cnt
+  uint32_t     base_cnt;
+  uint32_t     ocb_valid;       // CC channels with OCB written since the wrap
+  sim_event_t  event;
+} timer_model_t;
+
+static timer_model_t timers[TIMER_COUNT] = {
+  { .irq = TIMER0_IRQn, .source = LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER0,
+    .signals = { LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0CC0, LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0CC1,
+                 LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0CC2, LDMAXBAR_CH_REQSEL_SIGSEL_TIMER0UFOF },
+    .clken_reg = 0, .clken_bit = _CMU_CLKEN0_TIMER0_SHIFT },
+  { .irq = TIMER1_IRQn, .source = LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER1,
+    .signals = { LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1CC0, LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1CC1,
+                 LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1CC2, LDMAXBAR_CH_REQSEL_SIGSEL_TIMER1UFOF },
+    .clken_reg = 0, .clken_bit = _CMU_CLKEN0_TIMER1_SHIFT },
+  { .irq = TIMER2_IRQn, .source = LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER2,
+    .signals = { LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2CC0, LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2CC1,
+                 LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2CC2, LDMAXBAR_CH_REQSEL_SIGSEL_TIMER2UFOF },
+    .clken_reg = 0, .clken_bit = _CMU_CLKEN0_TIMER2_SHIFT },
+  { .irq = TIMER3_IRQn, .source = LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER3,
+    .signals = { LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3CC0, LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3CC1,
+                 LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3CC2, LDMAXBAR_CH_REQSEL_SIGSEL_TIMER3UFOF },
+    .clken_reg = 0, .clken_bit = _CMU_CLKEN0_TIMER3_SHIFT },
+  { .irq = TIMER4_IRQn, .source = LDMAXBAR_CH_REQSEL_SOURCESEL_TIMER4,
+    .signals = { LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4CC0, LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4CC1,
+                 LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4CC2, LDMAXBAR_CH_REQSEL_SIGSEL_TIMER4UFOF },
+    .clken_reg = 1, .clken_bit = _CMU_CLKEN1_TIMER4_SHIFT },
+};
+
+static const uintptr_t timer_bases[TIMER_COUNT] = {
+  TIMER0_BASE, TIMER1_BASE, TIMER2_BASE, TIMER3_BASE, TIMER4_BASE
+};
+
+static const char *const timer_names[TIMER_COUNT] = {
+  "TIMER0", "TIMER1", "TIMER2", "TIMER3", "TIMER4"
+};
+
+#define REGS(timer)  ((TIMER_TypeDef *)(timer)->block->regs)
+
+static bool counting_down(const timer_model_t *timer)
+{
+  return (REGS(timer)->CFG & _TIMER_CFG_MODE_MASK) == TIMER_CFG_MODE_DOWN;
+}
+
+/* EM01GRPACLK cycles per counter tick */
+static uint64_t tick_divider(const timer_model_t *timer)
+{
+  return ((REGS(timer)->CFG & _TIMER_CFG_PRESC_MASK) >> _TIMER_CFG_PRESC_SHIFT) + 1U;
+}
+
+static uint64_t ticks_since_base(const timer_model_t *timer)
+{
+  __uint128_t elapsed = sim_time() - timer->base_time;
+
+  return (uint64_t)(elapsed * sim_cmu_em01grpaclk()
+                    / ((__uint128_t)tick_divider(timer) * 1000000000U));
+}
+
+static uint64_t tick_time(const timer_model_t *timer, uint64_t ticks)
+{
+  __uint128_t scaled = (__uint128_t)ticks * tick_divider(timer) * 1000000000U;
+  uint32_t    freq   = sim_cmu_em01grpaclk();
+
+  if (freq == 0) {
+    sim_error("%s runs with its clock stopped", timer->block->name);
+  }
+  return timer->base_time + (uint64_t)((scaled + freq - 1U) / freq);
+}
+
+/* The counter as it stands, there is no wrap between the base and now */
+static uint32_t counter(const timer_model_t *timer)
+{
+  uint64_t ticks;
+
+  if (!timer->running) {
+    return REGS(timer)->CNT;
+  }
+  ticks = ticks_since_base(timer);
+  return counting_down(timer) ? timer->base_cnt - (uint32_t)ticks
+         : timer->base_cnt + (uint32_t)ticks;
+}
+
+static void rebase(timer_model_t *timer, uint32_t cnt)
+{
+  timer->base_time = sim_time();
+  timer->base_cnt  = cnt;
+}
+
+static bool compare_active(const timer_model_t *timer, unsigned cc)
+{
+  uint32_t mode = REGS(timer)->CC[cc].CFG & _TIMER_CC_CFG_MODE_MASK;
+
+  return (mode == TIMER_CC_CFG_MODE_OUTPUTCOMPARE) || (mode == TIMER_CC_CFG_MODE_PWM);
+}
+
+/* Schedules the next wrap or compare match after the current tick */
+static void schedule(timer_model_t *timer)
+{
+  uint32_t top = REGS(timer)->TOP;
+  uint64_t now = timer->running ? ticks_since_base(timer) : 0;
+  uint64_t next;
+
+  sim_event_cancel(&timer->event);
+  if (!timer->running) {
+    return;
+  }
+  next = counting_down(timer) ? (uint64_t)timer->base_cnt + 1U
+         : (uint64_t)top - timer->base_cnt + 1U;
+  for (unsigned cc = 0; cc < TIMER_CC_COUNT; cc++) {
+    uint32_t oc = REGS(timer)->CC[cc].OC;
+    uint64_t at;
+
+    if (!compare_active(timer, cc) || (oc > top)) {
+      continue;
+    }
+    at = counting_down(timer) ? (uint64_t)timer->base_cnt - oc
+         : (uint64_t)oc - timer->base_cnt;
+    if ((at > now) && (at < next) && (at <= (uint64_t)top + 1U)) {
+      next = at;
+    }
+  }
+  sim_event_schedule(&timer->event, tick_time(timer, next) - sim_time());
+}
+
+static void request_pulse(timer_model_t *timer, unsigned signal)
+{
+  sim_ldma_request(timer->source, timer->signals[signal], true);
+  sim_ldma_request(timer->source, timer->signals[signal], false);
+}
+
+static void irq_update(timer_model_t *timer)
+{
+  sim_irq_flags(timer->block, timer->irq, offsetof(TIMER_TypeDef, IF),
+                offsetof(TIMER_TypeDef, IEN));
+}
+
+static void timer_event(sim_event_t *event)
+{
+  timer_model_t *timer = event->arg;
+  TIMER_TypeDef *regs  = REGS(timer);
+  uint32_t       top   = regs->TOP;
+  uint64_t       ticks = ticks_since_base(timer);
+  bool           down  = counting_down(timer);
+  uint64_t       span  = down ? (uint64_t)timer->base_cnt + 1U
+                         : (uint64_t)top - timer->base_cnt + 1U;
+  uint32_t       cnt;
+
+  if (ticks >= span) {
+    // Wrap, with the buffered values loaded
+    if (regs->STATUS & TIMER_STATUS_TOPBV) {
+      regs->TOP     = regs->TOPB;
+      regs->STATUS &= ~TIMER_STATUS_TOPBV;
+    }
+    for (unsigned cc = 0; cc < TIMER_CC_COUNT; cc++) {
+      if (timer->ocb_valid & (1U << cc)) {
+        regs->CC[cc].OC = regs->CC[cc].OCB;
+      }
+    }
+    timer->ocb_valid = 0;
+    regs->IF |= down ? TIMER_IF_UF : TIMER_IF_OF;
+    timer->base_time = tick_time(timer, span);
+    timer->base_cnt  = down ? regs->TOP : 0;
+    request_pulse(timer, 3);
+  }
+  cnt = counter(timer);
+  for (unsigned cc = 0; cc < TIMER_CC_COUNT; cc++) {
+    if (compare_active(timer, cc) && (regs->CC[cc].OC == cnt)) {
+      regs->IF |= TIMER_IF_CC0 << cc;
+      request_pulse(timer, cc);
+    }
+  }
+  irq_update(timer);
+  schedule(timer);
+}
+
+static void timer_read(sim_block_t *block, uint32_t offset)
+{
+  timer_model_t *timer = block->model;
+
+  if (offset == offsetof(TIMER_TypeDef, CNT)) {
+    REGS(timer)->CNT = counter(timer);
+  }
+}
+
+static void timer_write(sim_block_t *block, uint32_t offset, uint32_t old,
+                        uint32_t value)
+{
+  timer_model_t *timer = block->model;
+  TIMER_TypeDef *regs  = REGS(timer);
+
+  switch (offset) {
+    case offsetof(TIMER_TypeDef, EN):
+      if (!(regs->EN & TIMER_EN_EN) && timer->running) {
+        regs->CNT      = counter(timer);
+        timer->running = false;
+        regs->STATUS  &= ~TIMER_STATUS_RUNNING;
+      }
+      break;
+
+    case offsetof(TIMER_TypeDef, CMD):
+      regs->CMD = 0;
+      if (!(regs->EN & TIMER_EN_EN)) {
+        sim_error("%s command written while disabled", block->name);
+      }
+      if ((regs->CFG & _TIMER_CFG_CLKSEL_MASK) != TIMER_CFG_CLKSEL_PRESCEM01GRPACLK) {
+        sim_error("%s: only the prescaled clock is modelled", block->name);
+      }
+      if (((regs->CFG & _TIMER_CFG_MODE_MASK) != TIMER_CFG_MODE_UP)
+          && !counting_down(timer)) {
+        sim_error("%s: only up and down counting are modelled", block->name);
+      }
+      if ((value & TIMER_CMD_START) && !timer->running) {
+        timer->running = true;
+        regs->STATUS  |= TIMER_STATUS_RUNNING;
+        rebase(timer, regs->CNT);
+      } else if ((value & TIMER_CMD_STOP) && timer->running) {
+        regs->CNT      = counter(timer);
+        timer->running = false;
+        regs->STATUS  &= ~TIMER_STATUS_RUNNING;
+      }
+      break;
+
+    case offsetof(TIMER_TypeDef, CNT):
+      if (timer->running) {
+        rebase(timer, regs->CNT);
+      }
+      break;
+
+    case offsetof(TIMER_TypeDef, TOPB):
+      regs->STATUS |= TIMER_STATUS_TOPBV;
+      break;
+
+    case offsetof(TIMER_TypeDef, STATUS):
+      regs->STATUS = old;
+      break;
+
+    default:
+      for (unsigned cc = 0; cc < TIMER_CC_COUNT; cc++) {
+        if (offset == offsetof(TIMER_TypeDef, CC[cc].OCB)) {
+          timer->ocb_valid |= 1U << cc;
+        }
+      }
+      break;
+  }
+  irq_update(timer);
+  schedule(timer);
+}
+
+void sim_timer_init(void)
+{
+  for (unsigned i = 0; i < TIMER_COUNT; i++) {
+    timer_model_t *timer = &timers[i];
+
+    timer->block = sim_block_add(timer_names[i], timer_bases[i],
+                                 sizeof(TIMER_TypeDef), SIM_BLOCK_ALIASES,
+                                 timer_read, timer_write, timer);
+    sim_block_clock(timer->block, timer->clken_reg, timer->clken_bit);
+    sim_event_init(&timer->event, timer_event, timer);
+    REGS(timer)->TOP = _TIMER_TOP_RESETVALUE;
+  }
+}
@@ -0,0 +1,367 @@
+/*
+ *  USART model
+ *
+ *  Frames take the time CLKDIV, CTRL OVS and FRAME give them at the PCLK
+ *  frequency, from the transmit buffer through the shift register:
+ *
+ *  - the transmit buffer holds two frames, TXBL is set while it is empty, or
+ *    while it has room with CTRL TXBIL HALFFULL, and TXC once the last frame
+ *    has left the shift register
+ *  - a frame goes to the USART connected with sim_usart_connect(), and to
+ *    this USART itself when CTRL LOOPBK is set. A synchronous master that
+ *    does not loop back receives all ones, the idle MISO line.
+ *  - the receive FIFO holds two frames, RXDATAV and RXFULL follow its level
+ *    and a frame arriving when it is full sets RXOF
+ *
+ *  The TXBL, RXDATAV and RXFULL interrupt flags follow the status, the others
+ *  stay set until cleared. TXBL and RXDATAV drive the LDMA requests. Parity,
+ *  framing errors, synchronous slaves, IrDA and I2S are not modelled.
+ */
+
+#include "sim.h"
+
+#define TX_BUFFER_SIZE  2U
+#define RX_FIFO_SIZE    2U
+
+#define RX_FLAGS        (USART_IF_RXDATAV | USART_IF_RXFULL | USART_IF_RXOF \
+                         | USART_IF_RXUF | USART_IF_PERR | USART_IF_FERR)
+#define LEVEL_FLAGS     (USART_IF_TXBL | USART_IF_RXDATAV | USART_IF_RXFULL)
+
+typedef struct usart_model {
+  sim_block_t        *block;
+  uintptr_t           base;
+  const char         *name;
+  IRQn_Type           rx_irq;
+  IRQn_Type           tx_irq;
+  uint32_t            source;       // LDMAXBAR SOURCESEL
+  uint32_t            rx_signal;    // LDMAXBAR SIGSEL of RXDATAV
+  uint32_t            tx_signal;    // LDMAXBAR SIGSEL of TXBL
+  unsigned            clken_bit;
+  uint16_t            tx_buffer[TX_BUFFER_SIZE];
+  unsigned            tx_count;
+  bool                shifting;
+  uint16_t            shift;
+  uint16_t            rx_fifo[RX_FIFO_SIZE];
+  unsigned            rx_count;
+  struct usart_model *peer;
+  uint32_t            frames_sent;
+  sim_event_t         frame_done;
+} usart_model_t;
+
+static usart_model_t usarts[USART_COUNT] = {
+  { .base = USART0_BASE, .name = "USART0", .rx_irq = USART0_RX_IRQn,
+    .tx_irq = USART0_TX_IRQn, .source = LDMAXBAR_CH_REQSEL_SOURCESEL_USART0,
+    .rx_signal = LDMAXBAR_CH_REQSEL_SIGSEL_USART0RXDATAV,
+    .tx_signal = LDMAXBAR_CH_REQSEL_SIGSEL_USART0TXBL,
+    .clken_bit = _CMU_CLKEN0_USART0_SHIFT },
+  { .base = USART1_BASE, .name = "USART1", .rx_irq = USART1_RX_IRQn,
+    .tx_irq = USART1_TX_IRQn, .source = LDMAXBAR_CH_REQSEL_SOURCESEL_USART1,
+    .rx_signal = LDMAXBAR_CH_REQSEL_SIGSEL_USART1RXDATAV,
+    .tx_signal = LDMAXBAR_CH_REQSEL_SIGSEL_USART1TXBL,
+    .clken_bit = _CMU_CLKEN0_USART1_SHIFT },
+};
+
+#define REGS(usart)  ((USART_TypeDef *)(usart)->block->regs)
+
+static usart_model_t *usart_model(const USART_TypeDef *usart)
+{
+  for (unsigned i = 0; i < USART_COUNT; i++) {
+    if (usarts[i].base == (uintptr_t)usart) {
+      return &usarts[i];
+    }
+  }
+  sim_error("no USART at %p", (const void *)usart);
+}
+
+static bool sync_mode(const usart_model_t *usart)
+{
+  return (REGS(usart)->CTRL & USART_CTRL_SYNC) != 0;
+}
+
+static uint32_t data_bits(const usart_model_t *usart)
+{
+  return ((REGS(usart)->FRAME & _USART_FRAME_DATABITS_MASK)
+          >> _USART_FRAME_DATABITS_SHIFT) + 3U;
+}
+
+/* Time one frame takes on the line */
+static uint64_t frame_ns(const usart_model_t *usart)
+{
+  static const uint32_t oversampling[4] = { 16, 8, 6, 4 };
+  USART_TypeDef        *regs   = REGS(usart);
+  uint32_t              clkdiv = regs->CLKDIV & _USART_CLKDIV_DIV_MASK;
+  uint32_t              freq   = sim_cmu_pclk();
+  uint32_t              ovs;
+  uint32_t              half_bits;
+  __uint128_t           scaled;
+
+  if (sync_mode(usart)) {
+    ovs       = 2;
+    half_bits = 2 * data_bits(usart);
+  } else {
+    ovs       = oversampling[(regs->CTRL & _USART_CTRL_OVS_MASK) >> _USART_CTRL_OVS_SHIFT];
+    half_bits = 2 * (1 + data_bits(usart))
+                + ((regs->FRAME & _USART_FRAME_PARITY_MASK) != USART_FRAME_PARITY_NONE ? 2 : 0)
+                + ((regs->FRAME & _USART_FRAME_STOPBITS_MASK) >> _USART_FRAME_STOPBITS_SHIFT) + 1;
+  }
+  if (freq == 0) {
+    sim_error("%s transmits with its clock stopped", usart->name);
+  }
+  // A bit lasts ovs * (256 + CLKDIV) / 256 clock cycles
+  scaled = (__uint128_t)half_bits * ovs * (256U + clkdiv) * 1000000000U;
+  return (uint64_t)((scaled + 512U * (uint64_t)freq - 1U) / (512U * (uint64_t)freq));
+}
+
+static void status_update(usart_model_t *usart)
+{
+  USART_TypeDef *regs   = REGS(usart);
+  uint32_t       status = regs->STATUS & ~(USART_STATUS_TXBL | USART_STATUS_RXDATAV
+                                           | USART_STATUS_RXFULL | USART_STATUS_TXIDLE);
+  uint32_t       level  = 0;
+  bool           txbl   = (usart->tx_count == 0)
+                          || ((regs->CTRL & USART_CTRL_TXBIL_HALFFULL)
+                              && (usart->tx_count < TX_BUFFER_SIZE));
+  uint32_t       flags;
+
+  if (txbl) {
+    level |= USART_IF_TXBL;
+    status |= USART_STATUS_TXBL;
+  }
+  if ((usart->tx_count == 0) && !usart->shifting) {
+    status |= USART_STATUS_TXIDLE;
+  }
+  if (usart->rx_count != 0) {
+    level  |= USART_IF_RXDATAV;
+    status |= USART_STATUS_RXDATAV;
+  }
+  if (usart->rx_count == RX_FIFO_SIZE) {
+    level  |= USART_IF_RXFULL;
+    status |= USART_STATUS_RXFULL;
+  }
+  regs->STATUS = status;
+  regs->IF     = (regs->IF & ~LEVEL_FLAGS) | level;
+
+  flags = regs->IF & regs->IEN;
+  sim_irq_line(usart->rx_irq, (flags & RX_FLAGS) != 0);
+  sim_irq_line(usart->tx_irq, (flags & ~RX_FLAGS) != 0);
+  sim_ldma_request(usart->source, usart->rx_signal, usart->rx_count != 0);
+  sim_ldma_request(usart->source, usart->tx_signal, txbl);
+}
+
+static void receive(usart_model_t *usart, uint16_t frame)
+{
+  if (!(REGS(usart)->STATUS & USART_STATUS_RXENS)) {
+    return;
+  }
+  if (usart->rx_count == RX_FIFO_SIZE) {
+    REGS(usart)->IF |= USART_IF_RXOF;
+  } else {
+    usart->rx_fifo[usart->rx_count++] = frame;
+  }
+  status_update(usart);
+}
+
+static void shift_start(usart_model_t *usart)
+{
+  USART_TypeDef *regs = REGS(usart);
+
+  if (usart->shifting || (usart->tx_count == 0)
+      || !(regs->STATUS & USART_STATUS_TXENS)
+      || (sync_mode(usart) && !(regs->STATUS & USART_STATUS_MASTER))) {
+    return;
+  }
+  usart->shift = usart->tx_buffer[0];
+  usart->tx_buffer[0] = usart->tx_buffer[1];
+  usart->tx_count--;
+  usart->shifting = true;
+  regs->STATUS   &= ~USART_STATUS_TXC;
+  sim_event_schedule(&usart->frame_done, frame_ns(usart));
+}
+
+static void frame_done(sim_event_t *event)
+{
+  usart_model_t *usart = event->arg;
+  USART_TypeDef *regs  = REGS(usart);
+  uint16_t       mask  = (uint16_t)((1U << data_bits(usart)) - 1U);
+  uint16_t       frame = usart->shift & mask;
+
+  usart->shifting = false;
+  usart->frames_sent++;
+  if (regs->CTRL & USART_CTRL_LOOPBK) {
+    receive(usart, frame);
+  } else if (sync_mode(usart)) {
+    receive(usart, mask);
+  }
+  if ((usart->peer != NULL) && (usart->peer != usart)) {
+    receive(usart->peer, frame);
+  }
+  shift_start(usart);
+  if (!usart->shifting) {
+    regs->STATUS |= USART_STATUS_TXC;
+    regs->IF     |= USART_IF_TXC;
+  }
+  status_update(usart);
+}
+
+static void transmit(usart_model_t *usart, uint16_t frame)
+{
+  if (usart->tx_count == TX_BUFFER_SIZE) {
+    REGS(usart)->IF |= USART_IF_TXOF;
+    return;
+  }
+  usart->tx_buffer[usart->tx_count++] = frame;
+  REGS(usart)->STATUS &= ~USART_STATUS_TXC;
+  shift_start(usart);
+}
+
+static uint16_t receive_pop(usart_model_t *usart)
+{
+  uint16_t frame;
+
+  if (usart->rx_count == 0) {
+    REGS(usart)->IF |= USART_IF_RXUF;
+    return 0;
+  }
+  frame = usart->rx_fifo[0];
+  usart->rx_fifo[0] = usart->rx_fifo[1];
+  usart->rx_count--;
+  return frame;
+}
+
+static void buffers_clear(usart_model_t *usart, bool tx, bool rx)
+{
+  if (tx) {
+    usart->tx_count = 0;
+  }
+  if (rx) {
+    usart->rx_count = 0;
+  }
+}
+
+static void usart_read(sim_block_t *block, uint32_t offset)
+{
+  usart_model_t *usart = block->model;
+  USART_TypeDef *regs  = REGS(usart);
+  uint32_t       low;
+
+  switch (offset) {
+    case offsetof(USART_TypeDef, RXDATA):
+    case offsetof(USART_TypeDef, RXDATAX):
+      block->regs[offset / 4] = receive_pop(usart);
+      break;
+
+    case offsetof(USART_TypeDef, RXDOUBLE):
+      low = receive_pop(usart) & 0xFFU;
+      regs->RXDOUBLE = low | ((uint32_t)(receive_pop(usart) & 0xFFU) << 8);
+      break;
+
+    case offsetof(USART_TypeDef, RXDOUBLEX):
+      low = receive_pop(usart) & 0x1FFU;
+      regs->RXDOUBLEX = low | ((uint32_t)(receive_pop(usart) & 0x1FFU) << 16);
+      break;
+
+    default:
+      return;
+  }
+  status_update(usart);
+}
+
+static void usart_write(sim_block_t *block, uint32_t offset, uint32_t old,
+                        uint32_t value)
+{
+  usart_model_t *usart = block->model;
+  USART_TypeDef *regs  = REGS(usart);
+
+  switch (offset) {
+    case offsetof(USART_TypeDef, EN):
+      if (!(regs->EN & USART_EN_EN)) {
+        sim_event_cancel(&usart->frame_done);
+        usart->shifting = false;
+        buffers_clear(usart, true, true);
+        regs->STATUS = 0;
+      }
+      break;
+
+    case offsetof(USART_TypeDef, CMD):
+      regs->CMD = 0;
+      if (value & (USART_CMD_CLEARTX | USART_CMD_CLEARRX)) {
+        buffers_clear(usart, value & USART_CMD_CLEARTX, value & USART_CMD_CLEARRX);
+      }
+      if (value & USART_CMD_RXDIS) {
+        regs->STATUS &= ~USART_STATUS_RXENS;
+      }
+      if (value & USART_CMD_RXEN) {
+        regs->STATUS |= USART_STATUS_RXENS;
+      }
+      if (value & USART_CMD_TXDIS) {
+        regs->STATUS &= ~USART_STATUS_TXENS;
+      }
+      if (value & USART_CMD_TXEN) {
+        regs->STATUS |= USART_STATUS_TXENS;
+      }
+      if (value & USART_CMD_MASTERDIS) {
+        regs->STATUS &= ~USART_STATUS_MASTER;
+      }
+      if (value & USART_CMD_MASTEREN) {
+        regs->STATUS |= USART_STATUS_MASTER;
+      }
+      shift_start(usart);
+      break;
+
+    case offsetof(USART_TypeDef, TXDATA):
+    case offsetof(USART_TypeDef, TXDATAX):
+      transmit(usart, (uint16_t)(value & 0x1FFU));
+      break;
+
+    case offsetof(USART_TypeDef, TXDOUBLE):
+      transmit(usart, (uint16_t)(value & 0xFFU));
+      transmit(usart, (uint16_t)((value >> 8) & 0xFFU));
+      break;
+
+    case offsetof(USART_TypeDef, TXDOUBLEX):
+      transmit(usart, (uint16_t)(value & 0x1FFU));
+      transmit(usart, (uint16_t)((value >> 16) & 0x1FFU));
+      break;
+
+    case offsetof(USART_TypeDef, IFC):
+      regs->IF &= ~value;
+      regs->IFC = 0;
+      break;
+
+    case offsetof(USART_TypeDef, IFS):
+      regs->IF |= value;
+      regs->IFS = 0;
+      break;
+
+    case offsetof(USART_TypeDef, STATUS):
+      regs->STATUS = old;
+      break;
+
+    default:
+      break;
+  }
+  status_update(usart);
+}
+
+void sim_usart_connect(USART_TypeDef *usart, USART_TypeDef *peer)
+{
+  usart_model(usart)->peer = (peer != NULL) ? usart_model(peer) : NULL;
+}
+
+uint32_t sim_usart_frames_sent(USART_TypeDef *usart)
+{
+  return usart_model(usart)->frames_sent;
+}
+
+void sim_usart_init(void)
+{
+  for (unsigned i = 0; i < USART_COUNT; i++) {
+    usart_model_t *usart = &usarts[i];
+
+    usart->block = sim_block_add(usart->name, usart->base, sizeof(USART_TypeDef),
+                                 SIM_BLOCK_ALIASES, usart_read, usart_write, usart);
+    sim_block_clock(usart->block, 0, usart->clken_bit);
+    sim_event_init(&usart->frame_done, frame_done, usart);
+    REGS(usart)->FRAME = _USART_FRAME_RESETVALUE;
+  }
+}
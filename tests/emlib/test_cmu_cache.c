@@ -0,0 +1,276 @@
+/*
+ *  Test of the CMU clock frequency cache, built with CMU_CLOCK_FREQ_CACHE
+ *
+ *  Checks that cached frequencies cost no register access, that the clock
+ *  setters and CMU_ClockFreqCacheRefresh() update them and report the
+ *  changes to the subscribers, that the cache replaces entries when full,
+ *  and that a frequency computed while an interrupt changes the clock tree
+ *  is not cached.
+ */
+
+#include <stdio.h>
+
+#include "check.h"
+#include "sim.h"
+#include "em_cmu.h"
+
+#define MAX_CHANGES         16
+
+typedef struct {
+  CMU_Clock_TypeDef clock;
+  uint32_t          freq;
+} change_t;
+
+static change_t changes[MAX_CHANGES];
+static unsigned change_count;
+
+static sim_event_t    irq_event;
+static uint32_t       irq_pclk_div = 1;
+
+/* Clock points the model computes, more than the cache holds so that
+   reading them in turn evicts any other entry */
+static const CMU_Clock_TypeDef fillers[CMU_CLOCK_FREQ_CACHE_SIZE + 1] = {
+  cmuClock_SYSCLK, cmuClock_HCLK, cmuClock_LSPCLK, cmuClock_EM01GRPACLK,
+  cmuClock_IADCCLK, cmuClock_EUART0CLK, cmuClock_TIMER0, cmuClock_TIMER1,
+  cmuClock_TIMER2, cmuClock_TIMER3, cmuClock_USART0, cmuClock_USART1,
+  cmuClock_IADC0, cmuClock_I2C0, cmuClock_I2C1, cmuClock_LDMA,
+  cmuClock_GPIO
+};
+
+static void record_change(CMU_Clock_TypeDef clock, uint32_t freq)
+{
+  if (change_count < MAX_CHANGES) {
+    changes[change_count].clock = clock;
+    changes[change_count].freq  = freq;
+  }
+  change_count++;
+}
+
+static void ignore_change(CMU_Clock_TypeDef clock, uint32_t freq)
+{
+}
+
+static void ignore_change2(CMU_Clock_TypeDef clock, uint32_t freq)
+{
+}
+
+static void ignore_change3(CMU_Clock_TypeDef clock, uint32_t freq)
+{
+}
+
+static void ignore_change4(CMU_Clock_TypeDef clock, uint32_t freq)
+{
+}
+
+/* Last frequency reported for a clock point since the changes were cleared,
+   0 if none. Setters going through intermediate clock trees report each. */
+static uint32_t changed(CMU_Clock_TypeDef clock)
+{
+  uint32_t freq = 0;
+
+  CHECK(change_count <= MAX_CHANGES);
+  for (unsigned i = 0; i < change_count && i < MAX_CHANGES; i++) {
+    if (changes[i].clock == clock) {
+      freq = changes[i].freq;
+    }
+  }
+  return freq;
+}
+
+static uint32_t reads_of(CMU_Clock_TypeDef clock, uint32_t *freq)
+{
+  sim_stats_t stats;
+
+  sim_stats_clear();
+  *freq = CMU_ClockFreqGet(clock);
+  sim_stats_get(&stats);
+  return stats.reads;
+}
+
+/* Changes PCLK while the main program may be computing a frequency */
+void GPIO_ODD_IRQHandler(void)
+{
+  sim_irq_line(GPIO_ODD_IRQn, false);
+  irq_pclk_div = 3 - irq_pclk_div;
+  CMU_ClockDivSet(cmuClock_PCLK, irq_pclk_div);
+}
+
+static void raise_irq(sim_event_t *event)
+{
+  sim_irq_line(GPIO_ODD_IRQn, true);
+}
+
+static void test_hits(void)
+{
+  uint32_t freq;
+  uint32_t again;
+
+  CHECK(reads_of(cmuClock_HCLK, &freq) > 0);
+  CHECK(freq == sim_cmu_hclk());
+  CHECK(reads_of(cmuClock_HCLK, &again) == 0);
+  CHECK(again == freq);
+  CHECK(reads_of(cmuClock_PCLK, &freq) > 0);
+  CHECK(freq == sim_cmu_pclk());
+  CHECK(reads_of(cmuClock_PCLK, &again) == 0);
+  CHECK(again == freq);
+}
+
+static void test_setters(void)
+{
+  CHECK(CMU_ClockChangeSubscribe(record_change));
+  CMU_ClockFreqGet(cmuClock_SYSCLK);
+  CMU_ClockFreqGet(cmuClock_HCLK);
+  CMU_ClockFreqGet(cmuClock_PCLK);
+
+  change_count = 0;
+  CMU_ClockDivSet(cmuClock_PCLK, 2);
+  CHECK(sim_cmu_pclk() == sim_cmu_hclk() / 2);
+  CHECK(changed(cmuClock_PCLK) == sim_cmu_pclk());
+  CHECK(changed(cmuClock_HCLK) == 0);
+  CHECK(CMU_ClockFreqGet(cmuClock_PCLK) == sim_cmu_pclk());
+
+  // The band change also sets the PCLK divider back to 1
+  change_count = 0;
+  CMU_HFRCODPLLBandSet(cmuHFRCODPLLFreq_19M0Hz);
+  CHECK(sim_cmu_hclk() == 19000000);
+  CHECK(changed(cmuClock_SYSCLK) == 19000000);
+  CHECK(changed(cmuClock_HCLK) == 19000000);
+  CHECK(changed(cmuClock_PCLK) == sim_cmu_pclk());
+  CHECK(CMU_ClockFreqGet(cmuClock_HCLK) == 19000000);
+  CHECK(CMU_ClockFreqGet(cmuClock_PCLK) == sim_cmu_pclk());
+
+  CMU_ClockChangeUnsubscribe(record_change);
+  change_count = 0;
+  CMU_HFRCODPLLBandSet(cmuHFRCODPLLFreq_38M0Hz);
+  CMU_ClockDivSet(cmuClock_PCLK, 1);
+  CHECK(change_count == 0);
+  CHECK(CMU_ClockFreqGet(cmuClock_PCLK) == 38000000);
+}
+
+/* Register writes bypassing the setters need an explicit refresh */
+static void test_refresh(void)
+{
+  CHECK(CMU_ClockChangeSubscribe(record_change));
+  CMU_ClockFreqGet(cmuClock_PCLK);
+
+  change_count = 0;
+  CMU->SYSCLKCTRL = (CMU->SYSCLKCTRL & ~_CMU_SYSCLKCTRL_PCLKPRESC_MASK)
+                    | CMU_SYSCLKCTRL_PCLKPRESC_DIV2;
+  CHECK(CMU_ClockFreqGet(cmuClock_PCLK) == 38000000);
+  CMU_ClockFreqCacheRefresh();
+  CHECK(CMU_ClockFreqGet(cmuClock_PCLK) == 19000000);
+  CHECK(changed(cmuClock_PCLK) == 19000000);
+
+  CMU_ClockDivSet(cmuClock_PCLK, 1);
+  CMU_ClockChangeUnsubscribe(record_change);
+}
+
+static void test_subscribers(void)
+{
+  CHECK(CMU_CLOCK_CHANGE_SUBSCRIBERS_MAX == 4);
+  CHECK(CMU_ClockChangeSubscribe(record_change));
+  CHECK(CMU_ClockChangeSubscribe(ignore_change));
+  CHECK(CMU_ClockChangeSubscribe(ignore_change2));
+  CHECK(CMU_ClockChangeSubscribe(ignore_change3));
+  CHECK(!CMU_ClockChangeSubscribe(ignore_change4));
+  // Already registered callbacks take no slot
+  CHECK(CMU_ClockChangeSubscribe(record_change));
+
+  // record_change is called once per change
+  CMU_ClockFreqGet(cmuClock_PCLK);
+  change_count = 0;
+  CMU_ClockDivSet(cmuClock_PCLK, 2);
+  CHECK(change_count == 1);
+  CHECK(changed(cmuClock_PCLK) == 19000000);
+
+  CMU_ClockChangeUnsubscribe(ignore_change2);
+  CHECK(CMU_ClockChangeSubscribe(ignore_change4));
+
+  CMU_ClockChangeUnsubscribe(record_change);
+  CMU_ClockChangeUnsubscribe(ignore_change);
+  CMU_ClockChangeUnsubscribe(ignore_change3);
+  CMU_ClockChangeUnsubscribe(ignore_change4);
+  change_count = 0;
+  CMU_ClockDivSet(cmuClock_PCLK, 1);
+  CHECK(change_count == 0);
+}
+
+static void test_replacement(void)
+{
+  uint32_t freq;
+
+  CMU_ClockFreqGet(cmuClock_PCLK);
+  CHECK(reads_of(cmuClock_PCLK, &freq) == 0);
+  for (unsigned i = 0; i < CMU_CLOCK_FREQ_CACHE_SIZE + 1; i++) {
+    CMU_ClockFreqGet(fillers[i]);
+  }
+  CHECK(reads_of(cmuClock_PCLK, &freq) > 0);
+  CHECK(freq == sim_cmu_pclk());
+  for (unsigned i = 0; i < CMU_CLOCK_FREQ_CACHE_SIZE + 1; i++) {
+    CHECK(CMU_ClockFreqGet(fillers[i]) != 0);
+  }
+}
+
+/* Lets an interrupt change PCLK after each register access in turn of a
+   PCLK frequency computation. Whatever the computation returns, the cache
+   must hold the frequency of the new clock tree afterwards. */
+static void test_interrupted_compute(void)
+{
+  unsigned landed = 0;
+  unsigned stale  = 0;
+
+  // The computation reads CMU registers that do not change, which must not
+  // skip time to the interrupt
+  sim_poll_skip_set(false);
+  sim_event_init(&irq_event, raise_irq, NULL);
+  NVIC_ClearPendingIRQ(GPIO_ODD_IRQn);
+  NVIC_EnableIRQ(GPIO_ODD_IRQn);
+
+  for (unsigned access = 0; access < 64; access++) {
+    uint32_t irqs;
+    uint32_t freq;
+
+    // Evict PCLK
+    for (unsigned i = 0; i < CMU_CLOCK_FREQ_CACHE_SIZE + 1; i++) {
+      CMU_ClockFreqGet(fillers[i]);
+    }
+
+    irqs = sim_irq_count(GPIO_ODD_IRQn);
+    sim_event_schedule(&irq_event, (uint64_t)access * SIM_ACCESS_NS);
+    freq = CMU_ClockFreqGet(cmuClock_PCLK);
+    if (sim_irq_count(GPIO_ODD_IRQn) == irqs) {
+      // The computation ended before the interrupt
+      sim_event_cancel(&irq_event);
+      sim_irq_line(GPIO_ODD_IRQn, false);
+      break;
+    }
+    landed++;
+    if (freq != sim_cmu_pclk()) {
+      stale++;
+    }
+    CHECK(CMU_ClockFreqGet(cmuClock_PCLK) == sim_cmu_pclk());
+  }
+  NVIC_DisableIRQ(GPIO_ODD_IRQn);
+  sim_poll_skip_set(true);
+
+  // Some interrupts came in the middle of the computation
+  CHECK(landed > 1);
+  CHECK(stale > 0);
+  CMU_ClockDivSet(cmuClock_PCLK, 1);
+}
+
+int main(void)
+{
+  sim_init();
+  CMU_HFRCODPLLBandSet(cmuHFRCODPLLFreq_38M0Hz);
+  CMU_ClockSelectSet(cmuClock_SYSCLK, cmuSelect_HFRCODPLL);
+
+  test_hits();
+  test_setters();
+  test_refresh();
+  test_subscribers();
+  test_replacement();
+  test_interrupted_compute();
+
+  return check_report();
+}
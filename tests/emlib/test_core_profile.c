@@ -0,0 +1,192 @@
+/*
+ *  Test of the interrupt masking profiler of em_core, built with
+ *  CORE_PROFILE
+ *
+ *  CORE_PROFILE_TIMESTAMP() reads fake_clock, which only the test advances,
+ *  so every interval has a known length. Checks that nested CRITICAL
+ *  sections count once, that CORE_YieldCritical() and CORE_YieldNvicMask()
+ *  end the open interval before the pending interrupt runs and start another
+ *  one afterwards, and that NVIC mask sections are recorded apart from
+ *  PRIMASK and BASEPRI masking.
+ */
+
+#include <stdio.h>
+
+#include "check.h"
+#include "sim.h"
+#include "em_core.h"
+
+// Cycles the interrupt handler takes, which no interval may include
+#define HANDLER_CYCLES      1000U
+#define YIELD_IRQ           GPIO_ODD_IRQn
+
+volatile uint32_t fake_clock;
+
+void GPIO_ODD_IRQHandler(void)
+{
+  sim_irq_line(YIELD_IRQ, false);
+  fake_clock += HANDLER_CYCLES;
+}
+
+/* Number of sites of the kind given, and of those with one interval of
+   cycles */
+static uint32_t sites_of(bool nvic, uint32_t cycles, uint32_t *matching)
+{
+  CORE_profileSite_t sites[CORE_PROFILE_SITES];
+  uint32_t           count = CORE_ProfileGetSites(sites, CORE_PROFILE_SITES);
+  uint32_t           found = 0;
+
+  *matching = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    if (sites[i].nvic == nvic) {
+      found++;
+      if ((sites[i].count == 1) && (sites[i].maxCycles == cycles)) {
+        (*matching)++;
+      }
+    }
+  }
+  return found;
+}
+
+static void test_critical(void)
+{
+  CORE_profile_t  profile;
+  CORE_irqState_t outer;
+  CORE_irqState_t inner;
+  uint32_t        matching;
+
+  CORE_ProfileReset();
+  outer = CORE_EnterCritical();
+  fake_clock += 100;
+  inner = CORE_EnterCritical();
+  fake_clock += 50;
+  CORE_ExitCritical(inner);
+  fake_clock += 10;
+  CORE_ExitCritical(outer);
+
+  CORE_ProfileGet(&profile);
+  CHECK(profile.intervals == 1);
+  CHECK(profile.maxCycles == 160);
+  CHECK(profile.maxSite != NULL);
+  CHECK(profile.dropped == 0);
+  // 160 is in the bin of 128 to 255
+  CHECK(profile.histogram[8] == 1);
+  CHECK(sites_of(false, 160, &matching) == 1);
+  CHECK(matching == 1);
+  CHECK(sites_of(true, 0, &matching) == 0);
+}
+
+static void test_atomic(void)
+{
+  CORE_profile_t  profile;
+  CORE_irqState_t state;
+  uint32_t        matching;
+
+  CORE_ProfileReset();
+  state = CORE_EnterAtomic();
+  fake_clock += 70;
+  CORE_ExitAtomic(state);
+  CORE_ProfileGet(&profile);
+  CHECK(profile.intervals == 1);
+  CHECK(profile.maxCycles == 70);
+  CHECK(sites_of(false, 70, &matching) == 1);
+  CHECK(matching == 1);
+}
+
+static void test_yield_critical(void)
+{
+  CORE_profile_t  profile;
+  CORE_irqState_t state;
+  uint32_t        irqs = sim_irq_count(YIELD_IRQ);
+  uint32_t        matching;
+
+  NVIC_EnableIRQ(YIELD_IRQ);
+  CORE_ProfileReset();
+  state = CORE_EnterCritical();
+  sim_irq_line(YIELD_IRQ, true);
+  fake_clock += 30;
+  CORE_YieldCritical();
+  CHECK(sim_irq_count(YIELD_IRQ) == irqs + 1);
+  fake_clock += 40;
+  CORE_ExitCritical(state);
+  NVIC_DisableIRQ(YIELD_IRQ);
+
+  // The section before the yield, then the one after it, each at its site
+  CORE_ProfileGet(&profile);
+  CHECK(profile.intervals == 2);
+  CHECK(profile.maxCycles == 40);
+  CHECK(sites_of(false, 30, &matching) == 2);
+  CHECK(matching == 1);
+  CHECK(sites_of(false, 40, &matching) == 2);
+  CHECK(matching == 1);
+}
+
+static void test_nvic(void)
+{
+  CORE_DECLARE_NVIC_ZEROMASK(mask);
+  CORE_nvicMask_t nvicState;
+  uint32_t        irqs = sim_irq_count(YIELD_IRQ);
+  uint32_t        matching;
+
+  CORE_NvicMaskSetIRQ(YIELD_IRQ, &mask);
+  NVIC_EnableIRQ(YIELD_IRQ);
+
+  // A section left whole
+  CORE_ProfileReset();
+  CORE_EnterNvicMask(&nvicState, &mask);
+  fake_clock += 200;
+  CORE_NvicEnableMask(&nvicState);
+  CHECK(sites_of(true, 200, &matching) == 1);
+  CHECK(matching == 1);
+
+  // A yield letting the pending interrupt run splits the section
+  CORE_ProfileReset();
+  CORE_EnterNvicMask(&nvicState, &mask);
+  sim_irq_line(YIELD_IRQ, true);
+  fake_clock += 100;
+  CORE_YieldNvicMask(&nvicState);
+  CHECK(sim_irq_count(YIELD_IRQ) == irqs + 1);
+  CHECK(NVIC_GetEnableIRQ(YIELD_IRQ) == 0);
+  fake_clock += 50;
+  CORE_NvicEnableMask(&nvicState);
+  CHECK(NVIC_GetEnableIRQ(YIELD_IRQ) == 1);
+  CHECK(sites_of(true, 100, &matching) == 2);
+  CHECK(matching == 1);
+  CHECK(sites_of(true, 50, &matching) == 2);
+  CHECK(matching == 1);
+
+  // A yield with another mask than the state of the section leaves it open
+  CORE_ProfileReset();
+  CORE_EnterNvicMask(&nvicState, &mask);
+  sim_irq_line(YIELD_IRQ, true);
+  fake_clock += 100;
+  CORE_YieldNvicMask(&mask);
+  CHECK(sim_irq_count(YIELD_IRQ) == irqs + 2);
+  fake_clock += 50;
+  CORE_NvicEnableMask(&nvicState);
+  CHECK(sites_of(true, 150 + HANDLER_CYCLES, &matching) == 1);
+  CHECK(matching == 1);
+
+  // Nothing to enable, the yield leaves the section open
+  NVIC_DisableIRQ(YIELD_IRQ);
+  CORE_ProfileReset();
+  CORE_EnterNvicMask(&nvicState, &mask);
+  fake_clock += 100;
+  CORE_YieldNvicMask(&nvicState);
+  fake_clock += 50;
+  CORE_NvicEnableMask(&nvicState);
+  CHECK(sites_of(true, 150, &matching) == 1);
+  CHECK(matching == 1);
+}
+
+int main(void)
+{
+  sim_init();
+
+  test_critical();
+  test_atomic();
+  test_yield_critical();
+  test_nvic();
+
+  return check_report();
+}
@@ -0,0 +1,347 @@
+/*
+ *  Functional test of emlib against the register level device model
+ *
+ *  Each test drives one peripheral through the emlib API the way an
+ *  application would, then checks what the model saw and what emlib
+ *  reports.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "check.h"
+#include "sim.h"
+#include "em_cmu.h"
+#include "em_core.h"
+#include "em_crypto.h"
+#include "em_eusart.h"
+#include "em_i2c.h"
+#include "em_iadc.h"
+#include "em_ldma.h"
+#include "em_msc.h"
+#include "em_timer.h"
+#include "em_usart.h"
+
+#define EEPROM_ADDRESS      0x50
+#define FLASH_TEST_PAGE     ((uint32_t *)(FLASH_BASE + 16 * FLASH_PAGE_SIZE))
+
+static volatile uint32_t timer_overflows;
+static volatile uint32_t ldma_done;
+
+/* LDMA buffers and descriptors need addresses below 4 GB */
+static uint32_t          dma_source[64];
+static uint32_t          dma_destination[64];
+static LDMA_Descriptor_t dma_descriptor;
+
+void TIMER0_IRQHandler(void)
+{
+  uint32_t flags = TIMER_IntGet(TIMER0);
+
+  TIMER_IntClear(TIMER0, flags);
+  if (flags & TIMER_IF_OF) {
+    timer_overflows++;
+  }
+}
+
+void LDMA_IRQHandler(void)
+{
+  uint32_t pending = LDMA_IntGetEnabled();
+
+  LDMA_IntClear(pending);
+  ldma_done |= pending;
+}
+
+static bool near(uint32_t value, uint32_t expected, uint32_t tolerance)
+{
+  return (value + tolerance >= expected) && (value <= expected + tolerance);
+}
+
+static void test_cmu(void)
+{
+  CHECK(CMU_ClockFreqGet(cmuClock_SYSCLK) == EFR32_FSRCO_FREQ);
+
+  CMU_HFRCODPLLBandSet(cmuHFRCODPLLFreq_38M0Hz);
+  CMU_ClockSelectSet(cmuClock_SYSCLK, cmuSelect_HFRCODPLL);
+  CHECK(CMU_ClockSelectGet(cmuClock_SYSCLK) == cmuSelect_HFRCODPLL);
+  CHECK(CMU_ClockFreqGet(cmuClock_SYSCLK) == 38000000);
+  CHECK(CMU_ClockFreqGet(cmuClock_HCLK) == sim_cmu_hclk());
+  CHECK(CMU_ClockFreqGet(cmuClock_PCLK) == sim_cmu_pclk());
+  CHECK(SystemCoreClock == 38000000);
+
+  CMU_ClockDivSet(cmuClock_PCLK, 2);
+  CHECK(sim_cmu_pclk() == 19000000);
+  CHECK(CMU_ClockFreqGet(cmuClock_PCLK) == 19000000);
+  CMU_ClockDivSet(cmuClock_PCLK, 1);
+  CHECK(CMU_ClockFreqGet(cmuClock_PCLK) == 38000000);
+}
+
+static void test_usart(void)
+{
+  USART_InitAsync_TypeDef init = USART_INITASYNC_DEFAULT;
+  uint32_t                frames;
+  bool                    echoed = true;
+
+  CMU_ClockEnable(cmuClock_USART0, true);
+  init.enable = usartDisable;
+  USART_InitAsync(USART0, &init);
+  CHECK(near(USART_BaudrateGet(USART0), 115200, 115200 / 100));
+
+  USART0->CTRL_SET = USART_CTRL_LOOPBK;
+  USART_Enable(USART0, usartEnable);
+  frames = sim_usart_frames_sent(USART0);
+  for (unsigned i = 0; i < 32; i++) {
+    USART_Tx(USART0, (uint8_t)(0xA0 + i));
+    echoed &= USART_Rx(USART0) == (uint8_t)(0xA0 + i);
+  }
+  CHECK(echoed);
+  CHECK(sim_usart_frames_sent(USART0) - frames == 32);
+  CHECK(!(USART_IntGet(USART0) & USART_IF_RXOF));
+
+  USART_Reset(USART0);
+  CMU_ClockEnable(cmuClock_USART0, false);
+}
+
+static void test_eusart(void)
+{
+  EUSART_UartInit_TypeDef init = EUSART_UART_INIT_DEFAULT_HF;
+  uint32_t                frames;
+  bool                    echoed = true;
+
+  CMU_ClockEnable(cmuClock_EUART0, true);
+  init.loopbackEnable = eusartLoopbackEnable;
+  EUSART_UartInitHf(EUART0, &init);
+  CHECK(near(EUSART_BaudrateGet(EUART0), 115200, 115200 / 100));
+
+  frames = sim_eusart_frames_sent(EUART0);
+  for (unsigned i = 0; i < 16; i++) {
+    EUSART_Tx(EUART0, (uint8_t)(0x30 + i));
+    echoed &= EUSART_Rx(EUART0) == (uint8_t)(0x30 + i);
+  }
+  CHECK(echoed);
+  CHECK(sim_eusart_frames_sent(EUART0) - frames == 16);
+
+  EUSART_Reset(EUART0);
+  CMU_ClockEnable(cmuClock_EUART0, false);
+}
+
+static void test_timer(void)
+{
+  TIMER_Init_TypeDef init = TIMER_INIT_DEFAULT;
+  uint32_t           freq;
+  uint64_t           start;
+  uint64_t           elapsed;
+  uint64_t           expected;
+
+  CMU_ClockEnable(cmuClock_TIMER0, true);
+  freq          = CMU_ClockFreqGet(cmuClock_TIMER0);
+  init.prescale = timerPrescale64;
+  init.enable   = false;
+  TIMER_Init(TIMER0, &init);
+  TIMER_TopSet(TIMER0, 999);
+  TIMER_IntClear(TIMER0, _TIMER_IF_MASK);
+  TIMER_IntEnable(TIMER0, TIMER_IEN_OF);
+  NVIC_ClearPendingIRQ(TIMER0_IRQn);
+  NVIC_EnableIRQ(TIMER0_IRQn);
+
+  timer_overflows = 0;
+  start           = sim_time();
+  TIMER_Enable(TIMER0, true);
+  while (timer_overflows < 10) {
+    __WFI();
+  }
+  elapsed  = sim_time() - start;
+  expected = 10ULL * 1000 * 64 * 1000000000ULL / freq;
+  CHECK(elapsed >= expected);
+  CHECK(elapsed < expected + expected / 100);
+  CHECK(TIMER_CounterGet(TIMER0) <= 999);
+  CHECK(sim_irq_count(TIMER0_IRQn) >= 10);
+
+  TIMER_Enable(TIMER0, false);
+  NVIC_DisableIRQ(TIMER0_IRQn);
+  TIMER_Reset(TIMER0);
+  CMU_ClockEnable(cmuClock_TIMER0, false);
+}
+
+static void test_ldma(void)
+{
+  LDMA_Init_t        init = LDMA_INIT_DEFAULT;
+  LDMA_TransferCfg_t cfg  = LDMA_TRANSFER_CFG_MEMORY();
+
+  for (unsigned i = 0; i < 64; i++) {
+    dma_source[i]      = 0x01010101U * i;
+    dma_destination[i] = 0;
+  }
+  dma_descriptor = (LDMA_Descriptor_t)LDMA_DESCRIPTOR_SINGLE_M2M_WORD(dma_source, dma_destination, 64);
+
+  ldma_done = 0;
+  LDMA_Init(&init);
+  LDMA_StartTransfer(0, &cfg, &dma_descriptor);
+  while (!LDMA_TransferDone(0)) {
+  }
+  CHECK(memcmp(dma_source, dma_destination, sizeof(dma_source)) == 0);
+  CHECK(LDMA_TransferRemainingCount(0) == 0);
+  CHECK(ldma_done == 1);
+  LDMA_DeInit();
+}
+
+static void test_msc(void)
+{
+  static const uint32_t words[4] = { 0x12345678, 0x9ABCDEF0, 0xFFFF0000, 0x0F0F0F0F };
+  sim_flash_stats_t     stats;
+  sim_stats_t           accesses;
+  uint32_t              erases;
+
+  MSC_Init();
+  sim_flash_stats_get(&stats);
+  erases = stats.page_erases;
+
+  // The 20 ms the erase takes are skipped, not polled through
+  sim_stats_clear();
+  CHECK(MSC_ErasePage(FLASH_TEST_PAGE) == mscReturnOk);
+  sim_stats_get(&accesses);
+  CHECK(accesses.reads < 50);
+  CHECK(MSC_WriteWord(FLASH_TEST_PAGE, words, sizeof(words)) == mscReturnOk);
+  CHECK(memcmp(FLASH_TEST_PAGE, words, sizeof(words)) == 0);
+  CHECK(FLASH_TEST_PAGE[4] == 0xFFFFFFFF);
+
+  // Programming only clears bits
+  CHECK(MSC_WriteWord(FLASH_TEST_PAGE, &words[1], 4) == mscReturnOk);
+  CHECK(FLASH_TEST_PAGE[0] == (words[0] & words[1]));
+
+  CHECK(MSC_ErasePage(FLASH_TEST_PAGE) == mscReturnOk);
+  CHECK(FLASH_TEST_PAGE[0] == 0xFFFFFFFF);
+  CHECK(MSC_WriteWord((uint32_t *)(FLASH_BASE + FLASH_SIZE), words, 4) == mscReturnInvalidAddr);
+
+  sim_flash_stats_get(&stats);
+  CHECK(stats.page_erases - erases == 2);
+  MSC_Deinit();
+}
+
+static void test_iadc(void)
+{
+  IADC_Init_t        init    = IADC_INIT_DEFAULT;
+  IADC_AllConfigs_t  configs = IADC_ALLCONFIGS_DEFAULT;
+  IADC_InitSingle_t  single  = IADC_INITSINGLE_DEFAULT;
+  IADC_SingleInput_t input   = IADC_SINGLEINPUT_DEFAULT;
+  IADC_Result_t      result;
+
+  CMU_ClockEnable(cmuClock_IADC0, true);
+  CMU_ClockSelectSet(cmuClock_IADCCLK, cmuSelect_FSRCO);
+
+  init.srcClkPrescale             = IADC_calcSrcClkPrescale(IADC0, 10000000, 0);
+  configs.configs[0].reference    = iadcCfgReferenceVddx;
+  configs.configs[0].vRef         = 3300;
+  configs.configs[0].adcClkPrescale =
+    IADC_calcAdcClkPrescale(IADC0, 1000000, 0, iadcCfgModeNormal, init.srcClkPrescale);
+  input.posInput = iadcPosInputPortBPin0;
+  input.negInput = iadcNegInputGnd;
+  IADC_init(IADC0, &init, &configs);
+  IADC_initSingle(IADC0, &single, &input);
+
+  sim_iadc_input_set(iadcPosInputPortBPin0, 1650);
+  IADC_command(IADC0, iadcCmdStartSingle);
+  while (!(IADC_getStatus(IADC0) & IADC_STATUS_SINGLEFIFODV)) {
+  }
+  result = IADC_pullSingleFifoResult(IADC0);
+  CHECK(near(result.data, 2048, 2));
+  CHECK(IADC_getSingleFifoCnt(IADC0) == 0);
+
+  sim_iadc_input_set(iadcPosInputPortBPin0, 3300);
+  IADC_command(IADC0, iadcCmdStartSingle);
+  while (!(IADC_getStatus(IADC0) & IADC_STATUS_SINGLEFIFODV)) {
+  }
+  CHECK(IADC_pullSingleFifoResult(IADC0).data == 4095);
+
+  IADC_reset(IADC0);
+  CMU_ClockEnable(cmuClock_IADC0, false);
+}
+
+static I2C_TransferReturn_TypeDef i2c_run(I2C_TransferSeq_TypeDef *seq)
+{
+  I2C_TransferReturn_TypeDef ret = I2C_TransferInit(I2C0, seq);
+
+  while (ret == i2cTransferInProgress) {
+    ret = I2C_Transfer(I2C0);
+  }
+  return ret;
+}
+
+static void test_i2c(void)
+{
+  static sim_eeprom_t     eeprom;
+  I2C_Init_TypeDef        init = I2C_INIT_DEFAULT;
+  I2C_TransferSeq_TypeDef seq;
+  uint8_t                 write[9] = { 0x10, 1, 2, 3, 4, 5, 6, 7, 8 };
+  uint8_t                 pointer  = 0x12;
+  uint8_t                 read[6];
+
+  sim_eeprom_init(&eeprom, EEPROM_ADDRESS);
+  sim_i2c_attach(I2C0, &eeprom.slave);
+  CMU_ClockEnable(cmuClock_I2C0, true);
+  I2C_Init(I2C0, &init);
+
+  seq.addr        = EEPROM_ADDRESS << 1;
+  seq.flags       = I2C_FLAG_WRITE;
+  seq.buf[0].data = write;
+  seq.buf[0].len  = sizeof(write);
+  CHECK(i2c_run(&seq) == i2cTransferDone);
+  CHECK(memcmp(&eeprom.memory[0x10], &write[1], 8) == 0);
+
+  seq.flags       = I2C_FLAG_WRITE_READ;
+  seq.buf[0].data = &pointer;
+  seq.buf[0].len  = 1;
+  seq.buf[1].data = read;
+  seq.buf[1].len  = sizeof(read);
+  CHECK(i2c_run(&seq) == i2cTransferDone);
+  CHECK(memcmp(read, &write[3], sizeof(read)) == 0);
+
+  // Nothing answers at the next address
+  seq.addr = (EEPROM_ADDRESS + 1) << 1;
+  CHECK(i2c_run(&seq) == i2cTransferAddrNack);
+
+  I2C_Reset(I2C0);
+  sim_i2c_detach(I2C0, &eeprom.slave);
+  CMU_ClockEnable(cmuClock_I2C0, false);
+}
+
+static void test_crypto(void)
+{
+  static const uint8_t abc_sha256[32] = {
+    0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde,
+    0x5d, 0xae, 0x22, 0x23, 0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+    0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad
+  };
+  static const uint8_t abc_sha1[20] = {
+    0xa9, 0x99, 0x3e, 0x36, 0x47, 0x06, 0x81, 0x6a, 0xba, 0x3e, 0x25, 0x71,
+    0x78, 0x50, 0xc2, 0x6c, 0x9c, 0xd0, 0xd8, 0x9d
+  };
+  CRYPTO_SHA256_Digest_TypeDef digest256;
+  CRYPTO_SHA1_Digest_TypeDef   digest1;
+
+  CMU_ClockEnable(cmuClock_CRYPTOACC, true);
+  CRYPTO_SHA_256(CRYPTO, (const uint8_t *)"abc", 3, digest256);
+  CHECK(memcmp(digest256, abc_sha256, sizeof(abc_sha256)) == 0);
+  CRYPTO_SHA_1(CRYPTO, (const uint8_t *)"abc", 3, digest1);
+  CHECK(memcmp(digest1, abc_sha1, sizeof(abc_sha1)) == 0);
+  CMU_ClockEnable(cmuClock_CRYPTOACC, false);
+}
+
+int main(void)
+{
+  sim_init();
+  // The peripheral initializations update their pin routes
+  CMU_ClockEnable(cmuClock_GPIO, true);
+
+  test_cmu();
+  test_usart();
+  test_eusart();
+  test_timer();
+  test_ldma();
+  test_msc();
+  test_iadc();
+  test_i2c();
+  test_crypto();
+
+  return check_report();
+}
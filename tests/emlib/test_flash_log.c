@@ -0,0 +1,393 @@
+/*
+ *  Test of the flash log record store of the RAIL flash-data plugin
+ *
+ *  flash_log.c is built over the last FLASH_LOG_PAGE_COUNT pages of the
+ *  flash model, once with MSC_WriteWord() and once with MSC_WriteWordDma()
+ *  (test_flash_log_dma). Checks records against a copy kept in RAM through
+ *  writes, deletes, garbage collection and remounts, that the erase counts
+ *  stay within FLASH_LOG_WEAR_THRESHOLD of each other, and that cutting the
+ *  power at any flash operation of a write, garbage collection included,
+ *  leaves the previous record, the other records intact and the log
+ *  writable after FL_Init(). Reports the rate of FL_WriteRecord() in device
+ *  time and of FL_ReadRecord() in host time.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+
+#include "check.h"
+#include "sim.h"
+#include "em_cmu.h"
+#include "em_ldma.h"
+#include "em_msc.h"
+#include "flash_log.h"
+#include "flash_data_config.h"
+
+#define KEYS                8U
+#define MAX_LENGTH          200U
+#define LOG_SIZE            (FLASH_LOG_PAGE_COUNT * FLASH_DATA_PAGE_SIZE)
+// Flash taken by a record: header, data padded to words and commit marker
+#define FLASH_LOG_RECORD_BYTES(length)  (8U + (((length) + 3U) & ~3U))
+// Prefix, erase count and sequence words programmed when a page is reused
+#define PAGE_HEADER_BYTES   12U
+#define STACK_SIZE          (256U * 1024U)
+#define RATE_WRITES         500U
+#define RATE_READS          1000000U
+
+typedef struct {
+  uint32_t length;        // 0 for no record
+  uint8_t  data[MAX_LENGTH];
+} record_t;
+
+static record_t records[KEYS];
+static uint8_t  flash_image[SIM_FLASH_SIZE];
+
+/* The tests run on this stack: flash_log.c programs words from its stack,
+   which the LDMA can only read below 4 GB */
+static uint8_t    stack[STACK_SIZE];
+static ucontext_t main_context;
+static ucontext_t test_context;
+
+/* Contents of version of the record for key, length 1 to MAX_LENGTH */
+static uint32_t make_record(uint16_t key, uint32_t version, uint8_t *data)
+{
+  uint32_t length = 1U + (key * 37U + version * 11U) % MAX_LENGTH;
+
+  for (uint32_t i = 0; i < length; i++) {
+    data[i] = (uint8_t)(key * 31U + version * 7U + i);
+  }
+  return length;
+}
+
+static RAIL_Status_t write(uint16_t key, uint32_t version)
+{
+  uint8_t       data[MAX_LENGTH];
+  uint32_t      length = make_record(key, version, data);
+  RAIL_Status_t status = FL_WriteRecord(key, data, length);
+
+  if (status == RAIL_STATUS_NO_ERROR) {
+    records[key].length = length;
+    memcpy(records[key].data, data, length);
+  }
+  return status;
+}
+
+static bool matches(uint16_t key, const record_t *record)
+{
+  uint8_t      *data;
+  uint32_t      length;
+  RAIL_Status_t status = FL_ReadRecord(key, &data, &length);
+
+  if (record->length == 0) {
+    return status == RAIL_STATUS_INVALID_CALL;
+  }
+  return (status == RAIL_STATUS_NO_ERROR) && (length == record->length)
+         && (memcmp(data, record->data, length) == 0);
+}
+
+/* Every key holds the record kept in RAM */
+static bool all_match(void)
+{
+  for (uint16_t key = 0; key < KEYS; key++) {
+    if (!matches(key, &records[key])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static uint32_t flash_operations(void)
+{
+  sim_flash_stats_t stats;
+
+  sim_flash_stats_get(&stats);
+  return stats.word_writes + stats.page_erases;
+}
+
+/* Starts from flash as the device leaves it, not erased */
+static void mount_dirty(void)
+{
+  static const uint32_t garbage[4] = { 0x12345678, 0, 0xCAFEF00D, 1 };
+  uint32_t             *base = (uint32_t *)FLASH_LOG_BASE_ADDR;
+  unsigned              dirty = 0;
+
+  sim_flash_clear();
+  MSC_Init();
+  for (uint32_t page = 0; page < FLASH_LOG_PAGE_COUNT; page++) {
+    MSC_WriteWord(base + page * FLASH_DATA_PAGE_SIZE / 4 + page * 9U, garbage,
+                  sizeof(garbage));
+  }
+  MSC_Deinit();
+  memset(records, 0, sizeof(records));
+  CHECK(FL_Init() == RAIL_STATUS_NO_ERROR);
+
+  // Only the erase counts are left
+  for (uint32_t i = 0; i < LOG_SIZE / 4; i++) {
+    dirty += (i % (FLASH_DATA_PAGE_SIZE / 4) != 1) && (base[i] != 0xFFFFFFFFU);
+  }
+  CHECK(dirty == 0);
+}
+
+static void test_basic(void)
+{
+  uint8_t  *data;
+  uint32_t  length;
+  FL_Stats_t stats;
+
+  mount_dirty();
+  CHECK(FL_ReadRecord(0, &data, &length) == RAIL_STATUS_INVALID_CALL);
+  CHECK(FL_WriteRecord(KEYS, (const uint8_t *)"x", 1) == RAIL_STATUS_NO_ERROR);
+  CHECK(FL_WriteRecord(FLASH_LOG_KEY_COUNT, (const uint8_t *)"x", 1)
+        == RAIL_STATUS_INVALID_PARAMETER);
+  CHECK(FL_WriteRecord(0, (const uint8_t *)"x", 0) == RAIL_STATUS_INVALID_PARAMETER);
+  CHECK(FL_WriteRecord(0, NULL, 1) == RAIL_STATUS_INVALID_PARAMETER);
+  CHECK(FL_WriteRecord(0, (const uint8_t *)"x", FL_GetMaxRecordLength() + 1)
+        == RAIL_STATUS_INVALID_PARAMETER);
+  CHECK(FL_DeleteRecord(KEYS) == RAIL_STATUS_NO_ERROR);
+  CHECK(FL_DeleteRecord(KEYS) == RAIL_STATUS_INVALID_CALL);
+
+  for (uint16_t key = 0; key < KEYS; key++) {
+    CHECK(write(key, 0) == RAIL_STATUS_NO_ERROR);
+  }
+  CHECK(all_match());
+  CHECK(write(3, 1) == RAIL_STATUS_NO_ERROR);
+  CHECK(FL_DeleteRecord(5) == RAIL_STATUS_NO_ERROR);
+  records[5].length = 0;
+  CHECK(all_match());
+
+  // The index is rebuilt from flash
+  CHECK(FL_Init() == RAIL_STATUS_NO_ERROR);
+  CHECK(all_match());
+  FL_GetStats(&stats);
+  CHECK(stats.bytesRequested == 0);
+
+  CHECK(FL_Format() == RAIL_STATUS_NO_ERROR);
+  memset(records, 0, sizeof(records));
+  CHECK(all_match());
+  CHECK(FL_Init() == RAIL_STATUS_NO_ERROR);
+  CHECK(all_match());
+}
+
+/* Enough updates of a few hot keys, next to cold ones, to go through every
+   page many times */
+static void test_collection(void)
+{
+  FL_Stats_t stats;
+  FL_Stats_t total = { 0 };
+  uint32_t   version = 1;
+  bool       ok = true;
+
+  mount_dirty();
+  for (uint16_t key = 0; key < KEYS; key++) {
+    CHECK(write(key, 0) == RAIL_STATUS_NO_ERROR);
+  }
+  while (true) {
+    FL_GetStats(&stats);
+    if (stats.minEraseCount >= 3 * FLASH_LOG_WEAR_THRESHOLD) {
+      break;
+    }
+    ok &= write((uint16_t)(version % 3U), version) == RAIL_STATUS_NO_ERROR;
+    if (version % 97U == 0) {
+      ok &= all_match();
+      ok &= stats.maxEraseCount - stats.minEraseCount <= FLASH_LOG_WEAR_THRESHOLD + 1;
+    }
+    if (version % 1001U == 0) {
+      // The statistics start again from the remount
+      total.bytesRequested  += stats.bytesRequested;
+      total.bytesProgrammed += stats.bytesProgrammed;
+      total.collections     += stats.collections;
+      ok &= FL_Init() == RAIL_STATUS_NO_ERROR;
+      ok &= all_match();
+    }
+    version++;
+  }
+  total.bytesRequested  += stats.bytesRequested;
+  total.bytesProgrammed += stats.bytesProgrammed;
+  total.collections     += stats.collections;
+  CHECK(ok);
+  CHECK(all_match());
+  CHECK(total.collections > 0);
+  // Live data is a small part of the log, collections copy little
+  CHECK(total.bytesProgrammed < 2 * total.bytesRequested);
+  printf("%u writes, %u collections, write amplification %.2f, erase counts "
+         "%u to %u\n", (unsigned)version, (unsigned)total.collections,
+         (double)total.bytesProgrammed / total.bytesRequested,
+         (unsigned)stats.minEraseCount, (unsigned)stats.maxEraseCount);
+
+  CHECK(FL_Collect() == RAIL_STATUS_NO_ERROR);
+  CHECK(all_match());
+  CHECK(FL_Init() == RAIL_STATUS_NO_ERROR);
+  CHECK(all_match());
+}
+
+/* Writes per second of device time, flash programming and garbage
+   collection included, and reads per second of host time, as reading a
+   record takes no register access */
+static void report_rates(void)
+{
+  struct timespec start;
+  struct timespec end;
+  uint64_t        sim_start = sim_time();
+  double          write_s;
+  double          read_s;
+  bool            ok = true;
+
+  for (uint32_t version = 0; version < RATE_WRITES; version++) {
+    ok &= write((uint16_t)(version % KEYS), version) == RAIL_STATUS_NO_ERROR;
+  }
+  write_s = (double)(sim_time() - sim_start) * 1e-9;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint32_t i = 0; i < RATE_READS; i++) {
+    uint8_t *data;
+    uint32_t length;
+
+    ok &= FL_ReadRecord((uint16_t)(i % KEYS), &data, &length) == RAIL_STATUS_NO_ERROR;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  read_s = (double)(end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) * 1e-9;
+
+  CHECK(ok);
+  CHECK(all_match());
+  printf("FL_WriteRecord %.0f ops/s of device time, FL_ReadRecord %.0f ops/s "
+         "of host time\n", RATE_WRITES / write_s, RATE_READS / read_s);
+}
+
+static uint32_t page_erases(void)
+{
+  sim_flash_stats_t stats;
+
+  sim_flash_stats_get(&stats);
+  return stats.page_erases;
+}
+
+/* Key of the version-th write of the power loss tests: every key once, then
+   three hot keys, so that the pages of the cold keys get collected */
+static uint16_t key_of(uint32_t version)
+{
+  return (uint16_t)((version < KEYS) ? version : version % 3U);
+}
+
+/* The first version whose write erases a page, or, with copies, moves live
+   records first, writing versions from 0 on from a fresh log */
+static uint32_t first_collection(bool copies)
+{
+  uint32_t version = 0;
+
+  mount_dirty();
+  while (true) {
+    uint16_t   key    = key_of(version);
+    uint32_t   erases = page_erases();
+    FL_Stats_t before;
+    FL_Stats_t after;
+
+    FL_GetStats(&before);
+    CHECK(write(key, version) == RAIL_STATUS_NO_ERROR);
+    FL_GetStats(&after);
+    if (copies ? (after.bytesProgrammed - before.bytesProgrammed
+                  > FLASH_LOG_RECORD_BYTES(records[key].length) + PAGE_HEADER_BYTES)
+        : (page_erases() != erases)) {
+      return version;
+    }
+    version++;
+  }
+}
+
+/* Cuts the power at each flash operation in turn of the write of version
+   count, the versions before it being written from a fresh log */
+static void test_power_loss(uint32_t count, bool erases_page)
+{
+  record_t saved[KEYS];
+  uint16_t key = key_of(count);
+  uint32_t operations = 0;
+  uint32_t fail = 0;
+  unsigned runs = 0;
+  bool     ok = true;
+
+  mount_dirty();
+  for (uint32_t version = 0; version < count; version++) {
+    ok &= write(key_of(version), version) == RAIL_STATUS_NO_ERROR;
+  }
+  memcpy(saved, records, sizeof(records));
+  sim_flash_save(flash_image);
+
+  while (true) {
+    uint32_t      start;
+    uint32_t      erases;
+    RAIL_Status_t status;
+
+    sim_flash_restore(flash_image);
+    memcpy(records, saved, sizeof(records));
+    ok &= FL_Init() == RAIL_STATUS_NO_ERROR;
+
+    start  = flash_operations();
+    erases = page_erases();
+    sim_flash_fail_after(fail);
+    status = write(key, count);
+    if (fail == 0) {
+      ok &= status == RAIL_STATUS_NO_ERROR;
+      operations = flash_operations() - start;
+      CHECK((page_erases() != erases) == erases_page);
+    } else {
+      CHECK(flash_operations() - start == fail);
+      sim_flash_power_cycle();
+
+      // Reboot. The commit marker is the last word written, the write is
+      // lost whatever operation the power fails at.
+      memcpy(records, saved, sizeof(records));
+      ok &= FL_Init() == RAIL_STATUS_NO_ERROR;
+      ok &= all_match();
+      ok &= write((uint16_t)((key + 1U) % KEYS), count + 1) == RAIL_STATUS_NO_ERROR;
+      ok &= FL_Init() == RAIL_STATUS_NO_ERROR;
+      ok &= all_match();
+      runs++;
+    }
+    if (!ok) {
+      printf("  power lost at operation %u of %u\n", (unsigned)fail,
+             (unsigned)operations);
+      break;
+    }
+    if (fail >= operations) {
+      break;
+    }
+    fail++;
+  }
+  CHECK(ok);
+  CHECK(runs > 0);
+}
+
+static void run_tests(void)
+{
+  test_basic();
+  test_collection();
+  report_rates();
+  // A write appended to the open page, one that erases a page first, and
+  // one that moves live records off it first
+  test_power_loss(KEYS + 1, false);
+  test_power_loss(first_collection(false), true);
+  test_power_loss(first_collection(true), true);
+}
+
+int main(void)
+{
+  sim_init();
+  CMU_ClockEnable(cmuClock_GPIO, true);
+#ifdef FLASH_LOG_DMA_CHANNEL
+  LDMA_Init_t ldma = LDMA_INIT_DEFAULT;
+
+  CMU_ClockEnable(cmuClock_LDMA, true);
+  CMU_ClockEnable(cmuClock_LDMAXBAR, true);
+  LDMA_Init(&ldma);
+#endif
+
+  getcontext(&test_context);
+  test_context.uc_stack.ss_sp   = stack;
+  test_context.uc_stack.ss_size = sizeof(stack);
+  test_context.uc_link          = &main_context;
+  makecontext(&test_context, run_tests, 0);
+  swapcontext(&main_context, &test_context);
+
+  return check_report();
+}
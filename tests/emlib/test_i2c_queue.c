@@ -0,0 +1,413 @@
+/*
+ *  Test of the interrupt driven I2C transaction queue of em_i2c_utils
+ *
+ *  An EEPROM slave answers on I2C0 and TIMER0 calls I2C_QueueTick() every
+ *  TICK_US microseconds. Checks that queued transactions run back to back,
+ *  each one started before the callback of the one before it runs, with the
+ *  callbacks in submission order, and that a callback can submit the next
+ *  transaction. A stalled transaction times out and a bus error ends one,
+ *  both followed by an I2C_Reset() and I2C_Init() after which the queue
+ *  goes on, while an address NACK needs no recovery. A full queue refuses
+ *  submissions, and busyTicks and idleGaps follow the bus time and the times
+ *  the queue drained.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "check.h"
+#include "sim.h"
+#include "em_cmu.h"
+#include "em_core.h"
+#include "em_i2c.h"
+#include "em_i2c_utils.h"
+#include "em_timer.h"
+
+#define EEPROM_ADDRESS      0x50
+#define QUEUE_SIZE          4U
+#define TICK_US             10U
+#define TIMEOUT_TICKS       5U
+#define MAX_DONE            8U
+#define SADDR_MARK          (0x42U << 1)
+
+static I2C_Queue_TypeDef      queue;
+static I2C_QueueEntry_TypeDef entries[QUEUE_SIZE];
+static sim_eeprom_t           eeprom;
+
+/* Callbacks in the order they ran */
+static struct {
+  I2C_TransferSeq_TypeDef   *seq;
+  I2C_TransferReturn_TypeDef result;
+  void                      *arg;
+  bool                      nextActive;   // The next one was on the bus
+} done[MAX_DONE];
+static volatile uint32_t doneCount;
+
+static I2C_TransferSeq_TypeDef followUp;
+
+void I2C0_IRQHandler(void)
+{
+  I2C_QueueIrqHandler(&queue);
+}
+
+void TIMER0_IRQHandler(void)
+{
+  TIMER_IntClear(TIMER0, TIMER_IntGet(TIMER0));
+  I2C_QueueTick(&queue);
+}
+
+static void record(I2C_TransferSeq_TypeDef *seq,
+                   I2C_TransferReturn_TypeDef result, void *arg)
+{
+  if (doneCount < MAX_DONE) {
+    done[doneCount].seq        = seq;
+    done[doneCount].result     = result;
+    done[doneCount].arg        = arg;
+    done[doneCount].nextActive = queue.active;
+  }
+  doneCount++;
+}
+
+static void submit_follow_up(I2C_TransferSeq_TypeDef *seq,
+                             I2C_TransferReturn_TypeDef result, void *arg)
+{
+  record(seq, result, arg);
+  CHECK(I2C_QueueSubmit(&queue, &followUp, record, NULL, 0));
+}
+
+/* data holds the EEPROM address then the bytes to write there */
+static void seq_write(I2C_TransferSeq_TypeDef *seq, uint8_t *data,
+                      uint16_t length)
+{
+  seq->addr        = EEPROM_ADDRESS << 1;
+  seq->flags       = I2C_FLAG_WRITE;
+  seq->buf[0].data = data;
+  seq->buf[0].len  = length;
+}
+
+static void seq_read(I2C_TransferSeq_TypeDef *seq, uint8_t *pointer,
+                     uint8_t *data, uint16_t length)
+{
+  seq->addr        = EEPROM_ADDRESS << 1;
+  seq->flags       = I2C_FLAG_WRITE_READ;
+  seq->buf[0].data = pointer;
+  seq->buf[0].len  = 1;
+  seq->buf[1].data = data;
+  seq->buf[1].len  = length;
+}
+
+static void wait_idle(void)
+{
+  while (I2C_QueuePending(&queue) != 0) {
+    __WFI();
+  }
+}
+
+static void tick_start(void)
+{
+  TIMER_Init_TypeDef init = TIMER_INIT_DEFAULT;
+
+  CMU_ClockEnable(cmuClock_TIMER0, true);
+  init.enable = false;
+  TIMER_Init(TIMER0, &init);
+  TIMER_TopSet(TIMER0, CMU_ClockFreqGet(cmuClock_TIMER0) / (1000000U / TICK_US) - 1U);
+  TIMER_IntClear(TIMER0, _TIMER_IF_MASK);
+  TIMER_IntEnable(TIMER0, TIMER_IEN_OF);
+  NVIC_ClearPendingIRQ(TIMER0_IRQn);
+  NVIC_EnableIRQ(TIMER0_IRQn);
+  TIMER_Enable(TIMER0, true);
+}
+
+static void test_chain(void)
+{
+  uint8_t                 blocks[2][9] = {
+    { 0x20, 1, 2, 3, 4, 5, 6, 7, 8 },
+    { 0x28, 9, 10, 11, 12, 13, 14, 15, 16 },
+  };
+  uint8_t                 pointers[2] = { 0x20, 0x24 };
+  uint8_t                 read[16];
+  uint8_t                 part[4];
+  I2C_TransferSeq_TypeDef seq[4];
+  I2C_QueueStats_TypeDef  stats;
+
+  seq_write(&seq[0], blocks[0], sizeof(blocks[0]));
+  seq_write(&seq[1], blocks[1], sizeof(blocks[1]));
+  seq_read(&seq[2], &pointers[0], read, sizeof(read));
+  seq_read(&seq[3], &pointers[1], part, sizeof(part));
+
+  I2C_QueueClearStats(&queue);
+  doneCount = 0;
+  for (unsigned i = 0; i < 4; i++) {
+    CHECK(I2C_QueueSubmit(&queue, &seq[i], record, &seq[i], 0));
+  }
+  wait_idle();
+
+  // In order, each one started before the callback of the one before
+  CHECK(doneCount == 4);
+  for (unsigned i = 0; i < 4; i++) {
+    CHECK(done[i].seq == &seq[i]);
+    CHECK(done[i].arg == &seq[i]);
+    CHECK(done[i].result == i2cTransferDone);
+    CHECK(done[i].nextActive == (i < 3));
+  }
+  CHECK(memcmp(read, &blocks[0][1], 8) == 0);
+  CHECK(memcmp(read + 8, &blocks[1][1], 8) == 0);
+  CHECK(memcmp(part, &blocks[0][5], 4) == 0);
+
+  I2C_QueueGetStats(&queue, &stats);
+  CHECK(stats.completed == 4);
+  CHECK(stats.failed == 0);
+  CHECK(stats.bytes == 9 + 9 + 1 + 16 + 1 + 4);
+  CHECK(stats.maxQueued == 4);
+  CHECK(stats.idleGaps == 1);
+}
+
+static void test_callback_submit(void)
+{
+  uint8_t                 block[5] = { 0x40, 0xA1, 0xA2, 0xA3, 0xA4 };
+  uint8_t                 pointer  = 0x40;
+  uint8_t                 read[4];
+  I2C_TransferSeq_TypeDef seq;
+
+  seq_write(&seq, block, sizeof(block));
+  seq_read(&followUp, &pointer, read, sizeof(read));
+
+  doneCount = 0;
+  CHECK(I2C_QueueSubmit(&queue, &seq, submit_follow_up, NULL, 0));
+  wait_idle();
+
+  CHECK(doneCount == 2);
+  CHECK(done[0].seq == &seq && done[0].result == i2cTransferDone);
+  CHECK(done[1].seq == &followUp && done[1].result == i2cTransferDone);
+  CHECK(memcmp(read, &block[1], sizeof(read)) == 0);
+}
+
+/* Leaves marks only a recovery removes: a slave address, which only
+   I2C_Reset() clears, and another bus frequency, which I2C_Init() sets
+   back */
+static void mark_config(void)
+{
+  I2C0->SADDR = SADDR_MARK;
+  I2C_BusFreqSet(I2C0, 0, I2C_FREQ_FAST_MAX, i2cClockHLRAsymetric);
+}
+
+/* Reads back the start of the block test_chain() wrote */
+static void check_read(void)
+{
+  uint8_t                 pointer = 0x20;
+  uint8_t                 read[2];
+  I2C_TransferSeq_TypeDef seq;
+
+  seq_read(&seq, &pointer, read, sizeof(read));
+  doneCount = 0;
+  CHECK(I2C_QueueSubmit(&queue, &seq, record, NULL, 0));
+  wait_idle();
+  CHECK(doneCount == 1 && done[0].result == i2cTransferDone);
+  CHECK(read[0] == 1 && read[1] == 2);
+}
+
+/* A recovered I2C is back to the configuration of the queue and takes
+   transactions */
+static void check_recovered(uint32_t clkdiv)
+{
+  CHECK(I2C0->EN & I2C_EN_EN);
+  CHECK(I2C0->SADDR == 0);
+  CHECK(I2C0->CLKDIV == clkdiv);
+  CHECK((I2C0->CTRL & _I2C_CTRL_CLHR_MASK) == I2C_CTRL_CLHR_STANDARD);
+  CHECK((I2C0->IF & (I2C_IF_BUSERR | I2C_IF_ARBLOST)) == 0);
+  check_read();
+}
+
+static void test_timeout(void)
+{
+  uint32_t                clkdiv  = I2C0->CLKDIV;
+  uint8_t                 pointer = 0x20;
+  uint8_t                 read[2];
+  I2C_TransferSeq_TypeDef seq;
+  I2C_QueueStats_TypeDef  stats;
+  uint32_t                start;
+
+  // The slave holds SCL low after its address, the transaction never ends
+  seq_read(&seq, &pointer, read, sizeof(read));
+  I2C_QueueClearStats(&queue);
+  doneCount = 0;
+  mark_config();
+  sim_i2c_stall(I2C0, true);
+  start = queue.ticks;
+  CHECK(I2C_QueueSubmit(&queue, &seq, record, NULL, TIMEOUT_TICKS));
+  wait_idle();
+  sim_i2c_stall(I2C0, false);
+
+  CHECK(doneCount == 1 && done[0].result == I2C_QUEUE_TIMEOUT);
+  CHECK(queue.ticks - start >= TIMEOUT_TICKS - 1);
+  CHECK(queue.ticks - start <= TIMEOUT_TICKS);
+  I2C_QueueGetStats(&queue, &stats);
+  CHECK(stats.timeouts == 1);
+  CHECK(stats.failed == 1);
+  CHECK(stats.recoveries == 1);
+
+  check_recovered(clkdiv);
+}
+
+static void bus_error(sim_event_t *event)
+{
+  sim_i2c_bus_error(I2C0);
+}
+
+static void test_errors(void)
+{
+  uint32_t                clkdiv = I2C0->CLKDIV;
+  uint8_t                 block[17];
+  uint8_t                 pointer = 0x20;
+  uint8_t                 read[4];
+  I2C_TransferSeq_TypeDef seq[2];
+  I2C_QueueStats_TypeDef  stats;
+  sim_event_t             fault;
+
+  // Nothing answers at the next address, the bus is left idle by the NACK
+  // and the I2C is not reset
+  seq_read(&seq[0], &pointer, read, sizeof(read));
+  seq[0].addr = (EEPROM_ADDRESS + 1) << 1;
+  I2C_QueueClearStats(&queue);
+  doneCount = 0;
+  I2C0->SADDR = SADDR_MARK;
+  CHECK(I2C_QueueSubmit(&queue, &seq[0], record, NULL, 0));
+  wait_idle();
+  CHECK(doneCount == 1 && done[0].result == i2cTransferAddrNack);
+  CHECK(I2C0->SADDR == SADDR_MARK);
+  I2C0->SADDR = 0;
+  I2C_QueueGetStats(&queue, &stats);
+  CHECK(stats.failed == 1);
+  CHECK(stats.recoveries == 0);
+  check_read();
+
+  // A bus error halfway through a write, with a read queued behind it
+  memset(block, 0x55, sizeof(block));
+  block[0] = 0x80;
+  seq_write(&seq[0], block, sizeof(block));
+  seq_read(&seq[1], &pointer, read, sizeof(read));
+  sim_event_init(&fault, bus_error, NULL);
+  mark_config();
+  I2C_QueueClearStats(&queue);
+  doneCount = 0;
+  CHECK(I2C_QueueSubmit(&queue, &seq[0], record, NULL, 0));
+  CHECK(I2C_QueueSubmit(&queue, &seq[1], record, NULL, 0));
+  sim_event_schedule(&fault, 100000);
+  wait_idle();
+  CHECK(doneCount == 2);
+  CHECK(done[0].seq == &seq[0] && done[0].result == i2cTransferBusErr);
+  CHECK(done[1].seq == &seq[1] && done[1].result == i2cTransferDone);
+  CHECK(read[0] == 1 && read[3] == 4);
+  I2C_QueueGetStats(&queue, &stats);
+  CHECK(stats.failed == 1);
+  CHECK(stats.completed == 1);
+  CHECK(stats.recoveries == 1);
+  check_recovered(clkdiv);
+}
+
+static void test_full(void)
+{
+  uint8_t                 pointer = 0x20;
+  uint8_t                 read[QUEUE_SIZE + 1][2];
+  I2C_TransferSeq_TypeDef seq[QUEUE_SIZE + 1];
+  I2C_QueueStats_TypeDef  stats;
+
+  for (unsigned i = 0; i <= QUEUE_SIZE; i++) {
+    seq_read(&seq[i], &pointer, read[i], sizeof(read[i]));
+  }
+  I2C_QueueClearStats(&queue);
+  doneCount = 0;
+
+  // With the interrupts masked nothing leaves the queue
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_CRITICAL();
+  for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+    CHECK(I2C_QueueSubmit(&queue, &seq[i], record, NULL, 0));
+  }
+  CHECK(!I2C_QueueSubmit(&queue, &seq[QUEUE_SIZE], record, NULL, 0));
+  CHECK(I2C_QueuePending(&queue) == QUEUE_SIZE);
+  CORE_EXIT_CRITICAL();
+  wait_idle();
+  CHECK(doneCount == QUEUE_SIZE);
+
+  CHECK(I2C_QueueSubmit(&queue, &seq[QUEUE_SIZE], record, NULL, 0));
+  wait_idle();
+  CHECK(doneCount == QUEUE_SIZE + 1);
+  for (unsigned i = 0; i <= QUEUE_SIZE; i++) {
+    CHECK(done[i].seq == &seq[i] && done[i].result == i2cTransferDone);
+  }
+  I2C_QueueGetStats(&queue, &stats);
+  CHECK(stats.maxQueued == QUEUE_SIZE);
+  CHECK(stats.completed == QUEUE_SIZE + 1);
+}
+
+static void test_stats(void)
+{
+  uint8_t                 block[17];
+  I2C_TransferSeq_TypeDef seq[QUEUE_SIZE];
+  I2C_QueueStats_TypeDef  stats;
+  uint64_t                start;
+  uint32_t                busy;
+  uint32_t                ticks;
+
+  memset(block, 0xAA, sizeof(block));
+  block[0] = 0x80;
+  for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+    seq_write(&seq[i], block, sizeof(block));
+  }
+
+  // Wait for the start of a tick, then run a batch
+  ticks = queue.ticks;
+  while (queue.ticks == ticks) {
+    __WFI();
+  }
+  I2C_QueueClearStats(&queue);
+  start = sim_time();
+  for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+    CHECK(I2C_QueueSubmit(&queue, &seq[i], NULL, NULL, 0));
+  }
+  wait_idle();
+  busy = (uint32_t)((sim_time() - start) / (TICK_US * 1000U));
+
+  I2C_QueueGetStats(&queue, &stats);
+  CHECK(stats.completed == QUEUE_SIZE);
+  CHECK(stats.bytes == QUEUE_SIZE * sizeof(block));
+  CHECK(stats.busyTicks + 1 >= busy);
+  CHECK(stats.busyTicks <= busy + 1);
+  CHECK(stats.idleGaps == 1);
+
+  // Idle ticks are counted until the next batch, which drains once more
+  ticks = queue.ticks;
+  while (queue.ticks - ticks < 20) {
+    __WFI();
+  }
+  for (unsigned i = 0; i < QUEUE_SIZE; i++) {
+    CHECK(I2C_QueueSubmit(&queue, &seq[i], NULL, NULL, 0));
+  }
+  wait_idle();
+  I2C_QueueGetStats(&queue, &stats);
+  CHECK(stats.idleTicks >= 20);
+  CHECK(stats.idleGaps == 2);
+  CHECK(stats.completed == 2 * QUEUE_SIZE);
+}
+
+int main(void)
+{
+  I2C_Init_TypeDef init = I2C_INIT_DEFAULT;
+
+  sim_init();
+  sim_eeprom_init(&eeprom, EEPROM_ADDRESS);
+  sim_i2c_attach(I2C0, &eeprom.slave);
+  CMU_ClockEnable(cmuClock_I2C0, true);
+  I2C_QueueInit(&queue, I2C0, &init, entries, QUEUE_SIZE);
+  tick_start();
+
+  test_chain();
+  test_callback_submit();
+  test_timeout();
+  test_errors();
+  test_full();
+  test_stats();
+
+  return check_report();
+}
@@ -0,0 +1,243 @@
+/*
+ *  Test of the batched IADC FIFO drains
+ *
+ *  For every FIFO alignment, with and without IDs, a scan of four inputs
+ *  and four single conversions fill the FIFOs twice: once drained one
+ *  result at a time by IADC_pullScanFifoResult() and
+ *  IADC_pullSingleFifoResult(), once by each batched function. The results
+ *  must be the same, partial drains must leave the rest in order, and a
+ *  batch must read the FIFO configuration and level only once.
+ */
+
+#include <stdio.h>
+
+#include "check.h"
+#include "sim.h"
+#include "em_cmu.h"
+#include "em_iadc.h"
+
+// Results per fill, the FIFO depth of the model
+#define ENTRIES             4U
+#define SINGLE_ID           0x20U
+
+typedef enum {
+  DRAIN_RESULTS,
+  DRAIN_ARRAYS,
+  DRAIN_ARRAYS_NO_ID,
+} drain_t;
+
+static const IADC_PosInput_t inputs[ENTRIES] = {
+  iadcPosInputPortBPin0, iadcPosInputPortBPin1,
+  iadcPosInputPortBPin2, iadcPosInputPortBPin3
+};
+static const uint32_t millivolts[ENTRIES] = { 0, 825, 1650, 3300 };
+
+static const IADC_Alignment_t alignments[] = {
+  iadcAlignRight12, iadcAlignRight16, iadcAlignRight20,
+  iadcAlignLeft12, iadcAlignLeft16, iadcAlignLeft20
+};
+
+static void init(IADC_Alignment_t alignment, bool showId)
+{
+  IADC_Init_t        init    = IADC_INIT_DEFAULT;
+  IADC_AllConfigs_t  configs = IADC_ALLCONFIGS_DEFAULT;
+  IADC_InitScan_t    scan    = IADC_INITSCAN_DEFAULT;
+  IADC_ScanTable_t   table   = IADC_SCANTABLE_DEFAULT;
+  IADC_InitSingle_t  single  = IADC_INITSINGLE_DEFAULT;
+  IADC_SingleInput_t input   = IADC_SINGLEINPUT_DEFAULT;
+
+  init.srcClkPrescale             = IADC_calcSrcClkPrescale(IADC0, 10000000, 0);
+  configs.configs[0].reference    = iadcCfgReferenceVddx;
+  configs.configs[0].vRef         = 3300;
+  configs.configs[0].adcClkPrescale =
+    IADC_calcAdcClkPrescale(IADC0, 1000000, 0, iadcCfgModeNormal, init.srcClkPrescale);
+  scan.alignment   = alignment;
+  scan.showId      = showId;
+  single.alignment = alignment;
+  single.showId    = showId;
+  for (unsigned i = 0; i < ENTRIES; i++) {
+    table.entries[i].posInput      = inputs[i];
+    table.entries[i].negInput      = iadcNegInputGnd;
+    table.entries[i].includeInScan = true;
+  }
+  input.posInput = inputs[0];
+  input.negInput = iadcNegInputGnd;
+
+  IADC_reset(IADC0);
+  IADC_init(IADC0, &init, &configs);
+  IADC_initScan(IADC0, &scan, &table);
+  IADC_initSingle(IADC0, &single, &input);
+}
+
+static void fill_scan(void)
+{
+  IADC_command(IADC0, iadcCmdStartScan);
+  while (IADC_getScanFifoCnt(IADC0) < ENTRIES) {
+  }
+}
+
+/* Converts each input in turn, the single input being reconfigured between
+   conversions */
+static void fill_single(void)
+{
+  IADC_SingleInput_t input = IADC_SINGLEINPUT_DEFAULT;
+
+  for (unsigned i = 0; i < ENTRIES; i++) {
+    input.posInput = inputs[i];
+    input.negInput = iadcNegInputGnd;
+    IADC_updateSingleInput(IADC0, &input);
+    IADC_command(IADC0, iadcCmdStartSingle);
+    while (IADC_getSingleFifoCnt(IADC0) < i + 1) {
+    }
+  }
+}
+
+static bool same(const IADC_Result_t *a, const IADC_Result_t *b, unsigned count)
+{
+  for (unsigned i = 0; i < count; i++) {
+    if (a[i].data != b[i].data || a[i].id != b[i].id) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Drains the FIFO with the batched function of the kind given, in two calls
+   of max results then the rest, and converts back to results */
+static uint32_t drain(bool scan, drain_t kind, IADC_Result_t *results,
+                      uint32_t max)
+{
+  uint32_t data[ENTRIES];
+  uint8_t  id[ENTRIES];
+  uint32_t count = 0;
+
+  for (unsigned call = 0; call < 2; call++) {
+    uint32_t limit = (call == 0) ? max : ENTRIES;
+    uint32_t pulled;
+
+    if (kind == DRAIN_RESULTS) {
+      pulled = scan ? IADC_pullScanFifoResults(IADC0, results + count, limit)
+               : IADC_pullSingleFifoResults(IADC0, results + count, limit);
+    } else {
+      uint8_t *ids = (kind == DRAIN_ARRAYS) ? id : NULL;
+
+      for (unsigned i = 0; i < ENTRIES; i++) {
+        id[i] = 0xEE;
+      }
+      pulled = scan ? IADC_pullScanFifoResultArrays(IADC0, data, ids, limit)
+               : IADC_pullSingleFifoResultArrays(IADC0, data, ids, limit);
+      for (uint32_t i = 0; i < pulled; i++) {
+        results[count + i].data = data[i];
+        results[count + i].id   = id[i];
+      }
+    }
+    CHECK(pulled <= limit);
+    count += pulled;
+  }
+  return count;
+}
+
+static void check_fifo(bool scan, IADC_Alignment_t alignment, bool showId)
+{
+  IADC_Result_t expected[ENTRIES];
+  IADC_Result_t results[ENTRIES];
+
+  init(alignment, showId);
+  scan ? fill_scan() : fill_single();
+  for (unsigned i = 0; i < ENTRIES; i++) {
+    expected[i] = scan ? IADC_pullScanFifoResult(IADC0)
+                  : IADC_pullSingleFifoResult(IADC0);
+  }
+  if (showId) {
+    for (unsigned i = 0; i < ENTRIES; i++) {
+      CHECK(expected[i].id == (scan ? i : SINGLE_ID));
+    }
+  }
+
+  for (drain_t kind = DRAIN_RESULTS; kind <= DRAIN_ARRAYS_NO_ID; kind++) {
+    for (uint32_t max = 0; max <= ENTRIES; max++) {
+      scan ? fill_scan() : fill_single();
+      CHECK(drain(scan, kind, results, max) == ENTRIES);
+      if (kind == DRAIN_ARRAYS_NO_ID) {
+        // No ids are written
+        for (unsigned i = 0; i < ENTRIES; i++) {
+          CHECK(results[i].id == 0xEE);
+          results[i].id = expected[i].id;
+        }
+      }
+      CHECK(same(results, expected, ENTRIES));
+      CHECK((scan ? IADC_getScanFifoCnt(IADC0) : IADC_getSingleFifoCnt(IADC0)) == 0);
+    }
+  }
+}
+
+/* The raw values the model gives, whatever the alignment */
+static void check_values(void)
+{
+  IADC_Result_t results[ENTRIES];
+
+  init(iadcAlignRight12, true);
+  fill_scan();
+  CHECK(IADC_pullScanFifoResults(IADC0, results, ENTRIES) == ENTRIES);
+  CHECK(results[0].data <= 2);
+  CHECK(results[1].data + 2 >= 1024 && results[1].data <= 1024 + 2);
+  CHECK(results[2].data + 2 >= 2048 && results[2].data <= 2048 + 2);
+  CHECK(results[3].data == 4095);
+  CHECK(results[3].id == 3);
+
+  // Nothing to pull
+  CHECK(IADC_pullScanFifoResults(IADC0, results, ENTRIES) == 0);
+  CHECK(IADC_pullSingleFifoResultArrays(IADC0, &results[0].data, NULL, ENTRIES) == 0);
+  CHECK(!(IADC_getInt(IADC0) & (IADC_IF_SCANFIFOUF | IADC_IF_SINGLEFIFOUF)));
+}
+
+/* One read of the configuration and one of the level per batch */
+static void check_accesses(void)
+{
+  IADC_Result_t results[ENTRIES];
+  sim_stats_t   stats;
+  uint32_t      batch;
+  uint32_t      single = 0;
+
+  init(iadcAlignLeft16, true);
+  fill_scan();
+  sim_stats_clear();
+  CHECK(IADC_pullScanFifoResults(IADC0, results, ENTRIES) == ENTRIES);
+  sim_stats_get(&stats);
+  batch = stats.reads;
+  CHECK(batch == ENTRIES + 2);
+
+  fill_scan();
+  for (unsigned i = 0; i < ENTRIES; i++) {
+    sim_stats_clear();
+    IADC_pullScanFifoResult(IADC0);
+    sim_stats_get(&stats);
+    single += stats.reads;
+  }
+  CHECK(single > batch);
+}
+
+int main(void)
+{
+  sim_init();
+  CMU_ClockEnable(cmuClock_GPIO, true);
+  CMU_ClockEnable(cmuClock_IADC0, true);
+  CMU_ClockSelectSet(cmuClock_IADCCLK, cmuSelect_FSRCO);
+  for (unsigned i = 0; i < ENTRIES; i++) {
+    sim_iadc_input_set(inputs[i], millivolts[i]);
+  }
+
+  check_values();
+  check_accesses();
+  for (unsigned i = 0; i < sizeof(alignments) / sizeof(alignments[0]); i++) {
+    for (unsigned showId = 0; showId < 2; showId++) {
+      check_fifo(true, alignments[i], showId);
+      check_fifo(false, alignments[i], showId);
+    }
+  }
+
+  IADC_reset(IADC0);
+  CMU_ClockEnable(cmuClock_IADC0, false);
+
+  return check_report();
+}
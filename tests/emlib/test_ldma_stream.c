@@ -0,0 +1,216 @@
+/*
+ *  Test of the LDMA ring buffer streams of em_ldma_utils
+ *
+ *  USART0 loops its frames back and the stream reads them from RXDATA, one
+ *  byte per RXDATAV request, into a ring buffer of four segments. Checks
+ *  that the bytes come out in the order they were sent across many turns of
+ *  the ring, that LDMA_StreamPeek() stops at the end of the buffer, that
+ *  partial segments can be read before their interrupt, that the segment
+ *  callback runs once per segment, and that data the LDMA catches up with is
+ *  dropped and counted as an overrun.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "check.h"
+#include "sim.h"
+#include "em_cmu.h"
+#include "em_ldma.h"
+#include "em_ldma_utils.h"
+#include "em_usart.h"
+
+#define STREAM_CHANNEL      2
+#define SEGMENTS            4U
+#define SEGMENT_SIZE        16U
+#define STREAM_SIZE         (SEGMENTS * SEGMENT_SIZE)
+
+/* LDMA buffers and descriptors need addresses below 4 GB */
+static uint8_t             ring[STREAM_SIZE];
+static LDMA_Descriptor_t   descriptors[SEGMENTS];
+static LDMA_Stream_TypeDef stream;
+
+static volatile uint32_t segments_done;
+static uint8_t           next_sent;
+static uint8_t           next_read;
+
+void LDMA_IRQHandler(void)
+{
+  uint32_t pending = LDMA_IntGetEnabled();
+
+  if (!LDMA_StreamIrqHandler(&stream, pending)) {
+    LDMA_IntClear(pending);
+  }
+}
+
+static void segment_done(LDMA_Stream_TypeDef *s, void *arg)
+{
+  CHECK(s == &stream);
+  CHECK(arg == &segments_done);
+  segments_done++;
+}
+
+/* Sends count bytes of the sequence and waits until the last one has been
+   received */
+static void send(unsigned count)
+{
+  for (unsigned i = 0; i < count; i++) {
+    USART_Tx(USART0, next_sent++);
+  }
+  while (!(USART_StatusGet(USART0) & USART_STATUS_TXC)) {
+  }
+}
+
+/* Reads up to length bytes, which must continue the sequence */
+static size_t read_checked(size_t length)
+{
+  uint8_t data[STREAM_SIZE];
+  size_t  count = LDMA_StreamRead(&stream, data, length);
+  bool    ordered = true;
+
+  for (size_t i = 0; i < count; i++) {
+    ordered &= data[i] == next_read++;
+  }
+  CHECK(ordered);
+  return count;
+}
+
+static void start(void)
+{
+  LDMA_TransferCfg_t cfg =
+    LDMA_TRANSFER_CFG_PERIPHERAL(ldmaPeripheralSignal_USART0_RXDATAV);
+
+  memset(ring, 0, sizeof(ring));
+  segments_done = 0;
+  LDMA_StreamStart(&stream, STREAM_CHANNEL, &cfg, &USART0->RXDATA,
+                   ldmaCtrlSizeByte, ring, sizeof(ring), descriptors,
+                   SEGMENTS, segment_done, (void *)&segments_done);
+  next_read = next_sent;
+}
+
+static void test_order(void)
+{
+  start();
+  CHECK(LDMA_StreamAvailable(&stream) == 0);
+
+  // 37 bytes a turn, never on a segment boundary, for 20 turns of the ring
+  for (unsigned turn = 0; turn < 20 * STREAM_SIZE / 37; turn++) {
+    send(37);
+    CHECK(LDMA_StreamAvailable(&stream) == 37);
+    CHECK(read_checked(20) == 20);
+    CHECK(read_checked(sizeof(ring)) == 17);
+    CHECK(LDMA_StreamAvailable(&stream) == 0);
+  }
+  CHECK(segments_done == stream.written / SEGMENT_SIZE);
+  CHECK(stream.consumed == 20 * STREAM_SIZE / 37 * 37);
+  CHECK(stream.overruns == 0);
+  CHECK(stream.lost == 0);
+  LDMA_StreamStop(&stream);
+}
+
+static void test_peek(void)
+{
+  const uint8_t *data;
+  size_t         length;
+
+  start();
+
+  // A partial segment is available before its interrupt
+  send(5);
+  CHECK(segments_done == 0);
+  data = LDMA_StreamPeek(&stream, &length);
+  CHECK(data == ring);
+  CHECK(length == 5);
+  CHECK(data[0] == next_read && data[4] == (uint8_t)(next_read + 4));
+  LDMA_StreamConsume(&stream, length);
+  next_read += 5;
+
+  // Move the read index to 40, then fill past the end of the buffer
+  send(35);
+  CHECK(read_checked(35) == 35);
+  send(40);
+  CHECK(LDMA_StreamAvailable(&stream) == 40);
+  data = LDMA_StreamPeek(&stream, &length);
+  CHECK(data == ring + 40);
+  CHECK(length == STREAM_SIZE - 40);
+  CHECK(data[0] == next_read);
+  LDMA_StreamConsume(&stream, length);
+  next_read += length;
+  data = LDMA_StreamPeek(&stream, &length);
+  CHECK(data == ring);
+  CHECK(length == 40 - (STREAM_SIZE - 40));
+  CHECK(data[0] == next_read);
+  LDMA_StreamConsume(&stream, length);
+  next_read += length;
+  CHECK(LDMA_StreamAvailable(&stream) == 0);
+  LDMA_StreamStop(&stream);
+}
+
+static void test_overrun(void)
+{
+  uint32_t produced;
+
+  start();
+
+  // The segment being written is lost to the reader: three segments of
+  // unread data fit, one more byte is an overrun
+  send(STREAM_SIZE - SEGMENT_SIZE);
+  CHECK(LDMA_StreamAvailable(&stream) == STREAM_SIZE - SEGMENT_SIZE);
+  CHECK(stream.overruns == 0);
+  send(1);
+  CHECK(LDMA_StreamAvailable(&stream) == 0);
+  CHECK(stream.overruns == 1);
+  CHECK(stream.lost == STREAM_SIZE - SEGMENT_SIZE + 1);
+  next_read += STREAM_SIZE - SEGMENT_SIZE + 1;
+
+  // Reading resumes with the data sent after the overrun
+  send(30);
+  CHECK(read_checked(sizeof(ring)) == 30);
+
+  // Lapping the reader several times is one overrun
+  produced = stream.written;
+  send(3 * STREAM_SIZE + 7);
+  CHECK(stream.written - produced >= 3 * STREAM_SIZE);
+  CHECK(LDMA_StreamAvailable(&stream) == 0);
+  CHECK(stream.overruns == 2);
+  CHECK(stream.lost == STREAM_SIZE - SEGMENT_SIZE + 1 + 3 * STREAM_SIZE + 7);
+  next_read += 3 * STREAM_SIZE + 7;
+  send(9);
+  CHECK(read_checked(sizeof(ring)) == 9);
+  CHECK(stream.consumed == stream.lost + 30 + 9);
+
+  // Data received before the stop can still be read, none after it
+  send(12);
+  LDMA_StreamStop(&stream);
+  send(4);
+  next_sent -= 4;
+  CHECK(read_checked(sizeof(ring)) == 12);
+}
+
+int main(void)
+{
+  USART_InitAsync_TypeDef init = USART_INITASYNC_DEFAULT;
+  LDMA_Init_t             ldma = LDMA_INIT_DEFAULT;
+
+  sim_init();
+  CMU_ClockEnable(cmuClock_GPIO, true);
+  CMU_ClockEnable(cmuClock_USART0, true);
+  CMU_ClockEnable(cmuClock_LDMA, true);
+  CMU_ClockEnable(cmuClock_LDMAXBAR, true);
+
+  init.baudrate = 1000000;
+  init.enable   = usartDisable;
+  USART_InitAsync(USART0, &init);
+  USART0->CTRL_SET = USART_CTRL_LOOPBK;
+  USART_Enable(USART0, usartEnable);
+  LDMA_Init(&ldma);
+
+  test_order();
+  test_peek();
+  test_overrun();
+
+  LDMA_DeInit();
+  USART_Reset(USART0);
+
+  return check_report();
+}
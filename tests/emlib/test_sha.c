@@ -0,0 +1,232 @@
+/*
+ *  Test of the incremental SHA-1 and SHA-256 of em_crypto and em_sha_utils
+ *
+ *  Checks CRYPTO_SHA_Init(), CRYPTO_SHA_Update() and CRYPTO_SHA_Final() on
+ *  the CRYPTO model, and SHA_Init(), SHA_Update() and SHA_Final() in
+ *  software, against the FIPS 180 examples, then against the one-shot
+ *  CRYPTO_SHA_1() and CRYPTO_SHA_256() for every message length past two
+ *  blocks cut in chunks of several sizes. Two hashes interleaved with each
+ *  other and with one-shot hashes on the same CRYPTO must not disturb each
+ *  other.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "check.h"
+#include "sim.h"
+#include "em_cmu.h"
+#include "em_crypto.h"
+#include "em_sha_utils.h"
+
+#define BLOCK_SIZE          64U
+#define MESSAGE_SIZE        (2U * BLOCK_SIZE + 9U)
+#define MILLION             1000000U
+
+typedef struct {
+  const char    *message;
+  uint32_t       repeat;
+  const uint8_t *sha1;
+  const uint8_t *sha256;
+} known_answer_t;
+
+static const uint8_t empty_sha1[20] = {
+  0xda, 0x39, 0xa3, 0xee, 0x5e, 0x6b, 0x4b, 0x0d, 0x32, 0x55, 0xbf, 0xef,
+  0x95, 0x60, 0x18, 0x90, 0xaf, 0xd8, 0x07, 0x09
+};
+static const uint8_t empty_sha256[32] = {
+  0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14, 0x9a, 0xfb, 0xf4, 0xc8,
+  0x99, 0x6f, 0xb9, 0x24, 0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c,
+  0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55
+};
+static const uint8_t abc_sha1[20] = {
+  0xa9, 0x99, 0x3e, 0x36, 0x47, 0x06, 0x81, 0x6a, 0xba, 0x3e, 0x25, 0x71,
+  0x78, 0x50, 0xc2, 0x6c, 0x9c, 0xd0, 0xd8, 0x9d
+};
+static const uint8_t abc_sha256[32] = {
+  0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde,
+  0x5d, 0xae, 0x22, 0x23, 0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c,
+  0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad
+};
+static const uint8_t two_blocks_sha1[20] = {
+  0x84, 0x98, 0x3e, 0x44, 0x1c, 0x3b, 0xd2, 0x6e, 0xba, 0xae, 0x4a, 0xa1,
+  0xf9, 0x51, 0x29, 0xe5, 0xe5, 0x46, 0x70, 0xf1
+};
+static const uint8_t two_blocks_sha256[32] = {
+  0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8, 0xe5, 0xc0, 0x26, 0x93,
+  0x0c, 0x3e, 0x60, 0x39, 0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67,
+  0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1
+};
+static const uint8_t million_sha1[20] = {
+  0x34, 0xaa, 0x97, 0x3c, 0xd4, 0xc4, 0xda, 0xa4, 0xf6, 0x1e, 0xeb, 0x2b,
+  0xdb, 0xad, 0x27, 0x31, 0x65, 0x34, 0x01, 0x6f
+};
+static const uint8_t million_sha256[32] = {
+  0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92, 0x81, 0xa1, 0xc7, 0xe2,
+  0x84, 0xd7, 0x3e, 0x67, 0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e,
+  0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0
+};
+
+/* Messages repeated to reach their length are hashed in chunks of the
+   repeated part. The million bytes take too long on the CRYPTO model and
+   are hashed in software only. */
+static const known_answer_t known_answers[] = {
+  { "", 1, empty_sha1, empty_sha256 },
+  { "abc", 1, abc_sha1, abc_sha256 },
+  { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1,
+    two_blocks_sha1, two_blocks_sha256 },
+  { "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+    "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+    MILLION / 125, million_sha1, million_sha256 },
+};
+
+// Chunk sizes the messages are cut in, 0 standing for the whole message
+static const uint32_t chunk_sizes[] = { 0, 1, 3, 55, 63, 64, 65, 130 };
+
+static uint8_t message[MESSAGE_SIZE];
+// The message again, at an odd address
+static uint8_t unaligned[MESSAGE_SIZE + 1];
+
+static void crypto_hash(CRYPTO_ShaMode_TypeDef mode, const uint8_t *msg,
+                        uint32_t length, uint32_t chunk, uint8_t *digest)
+{
+  CRYPTO_SHA_Context_TypeDef ctx;
+
+  CRYPTO_SHA_Init(&ctx, CRYPTO, mode);
+  for (uint32_t done = 0; done < length;) {
+    uint32_t count = (chunk == 0 || chunk > length - done) ? length - done : chunk;
+
+    CRYPTO_SHA_Update(&ctx, msg + done, count);
+    done += count;
+  }
+  CRYPTO_SHA_Final(&ctx, digest);
+}
+
+static void soft_hash(SHA_Mode_TypeDef mode, const uint8_t *msg,
+                      uint32_t length, uint32_t chunk, uint8_t *digest)
+{
+  SHA_Context_TypeDef ctx;
+
+  SHA_Init(&ctx, mode);
+  for (uint32_t done = 0; done < length;) {
+    uint32_t count = (chunk == 0 || chunk > length - done) ? length - done : chunk;
+
+    SHA_Update(&ctx, msg + done, count);
+    done += count;
+  }
+  SHA_Final(&ctx, digest);
+}
+
+static void test_known_answers(void)
+{
+  for (unsigned i = 0; i < sizeof(known_answers) / sizeof(known_answers[0]); i++) {
+    const known_answer_t      *answer = &known_answers[i];
+    const uint8_t             *msg    = (const uint8_t *)answer->message;
+    uint32_t                   length = (uint32_t)strlen(answer->message);
+    CRYPTO_SHA_Context_TypeDef crypto_ctx[2];
+    SHA_Context_TypeDef        soft_ctx[2];
+    uint8_t                    digest[4][32];
+
+    CRYPTO_SHA_Init(&crypto_ctx[0], CRYPTO, cryptoShaSha1);
+    CRYPTO_SHA_Init(&crypto_ctx[1], CRYPTO, cryptoShaSha256);
+    SHA_Init(&soft_ctx[0], shaModeSha1);
+    SHA_Init(&soft_ctx[1], shaModeSha256);
+    for (uint32_t n = 0; n < answer->repeat; n++) {
+      if (answer->repeat == 1) {
+        CRYPTO_SHA_Update(&crypto_ctx[0], msg, length);
+        CRYPTO_SHA_Update(&crypto_ctx[1], msg, length);
+      }
+      SHA_Update(&soft_ctx[0], msg, length);
+      SHA_Update(&soft_ctx[1], msg, length);
+    }
+    CRYPTO_SHA_Final(&crypto_ctx[0], digest[0]);
+    CRYPTO_SHA_Final(&crypto_ctx[1], digest[1]);
+    SHA_Final(&soft_ctx[0], digest[2]);
+    SHA_Final(&soft_ctx[1], digest[3]);
+
+    if (answer->repeat == 1) {
+      CHECK(memcmp(digest[0], answer->sha1, 20) == 0);
+      CHECK(memcmp(digest[1], answer->sha256, 32) == 0);
+    }
+    CHECK(memcmp(digest[2], answer->sha1, 20) == 0);
+    CHECK(memcmp(digest[3], answer->sha256, 32) == 0);
+  }
+}
+
+/* Every length past two blocks, in every chunk size, aligned or not */
+static void test_lengths(void)
+{
+  unsigned mismatches = 0;
+
+  for (uint32_t i = 0; i < MESSAGE_SIZE; i++) {
+    message[i] = (uint8_t)(i * 167U + 13U);
+  }
+  memcpy(unaligned + 1, message, MESSAGE_SIZE);
+
+  for (uint32_t length = 0; length <= MESSAGE_SIZE; length++) {
+    CRYPTO_SHA1_Digest_TypeDef   sha1;
+    CRYPTO_SHA256_Digest_TypeDef sha256;
+    uint8_t                      digest[32];
+
+    CRYPTO_SHA_1(CRYPTO, message, length, sha1);
+    CRYPTO_SHA_256(CRYPTO, message, length, sha256);
+    for (unsigned c = 0; c < sizeof(chunk_sizes) / sizeof(chunk_sizes[0]); c++) {
+      const uint8_t *msg = (c & 1U) ? unaligned + 1 : message;
+
+      crypto_hash(cryptoShaSha1, msg, length, chunk_sizes[c], digest);
+      mismatches += memcmp(digest, sha1, sizeof(sha1)) != 0;
+      crypto_hash(cryptoShaSha256, msg, length, chunk_sizes[c], digest);
+      mismatches += memcmp(digest, sha256, sizeof(sha256)) != 0;
+      soft_hash(shaModeSha1, msg, length, chunk_sizes[c], digest);
+      mismatches += memcmp(digest, sha1, sizeof(sha1)) != 0;
+      soft_hash(shaModeSha256, msg, length, chunk_sizes[c], digest);
+      mismatches += memcmp(digest, sha256, sizeof(sha256)) != 0;
+    }
+  }
+  CHECK(mismatches == 0);
+}
+
+/* The CRYPTO state of a context is saved between calls */
+static void test_interleaved(void)
+{
+  CRYPTO_SHA_Context_TypeDef   first;
+  CRYPTO_SHA_Context_TypeDef   second;
+  CRYPTO_SHA1_Digest_TypeDef   sha1;
+  CRYPTO_SHA256_Digest_TypeDef sha256;
+  uint8_t                      digest[32];
+
+  CRYPTO_SHA_Init(&first, CRYPTO, cryptoShaSha256);
+  CRYPTO_SHA_Init(&second, CRYPTO, cryptoShaSha1);
+  for (uint32_t done = 0; done < MESSAGE_SIZE; done += 100) {
+    uint32_t count = (MESSAGE_SIZE - done < 100) ? MESSAGE_SIZE - done : 100;
+
+    CRYPTO_SHA_Update(&first, message + done, count);
+    CRYPTO_SHA_1(CRYPTO, (const uint8_t *)"abc", 3, sha1);
+    CRYPTO_SHA_Update(&second, message + done, count);
+    CRYPTO_SHA_256(CRYPTO, (const uint8_t *)"abc", 3, sha256);
+  }
+  CHECK(memcmp(sha1, abc_sha1, sizeof(sha1)) == 0);
+  CHECK(memcmp(sha256, abc_sha256, sizeof(sha256)) == 0);
+
+  CRYPTO_SHA_Final(&first, digest);
+  CRYPTO_SHA_256(CRYPTO, message, MESSAGE_SIZE, sha256);
+  CHECK(memcmp(digest, sha256, sizeof(sha256)) == 0);
+  CRYPTO_SHA_Final(&second, digest);
+  CRYPTO_SHA_1(CRYPTO, message, MESSAGE_SIZE, sha1);
+  CHECK(memcmp(digest, sha1, sizeof(sha1)) == 0);
+}
+
+int main(void)
+{
+  sim_init();
+  CMU_ClockEnable(cmuClock_GPIO, true);
+  CMU_ClockEnable(cmuClock_CRYPTOACC, true);
+
+  test_known_answers();
+  test_lengths();
+  test_interleaved();
+
+  CMU_ClockEnable(cmuClock_CRYPTOACC, false);
+
+  return check_report();
+}
@@ -0,0 +1,372 @@
+/*
+ *  Test of the buffer transfers of em_usart_utils and em_eusart_utils
+ *
+ *  USART0 sends to USART1 and USART1 back to USART0, both asynchronous, to
+ *  check USART_TxBuffer() and USART_RxBuffer() against an LDMA transfer on
+ *  the other side, with TXDOUBLE and RXDOUBLE in use and, with TXBIL
+ *  HALFFULL and nine data bits, not. USART0 then loops its frames back as a
+ *  synchronous master for USART_SpiTransferBuffer() and its asynchronous
+ *  version, with and without data to send and a buffer to receive into; in
+ *  SPI mode only the RX channel may signal completion, after the last frame
+ *  has been received. EUART0 loops its frames back for the EUSART
+ *  functions.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "check.h"
+#include "sim.h"
+#include "em_cmu.h"
+#include "em_eusart.h"
+#include "em_eusart_utils.h"
+#include "em_ldma.h"
+#include "em_usart.h"
+#include "em_usart_utils.h"
+
+// Odd, to leave a single frame after the TXDOUBLE and RXDOUBLE pairs
+#define LENGTH              33U
+
+#define SPI_TX_CHANNEL      0
+#define SPI_RX_CHANNEL      1
+#define PEER_TX_CHANNEL     2
+#define PEER_RX_CHANNEL     3
+#define EUSART_TX_CHANNEL   4
+#define EUSART_RX_CHANNEL   5
+
+typedef struct {
+  uint32_t calls;
+  uint32_t frames;    // Frames sent when the callback ran
+} done_t;
+
+/* LDMA buffers and descriptors need addresses below 4 GB */
+static uint8_t                 tx[LENGTH];
+static uint8_t                 rx[LENGTH];
+static USART_Transfer_TypeDef  spi;
+static USART_Transfer_TypeDef  peer;
+static EUSART_Transfer_TypeDef eusart_tx;
+static EUSART_Transfer_TypeDef eusart_rx;
+
+static volatile uint32_t ldma_pending;
+static sim_event_t       busy_event;
+
+// Interrupt keeping the CPU away from a transfer for several frames
+#define BUSY_IRQ            GPIO_ODD_IRQn
+#define BUSY_NS             50000U
+
+void GPIO_ODD_IRQHandler(void)
+{
+  sim_irq_line(BUSY_IRQ, false);
+  sim_time_advance(BUSY_NS);
+}
+
+static void busy_raise(sim_event_t *event)
+{
+  (void)event;
+  sim_irq_line(BUSY_IRQ, true);
+}
+
+void LDMA_IRQHandler(void)
+{
+  uint32_t pending = LDMA_IntGetEnabled();
+
+  ldma_pending |= pending;
+  if (!USART_TransferIrqHandler(&spi, pending)
+      && !USART_TransferIrqHandler(&peer, pending)
+      && !EUSART_TransferIrqHandler(&eusart_tx, pending)
+      && !EUSART_TransferIrqHandler(&eusart_rx, pending)) {
+    LDMA_IntClear(pending);
+  }
+}
+
+static void usart_done(USART_Transfer_TypeDef *transfer, void *arg)
+{
+  done_t *done = arg;
+
+  done->calls++;
+  done->frames = sim_usart_frames_sent(transfer->usart);
+}
+
+static void eusart_done(EUSART_Transfer_TypeDef *transfer, void *arg)
+{
+  done_t *done = arg;
+
+  done->calls++;
+  done->frames = sim_eusart_frames_sent(transfer->eusart);
+}
+
+static void wait_done(const volatile done_t *done)
+{
+  while (done->calls == 0) {
+    __WFI();
+  }
+}
+
+static void buffers_fill(uint8_t first)
+{
+  for (unsigned i = 0; i < LENGTH; i++) {
+    tx[i] = (uint8_t)(first + 7 * i);
+  }
+  memset(rx, 0, sizeof(rx));
+}
+
+static bool all_equal(const uint8_t *data, uint8_t value)
+{
+  for (unsigned i = 0; i < LENGTH; i++) {
+    if (data[i] != value) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void usart_async_init(USART_TypeDef *usart, bool nine_bits)
+{
+  USART_InitAsync_TypeDef init = USART_INITASYNC_DEFAULT;
+
+  init.baudrate = 1000000;
+  init.databits = nine_bits ? usartDatabits9 : usartDatabits8;
+  USART_InitAsync(usart, &init);
+}
+
+/* USART_TxBuffer() on USART0, received by USART1 through the LDMA */
+static void test_tx_buffer(bool double_access)
+{
+  volatile done_t done   = { 0 };
+  uint32_t        frames = sim_usart_frames_sent(USART0);
+  sim_stats_t     stats;
+
+  buffers_fill(double_access ? 0x10 : 0x80);
+  usart_async_init(USART0, false);
+  usart_async_init(USART1, false);
+  if (!double_access) {
+    USART0->CTRL_SET = USART_CTRL_TXBIL_HALFFULL;
+  }
+  sim_usart_connect(USART0, USART1);
+
+  USART_RxBufferAsync(&peer, rx, LENGTH, usart_done, (void *)&done);
+  sim_stats_clear();
+  USART_TxBuffer(USART0, tx, LENGTH);
+  sim_stats_get(&stats);
+  wait_done(&done);
+
+  // One TXDOUBLE write per pair, then TXDATA for the last frame
+  CHECK(stats.writes == (double_access ? LENGTH / 2 + 1 : LENGTH));
+  CHECK(memcmp(tx, rx, LENGTH) == 0);
+  CHECK(sim_usart_frames_sent(USART0) - frames == LENGTH);
+  CHECK(!(USART_IntGet(USART0) & USART_IF_TXOF));
+  CHECK(!(USART_IntGet(USART1) & USART_IF_RXOF));
+  CHECK(done.calls == 1);
+  CHECK(ldma_pending & (1U << PEER_RX_CHANNEL));
+
+  sim_usart_connect(USART0, NULL);
+  ldma_pending = 0;
+}
+
+/* USART_RxBuffer() on USART0, sent by USART1 through the LDMA. Eight data
+   bits allow RXDOUBLE, nine do not. */
+static void test_rx_buffer(bool double_access)
+{
+  volatile done_t done = { 0 };
+  sim_stats_t     stats;
+
+  buffers_fill(double_access ? 0x20 : 0x90);
+  usart_async_init(USART0, !double_access);
+  usart_async_init(USART1, !double_access);
+  sim_usart_connect(USART1, USART0);
+
+  USART_TxBufferAsync(&peer, tx, LENGTH, usart_done, (void *)&done);
+
+  // A full receive FIFO is read with FRAME, STATUS and one RXDOUBLE access,
+  // or FRAME and STATUS and RXDATA twice
+  while (!(USART_StatusGet(USART0) & USART_STATUS_RXFULL)) {
+  }
+  sim_stats_clear();
+  USART_RxBuffer(USART0, rx, 2);
+  sim_stats_get(&stats);
+  CHECK(stats.reads == (double_access ? 3 : 5));
+
+  USART_RxBuffer(USART0, rx + 2, LENGTH - 2);
+  wait_done(&done);
+  CHECK(memcmp(tx, rx, LENGTH) == 0);
+  CHECK(!(USART_IntGet(USART0) & (USART_IF_RXOF | USART_IF_RXUF)));
+  CHECK(done.calls == 1);
+  CHECK(ldma_pending & (1U << PEER_TX_CHANNEL));
+
+  sim_usart_connect(USART1, NULL);
+  ldma_pending = 0;
+}
+
+static void spi_init(void)
+{
+  USART_InitSync_TypeDef init = USART_INITSYNC_DEFAULT;
+
+  init.enable = usartDisable;
+  USART_InitSync(USART0, &init);
+  USART0->CTRL_SET = USART_CTRL_LOOPBK;
+  USART_Enable(USART0, usartEnable);
+}
+
+static void test_spi(void)
+{
+  uint32_t frames;
+
+  spi_init();
+
+  buffers_fill(0x30);
+  frames = sim_usart_frames_sent(USART0);
+  USART_SpiTransferBuffer(USART0, tx, rx, LENGTH);
+  CHECK(memcmp(tx, rx, LENGTH) == 0);
+  CHECK(sim_usart_frames_sent(USART0) - frames == LENGTH);
+
+  // Without data to send, dummy frames are clocked out
+  buffers_fill(0x40);
+  frames = sim_usart_frames_sent(USART0);
+  USART_SpiTransferBuffer(USART0, NULL, rx, LENGTH);
+  CHECK(all_equal(rx, USART_SPI_DUMMY_FRAME));
+  CHECK(sim_usart_frames_sent(USART0) - frames == LENGTH);
+
+  // Without a buffer, every frame received is still read
+  buffers_fill(0x50);
+  frames = sim_usart_frames_sent(USART0);
+  USART_SpiTransferBuffer(USART0, tx, NULL, LENGTH);
+  CHECK(sim_usart_frames_sent(USART0) - frames == LENGTH);
+  CHECK(!(USART_StatusGet(USART0) & USART_STATUS_RXDATAV));
+  CHECK(all_equal(rx, 0));
+
+  // An interrupt in the middle of a transfer leaves at most two frames to
+  // receive, which the receive FIFO holds, even with TXBIL HALFFULL letting
+  // the transmit buffer take another
+  buffers_fill(0x58);
+  USART0->CTRL_SET = USART_CTRL_TXBIL_HALFFULL;
+  sim_event_schedule(&busy_event, 100000U);
+  USART_SpiTransferBuffer(USART0, tx, rx, LENGTH);
+  CHECK(sim_irq_count(BUSY_IRQ) == 1);
+  CHECK(memcmp(tx, rx, LENGTH) == 0);
+  USART0->CTRL_CLR = USART_CTRL_TXBIL_HALFFULL;
+
+  CHECK(!(USART_IntGet(USART0) & (USART_IF_RXOF | USART_IF_RXUF | USART_IF_TXOF)));
+}
+
+/* An asynchronous SPI transfer, which must complete with the RX channel once
+   all the frames have been sent and received */
+static void spi_async(const uint8_t *tx_data, uint8_t *rx_data)
+{
+  volatile done_t done   = { 0 };
+  uint32_t        frames = sim_usart_frames_sent(USART0);
+
+  ldma_pending = 0;
+  USART_SpiTransferBufferAsync(&spi, tx_data, rx_data, LENGTH, usart_done,
+                               (void *)&done);
+  wait_done(&done);
+  CHECK(done.calls == 1);
+  CHECK(done.frames - frames == LENGTH);
+  CHECK(ldma_pending & (1U << SPI_RX_CHANNEL));
+  CHECK(!(ldma_pending & (1U << SPI_TX_CHANNEL)));
+  CHECK(!(LDMA_IntGet() & (1U << SPI_TX_CHANNEL)));
+  CHECK(!spi.busy);
+}
+
+static void test_spi_async(void)
+{
+  spi_init();
+
+  buffers_fill(0x60);
+  spi_async(tx, rx);
+  CHECK(memcmp(tx, rx, LENGTH) == 0);
+
+  buffers_fill(0x70);
+  spi_async(NULL, rx);
+  CHECK(all_equal(rx, USART_SPI_DUMMY_FRAME));
+
+  buffers_fill(0x80);
+  spi_async(tx, NULL);
+  CHECK(all_equal(rx, 0));
+  CHECK(!(USART_StatusGet(USART0) & USART_STATUS_RXDATAV));
+
+  CHECK(!(USART_IntGet(USART0) & (USART_IF_RXOF | USART_IF_RXUF | USART_IF_TXOF)));
+  USART_Reset(USART0);
+  ldma_pending = 0;
+}
+
+static void test_eusart(void)
+{
+  EUSART_UartInit_TypeDef init   = EUSART_UART_INIT_DEFAULT_HF;
+  volatile done_t         done   = { 0 };
+  uint32_t                frames = sim_eusart_frames_sent(EUART0);
+  sim_stats_t             stats;
+
+  init.loopbackEnable = eusartLoopbackEnable;
+  EUSART_UartInitHf(EUART0, &init);
+
+  // Blocking send, received through the LDMA
+  buffers_fill(0xA0);
+  EUSART_RxBufferAsync(&eusart_rx, rx, LENGTH, eusart_done, (void *)&done);
+  sim_stats_clear();
+  EUSART_TxBuffer(EUART0, tx, LENGTH);
+  sim_stats_get(&stats);
+  wait_done(&done);
+  CHECK(stats.writes == LENGTH);
+  CHECK(memcmp(tx, rx, LENGTH) == 0);
+  CHECK(done.calls == 1);
+  CHECK(done.frames - frames == LENGTH);
+  CHECK(ldma_pending & (1U << EUSART_RX_CHANNEL));
+  CHECK(!eusart_rx.busy);
+
+  // Sent through the LDMA, blocking receive. The send completes once the
+  // last frame is in the TX FIFO, before it has been received.
+  buffers_fill(0xB0);
+  frames       = sim_eusart_frames_sent(EUART0);
+  done.calls   = 0;
+  ldma_pending = 0;
+  EUSART_TxBufferAsync(&eusart_tx, tx, LENGTH, eusart_done, (void *)&done);
+  EUSART_RxBuffer(EUART0, rx, LENGTH);
+  CHECK(memcmp(tx, rx, LENGTH) == 0);
+  CHECK(done.calls == 1);
+  CHECK(done.frames - frames < LENGTH);
+  CHECK(ldma_pending & (1U << EUSART_TX_CHANNEL));
+  CHECK(!eusart_tx.busy);
+
+  CHECK(!(EUSART_IntGet(EUART0) & (EUSART_IF_RXOF | EUSART_IF_RXUF | EUSART_IF_TXOF)));
+  EUSART_Reset(EUART0);
+  ldma_pending = 0;
+}
+
+int main(void)
+{
+  LDMA_Init_t ldma = LDMA_INIT_DEFAULT;
+
+  sim_init();
+  // A lost frame leaves a blocking transfer polling, stop it well before the
+  // default limit
+  sim_time_limit_set(sim_time() + 20000000U);
+  CMU_ClockEnable(cmuClock_GPIO, true);
+  CMU_ClockEnable(cmuClock_USART0, true);
+  CMU_ClockEnable(cmuClock_USART1, true);
+  CMU_ClockEnable(cmuClock_EUART0, true);
+  CMU_ClockEnable(cmuClock_LDMA, true);
+  CMU_ClockEnable(cmuClock_LDMAXBAR, true);
+  LDMA_Init(&ldma);
+
+  sim_event_init(&busy_event, busy_raise, NULL);
+  NVIC_EnableIRQ(BUSY_IRQ);
+
+  USART_TransferInit(&spi, USART0, SPI_TX_CHANNEL, SPI_RX_CHANNEL);
+  USART_TransferInit(&peer, USART1, PEER_TX_CHANNEL, PEER_RX_CHANNEL);
+  EUSART_TransferInit(&eusart_tx, EUART0, EUSART_TX_CHANNEL);
+  EUSART_TransferInit(&eusart_rx, EUART0, EUSART_RX_CHANNEL);
+
+  test_tx_buffer(true);
+  test_tx_buffer(false);
+  test_rx_buffer(true);
+  test_rx_buffer(false);
+  test_spi();
+  test_spi_async();
+  test_eusart();
+
+  LDMA_DeInit();
+  USART_Reset(USART0);
+  USART_Reset(USART1);
+
+  return check_report();
+}
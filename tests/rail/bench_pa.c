@@ -0,0 +1,135 @@
+/*
+ *  Host time of the PA conversions on the curves and with the lookup tables
+ *
+ *  Usage: bench_pa_<family> [iterations]
+ *
+ *  With the battery curves loaded, each PA converts deci-dBm values sweeping
+ *  its range plus 5 dB on either side, and every power level, in both
+ *  builds. The table build pays its setup once in
+ *  RAIL_InitTxPowerCurvesAlt(), which is timed as well.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "pa_host.h"
+
+// Deci-dBm swept beyond each end of the PA range
+#define SWEEP_MARGIN    50
+// Inputs cycled through, a power of two so that the loop only masks
+#define SWEEP_VALUES    4096U
+
+static unsigned long iterations = 1000000;
+static volatile uint32_t sink;
+static RAIL_TxPower_t sweep[SWEEP_VALUES];
+
+static const char *const modeNames[] = RAIL_TX_POWER_MODE_NAMES;
+
+static double now_s(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static void report(const char *mode, const char *name, double curve,
+                   double table, unsigned long calls)
+{
+  printf("%-28s %-10s %8.1f %8.1f ns/call %5.1fx\n", mode, name,
+         curve * 1e9 / calls, table * 1e9 / calls, curve / table);
+}
+
+static double time_dbm_to_raw(RAIL_TxPowerLevel_t (*convert)(RAIL_Handle_t,
+                                                             RAIL_TxPowerMode_t,
+                                                             RAIL_TxPower_t),
+                              RAIL_TxPowerMode_t mode)
+{
+  double start = now_s();
+
+  for (unsigned long i = 0; i < iterations; i++) {
+    sink += convert(NULL, mode, sweep[i & (SWEEP_VALUES - 1U)]);
+  }
+  return now_s() - start;
+}
+
+static double time_raw_to_dbm(RAIL_TxPower_t (*convert)(RAIL_Handle_t,
+                                                        RAIL_TxPowerMode_t,
+                                                        RAIL_TxPowerLevel_t),
+                              RAIL_TxPowerMode_t mode)
+{
+  double start = now_s();
+
+  for (unsigned long i = 0; i < iterations; i++) {
+    sink += convert(NULL, mode, (RAIL_TxPowerLevel_t)i);
+  }
+  return now_s() - start;
+}
+
+static void bench_mode(RAIL_TxPowerMode_t mode, RAIL_PaDescriptor_t const *pa)
+{
+  int32_t min;
+  int32_t max;
+
+  if (pa->algorithm == RAIL_PA_ALGORITHM_MAPPING_TABLE) {
+    min = pa->conversion.mappingTable[0];
+    max = pa->conversion.mappingTable[pa->max - pa->min];
+  } else if (pa->conversion.powerCurve != NULL) {
+    min = pa->conversion.powerCurve->minPower;
+    max = pa->conversion.powerCurve->maxPower;
+  } else {
+    return;
+  }
+  min -= SWEEP_MARGIN;
+  max += SWEEP_MARGIN;
+  for (uint32_t i = 0; i < SWEEP_VALUES; i++) {
+    sweep[i] = (RAIL_TxPower_t)(min + (int32_t)(i % (uint32_t)(max - min + 1)));
+  }
+
+  report(modeNames[mode], "dBm to raw",
+         time_dbm_to_raw(curve_ConvertDbmToRaw, mode),
+         time_dbm_to_raw(table_ConvertDbmToRaw, mode),
+         iterations);
+  report(modeNames[mode], "raw to dBm",
+         time_raw_to_dbm(curve_ConvertRawToDbm, mode),
+         time_raw_to_dbm(table_ConvertRawToDbm, mode),
+         iterations);
+}
+
+static void bench_init(RAIL_TxPowerCurvesConfigAlt_t const *curves)
+{
+  unsigned long calls = iterations / 10000;
+  double        curve;
+  double        start;
+
+  start = now_s();
+  for (unsigned long i = 0; i < calls; i++) {
+    sink += curve_InitTxPowerCurvesAlt(curves);
+  }
+  curve = now_s() - start;
+  start = now_s();
+  for (unsigned long i = 0; i < calls; i++) {
+    sink += table_InitTxPowerCurvesAlt(curves);
+  }
+  printf("%-28s %-10s %8.1f %8.1f us/call\n", "RAIL_InitTxPowerCurvesAlt",
+         "", curve * 1e6 / calls, (now_s() - start) * 1e6 / calls);
+}
+
+int main(int argc, char **argv)
+{
+  if (argc > 1) {
+    iterations = strtoul(argv[1], NULL, 0);
+  }
+  if (iterations < 10000) {
+    fprintf(stderr, "usage: %s [iterations, at least 10000]\n", argv[0]);
+    return 2;
+  }
+
+  printf("%-28s %-10s %8s %8s\n", "", "", "curve", "table");
+  bench_init(&RAIL_TxPowerCurvesVbat);
+  for (RAIL_TxPowerMode_t mode = 0; mode < RAIL_NUM_PA; mode++) {
+    bench_mode(mode, &RAIL_TxPowerCurvesVbat.curves[mode]);
+  }
+  return 0;
+}
@@ -0,0 +1,42 @@
+/*
+ *  Host stand-in for the device header: the part family macros the RAIL
+ *  headers and the PA curves select on, for the family named by one of
+ *  PA_HOST_EFR32XG1X, PA_HOST_EFR32XG21 or PA_HOST_EFR32XG22
+ */
+
+#ifndef EM_DEVICE_H
+#define EM_DEVICE_H
+
+#include <stdint.h>
+
+// What CMSIS provides on the target, for em_common.h
+#define __STATIC_INLINE                      static inline
+#define __CORTEX_M                           0U
+
+#define _SILICON_LABS_EFR32_RADIO_SUBGHZ     1
+#define _SILICON_LABS_EFR32_RADIO_2G4HZ      2
+#define _SILICON_LABS_EFR32_RADIO_DUALBAND   3
+
+#if defined(PA_HOST_EFR32XG1X)
+#define _SILICON_LABS_32B_SERIES             1
+#define _SILICON_LABS_32B_SERIES_1
+#define _SILICON_LABS_32B_SERIES_1_CONFIG    2
+#define _SILICON_LABS_32B_SERIES_1_CONFIG_2
+#define _SILICON_LABS_EFR32_RADIO_TYPE       _SILICON_LABS_EFR32_RADIO_DUALBAND
+#elif defined(PA_HOST_EFR32XG21)
+#define _SILICON_LABS_32B_SERIES             2
+#define _SILICON_LABS_32B_SERIES_2
+#define _SILICON_LABS_32B_SERIES_2_CONFIG    1
+#define _SILICON_LABS_32B_SERIES_2_CONFIG_1
+#define _SILICON_LABS_EFR32_RADIO_TYPE       _SILICON_LABS_EFR32_RADIO_2G4HZ
+#elif defined(PA_HOST_EFR32XG22)
+#define _SILICON_LABS_32B_SERIES             2
+#define _SILICON_LABS_32B_SERIES_2
+#define _SILICON_LABS_32B_SERIES_2_CONFIG    2
+#define _SILICON_LABS_32B_SERIES_2_CONFIG_2
+#define _SILICON_LABS_EFR32_RADIO_TYPE       _SILICON_LABS_EFR32_RADIO_2G4HZ
+#else
+#error "Define the PA_HOST_* family to build"
+#endif
+
+#endif
@@ -0,0 +1 @@
+/* Host stand-in: the PA conversions use no GPIO */
@@ -0,0 +1,11 @@
+/*
+ *  pa_conversions_efr32.c as shipped, converting on the curves
+ */
+
+#define RAIL_GetTxPowerCurve        curve_GetTxPowerCurve
+#define RAIL_InitTxPowerCurves      curve_InitTxPowerCurves
+#define RAIL_InitTxPowerCurvesAlt   curve_InitTxPowerCurvesAlt
+#define RAIL_ConvertDbmToRaw        curve_ConvertDbmToRaw
+#define RAIL_ConvertRawToDbm        curve_ConvertRawToDbm
+
+#include "pa_conversions_efr32.c"
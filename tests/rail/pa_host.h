@@ -0,0 +1,34 @@
+/*
+ *  pa_conversions_efr32.c is built twice into each program, as shipped and
+ *  with RAIL_PA_CONVERSIONS_LOOKUP_TABLES, its public functions renamed to
+ *  curve_* and table_* respectively (pa_curve.c, pa_table.c)
+ */
+
+#ifndef PA_HOST_H
+#define PA_HOST_H
+
+#include "pa_conversions_efr32.h"
+#include "rail.h"
+
+RAIL_Status_t curve_InitTxPowerCurves(const RAIL_TxPowerCurvesConfig_t *config);
+RAIL_Status_t curve_InitTxPowerCurvesAlt(const RAIL_TxPowerCurvesConfigAlt_t *config);
+RAIL_TxPowerLevel_t curve_ConvertDbmToRaw(RAIL_Handle_t railHandle,
+                                          RAIL_TxPowerMode_t mode,
+                                          RAIL_TxPower_t power);
+RAIL_TxPower_t curve_ConvertRawToDbm(RAIL_Handle_t railHandle,
+                                     RAIL_TxPowerMode_t mode,
+                                     RAIL_TxPowerLevel_t powerLevel);
+
+RAIL_Status_t table_InitTxPowerCurves(const RAIL_TxPowerCurvesConfig_t *config);
+RAIL_Status_t table_InitTxPowerCurvesAlt(const RAIL_TxPowerCurvesConfigAlt_t *config);
+RAIL_TxPowerLevel_t table_ConvertDbmToRaw(RAIL_Handle_t railHandle,
+                                          RAIL_TxPowerMode_t mode,
+                                          RAIL_TxPower_t power);
+RAIL_TxPower_t table_ConvertRawToDbm(RAIL_Handle_t railHandle,
+                                     RAIL_TxPowerMode_t mode,
+                                     RAIL_TxPowerLevel_t powerLevel);
+
+// Deci-dBm values in the lookup table of a PA, 0 if it converts on the curve
+uint16_t table_DbmEntries(RAIL_TxPowerMode_t mode);
+
+#endif
@@ -0,0 +1,18 @@
+/*
+ *  pa_conversions_efr32.c with the lookup tables
+ */
+
+#define RAIL_PA_CONVERSIONS_LOOKUP_TABLES
+
+#define RAIL_GetTxPowerCurve        table_GetTxPowerCurve
+#define RAIL_InitTxPowerCurves      table_InitTxPowerCurves
+#define RAIL_InitTxPowerCurvesAlt   table_InitTxPowerCurvesAlt
+#define RAIL_ConvertDbmToRaw        table_ConvertDbmToRaw
+#define RAIL_ConvertRawToDbm        table_ConvertRawToDbm
+
+#include "pa_conversions_efr32.c"
+
+uint16_t table_DbmEntries(RAIL_TxPowerMode_t mode)
+{
+  return (mode < RAIL_NUM_PA) ? paLookupTables[mode].dbmEntries : 0U;
+}
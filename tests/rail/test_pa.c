@@ -0,0 +1,125 @@
+/*
+ *  Checks that the PA conversion lookup tables convert exactly like the
+ *  curves they are built from
+ *
+ *  Built once per part family, for the curves pa_curves_efr32.c declares from
+ *  pa_curves_efr32xg1x.h, pa_curves_efr32xg21.h or pa_curves_efr32xg22.h.
+ *  Both the battery and the DC-DC curves are loaded, one after the other,
+ *  and, on Series 1, the curves of RAIL_InitTxPowerCurves(). For each, every
+ *  int16_t deci-dBm value and every power level of every PA is converted by
+ *  the shipped code and by the table build, and the results must be equal.
+ */
+
+#include <stdio.h>
+
+#include "check.h"
+#include "pa_host.h"
+
+// Mismatches printed per PA and direction, the rest are only counted
+#define MAX_REPORTED    4
+
+static const char *const modeNames[] = RAIL_TX_POWER_MODE_NAMES;
+
+#ifdef _SILICON_LABS_32B_SERIES_1
+RAIL_DECLARE_TX_POWER_VBAT_CURVES(piecewiseSegments, curvesSg, curves24Hp,
+                                  curves24Lp);
+
+static const RAIL_TxPowerCurvesConfig_t legacyConfig = {
+  curves24Hp, curvesSg, curves24Lp, piecewiseSegments
+};
+#endif
+
+static unsigned check_dbm_to_raw(RAIL_TxPowerMode_t mode)
+{
+  unsigned mismatches = 0;
+
+  for (int32_t power = INT16_MIN; power <= INT16_MAX; power++) {
+    RAIL_TxPowerLevel_t curve = curve_ConvertDbmToRaw(NULL, mode, power);
+    RAIL_TxPowerLevel_t table = table_ConvertDbmToRaw(NULL, mode, power);
+
+    if (curve != table && mismatches++ < MAX_REPORTED) {
+      printf("  %s: %d deci-dBm converts to %u, the table gives %u\n",
+             modeNames[mode], power, curve, table);
+    }
+  }
+  return mismatches;
+}
+
+static unsigned check_raw_to_dbm(RAIL_TxPowerMode_t mode,
+                                 RAIL_PaDescriptor_t const *pa)
+{
+  unsigned mismatches = 0;
+  unsigned first      = 0;
+
+  // The shipped code indexes the mapping table before its start for power
+  // levels below the PA minimum, there is no result to compare
+  if (pa != NULL && pa->algorithm == RAIL_PA_ALGORITHM_MAPPING_TABLE) {
+    first = pa->min;
+#ifdef _SILICON_LABS_32B_SERIES_1
+    first = (first < 1U) ? 1U : first;
+#endif
+  }
+
+  for (unsigned level = first; level <= UINT8_MAX; level++) {
+    RAIL_TxPower_t curve = curve_ConvertRawToDbm(NULL, mode, level);
+    RAIL_TxPower_t table = table_ConvertRawToDbm(NULL, mode, level);
+
+    if (curve != table && mismatches++ < MAX_REPORTED) {
+      printf("  %s: power level %u converts to %d deci-dBm, the table "
+             "gives %d\n", modeNames[mode], level, curve, table);
+    }
+  }
+  return mismatches;
+}
+
+// Compares both directions on every PA of the curves loaded into both builds,
+// which curves describes
+static void check_curves(const char *name,
+                         RAIL_TxPowerCurvesConfigAlt_t const *curves)
+{
+  printf("%s\n", name);
+  for (RAIL_TxPowerMode_t mode = 0; mode < RAIL_NUM_PA; mode++) {
+    RAIL_PaDescriptor_t const *pa = &curves->curves[mode];
+
+    printf("  %-28s %3u deci-dBm table entries\n", modeNames[mode],
+           table_DbmEntries(mode));
+    // Every curve shipped fits in a table
+    CHECK(pa->conversion.powerCurve == NULL || table_DbmEntries(mode) != 0U);
+    CHECK(check_dbm_to_raw(mode) == 0U);
+    CHECK(check_raw_to_dbm(mode, pa) == 0U);
+  }
+  // Invalid modes are rejected before the tables are looked at
+  CHECK(check_dbm_to_raw(RAIL_TX_POWER_MODE_NONE) == 0U);
+  CHECK(check_raw_to_dbm(RAIL_TX_POWER_MODE_NONE, NULL) == 0U);
+}
+
+static void check_curves_alt(const char *name,
+                             RAIL_TxPowerCurvesConfigAlt_t const *curves)
+{
+  CHECK(curve_InitTxPowerCurvesAlt(curves) == RAIL_STATUS_NO_ERROR);
+  CHECK(table_InitTxPowerCurvesAlt(curves) == RAIL_STATUS_NO_ERROR);
+  check_curves(name, curves);
+}
+
+int main(void)
+{
+  check_curves_alt("RAIL_TxPowerCurvesVbat", &RAIL_TxPowerCurvesVbat);
+  check_curves_alt("RAIL_TxPowerCurvesDcdc", &RAIL_TxPowerCurvesDcdc);
+  // Loading the first curves again rebuilds the tables of the second
+  check_curves_alt("RAIL_TxPowerCurvesVbat", &RAIL_TxPowerCurvesVbat);
+
+#ifdef _SILICON_LABS_32B_SERIES_1
+  CHECK(curve_InitTxPowerCurves(&legacyConfig) == RAIL_STATUS_NO_ERROR);
+  CHECK(table_InitTxPowerCurves(&legacyConfig) == RAIL_STATUS_NO_ERROR);
+  // Same algorithms and power level ranges as the battery curves
+  check_curves("RAIL_InitTxPowerCurves", &RAIL_TxPowerCurvesVbat);
+#else
+  RAIL_TxPowerCurvesConfig_t legacyConfig = { 0 };
+
+  // Series 2 has no legacy curves and must not build tables for them
+  CHECK(curve_InitTxPowerCurves(&legacyConfig) == RAIL_STATUS_INVALID_CALL);
+  CHECK(table_InitTxPowerCurves(&legacyConfig) == RAIL_STATUS_INVALID_CALL);
+#endif
+
+  return check_report();
+}
@@ -0,0 +1,80 @@
+/*
+ *  Throughput of the software AES-CCM secure link backend
+ *
+ *  Usage: bench_ccm [megabytes]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sl_wfx_secure_link_ccm.h"
+
+/* Only referenced by the host encode/decode functions of the backend */
+sl_wfx_context_t *sl_wfx_context;
+
+static const uint32_t lengths[] = { 16, 64, 256, 1500 };
+
+static double now_s(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+  static uint8_t buffer[1500 + SL_WFX_SECURE_LINK_CCM_TAG_SIZE];
+  uint8_t        keys[2][SL_WFX_SECURE_LINK_SESSION_KEY_LENGTH];
+  uint8_t        nonce[SL_WFX_SECURE_LINK_NONCE_SIZE_BYTES] = { 0 };
+  uint32_t       megabytes = (argc > 1) ? strtoul(argv[1], NULL, 0) : 64;
+  uint32_t       failures  = 0;
+  double         start;
+  double         encrypt_s;
+  double         decrypt_s;
+
+  memset(keys[0], 0x40, sizeof(keys[0]));
+  memset(keys[1], 0x41, sizeof(keys[1]));
+  memset(buffer, 0xA5, sizeof(buffer));
+
+  for (uint32_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+    uint32_t length = lengths[l];
+    uint32_t count  = (uint32_t)((uint64_t)megabytes * 1000000 / length);
+
+    start = now_s();
+    for (uint32_t i = 0; i < count; i++) {
+      sl_wfx_secure_link_ccm_encrypt(keys[0], nonce, buffer, length, buffer + length);
+    }
+    encrypt_s = now_s() - start;
+
+    /* Each decryption is followed by an encryption restoring the message,
+       the time of the encryptions is subtracted */
+    start = now_s();
+    for (uint32_t i = 0; i < count; i++) {
+      failures += sl_wfx_secure_link_ccm_decrypt(keys[0], nonce, buffer, length, buffer + length) != SL_STATUS_OK;
+      sl_wfx_secure_link_ccm_encrypt(keys[0], nonce, buffer, length, buffer + length);
+    }
+    decrypt_s = now_s() - start - encrypt_s;
+
+    printf("%5u bytes: encrypt %7.2f MB/s, decrypt %7.2f MB/s\n",
+           length,
+           count * (double)length / encrypt_s / 1e6,
+           count * (double)length / decrypt_s / 1e6);
+  }
+
+  /* Alternating keys defeats the key schedule cache */
+  start = now_s();
+  for (uint32_t i = 0; i < 100000; i++) {
+    sl_wfx_secure_link_ccm_encrypt(keys[i & 1], nonce, buffer, 64, buffer + 64);
+  }
+  printf("   64 bytes with a key change each message: %.2f us/message\n",
+         (now_s() - start) * 1e6 / 100000);
+
+  if (failures != 0) {
+    printf("%u decryption(s) failed\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,220 @@
+/*
+ *  Benchmark of the WFx FMAC driver against the in-memory WF200 model
+ *
+ *  Usage: bench_wfx [spi_clock_hz [cs_overhead_ns]]
+ *
+ *  Each scenario reports the host time spent in the driver and the model,
+ *  the SPI traffic per frame and the bus time that traffic would take at the
+ *  given SPI clock, each chip select frame costing cs_overhead_ns on top of
+ *  its bytes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sl_wfx.h"
+#include "wfx_chip.h"
+#include "wfx_host.h"
+
+#define FIRMWARE_BODY_SIZE  (300 * 1024)
+#define BOOT_COUNT          20
+#define TX_FRAME_COUNT      30000
+#define TX_FRAME_SIZE       1500
+#define TX_BURST            30
+#define RX_FRAME_COUNT      30000
+#define RX_FRAME_SIZE       1500
+#define RX_BURST            60
+#define SCAN_COUNT          500
+#define SCAN_RESULTS        20
+#define COMMAND_COUNT       20000
+
+static sl_wfx_context_t context;
+static uint32_t         spi_clock_hz   = 20000000;
+static uint32_t         cs_overhead_ns = 1000;
+static uint32_t         event_count;
+
+static double now_s(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static void on_event(const sl_wfx_generic_message_t *event)
+{
+  (void)event;
+  event_count++;
+}
+
+static void drain(void)
+{
+  while (wfx_host_process(NULL) == SL_STATUS_OK) {
+  }
+}
+
+static void start_measure(void)
+{
+  wfx_chip_clear_stats();
+  wfx_host_clear_stats();
+}
+
+/* Print the traffic of a scenario, normalized per unit */
+static void report(const char *name, const char *unit, uint32_t count, double elapsed)
+{
+  const wfx_chip_bus_stats_t *bus   = wfx_chip_bus_stats();
+  uint64_t                    bytes = (uint64_t)bus->header_bytes + bus->read_bytes + bus->write_bytes;
+  double                      bus_s = bytes * 8.0 / spi_clock_hz + bus->transactions * cs_overhead_ns * 1e-9;
+
+  printf("%-8s %8u %-7s %10.0f %s/s host, %10.0f %s/s bus, "
+         "%6.2f transactions/%s, %8.1f bytes/%s\n",
+         name, count, unit,
+         count / elapsed, unit,
+         count / bus_s, unit,
+         (double)bus->transactions / count, unit,
+         (double)bytes / count, unit);
+  if (wfx_chip_msg_stats()->errors != 0 || wfx_host_stats()->errors != 0) {
+    printf("  errors: chip \"%s\", host \"%s\"\n", wfx_chip_last_error(), wfx_host_last_error());
+  }
+}
+
+static int bench_boot(void)
+{
+  uint32_t image_size;
+  uint8_t *image = wfx_host_build_firmware(FIRMWARE_BODY_SIZE, WFX_CHIP_KEYSET, &image_size);
+  double   start;
+
+  wfx_host_set_firmware(image, image_size);
+  start_measure();
+  start = now_s();
+  for (uint32_t i = 0; i < BOOT_COUNT; i++) {
+    /* sl_wfx_init() resets the model through sl_wfx_host_reset_chip(), only
+       the traffic of the last boot is left in the statistics */
+    if (sl_wfx_init(&context) != SL_STATUS_OK) {
+      printf("boot failed: %s\n", wfx_chip_last_error());
+      free(image);
+      return 1;
+    }
+  }
+  report("boot", "boot", 1, (now_s() - start) / BOOT_COUNT);
+  printf("         %u waits for %u ms per boot\n", wfx_host_stats()->waits, wfx_host_stats()->wait_ms);
+  free(image);
+  return 0;
+}
+
+static void bench_tx(void)
+{
+  sl_wfx_send_frame_req_t *frame;
+  double                   start;
+
+  sl_wfx_allocate_command_buffer((sl_wfx_generic_message_t **)&frame,
+                                 SL_WFX_SEND_FRAME_REQ_ID,
+                                 SL_WFX_TX_FRAME_BUFFER,
+                                 sizeof(sl_wfx_send_frame_req_t) + TX_FRAME_SIZE);
+  memset(frame->body.packet_data, 0xA5, TX_FRAME_SIZE);
+
+  start_measure();
+  start = now_s();
+  for (uint32_t i = 0; i < TX_FRAME_COUNT; i++) {
+    sl_wfx_send_ethernet_frame(frame, TX_FRAME_SIZE, SL_WFX_STA_INTERFACE, 0);
+    if ((i + 1) % TX_BURST == 0) {
+      drain();
+    }
+  }
+  drain();
+  report("tx", "frame", TX_FRAME_COUNT, now_s() - start);
+
+  sl_wfx_free_command_buffer((sl_wfx_generic_message_t *)frame,
+                             SL_WFX_SEND_FRAME_REQ_ID,
+                             SL_WFX_TX_FRAME_BUFFER);
+}
+
+static void bench_rx(void)
+{
+  static uint8_t data[RX_FRAME_SIZE];
+  double         elapsed = 0;
+  double         start;
+
+  memset(data, 0x5A, sizeof(data));
+  start_measure();
+  for (uint32_t i = 0; i < RX_FRAME_COUNT; i += RX_BURST) {
+    /* Only the host side is timed, the frames are queued beforehand */
+    for (uint32_t j = 0; j < RX_BURST; j++) {
+      wfx_chip_queue_rx_frame(data, sizeof(data));
+    }
+    start    = now_s();
+    drain();
+    elapsed += now_s() - start;
+  }
+  report("rx", "frame", RX_FRAME_COUNT, elapsed);
+}
+
+static void bench_scan(void)
+{
+  const uint8_t channels[] = { 1, 6, 11 };
+  double        start;
+
+  wfx_chip_set_scan_results(SCAN_RESULTS, 120);
+  start_measure();
+  start = now_s();
+  for (uint32_t i = 0; i < SCAN_COUNT; i++) {
+    sl_wfx_send_scan_command(WFM_SCAN_MODE_ACTIVE, channels, sizeof(channels),
+                             NULL, 0, NULL, 0, NULL);
+    drain();
+  }
+  report("scan", "scan", SCAN_COUNT, now_s() - start);
+}
+
+/* Latency from the request to its confirmation, as seen by the caller */
+static void bench_command(void)
+{
+  sl_wfx_mac_address_t mac = { { 0x02, 0x00, 0x00, 0x00, 0x00, 0x10 } };
+  double               start;
+  double               latency;
+  double               total = 0;
+  double               max   = 0;
+
+  start_measure();
+  for (uint32_t i = 0; i < COMMAND_COUNT; i++) {
+    start   = now_s();
+    sl_wfx_set_mac_address(&mac, SL_WFX_STA_INTERFACE);
+    latency = now_s() - start;
+    total  += latency;
+    if (latency > max) {
+      max = latency;
+    }
+  }
+  report("command", "command", COMMAND_COUNT, total);
+  printf("         confirmation latency %.2f us mean, %.2f us max host\n",
+         total * 1e6 / COMMAND_COUNT, max * 1e6);
+}
+
+int main(int argc, char **argv)
+{
+  if (argc > 1) {
+    spi_clock_hz = strtoul(argv[1], NULL, 0);
+  }
+  if (argc > 2) {
+    cs_overhead_ns = strtoul(argv[2], NULL, 0);
+  }
+  if (spi_clock_hz == 0) {
+    fprintf(stderr, "usage: %s [spi_clock_hz [cs_overhead_ns]]\n", argv[0]);
+    return 2;
+  }
+
+  printf("SPI clock %u Hz, %u ns per chip select\n", spi_clock_hz, cs_overhead_ns);
+  wfx_host_set_event_callback(on_event);
+
+  if (bench_boot() != 0) {
+    return 1;
+  }
+  bench_tx();
+  bench_rx();
+  bench_scan();
+  bench_command();
+
+  sl_wfx_deinit();
+  return 0;
+}
@@ -0,0 +1,38 @@
+/*
+ *  Subset of the Gecko SDK sl_status.h used by the WFx FMAC driver, for the
+ *  host build. The values match the Gecko SDK ones.
+ */
+
+#ifndef SL_STATUS_H
+#define SL_STATUS_H
+
+#include <stdint.h>
+
+typedef uint32_t sl_status_t;
+
+#define SL_STATUS_OK                                  ((sl_status_t)0x0000)
+#define SL_STATUS_FAIL                                ((sl_status_t)0x0001)
+#define SL_STATUS_TIMEOUT                             ((sl_status_t)0x0007)
+#define SL_STATUS_NO_MORE_RESOURCE                    ((sl_status_t)0x0019)
+#define SL_STATUS_INVALID_PARAMETER                   ((sl_status_t)0x0021)
+
+#define SL_STATUS_WIFI_INVALID_KEY                    ((sl_status_t)0x0B01)
+#define SL_STATUS_WIFI_FIRMWARE_DOWNLOAD_TIMEOUT      ((sl_status_t)0x0B02)
+#define SL_STATUS_WIFI_UNSUPPORTED_MESSAGE_ID         ((sl_status_t)0x0B03)
+#define SL_STATUS_WIFI_WARNING                        ((sl_status_t)0x0B04)
+#define SL_STATUS_WIFI_NO_PACKET_TO_RECEIVE           ((sl_status_t)0x0B05)
+#define SL_STATUS_WIFI_SLEEP_GRANTED                  ((sl_status_t)0x0B08)
+#define SL_STATUS_WIFI_SLEEP_NOT_GRANTED              ((sl_status_t)0x0B09)
+#define SL_STATUS_WIFI_SECURE_LINK_MAC_KEY_ERROR      ((sl_status_t)0x0B10)
+#define SL_STATUS_WIFI_SECURE_LINK_EXCHANGE_FAILED    ((sl_status_t)0x0B14)
+#define SL_STATUS_WIFI_WRONG_STATE                    ((sl_status_t)0x0B18)
+#define SL_STATUS_WIFI_CHANNEL_NOT_ALLOWED            ((sl_status_t)0x0B19)
+#define SL_STATUS_WIFI_NO_MATCHING_AP                 ((sl_status_t)0x0B1A)
+#define SL_STATUS_WIFI_CONNECTION_ABORTED             ((sl_status_t)0x0B1B)
+#define SL_STATUS_WIFI_CONNECTION_TIMEOUT             ((sl_status_t)0x0B1C)
+#define SL_STATUS_WIFI_CONNECTION_REJECTED_BY_AP      ((sl_status_t)0x0B1D)
+#define SL_STATUS_WIFI_CONNECTION_AUTH_FAILURE        ((sl_status_t)0x0B1E)
+#define SL_STATUS_WIFI_RETRY_EXCEEDED                 ((sl_status_t)0x0B1F)
+#define SL_STATUS_WIFI_TX_LIFETIME_EXCEEDED           ((sl_status_t)0x0B20)
+
+#endif // SL_STATUS_H
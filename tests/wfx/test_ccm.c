@@ -0,0 +1,132 @@
+/*
+ *  Known answer test of the software AES-CCM secure link backend
+ *
+ *  The backend uses a 12 bytes nonce, a 16 bytes tag and no additional data,
+ *  a combination the SP 800-38C and RFC 3610 examples do not cover. The
+ *  expected values were computed with an independent CCM implementation on
+ *  top of OpenSSL AES-128-ECB, itself checked against SP 800-38C example 3.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "check.h"
+#include "sl_wfx_secure_link_ccm.h"
+
+#define MAX_LENGTH  100
+
+/* Only referenced by the host encode/decode functions of the backend */
+sl_wfx_context_t *sl_wfx_context;
+
+typedef struct {
+  const char *key;
+  const char *nonce;
+  uint32_t    length;     // Plaintext bytes, 0x20, 0x21, ...
+  const char *expected;   // Ciphertext followed by the tag
+} ccm_vector_t;
+
+static const ccm_vector_t vectors[] = {
+  { "404142434445464748494a4b4c4d4e4f", "101112131415161718191a1b", 0,
+    "538f76630f36a98a2f502d9b23d86343" },
+  { "404142434445464748494a4b4c4d4e4f", "101112131415161718191a1b", 1,
+    "e3d85a82557a23c6476ed3a9d4803bcc73" },
+  { "404142434445464748494a4b4c4d4e4f", "101112131415161718191a1b", 15,
+    "e3b201a9f5b71a7a9b1ceaeccd97e76d0800594f86d9bfa1742d1ba86cc4d6" },
+  { "404142434445464748494a4b4c4d4e4f", "101112131415161718191a1b", 16,
+    "e3b201a9f5b71a7a9b1ceaeccd97e70b2efea47e37543546c0c177c5e39b76da" },
+  { "404142434445464748494a4b4c4d4e4f", "101112131415161718191a1b", 17,
+    "e3b201a9f5b71a7a9b1ceaeccd97e70b611da223511da88e9ee848b62a2b43a42b" },
+  { "404142434445464748494a4b4c4d4e4f", "101112131415161718191a1b", 32,
+    "e3b201a9f5b71a7a9b1ceaeccd97e70b6176aad9a4428aa5541bd1d416fa0ce3"
+    "01c85168111733005835c17152d19b4e" },
+  { "404142434445464748494a4b4c4d4e4f", "101112131415161718191a1b", 45,
+    "e3b201a9f5b71a7a9b1ceaeccd97e70b6176aad9a4428aa5541bd1d416fa0ce3"
+    "ec37af206e6278ae445328420bc3507c52bbc75601fda29a7aeac9cf4a" },
+  { "2b7e151628aed2a6abf7158809cf4f3c", "cafebabefacedbaddecaf888", 24,
+    "aa5d54102db80a13ea4c5fc747b2a58f91f84616bfad08a971952d4f6f0eddea"
+    "65bab3b4be8b280c" },
+  { "2b7e151628aed2a6abf7158809cf4f3c", "cafebabefacedbaddecaf888", 64,
+    "aa5d54102db80a13ea4c5fc747b2a58f91f84616bfad08a9b33d4e65a2c701d4"
+    "5dd2fdd205c1a4ee5a54e3fc9dba5bb3cbfe11675e26adf6f489aa3d13b0ad92"
+    "2c8111a3c6e5d03baf2bc081b56dea53" },
+  { "2b7e151628aed2a6abf7158809cf4f3c", "cafebabefacedbaddecaf888", 100,
+    "aa5d54102db80a13ea4c5fc747b2a58f91f84616bfad08a9b33d4e65a2c701d4"
+    "5dd2fdd205c1a4ee5a54e3fc9dba5bb3cbfe11675e26adf6f489aa3d13b0ad92"
+    "a6bae3c1b1838e9a56cf4142ea69f14618371cbd3dcf67c466cf567c5fad9291"
+    "70b11155518ddd965405da1e8ca7f9fdf99db3c2" },
+};
+
+#define VECTOR_COUNT  (sizeof(vectors) / sizeof(vectors[0]))
+
+static void from_hex(const char *hex, uint8_t *data)
+{
+  unsigned value;
+
+  for (; hex[0] != '\0'; hex += 2) {
+    sscanf(hex, "%2x", &value);
+    *data++ = (uint8_t)value;
+  }
+}
+
+static void test_vector(const ccm_vector_t *vector)
+{
+  uint8_t key[SL_WFX_SECURE_LINK_SESSION_KEY_LENGTH];
+  uint8_t nonce[SL_WFX_SECURE_LINK_NONCE_SIZE_BYTES];
+  uint8_t expected[MAX_LENGTH + SL_WFX_SECURE_LINK_CCM_TAG_SIZE];
+  uint8_t buffer[MAX_LENGTH + SL_WFX_SECURE_LINK_CCM_TAG_SIZE];
+  uint8_t plaintext[MAX_LENGTH];
+  uint32_t length = vector->length;
+
+  from_hex(vector->key, key);
+  from_hex(vector->nonce, nonce);
+  from_hex(vector->expected, expected);
+  for (uint32_t i = 0; i < length; i++) {
+    plaintext[i] = (uint8_t)(0x20 + i);
+  }
+
+  /* The tag directly follows the data, as in the secure link messages */
+  memcpy(buffer, plaintext, length);
+  CHECK(sl_wfx_secure_link_ccm_encrypt(key, nonce, buffer, length, buffer + length) == SL_STATUS_OK);
+  CHECK(memcmp(buffer, expected, length + SL_WFX_SECURE_LINK_CCM_TAG_SIZE) == 0);
+
+  CHECK(sl_wfx_secure_link_ccm_decrypt(key, nonce, buffer, length, buffer + length) == SL_STATUS_OK);
+  CHECK(memcmp(buffer, plaintext, length) == 0);
+
+  /* Any modification of the ciphertext, the tag or the nonce is rejected */
+  if (length > 0) {
+    memcpy(buffer, expected, length + SL_WFX_SECURE_LINK_CCM_TAG_SIZE);
+    buffer[length - 1] ^= 0x01;
+    CHECK(sl_wfx_secure_link_ccm_decrypt(key, nonce, buffer, length, buffer + length) == SL_STATUS_FAIL);
+  }
+  memcpy(buffer, expected, length + SL_WFX_SECURE_LINK_CCM_TAG_SIZE);
+  buffer[length + SL_WFX_SECURE_LINK_CCM_TAG_SIZE - 1] ^= 0x80;
+  CHECK(sl_wfx_secure_link_ccm_decrypt(key, nonce, buffer, length, buffer + length) == SL_STATUS_FAIL);
+
+  memcpy(buffer, expected, length + SL_WFX_SECURE_LINK_CCM_TAG_SIZE);
+  nonce[0] ^= 0x01;
+  CHECK(sl_wfx_secure_link_ccm_decrypt(key, nonce, buffer, length, buffer + length) == SL_STATUS_FAIL);
+}
+
+int main(void)
+{
+  uint8_t key[SL_WFX_SECURE_LINK_SESSION_KEY_LENGTH];
+
+  for (uint32_t i = 0; i < VECTOR_COUNT; i++) {
+    test_vector(&vectors[i]);
+  }
+
+  /* The key schedule is cached, changing the key back and forth must not
+     reuse a stale one */
+  for (uint32_t i = VECTOR_COUNT; i > 0; i--) {
+    test_vector(&vectors[i - 1]);
+    test_vector(&vectors[(i * 7) % VECTOR_COUNT]);
+  }
+
+  /* The same holds when the key is installed ahead of time */
+  from_hex(vectors[VECTOR_COUNT - 1].key, key);
+  sl_wfx_secure_link_ccm_set_key(key);
+  test_vector(&vectors[0]);
+  test_vector(&vectors[VECTOR_COUNT - 1]);
+
+  return check_report();
+}
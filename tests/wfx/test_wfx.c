@@ -0,0 +1,449 @@
+/*
+ *  Functional test of the WFx FMAC driver against the in-memory WF200 model
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "check.h"
+#include "sl_wfx.h"
+#include "wfx_chip.h"
+#include "wfx_host.h"
+
+/* Firmware images are made of 32-bit words, the last block is a partial one */
+#define FIRMWARE_BODY_SIZE  (200 * 1024 + 332)
+
+static sl_wfx_context_t context;
+
+static uint32_t rx_frames;
+static uint32_t rx_bytes;
+static uint32_t rx_errors;
+static uint32_t scan_results;
+static uint32_t scan_completes;
+
+static void fill_frame(uint8_t *data, uint16_t length, uint32_t seed)
+{
+  for (uint16_t i = 0; i < length; i++) {
+    data[i] = (uint8_t)(seed + i * 7);
+  }
+}
+
+static void on_event(const sl_wfx_generic_message_t *event)
+{
+  switch (event->header.id) {
+    case SL_WFX_RECEIVED_IND_ID: {
+      const sl_wfx_received_ind_t *ind = (const sl_wfx_received_ind_t *)event;
+      uint8_t expected[1600];
+
+      fill_frame(expected, ind->body.frame_length, rx_frames);
+      if (memcmp(ind->body.frame, expected, ind->body.frame_length) != 0) {
+        rx_errors++;
+      }
+      rx_frames++;
+      rx_bytes += ind->body.frame_length;
+      break;
+    }
+    case SL_WFX_SCAN_RESULT_IND_ID:
+      scan_results++;
+      break;
+    case SL_WFX_SCAN_COMPLETE_IND_ID:
+      scan_completes++;
+      break;
+    default:
+      break;
+  }
+}
+
+static void check_clean(void)
+{
+  if (wfx_chip_msg_stats()->errors != 0) {
+    printf("  chip error: %s\n", wfx_chip_last_error());
+  }
+  if (wfx_host_stats()->errors != 0) {
+    printf("  host error: %s\n", wfx_host_last_error());
+  }
+  CHECK(wfx_chip_msg_stats()->errors == 0);
+  CHECK(wfx_host_stats()->errors == 0);
+}
+
+static void drain(void)
+{
+  while (wfx_host_process(NULL) == SL_STATUS_OK) {
+  }
+}
+
+static void test_boot(void)
+{
+  uint32_t       image_size;
+  uint8_t       *image = wfx_host_build_firmware(FIRMWARE_BODY_SIZE, WFX_CHIP_KEYSET, &image_size);
+  const uint8_t *downloaded;
+  uint32_t       downloaded_size;
+
+  printf("boot\n");
+  wfx_host_set_firmware(image, image_size);
+
+  /* The bootloader only drains 3 KB each time the host reads GET, so the
+     host has to wait for room in the download FIFO */
+  wfx_chip_set_download_drain(3 * 1024);
+  CHECK(sl_wfx_init(&context) == SL_STATUS_OK);
+  check_clean();
+
+  downloaded = wfx_chip_firmware(&downloaded_size);
+  CHECK(downloaded_size == FIRMWARE_BODY_SIZE);
+  CHECK(downloaded != NULL
+        && memcmp(downloaded, image + image_size - FIRMWARE_BODY_SIZE, FIRMWARE_BODY_SIZE) == 0);
+  CHECK(wfx_chip_firmware_running());
+  CHECK(context.state & SL_WFX_STARTED);
+  CHECK(context.firmware_major == 3 && context.firmware_minor == 4 && context.firmware_build == 1);
+  CHECK(context.mac_addr_0.octet[5] == 1 && context.mac_addr_1.octet[5] == 2);
+  CHECK(memcmp(context.wfx_opn, "WF200D", 6) == 0);
+  CHECK(context.used_buffers == 0);
+  CHECK(wfx_host_buffers_in_use() == 0);
+  /* The model answers at once, the driver never has to sleep */
+  CHECK(wfx_host_stats()->waits == 0);
+#ifdef SL_WFX_USE_BOOT_TIMING
+  CHECK(context.boot_timing.total >= context.boot_timing.firmware_download);
+#endif
+
+  free(image);
+}
+
+static void test_boot_errors(void)
+{
+  uint32_t image_size;
+  uint8_t *image;
+  sl_wfx_context_t failed_context;
+
+  printf("boot errors\n");
+
+  /* Firmware built for another keyset */
+  image = wfx_host_build_firmware(4096, WFX_CHIP_KEYSET + 1, &image_size);
+  wfx_host_set_firmware(image, image_size);
+  CHECK(sl_wfx_init(&failed_context) == SL_STATUS_WIFI_INVALID_KEY);
+  free(image);
+
+  /* Corrupted firmware, the authentication fails */
+  image = wfx_host_build_firmware(4096, WFX_CHIP_KEYSET, &image_size);
+  image[image_size - 1] ^= 0x01;
+  wfx_host_set_firmware(image, image_size);
+  CHECK(sl_wfx_init(&failed_context) == SL_STATUS_TIMEOUT);
+  CHECK(wfx_chip_msg_stats()->errors > 0);
+  free(image);
+}
+
+static void test_tx(void)
+{
+  sl_wfx_send_frame_req_t *frame;
+  uint32_t                 bytes = 0;
+  uint32_t                 chip_bytes;
+  uint32_t                 sent = 0;
+  const uint8_t           *last;
+  uint16_t                 last_length;
+
+  printf("tx\n");
+  wfx_chip_clear_stats();
+
+  for (uint32_t i = 0; i < 200; i++) {
+    uint16_t length = 60 + (i * 37) % 1450;
+
+    CHECK(sl_wfx_allocate_command_buffer((sl_wfx_generic_message_t **)&frame,
+                                         SL_WFX_SEND_FRAME_REQ_ID,
+                                         SL_WFX_TX_FRAME_BUFFER,
+                                         sizeof(sl_wfx_send_frame_req_t) + length) == SL_STATUS_OK);
+    fill_frame(frame->body.packet_data, length, i);
+    CHECK(sl_wfx_send_ethernet_frame(frame, length, SL_WFX_STA_INTERFACE, 0) == SL_STATUS_OK);
+    last = wfx_chip_last_tx_frame(&last_length);
+    CHECK(last_length == length && memcmp(last, frame->body.packet_data, length) == 0);
+    sl_wfx_free_command_buffer((sl_wfx_generic_message_t *)frame, SL_WFX_SEND_FRAME_REQ_ID, SL_WFX_TX_FRAME_BUFFER);
+    bytes += length;
+    sent++;
+
+    /* Confirmations are read in bursts of 8 */
+    if (i % 8 == 7) {
+      drain();
+    }
+  }
+  drain();
+
+  CHECK(wfx_chip_tx_frames(&chip_bytes) == sent);
+  CHECK(chip_bytes == bytes);
+  CHECK(wfx_chip_msg_stats()->confirmations == sent);
+  CHECK(wfx_chip_msg_stats()->max_buffers == 8);
+  CHECK(context.used_buffers == 0);
+  CHECK(wfx_host_buffers_in_use() == 0);
+  check_clean();
+}
+
+static void test_tx_payload(void)
+{
+  sl_wfx_send_frame_req_t *frame;
+  uint8_t                  expected[1500];
+  const uint8_t           *last;
+  uint16_t                 last_length;
+  sl_wfx_send_frame_req_t  header;
+  sl_wfx_data_segment_t    segments[3];
+
+  printf("tx payload\n");
+
+  fill_frame(expected, sizeof(expected), 42);
+
+  CHECK(sl_wfx_allocate_command_buffer((sl_wfx_generic_message_t **)&frame,
+                                       SL_WFX_SEND_FRAME_REQ_ID,
+                                       SL_WFX_TX_FRAME_BUFFER,
+                                       sizeof(sl_wfx_send_frame_req_t) + 1001) == SL_STATUS_OK);
+  memcpy(frame->body.packet_data, expected, 1001);
+  CHECK(sl_wfx_send_ethernet_frame(frame, 1001, SL_WFX_STA_INTERFACE, 0) == SL_STATUS_OK);
+  sl_wfx_free_command_buffer((sl_wfx_generic_message_t *)frame, SL_WFX_SEND_FRAME_REQ_ID, SL_WFX_TX_FRAME_BUFFER);
+  last = wfx_chip_last_tx_frame(&last_length);
+  CHECK(last_length == 1001 && memcmp(last, expected, 1001) == 0);
+
+  /* Scattered frame with an odd total length, written in one bus frame */
+  segments[0] = (sl_wfx_data_segment_t){ expected, 14 };
+  segments[1] = (sl_wfx_data_segment_t){ expected + 14, 20 };
+  segments[2] = (sl_wfx_data_segment_t){ expected + 34, 1177 };
+  wfx_chip_clear_stats();
+  CHECK(sl_wfx_send_ethernet_frame_segments(&header, segments, 3, SL_WFX_STA_INTERFACE, 0) == SL_STATUS_OK);
+  CHECK(wfx_chip_bus_stats()->register_writes[SL_WFX_IN_OUT_QUEUE_REG_ID] == 1);
+  last = wfx_chip_last_tx_frame(&last_length);
+  CHECK(last_length == 1211 && memcmp(last, expected, 1211) == 0);
+
+  drain();
+  CHECK(context.used_buffers == 0);
+  check_clean();
+}
+
+static void test_input_buffer_limit(void)
+{
+  sl_wfx_send_frame_req_t *frame;
+  sl_wfx_send_frame_req_t  header;
+  sl_wfx_data_segment_t    segments[1];
+  uint32_t                 sent = 0;
+
+  printf("input buffer limit\n");
+  wfx_chip_clear_stats();
+
+  CHECK(sl_wfx_allocate_command_buffer((sl_wfx_generic_message_t **)&frame,
+                                       SL_WFX_SEND_FRAME_REQ_ID,
+                                       SL_WFX_TX_FRAME_BUFFER,
+                                       sizeof(sl_wfx_send_frame_req_t) + 100) == SL_STATUS_OK);
+  memset(frame->body.packet_data, 0, 100);
+
+  /* Without reading confirmations, the driver stops writing to the chip at
+     the number of input buffers reported in the startup indication. The
+     frames sent past that point are dropped by the driver. */
+  for (sent = 0; sent < WFX_CHIP_INPUT_BUFFERS + 10; sent++) {
+    sl_wfx_send_ethernet_frame(frame, 100, SL_WFX_STA_INTERFACE, 0);
+  }
+  CHECK(context.used_buffers == WFX_CHIP_INPUT_BUFFERS);
+  CHECK(wfx_chip_msg_stats()->requests == WFX_CHIP_INPUT_BUFFERS);
+  CHECK(wfx_chip_msg_stats()->max_buffers == WFX_CHIP_INPUT_BUFFERS);
+
+  /* A segmented frame is refused as well, without keeping the driver lock */
+  segments[0] = (sl_wfx_data_segment_t){ frame->body.packet_data, 100 };
+  CHECK(sl_wfx_send_ethernet_frame_segments(&header, segments, 1, SL_WFX_STA_INTERFACE, 0)
+        == SL_STATUS_NO_MORE_RESOURCE);
+  CHECK(context.used_buffers == WFX_CHIP_INPUT_BUFFERS);
+  CHECK(wfx_chip_msg_stats()->requests == WFX_CHIP_INPUT_BUFFERS);
+
+  drain();
+  CHECK(context.used_buffers == 0);
+  CHECK(sl_wfx_send_ethernet_frame(frame, 100, SL_WFX_STA_INTERFACE, 0) == SL_STATUS_OK);
+  drain();
+
+  sl_wfx_free_command_buffer((sl_wfx_generic_message_t *)frame, SL_WFX_SEND_FRAME_REQ_ID, SL_WFX_TX_FRAME_BUFFER);
+  check_clean();
+}
+
+static void test_rx(void)
+{
+  uint8_t  data[1600];
+  uint32_t count;
+  uint32_t bytes = 0;
+
+  printf("rx\n");
+  rx_frames = 0;
+  rx_bytes  = 0;
+  rx_errors = 0;
+
+  for (uint32_t i = 0; i < 40; i++) {
+    uint16_t length = 64 + (i * 97) % 1450;
+
+    fill_frame(data, length, i);
+    CHECK(wfx_chip_queue_rx_frame(data, length));
+    bytes += length;
+  }
+
+  /* The whole burst is read with a single control register read, the next
+     frame length is piggy-backed after each frame */
+  wfx_chip_clear_stats();
+  CHECK(wfx_host_process(&count) == SL_STATUS_OK);
+  CHECK(count == 40);
+  CHECK(rx_frames == 40 && rx_bytes == bytes && rx_errors == 0);
+  CHECK(wfx_chip_bus_stats()->register_reads[SL_WFX_CONTROL_REG_ID] == 1);
+  CHECK(wfx_chip_bus_stats()->register_reads[SL_WFX_IN_OUT_QUEUE_REG_ID] == 40);
+  CHECK(wfx_host_process(&count) == SL_STATUS_WIFI_NO_PACKET_TO_RECEIVE);
+  CHECK(wfx_host_buffers_in_use() == 0);
+  check_clean();
+}
+
+static void test_scan(void)
+{
+  const uint8_t channels[] = { 1, 6, 11 };
+
+  printf("scan\n");
+  scan_results   = 0;
+  scan_completes = 0;
+  wfx_chip_set_scan_results(25, 120);
+
+  CHECK(sl_wfx_send_scan_command(WFM_SCAN_MODE_ACTIVE, channels, sizeof(channels),
+                                 NULL, 0, NULL, 0, NULL) == SL_STATUS_OK);
+  drain();
+  CHECK(scan_results == 25);
+  CHECK(scan_completes == 1);
+  check_clean();
+}
+
+static void test_command(void)
+{
+  sl_wfx_mac_address_t mac = { { 0x02, 0x00, 0x00, 0x00, 0x00, 0x10 } };
+
+  printf("command\n");
+  wfx_chip_clear_stats();
+  CHECK(sl_wfx_set_mac_address(&mac, SL_WFX_STA_INTERFACE) == SL_STATUS_OK);
+  CHECK(wfx_chip_msg_stats()->requests == 1);
+  CHECK(wfx_chip_msg_stats()->confirmations == 1);
+  CHECK(context.used_buffers == 0);
+  check_clean();
+}
+
+#ifdef SL_WFX_USE_STATISTICS
+/* The driver statistics must agree with the traffic seen by the model */
+static void test_statistics(void)
+{
+  sl_wfx_statistics_t         stats;
+  const wfx_chip_bus_stats_t *bus;
+  uint8_t                     data[300];
+
+  printf("statistics\n");
+  sl_wfx_reset_statistics();
+  wfx_chip_clear_stats();
+
+  fill_frame(data, sizeof(data), 0);
+  for (uint32_t i = 0; i < 10; i++) {
+    CHECK(wfx_chip_queue_rx_frame(data, sizeof(data)));
+  }
+  drain();
+
+  bus = wfx_chip_bus_stats();
+  CHECK(sl_wfx_get_statistics(&stats) == SL_STATUS_OK);
+  CHECK(stats.rx_frames.count == 10);
+  CHECK(stats.rx_frames.bytes == 10 * sizeof(data));
+  for (uint32_t reg = 0; reg < SL_WFX_STATS_REGISTER_COUNT; reg++) {
+    CHECK(stats.registers[reg].read_count == bus->register_reads[reg]);
+    CHECK(stats.registers[reg].write_count == bus->register_writes[reg]);
+  }
+  check_clean();
+}
+#endif
+
+#ifdef SL_WFX_USE_TX_QUEUE
+/* Give count frames to the TX queue without reading any confirmation */
+static void queue_frames(uint32_t count)
+{
+  sl_wfx_send_frame_req_t *frame;
+
+  for (uint32_t i = 0; i < count; i++) {
+    CHECK(sl_wfx_allocate_command_buffer((sl_wfx_generic_message_t **)&frame,
+                                         SL_WFX_SEND_FRAME_REQ_ID,
+                                         SL_WFX_TX_FRAME_BUFFER,
+                                         sizeof(sl_wfx_send_frame_req_t) + 100) == SL_STATUS_OK);
+    memset(frame->body.packet_data, 0, 100);
+    CHECK(sl_wfx_send_ethernet_frame_queued(frame, 100, SL_WFX_STA_INTERFACE, 0) == SL_STATUS_OK);
+  }
+}
+
+static void test_tx_queue(void)
+{
+  uint32_t                 data_credits = WFX_CHIP_INPUT_BUFFERS - SL_WFX_TX_QUEUE_CONTROL_CREDITS;
+  uint32_t                 image_size;
+  uint8_t                 *image;
+  uint8_t                  data[100];
+  sl_wfx_send_frame_req_t  header;
+  sl_wfx_data_segment_t    segments[1] = { { data, sizeof(data) } };
+  sl_wfx_tx_queue_stats_t  stats;
+
+  printf("tx queue\n");
+  memset(data, 0, sizeof(data));
+  sl_wfx_reset_tx_queue_stats();
+
+  /* Only the control credits are left, a segmented frame may not use them */
+  queue_frames(data_credits);
+  CHECK(sl_wfx_get_tx_queue_stats(&stats) == SL_STATUS_OK);
+  CHECK(stats.sent_frames == data_credits && stats.depth == 0);
+  CHECK(sl_wfx_send_ethernet_frame_segments(&header, segments, 1, SL_WFX_STA_INTERFACE, 0)
+        == SL_STATUS_NO_MORE_RESOURCE);
+
+  /* Nor overtake the queued frames, which are sent as buffers are released */
+  queue_frames(3);
+  CHECK(sl_wfx_get_tx_queue_stats(&stats) == SL_STATUS_OK);
+  CHECK(stats.depth == 3);
+  wfx_chip_clear_stats();
+  CHECK(sl_wfx_send_ethernet_frame_segments(&header, segments, 1, SL_WFX_STA_INTERFACE, 0)
+        == SL_STATUS_NO_MORE_RESOURCE);
+  CHECK(wfx_chip_msg_stats()->requests == 0);
+
+  drain();
+  CHECK(sl_wfx_get_tx_queue_stats(&stats) == SL_STATUS_OK);
+  CHECK(stats.depth == 0 && stats.sent_frames == data_credits + 3);
+  drain();
+  CHECK(context.used_buffers == 0);
+  CHECK(sl_wfx_send_ethernet_frame_segments(&header, segments, 1, SL_WFX_STA_INTERFACE, 0) == SL_STATUS_OK);
+  drain();
+  check_clean();
+
+  /* A failed shutdown still frees the queued frames */
+  queue_frames(data_credits + 3);
+  CHECK(wfx_host_buffers_in_use() == 3);
+  wfx_host_fail_wake_up_pin(true);
+  CHECK(sl_wfx_shutdown() == SL_STATUS_FAIL);
+  wfx_host_fail_wake_up_pin(false);
+  CHECK(sl_wfx_get_tx_queue_stats(&stats) == SL_STATUS_OK);
+  CHECK(stats.depth == 0 && stats.dropped_frames == 3);
+  CHECK(wfx_host_buffers_in_use() == 0);
+
+  /* So does a new initialization, before the context is cleared */
+  image = wfx_host_build_firmware(FIRMWARE_BODY_SIZE, WFX_CHIP_KEYSET, &image_size);
+  wfx_host_set_firmware(image, image_size);
+  CHECK(sl_wfx_init(&context) == SL_STATUS_OK);
+  queue_frames(data_credits + 3);
+  CHECK(wfx_host_buffers_in_use() == 3);
+  CHECK(sl_wfx_init(&context) == SL_STATUS_OK);
+  CHECK(wfx_host_buffers_in_use() == 0);
+  free(image);
+  check_clean();
+}
+#endif
+
+int main(void)
+{
+  wfx_host_set_event_callback(on_event);
+
+  test_boot();
+  test_command();
+  test_tx();
+  test_tx_payload();
+  test_input_buffer_limit();
+  test_rx();
+  test_scan();
+#ifdef SL_WFX_USE_STATISTICS
+  test_statistics();
+#endif
+#ifdef SL_WFX_USE_TX_QUEUE
+  test_tx_queue();
+#endif
+  CHECK(sl_wfx_deinit() == SL_STATUS_OK);
+  test_boot_errors();
+
+  return check_report();
+}
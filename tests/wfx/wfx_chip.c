@@ -0,0 +1,738 @@
+/*
+ *  In-memory WF200 model, driven through the SPI host API
+ */
+
+#include "wfx_chip.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sl_wfx.h"
+
+#define SPI_READ_FLAG          0x8000
+#define SPI_ADDRESS_OFFSET     12
+#define SPI_ADDRESS_MASK       0x7
+#define SPI_WORDS_MASK         0x0FFF
+#define SPI_FRAME_MAX          (SPI_WORDS_MASK * 2)
+
+#define SHARED_RAM_BASE        PAC_SHARED_MEMORY_SILICON
+#define SHARED_RAM_SIZE        0xD000
+
+#define OUTPUT_QUEUE_LENGTH    64
+#define OUTPUT_MESSAGE_MAX     2400
+
+#define CONFIG_RESET_VALUE     (SL_WFX_CONFIG_ACCESS_MODE_BIT    \
+                                | SL_WFX_CONFIG_CPU_RESET_BIT    \
+                                | SL_WFX_CONFIG_CPU_CLK_DIS_BIT  \
+                                | (2 << SL_WFX_CONFIG_REVISION_OFFSET))
+
+typedef struct {
+  uint16_t length;        // Message length rounded up to a 16-bit word
+  uint8_t  type;          // sl_wfx_received_message_type_t
+  uint8_t  data[OUTPUT_MESSAGE_MAX];
+} output_message_t;
+
+static struct {
+  /* Registers */
+  uint32_t config;
+  uint16_t control;
+  bool     wake_up_pin;
+  uint32_t sram_address;
+  uint32_t dport;
+
+  /* Current chip select frame */
+  bool     selected;
+  bool     have_header;
+  bool     read;
+  uint8_t  address;
+  uint32_t length;
+  uint32_t offset;
+  uint8_t  frame[SPI_FRAME_MAX + SL_WFX_CONT_REGISTER_SIZE];
+
+  /* Bootloader */
+  uint8_t  shared_ram[SHARED_RAM_SIZE];
+  uint32_t host_state;
+  uint32_t download_drain;
+  uint8_t *image;
+  uint32_t image_size;
+  uint32_t image_received;
+  bool     running;
+
+  /* Firmware */
+  output_message_t output[OUTPUT_QUEUE_LENGTH];
+  uint32_t output_head;
+  uint32_t output_count;
+  uint32_t buffers_in_use;
+  uint32_t scan_results;
+  uint16_t scan_ie_length;
+  uint32_t tx_frames;
+  uint32_t tx_bytes;
+  uint8_t  tx_last[WFX_CHIP_INPUT_BUFFER_SIZE];
+  uint16_t tx_last_length;
+
+  wfx_chip_bus_stats_t bus_stats;
+  wfx_chip_msg_stats_t msg_stats;
+  char     last_error[128];
+} chip;
+
+static void chip_error(const char *error)
+{
+  chip.msg_stats.errors++;
+  snprintf(chip.last_error, sizeof(chip.last_error), "%s", error);
+}
+
+static uint32_t get_le32(const uint8_t *data)
+{
+  return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+static void put_le32(uint8_t *data, uint32_t value)
+{
+  data[0] = value;
+  data[1] = value >> 8;
+  data[2] = value >> 16;
+  data[3] = value >> 24;
+}
+
+/* The CONFIG register is transferred in word mode 0, B1 B0 B3 B2 */
+static void swap_config_bytes(uint8_t *data)
+{
+  uint8_t byte = data[0];
+  data[0] = data[1];
+  data[1] = byte;
+  byte = data[2];
+  data[2] = data[3];
+  data[3] = byte;
+}
+
+/******************************************************
+*                Shared RAM and bootloader
+******************************************************/
+
+static uint8_t *shared_ram(uint32_t address, uint32_t length)
+{
+  if (address < SHARED_RAM_BASE || address + length > SHARED_RAM_BASE + SHARED_RAM_SIZE) {
+    chip_error("APB access outside of the shared RAM");
+    return NULL;
+  }
+  return &chip.shared_ram[address - SHARED_RAM_BASE];
+}
+
+static uint32_t apb_read_32(uint32_t address)
+{
+  uint8_t *data = shared_ram(address, 4);
+  return (data != NULL) ? get_le32(data) : 0;
+}
+
+static void apb_write_32(uint32_t address, uint32_t value)
+{
+  uint8_t *data = shared_ram(address, 4);
+  if (data != NULL) {
+    put_le32(data, value);
+  }
+}
+
+/* The bootloader moves up to length bytes from the download FIFO to the
+   firmware image, 0 meaning everything the host has put */
+static void download_drain(uint32_t length)
+{
+  uint32_t put = apb_read_32(ADDR_DWL_CTRL_AREA_PUT);
+  uint32_t get = apb_read_32(ADDR_DWL_CTRL_AREA_GET);
+
+  if (chip.image == NULL || put < get || put > chip.image_size || put - get > DOWNLOAD_FIFO_SIZE) {
+    chip_error("Inconsistent download FIFO pointers");
+    return;
+  }
+  if (length == 0 || length > put - get) {
+    length = put - get;
+  }
+
+  for (uint32_t i = 0; i < length; i++) {
+    chip.image[get + i] = chip.shared_ram[ADDR_DOWNLOAD_FIFO_BASE - SHARED_RAM_BASE
+                                          + ((get + i) % DOWNLOAD_FIFO_SIZE)];
+  }
+  chip.image_received = get + length;
+  apb_write_32(ADDR_DWL_CTRL_AREA_GET, get + length);
+}
+
+static void queue_startup_indication(void);
+
+static void bootloader_host_state(uint32_t state)
+{
+  uint32_t ncp_state = apb_read_32(ADDR_DWL_CTRL_AREA_NCP_STATUS);
+  uint8_t  hash[FW_HASH_SIZE];
+  uint64_t expected;
+
+  switch (state) {
+    case HOST_STATE_NOT_READY:
+      break;
+    case HOST_STATE_READY:
+      apb_write_32(SL_WFX_PTE_INFO + 12, WFX_CHIP_KEYSET << 8);
+      ncp_state = NCP_STATE_INFO_READY;
+      break;
+    case HOST_STATE_HOST_INFO_READ:
+      if (chip.host_state != HOST_STATE_READY) {
+        chip_error("Info read before the host was ready");
+      }
+      ncp_state = NCP_STATE_READY;
+      break;
+    case HOST_STATE_UPLOAD_PENDING:
+      if (chip.host_state != HOST_STATE_HOST_INFO_READ) {
+        chip_error("Upload started before the info was read");
+      }
+      free(chip.image);
+      chip.image_size     = apb_read_32(ADDR_DWL_CTRL_AREA_IMAGE_SIZE);
+      chip.image          = malloc(chip.image_size);
+      chip.image_received = 0;
+      ncp_state = NCP_STATE_DOWNLOAD_PENDING;
+      break;
+    case HOST_STATE_UPLOAD_COMPLETE:
+      download_drain(0);
+      memcpy(hash, shared_ram(ADDR_DWL_CTRL_AREA_FW_HASH, FW_HASH_SIZE), FW_HASH_SIZE);
+      expected = wfx_chip_image_hash(chip.image, chip.image_received);
+      if (chip.image_received == chip.image_size
+          && memcmp(hash, &expected, FW_HASH_SIZE) == 0) {
+        ncp_state = NCP_STATE_AUTH_OK;
+      } else {
+        chip_error("Firmware authentication failed");
+        ncp_state = NCP_STATE_AUTH_FAIL;
+      }
+      break;
+    case HOST_STATE_OK_TO_JUMP:
+      if (ncp_state == NCP_STATE_AUTH_OK) {
+        chip.running = true;
+        queue_startup_indication();
+      } else {
+        chip_error("Jump to a firmware that was not authenticated");
+      }
+      break;
+    default:
+      chip_error("Unknown host state");
+      break;
+  }
+
+  chip.host_state = state;
+  apb_write_32(ADDR_DWL_CTRL_AREA_NCP_STATUS, ncp_state);
+}
+
+/******************************************************
+*                  Firmware message layer
+******************************************************/
+
+static uint16_t control_register(void)
+{
+  uint16_t value = chip.control & SL_WFX_CONT_WUP_BIT;
+
+  if (value != 0 || chip.wake_up_pin) {
+    value |= SL_WFX_CONT_RDY_BIT;
+  }
+  if (chip.output_count > 0) {
+    const output_message_t *message = &chip.output[chip.output_head];
+    value |= (message->length / 2) & SL_WFX_CONT_NEXT_LEN_MASK;
+    value |= message->type << SL_WFX_CONT_FRAME_TYPE_OFFSET;
+  }
+  return value;
+}
+
+static sl_wfx_generic_message_t *output_alloc(uint8_t id, uint16_t length, uint8_t type)
+{
+  output_message_t *message;
+
+  if (chip.output_count == OUTPUT_QUEUE_LENGTH) {
+    chip_error("Output queue overflow");
+    return NULL;
+  }
+  if (length > OUTPUT_MESSAGE_MAX) {
+    chip_error("Output message too large");
+    return NULL;
+  }
+  message = &chip.output[(chip.output_head + chip.output_count) % OUTPUT_QUEUE_LENGTH];
+  chip.output_count++;
+
+  message->length = SL_WFX_ROUND_UP_EVEN(length);
+  memset(message->data, 0, message->length);
+  message->type   = type;
+
+  sl_wfx_generic_message_t *msg = (sl_wfx_generic_message_t *)message->data;
+  msg->header.length = length;
+  msg->header.id     = id;
+  msg->header.info   = 0;
+  return msg;
+}
+
+static void queue_startup_indication(void)
+{
+  sl_wfx_startup_ind_t *ind;
+
+  ind = (sl_wfx_startup_ind_t *)output_alloc(SL_WFX_STARTUP_IND_ID,
+                                             sizeof(sl_wfx_startup_ind_t),
+                                             SL_WFX_INDICATION_MESSAGE);
+  if (ind == NULL) {
+    return;
+  }
+  ind->body.num_inp_ch_bufs  = WFX_CHIP_INPUT_BUFFERS;
+  ind->body.size_inp_ch_buf  = WFX_CHIP_INPUT_BUFFER_SIZE;
+  ind->body.num_interfaces   = 2;
+  ind->body.firmware_major   = 3;
+  ind->body.firmware_minor   = 4;
+  ind->body.firmware_build   = 1;
+  ind->body.api_version_major = 3;
+  memcpy(ind->body.opn, "WF200D", 6);
+  memcpy(ind->body.mac_addr[0], "\x00\x0b\x57\x00\x00\x01", SL_WFX_MAC_ADDR_SIZE);
+  memcpy(ind->body.mac_addr[1], "\x00\x0b\x57\x00\x00\x02", SL_WFX_MAC_ADDR_SIZE);
+  snprintf((char *)ind->body.firmware_label, SL_WFX_FIRMWARE_LABEL_SIZE, "WF200 host model");
+}
+
+static void confirm(uint8_t id)
+{
+  sl_wfx_generic_confirmation_t *cnf;
+
+  cnf = (sl_wfx_generic_confirmation_t *)output_alloc(id,
+                                                      sizeof(sl_wfx_generic_confirmation_t),
+                                                      SL_WFX_CONFIRMATION_MESSAGE);
+  if (cnf != NULL) {
+    cnf->status = 0;
+  }
+}
+
+static void process_request(const uint8_t *frame, uint32_t length)
+{
+  const sl_wfx_generic_message_t *request = (const sl_wfx_generic_message_t *)frame;
+  uint16_t request_length = request->header.length;
+
+  if (!chip.running || (chip.config & SL_WFX_CONFIG_ACCESS_MODE_BIT)) {
+    chip_error("Request written outside of the message mode");
+    return;
+  }
+  if (request_length < sizeof(sl_wfx_header_t) || request_length > length) {
+    chip_error("Request length does not match the SPI frame");
+    return;
+  }
+  if (request_length > WFX_CHIP_INPUT_BUFFER_SIZE) {
+    chip_error("Request larger than an input buffer");
+    return;
+  }
+
+  chip.msg_stats.requests++;
+  chip.buffers_in_use++;
+  if (chip.buffers_in_use > chip.msg_stats.max_buffers) {
+    chip.msg_stats.max_buffers = chip.buffers_in_use;
+  }
+  if (chip.buffers_in_use > WFX_CHIP_INPUT_BUFFERS) {
+    chip_error("Input buffer overflow");
+  }
+
+  switch (request->header.id) {
+    case SL_WFX_SEND_FRAME_REQ_ID: {
+      const sl_wfx_send_frame_req_t *req = (const sl_wfx_send_frame_req_t *)frame;
+      sl_wfx_send_frame_cnf_t *cnf;
+
+      if (sizeof(*req) + req->body.packet_data_length > request_length) {
+        chip_error("Frame longer than its request");
+        break;
+      }
+      chip.tx_frames++;
+      chip.tx_bytes += req->body.packet_data_length;
+      chip.tx_last_length = req->body.packet_data_length;
+      memcpy(chip.tx_last, req->body.packet_data, chip.tx_last_length);
+
+      cnf = (sl_wfx_send_frame_cnf_t *)output_alloc(SL_WFX_SEND_FRAME_CNF_ID,
+                                                    sizeof(sl_wfx_send_frame_cnf_t),
+                                                    SL_WFX_CONFIRMATION_MESSAGE);
+      if (cnf != NULL) {
+        cnf->body.packet_id = req->body.packet_id;
+      }
+      break;
+    }
+    case SL_WFX_START_SCAN_REQ_ID: {
+      sl_wfx_scan_result_ind_t   *result;
+      sl_wfx_scan_complete_ind_t *complete;
+
+      confirm(SL_WFX_START_SCAN_CNF_ID);
+      for (uint32_t i = 0; i < chip.scan_results; i++) {
+        result = (sl_wfx_scan_result_ind_t *)output_alloc(SL_WFX_SCAN_RESULT_IND_ID,
+                                                          sizeof(sl_wfx_scan_result_ind_t) + chip.scan_ie_length,
+                                                          SL_WFX_INDICATION_MESSAGE);
+        if (result == NULL) {
+          break;
+        }
+        result->body.ssid_def.ssid_length = snprintf((char *)result->body.ssid_def.ssid,
+                                                     SL_WFX_SSID_SIZE, "ap-%u", (unsigned)i);
+        result->body.mac[5]         = i;
+        result->body.channel        = 1 + i % 13;
+        result->body.rcpi           = 100 + i % 60;
+        result->body.ie_data_length = chip.scan_ie_length;
+      }
+      complete = (sl_wfx_scan_complete_ind_t *)output_alloc(SL_WFX_SCAN_COMPLETE_IND_ID,
+                                                            sizeof(sl_wfx_scan_complete_ind_t),
+                                                            SL_WFX_INDICATION_MESSAGE);
+      if (complete != NULL) {
+        complete->body.status = 0;
+      }
+      break;
+    }
+    case SL_WFX_SHUT_DOWN_REQ_ID:
+      chip.running = false;
+      chip.buffers_in_use--;
+      break;
+    default:
+      confirm(request->header.id);
+      break;
+  }
+}
+
+/* Fill the IN/OUT queue read with the next output message and the
+   piggy-backed control register */
+static void output_read(uint8_t *data, uint32_t length)
+{
+  output_message_t *message;
+  uint32_t          message_length;
+  uint16_t          control;
+
+  if (chip.output_count == 0) {
+    chip_error("IN/OUT queue read with no pending message");
+    memset(data, 0, length);
+    return;
+  }
+
+  message        = &chip.output[chip.output_head];
+  message_length = message->length;
+  if (length != message_length + SL_WFX_CONT_REGISTER_SIZE) {
+    chip_error("IN/OUT queue read length does not match NEXT_LEN");
+  }
+
+  memset(data, 0, length);
+  memcpy(data, message->data, (length < message_length) ? length : message_length);
+
+  if (message->type == SL_WFX_CONFIRMATION_MESSAGE) {
+    chip.msg_stats.confirmations++;
+    if (chip.buffers_in_use == 0) {
+      chip_error("Confirmation without a request");
+    } else {
+      chip.buffers_in_use--;
+    }
+  } else {
+    chip.msg_stats.indications++;
+  }
+
+  chip.output_head = (chip.output_head + 1) % OUTPUT_QUEUE_LENGTH;
+  chip.output_count--;
+
+  if (length >= message_length + SL_WFX_CONT_REGISTER_SIZE) {
+    control = control_register();
+    data[message_length]     = control;
+    data[message_length + 1] = control >> 8;
+  }
+}
+
+/******************************************************
+*                     SPI register access
+******************************************************/
+
+static void config_write(uint32_t value)
+{
+  uint32_t previous = chip.config;
+
+  if (value & SL_WFX_CONFIG_PRFETCH_BIT) {
+    chip.dport = apb_read_32(chip.sram_address);
+    if (chip.sram_address == ADDR_DWL_CTRL_AREA_GET && chip.host_state == HOST_STATE_UPLOAD_PENDING) {
+      /* The bootloader makes progress while the host polls the FIFO */
+      download_drain(chip.download_drain);
+      chip.dport = apb_read_32(chip.sram_address);
+    }
+    value &= ~SL_WFX_CONFIG_PRFETCH_BIT;
+  }
+
+  if ((previous & SL_WFX_CONFIG_CPU_RESET_BIT) && !(value & SL_WFX_CONFIG_CPU_RESET_BIT)) {
+    apb_write_32(ADDR_DWL_CTRL_AREA_NCP_STATUS, NCP_STATE_NOT_READY);
+  }
+
+  chip.config = value;
+}
+
+/* Prepare the data returned by a read frame */
+static void register_read(uint8_t address, uint8_t *data, uint32_t length)
+{
+  uint16_t control;
+
+  switch (address) {
+    case SL_WFX_CONFIG_REG_ID:
+      memset(data, 0, length);
+      if (length >= 4) {
+        put_le32(data, chip.config);
+        swap_config_bytes(data);
+      }
+      break;
+    case SL_WFX_CONTROL_REG_ID:
+      control = control_register();
+      for (uint32_t i = 0; i + 1 < length; i += 2) {
+        data[i]     = control;
+        data[i + 1] = control >> 8;
+      }
+      break;
+    case SL_WFX_IN_OUT_QUEUE_REG_ID:
+      output_read(data, length);
+      break;
+    case SL_WFX_SRAM_BASE_ADDR_REG_ID:
+      memset(data, 0, length);
+      if (length >= 4) {
+        put_le32(data, chip.sram_address);
+      }
+      break;
+    case SL_WFX_SRAM_DPORT_REG_ID:
+      memset(data, 0, length);
+      if (length >= 4) {
+        put_le32(data, chip.dport);
+      }
+      break;
+    default:
+      chip_error("Read of an unsupported register");
+      memset(data, 0, length);
+      break;
+  }
+}
+
+/* Apply a write frame once the chip select is released */
+static void register_write(uint8_t address, uint8_t *data, uint32_t length)
+{
+  uint8_t *ram;
+
+  switch (address) {
+    case SL_WFX_CONFIG_REG_ID:
+      if (length == 4) {
+        swap_config_bytes(data);
+        config_write(get_le32(data));
+      } else {
+        chip_error("CONFIG write is not 32-bit");
+      }
+      break;
+    case SL_WFX_CONTROL_REG_ID:
+      chip.control = (data[0] | (data[1] << 8)) & SL_WFX_CONT_WUP_BIT;
+      break;
+    case SL_WFX_IN_OUT_QUEUE_REG_ID:
+      process_request(data, length);
+      break;
+    case SL_WFX_SRAM_BASE_ADDR_REG_ID:
+      chip.sram_address = get_le32(data);
+      break;
+    case SL_WFX_SRAM_DPORT_REG_ID:
+      ram = shared_ram(chip.sram_address, length);
+      if (ram != NULL) {
+        memcpy(ram, data, length);
+        if (chip.sram_address == ADDR_DWL_CTRL_AREA_HOST_STATUS && length == 4) {
+          bootloader_host_state(get_le32(data));
+        }
+      }
+      break;
+    case SL_WFX_TSET_GEN_R_W_REG_ID:
+      break;
+    default:
+      chip_error("Write to an unsupported register");
+      break;
+  }
+}
+
+/******************************************************
+*                       Public API
+******************************************************/
+
+uint64_t wfx_chip_image_hash(const uint8_t *data, uint32_t size)
+{
+  uint64_t hash = 0xcbf29ce484222325ULL;
+
+  for (uint32_t i = 0; i < size; i++) {
+    hash = (hash ^ data[i]) * 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+void wfx_chip_reset(void)
+{
+  /* The model settings survive the reset */
+  uint32_t drain          = chip.download_drain;
+  uint32_t scan_results   = chip.scan_results;
+  uint16_t scan_ie_length = chip.scan_ie_length;
+
+  free(chip.image);
+  memset(&chip, 0, sizeof(chip));
+  chip.download_drain = drain;
+  chip.scan_results   = scan_results;
+  chip.scan_ie_length = scan_ie_length;
+  chip.config         = CONFIG_RESET_VALUE;
+  apb_write_32(ADDR_DWL_CTRL_AREA_NCP_STATUS, NCP_STATE_UNDEF);
+}
+
+void wfx_chip_cs_assert(void)
+{
+  if (chip.selected) {
+    chip_error("Chip select asserted twice");
+  }
+  chip.selected    = true;
+  chip.have_header = false;
+  chip.offset      = 0;
+  chip.bus_stats.transactions++;
+}
+
+void wfx_chip_cs_deassert(void)
+{
+  if (!chip.selected) {
+    chip_error("Chip select released twice");
+    return;
+  }
+  chip.selected = false;
+  if (!chip.have_header) {
+    chip_error("Chip select frame without header");
+    return;
+  }
+  if (chip.offset != chip.length) {
+    chip_error("SPI frame length does not match its header");
+  }
+  if (chip.read) {
+    chip.bus_stats.register_reads[chip.address]++;
+  } else {
+    chip.bus_stats.register_writes[chip.address]++;
+    register_write(chip.address, chip.frame, chip.offset);
+  }
+}
+
+void wfx_chip_spi_transfer(bool read,
+                           const uint8_t *header,
+                           uint16_t header_length,
+                           uint8_t *buffer,
+                           uint16_t buffer_length)
+{
+  if (!chip.selected) {
+    chip_error("SPI transfer without chip select");
+    return;
+  }
+
+  if (header_length > 0) {
+    uint16_t value = (header[0] << 8) | header[1];
+
+    if (header_length != 2 || chip.have_header) {
+      chip_error("Unexpected SPI header");
+      return;
+    }
+    chip.have_header = true;
+    chip.read        = (value & SPI_READ_FLAG) != 0;
+    chip.address     = (value >> SPI_ADDRESS_OFFSET) & SPI_ADDRESS_MASK;
+    chip.length      = (value & SPI_WORDS_MASK) * 2;
+    chip.bus_stats.header_bytes += header_length;
+    if (chip.read) {
+      register_read(chip.address, chip.frame, chip.length);
+    }
+  } else if (!chip.have_header) {
+    chip_error("SPI data before the header");
+    return;
+  }
+
+  if (read != chip.read) {
+    chip_error("SPI transfer direction does not match its header");
+    return;
+  }
+  if (chip.offset + buffer_length > chip.length) {
+    chip_error("SPI transfer longer than its header");
+    return;
+  }
+
+  if (read) {
+    memcpy(buffer, &chip.frame[chip.offset], buffer_length);
+    chip.bus_stats.read_bytes += buffer_length;
+  } else {
+    memcpy(&chip.frame[chip.offset], buffer, buffer_length);
+    chip.bus_stats.write_bytes += buffer_length;
+  }
+  chip.offset += buffer_length;
+}
+
+bool wfx_chip_irq_pending(void)
+{
+  return chip.output_count > 0 && (chip.config & SL_WFX_CONFIG_DATA_IRQ_ENABLE);
+}
+
+void wfx_chip_set_wake_up_pin(bool state)
+{
+  chip.wake_up_pin = state;
+}
+
+void wfx_chip_set_download_drain(uint32_t bytes)
+{
+  chip.download_drain = bytes;
+}
+
+const uint8_t *wfx_chip_firmware(uint32_t *size)
+{
+  *size = chip.image_received;
+  return chip.image;
+}
+
+bool wfx_chip_firmware_running(void)
+{
+  return chip.running;
+}
+
+bool wfx_chip_queue_rx_frame(const uint8_t *data, uint16_t length)
+{
+  sl_wfx_received_ind_t *ind;
+
+  if (chip.output_count == OUTPUT_QUEUE_LENGTH) {
+    return false;
+  }
+  ind = (sl_wfx_received_ind_t *)output_alloc(SL_WFX_RECEIVED_IND_ID,
+                                              sizeof(sl_wfx_received_ind_t) + length,
+                                              SL_WFX_ETHERNET_DATA_MESSAGE);
+  if (ind == NULL) {
+    return false;
+  }
+  ind->body.frame_type    = 0;
+  ind->body.frame_padding = 0;
+  ind->body.frame_length  = length;
+  memcpy(ind->body.frame, data, length);
+  return true;
+}
+
+void wfx_chip_set_scan_results(uint32_t count, uint16_t ie_length)
+{
+  chip.scan_results   = count;
+  chip.scan_ie_length = ie_length;
+}
+
+uint32_t wfx_chip_tx_frames(uint32_t *bytes)
+{
+  if (bytes != NULL) {
+    *bytes = chip.tx_bytes;
+  }
+  return chip.tx_frames;
+}
+
+const uint8_t *wfx_chip_last_tx_frame(uint16_t *length)
+{
+  *length = chip.tx_last_length;
+  return chip.tx_last;
+}
+
+const wfx_chip_bus_stats_t *wfx_chip_bus_stats(void)
+{
+  return &chip.bus_stats;
+}
+
+const wfx_chip_msg_stats_t *wfx_chip_msg_stats(void)
+{
+  return &chip.msg_stats;
+}
+
+void wfx_chip_clear_stats(void)
+{
+  uint32_t errors = chip.msg_stats.errors;
+
+  memset(&chip.bus_stats, 0, sizeof(chip.bus_stats));
+  memset(&chip.msg_stats, 0, sizeof(chip.msg_stats));
+  chip.msg_stats.errors      = errors;
+  chip.msg_stats.max_buffers = chip.buffers_in_use;
+}
+
+const char *wfx_chip_last_error(void)
+{
+  return chip.last_error;
+}
@@ -0,0 +1,74 @@
+/*
+ *  In-memory WF200 model, driven through the SPI host API
+ *
+ *  The model decodes the SPI frames written by bus/sl_wfx_bus_spi.c and
+ *  implements the control register (NEXT_LEN, WUP, RDY and frame type bits,
+ *  piggy-backed after each output frame), the IN/OUT queue, the SRAM/APB
+ *  access used by the firmware download and the bootloader handshake. Once
+ *  the firmware is running, requests are confirmed right away and the
+ *  confirmations and indications are queued in the output queue.
+ */
+
+#ifndef WFX_CHIP_H
+#define WFX_CHIP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define WFX_CHIP_KEYSET             0xC0    // Keyset reported in the PTE info
+#define WFX_CHIP_INPUT_BUFFERS      30      // Input buffers reported at startup
+#define WFX_CHIP_INPUT_BUFFER_SIZE  1616    // Input buffer size reported at startup
+#define WFX_CHIP_REGISTER_COUNT     8       // Number of SPI register addresses
+
+/* SPI traffic since the last wfx_chip_reset() or wfx_chip_clear_stats() */
+typedef struct {
+  uint32_t transactions;                              // Chip select frames
+  uint32_t header_bytes;                              // SPI header bytes
+  uint32_t read_bytes;                                // Data bytes read by the host
+  uint32_t write_bytes;                               // Data bytes written by the host
+  uint32_t register_reads[WFX_CHIP_REGISTER_COUNT];   // Read frames per register
+  uint32_t register_writes[WFX_CHIP_REGISTER_COUNT];  // Write frames per register
+} wfx_chip_bus_stats_t;
+
+/* Messages exchanged with the firmware since the last reset */
+typedef struct {
+  uint32_t requests;        // Requests written to the IN/OUT queue
+  uint32_t confirmations;   // Confirmations read by the host
+  uint32_t indications;     // Indications read by the host
+  uint32_t max_buffers;     // Highest number of input buffers in use
+  uint32_t errors;          // Protocol errors, see wfx_chip_last_error()
+} wfx_chip_msg_stats_t;
+
+void wfx_chip_reset(void);
+
+/* SPI access, called by the host API implementation */
+void wfx_chip_cs_assert(void);
+void wfx_chip_cs_deassert(void);
+void wfx_chip_spi_transfer(bool read,
+                           const uint8_t *header,
+                           uint16_t header_length,
+                           uint8_t *buffer,
+                           uint16_t buffer_length);
+bool wfx_chip_irq_pending(void);
+void wfx_chip_set_wake_up_pin(bool state);
+
+/* Firmware download. The image is keyset, signature, hash and body, the hash
+   being wfx_chip_image_hash() of the body in little endian. */
+uint64_t wfx_chip_image_hash(const uint8_t *data, uint32_t size);
+void wfx_chip_set_download_drain(uint32_t bytes);
+const uint8_t *wfx_chip_firmware(uint32_t *size);
+bool wfx_chip_firmware_running(void);
+
+/* Traffic generation */
+bool wfx_chip_queue_rx_frame(const uint8_t *data, uint16_t length);
+void wfx_chip_set_scan_results(uint32_t count, uint16_t ie_length);
+uint32_t wfx_chip_tx_frames(uint32_t *bytes);
+const uint8_t *wfx_chip_last_tx_frame(uint16_t *length);
+
+/* Statistics */
+const wfx_chip_bus_stats_t *wfx_chip_bus_stats(void);
+const wfx_chip_msg_stats_t *wfx_chip_msg_stats(void);
+void wfx_chip_clear_stats(void);
+const char *wfx_chip_last_error(void);
+
+#endif // WFX_CHIP_H
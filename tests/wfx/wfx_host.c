@@ -0,0 +1,360 @@
+/*
+ *  Implementation of the WFx host API on top of the in-memory WF200 model
+ */
+
+#include "wfx_host.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "wfx_chip.h"
+
+static const char *const pds_data[] = {
+  "{a:{a:4,b:0}}",
+  "{b:{a:{a:4,b:0,c:0,d:0,e:A},b:{a:4,b:0,c:0,d:0,e:B}}}",
+  "{j:{a:0,b:0}}",
+};
+
+static struct {
+  const uint8_t *firmware;
+  uint32_t       firmware_size;
+  uint32_t       firmware_offset;
+  uint8_t        waited_event_id;
+  bool           waited_event_received;
+  bool           locked;
+  bool           fail_wake_up_pin;
+  uint16_t       control_register;
+  uint32_t       buffers_in_use;
+  wfx_host_event_callback_t event_callback;
+  wfx_host_stats_t stats;
+  char           last_error[128];
+} host;
+
+static void host_error(const char *error)
+{
+  host.stats.errors++;
+  snprintf(host.last_error, sizeof(host.last_error), "%s", error);
+}
+
+/******************************************************
+*                     Test harness API
+******************************************************/
+
+uint8_t *wfx_host_build_firmware(uint32_t body_size, uint8_t keyset, uint32_t *image_size)
+{
+  uint32_t size  = FW_KEYSET_SIZE + FW_SIGNATURE_SIZE + FW_HASH_SIZE + body_size;
+  uint8_t *image = malloc(size);
+  uint8_t *body  = image + FW_KEYSET_SIZE + FW_SIGNATURE_SIZE + FW_HASH_SIZE;
+  uint32_t seed  = 0x12345678;
+  uint64_t hash;
+  char     keyset_string[FW_KEYSET_SIZE + 1];
+
+  snprintf(keyset_string, sizeof(keyset_string), "KEYSET%02X", keyset);
+  memcpy(image, keyset_string, FW_KEYSET_SIZE);
+  memset(image + FW_KEYSET_SIZE, 0x5A, FW_SIGNATURE_SIZE);
+  for (uint32_t i = 0; i < body_size; i++) {
+    seed    = seed * 1103515245 + 12345;
+    body[i] = seed >> 16;
+  }
+  hash = wfx_chip_image_hash(body, body_size);
+  memcpy(image + FW_KEYSET_SIZE + FW_SIGNATURE_SIZE, &hash, FW_HASH_SIZE);
+
+  *image_size = size;
+  return image;
+}
+
+void wfx_host_set_firmware(const uint8_t *image, uint32_t image_size)
+{
+  host.firmware      = image;
+  host.firmware_size = image_size;
+}
+
+void wfx_host_set_event_callback(wfx_host_event_callback_t callback)
+{
+  host.event_callback = callback;
+}
+
+sl_status_t wfx_host_process(uint32_t *frame_count)
+{
+  if (!wfx_chip_irq_pending() && (host.control_register & SL_WFX_CONT_NEXT_LEN_MASK) == 0) {
+    if (frame_count != NULL) {
+      *frame_count = 0;
+    }
+    return SL_STATUS_WIFI_NO_PACKET_TO_RECEIVE;
+  }
+  return sl_wfx_receive_frames(&host.control_register, 0, frame_count);
+}
+
+const wfx_host_stats_t *wfx_host_stats(void)
+{
+  return &host.stats;
+}
+
+void wfx_host_clear_stats(void)
+{
+  uint32_t errors = host.stats.errors;
+
+  memset(&host.stats, 0, sizeof(host.stats));
+  host.stats.errors = errors;
+}
+
+const char *wfx_host_last_error(void)
+{
+  return host.last_error;
+}
+
+uint32_t wfx_host_buffers_in_use(void)
+{
+  return host.buffers_in_use;
+}
+
+void wfx_host_fail_wake_up_pin(bool fail)
+{
+  host.fail_wake_up_pin = fail;
+}
+
+/******************************************************
+*                   Driver host API
+******************************************************/
+
+sl_status_t sl_wfx_host_init(void)
+{
+  host.firmware_offset = 0;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_get_firmware_data(const uint8_t **data, uint32_t data_size)
+{
+  if (host.firmware_offset + data_size > host.firmware_size) {
+    host_error("Firmware read past its end");
+    return SL_STATUS_FAIL;
+  }
+  *data = host.firmware + host.firmware_offset;
+  host.firmware_offset += data_size;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_get_firmware_size(uint32_t *firmware_size)
+{
+  *firmware_size = host.firmware_size;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_get_pds_data(const char **pds, uint16_t index)
+{
+  *pds = pds_data[index];
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_get_pds_size(uint16_t *pds_size)
+{
+  *pds_size = sizeof(pds_data) / sizeof(pds_data[0]);
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_deinit(void)
+{
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_reset_chip(void)
+{
+  wfx_chip_reset();
+  host.control_register = 0;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_set_wake_up_pin(uint8_t state)
+{
+  if (host.fail_wake_up_pin) {
+    return SL_STATUS_FAIL;
+  }
+  wfx_chip_set_wake_up_pin(state != 0);
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_wait_for_wake_up(void)
+{
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_sleep_grant(sl_wfx_host_bus_transfer_type_t type,
+                                    sl_wfx_register_address_t address,
+                                    uint32_t length)
+{
+  return SL_STATUS_WIFI_SLEEP_NOT_GRANTED;
+}
+
+sl_status_t sl_wfx_host_hold_in_reset(void)
+{
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_setup_waited_event(uint8_t event_id)
+{
+  host.waited_event_id       = event_id;
+  host.waited_event_received = false;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_wait_for_confirmation(uint8_t confirmation_id,
+                                              uint32_t timeout_ms,
+                                              void **event_payload_out)
+{
+  sl_status_t result;
+
+  for (uint32_t i = 0; i <= timeout_ms; i++) {
+    if (host.waited_event_received && host.waited_event_id == confirmation_id) {
+      if (event_payload_out != NULL) {
+        *event_payload_out = sl_wfx_context->event_payload_buffer;
+      }
+      return SL_STATUS_OK;
+    }
+    result = wfx_host_process(NULL);
+    if (result == SL_STATUS_WIFI_NO_PACKET_TO_RECEIVE) {
+      sl_wfx_host_wait(1);
+    } else if (result != SL_STATUS_OK) {
+      return result;
+    }
+  }
+  return SL_STATUS_TIMEOUT;
+}
+
+sl_status_t sl_wfx_host_wait(uint32_t wait_ms)
+{
+  host.stats.waits++;
+  host.stats.wait_ms += wait_ms;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_post_event(sl_wfx_generic_message_t *event_payload)
+{
+  host.stats.events++;
+
+  if (host.event_callback != NULL) {
+    host.event_callback(event_payload);
+  }
+
+  if (event_payload->header.id == host.waited_event_id) {
+    if (event_payload->header.length > sizeof(sl_wfx_context->event_payload_buffer)) {
+      host_error("Waited event larger than the payload buffer");
+      return SL_STATUS_FAIL;
+    }
+    memcpy(sl_wfx_context->event_payload_buffer, event_payload, event_payload->header.length);
+    host.waited_event_received = true;
+  }
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_allocate_buffer(void **buffer,
+                                        sl_wfx_buffer_type_t type,
+                                        uint32_t buffer_size)
+{
+  *buffer = malloc(buffer_size);
+  if (*buffer == NULL) {
+    return SL_STATUS_NO_MORE_RESOURCE;
+  }
+  host.stats.allocations++;
+  host.buffers_in_use++;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_free_buffer(void *buffer, sl_wfx_buffer_type_t type)
+{
+  if (buffer == NULL || host.buffers_in_use == 0) {
+    host_error("Free of a buffer that was not allocated");
+    return SL_STATUS_FAIL;
+  }
+  host.buffers_in_use--;
+  free(buffer);
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_transmit_frame(void *frame, uint32_t frame_len)
+{
+  return sl_wfx_data_write(frame, frame_len);
+}
+
+sl_status_t sl_wfx_host_lock(void)
+{
+  if (host.locked) {
+    host_error("Driver lock taken twice");
+    return SL_STATUS_NO_MORE_RESOURCE;
+  }
+  host.locked = true;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_unlock(void)
+{
+  if (!host.locked) {
+    host_error("Driver lock released twice");
+    return SL_STATUS_FAIL;
+  }
+  host.locked = false;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_init_bus(void)
+{
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_deinit_bus(void)
+{
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_enable_platform_interrupt(void)
+{
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_disable_platform_interrupt(void)
+{
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_spi_cs_assert(void)
+{
+  wfx_chip_cs_assert();
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_spi_cs_deassert(void)
+{
+  wfx_chip_cs_deassert();
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wfx_host_spi_transfer_no_cs_assert(sl_wfx_host_bus_transfer_type_t type,
+                                                  uint8_t *header,
+                                                  uint16_t header_length,
+                                                  uint8_t *buffer,
+                                                  uint16_t buffer_length)
+{
+  wfx_chip_spi_transfer(type == SL_WFX_BUS_READ, header, header_length, buffer, buffer_length);
+  return SL_STATUS_OK;
+}
+
+uint32_t sl_wfx_host_get_time_us(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)(now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+}
+
+#if SL_WFX_DEBUG_MASK
+void sl_wfx_host_log(const char *string, ...)
+{
+  va_list args;
+
+  va_start(args, string);
+  vfprintf(stderr, string, args);
+  va_end(args);
+}
+#endif
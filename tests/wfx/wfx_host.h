@@ -0,0 +1,44 @@
+/*
+ *  Implementation of the WFx host API on top of the in-memory WF200 model
+ *
+ *  The host polls the model instead of waiting for an interrupt. It reads
+ *  frames only when the model interrupt is pending or the piggy-backed
+ *  control register announces one, so the bus traffic matches an interrupt
+ *  driven host. sl_wfx_host_wait() does not sleep, it only counts the
+ *  requested milliseconds.
+ */
+
+#ifndef WFX_HOST_H
+#define WFX_HOST_H
+
+#include "sl_wfx.h"
+
+typedef void (*wfx_host_event_callback_t)(const sl_wfx_generic_message_t *event);
+
+typedef struct {
+  uint32_t events;        // Messages posted by the driver
+  uint32_t allocations;   // Buffers allocated by the driver
+  uint32_t waits;         // Calls to sl_wfx_host_wait()
+  uint32_t wait_ms;       // Milliseconds requested through sl_wfx_host_wait()
+  uint32_t errors;        // Host API misuse, see wfx_host_last_error()
+} wfx_host_stats_t;
+
+/* Build a firmware image around a pseudo-random body of body_size bytes,
+   free it with free() */
+uint8_t *wfx_host_build_firmware(uint32_t body_size, uint8_t keyset, uint32_t *image_size);
+void wfx_host_set_firmware(const uint8_t *image, uint32_t image_size);
+
+void wfx_host_set_event_callback(wfx_host_event_callback_t callback);
+
+/* Read the frames pending in the model, as the bus task of a real host does */
+sl_status_t wfx_host_process(uint32_t *frame_count);
+
+const wfx_host_stats_t *wfx_host_stats(void);
+void wfx_host_clear_stats(void);
+const char *wfx_host_last_error(void);
+uint32_t wfx_host_buffers_in_use(void);
+
+/* Make sl_wfx_host_set_wake_up_pin() fail, to exercise driver error paths */
+void wfx_host_fail_wake_up_pin(bool fail);
+
+#endif // WFX_HOST_H